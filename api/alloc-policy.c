@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2021, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Huge-page allocation policy of fftw_malloc and of the buffers and
+   twiddle tables allocated by the plans; see kernel/kalloc.c. */
+
+#include "api/api.h"
+
+void X(set_alloc_policy)(int policy, size_t threshold)
+{
+     int m;
+
+     switch (policy) {
+	 case FFTW_ALLOC_THP: m = ALLOC_THP; break;
+	 case FFTW_ALLOC_HUGETLB: m = ALLOC_HUGETLB; break;
+	 default: m = ALLOC_DEFAULT; break;
+     }
+     X(kernel_set_alloc_policy)(m, threshold);
+}
+
+void X(get_alloc_stats)(X(alloc_stats) *stats)
+{
+     X(kernel_alloc_stats)(&stats->thp, &stats->hugetlb, &stats->peak,
+			   &stats->nalloc);
+}
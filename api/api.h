@@ -64,6 +64,10 @@ struct X(plan_s) {
      plan *pln;
      problem *prb;
      int sign;
+     struct profile_s *profile; /* see profile-plan.c, 0 if not profiling */
+     char *scratch; /* arena for the buffers of PLN, 0 if none */
+     size_t scratch_n;
+     int scratch_busy; /* nonzero while an execution uses SCRATCH */
 };
 
 /* shorthand */
@@ -111,12 +115,27 @@ apiplan *X(mkapiplan)(int sign, unsigned flags, problem *prb);
 apiplan *X(mkapiplan_ex)(int sign, unsigned flags, int n, problem *prb);
 #endif
 
+int X(apiplan_scratch_enter)(apiplan *p, scratch_arena *saved);
+void X(apiplan_scratch_leave)(apiplan *p, int entered,
+			      const scratch_arena *saved);
+
 rdft_kind *X(map_r2r_kind)(int rank, const X(r2r_kind) * kind);
 
 typedef void (*planner_hook_t)(void);
                                                      
 void X(set_planner_hooks)(planner_hook_t before, planner_hook_t after);
 
+void X(wisdom_store_load)(void);
+void X(wisdom_store_save)(void);
+void X(wisdom_store_forget)(void);
+void X(release_wisdom_mmap)(void);
+void *X(map_file)(const char *filename, size_t *szp);
+void X(unmap_file)(void *p, size_t sz);
+void X(twiddle_file_attach)(void);
+void X(release_twiddles_mmap)(void);
+void X(planner_trace_attach)(planner *plnr);
+void X(planner_trace_cleanup)(void);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif /* __cplusplus */
@@ -39,60 +39,10 @@ void X(set_planner_hooks)(planner_hook_t before, planner_hook_t after)
      after_planner_hook = after;
 }
 
-#ifdef AMD_TOP_N_PLANNER
-plan *plans[AMD_OPT_TOP_N];
-static int find_lowcost_plan()
-{
-    int i, lowcost, lowcost_id;
-    lowcost = plans[0]->pcost;
-    lowcost_id = 0;
-
-    for (i = 1; i < AMD_OPT_TOP_N; i++) {
-         if (plans[i]->pcost < lowcost) {
-              lowcost = plans[i]->pcost;
-              lowcost_id = i;
-         }
-    }
-    return lowcost_id;
-}
-#endif
-
 static plan *mkplan0(planner *plnr, unsigned flags,
 		     const problem *prb, unsigned hash_info,
 		     wisdom_state_t wisdom_state)
 {
-#ifdef AMD_TOP_N_PLANNER
-     static int lowcost_idx;	/* to hold the index of the plan which has the least pcost among the top N plans*/     
-/* map API flags into FFTW flags */
-     X(mapflags)(plnr, flags);
-
-     plnr->flags.hash_info = hash_info;
-     plnr->wisdom_state = wisdom_state;
-     
-     /* create plan */
-
-     if (AMD_OPT_TOP_N > 1) {
-          if (wisp_set == 1) {
-               for (int pln_idx = 0; pln_idx < AMD_OPT_TOP_N ; pln_idx ++) {
-                    plnr->index = pln_idx;
-	            plans[pln_idx] = plnr->adt->mkplan(plnr, prb);
-               }
-               lowcost_idx = find_lowcost_plan(plans);
-               return plans[lowcost_idx];
-          }
-          else {        
-               for (int pln_idx = 0; pln_idx < AMD_OPT_TOP_N ; pln_idx ++) {
-                    plnr->index = pln_idx;
-	            plans[pln_idx] = plnr->adt->mkplan(plnr, prb);
-               }	   
-	       return plans[0];
-          }
-     }   
-     else {
-          plnr->index = 0;
-          return plnr->adt->mkplan(plnr, prb);
-     }	
-#else	
      /* map API flags into FFTW flags */
      X(mapflags)(plnr, flags);
 
@@ -100,8 +50,11 @@ static plan *mkplan0(planner *plnr, unsigned flags,
      plnr->wisdom_state = wisdom_state;
 
      /* create plan */
+#ifdef AMD_TOP_N_PLANNER
+     return X(mkplan_top_n)(plnr, prb);
+#else
      return plnr->adt->mkplan(plnr, prb);
-#endif     
+#endif
 }
 
 static unsigned force_estimator(unsigned flags)
@@ -184,12 +137,10 @@ static int create_amd_app_layer(int sign, unsigned *flags, problem *prb, app_lay
         /* 
 	 * Enable applications to use the wisdom file if already present.
          * If the wisdom file is not availabe/applicable, the planner creates
-         * a new plan for the problem.
+         * a new plan for the problem.  The file is read only once per
+         * process, see X(set_wisdom_store).
          */
-        if (!X(import_wisdom_from_filename)("wis.dat"))
-        {
-		 //fprintf(stderr, "apiplan: ERROR reading wisdom wis.dat\n");
-	}
+        X(wisdom_store_load)();
 #endif
 	if(prb->adt->problem_kind == PROBLEM_DFT)
 	{
@@ -429,11 +380,11 @@ static void destroy_amd_app_layer(problem *prb, app_layer_data *app_layer)
 #ifdef AMD_APP_OPT_GENERATE_WISDOM
        /*
         * The write permission is set by the planner to export wisdom.
-        * The newly generated plan is exported to the wisdom file.
+        * The newly generated plan is appended to the wisdom file.
         */
        if (wisdom_write_set)
        {
-		X(export_wisdom_to_filename)("wis.dat");
+		X(wisdom_store_save)();
 		wisdom_write_set = 0;
        }
 #endif
@@ -496,6 +447,62 @@ static void destroy_amd_app_layer(problem *prb, app_layer_data *app_layer)
  */
 #endif
 
+/* Awaken the plan of P, and reserve the arena for its buffers */
+static void awake_plan(apiplan *p)
+{
+     X(scratch_layout_begin)();
+     if (sizeof(trigreal) > sizeof(R)) {
+	  /* this is probably faster, and we have enough trigreal
+	     bits to maintain accuracy */
+	  X(plan_awake)(p->pln, AWAKE_SQRTN_TABLE);
+     } else {
+	  /* more accurate */
+	  X(plan_awake)(p->pln, AWAKE_SINCOS);
+     }
+     p->scratch_n = X(scratch_layout_end)();
+     p->scratch = p->scratch_n ? (char *) MALLOC(p->scratch_n, BUFFERS) : 0;
+     p->scratch_busy = 0;
+}
+
+#if defined(__GNUC__)
+#  define ARENA_TRYLOCK(p) (!__atomic_exchange_n(&(p)->scratch_busy, 1, \
+						 __ATOMIC_ACQUIRE))
+#  define ARENA_UNLOCK(p) __atomic_store_n(&(p)->scratch_busy, 0, \
+					   __ATOMIC_RELEASE)
+#else
+   /* without atomics, executions allocate their buffers */
+#  define ARENA_TRYLOCK(p) 0
+#  define ARENA_UNLOCK(p)
+#endif
+
+/* Install the arena of P for an execution of P, unless a concurrent
+   execution holds it.  Return nonzero if the arena was installed. */
+int X(apiplan_scratch_enter)(apiplan *p, scratch_arena *saved)
+{
+     scratch_arena a;
+
+     if (!p->scratch || !ARENA_TRYLOCK(p))
+	  return 0;
+     a.base = p->scratch;
+     a.n = p->scratch_n;
+     X(scratch_enter)(&a, saved);
+     return 1;
+}
+
+void X(apiplan_scratch_leave)(apiplan *p, int entered,
+			      const scratch_arena *saved)
+{
+     if (entered) {
+	  X(scratch_leave)(saved);
+	  ARENA_UNLOCK(p);
+     }
+}
+
+size_t X(plan_scratch_size)(const X(plan) p)
+{
+     return p->scratch_n;
+}
+
 apiplan *X(mkapiplan)(int sign, unsigned flags, problem *prb)
 {
      apiplan *p = 0;
@@ -505,7 +512,7 @@ apiplan *X(mkapiplan)(int sign, unsigned flags, problem *prb)
      static const unsigned int pats[] = {FFTW_ESTIMATE, FFTW_MEASURE,
                                          FFTW_PATIENT, FFTW_EXHAUSTIVE};
      int pat, pat_max;
-     double pcost = 0;
+     double pcost = 0, pvar = 0;
 	 
 #ifdef AMD_APP_OPT_LAYER
      app_layer_data app_layer;
@@ -551,6 +558,7 @@ apiplan *X(mkapiplan)(int sign, unsigned flags, problem *prb)
 	       pln = pln1;
 	       flags_used_for_planning = tmpflags;
 	       pcost = pln->pcost;
+	       pvar = pln->pvar;
 	  }
      }
 
@@ -559,21 +567,16 @@ apiplan *X(mkapiplan)(int sign, unsigned flags, problem *prb)
 	  p = (apiplan *) MALLOC(sizeof(apiplan), PLANS);
 	  p->prb = prb;
 	  p->sign = sign; /* cache for execute_dft */
+	  p->profile = 0;
 
 	  /* re-create plan from wisdom, adding blessing */
 	  p->pln = mkplan(plnr, flags_used_for_planning, prb, BLESSING);
 
 	  /* record pcost from most recent measurement for use in X(cost) */
 	  p->pln->pcost = pcost;
+	  p->pln->pvar = pvar;
 
-	  if (sizeof(trigreal) > sizeof(R)) {
-	       /* this is probably faster, and we have enough trigreal
-		  bits to maintain accuracy */
-	       X(plan_awake)(p->pln, AWAKE_SQRTN_TABLE);
-	  } else {
-	       /* more accurate */
-	       X(plan_awake)(p->pln, AWAKE_SINCOS);
-	  }
+	  awake_plan(p);
 
 	  /* we don't use pln for p->pln, above, since by re-creating the
 	     plan we might use more patient wisdom from a timed-out mkplan */
@@ -607,7 +610,7 @@ apiplan *X(mkapiplan_ex)(int sign, unsigned flags, int n, problem *prb)
      static const unsigned int pats[] = {FFTW_ESTIMATE, FFTW_MEASURE,
                                          FFTW_PATIENT, FFTW_EXHAUSTIVE};
      int pat, pat_max;
-     double pcost = 0;
+     double pcost = 0, pvar = 0;
 	 
 #ifdef AMD_APP_OPT_LAYER
      app_layer_data app_layer;
@@ -653,6 +656,7 @@ apiplan *X(mkapiplan_ex)(int sign, unsigned flags, int n, problem *prb)
 	       pln = pln1;
 	       flags_used_for_planning = tmpflags;
 	       pcost = pln->pcost;
+	       pvar = pln->pvar;
 	  }
      }
 
@@ -661,21 +665,16 @@ apiplan *X(mkapiplan_ex)(int sign, unsigned flags, int n, problem *prb)
 	  p = (apiplan *) MALLOC(sizeof(apiplan), PLANS);
 	  p->prb = prb;
 	  p->sign = sign; /* cache for execute_dft */
+	  p->profile = 0;
 
 	  /* re-create plan from wisdom, adding blessing */
 	  p->pln = mkplan(plnr, flags_used_for_planning, prb, BLESSING);
 
 	  /* record pcost from most recent measurement for use in X(cost) */
 	  p->pln->pcost = pcost;
+	  p->pln->pvar = pvar;
 
-	  if (sizeof(trigreal) > sizeof(R)) {
-	       /* this is probably faster, and we have enough trigreal
-		  bits to maintain accuracy */
-	       X(plan_awake)(p->pln, AWAKE_SQRTN_TABLE);
-	  } else {
-	       /* more accurate */
-	       X(plan_awake)(p->pln, AWAKE_SINCOS);
-	  }
+	  awake_plan(p);
 
 	  /* we don't use pln for p->pln, above, since by re-creating the
 	     plan we might use more patient wisdom from a timed-out mkplan */
@@ -705,7 +704,9 @@ void X(destroy_plan)(X(plan) p)
           if (before_planner_hook)
                before_planner_hook();
      
+          X(plan_profile_stop)(p);
           X(plan_awake)(p->pln, SLEEPY);
+          X(ifree0)(p->scratch);
           X(plan_destroy_internal)(p->pln);
           X(problem_destroy)(p->prb);
           X(ifree)(p);
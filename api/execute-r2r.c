@@ -25,5 +25,9 @@
 void X(execute_r2r)(const X(plan) p, R *in, R *out)
 {
      plan_rdft *pln = (plan_rdft *) p->pln;
+     scratch_arena saved;
+     int entered = X(apiplan_scratch_enter)(p, &saved);
+
      pln->apply((plan *) pln, in, out);
+     X(apiplan_scratch_leave)(p, entered, &saved);
 }
@@ -26,5 +26,9 @@ void X(execute_split_dft_c2r)(const X(plan) p, R *ri, R *ii, R *out)
 {
      plan_rdft2 *pln = (plan_rdft2 *) p->pln;
      problem_rdft2 *prb = (problem_rdft2 *) p->prb;
+     scratch_arena saved;
+     int entered = X(apiplan_scratch_enter)(p, &saved);
+
      pln->apply((plan *) pln, out, out + (prb->r1 - prb->r0), ri, ii);
+     X(apiplan_scratch_leave)(p, entered, &saved);
 }
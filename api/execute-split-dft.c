@@ -25,5 +25,9 @@
 void X(execute_split_dft)(const X(plan) p, R *ri, R *ii, R *ro, R *io)
 {
      plan_dft *pln = (plan_dft *) p->pln;
+     scratch_arena saved;
+     int entered = X(apiplan_scratch_enter)(p, &saved);
+
      pln->apply((plan *) pln, ri, ii, ro, io);
+     X(apiplan_scratch_leave)(p, entered, &saved);
 }
@@ -23,5 +23,21 @@
 void X(execute)(const X(plan) p)
 {
      plan *pln = p->pln;
+     scratch_arena saved;
+     int entered = X(apiplan_scratch_enter)(p, &saved);
+
+     pln->adt->solve(pln, p->prb);
+     X(apiplan_scratch_leave)(p, entered, &saved);
+}
+
+void X(execute_with_scratch)(const X(plan) p, void *scratch)
+{
+     plan *pln = p->pln;
+     scratch_arena a, saved;
+
+     a.base = (char *) scratch;
+     a.n = scratch ? p->scratch_n : 0;
+     X(scratch_enter)(&a, &saved);
      pln->adt->solve(pln, p->prb);
+     X(scratch_leave)(&saved);
 }
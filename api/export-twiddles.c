@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2021, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Write the twiddle factors of the plans that exist into FILENAME, for
+   X(import_twiddles_mmap). */
+
+#include "api/api.h"
+
+int X(export_twiddles)(const char *filename)
+{
+     size_t sz = X(twiddle_export)(0);
+     void *buf = MALLOC(sz, OTHER);
+     FILE *f;
+     int ret;
+
+     X(twiddle_export)(buf);
+     f = fopen(filename, "wb");
+     if (!f) {
+	  X(ifree)(buf);
+	  return 0; /* error opening file */
+     }
+     ret = (fwrite(buf, 1, sz, f) == sz);
+     if (fclose(f)) ret = 0; /* error closing file */
+     X(ifree)(buf);
+     return ret;
+}
@@ -118,6 +118,28 @@ struct fftw_iodim64_do_not_use_me {
      ptrdiff_t os;			/* output stride */
 };
 
+/* planner statistics, see fftw_get_planner_stats */
+struct fftw_planner_stats_do_not_use_me {
+     double nprob;              /* problems planned, incl. subproblems */
+     double nsearch;            /* of which were not found in wisdom */
+     double nplan;              /* plans evaluated */
+     double ntimeout;           /* times the time limit was hit */
+     double pcost, epcost;      /* total cost of measured/estimated plans */
+     double lookup, succ_lookup, lookup_iter;   /* wisdom hash tables */
+     double insert, insert_iter, insert_unknown;
+     double nrehash;
+     double nelem, hashsiz;     /* solutions in the tables, and slots */
+     double nswap;              /* recycled tables of unblessed solutions */
+};
+
+/* huge-page allocation statistics, see fftw_get_alloc_stats */
+struct fftw_alloc_stats_do_not_use_me {
+     size_t thp;                /* bytes advised to use transparent huge pages */
+     size_t hugetlb;            /* bytes mapped from hugetlbfs */
+     size_t peak;               /* maximum of thp + hugetlb */
+     size_t nalloc;             /* blocks allocated either way */
+};
+
 typedef void (FFTW_CDECL *fftw_write_char_func_do_not_use_me)(char c, void *);
 typedef int (FFTW_CDECL *fftw_read_char_func_do_not_use_me)(void *);
 
@@ -138,6 +160,8 @@ typedef struct X(plan_s) *X(plan);                                      \
                                                                         \
 typedef struct fftw_iodim_do_not_use_me X(iodim);                       \
 typedef struct fftw_iodim64_do_not_use_me X(iodim64);                   \
+typedef struct fftw_planner_stats_do_not_use_me X(planner_stats);       \
+typedef struct fftw_alloc_stats_do_not_use_me X(alloc_stats);           \
                                                                         \
 typedef enum fftw_r2r_kind_do_not_use_me X(r2r_kind);                   \
                                                                         \
@@ -147,6 +171,12 @@ typedef fftw_read_char_func_do_not_use_me X(read_char_func);            \
 FFTW_EXTERN void                                                        \
 FFTW_CDECL X(execute)(const X(plan) p);                                 \
                                                                         \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(execute_with_scratch)(const X(plan) p, void *scratch);     \
+                                                                        \
+FFTW_EXTERN size_t                                                      \
+FFTW_CDECL X(plan_scratch_size)(const X(plan) p);                       \
+                                                                        \
 FFTW_EXTERN X(plan)                                                     \
 FFTW_CDECL X(plan_dft)(int rank, const int *n,                          \
                        C *in, C *out, int sign, unsigned flags);        \
@@ -383,6 +413,22 @@ FFTW_EXTERN void                                                        \
 FFTW_CDECL X(set_timelimit)(double t);                                  \
                                                                         \
 FFTW_EXTERN void                                                        \
+FFTW_CDECL X(set_timing_confidence)(double rel_ci, double stability);   \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(plan_with_top_n)(int n);                                   \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(plan_with_cache_pressure)(size_t cache_per_thread,         \
+                                       size_t pressure);                \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(set_cache_sizes)(size_t l1d, size_t l2, size_t l3);        \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(get_cache_sizes)(size_t *l1d, size_t *l2, size_t *l3);     \
+                                                                        \
+FFTW_EXTERN void                                                        \
 FFTW_CDECL X(plan_with_nthreads)(int nthreads);                         \
                                                                         \
 FFTW_EXTERN int                                                         \
@@ -400,11 +446,35 @@ FFTW_CDECL X(threads_set_callback)(                                     \
      char *jobdata, size_t elsize, int njobs, void *data), void *data); \
                                                                         \
 FFTW_EXTERN void                                                        \
+FFTW_CDECL X(threads_set_work_stealing)(int enable);                    \
+                                                                        \
+FFTW_EXTERN int                                                         \
+FFTW_CDECL X(plan_with_affinity)(const int *cpus, int ncpus);           \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(plan_with_parallel_planner)(int nworkers);                 \
+                                                                        \
+FFTW_EXTERN void                                                        \
 FFTW_CDECL X(make_planner_thread_safe)(void);                           \
                                                                         \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(set_wisdom_store)(const char *filename);                   \
+                                                                        \
 FFTW_EXTERN int                                                         \
 FFTW_CDECL X(export_wisdom_to_filename)(const char *filename);          \
                                                                         \
+FFTW_EXTERN int                                                         \
+FFTW_CDECL X(export_wisdom_binary)(const char *filename);               \
+                                                                        \
+FFTW_EXTERN int                                                         \
+FFTW_CDECL X(import_wisdom_mmap)(const char *filename);                 \
+                                                                        \
+FFTW_EXTERN int                                                         \
+FFTW_CDECL X(export_twiddles)(const char *filename);                    \
+                                                                        \
+FFTW_EXTERN int                                                         \
+FFTW_CDECL X(import_twiddles_mmap)(const char *filename);               \
+                                                                        \
 FFTW_EXTERN void                                                        \
 FFTW_CDECL X(export_wisdom_to_file)(FILE *output_file);                 \
                                                                         \
@@ -438,6 +508,27 @@ FFTW_CDECL X(print_plan)(const X(plan) p);                              \
 FFTW_EXTERN char *                                                      \
 FFTW_CDECL X(sprint_plan)(const X(plan) p);                             \
                                                                         \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(plan_profile_start)(X(plan) p);                            \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(plan_profile_stop)(X(plan) p);                             \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(plan_profile_fprint)(const X(plan) p, FILE *output_file);  \
+                                                                        \
+FFTW_EXTERN char *                                                      \
+FFTW_CDECL X(plan_profile_sprint)(const X(plan) p);                     \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(get_planner_stats)(X(planner_stats) *stats);               \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(reset_planner_stats)(void);                                \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(set_planner_trace)(const char *filename);                  \
+                                                                        \
 FFTW_EXTERN void *                                                      \
 FFTW_CDECL X(malloc)(size_t n);                                         \
                                                                         \
@@ -450,6 +541,12 @@ FFTW_EXTERN void                                                        \
 FFTW_CDECL X(free)(void *p);                                            \
                                                                         \
 FFTW_EXTERN void                                                        \
+FFTW_CDECL X(set_alloc_policy)(int policy, size_t threshold);           \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(get_alloc_stats)(X(alloc_stats) *stats);                   \
+                                                                        \
+FFTW_EXTERN void                                                        \
 FFTW_CDECL X(flops)(const X(plan) p,                                    \
                     double *add, double *mul, double *fmas);            \
 FFTW_EXTERN double                                                      \
@@ -496,6 +593,11 @@ FFTW_DEFINE_API(FFTW_MANGLE_QUAD, __float128, fftwq_complex)
 
 #define FFTW_NO_TIMELIMIT (-1.0)
 
+/* policies of fftw_set_alloc_policy */
+#define FFTW_ALLOC_DEFAULT 0
+#define FFTW_ALLOC_THP 1
+#define FFTW_ALLOC_HUGETLB 2
+
 /* documented flags */
 #define FFTW_MEASURE (0U)
 #define FFTW_DESTROY_INPUT (1U << 0)
@@ -24,4 +24,6 @@ void X(forget_wisdom)(void)
 {
      planner *plnr = X(the_planner)();
      plnr->adt->forget(plnr, FORGET_EVERYTHING);
+     X(wisdom_store_forget)();
+     X(release_wisdom_mmap)();
 }
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2021, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Import twiddle factors (see X(export_twiddles)) by mapping the file
+   read-only.  Plans awakened afterwards use the tables of the file in
+   place instead of computing them, and the pages of the file are
+   shared by all processes on a node.  The file named by the
+   environment variable FFTW_TWIDDLE_FILE is imported when the planner
+   is created. */
+
+#include "api/api.h"
+#include <stdlib.h>
+
+#define TWIDDLE_ENV "FFTW_TWIDDLE_FILE"
+
+/* the image currently attached, if any */
+static void *img = 0;
+static size_t img_sz = 0;
+static int env_done = 0;
+
+int X(import_twiddles_mmap)(const char *filename)
+{
+     size_t sz;
+     void *p = X(map_file)(filename, &sz);
+
+     if (!p)
+	  return 0;
+
+     if (!X(twiddle_map)(p, sz)) {
+	  X(unmap_file)(p, sz);
+	  return 0;
+     }
+
+     /* the tables of the previous image that are in use were copied
+	into memory by X(twiddle_map) */
+     if (img)
+	  X(unmap_file)(img, img_sz);
+     img = p;
+     img_sz = sz;
+     return 1;
+}
+
+/* called when the API planner is created */
+void X(twiddle_file_attach)(void)
+{
+     if (!env_done) {
+	  const char *env = getenv(TWIDDLE_ENV);
+	  env_done = 1;
+	  if (env && *env)
+	       X(import_twiddles_mmap)(env);
+     }
+}
+
+/* called by X(cleanup), when no plan is left */
+void X(release_twiddles_mmap)(void)
+{
+     X(twiddle_unmap)();
+     if (img) {
+	  X(unmap_file)(img, img_sz);
+	  img = 0;
+	  img_sz = 0;
+     }
+     env_done = 0;
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2021, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Import binary wisdom (see X(export_wisdom_binary)) by mapping the
+   file read-only.  The planner probes the mapped image directly, so
+   importing costs the same regardless of the amount of wisdom, and
+   the pages of the file are shared by all processes on a node. */
+
+#include "api/api.h"
+
+#if defined(HAVE_UNISTD_H) && !defined(_WIN32)
+#  define HAVE_WISDOM_MMAP 1
+#  include <unistd.h>
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#endif
+
+/* the image currently attached to the planner, if any */
+static void *img = 0;
+static size_t img_sz = 0;
+
+void X(unmap_file)(void *p, size_t sz)
+{
+#ifdef HAVE_WISDOM_MMAP
+     munmap(p, sz);
+#else
+     UNUSED(sz);
+     X(ifree)(p);
+#endif
+}
+
+/* map FILENAME read-only, or read it into memory where mmap() is not
+   available; return 0 on error */
+void *X(map_file)(const char *filename, size_t *szp)
+{
+#ifdef HAVE_WISDOM_MMAP
+     struct stat st;
+     void *p;
+     int fd = open(filename, O_RDONLY);
+
+     if (fd < 0)
+	  return 0;
+     if (fstat(fd, &st) || st.st_size <= 0) {
+	  close(fd);
+	  return 0;
+     }
+     p = mmap(0, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+     close(fd);
+     if (p == MAP_FAILED)
+	  return 0;
+     *szp = (size_t) st.st_size;
+     return p;
+#else
+     FILE *f = fopen(filename, "rb");
+     void *p;
+     long n;
+
+     if (!f)
+	  return 0;
+     if (fseek(f, 0, SEEK_END) || (n = ftell(f)) <= 0) {
+	  fclose(f);
+	  return 0;
+     }
+     rewind(f);
+     p = MALLOC((size_t) n, OTHER);
+     if (fread(p, 1, (size_t) n, f) != (size_t) n) {
+	  X(ifree)(p);
+	  p = 0;
+     }
+     fclose(f);
+     *szp = (size_t) n;
+     return p;
+#endif
+}
+
+int X(import_wisdom_mmap)(const char *filename)
+{
+     planner *plnr = X(the_planner)();
+     size_t sz;
+     void *p = X(map_file)(filename, &sz);
+
+     if (!p)
+	  return 0;
+
+     if (!X(planner_map_wisdom)(plnr, p, sz)) {
+	  X(unmap_file)(p, sz);
+	  return 0;
+     }
+
+     /* the records of the previous image, if any, were copied into
+	the planner by X(planner_map_wisdom) */
+     if (img)
+	  X(unmap_file)(img, img_sz);
+     img = p;
+     img_sz = sz;
+     return 1;
+}
+
+/* detach and release the image; called after the planner forgot it */
+void X(release_wisdom_mmap)(void)
+{
+     if (img) {
+	  X(unmap_file)(img, img_sz);
+	  img = 0;
+	  img_sz = 0;
+     }
+}
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2021, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Planner statistics and planning trace.  The trace is written by the
+   planner (see the comment on the planning trace in kernel/planner.c)
+   to the file named by X(set_planner_trace), or else by the
+   FFTW_PLANNER_TRACE environment variable when the planner is created.
+   A "%p" in the name is replaced by the process id, so that the ranks
+   of an MPI job can write separate files.  Every record is flushed
+   when complete. */
+
+#include "api/api.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_UNISTD_H) && !defined(_WIN32)
+#  include <unistd.h>
+#  define GETPID() ((long) getpid())
+#else
+#  define GETPID() 0L
+#endif
+
+#define TRACE_ENV "FFTW_PLANNER_TRACE"
+#define BUFSZ 256
+
+typedef struct {
+     printer super;
+     FILE *f;
+     char buf[BUFSZ];
+     char *bufw;
+} P;
+
+static printer *trace = 0;
+static int trace_set = 0;
+
+static void myflush(P *p)
+{
+     fwrite(p->buf, 1, (size_t)(p->bufw - p->buf), p->f);
+     p->bufw = p->buf;
+}
+
+static void myputchr(printer *p_, char c)
+{
+     P *p = (P *) p_;
+     if (p->bufw >= p->buf + BUFSZ)
+	  myflush(p);
+     *p->bufw++ = c;
+     if (c == '\n') {
+	  myflush(p);
+	  fflush(p->f);
+     }
+}
+
+static void mycleanup(printer *p_)
+{
+     P *p = (P *) p_;
+     myflush(p);
+     if (p->f == stderr || p->f == stdout)
+	  fflush(p->f);
+     else
+	  fclose(p->f);
+}
+
+static printer *mkprinter_trace(const char *filename)
+{
+     char *name, *o;
+     const char *s;
+     FILE *f;
+     P *p;
+
+     if (!strcmp(filename, "-"))
+	  f = stderr;
+     else {
+	  /* expand %p */
+	  size_t n = strlen(filename) + 1;
+	  for (s = filename; (s = strstr(s, "%p")); s += 2)
+	       n += 20;
+	  name = o = (char *) MALLOC(n, OTHER);
+	  for (s = filename; *s; ++s) {
+	       if (s[0] == '%' && s[1] == 'p') {
+		    o += sprintf(o, "%ld", GETPID());
+		    ++s;
+	       } else
+		    *o++ = *s;
+	  }
+	  *o = 0;
+	  f = fopen(name, "a");
+	  X(ifree)(name);
+	  if (!f)
+	       return 0;
+     }
+
+     p = (P *) X(mkprinter)(sizeof(P), myputchr, mycleanup);
+     p->f = f;
+     p->bufw = p->buf;
+     return &p->super;
+}
+
+static void close_trace(void)
+{
+     if (trace) {
+	  X(printer_destroy)(trace);
+	  trace = 0;
+     }
+}
+
+/* called when the API planner is created */
+void X(planner_trace_attach)(planner *plnr)
+{
+     if (!trace_set) {
+	  const char *env = getenv(TRACE_ENV);
+	  if (env && *env)
+	       trace = mkprinter_trace(env);
+	  trace_set = 1;
+     }
+     plnr->trace = trace;
+}
+
+/* called by X(cleanup), after the planner is destroyed */
+void X(planner_trace_cleanup)(void)
+{
+     close_trace();
+     trace_set = 0;
+}
+
+void X(set_planner_trace)(const char *filename)
+{
+     planner *plnr = X(the_planner)();
+
+     close_trace();
+     if (filename && *filename)
+	  trace = mkprinter_trace(filename);
+     trace_set = 1;
+     plnr->trace = trace;
+}
+
+void X(get_planner_stats)(X(planner_stats) *stats)
+{
+     planner *plnr = X(the_planner)();
+     hashtab ht;
+
+     X(planner_htab_stats)(plnr, &ht);
+     stats->nprob = plnr->nprob;
+     stats->nsearch = plnr->nsearch;
+     stats->nplan = plnr->nplan;
+     stats->ntimeout = plnr->ntimeout;
+     stats->pcost = plnr->pcost;
+     stats->epcost = plnr->epcost;
+     stats->lookup = ht.lookup;
+     stats->succ_lookup = ht.succ_lookup;
+     stats->lookup_iter = ht.lookup_iter;
+     stats->insert = ht.insert;
+     stats->insert_iter = ht.insert_iter;
+     stats->insert_unknown = ht.insert_unknown;
+     stats->nrehash = ht.nrehash;
+     stats->nelem = ht.nelem;
+     stats->hashsiz = ht.hashsiz;
+     stats->nswap = plnr->nswap;
+}
+
+void X(reset_planner_stats)(void)
+{
+     X(planner_reset_stats)(X(the_planner)());
+}
@@ -0,0 +1,449 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2021, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Execution profiler.  X(plan_profile_start) walks the plan tree the
+   same way X(print_plan) does (a printer hook reports every child
+   printed with %p), and replaces the apply method of every node whose
+   signature is known (see plan->apply_arity) with a wrapper that counts
+   calls and cycles before calling the original.  The profile is
+   reported as JSON, one object per node, nested like the plan.
+
+   Times are inclusive and summed over all threads.  For each node we
+   also record how many of its children ran at once, so that the time
+   of a node not spent in its children ("self") can be estimated for
+   threaded plans too: there it is mostly fork/join and imbalance.
+
+   The instrumentation costs two cycle-counter reads per call of each
+   node, which is noticeable for trees of tiny codelets. */
+
+#include "api/api.h"
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef WITH_SLOW_TIMER
+#  include "kernel/cycle.h"
+#endif
+
+#if defined(__GNUC__)
+#  define ATOMIC_ADD(p, v) __atomic_add_fetch(p, v, __ATOMIC_RELAXED)
+#else
+#  define ATOMIC_ADD(p, v) (*(p) += (v))
+#endif
+
+#define NAMESZ 96
+
+typedef void (*apply4)(const plan *ego, R *a, R *b, R *c, R *d);
+typedef void (*apply2)(const plan *ego, R *a, R *b);
+typedef void (*apply1)(const plan *ego, R *a);
+
+/* the layout shared by plan_dft, plan_rdft, plan_dftw, etc. */
+typedef struct { plan super; apply4 apply; } plan4;
+typedef struct { plan super; apply2 apply; } plan2;
+typedef struct { plan super; apply1 apply; } plan1;
+
+typedef struct profnode_s {
+     plan *pln;
+     union { apply4 a4; apply2 a2; apply1 a1; } orig;
+     struct profnode_s *parent;
+     int up, child, sibling; /* indices of parent, first child and next
+				sibling, or -1 */
+     int timed;
+     char name[NAMESZ];
+     size_t namelen;
+     unsigned long long calls, ticks;
+     int active; /* children of this node running now */
+     int parallelism; /* most children that ran at once */
+} profnode;
+
+struct profile_s {
+     profnode *nodes;
+     int n, nalloc;
+     crude_time t0;
+#ifdef HAVE_TICK_COUNTER
+     ticks c0;
+#endif
+};
+
+typedef profnode node; /* shorthand */
+
+/*************************************************************
+ * Wrappers
+ *************************************************************/
+
+static void enter(node *n)
+{
+     node *par = n->parent;
+
+     if (par) {
+	  int k = ATOMIC_ADD(&par->active, 1);
+#if defined(__GNUC__)
+	  int m = __atomic_load_n(&par->parallelism, __ATOMIC_RELAXED);
+	  while (k > m && !__atomic_compare_exchange_n(
+		      &par->parallelism, &m, k, 0,
+		      __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+	       ;
+#else
+	  if (k > par->parallelism) par->parallelism = k;
+#endif
+     }
+     ATOMIC_ADD(&n->calls, 1ULL);
+}
+
+static void leave(node *n)
+{
+     if (n->parent)
+	  ATOMIC_ADD(&n->parent->active, -1);
+}
+
+#ifdef HAVE_TICK_COUNTER
+#  define TIMED(n, call) {					\
+     ticks t0_;							\
+     enter(n);							\
+     t0_ = getticks();						\
+     call;							\
+     ATOMIC_ADD(&(n)->ticks,					\
+		(unsigned long long) elapsed(getticks(), t0_));	\
+     leave(n);							\
+}
+#else
+#  define TIMED(n, call) { enter(n); call; leave(n); }
+#endif
+
+static void wrap4(const plan *ego, R *a, R *b, R *c, R *d)
+{
+     node *n = ego->prof;
+     TIMED(n, n->orig.a4(ego, a, b, c, d));
+}
+
+static void wrap2(const plan *ego, R *a, R *b)
+{
+     node *n = ego->prof;
+     TIMED(n, n->orig.a2(ego, a, b));
+}
+
+static void wrap1(const plan *ego, R *a)
+{
+     node *n = ego->prof;
+     TIMED(n, n->orig.a1(ego, a));
+}
+
+static void install(node *n)
+{
+     plan *pln = n->pln;
+
+     pln->prof = n;
+     switch (pln->apply_arity) {
+	 case 4:
+	      n->orig.a4 = ((plan4 *) pln)->apply;
+	      ((plan4 *) pln)->apply = wrap4;
+	      break;
+	 case 2:
+	      n->orig.a2 = ((plan2 *) pln)->apply;
+	      ((plan2 *) pln)->apply = wrap2;
+	      break;
+	 case 1:
+	      n->orig.a1 = ((plan1 *) pln)->apply;
+	      ((plan1 *) pln)->apply = wrap1;
+	      break;
+	 default:
+	      return;
+     }
+     n->timed = 1;
+}
+
+static void uninstall(node *n)
+{
+     plan *pln = n->pln;
+
+     if (n->timed) {
+	  switch (pln->apply_arity) {
+	      case 4: ((plan4 *) pln)->apply = n->orig.a4; break;
+	      case 2: ((plan2 *) pln)->apply = n->orig.a2; break;
+	      case 1: ((plan1 *) pln)->apply = n->orig.a1; break;
+	  }
+     }
+     pln->prof = 0;
+}
+
+/*************************************************************
+ * Walking the plan tree
+ *************************************************************/
+
+typedef struct {
+     printer super;
+     struct profile_s *prof;
+     int cur; /* node being printed, or -1 */
+} P;
+
+static void add_node(P *p, const plan *x)
+{
+     struct profile_s *prof = p->prof;
+     node *n;
+
+     if (prof->n == prof->nalloc) {
+	  int nalloc = 2 * prof->nalloc + 16;
+	  node *nodes = (node *) MALLOC(sizeof(node) * (size_t)nalloc, OTHER);
+	  if (prof->n)
+	       memcpy(nodes, prof->nodes, sizeof(node) * (size_t)prof->n);
+	  X(ifree0)(prof->nodes);
+	  prof->nodes = nodes;
+	  prof->nalloc = nalloc;
+     }
+
+     n = prof->nodes + prof->n;
+     memset(n, 0, sizeof(node));
+     n->pln = (plan *) x;
+     n->up = p->cur;
+     n->child = n->sibling = -1;
+     if (p->cur >= 0) {
+	  node *par = prof->nodes + p->cur;
+	  int *last = &par->child;
+	  while (*last >= 0)
+	       last = &prof->nodes[*last].sibling;
+	  *last = prof->n;
+     }
+     p->cur = prof->n++;
+}
+
+static void plan_hook(printer *p_, const plan *x, int enter_p)
+{
+     P *p = (P *) p_;
+
+     if (enter_p)
+	  add_node(p, x);
+     else
+	  p->cur = p->prof->nodes[p->cur].up;
+}
+
+/* the name of a node is the text that it prints itself, with
+   parentheses and runs of blanks dropped */
+static void putchr(printer *p_, char c)
+{
+     P *p = (P *) p_;
+     node *n;
+
+     if (p->cur < 0)
+	  return;
+     n = p->prof->nodes + p->cur;
+     if (c == '(' || c == ')')
+	  return;
+     if (c == '\n' || c == ' ') {
+	  if (n->namelen == 0 || n->name[n->namelen - 1] == ' ')
+	       return;
+	  c = ' ';
+     }
+     if (n->namelen + 1 < NAMESZ)
+	  n->name[n->namelen++] = c;
+}
+
+static void walk(struct profile_s *prof, plan *pln)
+{
+     P *p = (P *) X(mkprinter)(sizeof(P), putchr, 0);
+     int i, j;
+
+     p->super.plan_hook = plan_hook;
+     p->prof = prof;
+     p->cur = -1;
+
+     plan_hook(&p->super, pln, 1);
+     pln->adt->print(pln, &p->super);
+     plan_hook(&p->super, pln, 0);
+     X(printer_destroy)(&p->super);
+
+     for (i = 0; i < prof->n; ++i) {
+	  node *n = prof->nodes + i;
+	  /* the array does not move any more */
+	  n->parent = n->up >= 0 ? prof->nodes + n->up : 0;
+	  while (n->namelen > 0 && n->name[n->namelen - 1] == ' ')
+	       --n->namelen;
+	  n->name[n->namelen] = 0;
+
+	  /* a plan printed twice is only timed once */
+	  for (j = 0; j < i; ++j)
+	       if (prof->nodes[j].pln == n->pln)
+		    break;
+	  if (j == i)
+	       install(n);
+     }
+}
+
+/*************************************************************
+ * JSON output
+ *************************************************************/
+
+typedef struct {
+     char *s;
+     size_t len, alloc;
+} buf;
+
+static void out(buf *b, const char *fmt, ...)
+{
+     char tmp[256];
+     va_list ap;
+     size_t n;
+
+     va_start(ap, fmt);
+     vsprintf(tmp, fmt, ap);
+     va_end(ap);
+
+     n = strlen(tmp);
+     if (b->len + n + 1 > b->alloc) {
+	  size_t alloc = 2 * b->alloc + n + 1024;
+	  char *s = (char *) malloc(alloc);
+	  if (b->len)
+	       memcpy(s, b->s, b->len);
+	  free(b->s);
+	  b->s = s;
+	  b->alloc = alloc;
+     }
+     memcpy(b->s + b->len, tmp, n + 1);
+     b->len += n;
+}
+
+static void out_name(buf *b, const char *name)
+{
+     char tmp[2 * NAMESZ + 1], *t = tmp;
+
+     for (; *name; ++name) {
+	  if (*name == '"' || *name == '\\')
+	       *t++ = '\\';
+	  *t++ = *name;
+     }
+     *t = 0;
+     out(b, "\"%s\"", tmp);
+}
+
+static void out_node(buf *b, const struct profile_s *prof, int i,
+		     double tps, int indent)
+{
+     const node *n = prof->nodes + i;
+     const opcnt *ops = &n->pln->ops;
+     double t = tps > 0 ? (double) n->ticks / tps : 0;
+     double tchld = 0, tself;
+     int j;
+
+     for (j = n->child; j >= 0; j = prof->nodes[j].sibling)
+	  tchld += (double) prof->nodes[j].ticks;
+     if (n->parallelism > 1)
+	  tchld /= n->parallelism;
+     tself = tps > 0 && (double) n->ticks > tchld
+	  ? ((double) n->ticks - tchld) / tps : 0;
+
+     out(b, "%*s{\"name\": ", indent, "");
+     out_name(b, n->name);
+     out(b, ", \"timed\": %s, \"calls\": %llu, \"ticks\": %llu",
+	 n->timed ? "true" : "false", n->calls, n->ticks);
+     out(b, ", \"seconds\": %.6g, \"self_seconds\": %.6g",
+	 t, tself);
+     out(b, ", \"parallelism\": %d", n->parallelism > 0 ? n->parallelism : 1);
+     out(b, ",\n%*s \"ops\": {\"add\": %.0f, \"mul\": %.0f, "
+	 "\"fma\": %.0f, \"other\": %.0f}",
+	 indent, "", ops->add, ops->mul, ops->fma, ops->other);
+     if (n->child >= 0) {
+	  out(b, ",\n%*s \"children\": [\n", indent, "");
+	  for (j = n->child; j >= 0; j = prof->nodes[j].sibling) {
+	       out_node(b, prof, j, tps, indent + 2);
+	       out(b, prof->nodes[j].sibling >= 0 ? ",\n" : "\n");
+	  }
+	  out(b, "%*s ]", indent, "");
+     }
+     out(b, "}");
+}
+
+static char *report(const struct profile_s *prof)
+{
+     buf b;
+     double tps = 0;
+
+     b.s = 0;
+     b.len = b.alloc = 0;
+
+#ifdef HAVE_TICK_COUNTER
+     {
+	  double dt = X(seconds_since)(prof->t0);
+	  if (dt > 0)
+	       tps = elapsed(getticks(), prof->c0) / dt;
+     }
+#endif
+
+     out(&b, "{\"ticks_per_second\": %.6g,\n \"plan\":\n", tps);
+     out_node(&b, prof, 0, tps, 2);
+     out(&b, "}\n");
+     return b.s;
+}
+
+/*************************************************************
+ * Interface
+ *************************************************************/
+
+void X(plan_profile_start)(X(plan) p)
+{
+     struct profile_s *prof;
+
+     if (!p)
+	  return;
+
+     X(plan_profile_stop)(p);
+
+     prof = (struct profile_s *) MALLOC(sizeof(struct profile_s), OTHER);
+     prof->nodes = 0;
+     prof->n = prof->nalloc = 0;
+     walk(prof, p->pln);
+     prof->t0 = X(get_crude_time)();
+#ifdef HAVE_TICK_COUNTER
+     prof->c0 = getticks();
+#endif
+     p->profile = prof;
+}
+
+void X(plan_profile_stop)(X(plan) p)
+{
+     struct profile_s *prof = p ? p->profile : 0;
+     int i;
+
+     if (!prof)
+	  return;
+
+     for (i = 0; i < prof->n; ++i)
+	  if (prof->nodes[i].pln->prof == prof->nodes + i)
+	       uninstall(prof->nodes + i);
+     X(ifree0)(prof->nodes);
+     X(ifree)(prof);
+     p->profile = 0;
+}
+
+char *X(plan_profile_sprint)(const X(plan) p)
+{
+     if (!p || !p->profile)
+	  return 0;
+     return report(p->profile);
+}
+
+void X(plan_profile_fprint)(const X(plan) p, FILE *output_file)
+{
+     char *s = X(plan_profile_sprint)(p);
+
+     if (s) {
+	  fputs(s, output_file);
+	  free(s);
+     }
+}
@@ -29,6 +29,8 @@ planner *X(the_planner)(void)
      if (!plnr) {
           plnr = X(mkplanner)();
           X(configure_planner)(plnr);
+          X(planner_trace_attach)(plnr);
+          X(twiddle_file_attach)();
      }
 
      return plnr;
@@ -42,6 +44,8 @@ planner *X(the_planner_ex)(int n)
           plnr = X(mkplanner)();
 	  plnr->size = n;
           X(configure_planner)(plnr);
+          X(planner_trace_attach)(plnr);
+          X(twiddle_file_attach)();
      }
 
      return plnr;
@@ -54,6 +58,11 @@ void X(cleanup)(void)
           X(planner_destroy)(plnr);
           plnr = 0;
      }
+     X(release_wisdom_mmap)();
+     X(release_twiddles_mmap)();
+     X(cache_pressure_cleanup)();
+     X(set_wisdom_store)(0);
+     X(planner_trace_cleanup)();
 }
 
 void X(set_timelimit)(double tlim) 
@@ -62,3 +71,35 @@ void X(set_timelimit)(double tlim)
 	called, so use X(the_planner)() */
      X(the_planner)()->timelimit = tlim; 
 }
+
+void X(set_timing_confidence)(double rel_ci, double stability)
+{
+     X(timing_rel_ci) = rel_ci;
+     X(timing_stability) = stability;
+}
+
+void X(plan_with_top_n)(int n)
+{
+#ifdef AMD_TOP_N_PLANNER
+     X(planner_set_top_n)(X(the_planner)(), X(imax)(n, 1));
+#else
+     UNUSED(n);
+#endif
+}
+
+void X(plan_with_cache_pressure)(size_t cache_per_thread, size_t pressure)
+{
+     X(cache_pressure_init)(cache_per_thread, pressure);
+}
+
+void X(set_cache_sizes)(size_t l1d, size_t l2, size_t l3)
+{
+     X(cache_set_sizes)(l1d, l2, l3);
+}
+
+void X(get_cache_sizes)(size_t *l1d, size_t *l2, size_t *l3)
+{
+     if (l1d) *l1d = X(cache_size)(1);
+     if (l2) *l2 = X(cache_size)(2);
+     if (l3) *l3 = X(cache_size)(3);
+}
@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2021, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Persistent wisdom store, shared by all processes that plan with
+   the same file (e.g. the ranks of an MPI job started in one
+   directory).
+
+   The file is a sequence of ordinary wisdom exports.  A process reads
+   and imports it once, remembering every record it has seen.  After
+   planning, it appends only the records that are not in the file yet,
+   in a single write under an exclusive flock(), so concurrent writers
+   neither rewrite nor corrupt each other's records.  When the file has
+   accumulated too many appended exports, the reader that notices
+   rewrites it into a single export, atomically via rename().  Writers
+   check after locking that the file was not renamed under them. */
+
+#include "api/api.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_UNISTD_H) && !defined(_WIN32)
+#  define HAVE_STORE_LOCKING 1
+#  include <unistd.h>
+#  include <fcntl.h>
+#  include <sys/file.h>
+#  include <sys/stat.h>
+#endif
+
+#define DEFAULT_STORE "wis.dat"
+#define STORE_ENV "FFTW_WISDOM_FILE"
+
+/* number of appended exports after which the store is compacted */
+#define STORE_MAX_UNITS 32
+
+/* an export consists of one block per hash table */
+#ifdef AMD_TOP_N_PLANNER
+#  define BLOCKS_PER_UNIT (X(the_planner)()->top_n)
+#else
+#  define BLOCKS_PER_UNIT 1
+#endif
+
+#define NBUCKETS 1024
+
+/* in-memory index of the records known to be in the store */
+typedef struct rec_s {
+     struct rec_s *cdr;
+     unsigned h;
+     int tbl;
+     char line[1]; /* actually longer */
+} rec;
+
+static rec *idx[NBUCKETS];
+static char *store_path = 0;
+static int loaded = 0;
+
+/*************************************************************
+ * Index of records
+ *************************************************************/
+
+static size_t linelen(const char *s)
+{
+     const char *e = strchr(s, '\n');
+     return e ? (size_t)(e - s) : strlen(s);
+}
+
+static unsigned hash_line(const char *s, size_t n, int tbl)
+{
+     unsigned h = (unsigned) tbl * 17u;
+     size_t i;
+     for (i = 0; i < n; ++i)
+	  h = h * 17u ^ (unsigned char) s[i];
+     return h;
+}
+
+static rec *lookup(const char *s, size_t n, int tbl, unsigned h)
+{
+     rec *r;
+     for (r = idx[h % NBUCKETS]; r; r = r->cdr)
+	  if (r->h == h && r->tbl == tbl
+	      && !strncmp(r->line, s, n) && !r->line[n])
+	       return r;
+     return 0;
+}
+
+/* insert line S (of length N) of table TBL; return 1 if it is new */
+static int remember(const char *s, size_t n, int tbl)
+{
+     unsigned h = hash_line(s, n, tbl);
+     rec *r;
+
+     if (lookup(s, n, tbl, h))
+	  return 0;
+
+     r = (rec *) MALLOC(sizeof(rec) + n, OTHER);
+     r->h = h;
+     r->tbl = tbl;
+     memcpy(r->line, s, n);
+     r->line[n] = 0;
+     r->cdr = idx[h % NBUCKETS];
+     idx[h % NBUCKETS] = r;
+     return 1;
+}
+
+static void forget_index(void)
+{
+     int i;
+     for (i = 0; i < NBUCKETS; ++i) {
+	  rec *r = idx[i];
+	  while (r) {
+	       rec *cdr = r->cdr;
+	       X(ifree)(r);
+	       r = cdr;
+	  }
+	  idx[i] = 0;
+     }
+}
+
+/* Import every export found in TEXT (which is modified temporarily)
+   and index its records.  Return the number of exports. */
+static int import_text(char *text)
+{
+     char *s = text, *unit = text;
+     int nblk = 0, nunits = 0;
+
+     while (*s) {
+	  size_t n = linelen(s);
+	  char *next = s + n + (s[n] == '\n');
+
+	  if (s[0] == ')') {
+	       /* end of a block */
+	       if (++nblk % BLOCKS_PER_UNIT == 0) {
+		    char c = *next;
+		    *next = 0;
+		    X(import_wisdom_from_string)(unit);
+		    *next = c;
+		    unit = next;
+		    ++nunits;
+	       }
+	  } else if (s[0] == ' ') {
+	       /* record within block NBLK of the current unit */
+	       while (*s == ' ') { ++s; --n; }
+	       remember(s, n, nblk % BLOCKS_PER_UNIT);
+	  }
+	  s = next;
+     }
+     return nunits;
+}
+
+/* Return, in a freshly allocated string, an export of the records in
+   the planner that are not in the index yet, and add them to the
+   index.  Return 0 if there are no such records. */
+static char *new_records(void)
+{
+     char *all = X(export_wisdom_to_string)();
+     char *out, *o, *s;
+     int nblk = 0, nnew = 0;
+
+     if (!all)
+	  return 0;
+
+     out = o = (char *) MALLOC(strlen(all) + 1, OTHER);
+     for (s = all; *s; ) {
+	  size_t n = linelen(s);
+	  char *next = s + n + (s[n] == '\n');
+	  const char *r = s;
+	  size_t rn = n;
+
+	  while (*r == ' ') { ++r; --rn; }
+	  if (s[0] == ')')
+	       ++nblk;
+	  if (s[0] != ' ' || remember(r, rn, nblk % BLOCKS_PER_UNIT)) {
+	       memcpy(o, s, (size_t)(next - s));
+	       o += next - s;
+	       nnew += (s[0] == ' ');
+	  }
+	  s = next;
+     }
+     *o = 0;
+     free(all);
+
+     if (!nnew) {
+	  X(ifree)(out);
+	  return 0;
+     }
+     return out;
+}
+
+/*************************************************************
+ * File access
+ *************************************************************/
+
+static const char *path_of_store(void)
+{
+     const char *env;
+
+     if (store_path)
+	  return store_path;
+     env = getenv(STORE_ENV);
+     return (env && *env) ? env : DEFAULT_STORE;
+}
+
+#ifdef HAVE_STORE_LOCKING
+
+static int write_all(int fd, const char *s, size_t n)
+{
+     while (n > 0) {
+	  ssize_t k = write(fd, s, n);
+	  if (k <= 0)
+	       return 0;
+	  s += k;
+	  n -= (size_t) k;
+     }
+     return 1;
+}
+
+/* read the whole file FD into a freshly allocated string */
+static char *read_all(int fd)
+{
+     struct stat st;
+     char *text;
+     size_t n = 0;
+
+     if (fstat(fd, &st))
+	  return 0;
+     text = (char *) MALLOC((size_t) st.st_size + 1, OTHER);
+     while (n < (size_t) st.st_size) {
+	  ssize_t k = read(fd, text + n, (size_t) st.st_size - n);
+	  if (k <= 0)
+	       break;
+	  n += (size_t) k;
+     }
+     text[n] = 0;
+     return text;
+}
+
+/* open PATH and lock it with OP; retry if the file is replaced before
+   we hold the lock */
+static int open_locked(const char *path, int oflags, int op)
+{
+     for (;;) {
+	  struct stat a, b;
+	  int fd = open(path, oflags, 0644);
+
+	  if (fd < 0)
+	       return -1;
+	  if (flock(fd, op)) {
+	       close(fd);
+	       return -1;
+	  }
+	  if (!fstat(fd, &a) && !stat(path, &b)
+	      && a.st_dev == b.st_dev && a.st_ino == b.st_ino)
+	       return fd;
+	  close(fd); /* renamed under us */
+     }
+}
+
+static void compact(const char *path)
+{
+     int fd = open_locked(path, O_RDONLY, LOCK_EX);
+     char *text, *tmp, *all;
+     size_t n;
+     int tfd;
+
+     if (fd < 0)
+	  return;
+
+     /* other processes may have appended since we read the file */
+     text = read_all(fd);
+     if (text) {
+	  import_text(text);
+	  X(ifree)(text);
+     }
+
+     n = strlen(path);
+     tmp = (char *) MALLOC(n + 32, OTHER);
+     sprintf(tmp, "%s.%ld.tmp", path, (long) getpid());
+     all = X(export_wisdom_to_string)();
+     tfd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+     if (tfd >= 0) {
+	  int ok = all && write_all(tfd, all, strlen(all));
+	  if (close(tfd) || !ok || rename(tmp, path))
+	       unlink(tmp);
+     }
+     free(all);
+     X(ifree)(tmp);
+
+     flock(fd, LOCK_UN);
+     close(fd);
+}
+
+static void load(const char *path)
+{
+     int fd = open(path, O_RDONLY);
+     char *text;
+     int nunits = 0;
+
+     if (fd < 0)
+	  return; /* no store yet */
+     if (!flock(fd, LOCK_SH)) {
+	  text = read_all(fd);
+	  if (text) {
+	       nunits = import_text(text);
+	       X(ifree)(text);
+	  }
+	  flock(fd, LOCK_UN);
+     }
+     close(fd);
+
+     if (nunits > STORE_MAX_UNITS)
+	  compact(path);
+}
+
+static void append(const char *path, const char *s)
+{
+     int fd = open_locked(path, O_WRONLY | O_APPEND | O_CREAT, LOCK_EX);
+
+     if (fd < 0)
+	  return;
+     write_all(fd, s, strlen(s));
+     flock(fd, LOCK_UN);
+     close(fd);
+}
+
+#else /* !HAVE_STORE_LOCKING */
+
+static void load(const char *path)
+{
+     FILE *f = fopen(path, "rb");
+     char *text;
+     long n;
+
+     if (!f)
+	  return;
+     if (!fseek(f, 0, SEEK_END) && (n = ftell(f)) >= 0) {
+	  rewind(f);
+	  text = (char *) MALLOC((size_t) n + 1, OTHER);
+	  text[fread(text, 1, (size_t) n, f)] = 0;
+	  import_text(text);
+	  X(ifree)(text);
+     }
+     fclose(f);
+}
+
+static void append(const char *path, const char *s)
+{
+     FILE *f = fopen(path, "ab");
+     if (!f)
+	  return;
+     fputs(s, f);
+     fclose(f);
+}
+
+#endif /* HAVE_STORE_LOCKING */
+
+/*************************************************************
+ * Interface
+ *************************************************************/
+
+void X(wisdom_store_load)(void)
+{
+     if (!loaded) {
+	  load(path_of_store());
+	  loaded = 1;
+     }
+}
+
+void X(wisdom_store_save)(void)
+{
+     char *s;
+
+     X(wisdom_store_load)();
+     s = new_records();
+     if (s) {
+	  append(path_of_store(), s);
+	  X(ifree)(s);
+     }
+}
+
+void X(wisdom_store_forget)(void)
+{
+     forget_index();
+     loaded = 0;
+}
+
+void X(set_wisdom_store)(const char *filename)
+{
+     X(wisdom_store_forget)();
+     X(ifree0)(store_path);
+     store_path = 0;
+     if (filename) {
+	  store_path = (char *) MALLOC(strlen(filename) + 1, OTHER);
+	  strcpy(store_path, filename);
+     }
+}
@@ -33,6 +33,7 @@ typedef struct {
      R *W;      /* DFT(w) */
      plan *cldf;
      INT is, os;
+     scratch scr;
 } P;
 
 static void bluestein_sequence(enum wakefulness wakefulness, INT n, R *w)
@@ -91,7 +92,7 @@ static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
      const P *ego = (const P *) ego_;
      INT i, n = ego->n, nb = ego->nb, is = ego->is, os = ego->os;
      R *w = ego->w, *W = ego->W;
-     R *b = (R *) MALLOC(2 * nb * sizeof(R), BUFFERS);
+     R *b = X(scratch_get)(&ego->scr);
 
      /* multiply input by conjugate bluestein sequence */
      for (i = 0; i < n; ++i) {
@@ -131,7 +132,7 @@ static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
           io[i*os] = xi * wr - xr * wi;
      }
 
-     X(ifree)(b);	  
+     X(scratch_put)(&ego->scr, b);
 }
 
 static void awake(plan *ego_, enum wakefulness wakefulness)
@@ -139,6 +140,7 @@ static void awake(plan *ego_, enum wakefulness wakefulness)
      P *ego = (P *) ego_;
 
      X(plan_awake)(ego->cldf, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
 
      switch (wakefulness) {
 	 case SLEEPY:
@@ -229,6 +231,7 @@ static plan *mkplan(const solver *ego, const problem *p_, planner *plnr)
      pln->cldf = cldf;
      pln->is = p->sz->dims[0].is;
      pln->os = p->sz->dims[0].os;
+     X(scratch_init)(&pln->scr, 2 * nb * sizeof(R));
 
      X(ops_add)(&cldf->ops, &cldf->ops, &pln->super.super.ops);
      pln->super.super.ops.add += 4 * n + 2 * nb;
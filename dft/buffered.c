@@ -35,6 +35,7 @@ typedef struct {
      INT n, vl, nbuf, bufdist;
      INT ivs_by_nbuf, ovs_by_nbuf;
      INT roffset, ioffset;
+     scratch scr;
 } P;
 
 /* transform a vector input with the help of bufs */
@@ -42,7 +43,7 @@ static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
 {
      const P *ego = (const P *) ego_;
      INT nbuf = ego->nbuf;
-     R *bufs = (R *)MALLOC(sizeof(R) * nbuf * ego->bufdist * 2, BUFFERS);
+     R *bufs = X(scratch_get)(&ego->scr);
 
      plan_dft *cld = (plan_dft *) ego->cld;
      plan_dft *cldcpy = (plan_dft *) ego->cldcpy;
@@ -61,7 +62,7 @@ static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
 	  ro += ovs_by_nbuf; io += ovs_by_nbuf;
      }
 
-     X(ifree)(bufs);
+     X(scratch_put)(&ego->scr, bufs);
 
      /* Do the remaining transforms, if any: */
      cldrest = (plan_dft *) ego->cldrest;
@@ -76,6 +77,7 @@ static void awake(plan *ego_, enum wakefulness wakefulness)
      X(plan_awake)(ego->cld, wakefulness);
      X(plan_awake)(ego->cldcpy, wakefulness);
      X(plan_awake)(ego->cldrest, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
 }
 
 static void destroy(plan *ego_)
@@ -221,7 +223,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      if (!cldcpy)
           goto nada;
 
-     /* deallocate buffers, let apply() allocate them for real */
+     /* deallocate buffers, let apply() take them from the scratch arena */
      X(ifree)(bufs);
      bufs = 0;
 
@@ -251,6 +253,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 
      pln->nbuf = nbuf;
      pln->bufdist = bufdist;
+     X(scratch_init)(&pln->scr, sizeof(R) * nbuf * bufdist * 2);
 
      {
 	  opcnt t;
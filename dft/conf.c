@@ -27,6 +27,7 @@ static const solvtab s =
      SOLVTAB(X(dft_indirect_register)),
      SOLVTAB(X(dft_indirect_transpose_register)),
      SOLVTAB(X(dft_rank_geq2_register)),
+     SOLVTAB(X(dft_rank_geq2_fused_register)),
      SOLVTAB(X(dft_vrank_geq1_register)),
      SOLVTAB(X(dft_buffered_register)),
      SOLVTAB(X(dft_generic_register)),
@@ -35,6 +36,7 @@ static const solvtab s =
      SOLVTAB(X(dft_nop_register)),
      SOLVTAB(X(ct_generic_register)),
      SOLVTAB(X(ct_genericbuf_register)),
+     SOLVTAB(X(dft_sixstep_register)),
      SOLVTAB_END
 };
 
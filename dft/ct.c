@@ -250,6 +250,7 @@ plan *X(mkplan_dftw)(size_t size, const plan_adt *adt, dftwapply apply)
 
      ego = (plan_dftw *) X(mkplan)(size, adt);
      ego->apply = apply;
+     ego->super.apply_arity = 2;
 
      return &(ego->super);
 }
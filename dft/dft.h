@@ -68,6 +68,7 @@ solver *X(mksolver_dft_directbuf)(kdft k, const kdft_desc *desc);
 
 void X(dft_rank0_register)(planner *p);
 void X(dft_rank_geq2_register)(planner *p);
+void X(dft_rank_geq2_fused_register)(planner *p);
 void X(dft_indirect_register)(planner *p);
 void X(dft_indirect_transpose_register)(planner *p);
 void X(dft_vrank_geq1_register)(planner *p);
@@ -80,6 +81,13 @@ void X(dft_bluestein_register)(planner *p);
 void X(dft_nop_register)(planner *p);
 void X(ct_generic_register)(planner *p);
 void X(ct_genericbuf_register)(planner *p);
+void X(dft_sixstep_register)(planner *p);
+
+/* parallel loop over [0, N) in blocks of [LO, HI), used by the six-step
+   solver and set by the threads library */
+extern void (*X(dft_sixstep_loop_hook))(INT n, int nthr,
+					void (*f)(INT lo, INT hi, void *args),
+					void *args);
 
 /* configurations */
 void X(dft_conf_standard)(planner *p);
@@ -245,6 +245,13 @@ static int applicable(const S *ego,
 				       v, m * r, r))
 	  return 0;
 
+     /* an unbuffered twiddle pass strides across the whole transform,
+	which is ugly if the latter does not fit in the cache share that
+	the user declared for each thread */
+     if (NO_UGLYP(plnr) && !ego->bufferedp
+	 && X(cache_oversubscribedp)(m * r * 2 * (INT)sizeof(R)))
+	  return 0;
+
 #ifdef AMD_FAST_PLANNER
      if ((m * r > 262144 && NO_FIXED_RADIX_LARGE_NP(plnr)) || v > 4096)
 #else
@@ -27,6 +27,7 @@ plan *X(mkplan_dft)(size_t size, const plan_adt *adt, dftapply apply)
 
      ego = (plan_dft *) X(mkplan)(size, adt);
      ego->apply = apply;
+     ego->super.apply_arity = 4;
 
      return &(ego->super);
 }
@@ -39,6 +39,7 @@ typedef struct {
      INT n, g, ginv;
      INT is, os;
      plan *cld_omega;
+     scratch scr;
 } P;
 
 static rader_tl *omegas = 0;
@@ -105,7 +106,7 @@ static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
      R r0 = ri[0], i0 = ii[0];
 
      r = ego->n; is = ego->is; os = ego->os; g = ego->g; 
-     buf = (R *) MALLOC(sizeof(R) * (r - 1) * 2, BUFFERS);
+     buf = X(scratch_get)(&ego->scr);
 
      /* First, permute the input, storing in buf: */
      for (gpower = 1, k = 0; k < r - 1; ++k, gpower = MULMOD(gpower, g, r)) {
@@ -165,7 +166,7 @@ static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
      }
 
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 /***************************************************************************/
@@ -177,6 +178,7 @@ static void awake(plan *ego_, enum wakefulness wakefulness)
      X(plan_awake)(ego->cld1, wakefulness);
      X(plan_awake)(ego->cld2, wakefulness);
      X(plan_awake)(ego->cld_omega, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
 
      switch (wakefulness) {
 	 case SLEEPY:
@@ -265,7 +267,7 @@ static int mkP(P *pln, INT n, INT is, INT os, R *ro, R *io,
 			       NO_SLOW, ESTIMATE, 0);
      if (!cld_omega) goto nada;
 
-     /* deallocate buffers; let awake() or apply() allocate them for real */
+     /* deallocate buffers; let apply() take them from the scratch arena */
      X(ifree)(buf);
      buf = 0;
 
@@ -276,6 +278,7 @@ static int mkP(P *pln, INT n, INT is, INT os, R *ro, R *io,
      pln->n = n;
      pln->is = is;
      pln->os = os;
+     X(scratch_init)(&pln->scr, sizeof(R) * (n - 1) * 2);
 
      X(ops_add)(&cld1->ops, &cld2->ops, &pln->super.super.ops);
      pln->super.super.ops.other += (n - 1) * (4 * 2 + 6) + 6;
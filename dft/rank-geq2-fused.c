@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/* plans for DFT of rank >= 2 that fuse the transforms of the inner
+   dimensions with the first (decimation in frequency) stage of the
+   transform of the next outer dimension.
+
+   Let dimension D of size N = R * M be the fused one, with prefix
+   dimensions A before it and inner dimensions B after it.  For each
+   index in A and each A0 < M, the R rows I[A0 + M * B0] (B0 < R) form
+   a slab that is transformed along B into the contiguous output rows
+   O[R * A0 + B0], then transformed across those R rows by an R-point
+   DFT and multiplied by the twiddle factors, while the slab is still
+   in cache.  A single in-place plan then computes the M-point DFTs
+   along D (with stride R) together with the transforms along A.
+   Compared to rank-geq2, the first pass over the array does the inner
+   dimensions and one radix-R stage of dimension D, so that the second
+   pass has less work left.  R is chosen so that a slab fits in the
+   L2 cache of one core. */
+
+#include "dft/dft.h"
+
+#define MAXR 64
+
+typedef struct {
+     solver super;
+     int last; /* fuse dimension rnk-2 instead of dimension 0 */
+} S;
+
+typedef struct {
+     plan_dft super;
+
+     plan *cld1, *cldr, *cld2;
+     R *W;
+     INT r, m, nA, isA, osA, isd, osd, nB, osB;
+     const S *solver;
+} P;
+
+static void twiddle(R *ro, R *io, const R *W, INT r, INT osd,
+		    INT nB, INT osB)
+{
+     INT k1, i;
+
+     for (k1 = 1; k1 < r; ++k1, W += 2) {
+	  R wr = W[0], wi = W[1];
+	  R *xr = ro + k1 * osd, *xi = io + k1 * osd;
+	  for (i = 0; i < nB; ++i, xr += osB, xi += osB) {
+	       E re = xr[0], im = xi[0];
+	       xr[0] = re * wr + im * wi;
+	       xi[0] = im * wr - re * wi;
+	  }
+     }
+}
+
+static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
+{
+     const P *ego = (const P *) ego_;
+     plan_dft *cld1 = (plan_dft *) ego->cld1;
+     plan_dft *cldr = (plan_dft *) ego->cldr;
+     plan_dft *cld2 = (plan_dft *) ego->cld2;
+     INT r = ego->r, m = ego->m;
+     INT j, a;
+
+     for (j = 0; j < ego->nA; ++j) {
+	  for (a = 0; a < m; ++a) {
+	       INT iofs = j * ego->isA + a * ego->isd;
+	       INT oofs = j * ego->osA + r * a * ego->osd;
+	       R *rs = ro + oofs, *is = io + oofs;
+
+	       cld1->apply(ego->cld1, ri + iofs, ii + iofs, rs, is);
+	       cldr->apply(ego->cldr, rs, is, rs, is);
+	       twiddle(rs, is, ego->W + 2 * (r - 1) * a, r, ego->osd,
+		       ego->nB, ego->osB);
+	  }
+     }
+
+     cld2->apply(ego->cld2, ro, io, ro, io);
+}
+
+static void awake(plan *ego_, enum wakefulness wakefulness)
+{
+     P *ego = (P *) ego_;
+
+     X(plan_awake)(ego->cld1, wakefulness);
+     X(plan_awake)(ego->cldr, wakefulness);
+     X(plan_awake)(ego->cld2, wakefulness);
+
+     if (wakefulness == SLEEPY) {
+	  X(ifree0)(ego->W);
+	  ego->W = 0;
+     } else if (!ego->W) {
+	  INT r = ego->r, m = ego->m, a, k1;
+	  R *W = (R *)MALLOC(sizeof(R) * 2 * (r - 1) * m, TWIDDLES);
+	  triggen *t = X(mktriggen)(wakefulness, r * m);
+
+	  for (a = 0; a < m; ++a)
+	       for (k1 = 1; k1 < r; ++k1)
+		    t->cexp(t, a * k1, W + 2 * ((r - 1) * a + k1 - 1));
+	  X(triggen_destroy)(t);
+	  ego->W = W;
+     }
+}
+
+static void destroy(plan *ego_)
+{
+     P *ego = (P *) ego_;
+     X(plan_destroy_internal)(ego->cld2);
+     X(plan_destroy_internal)(ego->cldr);
+     X(plan_destroy_internal)(ego->cld1);
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *) ego_;
+     p->print(p, "(dft-rank>=2-fused/%D-%D%(%p%)%(%p%)%(%p%))",
+	      ego->r, ego->m, ego->cld1, ego->cldr, ego->cld2);
+}
+
+/* largest radix R of N whose slab of R rows of NB complex elements
+   fits in the cache, leaving M = N / R >= 2 */
+static INT choose_radix(INT n, INT nB)
+{
+     INT r, maxr;
+
+     maxr = X(cache_fit)((INT)X(cache_size)(2), 1) / (nB * 2 * (INT)sizeof(R));
+     maxr = X(imin)(maxr, X(imin)(MAXR, n / 2));
+     for (r = maxr; r >= 2; --r)
+	  if (n % r == 0)
+	       return r;
+     return 0;
+}
+
+static int applicable0(const S *ego, const problem_dft *p, int *dp)
+{
+     if (!(1
+	   && FINITE_RNK(p->sz->rnk) && p->sz->rnk >= 2
+	   && p->vecsz->rnk == 0
+	   && p->ri != p->ro))
+	  return 0;
+
+     *dp = ego->last ? p->sz->rnk - 2 : 0;
+     if (ego->last && *dp == 0)
+	  return 0; /* same as the other variant */
+     return 1;
+}
+
+static int applicable(const S *ego, const problem_dft *p,
+		      const planner *plnr, int *dp)
+{
+     if (!applicable0(ego, p, dp)) return 0;
+
+     /* like the rank splits of rank-geq2, try the second variant only
+	in patient mode */
+     if (NO_RANK_SPLITSP(plnr) && ego->last) return 0;
+
+     return 1;
+}
+
+static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
+{
+     const S *ego = (const S *) ego_;
+     const problem_dft *p = (const problem_dft *) p_;
+     P *pln;
+     plan *cld1 = 0, *cldr = 0, *cld2 = 0;
+     tensor *szA, *szB, *szAc, *szBo, *szBc, *szAo, *vecr, *szm;
+     iodim *dd;
+     INT r, m, nB, osB, isA, osA, nA;
+     int d;
+     opcnt ops;
+
+     static const plan_adt padt = {
+	  X(dft_solve), awake, print, destroy
+     };
+
+     if (!applicable(ego, p, plnr, &d))
+          return (plan *) 0;
+
+     dd = p->sz->dims + d;
+     szA = X(tensor_copy_sub)(p->sz, 0, d);
+     szB = X(tensor_copy_sub)(p->sz, d + 1, p->sz->rnk - d - 1);
+     szAc = X(tensor_compress_contiguous)(szA);
+     szBo = X(tensor_copy_inplace)(szB, INPLACE_OS);
+     szBc = X(tensor_compress_contiguous)(szBo);
+     szAo = X(tensor_copy_inplace)(szA, INPLACE_OS);
+     szm = vecr = 0;
+
+     /* the loops over A and B in apply() are one-dimensional */
+     if (szAc->rnk > 1 || szBc->rnk != 1)
+	  goto nada;
+     nB = szBc->dims[0].n;
+     osB = szBc->dims[0].os;
+     if (szAc->rnk == 1) {
+	  nA = szAc->dims[0].n;
+	  isA = szAc->dims[0].is;
+	  osA = szAc->dims[0].os;
+     } else {
+	  nA = 1;
+	  isA = osA = 0;
+     }
+
+     if (!(r = choose_radix(dd->n, nB)))
+	  goto nada;
+     m = dd->n / r;
+
+     /* B transforms of the R rows of one slab */
+     cld1 = X(mkplan_d)(plnr,
+			X(mkproblem_dft_d)(
+			     X(tensor_copy)(szB),
+			     X(mktensor_1d)(r, m * dd->is, dd->os),
+			     TAINT(TAINT(p->ri, isA), dd->is),
+			     TAINT(TAINT(p->ii, isA), dd->is),
+			     TAINT(TAINT(p->ro, osA), r * dd->os),
+			     TAINT(TAINT(p->io, osA), r * dd->os)));
+     if (!cld1) goto nada;
+
+     /* R-point DFTs across the rows of one slab */
+     cldr = X(mkplan_d)(plnr,
+			X(mkproblem_dft_d)(
+			     X(mktensor_1d)(r, dd->os, dd->os),
+			     X(tensor_copy)(szBo),
+			     TAINT(TAINT(p->ro, osA), r * dd->os),
+			     TAINT(TAINT(p->io, osA), r * dd->os),
+			     TAINT(TAINT(p->ro, osA), r * dd->os),
+			     TAINT(TAINT(p->io, osA), r * dd->os)));
+     if (!cldr) goto nada;
+
+     /* M-point DFTs along D and the transforms along A */
+     szm = X(mktensor_1d)(m, r * dd->os, r * dd->os);
+     vecr = X(mktensor_1d)(r, dd->os, dd->os);
+     cld2 = X(mkplan_d)(plnr,
+			X(mkproblem_dft_d)(
+			     X(tensor_append)(szAo, szm),
+			     X(tensor_append)(vecr, szBo),
+			     p->ro, p->io, p->ro, p->io));
+     if (!cld2) goto nada;
+
+     pln = MKPLAN_DFT(P, &padt, apply);
+
+     pln->cld1 = cld1;
+     pln->cldr = cldr;
+     pln->cld2 = cld2;
+     pln->W = 0;
+     pln->r = r;
+     pln->m = m;
+     pln->nA = nA;
+     pln->isA = isA;
+     pln->osA = osA;
+     pln->isd = dd->is;
+     pln->osd = dd->os;
+     pln->nB = nB;
+     pln->osB = osB;
+     pln->solver = ego;
+
+     X(ops_zero)(&ops);
+     ops.mul = 4 * (r - 1) * nB;
+     ops.add = 2 * (r - 1) * nB;
+     X(ops_add2)(&cld1->ops, &ops);
+     X(ops_add2)(&cldr->ops, &ops);
+     X(ops_zero)(&pln->super.super.ops);
+     X(ops_madd2)(nA * m, &ops, &pln->super.super.ops);
+     X(ops_add2)(&cld2->ops, &pln->super.super.ops);
+
+     X(tensor_destroy4)(szA, szB, szAc, szBo);
+     X(tensor_destroy2)(szBc, szAo);
+     X(tensor_destroy2)(szm, vecr);
+
+     return &(pln->super.super);
+
+ nada:
+     X(plan_destroy_internal)(cld2);
+     X(plan_destroy_internal)(cldr);
+     X(plan_destroy_internal)(cld1);
+     X(tensor_destroy4)(szA, szB, szAc, szBo);
+     X(tensor_destroy2)(szBc, szAo);
+     if (szm) X(tensor_destroy2)(szm, vecr);
+     return (plan *) 0;
+}
+
+static solver *mksolver(int last)
+{
+     static const solver_adt sadt = { PROBLEM_DFT, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     slv->last = last;
+     return &(slv->super);
+}
+
+void X(dft_rank_geq2_fused_register)(planner *p)
+{
+     REGISTER_SOLVER(p, mksolver(0));
+     REGISTER_SOLVER(p, mksolver(1));
+}
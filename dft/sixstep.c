@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/* Six-step algorithm for large 1d DFTs.  With N = N1 * N2, the input
+   x[J1 + N1 * J2] is viewed as an N2 x N1 matrix and the output
+   X[K2 + N2 * K1] as an N1 x N2 matrix:
+
+   1. transpose the input into the N1 x N2 matrix U[J1][J2];
+   2. compute the N1 DFTs of size N2 of the rows of U, in place;
+   3. V[K2][J1] = U[J1][K2] * omega^(J1 * K2), a tiled transposition
+      fused with the twiddle multiplication;
+   4. compute the N2 DFTs of size N1 of the rows of V, into W[K2][K1];
+   5. transpose W into the output.
+
+   The two transpositions are rank-0 children (the planner's tiled
+   copies), and the two DFT passes run on contiguous rows, so that
+   every pass streams through the array instead of taking the large
+   strides of the recursive Cooley-Tukey plans.  If the input may be
+   destroyed, U = O and V = W = I; otherwise U = W is a scratch buffer
+   of about N elements and V = O.  The twiddle pass is split across
+   threads by X(dft_sixstep_loop_hook) when the threads library is in
+   use; the other passes are threaded by the planner as vector loops. */
+
+#include "dft/dft.h"
+
+/* smallest transform worth the extra passes, and smallest N1 */
+#define MINN 65536
+#define MINR 16
+
+/* padding of the rows of the buffer, in complex elements */
+#define PAD 8
+
+void (*X(dft_sixstep_loop_hook))(INT n, int nthr,
+				 void (*f)(INT lo, INT hi, void *args),
+				 void *args) = 0;
+
+typedef struct {
+     solver super;
+} S;
+
+typedef struct {
+     plan_dft super;
+
+     plan *cldcpy1, *cld1, *cld2, *cldcpy2;
+     INT n, n1, n2, us, urd, vs;
+     int destroy_input, nthr;
+     INT twshft, twmsk;
+     R *W0, *W1; /* omega^m = W0[m & twmsk] * W1[m >> twshft] */
+     scratch scr;
+} P;
+
+struct tw_closure {
+     const P *ego;
+     const R *ur, *ui;
+     R *vr, *vi;
+     INT tilesz;
+};
+
+static void dotile(INT k2l, INT k2u, INT j1l, INT j1u, void *args)
+{
+     const struct tw_closure *k = (const struct tw_closure *) args;
+     const P *ego = k->ego;
+     INT n = ego->n, n1 = ego->n1, n2 = ego->n2;
+     INT us = ego->us, urs = ego->urd, vs = ego->vs;
+     INT twshft = ego->twshft, twmsk = ego->twmsk;
+     const R *W0 = ego->W0, *W1 = ego->W1;
+     INT k2, j1;
+
+     for (k2 = k2l; k2 < k2u; ++k2) {
+	  INT m = (j1l * k2) % n;
+	  const R *ur = k->ur + j1l * urs + k2 * us;
+	  const R *ui = k->ui + j1l * urs + k2 * us;
+	  R *vr = k->vr + (k2 * n1 + j1l) * vs;
+	  R *vi = k->vi + (k2 * n1 + j1l) * vs;
+
+	  for (j1 = j1l; j1 < j1u; ++j1, ur += urs, ui += urs,
+		    vr += vs, vi += vs) {
+	       const R *w0 = W0 + 2 * (m & twmsk);
+	       const R *w1 = W1 + 2 * (m >> twshft);
+	       E wr = w0[0] * w1[0] - w0[1] * w1[1];
+	       E wi = w0[0] * w1[1] + w0[1] * w1[0];
+	       E re = ur[0], im = ui[0];
+	       vr[0] = re * wr + im * wi;
+	       vi[0] = im * wr - re * wi;
+	       m += k2;
+	       if (m >= n) m -= n;
+	  }
+     }
+}
+
+static void twiddle_rows(INT lo, INT hi, void *args)
+{
+     const struct tw_closure *k = (const struct tw_closure *) args;
+     X(tile2d)(lo, hi, 0, k->ego->n1, k->tilesz, dotile, args);
+}
+
+static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
+{
+     const P *ego = (const P *) ego_;
+     plan_dft *cldcpy1 = (plan_dft *) ego->cldcpy1;
+     plan_dft *cld1 = (plan_dft *) ego->cld1;
+     plan_dft *cld2 = (plan_dft *) ego->cld2;
+     plan_dft *cldcpy2 = (plan_dft *) ego->cldcpy2;
+     struct tw_closure k;
+     R *ur, *ui, *buf = 0;
+
+     if (ego->destroy_input) {
+	  ur = ro; ui = io;
+	  k.vr = ri; k.vi = ii;
+     } else {
+	  buf = X(scratch_get)(&ego->scr);
+	  ur = buf; ui = buf + 1;
+	  k.vr = ro; k.vi = io;
+     }
+
+     cldcpy1->apply(ego->cldcpy1, ri, ii, ur, ui);
+     cld1->apply(ego->cld1, ur, ui, ur, ui);
+
+     k.ego = ego;
+     k.ur = ur; k.ui = ui;
+     /* one tile of U and one of V in cache */
+     k.tilesz = X(compute_tilesz)(2, 2);
+     if (ego->nthr > 1 && X(dft_sixstep_loop_hook))
+	  X(dft_sixstep_loop_hook)(ego->n2, ego->nthr, twiddle_rows, &k);
+     else
+	  twiddle_rows(0, ego->n2, &k);
+
+     /* W is U if V is the output, and V otherwise */
+     if (ego->destroy_input) {
+	  cld2->apply(ego->cld2, k.vr, k.vi, k.vr, k.vi);
+	  cldcpy2->apply(ego->cldcpy2, k.vr, k.vi, ro, io);
+     } else {
+	  cld2->apply(ego->cld2, k.vr, k.vi, ur, ui);
+	  cldcpy2->apply(ego->cldcpy2, ur, ui, ro, io);
+	  X(scratch_put)(&ego->scr, buf);
+     }
+}
+
+static void awake(plan *ego_, enum wakefulness wakefulness)
+{
+     P *ego = (P *) ego_;
+
+     X(plan_awake)(ego->cldcpy1, wakefulness);
+     X(plan_awake)(ego->cld1, wakefulness);
+     X(plan_awake)(ego->cld2, wakefulness);
+     X(plan_awake)(ego->cldcpy2, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
+
+     if (wakefulness == SLEEPY) {
+	  X(ifree0)(ego->W0);
+	  X(ifree0)(ego->W1);
+	  ego->W0 = ego->W1 = 0;
+     } else if (!ego->W0) {
+	  INT n = ego->n, i, n0 = ego->twmsk + 1;
+	  INT nw1 = (n >> ego->twshft) + 1;
+	  triggen *t = X(mktriggen)(wakefulness, n);
+
+	  ego->W0 = (R *)MALLOC(sizeof(R) * 2 * n0, TWIDDLES);
+	  ego->W1 = (R *)MALLOC(sizeof(R) * 2 * nw1, TWIDDLES);
+	  for (i = 0; i < n0; ++i)
+	       t->cexp(t, i, ego->W0 + 2 * i);
+	  for (i = 0; i < nw1; ++i)
+	       t->cexp(t, (i << ego->twshft) % n, ego->W1 + 2 * i);
+	  X(triggen_destroy)(t);
+     }
+}
+
+static void destroy(plan *ego_)
+{
+     P *ego = (P *) ego_;
+     X(plan_destroy_internal)(ego->cldcpy2);
+     X(plan_destroy_internal)(ego->cld2);
+     X(plan_destroy_internal)(ego->cld1);
+     X(plan_destroy_internal)(ego->cldcpy1);
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *) ego_;
+     p->print(p, "(dft-sixstep-%D/%D-%D%s%(%p%)%(%p%)%(%p%)%(%p%))",
+	      ego->n, ego->n1, ego->n2,
+	      ego->destroy_input ? "-destroy-input" : "",
+	      ego->cldcpy1, ego->cld1, ego->cld2, ego->cldcpy2);
+}
+
+/* largest divisor of N not exceeding its square root */
+static INT choose_n1(INT n)
+{
+     INT n1;
+
+     for (n1 = X(isqrt)(n); n1 > 1; --n1)
+	  if (n % n1 == 0)
+	       return n1;
+     return 1;
+}
+
+static int applicable(const problem_dft *p, const planner *plnr)
+{
+     UNUSED(plnr);
+     return (1
+	     && p->sz->rnk == 1
+	     && p->vecsz->rnk == 0
+	     && p->ri != p->ro
+	     && p->sz->dims[0].n >= MINN
+	     && choose_n1(p->sz->dims[0].n) >= MINR
+	  );
+}
+
+static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
+{
+     const problem_dft *p = (const problem_dft *) p_;
+     P *pln;
+     plan *cldcpy1 = 0, *cld1 = 0, *cld2 = 0, *cldcpy2 = 0;
+     INT n, n1, n2, is, os, us, urd, vs, ws, wrd, twshft;
+     int destroy_input;
+     R *ur, *ui, *vr, *vi, *wr, *wi, *buf = 0;
+     INT bufsz = 0;
+
+     static const plan_adt padt = {
+	  X(dft_solve), awake, print, destroy
+     };
+
+     UNUSED(ego_);
+     if (!applicable(p, plnr))
+          return (plan *) 0;
+
+     n = p->sz->dims[0].n;
+     is = p->sz->dims[0].is;
+     os = p->sz->dims[0].os;
+     n1 = choose_n1(n);
+     n2 = n / n1;
+
+     destroy_input = !NO_DESTROY_INPUTP(plnr);
+     if (destroy_input) {
+	  ur = p->ro; ui = p->io; us = os; urd = n2 * os;
+	  vr = wr = p->ri; vi = wi = p->ii; vs = ws = is; wrd = n1 * is;
+     } else {
+	  /* the rows of U and W in the buffer are padded, so that the
+	     transpositions do not map a column to few cache sets */
+	  us = ws = 2;
+	  urd = 2 * (n2 + PAD);
+	  wrd = 2 * (n1 + PAD);
+	  bufsz = X(imax)(n1 * urd, n2 * wrd);
+
+	  /* initial allocation for the purpose of planning */
+	  buf = (R *) MALLOC(sizeof(R) * bufsz, BUFFERS);
+	  ur = wr = buf; ui = wi = buf + 1;
+	  vr = p->ro; vi = p->io; vs = os;
+     }
+
+     /* U[J1][J2] = x[J1 + N1 * J2] */
+     cldcpy1 = X(mkplan_d)(plnr,
+			   X(mkproblem_dft_d)(
+				X(mktensor_0d)(),
+				X(mktensor_2d)(n2, n1 * is, us,
+					       n1, is, urd),
+				p->ri, p->ii, ur, ui));
+     if (!cldcpy1) goto nada;
+
+     cld1 = X(mkplan_d)(plnr,
+			X(mkproblem_dft_d)(
+			     X(mktensor_1d)(n2, us, us),
+			     X(mktensor_1d)(n1, urd, urd),
+			     ur, ui, ur, ui));
+     if (!cld1) goto nada;
+
+     cld2 = X(mkplan_d)(plnr,
+			X(mkproblem_dft_d)(
+			     X(mktensor_1d)(n1, vs, ws),
+			     X(mktensor_1d)(n2, n1 * vs, wrd),
+			     vr, vi, wr, wi));
+     if (!cld2) goto nada;
+
+     /* X[K2 + N2 * K1] = W[K2][K1] */
+     cldcpy2 = X(mkplan_d)(plnr,
+			   X(mkproblem_dft_d)(
+				X(mktensor_0d)(),
+				X(mktensor_2d)(n2, wrd, os,
+					       n1, ws, n2 * os),
+				wr, wi, p->ro, p->io));
+     if (!cldcpy2) goto nada;
+
+     /* deallocate the buffer, let apply() take it from the scratch
+	arena */
+     X(ifree0)(buf);
+
+     pln = MKPLAN_DFT(P, &padt, apply);
+
+     pln->cldcpy1 = cldcpy1;
+     pln->cld1 = cld1;
+     pln->cld2 = cld2;
+     pln->cldcpy2 = cldcpy2;
+     pln->n = n;
+     pln->n1 = n1;
+     pln->n2 = n2;
+     pln->us = us;
+     pln->urd = urd;
+     pln->vs = vs;
+     pln->destroy_input = destroy_input;
+     pln->nthr = plnr->nthr;
+     for (twshft = 0; ((INT)1 << (2 * twshft)) < n; ++twshft)
+	  ;
+     pln->twshft = twshft;
+     pln->twmsk = ((INT)1 << twshft) - 1;
+     pln->W0 = pln->W1 = 0;
+     X(scratch_init)(&pln->scr,
+		     destroy_input ? 0 : sizeof(R) * (size_t)bufsz);
+
+     X(ops_add)(&cld1->ops, &cld2->ops, &pln->super.super.ops);
+     X(ops_add2)(&cldcpy1->ops, &pln->super.super.ops);
+     X(ops_add2)(&cldcpy2->ops, &pln->super.super.ops);
+     pln->super.super.ops.mul += 8 * n;
+     pln->super.super.ops.add += 4 * n;
+
+     return &(pln->super.super);
+
+ nada:
+     X(ifree0)(buf);
+     X(plan_destroy_internal)(cldcpy2);
+     X(plan_destroy_internal)(cld2);
+     X(plan_destroy_internal)(cld1);
+     X(plan_destroy_internal)(cldcpy1);
+     return (plan *) 0;
+}
+
+static solver *mksolver(void)
+{
+     static const solver_adt sadt = { PROBLEM_DFT, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     return &(slv->super);
+}
+
+void X(dft_sixstep_register)(planner *p)
+{
+     REGISTER_SOLVER(p, mksolver());
+}
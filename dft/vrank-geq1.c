@@ -182,8 +182,10 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      pln->super.super.ops.other = 3.14159; /* magic to prefer codelet loops */
      X(ops_madd2)(pln->vl, &cld->ops, &pln->super.super.ops);
 
-     if (p->sz->rnk != 1 || (p->sz->dims[0].n > 64))
+     if (p->sz->rnk != 1 || (p->sz->dims[0].n > 64)) {
 	  pln->super.super.pcost = pln->vl * cld->pcost;
+	  pln->super.super.pvar = pln->vl * cld->pvar;
+     }
 
      return &(pln->super.super);
 }
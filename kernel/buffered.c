@@ -29,13 +29,18 @@
 
 INT X(nbuf)(INT n, INT vl, INT maxnbuf)
 {
-     INT i, nbuf, lb; 
+     INT i, nbuf, lb, bufsz; 
 
      if (!maxnbuf) 
 	  maxnbuf = DEFAULT_MAXNBUF;
 
+     /* fill the L2 cache with complex buffers, but leave half of a
+	declared per-thread cache to the child plan */
+     bufsz = X(imin)(MAXBUFSZ,
+		     (INT)(X(cache_size)(2) / (2 * sizeof(R))));
+     bufsz = X(cache_fit)(bufsz, 2 * 2 * (INT)sizeof(R));
      nbuf = X(imin)(maxnbuf,
-		    X(imin)(vl, X(imax)((INT)1, MAXBUFSZ / n)));
+		    X(imin)(vl, X(imax)((INT)1, bufsz / n)));
 
      /*
       * Look for a buffer number (not too small) that divides the
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2021, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Cache model used by the planner when plans will run on a shared
+   last-level cache.  By default the planner assumes that it owns the
+   whole cache, which is what an idle machine at planning time shows.
+   The user may instead declare the cache capacity that one thread can
+   count on in production, and/or the size of a background working set
+   that competes with the transform for the cache.  The former bounds
+   the tile and buffer sizes chosen by the solvers; the latter is swept
+   through the cache before every timed execution in
+   X(measure_execution_time). */
+
+#include "kernel/ifftw.h"
+#include <string.h>
+
+size_t X(effective_cache_size) = 0; /* bytes per thread, 0 = unlimited */
+size_t X(cache_pressure) = 0; /* bytes of competing data, 0 = none */
+
+static R *pressure_buf = 0;
+static INT pressure_n = 0;
+
+void X(cache_pressure_init)(size_t effective_cache_size, size_t pressure)
+{
+     X(cache_pressure_cleanup)();
+
+     X(effective_cache_size) = effective_cache_size;
+     if (pressure > 0) {
+	  pressure_n = (INT)(pressure / sizeof(R));
+	  pressure_buf = (R *) MALLOC(sizeof(R) * pressure_n, OTHER);
+	  memset(pressure_buf, 0, sizeof(R) * pressure_n);
+	  X(cache_pressure) = pressure;
+     }
+}
+
+void X(cache_pressure_cleanup)(void)
+{
+     if (pressure_buf) {
+	  X(ifree)(pressure_buf);
+	  pressure_buf = 0;
+	  pressure_n = 0;
+     }
+     X(effective_cache_size) = 0;
+     X(cache_pressure) = 0;
+}
+
+/* Dirty one element per cache line of the pressure buffer, evicting
+   (in LRU order) whatever the transform left in the cache, much as a
+   co-tenant streaming through its own data would. */
+void X(cache_pollute)(void)
+{
+     INT i, stride = 64 / (INT)sizeof(R);
+     R *buf = pressure_buf;
+
+     for (i = 0; i < pressure_n; i += stride)
+	  buf[i] += K(1.0);
+}
+
+/* Largest number of elements of ELSZ bytes each that fit in the
+   declared per-thread cache, but never more than DFLT. */
+INT X(cache_fit)(INT dflt, INT elsz)
+{
+     INT n;
+
+     if (!X(effective_cache_size))
+	  return dflt;
+     n = (INT)(X(effective_cache_size) / (size_t)elsz);
+     return X(imax)(1, X(imin)(dflt, n));
+}
+
+/* TRUE if a working set of NBYTES does not fit in the declared
+   per-thread cache */
+int X(cache_oversubscribedp)(INT nbytes)
+{
+     return X(effective_cache_size) > 0
+	  && (size_t)nbytes > X(effective_cache_size);
+}
+
+/* Cache hierarchy of the machine we are running on: the sizes of the
+   L1 data cache and of the L2 and L3 caches that serve one core.  A
+   single binary built with the dynamic dispatcher runs on CPUs whose
+   caches differ, so these are read at run time, on first use, from
+   CPUID (leaf 0x8000001D on AMD, leaf 4 on Intel, which share their
+   layout, or the older AMD leaves 0x80000005/6) or else from sysfs.
+   Containers and virtual machines may misreport them; the user can
+   override any of them with X(cache_set_sizes) or with the
+   FFTW_CACHE_SIZES environment variable ("L1D,L2,L3", each a size with
+   an optional K or M suffix, or 0 to keep the detected value). */
+
+#define CACHE_ENV "FFTW_CACHE_SIZES"
+
+/* what the tile and buffer sizes assumed before they were probed */
+#define DEFAULT_L1D (32 * 1024)
+#define DEFAULT_L2 (512 * 1024)
+
+static size_t detected[3], override[3];
+static int probed = 0;
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64)
+#  include "simd-support/amd64-cpuid.h"
+#  define HAVE_CACHE_CPUID 1
+#elif (defined(__i386__) || defined(_M_IX86)) && defined(__GNUC__)
+#  include "simd-support/x86-cpuid.h"
+#  define HAVE_CACHE_CPUID 1
+#endif
+
+#ifdef HAVE_CACHE_CPUID
+/* walk the deterministic cache parameters of LEAF */
+static void cpuid_cache_leaf(int leaf, size_t *sz)
+{
+     int i, eax, ebx, ecx, edx;
+
+     for (i = 0; i < 16; ++i) {
+	  int type, level;
+
+	  cpuid_all(leaf, i, &eax, &ebx, &ecx, &edx);
+	  type = eax & 0x1f;
+	  if (type == 0)
+	       break; /* no more caches */
+	  level = (eax >> 5) & 7;
+	  if (type == 2 || level < 1 || level > 3)
+	       continue; /* instruction cache */
+	  sz[level - 1] = (size_t)(((unsigned)ebx >> 22) + 1) /* ways */
+	       * (size_t)((((unsigned)ebx >> 12) & 0x3ff) + 1) /* partitions */
+	       * (size_t)(((unsigned)ebx & 0xfff) + 1) /* line size */
+	       * (size_t)((unsigned)ecx + 1); /* sets */
+     }
+}
+
+static void cpuid_caches(size_t *sz)
+{
+     int eax, ebx, ecx, edx, max_stdfn, amd;
+     unsigned max_extfn;
+
+     cpuid_all(0, 0, &eax, &ebx, &ecx, &edx);
+     max_stdfn = eax;
+     /* "AuthenticAMD" or "HygonGenuine" */
+     amd = (ebx == 0x68747541 && edx == 0x69746e65 && ecx == 0x444d4163)
+	  || (ebx == 0x6f677948 && edx == 0x6e65476e && ecx == 0x656e6975);
+     cpuid_all((int)0x80000000, 0, &eax, &ebx, &ecx, &edx);
+     max_extfn = (unsigned)eax;
+
+     if (amd) {
+	  /* topology extensions */
+	  if (max_extfn >= 0x8000001Du) {
+	       cpuid_all((int)0x80000001, 0, &eax, &ebx, &ecx, &edx);
+	       if (ecx & (1 << 22)) {
+		    cpuid_cache_leaf((int)0x8000001D, sz);
+		    return;
+	       }
+	  }
+	  if (max_extfn >= 0x80000006u) {
+	       cpuid_all((int)0x80000005, 0, &eax, &ebx, &ecx, &edx);
+	       sz[0] = (size_t)(((unsigned)ecx >> 24) & 0xff) * 1024;
+	       cpuid_all((int)0x80000006, 0, &eax, &ebx, &ecx, &edx);
+	       sz[1] = (size_t)(((unsigned)ecx >> 16) & 0xffff) * 1024;
+	       sz[2] = (size_t)(((unsigned)edx >> 18) & 0x3fff) * 512 * 1024;
+	  }
+     } else if (max_stdfn >= 4) {
+	  cpuid_cache_leaf(4, sz);
+     }
+}
+#endif
+
+/* parse a size such as "512K" at *S, advancing *S past it */
+static size_t parse_size(const char **s)
+{
+     size_t n = 0;
+     const char *p = *s;
+
+     while (*p == ' ') ++p;
+     while (*p >= '0' && *p <= '9')
+	  n = 10 * n + (size_t)(*p++ - '0');
+     switch (*p) {
+	 case 'k': case 'K': n <<= 10; ++p; break;
+	 case 'm': case 'M': n <<= 20; ++p; break;
+	 case 'g': case 'G': n <<= 30; ++p; break;
+     }
+     *s = p;
+     return n;
+}
+
+#ifdef __linux__
+#include <stdio.h>
+
+static int read_line(const char *path, char *buf, int len)
+{
+     FILE *f = fopen(path, "r");
+     int ok;
+
+     if (!f)
+	  return 0;
+     ok = fgets(buf, len, f) != 0;
+     fclose(f);
+     return ok;
+}
+
+static void sysfs_caches(size_t *sz)
+{
+     int i;
+
+     for (i = 0; i < 16; ++i) {
+	  char path[96], buf[32];
+	  const char *s;
+	  int level;
+
+	  sprintf(path, "/sys/devices/system/cpu/cpu0/cache/index%d/level", i);
+	  if (!read_line(path, buf, sizeof(buf)))
+	       break;
+	  level = buf[0] - '0';
+	  sprintf(path, "/sys/devices/system/cpu/cpu0/cache/index%d/type", i);
+	  if (level < 1 || level > 3 || !read_line(path, buf, sizeof(buf))
+	      || buf[0] == 'I')
+	       continue; /* instruction cache */
+	  sprintf(path, "/sys/devices/system/cpu/cpu0/cache/index%d/size", i);
+	  if (!read_line(path, buf, sizeof(buf)))
+	       continue;
+	  s = buf;
+	  sz[level - 1] = parse_size(&s);
+     }
+}
+#endif
+
+static void probe_caches(void)
+{
+     const char *env;
+     int i;
+
+#ifdef HAVE_CACHE_CPUID
+     cpuid_caches(detected);
+#endif
+#ifdef __linux__
+     if (!detected[0] || !detected[1])
+	  sysfs_caches(detected);
+#endif
+     if (!detected[0]) detected[0] = DEFAULT_L1D;
+     if (!detected[1]) detected[1] = DEFAULT_L2;
+     /* detected[2] stays 0 if there is no L3 or we cannot tell */
+
+     if ((env = getenv(CACHE_ENV)) != 0) {
+	  for (i = 0; i < 3 && *env; ++i) {
+	       size_t n = parse_size(&env);
+	       if (n && !override[i])
+		    override[i] = n;
+	       while (*env == ' ') ++env;
+	       if (*env != ',' && *env != ':')
+		    break;
+	       ++env;
+	  }
+     }
+     probed = 1;
+}
+
+/* size in bytes of the level LEVEL (1 = L1 data, 2, 3) cache of one
+   core, or 0 if unknown */
+size_t X(cache_size)(int level)
+{
+     A(level >= 1 && level <= 3);
+     if (!probed)
+	  probe_caches();
+     return override[level - 1] ? override[level - 1] : detected[level - 1];
+}
+
+void X(cache_set_sizes)(size_t l1d, size_t l2, size_t l3)
+{
+     if (!probed)
+	  probe_caches();
+     override[0] = l1d;
+     override[1] = l2;
+     override[2] = l3;
+#ifdef AMD_OPT_TRANS
+     X(enquire_L1DcacheSize)();
+#endif
+}
@@ -89,7 +89,7 @@ extern "C"
 //disables 128-bit AVX2 versions of kernels and prefers only 256-bit AVX2 kernels support
 //This optimization switch is disabled by default. If it is enabled, WISDOM feature is not to be used.
 //#define AMD_OPT_PREFER_256BIT_FPU
-#define AMD_OPT_128BIT_KERNELS_THRESHOLD 1024//Below this SIZE, 128-bit AVX2 kernels allowed
+#define AMD_OPT_128BIT_KERNELS_THRESHOLD ((INT)(X(cache_size)(1) / 32))//Below this SIZE (1024 for a 32KB L1D), 128-bit AVX2 kernels allowed
 //--------------------------------
 //CPY2d related optimizations :- enable Either (i)C switch Or (ii)INTRIN switch
 //#define AMD_OPT_IN_PLACE_1D_CPY2D_STABLE_C
@@ -170,10 +170,12 @@ extern "C"
 //NEW TOP N PLANNER feature for AMD CPUs can be enabled with the below switch AMD_TOP_N_PLANNER.
 //The new Top N planner improves the run-to-run variations by using a dynamic wisdom (preset) plan functionality.
 //This feature implements the mechanism to search and store top N plans into the wisdom file and then use these plans to find the best plan for execution in the consecutive runs.
-//AMD_TOP_N_PLANNER can not be used with AMD_FAST_PLANNER. Only one of them can be enabled at a time. 
+//The planner keeps one pair of hash tables per rank. N can be changed at run time with fftw_plan_with_top_n(n), up to AMD_OPT_TOP_N_MAX.
+//AMD_TOP_N_PLANNER can be combined with AMD_FAST_PLANNER and with the threads/OpenMP libraries.
 #ifdef AMD_OPT_TOP_N_PLANNER 
 #define AMD_TOP_N_PLANNER
-#define AMD_OPT_TOP_N 3 //The value of AMD_OPT_TOP_N is fixed as 3, enabling the search, store and re-use of Top 3 plans. This value should not be changed by the user.
+#define AMD_OPT_TOP_N 3 //Default number of plans searched, stored and re-used for every problem.
+#define AMD_OPT_TOP_N_MAX 16 //Largest N accepted by fftw_plan_with_top_n.
 #endif
 //--------------------------------
 //Below switches and flags enable/disable and control AMD's separate optimization layer for Applications like QE, VASP, etc.
@@ -435,6 +437,12 @@ extern void X(debug)(const char *format, ...);
 extern void *X(kernel_malloc)(size_t n);
 extern void X(kernel_free)(void *p);
 
+/* huge-page policies of X(kernel_malloc), as FFTW_ALLOC_* in fftw3.h */
+enum { ALLOC_DEFAULT, ALLOC_THP, ALLOC_HUGETLB };
+extern void X(kernel_set_alloc_policy)(int policy, size_t threshold);
+extern void X(kernel_alloc_stats)(size_t *thp, size_t *hugetlb,
+				  size_t *peak, size_t *nalloc);
+
 /*-----------------------------------------------------------------------*/
 /* alloc.c: */
 
@@ -495,6 +503,7 @@ IFFTW_EXTERN void *X(malloc_plain)(size_t sz);
 crude_time X(get_crude_time)(void);
 double X(elapsed_since)(const planner *plnr, const problem *p,
 			crude_time t0); /* time in seconds since t0 */
+double X(seconds_since)(crude_time t0); /* ditto, without the cost hook */
 
 /*-----------------------------------------------------------------------*/
 /* ops.c: */
@@ -692,6 +701,9 @@ struct printer_s {
      void (*cleanup)(printer *p);
      int indent;
      int indent_incr;
+     /* if nonzero, called before (ENTER = 1) and after (ENTER = 0)
+	printing each child plan with %p */
+     void (*plan_hook)(printer *p, const plan *x, int enter);
 };
 
 printer *X(mkprinter)(size_t size, 
@@ -732,8 +744,11 @@ struct plan_s {
      const plan_adt *adt;
      opcnt ops;
      double pcost;
+     double pvar; /* variance of a measured pcost, 0 if not known */
      enum wakefulness wakefulness; /* used for debugging only */
      int could_prune_now_p;
+     int apply_arity; /* number of array arguments of apply, 0 if unknown */
+     struct profnode_s *prof; /* execution profile (api/profile-plan.c) */
 };
 
 plan *X(mkplan)(size_t size, const plan_adt *adt);
@@ -898,6 +913,17 @@ typedef struct {
 
 typedef enum { COST_SUM, COST_MAX } cost_kind;
 
+/* one candidate solver of a parallel search, see X(planner_psearch_cand) */
+typedef struct {
+     unsigned slvndx;
+     double cost;           /* pcost of the plan, < 0 if no plan */
+     double var;            /* pvar of the plan */
+     int could_prune_now_p;
+     int timed_out;
+     int nplan, nprob;      /* statistics of the worker planner */
+     double pcost;
+} psearch_cand;
+
 struct planner_s {
      const planner_adt *adt;
      void (*hook)(struct planner_s *plnr, plan *pln, 
@@ -907,6 +933,17 @@ struct planner_s {
      void (*nowisdom_hook)(const problem *p);
      wisdom_state_t (*bogosity_hook)(wisdom_state_t state, const problem *p);
 
+     /* parallel search, installed by the threads library: evaluate
+	the NCAND candidates C of problem P concurrently, return 0 if
+	not possible */
+     int (*psearch_hook)(struct planner_s *plnr, const problem *p,
+			 const flags_t *flagsp, psearch_cand *c, int ncand);
+     /* for the workers of a parallel search: the planner whose search
+	they share, and a lock for the state that they share with each
+	other (the tables of MASTER and the twiddle tables) */
+     struct planner_s *master;
+     void (*lock_hook)(int lockp);
+
      /* solver descriptors */
      slvdesc *slvdescs;
      unsigned nslvdesc, slvdescsiz;
@@ -917,14 +954,19 @@ struct planner_s {
      wisdom_state_t wisdom_state;
 
 #ifdef AMD_TOP_N_PLANNER
-     hashtab htab_blessed[AMD_OPT_TOP_N];
-     hashtab htab_unblessed[AMD_OPT_TOP_N];
-     int index;
+     /* one pair of tables per rank */
+     hashtab *htab_blessed;
+     hashtab *htab_unblessed;
+     int top_n; /* number of ranks */
+     int index; /* rank being planned */
 #else
      hashtab htab_blessed;
      hashtab htab_unblessed;
 #endif
 
+     /* read-only binary wisdom image, see X(planner_map_wisdom) */
+     const void *wisdom_map;
+
      int nthr;
      flags_t flags;
 
@@ -936,18 +978,33 @@ struct planner_s {
      int size;
 #endif
 
+     /* if nonzero, a log of the planning decisions, one JSON
+	record per line (see X(set_planner_trace)) */
+     printer *trace;
+
      /* various statistics */
      int nplan;    /* number of plans evaluated */
      double pcost, epcost; /* total pcost of measured/estimated plans */
      int nprob;    /* number of problems evaluated */
+     int nsearch;  /* number of problems searched, not found in wisdom */
+     int ntimeout; /* number of times the time limit was hit */
+     int nswap;    /* number of times the unblessed tables were recycled */
 };
 
+planner *X(mkplanner)(void);
 #ifdef AMD_TOP_N_PLANNER
-     extern int wisp_set;     /* flag to identify if the plans for an input problem size is found in the wisdom file or not*/
+void X(planner_set_top_n)(planner *ego, int n);
+plan *X(mkplan_top_n)(planner *ego, const problem *p);
 #endif
-
-planner *X(mkplanner)(void);
 void X(planner_destroy)(planner *ego);
+int X(planner_map_wisdom)(planner *ego, const void *img, size_t sz);
+void X(planner_unmap_wisdom)(planner *ego);
+size_t X(planner_export_binary)(planner *ego, void *buf);
+void X(planner_htab_stats)(const planner *ego, hashtab *sum);
+void X(planner_reset_stats)(planner *ego);
+void X(planner_psearch_cand)(planner *ego, planner *master,
+			     const problem *p, const flags_t *flagsp,
+			     psearch_cand *c);
 
 /*
   Iterate over all solvers.   Read:
@@ -1074,13 +1131,46 @@ typedef struct twid_s {
      INT n, r, m;                /* transform order, radix, # twiddle rows */
      int refcnt;
      const tw_instr *instr;
+     tw_instr *icopy;          /* INSTR, if owned by this table */
      struct twid_s *cdr;
      enum wakefulness wakefulness;
+     int mapped;               /* W and INSTR belong to a twiddle file */
+     struct triggen_s *t;      /* trig generator of size N, shared */
 } twid;
 
 INT X(twiddle_length)(INT r, const tw_instr *p);
 void X(twiddle_awake)(enum wakefulness wakefulness,
 		      twid **pp, const tw_instr *instr, INT n, INT r, INT m);
+size_t X(twiddle_export)(void *buf);
+int X(twiddle_map)(const void *img, size_t sz);
+void X(twiddle_unmap)(void);
+
+/*-----------------------------------------------------------------------*/
+/* scratch.c */
+/* scratch buffer of a plan, carved at execution time from the arena of
+   the apiplan that contains the plan */
+typedef struct {
+     size_t n;   /* bytes */
+     size_t off; /* offset in the arena, or SCRATCH_NONE */
+} scratch;
+
+#define SCRATCH_NONE (~(size_t)0)
+
+typedef struct {
+     char *base;
+     size_t n;
+} scratch_arena;
+
+void X(scratch_init)(scratch *s, size_t n);
+void X(scratch_awake)(scratch *s, enum wakefulness wakefulness);
+R *X(scratch_get)(const scratch *s);
+void X(scratch_put)(const scratch *s, R *buf);
+
+void X(scratch_layout_begin)(void);
+size_t X(scratch_layout_end)(void);
+IFFTW_EXTERN void X(scratch_current)(scratch_arena *a);
+IFFTW_EXTERN void X(scratch_enter)(const scratch_arena *a, scratch_arena *saved);
+IFFTW_EXTERN void X(scratch_leave)(const scratch_arena *saved);
 
 /*-----------------------------------------------------------------------*/
 /* trig.c */
@@ -1104,6 +1194,12 @@ struct triggen_s {
      INT twmsk;
      trigreal *W0, *W1;
      INT n;
+
+     /* generators are shared by all the users of the same N and
+	wakefulness, see X(mktriggen) */
+     enum wakefulness wakefulness;
+     int refcnt;
+     triggen *cdr;
 };
 
 triggen *X(mktriggen)(enum wakefulness wakefulness, INT n);
@@ -1146,19 +1242,29 @@ void X(rader_tl_delete)(R *W, rader_tl **tl);
 /*-----------------------------------------------------------------------*/
 /* copy/transposition routines */
 
-#if defined(AMD_OPT_AUTO_TUNED_TRANS_BLK_SIZE) || defined(AMD_OPT_AUTO_TUNED_RASTER_TILED_TRANS_METHOD)
-/* upper bound to the cache size based on latest CPU architectures, for AMD optimized tiled routines */
+/* upper bound to the L1 cache size used by the tiled routines, which
+   size their stack buffers by it; the size actually used is the
+   probed one, X(cache_size)(1), when smaller */
 #define CACHESIZE 32768
+#if defined(AMD_OPT_AUTO_TUNED_TRANS_BLK_SIZE) || defined(AMD_OPT_AUTO_TUNED_RASTER_TILED_TRANS_METHOD)
 #define BLK_SIZE 32
 extern unsigned int L1D_blk_size;// = CACHESIZE;
 extern unsigned int L1Dsize;// = BLK_SIZE;
-#else
-/* lower bound to the cache size, for tiled routines */
-#define CACHESIZE 8192
 #endif
 
 INT X(compute_tilesz)(INT vl, int how_many_tiles_in_cache);
 
+/* cache.c: */
+extern size_t X(effective_cache_size);
+extern size_t X(cache_pressure);
+void X(cache_pressure_init)(size_t effective_cache_size, size_t pressure);
+void X(cache_pressure_cleanup)(void);
+void X(cache_pollute)(void);
+INT X(cache_fit)(INT dflt, INT elsz);
+int X(cache_oversubscribedp)(INT nbytes);
+size_t X(cache_size)(int level);
+void X(cache_set_sizes)(size_t l1d, size_t l2, size_t l3);
+
 void X(tile2d)(INT n0l, INT n0u, INT n1l, INT n1u, INT tilesz,
 	       void (*f)(INT n0l, INT n0u, INT n1l, INT n1u, void *args),
 	       void *args);
@@ -1203,6 +1309,8 @@ void X(cpy2d_pair_co)(R *I0, R *I1, R *O0, R *O1,
 void X(transpose)(R *I, INT n, INT s0, INT s1, INT vl);
 void X(transpose_tiled)(R *I, INT n, INT s0, INT s1, INT vl);
 void X(transpose_tiledbuf)(R *I, INT n, INT s0, INT s1, INT vl);
+void X(transpose_tiled_slab)(R *I, INT l, INT u, INT s0, INT s1, INT vl);
+void X(transpose_tiledbuf_slab)(R *I, INT l, INT u, INT s0, INT s1, INT vl);
 
 typedef void (*transpose_func)(R *I, INT n, INT s0, INT s1, INT vl);
 typedef void (*cpy2d_func)(R *I, R *O,
@@ -1219,8 +1327,10 @@ double X(iestimate_cost)(const planner *, const plan *, const problem *);
 extern unsigned X(random_estimate_seed);
 #endif
 
+extern double X(timing_rel_ci);
+extern double X(timing_stability);
 double X(measure_execution_time)(const planner *plnr, 
-				 plan *pln, const problem *p);
+				 plan *pln, const problem *p, double *var);
 IFFTW_EXTERN int X(ialignment_of)(R *p);
 unsigned X(hash)(const char *s);
 INT X(nbuf)(INT n, INT vl, INT maxnbuf);
@@ -41,6 +41,149 @@ extern int posix_memalign(void **, size_t, size_t);
 
 #define real_free free /* memalign and malloc use ordinary free */
 
+/* Huge-page allocation policy.  Under ALLOC_THP, blocks of at least
+   the threshold are mapped on a huge-page boundary and advised with
+   MADV_HUGEPAGE, so that the kernel backs them with transparent huge
+   pages; under ALLOC_HUGETLB they are mapped from the hugetlbfs pool
+   with MAP_HUGETLB, falling back to ALLOC_THP if the pool is empty.
+   The mapped blocks are kept in a list, which X(kernel_free) searches
+   while it is not empty.  Only large blocks are mapped, so the list
+   stays short. */
+#if defined(__linux__) && defined(HAVE_UNISTD_H)
+#  include <sys/mman.h>
+#  define HAVE_HUGE_ALLOC 1
+#endif
+
+#define HUGE_PAGE_SIZE ((size_t) 2 << 20)
+
+static int alloc_policy = ALLOC_DEFAULT;
+static size_t alloc_threshold = HUGE_PAGE_SIZE;
+
+#ifdef HAVE_HUGE_ALLOC
+typedef struct huge_block_s {
+     void *p;
+     size_t len;
+     int policy;
+     struct huge_block_s *next;
+} huge_block;
+
+static huge_block *huge_blocks = 0;
+static size_t huge_bytes[ALLOC_HUGETLB + 1], huge_peak, huge_nalloc;
+
+#  if defined(__GNUC__)
+static int huge_lock = 0;
+#    define HUGE_LOCK() \
+     while (__atomic_exchange_n(&huge_lock, 1, __ATOMIC_ACQUIRE))
+#    define HUGE_UNLOCK() __atomic_store_n(&huge_lock, 0, __ATOMIC_RELEASE)
+#    define HUGE_ANY() \
+     (__atomic_load_n(&huge_blocks, __ATOMIC_RELAXED) != 0)
+#  else
+#    define HUGE_LOCK()
+#    define HUGE_UNLOCK()
+#    define HUGE_ANY() (huge_blocks != 0)
+#  endif
+
+static void *huge_malloc(size_t n)
+{
+     size_t len = (n + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+     void *p = MAP_FAILED;
+     int policy = ALLOC_THP;
+     huge_block *b;
+
+#  ifdef MAP_HUGETLB
+     if (alloc_policy == ALLOC_HUGETLB) {
+	  p = mmap(0, len, PROT_READ | PROT_WRITE,
+		   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+	  policy = ALLOC_HUGETLB;
+     }
+#  endif
+     if (p == MAP_FAILED) {
+	  /* map one huge page more than needed and trim the ends, to
+	     start on a huge-page boundary */
+	  char *q = (char *) mmap(0, len + HUGE_PAGE_SIZE,
+				  PROT_READ | PROT_WRITE,
+				  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	  size_t head;
+
+	  if (q == (char *) MAP_FAILED)
+	       return 0;
+	  head = (HUGE_PAGE_SIZE - (uintptr_t) q % HUGE_PAGE_SIZE)
+	       % HUGE_PAGE_SIZE;
+	  if (head)
+	       munmap(q, head);
+	  munmap(q + head + len, HUGE_PAGE_SIZE - head);
+	  p = q + head;
+#  ifdef MADV_HUGEPAGE
+	  madvise(p, len, MADV_HUGEPAGE);
+#  endif
+	  policy = ALLOC_THP;
+     }
+
+     if (!(b = (huge_block *) malloc(sizeof(huge_block)))) {
+	  munmap(p, len);
+	  return 0;
+     }
+     b->p = p;
+     b->len = len;
+     b->policy = policy;
+
+     HUGE_LOCK();
+     b->next = huge_blocks;
+     huge_blocks = b;
+     huge_bytes[policy] += len;
+     if (huge_bytes[ALLOC_THP] + huge_bytes[ALLOC_HUGETLB] > huge_peak)
+	  huge_peak = huge_bytes[ALLOC_THP] + huge_bytes[ALLOC_HUGETLB];
+     ++huge_nalloc;
+     HUGE_UNLOCK();
+
+     return p;
+}
+
+/* unmap P and return 1 if it is a mapped block, else return 0 */
+static int huge_free(void *p)
+{
+     huge_block **bp, *b = 0;
+
+     HUGE_LOCK();
+     for (bp = &huge_blocks; *bp; bp = &(*bp)->next)
+	  if ((*bp)->p == p) {
+	       b = *bp;
+	       *bp = b->next;
+	       huge_bytes[b->policy] -= b->len;
+	       break;
+	  }
+     HUGE_UNLOCK();
+
+     if (!b)
+	  return 0;
+     munmap(b->p, b->len);
+     free(b);
+     return 1;
+}
+#endif /* HAVE_HUGE_ALLOC */
+
+void X(kernel_set_alloc_policy)(int policy, size_t threshold)
+{
+     alloc_policy = policy;
+     /* smaller blocks would waste most of a huge page */
+     alloc_threshold = threshold > HUGE_PAGE_SIZE ? threshold : HUGE_PAGE_SIZE;
+}
+
+void X(kernel_alloc_stats)(size_t *thp, size_t *hugetlb, size_t *peak,
+			   size_t *nalloc)
+{
+#ifdef HAVE_HUGE_ALLOC
+     HUGE_LOCK();
+     *thp = huge_bytes[ALLOC_THP];
+     *hugetlb = huge_bytes[ALLOC_HUGETLB];
+     *peak = huge_peak;
+     *nalloc = huge_nalloc;
+     HUGE_UNLOCK();
+#else
+     *thp = *hugetlb = *peak = *nalloc = 0;
+#endif
+}
+
 #define IS_POWER_OF_TWO(n) (((n) > 0) && (((n) & ((n) - 1)) == 0))
 #if defined(WITH_OUR_MALLOC) && (MIN_ALIGNMENT >= 8) && IS_POWER_OF_TWO(MIN_ALIGNMENT)
 /* Our own MIN_ALIGNMENT-aligned malloc/free.  Assumes sizeof(void*) is a
@@ -72,6 +215,12 @@ void *X(kernel_malloc)(size_t n)
 {
      void *p;
 
+#ifdef HAVE_HUGE_ALLOC
+     if (alloc_policy != ALLOC_DEFAULT && n >= alloc_threshold
+	 && (p = huge_malloc(n)))
+	  return p;
+#endif
+
 #if defined(MIN_ALIGNMENT)
 
 #  if defined(WITH_OUR_MALLOC)
@@ -140,5 +289,9 @@ void *X(kernel_malloc)(size_t n)
 
 void X(kernel_free)(void *p)
 {
+#ifdef HAVE_HUGE_ALLOC
+     if (HUGE_ANY() && huge_free(p))
+	  return;
+#endif
      real_free(p);
 }
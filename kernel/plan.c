@@ -33,8 +33,11 @@ plan *X(mkplan)(size_t size, const plan_adt *adt)
      p->adt = adt;
      X(ops_zero)(&p->ops);
      p->pcost = 0.0;
+     p->pvar = 0.0;
      p->wakefulness = SLEEPY;
      p->could_prune_now_p = 0;
+     p->apply_arity = 0;
+     p->prof = 0;
      
      return p;
 }
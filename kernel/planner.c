@@ -24,9 +24,8 @@
 #include "dft/dft.h"
 #endif
 #include <string.h>
-#ifdef AMD_TOP_N_PLANNER
-int wisp_set; //Referring to extern variable declared in kernel/ifftw.h
-#endif
+#include <math.h>
+#include <stdio.h>
 
 
 /* GNU Coding Standards, Sec. 5.2: "Please write the comments in a GNU
@@ -180,6 +179,12 @@ static void md5hash(md5 *m, const problem *p, const planner *plnr)
      X(md5begin)(m);
      X(md5unsigned)(m, sizeof(R)); /* so we don't mix different precisions */
      X(md5int)(m, plnr->nthr);
+     if (X(effective_cache_size) || X(cache_pressure)) {
+	  /* plans tuned for a shared cache are not interchangeable
+	     with plans tuned for an idle machine */
+	  X(md5unsigned)(m, (unsigned) (X(effective_cache_size) >> 10));
+	  X(md5unsigned)(m, (unsigned) (X(cache_pressure) >> 10));
+     }
      p->adt->hash(p, m);
      X(md5end)(m);
 }
@@ -206,6 +211,11 @@ static void sigcpy(const md5sig a, md5sig b)
 struct solution_s {
      md5sig s;
      flags_t flags;
+#ifdef AMD_TOP_N_PLANNER
+     /* mean and standard deviation of the measured time of the plan,
+	0 if not measured */
+     float cost, spread;
+#endif
 };
 
 static solution *htab_lookup(hashtab *ht, const md5sig s, 
@@ -244,18 +254,30 @@ static solution *htab_lookup(hashtab *ht, const md5sig s,
      return best;
 }
 
+static solution *mlookup(planner *ego, const md5sig s, 
+			 const flags_t *flagsp);
+
+/* The Top N planner keeps one pair of tables per rank, and plans
+   with those of rank EGO->INDEX. */
+#ifdef AMD_TOP_N_PLANNER
+#  define NTABLES(ego) ((unsigned) (ego)->top_n)
+#  define BLESSED(ego, t) (&(ego)->htab_blessed[t])
+#  define UNBLESSED(ego, t) (&(ego)->htab_unblessed[t])
+#  define CUR_TABLE(ego) ((unsigned) (ego)->index)
+#else
+#  define NTABLES(ego) 1U
+#  define BLESSED(ego, t) (&(ego)->htab_blessed)
+#  define UNBLESSED(ego, t) (&(ego)->htab_unblessed)
+#  define CUR_TABLE(ego) 0U
+#endif
+
 static solution *hlookup(planner *ego, const md5sig s, 
 			 const flags_t *flagsp)
 {
-#ifdef AMD_TOP_N_PLANNER    
-     solution *sol = htab_lookup(&ego->htab_blessed[ego->index], s, flagsp);
-     if (!sol) sol = htab_lookup(&ego->htab_unblessed[ego->index], s, flagsp);
-     return sol;	
-#else	
-     solution *sol = htab_lookup(&ego->htab_blessed, s, flagsp);
-     if (!sol) sol = htab_lookup(&ego->htab_unblessed, s, flagsp);
+     solution *sol = htab_lookup(BLESSED(ego, CUR_TABLE(ego)), s, flagsp);
+     if (!sol && ego->wisdom_map) sol = mlookup(ego, s, flagsp);
+     if (!sol) sol = htab_lookup(UNBLESSED(ego, CUR_TABLE(ego)), s, flagsp);
      return sol;
-#endif     
 }
 
 static void fill_slot(hashtab *ht, const md5sig s, const flags_t *flagsp,
@@ -269,6 +291,9 @@ static void fill_slot(hashtab *ht, const md5sig s, const flags_t *flagsp,
      slot->flags.timelimit_impatience = flagsp->timelimit_impatience;
      slot->flags.hash_info |= H_VALID | H_LIVE;
      SLVNDX(slot) = slvndx;
+#ifdef AMD_TOP_N_PLANNER
+     slot->cost = slot->spread = 0;
+#endif
 
      /* keep this check enabled in case we add so many solvers
 	that the bitfield overflows */
@@ -284,8 +309,8 @@ static void kill_slot(hashtab *ht, solution *slot)
      slot->flags.hash_info = H_VALID;
 }
 
-static void hinsert0(hashtab *ht, const md5sig s, const flags_t *flagsp, 
-		     unsigned slvndx)
+static solution *hinsert0(hashtab *ht, const md5sig s, 
+			  const flags_t *flagsp, unsigned slvndx)
 {
      solution *l;
      unsigned g, h = h1(ht, s), d = h2(ht, s); 
@@ -301,6 +326,7 @@ static void hinsert0(hashtab *ht, const md5sig s, const flags_t *flagsp,
      }
 
      fill_slot(ht, s, flagsp, slvndx, l);
+     return l;
 }
 
 static void rehash(hashtab *ht, unsigned nsiz)
@@ -324,8 +350,15 @@ static void rehash(hashtab *ht, unsigned nsiz)
      /* copy table */
      for (h = 0; h < osiz; ++h) {
 	  solution *l = osol + h;
-	  if (LIVEP(l))
-	       hinsert0(ht, l->s, &l->flags, SLVNDX(l));
+	  if (LIVEP(l)) {
+	       solution *n = hinsert0(ht, l->s, &l->flags, SLVNDX(l));
+#ifdef AMD_TOP_N_PLANNER
+	       n->cost = l->cost;
+	       n->spread = l->spread;
+#else
+	       UNUSED(n);
+#endif
+	  }
      }
 
      X(ifree0)(osol);
@@ -403,13 +436,320 @@ static void htab_insert(hashtab *ht, const md5sig s, const flags_t *flagsp,
 static void hinsert(planner *ego, const md5sig s, const flags_t *flagsp, 
 		    unsigned slvndx)
 {
-#ifdef AMD_TOP_N_PLANNER
-     htab_insert(BLISS(*flagsp) ? &ego->htab_blessed[ego->index] : &ego->htab_unblessed[ego->index],
-		 s, flagsp, slvndx );
-#else	
-     htab_insert(BLISS(*flagsp) ? &ego->htab_blessed : &ego->htab_unblessed,
+     htab_insert(BLISS(*flagsp) ? BLESSED(ego, CUR_TABLE(ego)) 
+		 : UNBLESSED(ego, CUR_TABLE(ego)),
 		 s, flagsp, slvndx );
-#endif     
+}
+
+#ifdef AMD_TOP_N_PLANNER
+/* record the time of the plan of the solution just inserted by
+   hinsert(EGO, S, FLAGSP, ...) */
+static void hstats(planner *ego, const md5sig s, const flags_t *flagsp,
+		   double cost, double spread)
+{
+     solution *l = htab_lookup(BLISS(*flagsp) ? BLESSED(ego, CUR_TABLE(ego))
+			       : UNBLESSED(ego, CUR_TABLE(ego)), s, flagsp);
+     if (l) {
+	  l->cost = (float) cost;
+	  l->spread = (float) spread;
+     }
+}
+#endif
+
+/* The workers of a parallel search (see below) share their solutions
+   through the tables of the master planner, under the lock of the
+   threads library.  They keep copies in their own tables, which are
+   forgotten after each parallel search. */
+static solution *plookup(planner *ego, const md5sig s, 
+			 const flags_t *flagsp)
+{
+     solution *sol = hlookup(ego, s, flagsp), *l;
+     solution cpy;
+
+     if (sol || !ego->master)
+	  return sol;
+
+     ego->lock_hook(1);
+     if ((l = hlookup(ego->master, s, flagsp)))
+	  cpy = *l;
+     ego->lock_hook(0);
+
+     if (!l)
+	  return 0;
+     hinsert(ego, cpy.s, &cpy.flags, SLVNDX(&cpy));
+#ifdef AMD_TOP_N_PLANNER
+     hstats(ego, cpy.s, &cpy.flags, cpy.cost, cpy.spread);
+#endif
+     return hlookup(ego, s, flagsp);
+}
+
+static void pinsert(planner *ego, const md5sig s, const flags_t *flagsp, 
+		    unsigned slvndx)
+{
+     hinsert(ego, s, flagsp, slvndx);
+
+     if (ego->master) {
+	  ego->lock_hook(1);
+	  /* another worker may have found a solution meanwhile */
+	  if (!hlookup(ego->master, s, flagsp))
+	       hinsert(ego->master, s, flagsp, slvndx);
+	  ego->lock_hook(0);
+     }
+}
+
+#ifdef AMD_TOP_N_PLANNER
+static void pstats(planner *ego, const md5sig s, const flags_t *flagsp,
+		   double cost, double spread)
+{
+     hstats(ego, s, flagsp, cost, spread);
+
+     if (ego->master) {
+	  ego->lock_hook(1);
+	  hstats(ego->master, s, flagsp, cost, spread);
+	  ego->lock_hook(0);
+     }
+}
+#endif
+
+/*
+  binary wisdom:
+
+  An image consists of a header followed by one open-addressed hash
+  table of records per blessed hash table, using the same double
+  hashing as the in-memory tables.  The planner probes the image in
+  place, e.g. from a read-only mmap() of a file, and copies into the
+  blessed table only the records that it actually uses.  Solvers are
+  identified by their index, which is valid because the image is only
+  accepted if the signature of the configuration matches.  The Top N
+  planner also records the measured time of each plan and its spread.
+*/
+#define BWISDOM_MAGIC "FFTWBWIS"
+#define BWISDOM_VERSION 2
+#define BWISDOM_BYTEORDER 0x01020304u
+#define BWISDOM_EMPTY 0xffffffffu
+
+typedef struct {
+     char magic[8];
+     unsigned version, byteorder, sizeof_R, ntables;
+     unsigned config[4];
+     unsigned hashsiz, nelem;
+} bwisdom_header;
+
+typedef struct {
+     unsigned s[4];
+     unsigned l, u, timelimit_impatience;
+     unsigned slvndx; /* BWISDOM_EMPTY for an empty slot */
+     float cost, spread; /* 0 if not recorded */
+} bwisdom_rec;
+
+static const bwisdom_rec *mtable(const planner *ego, unsigned t)
+{
+     const bwisdom_header *hdr = (const bwisdom_header *) ego->wisdom_map;
+     return (const bwisdom_rec *) (hdr + 1) + (size_t) t * hdr->hashsiz;
+}
+
+/* decode record R into SIG/FLAGS/SLVNDX; 0 if the record is bogus */
+static int mdecode(const planner *ego, const bwisdom_rec *r, md5sig sig,
+		   flags_t *flagsp, unsigned *slvndx)
+{
+     flagsp->l = r->l;
+     flagsp->u = r->u;
+     flagsp->timelimit_impatience = r->timelimit_impatience;
+     flagsp->hash_info = BLESSING;
+     flagsp->slvndx = 0;
+     if (flagsp->l != r->l || flagsp->u != r->u 
+	 || flagsp->timelimit_impatience != r->timelimit_impatience)
+	  return 0;
+     if (r->slvndx != INFEASIBLE_SLVNDX) {
+	  if (r->slvndx >= ego->nslvdesc || r->timelimit_impatience != 0)
+	       return 0;
+     }
+     *slvndx = r->slvndx;
+     sig[0] = r->s[0]; sig[1] = r->s[1]; sig[2] = r->s[2]; sig[3] = r->s[3];
+     return 1;
+}
+
+static solution *mlookup(planner *ego, const md5sig s, 
+			 const flags_t *flagsp)
+{
+     const bwisdom_header *hdr = (const bwisdom_header *) ego->wisdom_map;
+     const bwisdom_rec *t = mtable(ego, CUR_TABLE(ego));
+     unsigned hashsiz = hdr->hashsiz;
+     unsigned g, h = s[0] % hashsiz, d = 1U + s[1] % (hashsiz - 1);
+     unsigned slvndx, best_slvndx = 0;
+     flags_t flags, best_flags;
+     const bwisdom_rec *best = 0;
+     md5sig sig;
+
+     g = h;
+     do {
+	  const bwisdom_rec *r = t + g;
+	  if (r->slvndx == BWISDOM_EMPTY)
+	       break;
+	  if (r->s[0] == s[0] && r->s[1] == s[1] 
+	      && r->s[2] == s[2] && r->s[3] == s[3]
+	      && mdecode(ego, r, sig, &flags, &slvndx)
+	      && subsumes(&flags, slvndx, flagsp)) {
+	       if (!best || LEQ(flags.u, best_flags.u)) {
+		    best_flags = flags;
+		    best_slvndx = slvndx;
+		    best = r;
+	       }
+	  }
+	  g = addmod(g, d, hashsiz);
+     } while (g != h);
+
+     if (!best)
+	  return 0;
+
+     /* materialize the record, so that the planner can treat it like
+	any other solution */
+     hinsert(ego, s, &best_flags, best_slvndx);
+#ifdef AMD_TOP_N_PLANNER
+     hstats(ego, s, &best_flags, best->cost, best->spread);
+#endif
+     return htab_lookup(BLESSED(ego, CUR_TABLE(ego)), s, flagsp);
+}
+
+/* copy all records of the image into the blessed tables */
+static void materialize(planner *ego)
+{
+     const bwisdom_header *hdr = (const bwisdom_header *) ego->wisdom_map;
+     unsigned t, g;
+
+     if (!hdr)
+	  return;
+
+     for (t = 0; t < NTABLES(ego); ++t) {
+	  const bwisdom_rec *r = mtable(ego, t);
+#ifdef AMD_TOP_N_PLANNER
+	  int oindex = ego->index;
+	  ego->index = (int) t;
+#endif
+	  for (g = 0; g < hdr->hashsiz; ++g) {
+	       md5sig sig;
+	       flags_t flags;
+	       unsigned slvndx;
+
+	       if (r[g].slvndx != BWISDOM_EMPTY
+		   && mdecode(ego, r + g, sig, &flags, &slvndx)
+		   && !htab_lookup(BLESSED(ego, t), sig, &flags)) {
+		    hinsert(ego, sig, &flags, slvndx);
+#ifdef AMD_TOP_N_PLANNER
+		    hstats(ego, sig, &flags, r[g].cost, r[g].spread);
+#endif
+	       }
+	  }
+#ifdef AMD_TOP_N_PLANNER
+	  ego->index = oindex;
+#endif
+     }
+}
+
+/* Attach the binary wisdom image IMG of SZ bytes, which must remain
+   valid until it is detached.  Return 0 if the image is not usable
+   by this planner. */
+int X(planner_map_wisdom)(planner *ego, const void *img, size_t sz)
+{
+     const bwisdom_header *hdr = (const bwisdom_header *) img;
+     md5 m;
+
+     if (sz < sizeof(bwisdom_header)
+	 || memcmp(hdr->magic, BWISDOM_MAGIC, sizeof(hdr->magic))
+	 || hdr->version != BWISDOM_VERSION
+	 || hdr->byteorder != BWISDOM_BYTEORDER
+	 || hdr->sizeof_R != sizeof(R)
+	 || hdr->ntables != NTABLES(ego)
+	 || hdr->hashsiz < 3
+	 || (sz - sizeof(bwisdom_header)) / sizeof(bwisdom_rec) / NTABLES(ego)
+	    < hdr->hashsiz)
+	  return 0;
+
+     signature_of_configuration(&m, ego);
+     if (m.s[0] != hdr->config[0] || m.s[1] != hdr->config[1] ||
+	 m.s[2] != hdr->config[2] || m.s[3] != hdr->config[3])
+	  return 0;
+
+     /* keep the records of a previous image */
+     materialize(ego);
+     ego->wisdom_map = img;
+     return 1;
+}
+
+/* Detach the binary wisdom image, if any, after copying its records
+   into the blessed tables. */
+void X(planner_unmap_wisdom)(planner *ego)
+{
+     materialize(ego);
+     ego->wisdom_map = 0;
+}
+
+/* Write the binary wisdom image of the planner's blessed wisdom into
+   BUF, if BUF is not null.  Return the size of the image in bytes. */
+size_t X(planner_export_binary)(planner *ego, void *buf)
+{
+     bwisdom_header *hdr = (bwisdom_header *) buf;
+     bwisdom_rec *recs;
+     unsigned t, h, hashsiz, nelem = 0;
+     md5 m;
+
+     materialize(ego);
+     for (t = 0; t < NTABLES(ego); ++t)
+	  if (BLESSED(ego, t)->nelem > nelem)
+	       nelem = BLESSED(ego, t)->nelem;
+     hashsiz = (unsigned) X(next_prime)((INT) (2U * nelem + 3U));
+
+     if (!buf)
+	  return sizeof(bwisdom_header) 
+	       + (size_t) NTABLES(ego) * hashsiz * sizeof(bwisdom_rec);
+
+     memset(hdr, 0, sizeof(bwisdom_header));
+     memcpy(hdr->magic, BWISDOM_MAGIC, sizeof(hdr->magic));
+     hdr->version = BWISDOM_VERSION;
+     hdr->byteorder = BWISDOM_BYTEORDER;
+     hdr->sizeof_R = sizeof(R);
+     hdr->ntables = NTABLES(ego);
+     signature_of_configuration(&m, ego);
+     for (h = 0; h < 4; ++h)
+	  hdr->config[h] = (unsigned) m.s[h];
+     hdr->hashsiz = hashsiz;
+     hdr->nelem = nelem;
+
+     recs = (bwisdom_rec *) (hdr + 1);
+     for (t = 0; t < NTABLES(ego); ++t) {
+	  hashtab *ht = BLESSED(ego, t);
+	  bwisdom_rec *tab = recs + (size_t) t * hashsiz;
+
+	  for (h = 0; h < hashsiz; ++h)
+	       tab[h].slvndx = BWISDOM_EMPTY;
+
+	  for (h = 0; h < ht->hashsiz; ++h) {
+	       solution *l = ht->solutions + h;
+	       if (LIVEP(l)) {
+		    unsigned g = l->s[0] % hashsiz;
+		    unsigned d = 1U + l->s[1] % (hashsiz - 1);
+		    bwisdom_rec *r;
+
+		    while (tab[g].slvndx != BWISDOM_EMPTY)
+			 g = addmod(g, d, hashsiz);
+		    r = tab + g;
+		    r->s[0] = (unsigned) l->s[0]; r->s[1] = (unsigned) l->s[1];
+		    r->s[2] = (unsigned) l->s[2]; r->s[3] = (unsigned) l->s[3];
+		    r->l = l->flags.l;
+		    r->u = l->flags.u;
+		    r->timelimit_impatience = l->flags.timelimit_impatience;
+		    r->slvndx = SLVNDX(l);
+#ifdef AMD_TOP_N_PLANNER
+		    r->cost = l->cost;
+		    r->spread = l->spread;
+#else
+		    r->cost = r->spread = 0;
+#endif
+	       }
+	  }
+     }
+     return sizeof(bwisdom_header) 
+	  + (size_t) NTABLES(ego) * hashsiz * sizeof(bwisdom_rec);
 }
 
 
@@ -460,6 +800,74 @@ double X(iestimate_cost)(const planner *ego, const plan *pln, const problem *p)
      return cost;
 }
 
+/* cost by which measured plans are ranked: the mean time, plus some
+   standard deviations if the user prefers steady plans */
+static double rank_cost(double pcost, double pvar)
+{
+     return pcost + X(timing_stability) * sqrt(pvar);
+}
+
+static int cheaperp(const plan *a, const plan *b)
+{
+     return rank_cost(a->pcost, a->pvar) < rank_cost(b->pcost, b->pvar);
+}
+
+/*
+  planning trace:
+  If ego->trace is set, the planner logs its decisions there, one JSON
+  object per line.  Every record names the event and, if it concerns a
+  problem, the md5 signature and kind of the problem, so that the
+  records of a subproblem, which are interleaved with those of its
+  parent, can be told apart.  Times are in the units of pcost.
+*/
+static void trace_begin(planner *ego, const problem *p, const char *ev)
+{
+     printer *pr = ego->trace;
+
+     pr->print(pr, "{\"event\": \"%s\"", ev);
+     if (p) {
+	  md5 m;
+	  md5hash(&m, p, ego);
+	  pr->print(pr, ", \"problem\": \"%M%M%M%M\", \"kind\": %d",
+		    m.s[0], m.s[1], m.s[2], m.s[3], p->adt->problem_kind);
+     }
+}
+
+static void trace_num(planner *ego, const char *key, double x)
+{
+     char buf[32];
+     sprintf(buf, "%.6g", x);
+     ego->trace->print(ego->trace, ", \"%s\": %s", key, buf);
+}
+
+static void trace_end(planner *ego)
+{
+     ego->trace->print(ego->trace, "}\n");
+}
+
+/* plan of candidate solver SLVNDX, of cost COST (0 if it was never
+   timed); solvers that are not applicable are not traced, as they are
+   the vast majority */
+static void trace_cand(planner *ego, const problem *p, unsigned slvndx,
+		       double cost, double var)
+{
+     if (ego->trace) {
+	  slvdesc *sp = ego->slvdescs + slvndx;
+	  trace_begin(ego, p, "solver");
+	  ego->trace->print(ego->trace, ", \"solver\": \"%s\", \"id\": %d",
+			    sp->reg_nam, sp->reg_id);
+	  if (cost > 0) {
+	       trace_num(ego, ESTIMATEP(ego) ? "estimate" : "time", cost);
+	       if (var > 0)
+		    trace_num(ego, "sd", sqrt(var));
+	  }
+	  trace_end(ego);
+     }
+}
+
+#define TRACE_CAND(ego, p, slvndx, pln)				\
+     trace_cand(ego, p, slvndx, (pln)->pcost, (pln)->pvar)
+
 static void evaluate_plan(planner *ego, plan *pln, const problem *p)
 {
      if (ESTIMATEP(ego) || !BELIEVE_PCOSTP(ego) || pln->pcost == 0.0) {
@@ -476,7 +884,8 @@ static void evaluate_plan(planner *ego, plan *pln, const problem *p)
 	       ego->epcost += pln->pcost;
 #endif
 	  } else {
-	       double t = X(measure_execution_time)(ego, pln, p);
+	       double var;
+	       double t = X(measure_execution_time)(ego, pln, p, &var);
 	       
 	       if (t < 0) {  /* unavailable cycle counter */
 		    /* Real programmers can write FORTRAN in any language */
@@ -484,6 +893,7 @@ static void evaluate_plan(planner *ego, plan *pln, const problem *p)
 	       }
 
 	       pln->pcost = t;
+	       pln->pvar = var;
 	       ego->pcost += t;
 	       ego->need_timeout_check = 1;
 	  }
@@ -521,11 +931,19 @@ static int timeout_p(planner *ego, const problem *p)
 	       return 1;
 	  }
 
-	  if (ego->timelimit >= 0 &&
-	      X(elapsed_since)(ego, p, ego->start_time) >= ego->timelimit) {
-	       ego->timed_out = 1;
-	       ego->need_timeout_check = 1;
-	       return 1;
+	  if (ego->timelimit >= 0) {
+	       double t = X(elapsed_since)(ego, p, ego->start_time);
+	       if (t >= ego->timelimit) {
+		    ego->timed_out = 1;
+		    ego->need_timeout_check = 1;
+		    ++ego->ntimeout;
+		    if (ego->trace) {
+			 trace_begin(ego, p, "timeout");
+			 trace_num(ego, "elapsed", t);
+			 trace_end(ego);
+		    }
+		    return 1;
+	       }
 	  }
      }
 
@@ -534,192 +952,240 @@ static int timeout_p(planner *ego, const problem *p)
      return 0;
 }
 
-static plan *search0(planner *ego, const problem *p, unsigned *slvndx, 
-		     const flags_t *flagsp)
+/*
+  parallel search:
+  The threads library may install a hook that evaluates the candidate
+  solvers of a search concurrently.  Each candidate is planned and
+  timed by a worker planner, on a private copy of the problem arrays,
+  by X(planner_psearch_cand).  The workers record the solutions of the
+  subproblems in the tables of the master (see plookup()), so that a
+  subproblem shared by several candidates is usually searched only
+  once.  The master then plans the winning candidate again, by table
+  lookups only.
+
+  The workers are only used for problems planned with one thread, and
+  not when timings must be consistent with other processes (MPI) or
+  with the cache model.
+*/
+void X(planner_psearch_cand)(planner *ego, planner *master,
+			     const problem *p, const flags_t *flagsp,
+			     psearch_cand *c)
 {
+     int nplan = ego->nplan, nprob = ego->nprob;
+     double pcost = ego->pcost;
+     plan *pln;
+
+     ego->master = master;
+     ego->flags = master->flags;
+     ego->nthr = master->nthr;
+     ego->wisdom_state = master->wisdom_state;
+     ego->start_time = master->start_time;
+     ego->timelimit = master->timelimit;
 #ifdef AMD_TOP_N_PLANNER
-     wisp_set = 0;
-     if (ego->index == 0) {
-          plan *best = 0;
-          int best_not_yet_timed = 1;
-
-          /* Do not start a search if the planner timed out. This check is
-	     necessary, lest the relaxation mechanism kick in */ 
-          if (timeout_p(ego, p))
-	       return 0;
+     ego->index = master->index;
+#endif
+     ego->timed_out = 0;
+
+     c->cost = -1.0;
+     c->could_prune_now_p = 0;
+     c->timed_out = timeout_p(ego, p);
+
+     if (!c->timed_out) {
+	  pln = invoke_solver(ego, p, ego->slvdescs[c->slvndx].slv, flagsp);
 
-          FORALL_SOLVERS_OF_KIND(p->adt->problem_kind, ego, s, sp, {
-	       plan *pln;
-
-	       pln = invoke_solver(ego, p, s, flagsp);
-
-	       if (ego->need_timeout_check) 
-	            if (timeout_p(ego, p)) {
-		         X(plan_destroy_internal)(pln);
-		         X(plan_destroy_internal)(best);
-		         return 0;
-	            }
-
-	       if (pln) {
-	            /* read COULD_PRUNE_NOW_P because PLN may be destroyed
-		       before we use COULD_PRUNE_NOW_P */
-	            int could_prune_now_p = pln->could_prune_now_p;
-
-	            if (best) {
-		         if (best_not_yet_timed) {
-			      evaluate_plan(ego, best, p);
-			      best_not_yet_timed = 0;
-		         }
-		         evaluate_plan(ego, pln, p);
-		         if (pln->pcost < best->pcost) {
-			      X(plan_destroy_internal)(best);
-			      best = pln;
-                              *slvndx = (unsigned)(sp - ego->slvdescs);
-		         } else {
-			      X(plan_destroy_internal)(pln);
-		         }
-	            } else {
-		         best = pln;
-                         *slvndx = (unsigned)(sp - ego->slvdescs);                    
-	            }
-
-	            if (ALLOW_PRUNINGP(ego) && could_prune_now_p) 
-		         break;
-	       } 
-          });
-
-          return best;
-     }     
-     else {          
-          plan *best = 0;
-          int best_not_yet_timed = 1;
-    
-          plan *best2 = 0;
-          plan *best3 = 0;
-
-          int slvndx2 = 0;
-          int slvndx3 = 0;
-
-          int best2_not_yet_timed = 1;
-          int best3_not_yet_timed = 1;
-
-          if (timeout_p(ego, p))
-               return 0;
-
-          FORALL_SOLVERS_OF_KIND(p->adt->problem_kind, ego, s, sp, {
-               plan *pln;
-
-               pln = invoke_solver(ego, p, s, flagsp);
-
-               if (ego->need_timeout_check)
-                    if (timeout_p(ego, p)) {
-                         X(plan_destroy_internal)(pln);
-                         X(plan_destroy_internal)(best);
-                         X(plan_destroy_internal)(best2);
-                         X(plan_destroy_internal)(best3);
-
-                         return 0;
-                    }
-			   
-               if (pln) {
-                    int could_prune_now_p = pln->could_prune_now_p;
-
-                    if (best && best2 && best3) {
-                         if (best_not_yet_timed) {
-                              evaluate_plan(ego, best, p);
-                              best_not_yet_timed = 0;
-                         }
-                         if (best2_not_yet_timed) {
-                              evaluate_plan(ego, best2, p);
-                              best2_not_yet_timed = 0;
-                         }
-                         if (best3_not_yet_timed) {
-                              evaluate_plan(ego, best3, p);
-                              best3_not_yet_timed = 0;
-                         }
-                         evaluate_plan(ego, pln, p);
-
-                         if (pln->pcost < best->pcost) {                        
-                              best3 = best2;                      
-                              best2 = best;
-                              slvndx3 = slvndx2;
-                              slvndx2 = *slvndx;                       
-                              best = pln;
-                              *slvndx = (unsigned)(sp - ego->slvdescs);
-                         }
-                         else if (pln->pcost < best2->pcost) {                       
-                              best3 = best2;
-                              slvndx3 = slvndx2;                       
-                              best2 = pln;
-                              slvndx2 = (unsigned)(sp - ego->slvdescs);
-                         }
-                         else if (pln->pcost < best3->pcost) {                      
-                              best3 = pln;
-                              slvndx3 = (unsigned)(sp - ego->slvdescs);
-                         }
-		         else {
-                              X(plan_destroy_internal)(pln);
-                         }
-                    } 
-                    else if (!best) {
-                         best = pln;
-                         *slvndx = (unsigned)(sp - ego->slvdescs);
-                    }
-                    else if (!best2) {
-                         if (pln->pcost < best->pcost) {
-                              best2 = best;
-                              slvndx2 = *slvndx;						
-                              best = pln;
-                              *slvndx =  (unsigned)(sp - ego->slvdescs);
-                         }
-                         else {
-                              best2 = pln;
-                              slvndx2 = (unsigned)(sp - ego->slvdescs);
-                         }
-                    }
-                    else if (!best3) {
-                         if (pln->pcost < best->pcost) {
-                              best3 = best2;
-                              slvndx3 = slvndx2;
-                              best2 = best;
-                              slvndx2 = *slvndx;
-                              best = pln;
-                              *slvndx = (unsigned)(sp - ego->slvdescs);
-                         }
-		         else if (pln->pcost < best2->pcost) {
-                              best3 = best2;
-                              slvndx3 = slvndx2;
-                              best2 = pln;
-                              slvndx2 = (unsigned)(sp - ego->slvdescs);
-                         }
-                         else {
-                              best3 = pln;
-                              slvndx3 = (unsigned)(sp - ego->slvdescs);
-                         }
-                   }
-                   if (ALLOW_PRUNINGP(ego) && could_prune_now_p)
-                        break;
-              }
-          });
-
-          if (ego->index == 1) {
-               if (best2) {
-                    *slvndx = slvndx2;
-                    return best2;
-               }
-               else
-                    return best;
-          }
-          else if (ego->index == 2) {
-               if (best3) {
-                    *slvndx = slvndx3;
-                    return best3;
-               }
-               else
-                    return best;
-          }   
+	  if (ego->need_timeout_check && timeout_p(ego, p))
+	       c->timed_out = 1;
+	  else if (pln) {
+	       evaluate_plan(ego, pln, p);
+	       c->cost = pln->pcost;
+	       c->var = pln->pvar;
+	       c->could_prune_now_p = pln->could_prune_now_p;
+	  }
+	  X(plan_destroy_internal)(pln);
      }
-#else	
+
+     c->nplan = ego->nplan - nplan;
+     c->nprob = ego->nprob - nprob;
+     c->pcost = ego->pcost - pcost;
+}
+
+static int psearchp(const planner *ego)
+{
+     return (ego->psearch_hook 
+	     && ego->nthr == 1
+	     && !ESTIMATEP(ego)
+	     && !ego->cost_hook 
+	     && !ego->wisdom_ok_hook
+	     && !X(cache_pressure));
+}
+
+/* parallel version of search0(); set *DONEP to 0 if the hook
+   declined to search */
+static plan *psearch(planner *ego, const problem *p, unsigned *slvndx, 
+		     const flags_t *flagsp, int *donep)
+{
+     psearch_cand *c;
+     plan *pln = 0;
+     int ncand = 0, best = -1, timed_out = 0, i, j, nrank = 0;
+     int rank = (int) CUR_TABLE(ego), *ranking;
+
+     *donep = 0;
+     FORALL_SOLVERS_OF_KIND(p->adt->problem_kind, ego, s, sp, {
+	  UNUSED(s); UNUSED(sp);
+	  ++ncand;
+     });
+     if (ncand < 2)
+	  return 0;
+
+     c = (psearch_cand *) MALLOC(sizeof(psearch_cand) * (size_t)ncand, OTHER);
+     i = 0;
+     FORALL_SOLVERS_OF_KIND(p->adt->problem_kind, ego, s, sp, {
+	  UNUSED(s);
+	  c[i++].slvndx = (unsigned)/*from ptrdiff_t*/(sp - ego->slvdescs);
+     });
+
+     if (!ego->psearch_hook(ego, p, flagsp, c, ncand)) {
+	  X(ifree)(c);
+	  return 0;
+     }
+     *donep = 1;
+
+     for (i = 0; i < ncand; ++i) {
+	  ego->nplan += c[i].nplan;
+	  ego->nprob += c[i].nprob;
+	  ego->pcost += c[i].pcost;
+	  timed_out |= c[i].timed_out;
+	  if (c[i].cost >= 0)
+	       trace_cand(ego, p, c[i].slvndx, c[i].cost, c[i].var);
+     }
+
+     if (timed_out) {
+	  ego->timed_out = 1;
+	  ego->need_timeout_check = 1;
+	  X(ifree)(c);
+	  return 0;
+     }
+
+     /* same choice as the serial search, which ranks a plan after
+	equally good ones, and returns the plan of rank RANK (always 0
+	unless in the Top N planner) or the best one */
+     ranking = (int *) MALLOC(sizeof(int) * (size_t)ncand, OTHER);
+     for (i = 0; i < ncand; ++i) {
+	  if (c[i].cost < 0)
+	       continue;
+	  for (j = nrank; j > 0 && rank_cost(c[i].cost, c[i].var)
+		    < rank_cost(c[ranking[j - 1]].cost, c[ranking[j - 1]].var);
+	       --j)
+	       ranking[j] = ranking[j - 1];
+	  ranking[j] = i;
+	  ++nrank;
+	  if (ALLOW_PRUNINGP(ego) && c[i].could_prune_now_p)
+	       break;
+     }
+     if (nrank > 0)
+	  best = ranking[nrank > rank ? rank : 0];
+     X(ifree)(ranking);
+
+     if (best >= 0) {
+	  pln = invoke_solver(ego, p, ego->slvdescs[c[best].slvndx].slv, 
+			      flagsp);
+	  if (ego->need_timeout_check && timeout_p(ego, p)) {
+	       X(plan_destroy_internal)(pln);
+	       pln = 0;
+	  } else if (pln) {
+	       pln->pcost = c[best].cost;
+	       pln->pvar = c[best].var;
+	       *slvndx = c[best].slvndx;
+	       invoke_hook(ego, pln, p, 0);
+	  }
+     }
+
+     X(ifree)(c);
+     return pln;
+}
+
+#ifdef AMD_TOP_N_PLANNER
+/* search of the Top N planner for rank R > 0: like the serial search
+   in search0(), but keep the R + 1 best plans, and return the plan of
+   rank R, or the best plan if there are not that many */
+static plan *search_rank(planner *ego, const problem *p, unsigned *slvndx, 
+			 const flags_t *flagsp, int r)
+{
+     plan **best = (plan **) MALLOC(sizeof(plan *) * (size_t)(r + 1), OTHER);
+     unsigned *ndx = 
+	  (unsigned *) MALLOC(sizeof(unsigned) * (size_t)(r + 1), OTHER);
+     plan *pln = 0;
+     int n = 0, pick = -1, timed_out = 0, best_not_yet_timed = 1, i;
+
+     FORALL_SOLVERS_OF_KIND(p->adt->problem_kind, ego, s, sp, {
+	  pln = invoke_solver(ego, p, s, flagsp);
+
+	  if (ego->need_timeout_check && timeout_p(ego, p)) {
+	       X(plan_destroy_internal)(pln);
+	       timed_out = 1;
+	       break;
+	  }
+
+	  if (pln) {
+	       int could_prune_now_p = pln->could_prune_now_p;
+
+	       if (n > 0) {
+		    if (best_not_yet_timed) {
+			 evaluate_plan(ego, best[0], p);
+			 TRACE_CAND(ego, p, ndx[0], best[0]);
+			 best_not_yet_timed = 0;
+		    }
+		    evaluate_plan(ego, pln, p);
+		    TRACE_CAND(ego, p, (unsigned)(sp - ego->slvdescs), pln);
+	       }
+
+	       /* rank PLN after equally good plans */
+	       for (i = n; i > 0 && cheaperp(pln, best[i - 1]); --i)
+		    ;
+	       if (i <= r) {
+		    if (n > r)
+			 X(plan_destroy_internal)(best[r]);
+		    else
+			 ++n;
+		    memmove(best + i + 1, best + i, 
+			    sizeof(plan *) * (size_t)(n - 1 - i));
+		    memmove(ndx + i + 1, ndx + i, 
+			    sizeof(unsigned) * (size_t)(n - 1 - i));
+		    best[i] = pln;
+		    ndx[i] = (unsigned)/*from ptrdiff_t*/(sp - ego->slvdescs);
+	       } else {
+		    X(plan_destroy_internal)(pln);
+	       }
+
+	       if (ALLOW_PRUNINGP(ego) && could_prune_now_p) 
+		    break;
+	  }
+     });
+
+     /* the first plan is traced once it is timed */
+     if (!timed_out && n > 0 && best_not_yet_timed)
+	  TRACE_CAND(ego, p, ndx[0], best[0]);
+
+     if (!timed_out && n > 0)
+	  pick = (n > r) ? r : 0;
+     for (i = 0; i < n; ++i)
+	  if (i != pick)
+	       X(plan_destroy_internal)(best[i]);
+
+     pln = 0;
+     if (pick >= 0) {
+	  pln = best[pick];
+	  *slvndx = ndx[pick];
+     }
+     X(ifree)(ndx);
+     X(ifree)(best);
+     return pln;
+}
+#endif
+
+static plan *search0(planner *ego, const problem *p, unsigned *slvndx, 
+		     const flags_t *flagsp)
+{
      plan *best = 0;
      int best_not_yet_timed = 1;
 
@@ -728,6 +1194,18 @@ static plan *search0(planner *ego, const problem *p, unsigned *slvndx,
      if (timeout_p(ego, p))
 	  return 0;
 
+     if (psearchp(ego)) {
+	  int donep;
+	  best = psearch(ego, p, slvndx, flagsp, &donep);
+	  if (donep)
+	       return best;
+     }
+
+#ifdef AMD_TOP_N_PLANNER
+     if (ego->index > 0)
+	  return search_rank(ego, p, slvndx, flagsp, ego->index);
+#endif
+
      FORALL_SOLVERS_OF_KIND(p->adt->problem_kind, ego, s, sp, {
 	  plan *pln;
 
@@ -748,10 +1226,12 @@ static plan *search0(planner *ego, const problem *p, unsigned *slvndx,
 	       if (best) {
 		    if (best_not_yet_timed) {
 			 evaluate_plan(ego, best, p);
+			 TRACE_CAND(ego, p, *slvndx, best);
 			 best_not_yet_timed = 0;
 		    }
 		    evaluate_plan(ego, pln, p);
-		    if (pln->pcost < best->pcost) {
+		    TRACE_CAND(ego, p, (unsigned)(sp - ego->slvdescs), pln);
+		    if (cheaperp(pln, best)) {
 			 X(plan_destroy_internal)(best);
 			 best = pln;
                          *slvndx = (unsigned)/*from ptrdiff_t*/(sp - ego->slvdescs);
@@ -768,8 +1248,11 @@ static plan *search0(planner *ego, const problem *p, unsigned *slvndx,
 	  }
      });
 
+     /* the only plan is never timed */
+     if (best && best_not_yet_timed)
+	  TRACE_CAND(ego, p, *slvndx, best);
+
      return best;
-#endif     
 }
 
 static plan *search(planner *ego, const problem *p, unsigned *slvndx, 
@@ -831,6 +1314,9 @@ static plan *mkplan(planner *ego, const problem *p)
      flags_t flags_of_solution;
      solution *sol;
      solver *s;
+#ifdef AMD_TOP_N_PLANNER
+     double cost = 0, spread = 0;
+#endif
 
      ASSERT_ALIGNED_DOUBLE;
      A(LEQ(PLNR_L(ego), PLNR_U(ego)));
@@ -840,16 +1326,8 @@ static plan *mkplan(planner *ego, const problem *p)
 
 
 #ifdef FFTW_DEBUG
-    #ifdef AMD_TOP_N_PLANNER
-
-    for (int pln_idx = 0; pln_idx < AMD_OPT_TOP_N ; pln_idx ++) {
-         check(&ego->htab_blessed[pln_idx]);
-         check(&ego->htab_unblessed[pln_idx]);
-    }
-    #else
-         check(&ego->htab_blessed);
-         check(&ego->htab_unblessed);
-    #endif
+     check(BLESSED(ego, CUR_TABLE(ego)));
+     check(UNBLESSED(ego, CUR_TABLE(ego)));
 #endif
 
      pln = 0;
@@ -864,7 +1342,7 @@ static plan *mkplan(planner *ego, const problem *p)
      flags_of_solution = ego->flags;
 
      if (ego->wisdom_state != WISDOM_IGNORE_ALL) {
-	  if ((sol = hlookup(ego, m.s, &flags_of_solution))) { 
+	  if ((sol = plookup(ego, m.s, &flags_of_solution))) { 
 	       /* wisdom is acceptable */
 	       wisdom_state_t owisdom_state = ego->wisdom_state;
 	       
@@ -883,6 +1361,10 @@ static plan *mkplan(planner *ego, const problem *p)
 	       }
 	       
 	       flags_of_solution = sol->flags;
+#ifdef AMD_TOP_N_PLANNER
+	       cost = sol->cost;
+	       spread = sol->spread;
+#endif
 	       
 	       /* inherit blessing either from wisdom
 		  or from the planner */
@@ -920,11 +1402,12 @@ static plan *mkplan(planner *ego, const problem *p)
 	       }
 	       
 	       ego->wisdom_state = owisdom_state;
-
-#ifdef AMD_TOP_N_PLANNER
-	       if (wisp_set && AMD_OPT_TOP_N > 1)
-		    evaluate_plan(ego, pln, p);
-#endif
+	       if (ego->trace) {
+		    trace_begin(ego, p, "wisdom");
+		    ego->trace->print(ego->trace, ", \"solver\": \"%s\"",
+				      ego->slvdescs[slvndx].reg_nam);
+		    trace_end(ego);
+	       }
 	       goto skip_search;
 	  }
 	  else if (ego->nowisdom_hook) /* for MPI, make sure lack of wisdom */
@@ -944,10 +1427,33 @@ static plan *mkplan(planner *ego, const problem *p)
      if (ego->wisdom_state == WISDOM_ONLY)
 	  goto wisdom_is_bogus;
 
+     ++ego->nsearch;
+     if (ego->trace) {
+	  trace_begin(ego, p, "search");
+	  ego->trace->print(ego->trace, ", \"l\": %u, \"u\": %u, \"nthr\": %d",
+			    PLNR_L(ego), PLNR_U(ego), ego->nthr);
+	  trace_end(ego);
+     }
+
      flags_of_solution = ego->flags;
      pln = search(ego, p, &slvndx, &flags_of_solution);
      CHECK_FOR_BOGOSITY; 	  /* catch error in child solvers */
 
+     if (ego->trace) {
+	  trace_begin(ego, p, "plan");
+	  if (pln) {
+	       ego->trace->print(ego->trace, ", \"solver\": \"%s\"",
+				 ego->slvdescs[slvndx].reg_nam);
+	       if (pln->pcost > 0)
+		    trace_num(ego, ESTIMATEP(ego) ? "estimate" : "time",
+			      pln->pcost);
+	  } else
+	       ego->trace->print(ego->trace, ", \"solver\": null, "
+				 "\"timed_out\": %s",
+				 ego->timed_out ? "true" : "false");
+	  trace_end(ego);
+     }
+
      if (ego->timed_out) {
 	  A(!pln);
 	  if (PLNR_TIMELIMIT_IMPATIENCE(ego) != 0) {
@@ -962,16 +1468,25 @@ static plan *mkplan(planner *ego, const problem *p)
      } else {
 	  /* canonicalize to infinite timeout */
 	  flags_of_solution.timelimit_impatience = 0;
+#ifdef AMD_TOP_N_PLANNER
+	  if (pln && !ESTIMATEP(ego) && pln->pcost > 0) {
+	       cost = pln->pcost;
+	       spread = sqrt(pln->pvar);
+	  }
+#endif
      }
 
  skip_search:
      if (ego->wisdom_state == WISDOM_NORMAL ||
 	 ego->wisdom_state == WISDOM_ONLY) {
 	  if (pln) {
-	       hinsert(ego, m.s, &flags_of_solution, slvndx);
+	       pinsert(ego, m.s, &flags_of_solution, slvndx);
+#ifdef AMD_TOP_N_PLANNER
+	       pstats(ego, m.s, &flags_of_solution, cost, spread);
+#endif
 	       invoke_hook(ego, pln, p, 1);
 	  } else {
-	       hinsert(ego, m.s, &flags_of_solution, INFEASIBLE_SLVNDX);
+	       pinsert(ego, m.s, &flags_of_solution, INFEASIBLE_SLVNDX);
 	  }
      }
 
@@ -990,102 +1505,112 @@ static void htab_destroy(hashtab *ht)
      ht->nelem = 0U;
 }
 
-static void mkhashtab(hashtab *ht)
+static void htab_reset_stats(hashtab *ht)
 {
      ht->nrehash = 0;
      ht->succ_lookup = ht->lookup = ht->lookup_iter = 0;
      ht->insert = ht->insert_iter = ht->insert_unknown = 0;
+}
 
+/* empty HT; its statistics are kept, so that they count since the
+   planner was created (or X(planner_reset_stats)) across forgets */
+static void mkhashtab(hashtab *ht)
+{
      ht->solutions = 0;
      ht->hashsiz = ht->nelem = 0U;
      hgrow(ht);			/* so that hashsiz > 0 */
 }
 
-/* destroy hash table entries.  If FORGET_EVERYTHING, destroy the whole
-   table.  If FORGET_ACCURSED, then destroy entries that are not blessed. */
-#ifdef AMD_FAST_PLANNER
-static void forget(planner *ego, amnesia a)
+#if defined(AMD_FAST_PLANNER) || defined(AMD_APP_OPT_LAYER)
+/* the unblessed table T grew too large and is recycled */
+static void trace_swap(planner *ego, unsigned t, const hashtab *unblessed)
 {
-     switch (a) {
-	 case FORGET_ACCURSED:
-	      //Do not delete the unblessed hash table after setup done.
-	      //But maintain its state in order to reuse the solvers next time.
-	      //htab_destroy(&ego->htab_unblessed);
-	      //mkhashtab(&ego->htab_unblessed);
-
-	      //Check the unblessed size and switch it with blessed when its size grows beyond the MAX size
-	      //AMD_HASH_UNBLESS_MAX_SIZE
-	      if ((sizeof(struct solution_s)*ego->htab_unblessed.hashsiz) > AMD_HASH_UNBLESS_MAX_SIZE)
-	      {
-		      solution *ht_unblessed_sols = ego->htab_unblessed.solutions;
-		      ego->htab_unblessed.solutions = ego->htab_blessed.solutions;
-		      ego->htab_unblessed.hashsiz = ego->htab_blessed.hashsiz;
-		      ego->htab_unblessed.nelem = ego->htab_blessed.nelem;
-		      ego->htab_unblessed.lookup = ego->htab_blessed.lookup;
-		      ego->htab_unblessed.succ_lookup = ego->htab_blessed.succ_lookup;
-		      ego->htab_unblessed.lookup_iter = ego->htab_blessed.lookup_iter;
-		      ego->htab_unblessed.insert = ego->htab_blessed.insert;
-		      ego->htab_unblessed.insert_iter = ego->htab_blessed.insert_iter;
-		      ego->htab_unblessed.insert_unknown = ego->htab_blessed.insert_unknown;
-		      ego->htab_unblessed.nrehash = ego->htab_blessed.nrehash;
-		      X(ifree)(ht_unblessed_sols);
-		      //Should blessed be cleared and deleted at this point??
-		      mkhashtab(&ego->htab_blessed);
-	      }
-	      break;
-	 case FORGET_EVERYTHING:
-	      //When wisdom is set bogus; delete both blessed and unblessed hash table
-	      htab_destroy(&ego->htab_blessed);
-	      mkhashtab(&ego->htab_blessed);
-	      htab_destroy(&ego->htab_unblessed);
-	      mkhashtab(&ego->htab_unblessed);
-	      break;
-	 default:
-	      break;
+     ++ego->nswap;
+     if (ego->trace) {
+	  trace_begin(ego, 0, "unblessed_swap");
+	  ego->trace->print(ego->trace, ", \"table\": %u, \"nelem\": %u",
+			    t, unblessed->nelem);
+	  trace_num(ego, "bytes",
+		    (double) (sizeof(struct solution_s) * unblessed->hashsiz));
+	  trace_end(ego);
      }
 }
-#elif defined (AMD_TOP_N_PLANNER)
+#endif
+
+/* destroy hash table entries.  If FORGET_EVERYTHING, destroy the whole
+   table.  If FORGET_ACCURSED, then destroy entries that are not blessed. */
+#ifdef AMD_FAST_PLANNER
 static void forget(planner *ego, amnesia a)
 {
-     switch (a) {
-	 case FORGET_EVERYTHING:
-              for (int pln_idx = 0; pln_idx < AMD_OPT_TOP_N ; pln_idx ++) {
-	           htab_destroy(&ego->htab_blessed[pln_idx]);
-	           mkhashtab(&ego->htab_blessed[pln_idx]);
-	      }     
-	      /* fall through */
-	 case FORGET_ACCURSED:
-              for (int pln_idx = 0; pln_idx < AMD_OPT_TOP_N ; pln_idx ++) {
-	           htab_destroy(&ego->htab_unblessed[pln_idx]);
-	           mkhashtab(&ego->htab_unblessed[pln_idx]);
-              }
-	      break;
-	 default:
-	      break;
+     unsigned t;
+
+     for (t = 0; t < NTABLES(ego); ++t) {
+	  hashtab *blessed = BLESSED(ego, t), *unblessed = UNBLESSED(ego, t);
+
+	  switch (a) {
+	      case FORGET_ACCURSED:
+		   //Do not delete the unblessed hash table after setup done.
+		   //But maintain its state in order to reuse the solvers next time.
+		   //htab_destroy(unblessed);
+		   //mkhashtab(unblessed);
+
+		   //Check the unblessed size and switch it with blessed when its size grows beyond the MAX size
+		   //AMD_HASH_UNBLESS_MAX_SIZE
+		   if ((sizeof(struct solution_s)*unblessed->hashsiz) > AMD_HASH_UNBLESS_MAX_SIZE)
+		   {
+			   solution *ht_unblessed_sols = unblessed->solutions;
+			   trace_swap(ego, t, unblessed);
+			   unblessed->solutions = blessed->solutions;
+			   unblessed->hashsiz = blessed->hashsiz;
+			   unblessed->nelem = blessed->nelem;
+			   X(ifree)(ht_unblessed_sols);
+			   //Should blessed be cleared and deleted at this point??
+			   mkhashtab(blessed);
+		   }
+		   break;
+	      case FORGET_EVERYTHING:
+		   //When wisdom is set bogus; delete both blessed and unblessed hash table
+		   ego->wisdom_map = 0;
+		   htab_destroy(blessed);
+		   mkhashtab(blessed);
+		   htab_destroy(unblessed);
+		   mkhashtab(unblessed);
+		   break;
+	      default:
+		   break;
+	  }
      }
 }
 #else
 static void forget(planner *ego, amnesia a)
 {
-     switch (a) {
-	 case FORGET_EVERYTHING:
-	      htab_destroy(&ego->htab_blessed);
-	      mkhashtab(&ego->htab_blessed);
-	      /* fall through */
-	 case FORGET_ACCURSED:
+     unsigned t;
+
+     for (t = 0; t < NTABLES(ego); ++t) {
+	  hashtab *blessed = BLESSED(ego, t), *unblessed = UNBLESSED(ego, t);
+
+	  switch (a) {
+	      case FORGET_EVERYTHING:
+		   ego->wisdom_map = 0;
+		   htab_destroy(blessed);
+		   mkhashtab(blessed);
+		   /* fall through */
+	      case FORGET_ACCURSED:
 #ifdef AMD_APP_OPT_LAYER
-	      if ((sizeof(struct solution_s)*ego->htab_unblessed.hashsiz) > AMD_APP_OPT_HASH_UNBLESS_MAX_SIZE)
-	      {
-	      	htab_destroy(&ego->htab_unblessed);
-	      	mkhashtab(&ego->htab_unblessed);
-	      }
+		   if ((sizeof(struct solution_s)*unblessed->hashsiz) > AMD_APP_OPT_HASH_UNBLESS_MAX_SIZE)
+		   {
+			trace_swap(ego, t, unblessed);
+			htab_destroy(unblessed);
+			mkhashtab(unblessed);
+		   }
 #else
-	      htab_destroy(&ego->htab_unblessed);
-	      mkhashtab(&ego->htab_unblessed);
+		   htab_destroy(unblessed);
+		   mkhashtab(unblessed);
 #endif
-	      break;
-	 default:
-	      break;
+		   break;
+	      default:
+		   break;
+	  }
      }
 }
 #endif
@@ -1094,19 +1619,26 @@ static void forget(planner *ego, amnesia a)
 #define WISDOM_PREAMBLE PACKAGE "-" VERSION " " STRINGIZE(X(wisdom))
 static const char stimeout[] = "TIMEOUT";
 
+#ifdef AMD_TOP_N_PLANNER
+/* time of a plan as written in wisdom */
+static int wisdom_time(double t)
+{
+     return (t < 2147483647.0) ? (int) ceil(t) : 2147483647;
+}
+#endif
+
 /* tantus labor non sit cassus */
 static void exprt(planner *ego, printer *p)
 {
-     unsigned h;
+     unsigned h, t;
      hashtab *ht;
      md5 m;
 
-#ifdef AMD_TOP_N_PLANNER
-     for (int plan_cnt = 0; plan_cnt < AMD_OPT_TOP_N; plan_cnt++) { 
-          ht = &ego->htab_blessed[plan_cnt];
-#else
-     ht = &ego->htab_blessed;
-#endif     
+     materialize(ego);
+
+     /* the Top N planner writes one block per rank */
+     for (t = 0; t < NTABLES(ego); ++t) {
+     ht = BLESSED(ego, t);
      signature_of_configuration(&m, ego);
 
      p->print(p, 
@@ -1130,16 +1662,21 @@ static void exprt(planner *ego, printer *p)
 
 	       /* qui salvandos salvas gratis
                   salva me fons pietatis */
-	       p->print(p, "  (%s %d #x%x #x%x #x%x #x%M #x%M #x%M #x%M)\n",
+	       p->print(p, "  (%s %d #x%x #x%x #x%x #x%M #x%M #x%M #x%M",
 			reg_nam, reg_id, 
 			l->flags.l, l->flags.u, l->flags.timelimit_impatience, 
 			l->s[0], l->s[1], l->s[2], l->s[3]);
+#ifdef AMD_TOP_N_PLANNER
+	       /* measured time of the plan and its standard deviation */
+	       if (l->cost > 0)
+		    p->print(p, " %d %d", 
+			     wisdom_time(l->cost), wisdom_time(l->spread));
+#endif
+	       p->print(p, ")\n");
 	  }
      }
      p->print(p, ")\n");
-#ifdef AMD_TOP_N_PLANNER     
-     } 
-#endif     
+     }
 }
 
 /* mors stupebit et natura
@@ -1150,19 +1687,15 @@ static int imprt(planner *ego, scanner *sc)
      md5uint sig[4];
      unsigned l, u, timelimit_impatience;
      flags_t flags;
-     int reg_id;
-     unsigned slvndx;
+     int reg_id, cost, spread;
+     unsigned slvndx, t;
      hashtab *ht;
      hashtab old;
      md5 m;
 
-#ifdef AMD_TOP_N_PLANNER
-     int wis_read = 0;
-     for (int plan_cnt = 0; plan_cnt < AMD_OPT_TOP_N; plan_cnt++) {
-          ht = &ego->htab_blessed[plan_cnt];
-#else
-     ht = &ego->htab_blessed;
-#endif     
+     /* the Top N planner reads one block per rank */
+     for (t = 0; t < NTABLES(ego); ++t) {
+     ht = BLESSED(ego, t);
      if (!sc->scan(sc, 
 		   "(" WISDOM_PREAMBLE " #x%M #x%M #x%M #x%M\n",
 		   sig + 0, sig + 1, sig + 2, sig + 3))
@@ -1189,11 +1722,16 @@ static int imprt(planner *ego, scanner *sc)
 	       break;
 
 	  /* qua resurget ex favilla */
-	  if (!sc->scan(sc, "(%*s %d #x%x #x%x #x%x #x%M #x%M #x%M #x%M)",
+	  if (!sc->scan(sc, "(%*s %d #x%x #x%x #x%x #x%M #x%M #x%M #x%M",
 			MAXNAM, buf, &reg_id, &l, &u, &timelimit_impatience,
 			sig + 0, sig + 1, sig + 2, sig + 3))
 	       goto bad;
 
+	  /* optional time of the plan, see exprt() */
+	  cost = spread = 0;
+	  if (!sc->scan(sc, ")") && !sc->scan(sc, "%d %d)", &cost, &spread))
+	       goto bad;
+
 	  if (!strcmp(buf, stimeout) && reg_id == 0) {
 	       slvndx = INFEASIBLE_SLVNDX;
 	  } else {
@@ -1216,34 +1754,27 @@ static int imprt(planner *ego, scanner *sc)
 	  CK(flags.timelimit_impatience == timelimit_impatience);
 
 #ifdef AMD_TOP_N_PLANNER
-	  ego->index = plan_cnt;
-#endif	  
+	  ego->index = (int) t;
+	  if (!hlookup(ego, sig, &flags)) {
+	       hinsert(ego, sig, &flags, slvndx);
+	       hstats(ego, sig, &flags, cost, spread);
+	  }
+	  ego->index = 0;
+#else
 	  if (!hlookup(ego, sig, &flags))
 	       hinsert(ego, sig, &flags, slvndx);
+#endif
      }
 
-    X(ifree0)(old.solutions);
-#ifdef AMD_TOP_N_PLANNER
-    wis_read+=1;    
-    goto wis_read;
-#else    
-    return 1;
-#endif    
+     X(ifree0)(old.solutions);
+     }
+     return 1;
 
  bad:
      /* ``The wisdom of FFTW must be above suspicion.'' */
      X(ifree0)(ht->solutions);
      *ht = old;
      return 0;
-
-#ifdef AMD_TOP_N_PLANNER     
- wis_read:
-          if (wis_read == AMD_OPT_TOP_N) {
-               wisp_set = 1;
-               return 1;          
-	  }											
-     }     
-#endif    
 }
 
 /*
@@ -1261,12 +1792,18 @@ planner *X(mkplanner)(void)
 
      p->adt = &padt;
      p->nplan = p->nprob = 0;
+     p->nsearch = p->ntimeout = p->nswap = 0;
      p->pcost = p->epcost = 0.0;
+     p->trace = 0;
      p->hook = 0;
      p->cost_hook = 0;
      p->wisdom_ok_hook = 0;
      p->nowisdom_hook = 0;
      p->bogosity_hook = 0;
+     p->psearch_hook = 0;
+     p->lock_hook = 0;
+     p->master = 0;
+     p->wisdom_map = 0;
      p->cur_reg_nam = 0;
      p->wisdom_state = WISDOM_NORMAL;
 
@@ -1282,12 +1819,13 @@ planner *X(mkplanner)(void)
      p->timelimit = -1;
 
 #ifdef AMD_TOP_N_PLANNER
-     for (int pln_idx = 0; pln_idx < AMD_OPT_TOP_N ; pln_idx ++) {
-          mkhashtab(&p->htab_blessed[pln_idx]);
-          mkhashtab(&p->htab_unblessed[pln_idx]);
-     }
+     p->htab_blessed = p->htab_unblessed = 0;
+     p->top_n = 0;
+     X(planner_set_top_n)(p, AMD_OPT_TOP_N);
 #else     
+     htab_reset_stats(&p->htab_blessed);
      mkhashtab(&p->htab_blessed);
+     htab_reset_stats(&p->htab_unblessed);
      mkhashtab(&p->htab_unblessed);
 #endif
 
@@ -1301,10 +1839,7 @@ void X(planner_destroy)(planner *ego)
 {
      /* destroy hash table */
 #ifdef AMD_TOP_N_PLANNER
-     for (int pln_idx = 0; pln_idx < AMD_OPT_TOP_N ; pln_idx ++) {
-          htab_destroy(&ego->htab_blessed[pln_idx]);
-          htab_destroy(&ego->htab_unblessed[pln_idx]);
-     }
+     X(planner_set_top_n)(ego, 0);
 #else	
      htab_destroy(&ego->htab_blessed);
      htab_destroy(&ego->htab_unblessed);
@@ -1319,6 +1854,147 @@ void X(planner_destroy)(planner *ego)
      X(ifree)(ego); /* dona eis requiem */
 }
 
+/* sum of the statistics and sizes of all hash tables into SUM */
+void X(planner_htab_stats)(const planner *ego, hashtab *sum)
+{
+     unsigned t;
+     int i;
+
+     memset(sum, 0, sizeof(hashtab));
+     for (t = 0; t < NTABLES(ego); ++t)
+	  for (i = 0; i < 2; ++i) {
+	       const hashtab *ht = i ? UNBLESSED(ego, t) : BLESSED(ego, t);
+	       sum->hashsiz += ht->hashsiz;
+	       sum->nelem += ht->nelem;
+	       sum->lookup += ht->lookup;
+	       sum->succ_lookup += ht->succ_lookup;
+	       sum->lookup_iter += ht->lookup_iter;
+	       sum->insert += ht->insert;
+	       sum->insert_iter += ht->insert_iter;
+	       sum->insert_unknown += ht->insert_unknown;
+	       sum->nrehash += ht->nrehash;
+	  }
+}
+
+void X(planner_reset_stats)(planner *ego)
+{
+     unsigned t;
+
+     ego->nplan = ego->nprob = 0;
+     ego->nsearch = ego->ntimeout = ego->nswap = 0;
+     ego->pcost = ego->epcost = 0.0;
+     for (t = 0; t < NTABLES(ego); ++t) {
+	  htab_reset_stats(BLESSED(ego, t));
+	  htab_reset_stats(UNBLESSED(ego, t));
+     }
+}
+
+#ifdef AMD_TOP_N_PLANNER
+/* Plan for the N best plans of every problem, with one pair of tables
+   per rank.  Changing N forgets all wisdom; N = 0 only frees the
+   tables, for X(planner_destroy). */
+void X(planner_set_top_n)(planner *ego, int n)
+{
+     int t;
+
+     n = X(imax)(0, X(imin)(n, AMD_OPT_TOP_N_MAX));
+     if (n == ego->top_n)
+	  return;
+
+     for (t = 0; t < ego->top_n; ++t) {
+	  htab_destroy(&ego->htab_blessed[t]);
+	  htab_destroy(&ego->htab_unblessed[t]);
+     }
+     X(ifree0)(ego->htab_blessed);
+     X(ifree0)(ego->htab_unblessed);
+     ego->htab_blessed = ego->htab_unblessed = 0;
+     ego->wisdom_map = 0;
+     ego->index = 0;
+     ego->top_n = n;
+
+     if (n > 0) {
+	  ego->htab_blessed = (hashtab *) MALLOC(sizeof(hashtab) * (size_t)n, HASHT);
+	  ego->htab_unblessed = (hashtab *) MALLOC(sizeof(hashtab) * (size_t)n, HASHT);
+	  for (t = 0; t < n; ++t) {
+	       htab_reset_stats(&ego->htab_blessed[t]);
+	       mkhashtab(&ego->htab_blessed[t]);
+	       htab_reset_stats(&ego->htab_unblessed[t]);
+	       mkhashtab(&ego->htab_unblessed[t]);
+	  }
+     }
+}
+
+/* TRUE if plan A may be as fast as plan B, given the spread of their
+   recorded times */
+static int may_compete_p(const plan *a, const plan *b)
+{
+     return a->pcost - 2.0 * sqrt(a->pvar) <= b->pcost + 2.0 * sqrt(b->pvar);
+}
+
+/* Plan P once for each rank, and return the plan of the rank that is
+   the fastest in this run.  Ranks whose recorded times show that they
+   cannot compete with the best one are not timed again; the others
+   are measured anew, so that the choice reflects the machine as it is
+   now. */
+plan *X(mkplan_top_n)(planner *ego, const problem *p)
+{
+     plan *plans[AMD_OPT_TOP_N_MAX];
+     int known[AMD_OPT_TOP_N_MAX], compete[AMD_OPT_TOP_N_MAX];
+     int n, k, best = -1, ncompete = 0;
+     md5 m;
+
+     ego->index = 0;
+     if (ego->top_n == 1)
+	  return ego->adt->mkplan(ego, p);
+
+     md5hash(&m, p, ego);
+     for (n = 0; n < ego->top_n; ++n) {
+	  solution *sol;
+
+	  ego->index = n;
+	  if (!(plans[n] = ego->adt->mkplan(ego, p)))
+	       break;
+	  sol = hlookup(ego, m.s, &ego->flags);
+	  known[n] = (sol && sol->cost > 0);
+	  if (known[n]) {
+	       plans[n]->pcost = sol->cost;
+	       plans[n]->pvar = (double) sol->spread * sol->spread;
+	  }
+     }
+     ego->index = 0;
+
+     if (!ESTIMATEP(ego)) {
+	  for (k = 0; k < n; ++k)
+	       if (known[k] && (best < 0 || cheaperp(plans[k], plans[best])))
+		    best = k;
+	  for (k = 0; k < n; ++k) {
+	       compete[k] = !known[k] || may_compete_p(plans[k], plans[best]);
+	       ncompete += compete[k];
+	  }
+
+	  /* time the competing ranks again */
+	  if (ncompete > 1) {
+	       best = -1;
+	       for (k = 0; k < n; ++k) {
+		    if (!compete[k]) 
+			 continue;
+		    plans[k]->pcost = 0;
+		    evaluate_plan(ego, plans[k], p);
+		    if (best < 0 || cheaperp(plans[k], plans[best]))
+			 best = k;
+	       }
+	  }
+     }
+     if (best < 0)
+	  best = 0;
+
+     for (k = 0; k < n; ++k)
+	  if (k != best)
+	       X(plan_destroy_internal)(plans[k]);
+     return (n > 0) ? plans[best] : 0;
+}
+#endif
+
 plan *X(mkplan_d)(planner *ego, problem *p)
 {
      plan *pln = ego->adt->mkplan(ego, p);
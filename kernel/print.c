@@ -170,9 +170,13 @@ static void vprint(printer *p, const char *format, va_list ap)
 		       case 'p': {  /* note difference from C's %p */
 			    /* print plan */
 			    plan *x = va_arg(ap, plan *);
-			    if (x) 
+			    if (x) {
+				 if (p->plan_hook)
+				      p->plan_hook(p, x, 1);
 				 x->adt->print(x, p);
-			    else 
+				 if (p->plan_hook)
+				      p->plan_hook(p, x, 0);
+			    } else 
 				 goto putnull;
 			    break;
 		       }
@@ -233,6 +237,7 @@ printer *X(mkprinter)(size_t size,
      s->cleanup = cleanup;
      s->indent = 0;
      s->indent_incr = 2;
+     s->plan_hook = 0;
      return s;
 }
 
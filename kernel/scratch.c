@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2021, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Scratch arenas.
+
+   A plan that needs a buffer during execution declares its size with
+   X(scratch_init) when it is created, and awakens it with
+   X(scratch_awake).  When the API awakens a new plan, it brackets the
+   awakening with X(scratch_layout_begin/end), which assigns to every
+   buffer in the plan a distinct offset in one arena and returns the
+   size of the arena.  Distinct buffers never share memory, since the
+   children of threaded plans run concurrently.
+
+   An execution installs an arena in the calling thread with
+   X(scratch_enter), and X(spawn_loop) installs it in the threads that
+   execute the children.  X(scratch_get) then returns the buffer of a
+   plan within the current arena.  Without an arena, e.g. while the
+   planner times a plan or when the arena of the apiplan is in use by
+   a concurrent execution, X(scratch_get) allocates the buffer. */
+
+#include "kernel/ifftw.h"
+
+/* alignment (in bytes) of every buffer within the arena */
+#define SCRATCH_ALIGN 64
+
+#if defined(_MSC_VER)
+#  define THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#  define THREAD_LOCAL __thread
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#  define THREAD_LOCAL _Thread_local
+#endif
+
+#ifdef THREAD_LOCAL
+static THREAD_LOCAL char *cur_base = 0;
+static THREAD_LOCAL size_t cur_n = 0;
+#endif
+
+/* layout of the plan being awakened by the API */
+static int layout = 0;
+static size_t layout_n = 0;
+
+void X(scratch_init)(scratch *s, size_t n)
+{
+     s->n = n;
+     s->off = SCRATCH_NONE;
+}
+
+void X(scratch_awake)(scratch *s, enum wakefulness wakefulness)
+{
+     if (wakefulness == SLEEPY || !layout || !s->n) {
+	  s->off = SCRATCH_NONE;
+     } else {
+	  s->off = layout_n;
+	  layout_n += (s->n + (SCRATCH_ALIGN - 1))
+	       & ~(size_t)(SCRATCH_ALIGN - 1);
+     }
+}
+
+R *X(scratch_get)(const scratch *s)
+{
+#ifdef THREAD_LOCAL
+     if (cur_base && s->off != SCRATCH_NONE && s->off + s->n <= cur_n)
+	  return (R *) (cur_base + s->off);
+#endif
+     return (R *) MALLOC(s->n, BUFFERS);
+}
+
+void X(scratch_put)(const scratch *s, R *buf)
+{
+     UNUSED(s);
+#ifdef THREAD_LOCAL
+     if ((char *) buf >= cur_base && (char *) buf < cur_base + cur_n)
+	  return; /* in the arena */
+#endif
+     X(ifree)(buf);
+}
+
+void X(scratch_layout_begin)(void)
+{
+     layout = 1;
+     layout_n = 0;
+}
+
+size_t X(scratch_layout_end)(void)
+{
+     layout = 0;
+     return layout_n;
+}
+
+void X(scratch_current)(scratch_arena *a)
+{
+#ifdef THREAD_LOCAL
+     a->base = cur_base;
+     a->n = cur_n;
+#else
+     a->base = 0;
+     a->n = 0;
+#endif
+}
+
+void X(scratch_enter)(const scratch_arena *a, scratch_arena *saved)
+{
+     X(scratch_current)(saved);
+#ifdef THREAD_LOCAL
+     cur_base = a->base;
+     cur_n = a->n;
+#endif
+}
+
+void X(scratch_leave)(const scratch_arena *saved)
+{
+#ifdef THREAD_LOCAL
+     cur_base = saved->base;
+     cur_n = saved->n;
+#else
+     UNUSED(saved);
+#endif
+}
@@ -20,6 +20,7 @@
 
 
 #include "kernel/ifftw.h"
+#include <math.h>
 
 #ifdef HAVE_UNISTD_H
 #  include <unistd.h>
@@ -98,6 +99,19 @@ static double elapsed_since(crude_time t0)
 
 #endif /* !HAVE_GETTIMEOFDAY */
 
+/* A measurement is repeated until the 95% confidence interval of the
+   mean time is within X(timing_rel_ci) of the mean.  When plans are
+   compared, X(timing_stability) standard deviations are added to their
+   mean times, so that plans with erratic times can lose to slightly
+   slower but steadier ones.  See X(set_timing_confidence). */
+double X(timing_rel_ci) = 0.02;
+double X(timing_stability) = 0.0;
+
+double X(seconds_since)(crude_time t0)
+{
+     return elapsed_since(t0);
+}
+
 double X(elapsed_since)(const planner *plnr, const problem *p, crude_time t0)
 {
      double t = elapsed_since(t0);
@@ -126,11 +140,86 @@ typedef crude_time ticks;
 #    define TIME_REPEAT 8
 #  endif
 
+#  ifndef TIME_REPEAT_MAX
+#    define TIME_REPEAT_MAX 64
+#  endif
+
+/* samples farther than this many robust standard deviations (1.4826
+   times the median absolute deviation) from the median are outliers,
+   e.g. executions hit by an interrupt or a clock frequency change */
+#  define OUTLIER_SIGMAS 3.0
+
+  static void sort(double *a, int n)
+  {
+       int i, j;
+
+       for (i = 1; i < n; ++i) {
+	    double x = a[i];
+	    for (j = i; j > 0 && a[j - 1] > x; --j)
+		 a[j] = a[j - 1];
+	    a[j] = x;
+       }
+  }
+
+  static double median(const double *sorted, int n)
+  {
+       return 0.5 * (sorted[(n - 1) / 2] + sorted[n / 2]);
+  }
+
+  /* Set *MEAN and *VAR to the mean and variance of the N samples T,
+     outliers excepted, and return the half-width of the 95% confidence
+     interval of *MEAN relative to *MEAN. */
+  static double robust_stats(const double *t, int n, 
+			     double *mean, double *var)
+  {
+       double s[TIME_REPEAT_MAX], d[TIME_REPEAT_MAX];
+       double med, lim, sum = 0, sum2 = 0;
+       int i, m = 0;
+
+       for (i = 0; i < n; ++i)
+	    s[i] = t[i];
+       sort(s, n);
+       med = median(s, n);
+       for (i = 0; i < n; ++i)
+	    d[i] = fabs(s[i] - med);
+       sort(d, n);
+       lim = OUTLIER_SIGMAS * 1.4826 * median(d, n);
+
+       /* at least half of the samples are within LIM, so M > 0 */
+       for (i = 0; i < n; ++i)
+	    if (fabs(s[i] - med) <= lim) {
+		 sum += s[i];
+		 ++m;
+	    }
+       *mean = sum / m;
+
+       for (i = 0; i < n; ++i)
+	    if (fabs(s[i] - med) <= lim)
+		 sum2 += (s[i] - *mean) * (s[i] - *mean);
+       *var = (m > 1) ? sum2 / (m - 1) : 0.0;
+
+       return (*mean > 0) ? 1.96 * sqrt(*var / m) / *mean : 0.0;
+  }
+
   static double measure(plan *pln, const problem *p, int iter)
   {
        ticks t0, t1;
        int i;
 
+       if (X(cache_pressure)) {
+	    /* evict the transform's data before every execution, and
+	       time the executions only */
+	    double t = 0;
+	    for (i = 0; i < iter; ++i) {
+		 X(cache_pollute)();
+		 t0 = getticks();
+		 pln->adt->solve(pln, p);
+		 t1 = getticks();
+		 t += elapsed(t1, t0);
+	    }
+	    return t;
+       }
+
        t0 = getticks();
        for (i = 0; i < iter; ++i) 
 	    pln->adt->solve(pln, p);
@@ -139,42 +228,66 @@ typedef crude_time ticks;
   }
 
 
+  /* the workers of a parallel search share the twiddle tables */
+  static void awake(const planner *plnr, plan *pln, 
+		    enum wakefulness wakefulness)
+  {
+       if (plnr->lock_hook)
+	    plnr->lock_hook(1);
+       X(plan_awake)(pln, wakefulness);
+       if (plnr->lock_hook)
+	    plnr->lock_hook(0);
+  }
+
   double X(measure_execution_time)(const planner *plnr, 
-				   plan *pln, const problem *p)
+				   plan *pln, const problem *p, double *var)
   {
+       double t[TIME_REPEAT_MAX];
        int iter;
-       int repeat;
+       int n;
 
-       X(plan_awake)(pln, AWAKE_ZERO);
+       awake(plnr, pln, AWAKE_ZERO);
        p->adt->zero(p);
 
+       /* warm up the caches and the TLB, and let an idle core reach
+	  its working clock frequency, before anything is timed */
+       measure(pln, p, 1);
+
   start_over:
        for (iter = 1; iter; iter *= 2) {
-	    double tmin = 0;
-	    int first = 1;
+	    double tmin = 0, mean;
 	    crude_time begin = X(get_crude_time)();
 
-	    /* repeat the measurement TIME_REPEAT times */
-	    for (repeat = 0; repeat < TIME_REPEAT; ++repeat) {
-		 double t = measure(pln, p, iter);
+	    /* repeat the measurement at least TIME_REPEAT times, and
+	       until the mean time is known precisely enough */
+	    for (n = 0; n < TIME_REPEAT_MAX; ) {
+		 double x = measure(pln, p, iter);
 		 
 		 if (plnr->cost_hook)
-		      t = plnr->cost_hook(p, t, COST_MAX);
-		 if (t < 0)
+		      x = plnr->cost_hook(p, x, COST_MAX);
+		 if (x < 0)
 		      goto start_over;
 
-		 if (first || t < tmin)
-		      tmin = t;
-		 first = 0;
+		 if (n == 0 || x < tmin)
+		      tmin = x;
+		 t[n++] = x;
 
 		 /* do not run for too long */
 		 if (X(elapsed_since)(plnr, p, begin) > FFTW_TIME_LIMIT)
 		      break;
+
+		 /* too few iterations to time at all, or precise enough */
+		 if (n >= TIME_REPEAT 
+		     && (tmin < TIME_MIN
+			 || robust_stats(t, n, &mean, var) <= X(timing_rel_ci)))
+		      break;
 	    }
 
 	    if (tmin >= TIME_MIN) {
-		 X(plan_awake)(pln, SLEEPY);
-		 return tmin / (double) iter;
+		 robust_stats(t, n, &mean, var);
+		 awake(plnr, pln, SLEEPY);
+		 *var /= (double) iter * (double) iter;
+		 return mean / (double) iter;
 	    }
        }
        goto start_over; /* may happen if timer is screwed up */
@@ -183,9 +296,10 @@ typedef crude_time ticks;
 #else /* no cycle counter */
 
   double X(measure_execution_time)(const planner *plnr, 
-				   plan *pln, const problem *p)
+				   plan *pln, const problem *p, double *var)
   {
        UNUSED(plnr);
+       UNUSED(var);
        UNUSED(p);
        UNUSED(pln);
        return -1.0;
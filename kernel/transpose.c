@@ -694,3 +694,46 @@ void X(transpose_tiledbuf)(R *I, INT n, INT s0, INT s1, INT vl)
 #endif
 }
 
+/* Rows [L, U) of the in-place transpose of a square matrix: the parts
+   of these rows left of the diagonal are swapped with the matching
+   columns, and the diagonal block is transposed.  The slabs of a
+   partition of the rows touch disjoint elements, so that they can be
+   transposed by different threads. */
+static void transpose_slab(R *I, INT l, INT u,
+			   void (*f)(INT n0l, INT n0u, INT n1l, INT n1u,
+				     void *args),
+			   struct transpose_closure *k)
+{
+     if (l > 0) {
+	  k->I = I;
+	  X(tile2d)(0, l, l, u, k->tilesz, f, k);
+     }
+     transpose_rec(I + l * (k->s0 + k->s1), u - l, f, k);
+}
+
+void X(transpose_tiled_slab)(R *I, INT l, INT u, INT s0, INT s1, INT vl)
+{
+     struct transpose_closure k;
+     k.s0 = s0;
+     k.s1 = s1;
+     k.vl = vl;
+     k.tilesz = X(compute_tilesz)(vl, 2);
+     k.buf0 = k.buf1 = 0; /* unused */
+     transpose_slab(I, l, u, dotile, &k);
+}
+
+void X(transpose_tiledbuf_slab)(R *I, INT l, INT u, INT s0, INT s1, INT vl)
+{
+     struct transpose_closure k;
+     R buf0[CACHESIZE / (2 * sizeof(R))];
+     R buf1[CACHESIZE / (2 * sizeof(R))];
+     k.s0 = s0;
+     k.s1 = s1;
+     k.vl = vl;
+     k.tilesz = X(compute_tilesz)(vl, 2);
+     k.buf0 = buf0;
+     k.buf1 = buf1;
+     A(k.tilesz * k.tilesz * vl * sizeof(R) <= sizeof(buf0));
+     A(k.tilesz * k.tilesz * vl * sizeof(R) <= sizeof(buf1));
+     transpose_slab(I, l, u, dotile_buf, &k);
+}
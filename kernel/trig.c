@@ -166,7 +166,43 @@ static void rotate_generic(triggen *p, INT m, R xr, R xi, R *res)
      res[1] = xi * w[0] + xr * (FFT_SIGN * w[1]);
 }
 
-triggen *X(mktriggen)(enum wakefulness wakefulness, INT n)
+/* Generators are shared: plans of size N awaken many twiddle tables
+   (one per radix and twiddle layout), Rader and Bluestein plans
+   awaken more, and all of them would otherwise compute the same
+   sqrt(N) tables.  The hash table of generators in use is keyed by
+   (wakefulness, n) and doubles with the number of generators. */
+static triggen **tgtab = 0;
+static INT tgtab_sz = 0;
+static INT tgtab_n = 0;
+
+static triggen **tgbucket(enum wakefulness wakefulness, INT n)
+{
+     size_t h = (size_t) n * 0x9e3779b1u + (size_t) wakefulness;
+     return &tgtab[(h ^ (h >> 16)) & (size_t)(tgtab_sz - 1)];
+}
+
+static void tgrehash(INT sz)
+{
+     triggen **old = tgtab, *p, *q;
+     INT i, osz = tgtab_sz;
+
+     tgtab = (triggen **)MALLOC(sz * sizeof(triggen *), TWIDDLES);
+     tgtab_sz = sz;
+     for (i = 0; i < sz; ++i)
+	  tgtab[i] = 0;
+
+     for (i = 0; i < osz; ++i) {
+	  for (p = old[i]; p; p = q) {
+	       triggen **b = tgbucket(p->wakefulness, p->n);
+	       q = p->cdr;
+	       p->cdr = *b;
+	       *b = p;
+	  }
+     }
+     X(ifree0)(old);
+}
+
+static triggen *mktriggen0(enum wakefulness wakefulness, INT n)
 {
      INT i, n0, n1;
      triggen *p = (triggen *)MALLOC(sizeof(*p), TWIDDLES);
@@ -226,8 +262,47 @@ triggen *X(mktriggen)(enum wakefulness wakefulness, INT n)
      return p;
 }
 
+triggen *X(mktriggen)(enum wakefulness wakefulness, INT n)
+{
+     triggen *p, **b;
+
+     if (tgtab) {
+	  for (p = *tgbucket(wakefulness, n); p; p = p->cdr)
+	       if (p->n == n && p->wakefulness == wakefulness) {
+		    ++p->refcnt;
+		    return p;
+	       }
+     }
+
+     p = mktriggen0(wakefulness, n);
+     p->wakefulness = wakefulness;
+     p->refcnt = 1;
+
+     if (tgtab_n >= tgtab_sz)
+	  tgrehash(tgtab_sz ? 2 * tgtab_sz : 16);
+     b = tgbucket(wakefulness, n);
+     p->cdr = *b;
+     *b = p;
+     ++tgtab_n;
+     return p;
+}
+
 void X(triggen_destroy)(triggen *p)
 {
+     triggen **q;
+
+     if (--p->refcnt > 0)
+	  return;
+
+     for (q = tgbucket(p->wakefulness, p->n); *q != p; q = &((*q)->cdr))
+	  A(*q);
+     *q = p->cdr;
+     if (--tgtab_n == 0) {
+	  X(ifree)(tgtab);
+	  tgtab = 0;
+	  tgtab_sz = 0;
+     }
+
      X(ifree0)(p->W0);
      X(ifree0)(p->W1);
      X(ifree)(p);
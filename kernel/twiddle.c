@@ -23,19 +23,38 @@
 
 #include "kernel/ifftw.h"
 #include <math.h>
-
-#define HASHSZ 109
-
-/* hash table of known twiddle factors */
-static twid *twlist[HASHSZ];
-
-static INT hash(INT n, INT r)
+#include <string.h>
+
+/* hash table of known twiddle factors, keyed by (n, r, instr).  The
+   number of buckets is a power of two that doubles when the table
+   holds as many twiddle arrays as buckets, so that plans with
+   thousands of distinct twiddle arrays still find theirs in O(1).
+   Like the rest of the planner, the table is protected by the locks
+   of the callers (the planner hooks of the API and the lock of the
+   parallel search). */
+static twid **twtab = 0;
+static INT twtab_sz = 0;
+static INT twtab_n = 0;
+
+static size_t hash(INT n, INT r, const tw_instr *p)
 {
-     INT h = n * 17 + r;
-
-     if (h < 0) h = -h;
+     size_t h = (size_t) n * 0x9e3779b1u + (size_t) r;
+
+     /* the fields that equal_instr() ignores are not hashed */
+     for (;; ++p) {
+	  h = h * 31 + p->op;
+	  h = h * 31 + (size_t) (p->v + 128);
+	  if (p->op == TW_NEXT)
+	       break;
+	  if (p->op != TW_FULL && p->op != TW_HALF)
+	       h = h * 31 + (size_t) (p->i + 32768);
+     }
+     return h ^ (h >> 16);
+}
 
-     return (h % HASHSZ);
+static twid **bucket(INT n, INT r, const tw_instr *p)
+{
+     return &twtab[hash(n, r, p) & (size_t)(twtab_sz - 1)];
 }
 
 static int equal_instr(const tw_instr *p, const tw_instr *q)
@@ -80,13 +99,80 @@ static twid *lookup(enum wakefulness wakefulness,
 {
      twid *p;
 
-     for (p = twlist[hash(n,r)]; 
+     if (!twtab)
+	  return 0;
+
+     for (p = *bucket(n, r, q); 
 	  p && !ok_twid(p, wakefulness, q, n, r, m); 
 	  p = p->cdr)
           ;
      return p;
 }
 
+static void rehash(INT sz)
+{
+     twid **old = twtab, *p, *q;
+     INT i, osz = twtab_sz;
+
+     twtab = (twid **)MALLOC(sz * sizeof(twid *), TWIDDLES);
+     twtab_sz = sz;
+     for (i = 0; i < sz; ++i)
+	  twtab[i] = 0;
+
+     for (i = 0; i < osz; ++i) {
+	  for (p = old[i]; p; p = q) {
+	       twid **b = bucket(p->n, p->r, p->instr);
+	       q = p->cdr;
+	       p->cdr = *b;
+	       *b = p;
+	  }
+     }
+     X(ifree0)(old);
+}
+
+static void insert(twid *p)
+{
+     twid **b;
+
+     if (twtab_n >= twtab_sz)
+	  rehash(twtab_sz ? 2 * twtab_sz : 64);
+
+     /* cons! onto the bucket */
+     b = bucket(p->n, p->r, p->instr);
+     p->cdr = *b;
+     *b = p;
+     ++twtab_n;
+}
+
+static void remove_twid(twid *p)
+{
+     twid **q;
+
+     for (q = bucket(p->n, p->r, p->instr); *q; q = &((*q)->cdr)) {
+	  if (*q == p) {
+	       *q = p->cdr;
+	       /* the last table releases the buckets */
+	       if (--twtab_n == 0) {
+		    X(ifree)(twtab);
+		    twtab = 0;
+		    twtab_sz = 0;
+	       }
+	       return;
+	  }
+     }
+     A(0 /* can't happen */ );
+}
+
+static void free_twid(twid *p)
+{
+     if (!p->mapped)
+	  X(ifree)(p->W);
+     X(ifree0)(p->icopy);
+     if (p->t)
+	  X(triggen_destroy)(p->t);
+     X(ifree)(p);
+}
+
 static INT twlen0(INT r, const tw_instr *p, INT *vl)
 {
      INT ntwiddle = 0;
@@ -121,13 +207,13 @@ INT X(twiddle_length)(INT r, const tw_instr *p)
      return twlen0(r, p, &vl);
 }
 
-static R *compute(enum wakefulness wakefulness,
-		  const tw_instr *instr, INT n, INT r, INT m)
+/* compute the twiddle factors with the trig generator T, which is
+   shared by all the tables and plans of size N */
+static R *compute(triggen *t, const tw_instr *instr, INT n, INT r, INT m)
 {
      INT ntwiddle, j, vl;
      R *W, *W0;
      const tw_instr *p;
-     triggen *t = X(mktriggen)(wakefulness, n);
 
      p = instr;
      ntwiddle = twlen0(r, p, &vl);
@@ -190,7 +276,6 @@ static R *compute(enum wakefulness wakefulness,
 	  }
      }
 
-     X(triggen_destroy)(t);
      return W0;
 }
 
@@ -198,7 +283,6 @@ static void mktwiddle(enum wakefulness wakefulness,
 		      twid **pp, const tw_instr *instr, INT n, INT r, INT m)
 {
      twid *p;
-     INT h;
 
      if ((p = lookup(wakefulness, instr, n, r, m))) {
           ++p->refcnt;
@@ -208,14 +292,13 @@ static void mktwiddle(enum wakefulness wakefulness,
 	  p->r = r;
 	  p->m = m;
 	  p->instr = instr;
+	  p->icopy = 0;
 	  p->refcnt = 1;
 	  p->wakefulness = wakefulness;
-	  p->W = compute(wakefulness, instr, n, r, m);
-
-	  /* cons! onto twlist */
-	  h = hash(n, r);
-	  p->cdr = twlist[h];
-	  twlist[h] = p;
+	  p->mapped = 0;
+	  p->t = X(mktriggen)(wakefulness, n);
+	  p->W = compute(p->t, instr, n, r, m);
+	  insert(p);
      }
 
      *pp = p;
@@ -224,20 +307,12 @@ static void mktwiddle(enum wakefulness wakefulness,
 static void twiddle_destroy(twid **pp)
 {
      twid *p = *pp;
-     twid **q;
 
-     if ((--p->refcnt) == 0) {
-	  /* remove p from twiddle list */
-	  for (q = &twlist[hash(p->n, p->r)]; *q; q = &((*q)->cdr)) {
-	       if (*q == p) {
-		    *q = p->cdr;
-		    X(ifree)(p->W);
-		    X(ifree)(p);
-		    *pp = 0;
-		    return;
-	       }
-	  }
-	  A(0 /* can't happen */ );
+     /* tables of a twiddle file stay until the file is detached */
+     if ((--p->refcnt) == 0 && !p->mapped) {
+	  remove_twid(p);
+	  free_twid(p);
+	  *pp = 0;
      }
 }
 
@@ -254,3 +329,253 @@ void X(twiddle_awake)(enum wakefulness wakefulness, twid **pp,
 	      break;
      }
 }
+
+/*
+  Twiddle files.  X(twiddle_export) writes the twiddle factors of the
+  tables in use into a versioned image:
+
+    header | ntab records | instructions of each table | factors
+
+  The factors of each table start at a multiple of 64 bytes, so that a
+  file mapped read-only at a page boundary can be used in place.
+  X(twiddle_map) inserts the tables of such an image into the hash
+  table, where plans find them instead of computing their factors.
+  The image must stay in place until X(twiddle_unmap), which copies
+  the tables still in use into memory.
+*/
+
+#define TWFILE_MAGIC "FFTW-TW"
+#define TWFILE_VERSION 1
+#define TWFILE_ENDIAN 0x01020304u
+#define TWFILE_ALIGN 64
+
+typedef struct {
+     char magic[8];
+     unsigned version;
+     unsigned endian;
+     unsigned sizeof_R;
+     unsigned sizeof_INT;
+     INT ntab;
+} twfile_header;
+
+typedef struct {
+     INT n, r, m;
+     INT wakefulness;
+     INT ninstr;    /* number of instructions, TW_NEXT included */
+     INT instr_off; /* offsets in bytes from the start of the image */
+     INT W_off;
+     INT nW;        /* number of factors */
+} twfile_record;
+
+static INT round_up(INT x, INT a)
+{
+     return (x + a - 1) / a * a;
+}
+
+static INT ninstr(const tw_instr *p)
+{
+     INT k = 1;
+     for ( ; p->op != TW_NEXT; ++p)
+	  ++k;
+     return k;
+}
+
+static INT nfactors(const twid *p)
+{
+     INT vl, ntwiddle = twlen0(p->r, p->instr, &vl);
+     return ntwiddle * (p->m / vl);
+}
+
+/* tables worth saving; AWAKE_ZERO tables are all zero */
+static int exportable(const twid *p)
+{
+     return p->wakefulness == AWAKE_SQRTN_TABLE
+	  || p->wakefulness == AWAKE_SINCOS;
+}
+
+/* write the image into BUF if BUF != 0; return its size in bytes */
+size_t X(twiddle_export)(void *buf)
+{
+     char *b = (char *)buf;
+     INT i, k, ntab = 0, off;
+     twid *p;
+
+     for (i = 0; i < twtab_sz; ++i)
+	  for (p = twtab[i]; p; p = p->cdr)
+	       if (exportable(p))
+		    ++ntab;
+
+     off = (INT)sizeof(twfile_header) + ntab * (INT)sizeof(twfile_record);
+
+     if (b) {
+	  twfile_header h;
+	  memset(&h, 0, sizeof(h));
+	  strcpy(h.magic, TWFILE_MAGIC);
+	  h.version = TWFILE_VERSION;
+	  h.endian = TWFILE_ENDIAN;
+	  h.sizeof_R = (unsigned)sizeof(R);
+	  h.sizeof_INT = (unsigned)sizeof(INT);
+	  h.ntab = ntab;
+	  memcpy(b, &h, sizeof(h));
+     }
+
+     /* instructions */
+     k = 0;
+     for (i = 0; i < twtab_sz; ++i)
+	  for (p = twtab[i]; p; p = p->cdr)
+	       if (exportable(p)) {
+		    INT ni = ninstr(p->instr);
+		    if (b) {
+			 twfile_record rec;
+			 rec.n = p->n;
+			 rec.r = p->r;
+			 rec.m = p->m;
+			 rec.wakefulness = (INT)p->wakefulness;
+			 rec.ninstr = ni;
+			 rec.instr_off = off;
+			 rec.W_off = 0; /* filled below */
+			 rec.nW = nfactors(p);
+			 memcpy(b + sizeof(twfile_header)
+				+ k * sizeof(twfile_record),
+				&rec, sizeof(rec));
+			 memcpy(b + off, p->instr, ni * sizeof(tw_instr));
+		    }
+		    off += ni * (INT)sizeof(tw_instr);
+		    ++k;
+	       }
+
+     /* factors */
+     k = 0;
+     for (i = 0; i < twtab_sz; ++i)
+	  for (p = twtab[i]; p; p = p->cdr)
+	       if (exportable(p)) {
+		    INT nW = nfactors(p);
+		    off = round_up(off, TWFILE_ALIGN);
+		    if (b) {
+			 twfile_record *rec = (twfile_record *)
+			      (b + sizeof(twfile_header)
+			       + k * sizeof(twfile_record));
+			 rec->W_off = off;
+			 memcpy(b + off, p->W, nW * sizeof(R));
+		    }
+		    off += nW * (INT)sizeof(R);
+		    ++k;
+	       }
+
+     return (size_t)off;
+}
+
+static int valid_instr(const tw_instr *p, INT ni)
+{
+     INT k;
+     for (k = 0; k < ni - 1; ++k)
+	  if (p[k].op > TW_HALF || p[k].op == TW_NEXT)
+	       return 0;
+     return p[ni - 1].op == TW_NEXT && p[ni - 1].v > 0;
+}
+
+static int valid_record(const twfile_record *rec, const char *img,
+			size_t sz)
+{
+     const tw_instr *instr;
+     INT vl;
+
+     if (rec->n <= 0 || rec->r <= 0 || rec->m <= 0 || rec->ninstr <= 0
+	 || (rec->wakefulness != AWAKE_SQRTN_TABLE
+	     && rec->wakefulness != AWAKE_SINCOS)
+	 || rec->instr_off < 0 || rec->W_off < 0 || rec->nW < 0
+	 || rec->W_off % TWFILE_ALIGN != 0
+	 || (size_t)rec->instr_off + rec->ninstr * sizeof(tw_instr) > sz
+	 || (size_t)rec->W_off + rec->nW * sizeof(R) > sz)
+	  return 0;
+
+     instr = (const tw_instr *)(img + rec->instr_off);
+     if (!valid_instr(instr, rec->ninstr))
+	  return 0;
+     return (rec->nW == twlen0(rec->r, instr, &vl) * (rec->m / vl)
+	     && rec->m % vl == 0);
+}
+
+/* detach the tables of the image, if any; copy those still in use */
+void X(twiddle_unmap)(void)
+{
+     INT i;
+     twid **q, *p;
+
+     for (i = 0; i < twtab_sz; ++i) {
+	  for (q = &twtab[i]; (p = *q); ) {
+	       if (!p->mapped) {
+		    q = &p->cdr;
+	       } else if (p->refcnt > 0) {
+		    INT nW = nfactors(p), ni = ninstr(p->instr);
+		    R *W = (R *)MALLOC(nW * sizeof(R), TWIDDLES);
+		    memcpy(W, p->W, nW * sizeof(R));
+		    p->icopy = (tw_instr *)MALLOC(ni * sizeof(tw_instr),
+						  TWIDDLES);
+		    memcpy(p->icopy, p->instr, ni * sizeof(tw_instr));
+		    p->instr = p->icopy;
+		    p->W = W;
+		    p->mapped = 0;
+		    q = &p->cdr;
+	       } else {
+		    *q = p->cdr;
+		    --twtab_n;
+		    X(ifree)(p);
+	       }
+	  }
+     }
+     if (twtab && twtab_n == 0) {
+	  X(ifree)(twtab);
+	  twtab = 0;
+	  twtab_sz = 0;
+     }
+}
+
+/* attach the image IMG of SZ bytes; return 0 if it is not a valid
+   twiddle file of this configuration */
+int X(twiddle_map)(const void *img, size_t sz)
+{
+     const char *b = (const char *)img;
+     twfile_header h;
+     INT k;
+
+     if (sz < sizeof(h))
+	  return 0;
+     memcpy(&h, b, sizeof(h));
+     if (memcmp(h.magic, TWFILE_MAGIC, sizeof(TWFILE_MAGIC))
+	 || h.version != TWFILE_VERSION
+	 || h.endian != TWFILE_ENDIAN
+	 || h.sizeof_R != sizeof(R)
+	 || h.sizeof_INT != sizeof(INT)
+	 || h.ntab < 0
+	 || sizeof(h) + (size_t)h.ntab * sizeof(twfile_record) > sz)
+	  return 0;
+
+     for (k = 0; k < h.ntab; ++k) {
+	  twfile_record rec;
+	  memcpy(&rec, b + sizeof(h) + k * sizeof(rec), sizeof(rec));
+	  if (!valid_record(&rec, b, sz))
+	       return 0;
+     }
+
+     X(twiddle_unmap)();
+
+     for (k = 0; k < h.ntab; ++k) {
+	  twfile_record rec;
+	  twid *p = (twid *) MALLOC(sizeof(twid), TWIDDLES);
+
+	  memcpy(&rec, b + sizeof(h) + k * sizeof(rec), sizeof(rec));
+	  p->n = rec.n;
+	  p->r = rec.r;
+	  p->m = rec.m;
+	  p->instr = (const tw_instr *)(b + rec.instr_off);
+	  p->icopy = 0;
+	  p->refcnt = 0;
+	  p->wakefulness = (enum wakefulness)rec.wakefulness;
+	  p->mapped = 1;
+	  p->t = 0;
+	  p->W = (R *)(b + rec.W_off);
+	  insert(p);
+     }
+     return 1;
+}
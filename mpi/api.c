@@ -354,6 +354,12 @@ ptrdiff_t XM(local_size_guru)(int rnk, const XM(ddim) *dims0,
 	  }
      }
 
+     else if (rnk == 3 && !MPI_FLAGS(flags)
+	      && XM(num_blocks)(sz->dims[2].n, sz->dims[2].b[IB]) == 1) {
+	  /* dft-rank3-pencil, if the blocks form a 2d process grid */
+	  N = X(imax)(N, XM(dft_rank3_pencil_local_size)(sz, 0, my_pe));
+     }
+
      local_size(my_pe, sz, IB, local_n_in, local_start_in);
      local_size(my_pe, sz, OB, local_n_out, local_start_out);
 
@@ -528,6 +534,145 @@ ptrdiff_t XM(local_size_3d)(ptrdiff_t nx, ptrdiff_t ny, ptrdiff_t nz,
      return XM(local_size)(3, n, comm, local_nx, local_x_start);
 }
 
+/*************************************************************************/
+/* Pencil decomposition of 3d complex DFTs */
+
+/* Convert FFTW_MPI_TRANSPOSED_IN/OUT to the rotated layouts. */
+#define PENCIL_FLAGS(f) ((((f) & FFTW_MPI_TRANSPOSED_IN) ? ROTATED_IN : 0) \
+			 | (((f) & FFTW_MPI_TRANSPOSED_OUT) ? ROTATED_OUT : 0))
+
+/* TRUE if the default block size splits n into exactly np blocks */
+static int pencil_fits(INT n, int np)
+{
+     return XM(num_blocks)(n, XM(default_block)(n, np)) == np;
+}
+
+/* Choose the P0 x P1 process grid: use as many processes as possible,
+   with P0 and P1 as close as possible, such that every process of the
+   grid gets a nonempty block of the dimensions distributed over P0 (n0
+   and n1) and over P1 (n1 and n2).  The grid does not depend on the
+   flags, so that forward and backward plans agree on the layouts. */
+static void pencil_grid(const ptrdiff_t *n, int n_pes, int *p0, int *p1)
+{
+     int q0, q1;
+
+     *p0 = *p1 = 1;
+     for (q0 = 1; q0 <= n_pes; ++q0) {
+	  if (!pencil_fits(n[0], q0) || !pencil_fits(n[1], q0))
+	       continue;
+	  for (q1 = n_pes / q0; q1 > 1; --q1)
+	       if (pencil_fits(n[1], q1) && pencil_fits(n[2], q1))
+		    break;
+	  if (q0 * q1 > *p0 * *p1
+	      || (q0 * q1 == *p0 * *p1
+		  && X(iabs)(q0 - q1) < X(iabs)(*p0 - *p1))) {
+	       *p0 = q0;
+	       *p1 = q1;
+	  }
+     }
+}
+
+static dtensor *pencil_sz(const ptrdiff_t *n, int p0, int p1,
+			  unsigned flags)
+{
+     dtensor *sz = XM(mkdtensor)(3), *sz0;
+     block_kind k;
+     int i;
+
+     for (i = 0; i < 3; ++i)
+	  sz->dims[i].n = n[i];
+     FORALL_BLOCK_KIND(k) {
+	  if (flags & (k == IB ? FFTW_MPI_TRANSPOSED_IN
+		       : FFTW_MPI_TRANSPOSED_OUT)) {
+	       sz->dims[0].b[k] = n[0];
+	       sz->dims[1].b[k] = XM(default_block)(n[1], p0);
+	       sz->dims[2].b[k] = XM(default_block)(n[2], p1);
+	  } else {
+	       sz->dims[0].b[k] = XM(default_block)(n[0], p0);
+	       sz->dims[1].b[k] = XM(default_block)(n[1], p1);
+	       sz->dims[2].b[k] = n[2];
+	  }
+     }
+     sz0 = XM(dtensor_canonical)(sz, 0);
+     XM(dtensor_destroy)(sz);
+     return sz0;
+}
+
+ptrdiff_t XM(local_size_many_pencil)(const ptrdiff_t *n, ptrdiff_t howmany,
+				     MPI_Comm comm, unsigned flags,
+				     ptrdiff_t *local_n_in,
+				     ptrdiff_t *local_start_in,
+				     ptrdiff_t *local_n_out,
+				     ptrdiff_t *local_start_out)
+{
+     INT N;
+     int my_pe, n_pes, p0, p1;
+     dtensor *sz;
+
+     MPI_Comm_rank(comm, &my_pe);
+     MPI_Comm_size(comm, &n_pes);
+     pencil_grid(n, n_pes, &p0, &p1);
+     sz = pencil_sz(n, p0, p1, flags);
+
+     local_size(my_pe, sz, IB, local_n_in, local_start_in);
+     local_size(my_pe, sz, OB, local_n_out, local_start_out);
+
+     N = X(imax)(1, X(imax)(prod(3, local_n_in), prod(3, local_n_out)));
+     N = X(imax)(N, XM(dft_rank3_pencil_local_size)(sz, PENCIL_FLAGS(flags),
+						    my_pe));
+     XM(dtensor_destroy)(sz);
+     return N * howmany;
+}
+
+ptrdiff_t XM(local_size_pencil)(ptrdiff_t n0, ptrdiff_t n1, ptrdiff_t n2,
+				MPI_Comm comm, unsigned flags,
+				ptrdiff_t *local_n_in,
+				ptrdiff_t *local_start_in,
+				ptrdiff_t *local_n_out,
+				ptrdiff_t *local_start_out)
+{
+     ptrdiff_t n[3];
+     n[0] = n0; n[1] = n1; n[2] = n2;
+     return XM(local_size_many_pencil)(n, 1, comm, flags,
+				       local_n_in, local_start_in,
+				       local_n_out, local_start_out);
+}
+
+X(plan) XM(plan_many_dft_pencil)(const ptrdiff_t *n, ptrdiff_t howmany,
+				 C *in, C *out,
+				 MPI_Comm comm, int sign, unsigned flags)
+{
+     int n_pes, p0, p1, i;
+
+     XM(init)();
+
+     if (howmany < 0) return 0;
+     for (i = 0; i < 3; ++i)
+	  if (n[i] < 1) return 0;
+     if ((flags & FFTW_MPI_TRANSPOSED_IN) && (flags & FFTW_MPI_TRANSPOSED_OUT))
+	  return 0;
+     if (flags & (FFTW_MPI_SCRAMBLED_IN | FFTW_MPI_SCRAMBLED_OUT))
+	  return 0;
+
+     MPI_Comm_size(comm, &n_pes);
+     pencil_grid(n, n_pes, &p0, &p1);
+
+     return
+          X(mkapiplan)(sign, flags,
+                       XM(mkproblem_dft_d)(pencil_sz(n, p0, p1, flags),
+					   howmany, (R *) in, (R *) out,
+					   comm, sign, PENCIL_FLAGS(flags)));
+}
+
+X(plan) XM(plan_dft_3d_pencil)(ptrdiff_t n0, ptrdiff_t n1, ptrdiff_t n2,
+			       C *in, C *out,
+			       MPI_Comm comm, int sign, unsigned flags)
+{
+     ptrdiff_t n[3];
+     n[0] = n0; n[1] = n1; n[2] = n2;
+     return XM(plan_many_dft_pencil)(n, 1, in, out, comm, sign, flags);
+}
+
 /*************************************************************************/
 /* Transpose API */
 
@@ -41,6 +41,7 @@ static const solvtab s =
      SOLVTAB(XM(dft_serial_register)),
      SOLVTAB(XM(dft_rank1_bigvec_register)),
      SOLVTAB(XM(dft_rank1_register)),
+     SOLVTAB(XM(dft_rank3_pencil_register)),
      SOLVTAB(XM(rdft_rank_geq2_register)),
      SOLVTAB(XM(rdft_rank_geq2_transposed_register)),
      SOLVTAB(XM(rdft_serial_register)),
@@ -0,0 +1,488 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Complex 3d DFTs distributed over a P0 x P1 grid of processes
+   ("pencil" decomposition), so that up to n0 * n1 processes can be
+   used instead of the n0 of the slab decomposition.
+
+   In the normal layout, the local array is (n0/P0) x (n1/P1) x n2 on
+   the process of rank r0 * P1 + r1.  In the rotated layout
+   (ROTATED_IN/OUT, i.e. FFTW_MPI_TRANSPOSED_IN/OUT in the pencil API)
+   it is (n1/P0) x (n2/P1) x n0.  The transform alternates local DFTs
+   of the dimension that is currently local with transposes over the
+   rows (the P1 processes with the same r0) or the columns (the P0
+   processes with the same r1) of the grid, so that each transpose only
+   involves sqrt(P) processes.  Normal to rotated takes three local
+   DFTs and two transposes; normal to normal needs two more transposes
+   to return to the original distribution. */
+
+#include "mpi-dft.h"
+#include "mpi-transpose.h"
+#include "dft/dft.h"
+
+#define MAXSTEPS 9
+
+enum { LOCAL_DFT, LOCAL_COPY, TRANSPOSE };
+enum { ROW, COL };
+
+/* local array of dimensions ord[0] x ord[1] x ord[2] x vn, holding
+   n[d] elements of dimension d */
+typedef struct {
+     int ord[3];
+     INT n[3];
+} layout;
+
+typedef struct {
+     int kind;
+     int d; /* dimension transformed by LOCAL_DFT */
+     int x, y, comm; /* TRANSPOSE of x (block bx) to y (block by) */
+     INT bx, by;
+     layout in, out;
+} step;
+
+typedef struct {
+     solver super;
+} S;
+
+typedef struct {
+     plan_mpi_dft super;
+
+     plan *cld[MAXSTEPS];
+     int kind[MAXSTEPS], rd[MAXSTEPS], wr[MAXSTEPS];
+     int nsteps;
+     INT p0, p1;
+     INT nbuf; /* size of the scratch buffer, or 0 */
+     INT roff, ioff;
+} P;
+
+static void apply(const plan *ego_, R *I, R *O)
+{
+     const P *ego = (const P *) ego_;
+     INT roff = ego->roff, ioff = ego->ioff;
+     R *buf[3];
+     int i;
+
+     buf[0] = I;
+     buf[1] = O;
+     buf[2] = ego->nbuf ? (R *) MALLOC(sizeof(R) * ego->nbuf, BUFFERS) : 0;
+
+     for (i = 0; i < ego->nsteps; ++i) {
+	  R *rd = buf[ego->rd[i]], *wr = buf[ego->wr[i]];
+
+	  if (!ego->cld[i])
+	       continue; /* nothing to do on this process */
+	  if (ego->kind[i] == LOCAL_DFT) {
+	       plan_dft *cld = (plan_dft *) ego->cld[i];
+	       cld->apply(ego->cld[i], rd + roff, rd + ioff,
+			  wr + roff, wr + ioff);
+	  } else {
+	       plan_rdft *cld = (plan_rdft *) ego->cld[i];
+	       cld->apply(ego->cld[i], rd, wr);
+	  }
+     }
+
+     X(ifree0)(buf[2]);
+}
+
+static void awake(plan *ego_, enum wakefulness wakefulness)
+{
+     P *ego = (P *) ego_;
+     int i;
+     for (i = 0; i < ego->nsteps; ++i)
+	  X(plan_awake)(ego->cld[i], wakefulness);
+}
+
+static void destroy(plan *ego_)
+{
+     P *ego = (P *) ego_;
+     int i;
+     for (i = ego->nsteps - 1; i >= 0; --i)
+	  X(plan_destroy_internal)(ego->cld[i]);
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *) ego_;
+     int i;
+     p->print(p, "(mpi-dft-rank3-pencil/%Dx%D", ego->p0, ego->p1);
+     for (i = 0; i < ego->nsteps; ++i)
+	  if (ego->cld[i])
+	       p->print(p, "%(%p%)", ego->cld[i]);
+     p->print(p, ")");
+}
+
+/* the P0 x P1 process grid, given by the input distribution */
+static void grid(const dtensor *sz, unsigned flags, INT *p0, INT *p1)
+{
+     const ddim *d = sz->dims;
+     if (flags & ROTATED_IN) {
+	  *p0 = XM(num_blocks)(d[1].n, d[1].b[IB]);
+	  *p1 = XM(num_blocks)(d[2].n, d[2].b[IB]);
+     } else {
+	  *p0 = XM(num_blocks)(d[0].n, d[0].b[IB]);
+	  *p1 = XM(num_blocks)(d[1].n, d[1].b[IB]);
+     }
+}
+
+static INT layout_sz(const layout *l)
+{
+     return l->n[0] * l->n[1] * l->n[2];
+}
+
+/* stride (in reals) of dimension d in layout l */
+static INT stride(const layout *l, int d, INT vn)
+{
+     INT s = 2 * vn;
+     int i;
+     for (i = 2; l->ord[i] != d; --i)
+	  s *= l->n[l->ord[i]];
+     return s;
+}
+
+static void set_order(layout *l, int o0, int o1, int o2)
+{
+     l->ord[0] = o0;
+     l->ord[1] = o1;
+     l->ord[2] = o2;
+}
+
+/* append a local step transforming dimension d (or just copying, if
+   d < 0) from the current layout l to the order o0 x o1 x o2 */
+static int local_step(step *s, int k, layout *l, int d,
+		      int o0, int o1, int o2)
+{
+     s[k].kind = d >= 0 ? LOCAL_DFT : LOCAL_COPY;
+     s[k].d = d;
+     s[k].in = *l;
+     set_order(l, o0, o1, o2);
+     s[k].out = *l;
+     return k + 1;
+}
+
+/* append a transpose from x_local x y x z to y_local x x x z, over the
+   communicator comm in which this process has coordinate r */
+static int transpose_step(step *s, int k, layout *l, const INT *n,
+			  int x, int y, INT bx, INT by, int comm, int r)
+{
+     A(l->ord[0] == x && l->ord[1] == y);
+     s[k].kind = TRANSPOSE;
+     s[k].x = x;
+     s[k].y = y;
+     s[k].bx = bx;
+     s[k].by = by;
+     s[k].comm = comm;
+     s[k].in = *l;
+     set_order(l, y, x, l->ord[2]);
+     l->n[x] = n[x];
+     l->n[y] = XM(block)(n[y], by, r);
+     s[k].out = *l;
+     return k + 1;
+}
+
+static int mksteps(const dtensor *sz, unsigned flags, int my_pe, step *s)
+{
+     const ddim *d = sz->dims;
+     INT n[3], p0, p1, bb, bc;
+     int r0, r1, k = 0;
+     layout l;
+
+     n[0] = d[0].n;
+     n[1] = d[1].n;
+     n[2] = d[2].n;
+     grid(sz, flags, &p0, &p1);
+     r0 = my_pe / p1; /* >= p0 (empty blocks) if idle */
+     r1 = my_pe % p1;
+
+     if (flags & ROTATED_IN) {
+	  l.n[0] = n[0];
+	  l.n[1] = XM(block)(n[1], d[1].b[IB], r0);
+	  l.n[2] = XM(block)(n[2], d[2].b[IB], r1);
+	  set_order(&l, 1, 2, 0);
+	  k = local_step(s, k, &l, 0, 1, 0, 2);
+	  k = transpose_step(s, k, &l, n, 1, 0, d[1].b[IB], d[0].b[OB],
+			     COL, r0);
+	  k = local_step(s, k, &l, 1, 2, 1, 0);
+	  k = transpose_step(s, k, &l, n, 2, 1, d[2].b[IB], d[1].b[OB],
+			     ROW, r1);
+	  k = local_step(s, k, &l, 2, 0, 1, 2);
+	  return k;
+     }
+
+     if (flags & ROTATED_OUT) {
+	  bb = d[1].b[OB];
+	  bc = d[2].b[OB];
+     } else {
+	  bb = XM(default_block)(n[1], p0);
+	  bc = XM(default_block)(n[2], p1);
+     }
+     l.n[0] = XM(block)(n[0], d[0].b[IB], r0);
+     l.n[1] = XM(block)(n[1], d[1].b[IB], r1);
+     l.n[2] = n[2];
+     set_order(&l, 0, 1, 2);
+     k = local_step(s, k, &l, 2, 1, 2, 0);
+     k = transpose_step(s, k, &l, n, 1, 2, d[1].b[IB], bc, ROW, r1);
+     k = local_step(s, k, &l, 1, 0, 1, 2);
+     k = transpose_step(s, k, &l, n, 0, 1, d[0].b[IB], bb, COL, r0);
+     if (flags & ROTATED_OUT)
+	  return local_step(s, k, &l, 0, 1, 2, 0);
+
+     /* back to the input distribution */
+     k = local_step(s, k, &l, 0, 1, 0, 2);
+     k = transpose_step(s, k, &l, n, 1, 0, bb, d[0].b[OB], COL, r0);
+     k = local_step(s, k, &l, -1, 2, 1, 0);
+     k = transpose_step(s, k, &l, n, 2, 1, bc, d[1].b[OB], ROW, r1);
+     k = local_step(s, k, &l, -1, 0, 1, 2);
+     return k;
+}
+
+/* number of complex vn-tuples that the local I and O arrays must
+   hold, for the API's local_size functions */
+INT XM(dft_rank3_pencil_local_size)(const dtensor *sz, unsigned flags,
+				    int my_pe)
+{
+     step s[MAXSTEPS];
+     INT N = 0;
+     int i, k;
+
+     k = mksteps(sz, flags, my_pe, s);
+     for (i = 0; i < k; ++i)
+	  N = X(imax)(N, X(imax)(layout_sz(&s[i].in),
+				 layout_sz(&s[i].out)));
+     return N;
+}
+
+static int applicable(const problem *p_, const planner *plnr)
+{
+     const problem_mpi_dft *p = (const problem_mpi_dft *) p_;
+     const ddim *d;
+     INT p0, p1, nb0, nb1;
+
+     UNUSED(plnr);
+     if (!(1
+	   && p->sz->rnk == 3
+	   && (p->flags == 0
+	       || p->flags == ROTATED_IN || p->flags == ROTATED_OUT)))
+	  return 0;
+
+     d = p->sz->dims;
+     grid(p->sz, p->flags, &p0, &p1);
+
+     if (p->flags & ROTATED_IN) {
+	  if (XM(num_blocks)(d[0].n, d[0].b[IB]) != 1
+	      || XM(num_blocks)(d[2].n, d[2].b[OB]) != 1)
+	       return 0;
+	  nb0 = XM(num_blocks)(d[0].n, d[0].b[OB]);
+	  nb1 = XM(num_blocks)(d[1].n, d[1].b[OB]);
+     } else if (p->flags & ROTATED_OUT) {
+	  if (XM(num_blocks)(d[2].n, d[2].b[IB]) != 1
+	      || XM(num_blocks)(d[0].n, d[0].b[OB]) != 1)
+	       return 0;
+	  nb0 = XM(num_blocks)(d[1].n, d[1].b[OB]);
+	  nb1 = XM(num_blocks)(d[2].n, d[2].b[OB]);
+     } else {
+	  if (p1 == 1) /* slab decomposition: use dft-rank-geq2 */
+	       return 0;
+	  if (XM(num_blocks)(d[2].n, d[2].b[IB]) != 1
+	      || XM(num_blocks)(d[2].n, d[2].b[OB]) != 1)
+	       return 0;
+	  nb0 = XM(num_blocks)(d[0].n, d[0].b[OB]);
+	  nb1 = XM(num_blocks)(d[1].n, d[1].b[OB]);
+     }
+
+     /* the output must be distributed over the same grid, so that the
+	last transposes deliver each block to its owner */
+     return nb0 <= p0 && nb1 <= p1 && (nb0 == 1 || nb1 == p1);
+}
+
+static plan *mkcld(planner *plnr, const problem_mpi_dft *p, const step *s,
+		   R *I, R *O, const MPI_Comm *comm)
+{
+     const layout *li = &s->in, *lo = &s->out;
+     INT vn = p->vn;
+     R *ri, *ii, *ro, *io;
+     int d, e0, e1;
+
+     switch (s->kind) {
+	 case TRANSPOSE:
+	      return X(mkplan_d)(plnr, XM(mkproblem_transpose)(
+					p->sz->dims[s->x].n,
+					p->sz->dims[s->y].n,
+					2 * vn * li->n[li->ord[2]],
+					I, O, s->bx, s->by,
+					comm[s->comm], 0));
+	 case LOCAL_COPY:
+	      return X(mkplan_d)(plnr, X(mkproblem_rdft_0_d)(
+					X(mktensor_4d)(
+					     li->n[0], stride(li, 0, vn),
+					     stride(lo, 0, vn),
+					     li->n[1], stride(li, 1, vn),
+					     stride(lo, 1, vn),
+					     li->n[2], stride(li, 2, vn),
+					     stride(lo, 2, vn),
+					     2 * vn, 1, 1),
+					I, O));
+	 default:
+	      d = s->d;
+	      e0 = (d + 1) % 3;
+	      e1 = (d + 2) % 3;
+	      X(extract_reim)(p->sign, I, &ri, &ii);
+	      X(extract_reim)(p->sign, O, &ro, &io);
+	      return X(mkplan_d)(plnr, X(mkproblem_dft_d)(
+					X(mktensor_1d)(li->n[d],
+						       stride(li, d, vn),
+						       stride(lo, d, vn)),
+					X(mktensor_3d)(li->n[e0],
+						       stride(li, e0, vn),
+						       stride(lo, e0, vn),
+						       li->n[e1],
+						       stride(li, e1, vn),
+						       stride(lo, e1, vn),
+						       vn, 2, 2),
+					ri, ii, ro, io));
+     }
+}
+
+/* TRUE if step s has nothing to do on this process */
+static int empty_step(const step *s)
+{
+     if (s->kind == TRANSPOSE)
+	  /* same for all processes of the communicator */
+	  return s->in.n[s->in.ord[2]] == 0;
+     return layout_sz(&s->in) == 0;
+}
+
+static plan *mkplan(const solver *ego, const problem *p_, planner *plnr)
+{
+     const problem_mpi_dft *p;
+     P *pln;
+     step s[MAXSTEPS];
+     plan *cld[MAXSTEPS];
+     int rd[MAXSTEPS], wr[MAXSTEPS];
+     R *buf[3], *ri, *ii;
+     MPI_Comm comm[2];
+     INT p0, p1, nbuf;
+     int i, k, my_pe, idle, destroy_input, inplace, nout, tmp, cur;
+     static const plan_adt padt = {
+          XM(dft_solve), awake, print, destroy
+     };
+
+     UNUSED(ego);
+
+     if (!applicable(p_, plnr))
+          return (plan *) 0;
+
+     p = (const problem_mpi_dft *) p_;
+     MPI_Comm_rank(p->comm, &my_pe);
+     grid(p->sz, p->flags, &p0, &p1);
+     idle = my_pe >= p0 * p1;
+     k = mksteps(p->sz, p->flags, my_pe, s);
+
+     /* Local steps permute the array and run out of place, alternating
+	between O and a temporary buffer, which is I if the input may be
+	destroyed and scratch space otherwise.  If needed, the first
+	transpose runs in place so that the last step writes O. */
+     destroy_input = p->I != p->O && !NO_DESTROY_INPUTP(plnr);
+     tmp = destroy_input ? 0 : 2;
+     nout = k;
+     inplace = -1;
+     if ((destroy_input && k % 2 == 0) || (p->I == p->O && k % 2 == 1)) {
+	  for (inplace = 0; s[inplace].kind != TRANSPOSE; ++inplace)
+	       ;
+	  --nout;
+     }
+     for (cur = 0, i = 0; i < k; ++i) {
+	  rd[i] = cur;
+	  if (i != inplace)
+	       cur = (nout-- % 2) ? 1 : tmp;
+	  wr[i] = cur;
+     }
+     A(cur == 1);
+
+     nbuf = 0;
+     if (tmp == 2 && !idle)
+	  for (i = 0; i < k; ++i)
+	       nbuf = X(imax)(nbuf, 2 * p->vn *
+			      X(imax)(layout_sz(&s[i].in),
+				      layout_sz(&s[i].out)));
+
+     MPI_Comm_split(p->comm, idle ? MPI_UNDEFINED : my_pe / p1,
+		    my_pe % p1, &comm[ROW]);
+     MPI_Comm_split(p->comm, idle ? MPI_UNDEFINED : my_pe % p1,
+		    my_pe / p1, &comm[COL]);
+
+     buf[0] = p->I;
+     buf[1] = p->O;
+     buf[2] = nbuf ? (R *) MALLOC(sizeof(R) * nbuf, BUFFERS) : 0;
+     for (i = 0; i < k; ++i)
+	  cld[i] = 0;
+     for (i = 0; i < k; ++i) {
+	  int needed = !idle && !empty_step(s + i);
+	  if (needed)
+	       cld[i] = mkcld(plnr, p, s + i, buf[rd[i]], buf[wr[i]], comm);
+	  if (XM(any_true)(needed && !cld[i], p->comm)) goto nada;
+     }
+     X(ifree0)(buf[2]);
+     if (!idle) {
+	  MPI_Comm_free(&comm[ROW]);
+	  MPI_Comm_free(&comm[COL]);
+     }
+
+     pln = MKPLAN_MPI_DFT(P, &padt, apply);
+     X(ops_zero)(&pln->super.super.ops);
+     for (i = 0; i < k; ++i) {
+	  pln->cld[i] = cld[i];
+	  pln->kind[i] = s[i].kind;
+	  pln->rd[i] = rd[i];
+	  pln->wr[i] = wr[i];
+	  if (cld[i])
+	       X(ops_add2)(&cld[i]->ops, &pln->super.super.ops);
+     }
+     pln->nsteps = k;
+     pln->p0 = p0;
+     pln->p1 = p1;
+     pln->nbuf = nbuf;
+     X(extract_reim)(p->sign, p->I, &ri, &ii);
+     pln->roff = ri - p->I;
+     pln->ioff = ii - p->I;
+
+     return &(pln->super.super);
+
+ nada:
+     X(ifree0)(buf[2]);
+     if (!idle) {
+	  MPI_Comm_free(&comm[ROW]);
+	  MPI_Comm_free(&comm[COL]);
+     }
+     for (i = k - 1; i >= 0; --i)
+	  X(plan_destroy_internal)(cld[i]);
+     return (plan *) 0;
+}
+
+static solver *mksolver(void)
+{
+     static const solver_adt sadt = { PROBLEM_MPI_DFT, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     return &(slv->super);
+}
+
+void XM(dft_rank3_pencil_register)(planner *p)
+{
+     REGISTER_SOLVER(p, mksolver());
+}
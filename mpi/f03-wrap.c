@@ -13,6 +13,8 @@ FFTW_EXTERN ptrdiff_t XM(local_size_2d_f03)(ptrdiff_t n0, ptrdiff_t n1, MPI_Fint
 FFTW_EXTERN ptrdiff_t XM(local_size_2d_transposed_f03)(ptrdiff_t n0, ptrdiff_t n1, MPI_Fint f_comm, ptrdiff_t * local_n0, ptrdiff_t * local_0_start, ptrdiff_t * local_n1, ptrdiff_t * local_1_start);
 FFTW_EXTERN ptrdiff_t XM(local_size_3d_f03)(ptrdiff_t n0, ptrdiff_t n1, ptrdiff_t n2, MPI_Fint f_comm, ptrdiff_t * local_n0, ptrdiff_t * local_0_start);
 FFTW_EXTERN ptrdiff_t XM(local_size_3d_transposed_f03)(ptrdiff_t n0, ptrdiff_t n1, ptrdiff_t n2, MPI_Fint f_comm, ptrdiff_t * local_n0, ptrdiff_t * local_0_start, ptrdiff_t * local_n1, ptrdiff_t * local_1_start);
+FFTW_EXTERN ptrdiff_t XM(local_size_many_pencil_f03)(const ptrdiff_t * n, ptrdiff_t howmany, MPI_Fint f_comm, unsigned flags, ptrdiff_t * local_n_in, ptrdiff_t * local_start_in, ptrdiff_t * local_n_out, ptrdiff_t * local_start_out);
+FFTW_EXTERN ptrdiff_t XM(local_size_pencil_f03)(ptrdiff_t n0, ptrdiff_t n1, ptrdiff_t n2, MPI_Fint f_comm, unsigned flags, ptrdiff_t * local_n_in, ptrdiff_t * local_start_in, ptrdiff_t * local_n_out, ptrdiff_t * local_start_out);
 FFTW_EXTERN X(plan) XM(plan_many_transpose_f03)(ptrdiff_t n0, ptrdiff_t n1, ptrdiff_t howmany, ptrdiff_t block0, ptrdiff_t block1, R * in, R * out, MPI_Fint f_comm, unsigned flags);
 FFTW_EXTERN X(plan) XM(plan_transpose_f03)(ptrdiff_t n0, ptrdiff_t n1, R * in, R * out, MPI_Fint f_comm, unsigned flags);
 FFTW_EXTERN X(plan) XM(plan_many_dft_f03)(int rnk, const ptrdiff_t * n, ptrdiff_t howmany, ptrdiff_t block, ptrdiff_t tblock, X(complex) * in, X(complex) * out, MPI_Fint f_comm, int sign, unsigned flags);
@@ -20,6 +22,8 @@ FFTW_EXTERN X(plan) XM(plan_dft_f03)(int rnk, const ptrdiff_t * n, X(complex) *
 FFTW_EXTERN X(plan) XM(plan_dft_1d_f03)(ptrdiff_t n0, X(complex) * in, X(complex) * out, MPI_Fint f_comm, int sign, unsigned flags);
 FFTW_EXTERN X(plan) XM(plan_dft_2d_f03)(ptrdiff_t n0, ptrdiff_t n1, X(complex) * in, X(complex) * out, MPI_Fint f_comm, int sign, unsigned flags);
 FFTW_EXTERN X(plan) XM(plan_dft_3d_f03)(ptrdiff_t n0, ptrdiff_t n1, ptrdiff_t n2, X(complex) * in, X(complex) * out, MPI_Fint f_comm, int sign, unsigned flags);
+FFTW_EXTERN X(plan) XM(plan_many_dft_pencil_f03)(const ptrdiff_t * n, ptrdiff_t howmany, X(complex) * in, X(complex) * out, MPI_Fint f_comm, int sign, unsigned flags);
+FFTW_EXTERN X(plan) XM(plan_dft_3d_pencil_f03)(ptrdiff_t n0, ptrdiff_t n1, ptrdiff_t n2, X(complex) * in, X(complex) * out, MPI_Fint f_comm, int sign, unsigned flags);
 FFTW_EXTERN X(plan) XM(plan_many_r2r_f03)(int rnk, const ptrdiff_t * n, ptrdiff_t howmany, ptrdiff_t iblock, ptrdiff_t oblock, R * in, R * out, MPI_Fint f_comm, const X(r2r_kind) * kind, unsigned flags);
 FFTW_EXTERN X(plan) XM(plan_r2r_f03)(int rnk, const ptrdiff_t * n, R * in, R * out, MPI_Fint f_comm, const X(r2r_kind) * kind, unsigned flags);
 FFTW_EXTERN X(plan) XM(plan_r2r_2d_f03)(ptrdiff_t n0, ptrdiff_t n1, R * in, R * out, MPI_Fint f_comm, X(r2r_kind) kind0, X(r2r_kind) kind1, unsigned flags);
@@ -115,6 +119,22 @@ ptrdiff_t XM(local_size_3d_transposed_f03)(ptrdiff_t n0, ptrdiff_t n1, ptrdiff_t
      return XM(local_size_3d_transposed)(n0,n1,n2,comm,local_n0,local_0_start,local_n1,local_1_start);
 }
 
+ptrdiff_t XM(local_size_many_pencil_f03)(const ptrdiff_t * n, ptrdiff_t howmany, MPI_Fint f_comm, unsigned flags, ptrdiff_t * local_n_in, ptrdiff_t * local_start_in, ptrdiff_t * local_n_out, ptrdiff_t * local_start_out)
+{
+     MPI_Comm comm;
+
+     comm = MPI_Comm_f2c(f_comm);
+     return XM(local_size_many_pencil)(n,howmany,comm,flags,local_n_in,local_start_in,local_n_out,local_start_out);
+}
+
+ptrdiff_t XM(local_size_pencil_f03)(ptrdiff_t n0, ptrdiff_t n1, ptrdiff_t n2, MPI_Fint f_comm, unsigned flags, ptrdiff_t * local_n_in, ptrdiff_t * local_start_in, ptrdiff_t * local_n_out, ptrdiff_t * local_start_out)
+{
+     MPI_Comm comm;
+
+     comm = MPI_Comm_f2c(f_comm);
+     return XM(local_size_pencil)(n0,n1,n2,comm,flags,local_n_in,local_start_in,local_n_out,local_start_out);
+}
+
 X(plan) XM(plan_many_transpose_f03)(ptrdiff_t n0, ptrdiff_t n1, ptrdiff_t howmany, ptrdiff_t block0, ptrdiff_t block1, R * in, R * out, MPI_Fint f_comm, unsigned flags)
 {
      MPI_Comm comm;
@@ -171,6 +191,22 @@ X(plan) XM(plan_dft_3d_f03)(ptrdiff_t n0, ptrdiff_t n1, ptrdiff_t n2, X(complex)
      return XM(plan_dft_3d)(n0,n1,n2,in,out,comm,sign,flags);
 }
 
+X(plan) XM(plan_many_dft_pencil_f03)(const ptrdiff_t * n, ptrdiff_t howmany, X(complex) * in, X(complex) * out, MPI_Fint f_comm, int sign, unsigned flags)
+{
+     MPI_Comm comm;
+
+     comm = MPI_Comm_f2c(f_comm);
+     return XM(plan_many_dft_pencil)(n,howmany,in,out,comm,sign,flags);
+}
+
+X(plan) XM(plan_dft_3d_pencil_f03)(ptrdiff_t n0, ptrdiff_t n1, ptrdiff_t n2, X(complex) * in, X(complex) * out, MPI_Fint f_comm, int sign, unsigned flags)
+{
+     MPI_Comm comm;
+
+     comm = MPI_Comm_f2c(f_comm);
+     return XM(plan_dft_3d_pencil)(n0,n1,n2,in,out,comm,sign,flags);
+}
+
 X(plan) XM(plan_many_r2r_f03)(int rnk, const ptrdiff_t * n, ptrdiff_t howmany, ptrdiff_t iblock, ptrdiff_t oblock, R * in, R * out, MPI_Fint f_comm, const X(r2r_kind) * kind, unsigned flags)
 {
      MPI_Comm comm;
@@ -117,6 +117,16 @@ FFTW_EXTERN ptrdiff_t XM(local_size_3d_transposed)(		\
      ptrdiff_t n0, ptrdiff_t n1, ptrdiff_t n2, MPI_Comm comm,	\
      ptrdiff_t *local_n0, ptrdiff_t *local_0_start,		\
      ptrdiff_t *local_n1, ptrdiff_t *local_1_start);		\
+FFTW_EXTERN ptrdiff_t XM(local_size_many_pencil)(		\
+     const ptrdiff_t *n, ptrdiff_t howmany, MPI_Comm comm,	\
+     unsigned flags,						\
+     ptrdiff_t *local_n_in, ptrdiff_t *local_start_in,		\
+     ptrdiff_t *local_n_out, ptrdiff_t *local_start_out);	\
+FFTW_EXTERN ptrdiff_t XM(local_size_pencil)(			\
+     ptrdiff_t n0, ptrdiff_t n1, ptrdiff_t n2, MPI_Comm comm,	\
+     unsigned flags,						\
+     ptrdiff_t *local_n_in, ptrdiff_t *local_start_in,		\
+     ptrdiff_t *local_n_out, ptrdiff_t *local_start_out);	\
 								\
 FFTW_EXTERN X(plan) XM(plan_many_transpose)			\
      (ptrdiff_t n0, ptrdiff_t n1,				\
@@ -140,6 +150,12 @@ FFTW_EXTERN X(plan) XM(plan_dft_2d)				\
      (ptrdiff_t n0, ptrdiff_t n1, C *in, C *out,		\
       MPI_Comm comm, int sign, unsigned flags);			\
 FFTW_EXTERN X(plan) XM(plan_dft_3d)				\
+     (ptrdiff_t n0, ptrdiff_t n1, ptrdiff_t n2, C *in, C *out,	\
+      MPI_Comm comm, int sign, unsigned flags);			\
+FFTW_EXTERN X(plan) XM(plan_many_dft_pencil)			\
+     (const ptrdiff_t *n, ptrdiff_t howmany, C *in, C *out,	\
+      MPI_Comm comm, int sign, unsigned flags);			\
+FFTW_EXTERN X(plan) XM(plan_dft_3d_pencil)			\
      (ptrdiff_t n0, ptrdiff_t n1, ptrdiff_t n2, C *in, C *out,	\
       MPI_Comm comm, int sign, unsigned flags);			\
 								\
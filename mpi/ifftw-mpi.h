@@ -35,6 +35,8 @@
 #define TRANSPOSED_IN (1 << 2)
 #define TRANSPOSED_OUT (1 << 3)
 #define RANK1_BIGVEC_ONLY (1 << 4) /* for rank=1, allow only bigvec solver */
+#define ROTATED_IN (1 << 5) /* rank-3 pencil layout n1 x n2 x n0 */
+#define ROTATED_OUT (1 << 6)
 
 #define ONLY_SCRAMBLEDP(flags) (!((flags) & ~(SCRAMBLED_IN|SCRAMBLED_OUT)))
 #define ONLY_TRANSPOSEDP(flags) (!((flags) & ~(TRANSPOSED_IN|TRANSPOSED_OUT)))
@@ -412,7 +412,12 @@ static FFTW(plan) mkplan_complex(bench_problem *p, unsigned flags)
 	  local_ni[i] = local_no[i] = total_ni[i];
 	  local_starti[i] = local_starto[i] = 0;
      }
-     if (rnk > 1) {
+     if (pencil && rnk == 3) {
+	  ntot = FFTW(mpi_local_size_many_pencil)
+	       (total_ni, vn, MPI_COMM_WORLD, flags,
+		local_ni, local_starti, local_no, local_starto);
+     }
+     else if (rnk > 1) {
 	  ptrdiff_t n, start, nT, startT;
 	  ntot = FFTW(mpi_local_size_many_transposed)
 	       (p->sz->rnk, total_ni, vn,
@@ -443,16 +448,33 @@ static FFTW(plan) mkplan_complex(bench_problem *p, unsigned flags)
      }
      alloc_local(ntot * 2, p->in == p->out);
 
-     pln = FFTW(mpi_plan_many_dft)(p->sz->rnk, total_ni, vn, 
-				   FFTW_MPI_DEFAULT_BLOCK,
-				   FFTW_MPI_DEFAULT_BLOCK,
-				   (FFTW(complex) *) local_in, 
-				   (FFTW(complex) *) local_out,
-				   MPI_COMM_WORLD, p->sign, flags);
+     if (pencil && rnk == 3)
+	  pln = FFTW(mpi_plan_many_dft_pencil)(total_ni, vn,
+					       (FFTW(complex) *) local_in,
+					       (FFTW(complex) *) local_out,
+					       MPI_COMM_WORLD, p->sign, flags);
+     else
+	  pln = FFTW(mpi_plan_many_dft)(p->sz->rnk, total_ni, vn, 
+					FFTW_MPI_DEFAULT_BLOCK,
+					FFTW_MPI_DEFAULT_BLOCK,
+					(FFTW(complex) *) local_in, 
+					(FFTW(complex) *) local_out,
+					MPI_COMM_WORLD, p->sign, flags);
 
      vn *= 2;
 
-     if (rnk > 1) {
+     if (pencil && rnk == 3) {
+	  /* the rotated layout is n1 x n2 x n0 */
+	  if (flags & FFTW_MPI_TRANSPOSED_IN)
+	       plan_scramble_in = mkplan_transpose_local(
+		    p->sz->dims[0].n, local_ni[1] * local_ni[2], vn,
+		    local_in, local_in);
+	  if (flags & FFTW_MPI_TRANSPOSED_OUT)
+	       plan_unscramble_out = mkplan_transpose_local(
+		    local_no[1] * local_no[2], p->sz->dims[0].n, vn,
+		    local_out, local_out);
+     }
+     else if (rnk > 1) {
 	  ptrdiff_t nrest = 1;
 	  for (i = 2; i < rnk; ++i) nrest *= p->sz->dims[i].n;
 	  if (flags & FFTW_MPI_TRANSPOSED_IN)
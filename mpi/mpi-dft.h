@@ -57,3 +57,7 @@ void XM(dft_rank_geq2_transposed_register)(planner *p);
 void XM(dft_serial_register)(planner *p);
 void XM(dft_rank1_bigvec_register)(planner *p);
 void XM(dft_rank1_register)(planner *p);
+void XM(dft_rank3_pencil_register)(planner *p);
+
+INT XM(dft_rank3_pencil_local_size)(const dtensor *sz, unsigned flags,
+				    int my_pe);
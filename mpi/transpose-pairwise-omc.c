@@ -48,11 +48,12 @@ typedef struct {
      R *send_block_bufs[2];
      MPI_Comm comm;
      int preserve_input;
+     scratch scr; /* both in-place buffers, unless AMD_MPI_MALLOC_ONCE */
 } P;
 
 static void transpose_chunks(int *sched, int n_pes, int my_pe,
                  INT *sbs, INT *sbo, INT *rbs, INT *rbo,
-                 MPI_Comm comm,
+                 MPI_Comm comm, const scratch *scr,
                  R *I, R *O, R **bufs)
 {
     if (sched) {
@@ -64,11 +65,13 @@ static void transpose_chunks(int *sched, int n_pes, int my_pe,
            //performed on one buffer, memcpy is performed on the second.
            R *buf[2];
 #if !defined(AMD_MPI_MALLOC_ONCE)
-           buf[0] = (R*) MALLOC(sizeof(R) * sbs[0], BUFFERS);
-           buf[1] = (R*) MALLOC(sizeof(R) * sbs[0], BUFFERS);
+           buf[0] = X(scratch_get)(scr);
+           buf[1] = buf[0] + sbs[0];
+           UNUSED(bufs);
 #else
            buf[0] = bufs[0];
            buf[1] = bufs[1];
+           UNUSED(scr);
 #endif
            int pe = sched[0], pe2, j=0;
            MPI_Status send_status, recv_status;
@@ -136,8 +139,7 @@ static void transpose_chunks(int *sched, int n_pes, int my_pe,
                        comm, &status);
            }
 #if !defined(AMD_MPI_MALLOC_ONCE)
-           X(ifree)(buf[0]);
-           X(ifree)(buf[1]);
+           X(scratch_put)(scr, buf[0]);
 #endif
       }
       else { /* I != O */
@@ -174,14 +176,14 @@ static void apply(const plan *ego_, R *I, R *O)
       transpose_chunks(ego->sched, ego->n_pes, ego->my_pe,
                ego->send_block_sizes, ego->send_block_offsets,
                ego->recv_block_sizes, ego->recv_block_offsets,
-               ego->comm, O, I, ego->send_block_bufs);
+               ego->comm, &ego->scr, O, I, ego->send_block_bufs);
      }
      else if (ego->preserve_input) {
       /* transpose chunks globally */
       transpose_chunks(ego->sched, ego->n_pes, ego->my_pe,
                ego->send_block_sizes, ego->send_block_offsets,
                ego->recv_block_sizes, ego->recv_block_offsets,
-               ego->comm, I, O, ego->send_block_bufs);
+               ego->comm, &ego->scr, I, O, ego->send_block_bufs);
 
       I = O;
      }
@@ -190,7 +192,7 @@ static void apply(const plan *ego_, R *I, R *O)
       transpose_chunks(ego->sched, ego->n_pes, ego->my_pe,
                ego->send_block_sizes, ego->send_block_offsets,
                ego->recv_block_sizes, ego->recv_block_offsets,
-               ego->comm, I, I, ego->send_block_bufs);
+               ego->comm, &ego->scr, I, I, ego->send_block_bufs);
      }
 
      /* transpose locally, again, to get ordinary row-major;
@@ -230,6 +232,7 @@ static void awake(plan *ego_, enum wakefulness wakefulness)
      X(plan_awake)(ego->cld2, wakefulness);
      X(plan_awake)(ego->cld2rest, wakefulness);
      X(plan_awake)(ego->cld3, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
 }
 
 static void destroy(plan *ego_)
@@ -438,6 +441,9 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      //Malloc temporary block-sized buffers for in-place transpose operation
      pln->send_block_bufs[0] = (R*) MALLOC(sizeof(R) * sbs[0], BUFFERS);
      pln->send_block_bufs[1] = (R*) MALLOC(sizeof(R) * sbs[0], BUFFERS);
+     X(scratch_init)(&pln->scr, 0);
+#else
+     X(scratch_init)(&pln->scr, sizeof(R) * 2 * sbs[0]);
 #endif
 
      X(ops_zero)(&pln->super.super.ops);
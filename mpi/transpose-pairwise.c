@@ -45,11 +45,12 @@ typedef struct {
      INT *recv_block_sizes, *recv_block_offsets;
      MPI_Comm comm;
      int preserve_input;
+     scratch scr; /* in-place buffer of send_block_sizes[0] elements */
 } P;
 
 static void transpose_chunks(int *sched, int n_pes, int my_pe,
 			     INT *sbs, INT *sbo, INT *rbs, INT *rbo,
-			     MPI_Comm comm,
+			     MPI_Comm comm, const scratch *scr,
 			     R *I, R *O)
 {
      if (sched) {
@@ -59,7 +60,7 @@ static void transpose_chunks(int *sched, int n_pes, int my_pe,
 	  /* TODO: explore non-synchronous send/recv? */
 
 	  if (I == O) {
-	       R *buf = (R*) MALLOC(sizeof(R) * sbs[0], BUFFERS);
+	       R *buf = X(scratch_get)(scr);
 	       
 	       for (i = 0; i < n_pes; ++i) {
 		    int pe = sched[i];
@@ -79,7 +80,7 @@ static void transpose_chunks(int *sched, int n_pes, int my_pe,
 		    }
 	       }
 
-	       X(ifree)(buf);
+	       X(scratch_put)(scr, buf);
 	  }
 	  else { /* I != O */
 	       for (i = 0; i < n_pes; ++i) {
@@ -115,14 +116,14 @@ static void apply(const plan *ego_, R *I, R *O)
 	  transpose_chunks(ego->sched, ego->n_pes, ego->my_pe,
 			   ego->send_block_sizes, ego->send_block_offsets,
 			   ego->recv_block_sizes, ego->recv_block_offsets,
-			   ego->comm, O, I);
+			   ego->comm, &ego->scr, O, I);
      }
      else if (ego->preserve_input) {
 	  /* transpose chunks globally */
 	  transpose_chunks(ego->sched, ego->n_pes, ego->my_pe,
 			   ego->send_block_sizes, ego->send_block_offsets,
 			   ego->recv_block_sizes, ego->recv_block_offsets,
-			   ego->comm, I, O);
+			   ego->comm, &ego->scr, I, O);
 
 	  I = O;
      }
@@ -131,7 +132,7 @@ static void apply(const plan *ego_, R *I, R *O)
 	  transpose_chunks(ego->sched, ego->n_pes, ego->my_pe,
 			   ego->send_block_sizes, ego->send_block_offsets,
 			   ego->recv_block_sizes, ego->recv_block_offsets,
-			   ego->comm, I, I);
+			   ego->comm, &ego->scr, I, I);
      }
 
      /* transpose locally, again, to get ordinary row-major;
@@ -170,6 +171,7 @@ static void awake(plan *ego_, enum wakefulness wakefulness)
      X(plan_awake)(ego->cld2, wakefulness);
      X(plan_awake)(ego->cld2rest, wakefulness);
      X(plan_awake)(ego->cld3, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
 }
 
 static void destroy(plan *ego_)
@@ -447,6 +449,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      pln->send_block_offsets = sbo;
      pln->recv_block_sizes = rbs;
      pln->recv_block_offsets = rbo;
+     X(scratch_init)(&pln->scr, sizeof(R) * sbs[0]);
 
      if (my_pe >= n_pes) {
 	  pln->sched = 0; /* this process is not doing anything */
@@ -34,6 +34,7 @@ typedef struct {
      plan *cld, *cldcpy, *cldrest;
      INT n, vl, nbuf, bufdist;
      INT ivs_by_nbuf, ovs_by_nbuf;
+     scratch scr;
 } P;
 
 /* transform a vector input with the help of bufs */
@@ -47,7 +48,7 @@ static void apply(const plan *ego_, R *I, R *O)
      INT ivs_by_nbuf = ego->ivs_by_nbuf, ovs_by_nbuf = ego->ovs_by_nbuf;
      R *bufs;
 
-     bufs = (R *)MALLOC(sizeof(R) * nbuf * ego->bufdist, BUFFERS);
+     bufs = X(scratch_get)(&ego->scr);
 
      for (i = nbuf; i <= vl; i += nbuf) {
           /* transform to bufs: */
@@ -59,7 +60,7 @@ static void apply(const plan *ego_, R *I, R *O)
 	  O += ovs_by_nbuf;
      }
 
-     X(ifree)(bufs);
+     X(scratch_put)(&ego->scr, bufs);
 
      /* Do the remaining transforms, if any: */
      cldrest = (plan_rdft *) ego->cldrest;
@@ -79,7 +80,7 @@ static void apply_hc2r(const plan *ego_, R *I, R *O)
      INT ivs_by_nbuf = ego->ivs_by_nbuf, ovs_by_nbuf = ego->ovs_by_nbuf;
      R *bufs;
 
-     bufs = (R *)MALLOC(sizeof(R) * nbuf * ego->bufdist, BUFFERS);
+     bufs = X(scratch_get)(&ego->scr);
 
      for (i = nbuf; i <= vl; i += nbuf) {
           /* copy input into bufs: */
@@ -91,7 +92,7 @@ static void apply_hc2r(const plan *ego_, R *I, R *O)
 	  O += ovs_by_nbuf;
      }
 
-     X(ifree)(bufs);
+     X(scratch_put)(&ego->scr, bufs);
 
      /* Do the remaining transforms, if any: */
      cldrest = (plan_rdft *) ego->cldrest;
@@ -106,6 +107,7 @@ static void awake(plan *ego_, enum wakefulness wakefulness)
      X(plan_awake)(ego->cld, wakefulness);
      X(plan_awake)(ego->cldcpy, wakefulness);
      X(plan_awake)(ego->cldrest, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
 }
 
 static void destroy(plan *ego_)
@@ -277,7 +279,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 	  if (!cldcpy) goto nada;
      }
 
-     /* deallocate buffers, let apply() allocate them for real */
+     /* deallocate buffers, let apply() take them from the scratch arena */
      X(ifree)(bufs);
      bufs = 0;
 
@@ -304,6 +306,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 
      pln->nbuf = nbuf;
      pln->bufdist = bufdist;
+     X(scratch_init)(&pln->scr, sizeof(R) * nbuf * bufdist);
 
      {
 	  opcnt t;
@@ -38,6 +38,7 @@ typedef struct {
      INT n, vl, nbuf, bufdist;
      INT ivs_by_nbuf, ovs_by_nbuf;
      INT ioffset, roffset;
+     scratch scr;
 } P;
 
 /* transform a vector input with the help of bufs */
@@ -48,7 +49,7 @@ static void apply_r2hc(const plan *ego_, R *r0, R *r1, R *cr, R *ci)
      plan_dft *cldcpy = (plan_dft *) ego->cldcpy;
      INT i, vl = ego->vl, nbuf = ego->nbuf;
      INT ivs_by_nbuf = ego->ivs_by_nbuf, ovs_by_nbuf = ego->ovs_by_nbuf;
-     R *bufs = (R *)MALLOC(sizeof(R) * nbuf * ego->bufdist, BUFFERS);
+     R *bufs = X(scratch_get)(&ego->scr);
      R *bufr = bufs + ego->roffset;
      R *bufi = bufs + ego->ioffset;
      plan_rdft2 *cldrest;
@@ -63,7 +64,7 @@ static void apply_r2hc(const plan *ego_, R *r0, R *r1, R *cr, R *ci)
 	  cr += ovs_by_nbuf; ci += ovs_by_nbuf;
      }
 
-     X(ifree)(bufs);
+     X(scratch_put)(&ego->scr, bufs);
 
      /* Do the remaining transforms, if any: */
      cldrest = (plan_rdft2 *) ego->cldrest;
@@ -80,7 +81,7 @@ static void apply_hc2r(const plan *ego_, R *r0, R *r1, R *cr, R *ci)
      plan_dft *cldcpy = (plan_dft *) ego->cldcpy;
      INT i, vl = ego->vl, nbuf = ego->nbuf;
      INT ivs_by_nbuf = ego->ivs_by_nbuf, ovs_by_nbuf = ego->ovs_by_nbuf;
-     R *bufs = (R *)MALLOC(sizeof(R) * nbuf * ego->bufdist, BUFFERS);
+     R *bufs = X(scratch_get)(&ego->scr);
      R *bufr = bufs + ego->roffset;
      R *bufi = bufs + ego->ioffset;
      plan_rdft2 *cldrest;
@@ -95,7 +96,7 @@ static void apply_hc2r(const plan *ego_, R *r0, R *r1, R *cr, R *ci)
 	  r0 += ovs_by_nbuf; r1 += ovs_by_nbuf;
      }
 
-     X(ifree)(bufs);
+     X(scratch_put)(&ego->scr, bufs);
 
      /* Do the remaining transforms, if any: */
      cldrest = (plan_rdft2 *) ego->cldrest;
@@ -110,6 +111,7 @@ static void awake(plan *ego_, enum wakefulness wakefulness)
      X(plan_awake)(ego->cld, wakefulness);
      X(plan_awake)(ego->cldcpy, wakefulness);
      X(plan_awake)(ego->cldrest, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
 }
 
 static void destroy(plan *ego_)
@@ -342,6 +344,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 
      pln->nbuf = nbuf;
      pln->bufdist = bufdist;
+     X(scratch_init)(&pln->scr, sizeof(R) * nbuf * bufdist);
 
      {
 	  opcnt t;
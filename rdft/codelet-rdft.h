@@ -67,6 +67,10 @@ typedef enum {
 typedef struct kr2c_desc_s kr2c_desc;
 
 typedef struct {
+     int (*okp)(
+	  const R *R0, const R *R1, const R *Cr, const R *Ci,
+	  INT rs, INT csr, INT csi, INT vl, INT ivs, INT ovs,
+	  const planner *plnr);
      rdft_kind kind;
      INT vl;
 } kr2c_genus;
@@ -152,6 +156,10 @@ extern const solvtab X(solvtab_rdft_generic_simd256);
 typedef struct kr2r_desc_s kr2r_desc;
 
 typedef struct {
+     int (*okp)(
+	  const R *I, const R *O, INT is, INT os,
+	  INT vl, INT ivs, INT ovs,
+	  const planner *plnr);
      INT vl;
 } kr2r_genus;
 
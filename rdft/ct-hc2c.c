@@ -291,6 +291,7 @@ plan *X(mkplan_hc2c)(size_t size, const plan_adt *adt, hc2capply apply)
 
      ego = (plan_hc2c *) X(mkplan)(size, adt);
      ego->apply = apply;
+     ego->super.apply_arity = 2;
 
      return &(ego->super);
 }
@@ -45,6 +45,7 @@ typedef struct {
      INT n, npad, g, ginv;
      INT is, os;
      plan *cld_omega;
+     scratch scr;
 } P;
 
 static rader_tl *omegas = 0;
@@ -70,7 +71,7 @@ static void apply(const plan *ego_, R *I, R *O)
      R *buf, *omega;
      R r0;
 
-     buf = (R *) MALLOC(sizeof(R) * npad, BUFFERS);
+     buf = X(scratch_get)(&ego->scr);
 
      /* First, permute the input, storing in buf: */
      g = ego->g; 
@@ -155,7 +156,7 @@ static void apply(const plan *ego_, R *I, R *O)
 #endif
      A(gpower == 1);
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 #ifdef AMD_FMV_AUTO
@@ -214,6 +215,7 @@ static void awake(plan *ego_, enum wakefulness wakefulness)
      X(plan_awake)(ego->cld1, wakefulness);
      X(plan_awake)(ego->cld2, wakefulness);
      X(plan_awake)(ego->cld_omega, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
 
      switch (wakefulness) {
 	 case SLEEPY:
@@ -343,7 +345,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 			       NO_SLOW, ESTIMATE, 0);
      if (!cld_omega) goto nada;
 
-     /* deallocate buffers; let awake() or apply() allocate them for real */
+     /* deallocate buffers; let apply() take them from the scratch arena */
      X(ifree)(buf);
      buf = 0;
 
@@ -356,6 +358,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      pln->npad = npad;
      pln->is = is;
      pln->os = os;
+     X(scratch_init)(&pln->scr, sizeof(R) * npad);
 
      X(ops_add)(&cld1->ops, &cld2->ops, &pln->super.super.ops);
      pln->super.super.ops.other += (npad/2-1)*6 + npad + n + (n-1) * ego->pad;
@@ -80,7 +80,8 @@ static void dobatch_r2hc(const P *ego, R *I, R *O, R *buf, INT batchsz)
 		 ego->n, ego->rs0, WS(ego->bcsr /* hack */, 1),
 		 batchsz, ego->ivs, 1, 1);
 
-     if (IABS(WS(ego->csr, 1)) < IABS(ego->ovs)) {
+     if (ego->slv->desc->genus->vl == 1
+	 && IABS(WS(ego->csr, 1)) < IABS(ego->ovs)) {
 	  /* transform directly to output */
 	  ego->k(buf, buf + WS(ego->bcsr /* hack */, 1), 
 		 O, O + ego->ioffset, 
@@ -100,7 +101,8 @@ static void dobatch_r2hc(const P *ego, R *I, R *O, R *buf, INT batchsz)
 
 static void dobatch_hc2r(const P *ego, R *I, R *O, R *buf, INT batchsz)
 {
-     if (IABS(WS(ego->csr, 1)) < IABS(ego->ivs)) {
+     if (ego->slv->desc->genus->vl == 1
+	 && IABS(WS(ego->csr, 1)) < IABS(ego->ivs)) {
 	  /* transform directly from input */
 	  ego->k(buf, buf + WS(ego->bcsr /* hack */, 1),
 		 I, I + ego->ioffset, 
@@ -187,12 +189,14 @@ static INT ioffset(rdft_kind kind, INT sz, INT s)
      return(s * ((kind == R2HC || kind == HC2R) ? sz : (sz - 1)));
 }
 
-static int applicable(const solver *ego_, const problem *p_)
+static int applicable(const solver *ego_, const problem *p_,
+		      const planner *plnr)
 {
      const S *ego = (const S *) ego_;
      const kr2c_desc *desc = ego->desc;
      const problem_rdft *p = (const problem_rdft *) p_;
-     INT vl, ivs, ovs;
+     INT vl, ivs, ovs, n, rs, cs;
+     const R *r, *c;
 
      return (
 	  1
@@ -204,6 +208,15 @@ static int applicable(const solver *ego_, const problem *p_)
 	  /* check strides etc */
 	  && X(tensor_tornk1)(p->vecsz, &vl, &ivs, &ovs)
 
+	  && (n = desc->n,
+	      R2HC_KINDP(p->kind[0]) ?
+	      (r = p->I, c = p->O,
+	       rs = p->sz->dims[0].is, cs = p->sz->dims[0].os) :
+	      (r = p->O, c = p->I,
+	       rs = p->sz->dims[0].os, cs = p->sz->dims[0].is), 1)
+	  && desc->genus->okp(r, r + rs, c, c + ioffset(p->kind[0], n, cs),
+			      2 * rs, cs, -cs, vl, ivs, ovs, plnr)
+
 	  && (0
 	      /* can operate out-of-place */
 	      || p->I != p->O
@@ -217,7 +230,8 @@ static int applicable(const solver *ego_, const problem *p_)
 	  );
 }
 
-static int applicable_buf(const solver *ego_, const problem *p_)
+static int applicable_buf(const solver *ego_, const problem *p_,
+			  const planner *plnr)
 {
      const S *ego = (const S *) ego_;
      const kr2c_desc *desc = ego->desc;
@@ -235,6 +249,16 @@ static int applicable_buf(const solver *ego_, const problem *p_)
 	  && X(tensor_tornk1)(p->vecsz, &vl, &ivs, &ovs)
 
 	  && (batchsz = compute_batchsize(desc->n), 1)
+	  && (desc->genus->okp(0, ((const R *)0) + batchsz, 0,
+			       ((const R *)0) + ioffset(p->kind[0], desc->n,
+							batchsz),
+			       2 * batchsz, batchsz, -batchsz,
+			       batchsz, 1, 1, plnr))
+	  && (desc->genus->okp(0, ((const R *)0) + batchsz, 0,
+			       ((const R *)0) + ioffset(p->kind[0], desc->n,
+							batchsz),
+			       2 * batchsz, batchsz, -batchsz,
+			       vl % batchsz, 1, 1, plnr))
 
 	  && (0
 	      /* can operate out-of-place */
@@ -262,13 +286,11 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 	  X(rdft_solve), X(null_awake), print, destroy
      };
 
-     UNUSED(plnr);
-
      if (ego->bufferedp) {
-	  if (!applicable_buf(ego_, p_))
+	  if (!applicable_buf(ego_, p_, plnr))
 	       return (plan *)0;
      } else {
-	  if (!applicable(ego_, p_))
+	  if (!applicable(ego_, p_, plnr))
 	       return (plan *)0;
      }
 
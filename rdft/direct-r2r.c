@@ -62,7 +62,8 @@ static void print(const plan *ego_, printer *p)
 	      ego->vl, s->desc->nam);
 }
 
-static int applicable(const solver *ego_, const problem *p_)
+static int applicable(const solver *ego_, const problem *p_,
+		      const planner *plnr)
 {
      const S *ego = (const S *) ego_;
      const problem_rdft *p = (const problem_rdft *) p_;
@@ -78,6 +79,8 @@ static int applicable(const solver *ego_, const problem *p_)
 
 	  /* check strides etc */
 	  && X(tensor_tornk1)(p->vecsz, &vl, &ivs, &ovs)
+	  && ego->desc->genus->okp(p->I, p->O, p->sz->dims[0].is,
+				   p->sz->dims[0].os, vl, ivs, ovs, plnr)
 
 	  && (0
 	      /* can operate out-of-place */
@@ -103,9 +106,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 	  X(rdft_solve), X(null_awake), print, destroy
      };
 
-     UNUSED(plnr);
-
-     if (!applicable(ego_, p_))
+     if (!applicable(ego_, p_, plnr))
           return (plan *)0;
 
      p = (const problem_rdft *) p_;
@@ -78,13 +78,15 @@ static void print(const plan *ego_, printer *p)
 	      ego->vl, s->desc->nam);
 }
 
-static int applicable(const solver *ego_, const problem *p_)
+static int applicable(const solver *ego_, const problem *p_,
+		      const planner *plnr)
 {
      const S *ego = (const S *) ego_;
      const kr2c_desc *desc = ego->desc;
      const problem_rdft2 *p = (const problem_rdft2 *) p_;
      INT vl;
      INT ivs, ovs;
+     int r2hc_kindp;
 
      return (
 	  1
@@ -96,6 +98,16 @@ static int applicable(const solver *ego_, const problem *p_)
 	  /* check strides etc */
 	  && X(tensor_tornk1)(p->vecsz, &vl, &ivs, &ovs)
 
+	  && (r2hc_kindp = R2HC_KINDP(p->kind), 1)
+	  && desc->genus->okp(p->r0, p->r1, p->cr, p->ci,
+			      r2hc_kindp ? p->sz->dims[0].is
+			                 : p->sz->dims[0].os,
+			      r2hc_kindp ? p->sz->dims[0].os
+			                 : p->sz->dims[0].is,
+			      r2hc_kindp ? p->sz->dims[0].os
+			                 : p->sz->dims[0].is,
+			      vl, ivs, ovs, plnr)
+
 	  && (0
 	      /* can operate out-of-place */
 	      || p->r0 != p->cr
@@ -124,9 +136,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 	  X(rdft2_solve), X(null_awake), print, destroy
      };
 
-     UNUSED(plnr);
-
-     if (!applicable(ego_, p_))
+     if (!applicable(ego_, p_, plnr))
           return (plan *)0;
 
      p = (const problem_rdft2 *) p_;
@@ -177,6 +177,13 @@ static int applicable(const S *ego, rdft_kind kind, INT r, INT m, INT v,
 				       v, m * r, r)) 
 	  return 0;
 
+     /* an unbuffered twiddle pass strides across the whole transform,
+	which is ugly if the latter does not fit in the cache share that
+	the user declared for each thread */
+     if (NO_UGLYP(plnr) && !ego->bufferedp
+	 && X(cache_oversubscribedp)(m * r * (INT)sizeof(R)))
+	  return 0;
+
      return 1;
 }
 
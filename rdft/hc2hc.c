@@ -209,6 +209,7 @@ plan *X(mkplan_hc2hc)(size_t size, const plan_adt *adt, hc2hcapply apply)
 
      ego = (plan_hc2hc *) X(mkplan)(size, adt);
      ego->apply = apply;
+     ego->super.apply_arity = 1;
 
      return &(ego->super);
 }
@@ -27,6 +27,7 @@ plan *X(mkplan_rdft)(size_t size, const plan_adt *adt, rdftapply apply)
 
      ego = (plan_rdft *) X(mkplan)(size, adt);
      ego->apply = apply;
+     ego->super.apply_arity = 2;
 
      return &(ego->super);
 }
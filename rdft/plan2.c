@@ -27,6 +27,7 @@ plan *X(mkplan_rdft2)(size_t size, const plan_adt *adt, rdft2apply apply)
 
      ego = (plan_rdft2 *) X(mkplan)(size, adt);
      ego->apply = apply;
+     ego->super.apply_arity = 4;
 
      return &(ego->super);
 }
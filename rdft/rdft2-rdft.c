@@ -32,6 +32,7 @@ typedef struct {
      plan *cld, *cldrest;
      INT n, vl, nbuf, bufdist;
      INT cs, ivs, ovs;
+     scratch scr;
 } P;
 
 /***************************************************************************/
@@ -89,7 +90,7 @@ static void apply_r2hc(const plan *ego_, R *r0, R *r1, R *cr, R *ci)
      INT i, j, vl = ego->vl, nbuf = ego->nbuf, bufdist = ego->bufdist;
      INT n = ego->n;
      INT ivs = ego->ivs, ovs = ego->ovs, os = ego->cs;
-     R *bufs = (R *)MALLOC(sizeof(R) * nbuf * bufdist, BUFFERS);
+     R *bufs = X(scratch_get)(&ego->scr);
      plan_rdft2 *cldrest;
 
      for (i = nbuf; i <= vl; i += nbuf) {
@@ -102,7 +103,7 @@ static void apply_r2hc(const plan *ego_, R *r0, R *r1, R *cr, R *ci)
 	       hc2c(n, bufs + j*bufdist, cr, ci, os);
      }
 
-     X(ifree)(bufs);
+     X(scratch_put)(&ego->scr, bufs);
 
      /* Do the remaining transforms, if any: */
      cldrest = (plan_rdft2 *) ego->cldrest;
@@ -116,7 +117,7 @@ static void apply_hc2r(const plan *ego_, R *r0, R *r1, R *cr, R *ci)
      INT i, j, vl = ego->vl, nbuf = ego->nbuf, bufdist = ego->bufdist;
      INT n = ego->n;
      INT ivs = ego->ivs, ovs = ego->ovs, is = ego->cs;
-     R *bufs = (R *)MALLOC(sizeof(R) * nbuf * bufdist, BUFFERS);
+     R *bufs = X(scratch_get)(&ego->scr);
      plan_rdft2 *cldrest;
 
      for (i = nbuf; i <= vl; i += nbuf) {
@@ -129,7 +130,7 @@ static void apply_hc2r(const plan *ego_, R *r0, R *r1, R *cr, R *ci)
 	  r0 += ovs * nbuf; r1 += ovs * nbuf;
      }
 
-     X(ifree)(bufs);
+     X(scratch_put)(&ego->scr, bufs);
 
      /* Do the remaining transforms, if any: */
      cldrest = (plan_rdft2 *) ego->cldrest;
@@ -142,6 +143,7 @@ static void awake(plan *ego_, enum wakefulness wakefulness)
 
      X(plan_awake)(ego->cld, wakefulness);
      X(plan_awake)(ego->cldrest, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
 }
 
 static void destroy(plan *ego_)
@@ -308,6 +310,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      X(rdft2_strides)(p->kind, &p->sz->dims[0], &rs, &pln->cs);
      pln->nbuf = nbuf;
      pln->bufdist = bufdist;
+     X(scratch_init)(&pln->scr, sizeof(R) * nbuf * bufdist);
 
      X(ops_madd)(vl / nbuf, &cld->ops, &cldrest->ops,
 		 &pln->super.super.ops);
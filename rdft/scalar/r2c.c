@@ -20,18 +20,28 @@
 
 #include "rdft/codelet-rdft.h"
 
+static int okp(const R *R0, const R *R1, const R *Cr, const R *Ci,
+	       INT rs, INT csr, INT csi, INT vl, INT ivs, INT ovs,
+	       const planner *plnr)
+{
+     UNUSED(R0); UNUSED(R1); UNUSED(Cr); UNUSED(Ci);
+     UNUSED(rs); UNUSED(csr); UNUSED(csi);
+     UNUSED(vl); UNUSED(ivs); UNUSED(ovs); UNUSED(plnr);
+     return 1;
+}
+
 #include "rdft/scalar/r2cf.h"
-const kr2c_genus GENUS = { R2HC, 1 };
+const kr2c_genus GENUS = { okp, R2HC, 1 };
 #undef GENUS
 
 #include "rdft/scalar/r2cfII.h"
-const kr2c_genus GENUS = { R2HCII, 1 };
+const kr2c_genus GENUS = { okp, R2HCII, 1 };
 #undef GENUS
 
 #include "rdft/scalar/r2cb.h"
-const kr2c_genus GENUS = { HC2R, 1 };
+const kr2c_genus GENUS = { okp, HC2R, 1 };
 #undef GENUS
 
 #include "rdft/scalar/r2cbIII.h"
-const kr2c_genus GENUS = { HC2RIII, 1 };
+const kr2c_genus GENUS = { okp, HC2RIII, 1 };
 #undef GENUS
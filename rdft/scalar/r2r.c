@@ -21,4 +21,12 @@
 #include "rdft/codelet-rdft.h"
 #include "rdft/scalar/r2r.h"
 
-const kr2r_genus GENUS = { 1 };
+static int okp(const R *I, const R *O, INT is, INT os,
+	       INT vl, INT ivs, INT ovs, const planner *plnr)
+{
+     UNUSED(I); UNUSED(O); UNUSED(is); UNUSED(os);
+     UNUSED(vl); UNUSED(ivs); UNUSED(ovs); UNUSED(plnr);
+     return 1;
+}
+
+const kr2r_genus GENUS = { okp, 1 };
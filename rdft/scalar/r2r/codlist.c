@@ -1,13 +1,109 @@
 #include "kernel/ifftw.h"
 
 
+extern void X(codelet_e00_5)(planner *);
+extern void X(codelet_e00_9)(planner *);
+extern void X(codelet_e00_17)(planner *);
+extern void X(codelet_e00_33)(planner *);
+extern void X(codelet_e01_4)(planner *);
+extern void X(codelet_e01_6)(planner *);
 extern void X(codelet_e01_8)(planner *);
+extern void X(codelet_e01_12)(planner *);
+extern void X(codelet_e01_16)(planner *);
+extern void X(codelet_e01_32)(planner *);
+extern void X(codelet_e01_64)(planner *);
+extern void X(codelet_e10_4)(planner *);
+extern void X(codelet_e10_6)(planner *);
 extern void X(codelet_e10_8)(planner *);
+extern void X(codelet_e10_12)(planner *);
+extern void X(codelet_e10_16)(planner *);
+extern void X(codelet_e10_32)(planner *);
+extern void X(codelet_e10_64)(planner *);
+extern void X(codelet_e11_4)(planner *);
+extern void X(codelet_e11_6)(planner *);
+extern void X(codelet_e11_8)(planner *);
+extern void X(codelet_e11_12)(planner *);
+extern void X(codelet_e11_16)(planner *);
+extern void X(codelet_e11_32)(planner *);
+extern void X(codelet_e11_64)(planner *);
+extern void X(codelet_o00_3)(planner *);
+extern void X(codelet_o00_7)(planner *);
+extern void X(codelet_o00_15)(planner *);
+extern void X(codelet_o00_31)(planner *);
+extern void X(codelet_o01_4)(planner *);
+extern void X(codelet_o01_6)(planner *);
+extern void X(codelet_o01_8)(planner *);
+extern void X(codelet_o01_12)(planner *);
+extern void X(codelet_o01_16)(planner *);
+extern void X(codelet_o01_32)(planner *);
+extern void X(codelet_o01_64)(planner *);
+extern void X(codelet_o10_4)(planner *);
+extern void X(codelet_o10_6)(planner *);
+extern void X(codelet_o10_8)(planner *);
+extern void X(codelet_o10_12)(planner *);
+extern void X(codelet_o10_16)(planner *);
+extern void X(codelet_o10_32)(planner *);
+extern void X(codelet_o10_64)(planner *);
+extern void X(codelet_o11_4)(planner *);
+extern void X(codelet_o11_6)(planner *);
+extern void X(codelet_o11_8)(planner *);
+extern void X(codelet_o11_12)(planner *);
+extern void X(codelet_o11_16)(planner *);
+extern void X(codelet_o11_32)(planner *);
+extern void X(codelet_o11_64)(planner *);
 
 
 extern const solvtab X(solvtab_rdft_r2r);
 const solvtab X(solvtab_rdft_r2r) = {
+   SOLVTAB(X(codelet_e00_5)),
+   SOLVTAB(X(codelet_e00_9)),
+   SOLVTAB(X(codelet_e00_17)),
+   SOLVTAB(X(codelet_e00_33)),
+   SOLVTAB(X(codelet_e01_4)),
+   SOLVTAB(X(codelet_e01_6)),
    SOLVTAB(X(codelet_e01_8)),
+   SOLVTAB(X(codelet_e01_12)),
+   SOLVTAB(X(codelet_e01_16)),
+   SOLVTAB(X(codelet_e01_32)),
+   SOLVTAB(X(codelet_e01_64)),
+   SOLVTAB(X(codelet_e10_4)),
+   SOLVTAB(X(codelet_e10_6)),
    SOLVTAB(X(codelet_e10_8)),
+   SOLVTAB(X(codelet_e10_12)),
+   SOLVTAB(X(codelet_e10_16)),
+   SOLVTAB(X(codelet_e10_32)),
+   SOLVTAB(X(codelet_e10_64)),
+   SOLVTAB(X(codelet_e11_4)),
+   SOLVTAB(X(codelet_e11_6)),
+   SOLVTAB(X(codelet_e11_8)),
+   SOLVTAB(X(codelet_e11_12)),
+   SOLVTAB(X(codelet_e11_16)),
+   SOLVTAB(X(codelet_e11_32)),
+   SOLVTAB(X(codelet_e11_64)),
+   SOLVTAB(X(codelet_o00_3)),
+   SOLVTAB(X(codelet_o00_7)),
+   SOLVTAB(X(codelet_o00_15)),
+   SOLVTAB(X(codelet_o00_31)),
+   SOLVTAB(X(codelet_o01_4)),
+   SOLVTAB(X(codelet_o01_6)),
+   SOLVTAB(X(codelet_o01_8)),
+   SOLVTAB(X(codelet_o01_12)),
+   SOLVTAB(X(codelet_o01_16)),
+   SOLVTAB(X(codelet_o01_32)),
+   SOLVTAB(X(codelet_o01_64)),
+   SOLVTAB(X(codelet_o10_4)),
+   SOLVTAB(X(codelet_o10_6)),
+   SOLVTAB(X(codelet_o10_8)),
+   SOLVTAB(X(codelet_o10_12)),
+   SOLVTAB(X(codelet_o10_16)),
+   SOLVTAB(X(codelet_o10_32)),
+   SOLVTAB(X(codelet_o10_64)),
+   SOLVTAB(X(codelet_o11_4)),
+   SOLVTAB(X(codelet_o11_6)),
+   SOLVTAB(X(codelet_o11_8)),
+   SOLVTAB(X(codelet_o11_12)),
+   SOLVTAB(X(codelet_o11_16)),
+   SOLVTAB(X(codelet_o11_32)),
+   SOLVTAB(X(codelet_o11_64)),
    SOLVTAB_END
 };
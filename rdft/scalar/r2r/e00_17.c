@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft00 -n 17 -name e00_17 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 76 FP additions, 34 FP multiplications,
+ * (or, 50 additions, 8 multiplications, 26 fused multiply/add),
+ * 60 stack variables, 9 constants, and 34 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e00_17(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(34, is), MAKE_VOLATILE_STRIDE(34, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = T1 + Th;
+	       Tj = FMA(KP2_000000000, T9, Ti);
+	       Tk = FMA(KP2_000000000, T5 + Td, Tj);
+	       Tl = T3 + Tf;
+	       Tm = T7 + Tb;
+	       Tn = FMA(KP2_000000000, Tl + Tm, Tk);
+	       To = T2 + Tg;
+	       Tp = T8 + Ta;
+	       Tq = To + Tp;
+	       Tr = T4 + Te;
+	       Ts = T6 + Tc;
+	       Tt = Tr + Ts;
+	       O[0] = FMA(KP2_000000000, Tq + Tt, Tn);
+	       Tu = T4 - Te;
+	       Tv = T6 - Tc;
+	       Tw = FMA(KP1_111140466, Tv, KP1_662939224 * Tu);
+	       Tx = T2 - Tg;
+	       Ty = T8 - Ta;
+	       Tz = FMA(KP390180644, Ty, KP1_961570560 * Tx);
+	       TA = Tw + Tz;
+	       TB = T3 - Tf;
+	       TC = T7 - Tb;
+	       TD = FMA(KP765366864, TC, KP1_847759065 * TB);
+	       TE = T1 - Th;
+	       TF = FMA(KP1_414213562, T5 - Td, TE);
+	       TG = TD + TF;
+	       O[WS(os, 1)] = TA + TG;
+	       TH = To - Tp;
+	       TI = Tr - Ts;
+	       TJ = FMA(KP765366864, TI, KP1_847759065 * TH);
+	       TK = FNMS(KP2_000000000, T9, Ti);
+	       TL = FMA(KP1_414213562, Tl - Tm, TK);
+	       O[WS(os, 2)] = TJ + TL;
+	       TM = FNMS(KP1_414213562, T5 - Td, TE);
+	       TN = FMS(KP1_847759065, TC, KP765366864 * TB);
+	       TO = TM - TN;
+	       TP = FMS(KP1_662939224, Tv, KP1_111140466 * Tu);
+	       TQ = FMS(KP1_961570560, Ty, KP390180644 * Tx);
+	       TR = TP + TQ;
+	       TS = Tw - Tz;
+	       O[WS(os, 3)] = FNMS(KP707106781, TR + TS, TO);
+	       TT = FNMS(KP2_000000000, T5 + Td, Tj);
+	       O[WS(os, 4)] = FMA(KP1_414213562, Tq - Tt, TT);
+	       TU = TN + TM;
+	       O[WS(os, 5)] = FMA(KP707106781, TR - TS, TU);
+	       TV = FNMS(KP1_414213562, Tl - Tm, TK);
+	       TW = FMS(KP1_847759065, TI, KP765366864 * TH);
+	       O[WS(os, 6)] = TV - TW;
+	       TX = TP - TQ;
+	       TY = TF - TD;
+	       O[WS(os, 7)] = TX + TY;
+	       O[WS(os, 8)] = FNMS(KP2_000000000, Tl + Tm, Tk);
+	       O[WS(os, 9)] = TY - TX;
+	       O[WS(os, 10)] = TW + TV;
+	       O[WS(os, 11)] = FNMS(KP707106781, TR - TS, TU);
+	       O[WS(os, 12)] = FNMS(KP1_414213562, Tq - Tt, TT);
+	       O[WS(os, 13)] = FMA(KP707106781, TR + TS, TO);
+	       O[WS(os, 14)] = TL - TJ;
+	       O[WS(os, 15)] = TG - TA;
+	       O[WS(os, 16)] = FNMS(KP2_000000000, Tq + Tt, Tn);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 17, "e00_17", {50, 8, 26, 0}, &GENUS, REDFT00 };
+
+void X(codelet_e00_17) (planner *p) {
+     X(kr2r_register) (p, e00_17, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft00 -n 17 -name e00_17 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 68 FP additions, 25 FP multiplications,
+ * (or, 68 additions, 25 multiplications, 0 fused multiply/add),
+ * 69 stack variables, 9 constants, and 34 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e00_17(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(34, is), MAKE_VOLATILE_STRIDE(34, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = T1 + Th;
+	       Tj = KP2_000000000 * T9;
+	       Tk = Ti + Tj;
+	       Tl = KP2_000000000 * (T5 + Td);
+	       Tm = Tk + Tl;
+	       Tn = T3 + Tf;
+	       To = T7 + Tb;
+	       Tp = KP2_000000000 * (Tn + To);
+	       Tq = Tm + Tp;
+	       Tr = T2 + Tg;
+	       Ts = T8 + Ta;
+	       Tt = Tr + Ts;
+	       Tu = T4 + Te;
+	       Tv = T6 + Tc;
+	       Tw = Tu + Tv;
+	       Tx = KP2_000000000 * (Tt + Tw);
+	       O[0] = Tq + Tx;
+	       Ty = T6 - Tc;
+	       Tz = T4 - Te;
+	       TA = KP1_111140466 * Ty + KP1_662939224 * Tz;
+	       TB = T8 - Ta;
+	       TC = T2 - Tg;
+	       TD = KP390180644 * TB + KP1_961570560 * TC;
+	       TE = TA + TD;
+	       TF = T7 - Tb;
+	       TG = T3 - Tf;
+	       TH = KP765366864 * TF + KP1_847759065 * TG;
+	       TI = T1 - Th;
+	       TJ = KP1_414213562 * (T5 - Td);
+	       TK = TI + TJ;
+	       TL = TH + TK;
+	       O[WS(os, 1)] = TE + TL;
+	       TM = Tu - Tv;
+	       TN = Tr - Ts;
+	       TO = KP765366864 * TM + KP1_847759065 * TN;
+	       TP = Ti - Tj;
+	       TQ = KP1_414213562 * (Tn - To);
+	       TR = TP + TQ;
+	       O[WS(os, 2)] = TO + TR;
+	       TS = TI - TJ;
+	       TT = KP1_847759065 * TF - KP765366864 * TG;
+	       TU = TS - TT;
+	       TV = KP1_662939224 * Ty - KP1_111140466 * Tz;
+	       TW = KP1_961570560 * TB - KP390180644 * TC;
+	       TX = TV + TW;
+	       TY = TA - TD;
+	       TZ = KP707106781 * (TX + TY);
+	       O[WS(os, 3)] = TU - TZ;
+	       T10 = Tk - Tl;
+	       T11 = KP1_414213562 * (Tt - Tw);
+	       O[WS(os, 4)] = T10 + T11;
+	       T12 = KP707106781 * (TX - TY);
+	       T13 = TT + TS;
+	       O[WS(os, 5)] = T12 + T13;
+	       T14 = TP - TQ;
+	       T15 = KP1_847759065 * TM - KP765366864 * TN;
+	       O[WS(os, 6)] = T14 - T15;
+	       T16 = TV - TW;
+	       T17 = TK - TH;
+	       O[WS(os, 7)] = T16 + T17;
+	       O[WS(os, 8)] = Tm - Tp;
+	       O[WS(os, 9)] = T17 - T16;
+	       O[WS(os, 10)] = T15 + T14;
+	       O[WS(os, 11)] = T13 - T12;
+	       O[WS(os, 12)] = T10 - T11;
+	       O[WS(os, 13)] = TZ + TU;
+	       O[WS(os, 14)] = TR - TO;
+	       O[WS(os, 15)] = TL - TE;
+	       O[WS(os, 16)] = Tq - Tx;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 17, "e00_17", {68, 25, 0, 0}, &GENUS, REDFT00 };
+
+void X(codelet_e00_17) (planner *p) {
+     X(kr2r_register) (p, e00_17, &desc);
+}
+
+#endif
@@ -0,0 +1,545 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft00 -n 33 -name e00_33 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 186 FP additions, 82 FP multiplications,
+ * (or, 130 additions, 26 multiplications, 56 fused multiply/add),
+ * 158 stack variables, 19 constants, and 66 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e00_33(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(66, is), MAKE_VOLATILE_STRIDE(66, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = I[WS(is, 32)];
+	       Ty = T1 + Tx;
+	       Tz = FMA(KP2_000000000, Th, Ty);
+	       TA = FMA(KP2_000000000, T9 + Tp, Tz);
+	       TB = T5 + Tt;
+	       TC = Td + Tl;
+	       TD = FMA(KP2_000000000, TB + TC, TA);
+	       TE = T3 + Tv;
+	       TF = Tf + Tj;
+	       TG = TE + TF;
+	       TH = T7 + Tr;
+	       TI = Tb + Tn;
+	       TJ = TH + TI;
+	       TK = FMA(KP2_000000000, TG + TJ, TD);
+	       TL = T2 + Tw;
+	       TM = Tg + Ti;
+	       TN = TL + TM;
+	       TO = T8 + Tq;
+	       TP = Ta + To;
+	       TQ = TO + TP;
+	       TR = TN + TQ;
+	       TS = T4 + Tu;
+	       TT = Te + Tk;
+	       TU = TS + TT;
+	       TV = T6 + Ts;
+	       TW = Tc + Tm;
+	       TX = TV + TW;
+	       TY = TU + TX;
+	       O[0] = FMA(KP2_000000000, TR + TY, TK);
+	       TZ = T6 - Ts;
+	       T10 = Tc - Tm;
+	       T11 = FMA(KP942793473, T10, KP1_763842528 * TZ);
+	       T12 = T4 - Tu;
+	       T13 = Te - Tk;
+	       T14 = FMA(KP580569354, T13, KP1_913880671 * T12);
+	       T15 = T11 + T14;
+	       T16 = T8 - Tq;
+	       T17 = Ta - To;
+	       T18 = FMA(KP1_268786568, T17, KP1_546020906 * T16);
+	       T19 = T2 - Tw;
+	       T1a = Tg - Ti;
+	       T1b = FMA(KP196034280, T1a, KP1_990369453 * T19);
+	       T1c = T18 + T1b;
+	       T1d = T15 + T1c;
+	       T1e = T7 - Tr;
+	       T1f = Tb - Tn;
+	       T1g = FMA(KP1_111140466, T1f, KP1_662939224 * T1e);
+	       T1h = T3 - Tv;
+	       T1i = Tf - Tj;
+	       T1j = FMA(KP390180644, T1i, KP1_961570560 * T1h);
+	       T1k = T1g + T1j;
+	       T1l = T5 - Tt;
+	       T1m = Td - Tl;
+	       T1n = FMA(KP765366864, T1m, KP1_847759065 * T1l);
+	       T1o = T1 - Tx;
+	       T1p = FMA(KP1_414213562, T9 - Tp, T1o);
+	       T1q = T1n + T1p;
+	       T1r = T1k + T1q;
+	       O[WS(os, 1)] = T1d + T1r;
+	       T1s = TS - TT;
+	       T1t = TV - TW;
+	       T1u = FMA(KP1_111140466, T1t, KP1_662939224 * T1s);
+	       T1v = TL - TM;
+	       T1w = TO - TP;
+	       T1x = FMA(KP390180644, T1w, KP1_961570560 * T1v);
+	       T1y = T1u + T1x;
+	       T1z = TE - TF;
+	       T1A = TH - TI;
+	       T1B = FMA(KP765366864, T1A, KP1_847759065 * T1z);
+	       T1C = FNMS(KP2_000000000, Th, Ty);
+	       T1D = FMA(KP1_414213562, TB - TC, T1C);
+	       T1E = T1B + T1D;
+	       O[WS(os, 2)] = T1y + T1E;
+	       T1F = FNMS(KP1_414213562, T9 - Tp, T1o);
+	       T1G = FMS(KP1_847759065, T1m, KP765366864 * T1l);
+	       T1H = T1F - T1G;
+	       T1I = FMS(KP1_662939224, T1f, KP1_111140466 * T1e);
+	       T1J = FMS(KP1_961570560, T1i, KP390180644 * T1h);
+	       T1K = T1I + T1J;
+	       T1L = T1g - T1j;
+	       T1M = FNMS(KP707106781, T1K + T1L, T1H);
+	       T1N = T1b - T18;
+	       T1O = FMS(KP1_763842528, T10, KP942793473 * TZ);
+	       T1P = FMS(KP1_913880671, T13, KP580569354 * T12);
+	       T1Q = T1O + T1P;
+	       T1R = T1N - T1Q;
+	       T1S = T11 - T14;
+	       T1T = FMS(KP1_546020906, T17, KP1_268786568 * T16);
+	       T1U = FMS(KP1_990369453, T1a, KP196034280 * T19);
+	       T1V = T1T + T1U;
+	       T1W = T1S + T1V;
+	       T1X = FMS(KP382683432, T1W, KP923879532 * T1R);
+	       O[WS(os, 3)] = T1M - T1X;
+	       T1Y = TN - TQ;
+	       T1Z = TU - TX;
+	       T20 = FMA(KP765366864, T1Z, KP1_847759065 * T1Y);
+	       T21 = FNMS(KP2_000000000, T9 + Tp, Tz);
+	       T22 = FMA(KP1_414213562, TG - TJ, T21);
+	       O[WS(os, 4)] = T20 + T22;
+	       T23 = T1G + T1F;
+	       T24 = FMA(KP707106781, T1K - T1L, T23);
+	       T25 = T1Q + T1N;
+	       T26 = T1S - T1V;
+	       T27 = FMS(KP382683432, T26, KP923879532 * T25);
+	       O[WS(os, 5)] = T24 - T27;
+	       T28 = FNMS(KP1_414213562, TB - TC, T1C);
+	       T29 = FMS(KP1_847759065, T1A, KP765366864 * T1z);
+	       T2a = T28 - T29;
+	       T2b = FMS(KP1_662939224, T1t, KP1_111140466 * T1s);
+	       T2c = FMS(KP1_961570560, T1w, KP390180644 * T1v);
+	       T2d = T2b + T2c;
+	       T2e = T1u - T1x;
+	       O[WS(os, 6)] = FNMS(KP707106781, T2d + T2e, T2a);
+	       T2f = T1I - T1J;
+	       T2g = T1p - T1n;
+	       T2h = T2f + T2g;
+	       T2i = T1O - T1P;
+	       T2j = T1T - T1U;
+	       T2k = T2i + T2j;
+	       T2l = T15 - T1c;
+	       O[WS(os, 7)] = FMA(KP707106781, T2k - T2l, T2h);
+	       T2m = FNMS(KP2_000000000, TB + TC, TA);
+	       O[WS(os, 8)] = FMA(KP1_414213562, TR - TY, T2m);
+	       T2n = T2g - T2f;
+	       O[WS(os, 9)] = FNMS(KP707106781, T2k + T2l, T2n);
+	       T2o = T29 + T28;
+	       O[WS(os, 10)] = FMA(KP707106781, T2d - T2e, T2o);
+	       T2p = FMA(KP923879532, T26, KP382683432 * T25);
+	       T2q = FNMS(KP707106781, T1K - T1L, T23);
+	       O[WS(os, 11)] = T2p + T2q;
+	       T2r = FNMS(KP1_414213562, TG - TJ, T21);
+	       T2s = FMS(KP1_847759065, T1Z, KP765366864 * T1Y);
+	       O[WS(os, 12)] = T2r - T2s;
+	       T2t = FMA(KP923879532, T1W, KP382683432 * T1R);
+	       T2u = FMA(KP707106781, T1K + T1L, T1H);
+	       O[WS(os, 13)] = T2t + T2u;
+	       T2v = T2b - T2c;
+	       T2w = T1D - T1B;
+	       O[WS(os, 14)] = T2v + T2w;
+	       T2x = T1q - T1k;
+	       T2y = T2i - T2j;
+	       O[WS(os, 15)] = T2x - T2y;
+	       O[WS(os, 16)] = FNMS(KP2_000000000, TG + TJ, TD);
+	       O[WS(os, 17)] = T2y + T2x;
+	       O[WS(os, 18)] = T2w - T2v;
+	       O[WS(os, 19)] = T2u - T2t;
+	       O[WS(os, 20)] = T2s + T2r;
+	       O[WS(os, 21)] = T2q - T2p;
+	       O[WS(os, 22)] = FNMS(KP707106781, T2d - T2e, T2o);
+	       O[WS(os, 23)] = FMA(KP707106781, T2k + T2l, T2n);
+	       O[WS(os, 24)] = FNMS(KP1_414213562, TR - TY, T2m);
+	       O[WS(os, 25)] = FNMS(KP707106781, T2k - T2l, T2h);
+	       O[WS(os, 26)] = FMA(KP707106781, T2d + T2e, T2a);
+	       O[WS(os, 27)] = T24 + T27;
+	       O[WS(os, 28)] = T22 - T20;
+	       O[WS(os, 29)] = T1X + T1M;
+	       O[WS(os, 30)] = T1E - T1y;
+	       O[WS(os, 31)] = T1r - T1d;
+	       O[WS(os, 32)] = FNMS(KP2_000000000, TR + TY, TK);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 33, "e00_33", {130, 26, 56, 0}, &GENUS, REDFT00 };
+
+void X(codelet_e00_33) (planner *p) {
+     X(kr2r_register) (p, e00_33, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft00 -n 33 -name e00_33 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 172 FP additions, 67 FP multiplications,
+ * (or, 172 additions, 67 multiplications, 0 fused multiply/add),
+ * 173 stack variables, 19 constants, and 66 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e00_33(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(66, is), MAKE_VOLATILE_STRIDE(66, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = I[WS(is, 32)];
+	       Ty = T1 + Tx;
+	       Tz = KP2_000000000 * Th;
+	       TA = Ty + Tz;
+	       TB = KP2_000000000 * (T9 + Tp);
+	       TC = TA + TB;
+	       TD = T5 + Tt;
+	       TE = Td + Tl;
+	       TF = KP2_000000000 * (TD + TE);
+	       TG = TC + TF;
+	       TH = T3 + Tv;
+	       TI = Tf + Tj;
+	       TJ = TH + TI;
+	       TK = T7 + Tr;
+	       TL = Tb + Tn;
+	       TM = TK + TL;
+	       TN = KP2_000000000 * (TJ + TM);
+	       TO = TG + TN;
+	       TP = T2 + Tw;
+	       TQ = Tg + Ti;
+	       TR = TP + TQ;
+	       TS = T8 + Tq;
+	       TT = Ta + To;
+	       TU = TS + TT;
+	       TV = TR + TU;
+	       TW = T4 + Tu;
+	       TX = Te + Tk;
+	       TY = TW + TX;
+	       TZ = T6 + Ts;
+	       T10 = Tc + Tm;
+	       T11 = TZ + T10;
+	       T12 = TY + T11;
+	       T13 = KP2_000000000 * (TV + T12);
+	       O[0] = TO + T13;
+	       T14 = Tc - Tm;
+	       T15 = T6 - Ts;
+	       T16 = KP942793473 * T14 + KP1_763842528 * T15;
+	       T17 = Te - Tk;
+	       T18 = T4 - Tu;
+	       T19 = KP580569354 * T17 + KP1_913880671 * T18;
+	       T1a = T16 + T19;
+	       T1b = Ta - To;
+	       T1c = T8 - Tq;
+	       T1d = KP1_268786568 * T1b + KP1_546020906 * T1c;
+	       T1e = Tg - Ti;
+	       T1f = T2 - Tw;
+	       T1g = KP196034280 * T1e + KP1_990369453 * T1f;
+	       T1h = T1d + T1g;
+	       T1i = T1a + T1h;
+	       T1j = Tb - Tn;
+	       T1k = T7 - Tr;
+	       T1l = KP1_111140466 * T1j + KP1_662939224 * T1k;
+	       T1m = Tf - Tj;
+	       T1n = T3 - Tv;
+	       T1o = KP390180644 * T1m + KP1_961570560 * T1n;
+	       T1p = T1l + T1o;
+	       T1q = Td - Tl;
+	       T1r = T5 - Tt;
+	       T1s = KP765366864 * T1q + KP1_847759065 * T1r;
+	       T1t = T1 - Tx;
+	       T1u = KP1_414213562 * (T9 - Tp);
+	       T1v = T1t + T1u;
+	       T1w = T1s + T1v;
+	       T1x = T1p + T1w;
+	       O[WS(os, 1)] = T1i + T1x;
+	       T1y = TZ - T10;
+	       T1z = TW - TX;
+	       T1A = KP1_111140466 * T1y + KP1_662939224 * T1z;
+	       T1B = TS - TT;
+	       T1C = TP - TQ;
+	       T1D = KP390180644 * T1B + KP1_961570560 * T1C;
+	       T1E = T1A + T1D;
+	       T1F = TK - TL;
+	       T1G = TH - TI;
+	       T1H = KP765366864 * T1F + KP1_847759065 * T1G;
+	       T1I = Ty - Tz;
+	       T1J = KP1_414213562 * (TD - TE);
+	       T1K = T1I + T1J;
+	       T1L = T1H + T1K;
+	       O[WS(os, 2)] = T1E + T1L;
+	       T1M = T1t - T1u;
+	       T1N = KP1_847759065 * T1q - KP765366864 * T1r;
+	       T1O = T1M - T1N;
+	       T1P = KP1_662939224 * T1j - KP1_111140466 * T1k;
+	       T1Q = KP1_961570560 * T1m - KP390180644 * T1n;
+	       T1R = T1P + T1Q;
+	       T1S = T1l - T1o;
+	       T1T = KP707106781 * (T1R + T1S);
+	       T1U = T1O - T1T;
+	       T1V = T16 - T19;
+	       T1W = KP1_546020906 * T1b - KP1_268786568 * T1c;
+	       T1X = KP1_990369453 * T1e - KP196034280 * T1f;
+	       T1Y = T1W + T1X;
+	       T1Z = T1V + T1Y;
+	       T20 = T1g - T1d;
+	       T21 = KP1_763842528 * T14 - KP942793473 * T15;
+	       T22 = KP1_913880671 * T17 - KP580569354 * T18;
+	       T23 = T21 + T22;
+	       T24 = T20 - T23;
+	       T25 = KP382683432 * T1Z - KP923879532 * T24;
+	       O[WS(os, 3)] = T1U - T25;
+	       T26 = TY - T11;
+	       T27 = TR - TU;
+	       T28 = KP765366864 * T26 + KP1_847759065 * T27;
+	       T29 = TA - TB;
+	       T2a = KP1_414213562 * (TJ - TM);
+	       T2b = T29 + T2a;
+	       O[WS(os, 4)] = T28 + T2b;
+	       T2c = KP707106781 * (T1R - T1S);
+	       T2d = T1N + T1M;
+	       T2e = T2c + T2d;
+	       T2f = T1V - T1Y;
+	       T2g = T23 + T20;
+	       T2h = KP382683432 * T2f - KP923879532 * T2g;
+	       O[WS(os, 5)] = T2e - T2h;
+	       T2i = T1I - T1J;
+	       T2j = KP1_847759065 * T1F - KP765366864 * T1G;
+	       T2k = T2i - T2j;
+	       T2l = KP1_662939224 * T1y - KP1_111140466 * T1z;
+	       T2m = KP1_961570560 * T1B - KP390180644 * T1C;
+	       T2n = T2l + T2m;
+	       T2o = T1A - T1D;
+	       T2p = KP707106781 * (T2n + T2o);
+	       O[WS(os, 6)] = T2k - T2p;
+	       T2q = T21 - T22;
+	       T2r = T1W - T1X;
+	       T2s = T2q + T2r;
+	       T2t = T1a - T1h;
+	       T2u = KP707106781 * (T2s - T2t);
+	       T2v = T1P - T1Q;
+	       T2w = T1v - T1s;
+	       T2x = T2v + T2w;
+	       O[WS(os, 7)] = T2u + T2x;
+	       T2y = TC - TF;
+	       T2z = KP1_414213562 * (TV - T12);
+	       O[WS(os, 8)] = T2y + T2z;
+	       T2A = T2w - T2v;
+	       T2B = KP707106781 * (T2s + T2t);
+	       O[WS(os, 9)] = T2A - T2B;
+	       T2C = KP707106781 * (T2n - T2o);
+	       T2D = T2j + T2i;
+	       O[WS(os, 10)] = T2C + T2D;
+	       T2E = KP923879532 * T2f + KP382683432 * T2g;
+	       T2F = T2d - T2c;
+	       O[WS(os, 11)] = T2E + T2F;
+	       T2G = T29 - T2a;
+	       T2H = KP1_847759065 * T26 - KP765366864 * T27;
+	       O[WS(os, 12)] = T2G - T2H;
+	       T2I = KP923879532 * T1Z + KP382683432 * T24;
+	       T2J = T1T + T1O;
+	       O[WS(os, 13)] = T2I + T2J;
+	       T2K = T2l - T2m;
+	       T2L = T1K - T1H;
+	       O[WS(os, 14)] = T2K + T2L;
+	       T2M = T1w - T1p;
+	       T2N = T2q - T2r;
+	       O[WS(os, 15)] = T2M - T2N;
+	       O[WS(os, 16)] = TG - TN;
+	       O[WS(os, 17)] = T2N + T2M;
+	       O[WS(os, 18)] = T2L - T2K;
+	       O[WS(os, 19)] = T2J - T2I;
+	       O[WS(os, 20)] = T2H + T2G;
+	       O[WS(os, 21)] = T2F - T2E;
+	       O[WS(os, 22)] = T2D - T2C;
+	       O[WS(os, 23)] = T2B + T2A;
+	       O[WS(os, 24)] = T2y - T2z;
+	       O[WS(os, 25)] = T2x - T2u;
+	       O[WS(os, 26)] = T2p + T2k;
+	       O[WS(os, 27)] = T2e + T2h;
+	       O[WS(os, 28)] = T2b - T28;
+	       O[WS(os, 29)] = T25 + T1U;
+	       O[WS(os, 30)] = T1L - T1E;
+	       O[WS(os, 31)] = T1x - T1i;
+	       O[WS(os, 32)] = TO - T13;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 33, "e00_33", {172, 67, 0, 0}, &GENUS, REDFT00 };
+
+void X(codelet_e00_33) (planner *p) {
+     X(kr2r_register) (p, e00_33, &desc);
+}
+
+#endif
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft00 -n 5 -name e00_5 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 12 FP additions, 6 FP multiplications,
+ * (or, 6 additions, 0 multiplications, 6 fused multiply/add),
+ * 8 stack variables, 2 constants, and 10 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e00_5(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(10, is), MAKE_VOLATILE_STRIDE(10, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = T1 + T5;
+	       T7 = FMA(KP2_000000000, T3, T6);
+	       O[0] = FMA(KP2_000000000, T2 + T4, T7);
+	       T8 = T1 - T5;
+	       O[WS(os, 1)] = FMA(KP1_414213562, T2 - T4, T8);
+	       O[WS(os, 2)] = FNMS(KP2_000000000, T3, T6);
+	       O[WS(os, 3)] = FNMS(KP1_414213562, T2 - T4, T8);
+	       O[WS(os, 4)] = FNMS(KP2_000000000, T2 + T4, T7);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 5, "e00_5", {6, 0, 6, 0}, &GENUS, REDFT00 };
+
+void X(codelet_e00_5) (planner *p) {
+     X(kr2r_register) (p, e00_5, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft00 -n 5 -name e00_5 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 10 FP additions, 3 FP multiplications,
+ * (or, 10 additions, 3 multiplications, 0 fused multiply/add),
+ * 11 stack variables, 2 constants, and 10 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e00_5(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(10, is), MAKE_VOLATILE_STRIDE(10, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = T1 + T5;
+	       T7 = KP2_000000000 * T3;
+	       T8 = T6 + T7;
+	       T9 = KP2_000000000 * (T2 + T4);
+	       O[0] = T8 + T9;
+	       Ta = T1 - T5;
+	       Tb = KP1_414213562 * (T2 - T4);
+	       O[WS(os, 1)] = Ta + Tb;
+	       O[WS(os, 2)] = T6 - T7;
+	       O[WS(os, 3)] = Ta - Tb;
+	       O[WS(os, 4)] = T8 - T9;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 5, "e00_5", {10, 3, 0, 0}, &GENUS, REDFT00 };
+
+void X(codelet_e00_5) (planner *p) {
+     X(kr2r_register) (p, e00_5, &desc);
+}
+
+#endif
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft00 -n 9 -name e00_9 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 30 FP additions, 14 FP multiplications,
+ * (or, 18 additions, 2 multiplications, 12 fused multiply/add),
+ * 22 stack variables, 4 constants, and 18 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e00_9(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(18, is), MAKE_VOLATILE_STRIDE(18, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = T1 + T9;
+	       Tb = FMA(KP2_000000000, T5, Ta);
+	       Tc = FMA(KP2_000000000, T3 + T7, Tb);
+	       Td = T2 + T8;
+	       Te = T4 + T6;
+	       O[0] = FMA(KP2_000000000, Td + Te, Tc);
+	       Tf = T2 - T8;
+	       Tg = T4 - T6;
+	       Th = FMA(KP765366864, Tg, KP1_847759065 * Tf);
+	       Ti = T1 - T9;
+	       Tj = FMA(KP1_414213562, T3 - T7, Ti);
+	       O[WS(os, 1)] = Th + Tj;
+	       Tk = FNMS(KP2_000000000, T5, Ta);
+	       O[WS(os, 2)] = FMA(KP1_414213562, Td - Te, Tk);
+	       Tl = FNMS(KP1_414213562, T3 - T7, Ti);
+	       Tm = FMS(KP1_847759065, Tg, KP765366864 * Tf);
+	       O[WS(os, 3)] = Tl - Tm;
+	       O[WS(os, 4)] = FNMS(KP2_000000000, T3 + T7, Tb);
+	       O[WS(os, 5)] = Tm + Tl;
+	       O[WS(os, 6)] = FNMS(KP1_414213562, Td - Te, Tk);
+	       O[WS(os, 7)] = Tj - Th;
+	       O[WS(os, 8)] = FNMS(KP2_000000000, Td + Te, Tc);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 9, "e00_9", {18, 2, 12, 0}, &GENUS, REDFT00 };
+
+void X(codelet_e00_9) (planner *p) {
+     X(kr2r_register) (p, e00_9, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft00 -n 9 -name e00_9 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 26 FP additions, 9 FP multiplications,
+ * (or, 26 additions, 9 multiplications, 0 fused multiply/add),
+ * 27 stack variables, 4 constants, and 18 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e00_9(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(18, is), MAKE_VOLATILE_STRIDE(18, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = T1 + T9;
+	       Tb = KP2_000000000 * T5;
+	       Tc = Ta + Tb;
+	       Td = KP2_000000000 * (T3 + T7);
+	       Te = Tc + Td;
+	       Tf = T2 + T8;
+	       Tg = T4 + T6;
+	       Th = KP2_000000000 * (Tf + Tg);
+	       O[0] = Te + Th;
+	       Ti = T4 - T6;
+	       Tj = T2 - T8;
+	       Tk = KP765366864 * Ti + KP1_847759065 * Tj;
+	       Tl = T1 - T9;
+	       Tm = KP1_414213562 * (T3 - T7);
+	       Tn = Tl + Tm;
+	       O[WS(os, 1)] = Tk + Tn;
+	       To = Ta - Tb;
+	       Tp = KP1_414213562 * (Tf - Tg);
+	       O[WS(os, 2)] = To + Tp;
+	       Tq = Tl - Tm;
+	       Tr = KP1_847759065 * Ti - KP765366864 * Tj;
+	       O[WS(os, 3)] = Tq - Tr;
+	       O[WS(os, 4)] = Tc - Td;
+	       O[WS(os, 5)] = Tr + Tq;
+	       O[WS(os, 6)] = To - Tp;
+	       O[WS(os, 7)] = Tn - Tk;
+	       O[WS(os, 8)] = Te - Th;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 9, "e00_9", {26, 9, 0, 0}, &GENUS, REDFT00 };
+
+void X(codelet_e00_9) (planner *p) {
+     X(kr2r_register) (p, e00_9, &desc);
+}
+
+#endif
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft01 -n 12 -name e01_12 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 54 FP additions, 36 FP multiplications,
+ * (or, 30 additions, 12 multiplications, 24 fused multiply/add),
+ * 50 stack variables, 14 constants, and 24 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e01_12(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DK(KP1_931851652, +1.931851652578136573499486399457794735267809678);
+     DK(KP517638090, +0.517638090205041524697797675248096656698137803);
+     DK(KP1_586706680, +1.586706680582470329159553923002598553257351842);
+     DK(KP1_217522858, +1.217522858017441278832195085796328009032787424);
+     DK(KP1_982889722, +1.982889722747620822289115053857125742555476549);
+     DK(KP261052384, +0.261052384440103183096812455790978020387481410);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP750000000, +0.750000000000000000000000000000000000000000000);
+     DK(KP433012701, +0.433012701892219323381861585376468091735701313);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(24, is), MAKE_VOLATILE_STRIDE(24, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = FMA(KP1_732050807, T5, T9);
+	       Te = FMA(KP517638090, Tb, KP1_931851652 * T3);
+	       Tf = Td + Te;
+	       Tg = FMA(KP1_217522858, T8, KP1_586706680 * T6);
+	       Th = FMA(KP261052384, Tc, KP1_982889722 * T2);
+	       Ti = Tg + Th;
+	       Tj = Tf + Ti;
+	       Tk = FMA(KP765366864, Ta, KP1_847759065 * T4);
+	       Tl = FMA(KP1_414213562, T7, T1);
+	       Tm = Tk + Tl;
+	       O[0] = Tj + Tm;
+	       Tn = FNMS(KP1_414213562, T7, T1);
+	       To = FMS(KP1_847759065, Ta, KP765366864 * T4);
+	       Tp = Tn - To;
+	       Tq = Td - Te;
+	       Tr = FMS(KP1_586706680, T8, KP1_217522858 * T6);
+	       Ts = FMS(KP1_982889722, Tc, KP261052384 * T2);
+	       Tt = Tr + Ts;
+	       Tu = Tq + Tt;
+	       Tv = FNMS(KP500000000, Tu, Tp);
+	       Tw = FNMS(KP1_732050807, T9, T5);
+	       Tx = FMS(KP1_931851652, Tb, KP517638090 * T3);
+	       Ty = Tw - Tx;
+	       Tz = Tg - Th;
+	       O[WS(os, 1)] = FMA(KP866025403, Ty - Tz, Tv);
+	       TA = To + Tn;
+	       TB = Ty + Tz;
+	       TC = Tq - Tt;
+	       TD = FMA(KP500000000, TC, KP866025403 * TB);
+	       O[WS(os, 2)] = TA - TD;
+	       TE = Tl - Tk;
+	       TF = Tf - Ti;
+	       TG = Tw + Tx;
+	       TH = Tr - Ts;
+	       TI = TG - TH;
+	       TJ = FMS(KP866025403, TI, KP500000000 * TF);
+	       TK = FNMS(KP500000000, TJ, TE);
+	       TL = FMA(KP433012701, TI, KP750000000 * TF);
+	       O[WS(os, 3)] = TK - TL;
+	       O[WS(os, 4)] = TJ + TE;
+	       TM = FMS(KP750000000, TC, KP433012701 * TB);
+	       TN = FMA(KP500000000, TD, TA);
+	       O[WS(os, 5)] = TM + TN;
+	       O[WS(os, 6)] = Tu + Tp;
+	       TO = FNMS(KP500000000, Tj, Tm);
+	       O[WS(os, 7)] = FMA(KP866025403, TG + TH, TO);
+	       O[WS(os, 8)] = FNMS(KP866025403, TG + TH, TO);
+	       O[WS(os, 9)] = FNMS(KP866025403, Ty - Tz, Tv);
+	       O[WS(os, 10)] = TN - TM;
+	       O[WS(os, 11)] = TL + TK;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 12, "e01_12", {30, 12, 24, 0}, &GENUS, REDFT01 };
+
+void X(codelet_e01_12) (planner *p) {
+     X(kr2r_register) (p, e01_12, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft01 -n 12 -name e01_12 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 52 FP additions, 33 FP multiplications,
+ * (or, 52 additions, 33 multiplications, 0 fused multiply/add),
+ * 53 stack variables, 14 constants, and 24 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e01_12(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DK(KP517638090, +0.517638090205041524697797675248096656698137803);
+     DK(KP1_931851652, +1.931851652578136573499486399457794735267809678);
+     DK(KP1_217522858, +1.217522858017441278832195085796328009032787424);
+     DK(KP1_586706680, +1.586706680582470329159553923002598553257351842);
+     DK(KP261052384, +0.261052384440103183096812455790978020387481410);
+     DK(KP1_982889722, +1.982889722747620822289115053857125742555476549);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP433012701, +0.433012701892219323381861585376468091735701313);
+     DK(KP750000000, +0.750000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(24, is), MAKE_VOLATILE_STRIDE(24, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = T9 + KP1_732050807 * T5;
+	       Te = KP517638090 * Tb + KP1_931851652 * T3;
+	       Tf = Td + Te;
+	       Tg = KP1_217522858 * T8 + KP1_586706680 * T6;
+	       Th = KP261052384 * Tc + KP1_982889722 * T2;
+	       Ti = Tg + Th;
+	       Tj = Tf + Ti;
+	       Tk = KP765366864 * Ta + KP1_847759065 * T4;
+	       Tl = KP1_414213562 * T7;
+	       Tm = T1 + Tl;
+	       Tn = Tk + Tm;
+	       O[0] = Tj + Tn;
+	       To = T5 - KP1_732050807 * T9;
+	       Tp = KP1_931851652 * Tb - KP517638090 * T3;
+	       Tq = To - Tp;
+	       Tr = Tg - Th;
+	       Ts = KP866025403 * (Tq - Tr);
+	       Tt = T1 - Tl;
+	       Tu = KP1_847759065 * Ta - KP765366864 * T4;
+	       Tv = Tt - Tu;
+	       Tw = Td - Te;
+	       Tx = KP1_586706680 * T8 - KP1_217522858 * T6;
+	       Ty = KP1_982889722 * Tc - KP261052384 * T2;
+	       Tz = Tx + Ty;
+	       TA = Tw + Tz;
+	       TB = Tv - KP500000000 * TA;
+	       O[WS(os, 1)] = Ts + TB;
+	       TC = Tu + Tt;
+	       TD = Tw - Tz;
+	       TE = Tq + Tr;
+	       TF = KP500000000 * TD + KP866025403 * TE;
+	       O[WS(os, 2)] = TC - TF;
+	       TG = Tm - Tk;
+	       TH = To + Tp;
+	       TI = Tx - Ty;
+	       TJ = TH - TI;
+	       TK = Tf - Ti;
+	       TL = KP866025403 * TJ - KP500000000 * TK;
+	       TM = TG - KP500000000 * TL;
+	       TN = KP433012701 * TJ + KP750000000 * TK;
+	       O[WS(os, 3)] = TM - TN;
+	       O[WS(os, 4)] = TL + TG;
+	       TO = KP750000000 * TD - KP433012701 * TE;
+	       TP = TC + KP500000000 * TF;
+	       O[WS(os, 5)] = TO + TP;
+	       O[WS(os, 6)] = TA + Tv;
+	       TQ = KP866025403 * (TH + TI);
+	       TR = Tn - KP500000000 * Tj;
+	       O[WS(os, 7)] = TQ + TR;
+	       O[WS(os, 8)] = TR - TQ;
+	       O[WS(os, 9)] = TB - Ts;
+	       O[WS(os, 10)] = TP - TO;
+	       O[WS(os, 11)] = TN + TM;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 12, "e01_12", {52, 33, 0, 0}, &GENUS, REDFT01 };
+
+void X(codelet_e01_12) (planner *p) {
+     X(kr2r_register) (p, e01_12, &desc);
+}
+
+#endif
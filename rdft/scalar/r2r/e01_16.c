@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft01 -n 16 -name e01_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 76 FP additions, 46 FP multiplications,
+ * (or, 48 additions, 18 multiplications, 28 fused multiply/add),
+ * 68 stack variables, 18 constants, and 32 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e01_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = FMA(KP942793473, Tc, KP1_763842528 * T6);
+	       Ti = FMA(KP580569354, Te, KP1_913880671 * T4);
+	       Tj = Th + Ti;
+	       Tk = FMA(KP1_268786568, Ta, KP1_546020906 * T8);
+	       Tl = FMA(KP196034280, Tg, KP1_990369453 * T2);
+	       Tm = Tk + Tl;
+	       Tn = Tj + Tm;
+	       To = FMA(KP1_111140466, Tb, KP1_662939224 * T7);
+	       Tp = FMA(KP390180644, Tf, KP1_961570560 * T3);
+	       Tq = To + Tp;
+	       Tr = FMA(KP765366864, Td, KP1_847759065 * T5);
+	       Ts = FMA(KP1_414213562, T9, T1);
+	       Tt = Tr + Ts;
+	       Tu = Tq + Tt;
+	       O[0] = Tn + Tu;
+	       Tv = FNMS(KP1_414213562, T9, T1);
+	       Tw = FMS(KP1_847759065, Td, KP765366864 * T5);
+	       Tx = Tv - Tw;
+	       Ty = FMS(KP1_662939224, Tb, KP1_111140466 * T7);
+	       Tz = FMS(KP1_961570560, Tf, KP390180644 * T3);
+	       TA = Ty + Tz;
+	       TB = To - Tp;
+	       TC = FNMS(KP707106781, TA + TB, Tx);
+	       TD = FMS(KP1_763842528, Tc, KP942793473 * T6);
+	       TE = FMS(KP1_913880671, Te, KP580569354 * T4);
+	       TF = TD + TE;
+	       TG = Tk - Tl;
+	       TH = TF + TG;
+	       TI = Th - Ti;
+	       TJ = FMS(KP1_546020906, Ta, KP1_268786568 * T8);
+	       TK = FMS(KP1_990369453, Tg, KP196034280 * T2);
+	       TL = TJ + TK;
+	       TM = TI + TL;
+	       TN = FMA(KP382683432, TM, KP923879532 * TH);
+	       O[WS(os, 1)] = TC - TN;
+	       TO = Tw + Tv;
+	       TP = FMA(KP707106781, TA - TB, TO);
+	       TQ = TF - TG;
+	       TR = TI - TL;
+	       TS = FMS(KP382683432, TR, KP923879532 * TQ);
+	       O[WS(os, 2)] = TP - TS;
+	       TT = Ty - Tz;
+	       TU = Ts - Tr;
+	       TV = TT + TU;
+	       TW = TD - TE;
+	       TX = TJ - TK;
+	       TY = TW + TX;
+	       TZ = Tj - Tm;
+	       O[WS(os, 3)] = FMA(KP707106781, TY - TZ, TV);
+	       T10 = TU - TT;
+	       O[WS(os, 4)] = FNMS(KP707106781, TY + TZ, T10);
+	       T11 = FMA(KP923879532, TR, KP382683432 * TQ);
+	       T12 = FNMS(KP707106781, TA - TB, TO);
+	       O[WS(os, 5)] = T11 + T12;
+	       T13 = FMS(KP923879532, TM, KP382683432 * TH);
+	       T14 = FMA(KP707106781, TA + TB, Tx);
+	       O[WS(os, 6)] = T13 + T14;
+	       T15 = Tt - Tq;
+	       T16 = TW - TX;
+	       O[WS(os, 7)] = T15 - T16;
+	       O[WS(os, 8)] = T16 + T15;
+	       O[WS(os, 9)] = T14 - T13;
+	       O[WS(os, 10)] = T12 - T11;
+	       O[WS(os, 11)] = FMA(KP707106781, TY + TZ, T10);
+	       O[WS(os, 12)] = FNMS(KP707106781, TY - TZ, TV);
+	       O[WS(os, 13)] = TS + TP;
+	       O[WS(os, 14)] = TN + TC;
+	       O[WS(os, 15)] = Tu - Tn;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 16, "e01_16", {48, 18, 28, 0}, &GENUS, REDFT01 };
+
+void X(codelet_e01_16) (planner *p) {
+     X(kr2r_register) (p, e01_16, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft01 -n 16 -name e01_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 72 FP additions, 41 FP multiplications,
+ * (or, 72 additions, 41 multiplications, 0 fused multiply/add),
+ * 73 stack variables, 18 constants, and 32 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e01_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = KP942793473 * Tc + KP1_763842528 * T6;
+	       Ti = KP580569354 * Te + KP1_913880671 * T4;
+	       Tj = Th + Ti;
+	       Tk = KP1_268786568 * Ta + KP1_546020906 * T8;
+	       Tl = KP196034280 * Tg + KP1_990369453 * T2;
+	       Tm = Tk + Tl;
+	       Tn = Tj + Tm;
+	       To = KP1_111140466 * Tb + KP1_662939224 * T7;
+	       Tp = KP390180644 * Tf + KP1_961570560 * T3;
+	       Tq = To + Tp;
+	       Tr = KP765366864 * Td + KP1_847759065 * T5;
+	       Ts = KP1_414213562 * T9;
+	       Tt = T1 + Ts;
+	       Tu = Tr + Tt;
+	       Tv = Tq + Tu;
+	       O[0] = Tn + Tv;
+	       Tw = T1 - Ts;
+	       Tx = KP1_847759065 * Td - KP765366864 * T5;
+	       Ty = Tw - Tx;
+	       Tz = KP1_662939224 * Tb - KP1_111140466 * T7;
+	       TA = KP1_961570560 * Tf - KP390180644 * T3;
+	       TB = Tz + TA;
+	       TC = To - Tp;
+	       TD = KP707106781 * (TB + TC);
+	       TE = Ty - TD;
+	       TF = Th - Ti;
+	       TG = KP1_546020906 * Ta - KP1_268786568 * T8;
+	       TH = KP1_990369453 * Tg - KP196034280 * T2;
+	       TI = TG + TH;
+	       TJ = TF + TI;
+	       TK = KP1_763842528 * Tc - KP942793473 * T6;
+	       TL = KP1_913880671 * Te - KP580569354 * T4;
+	       TM = TK + TL;
+	       TN = Tk - Tl;
+	       TO = TM + TN;
+	       TP = KP382683432 * TJ + KP923879532 * TO;
+	       O[WS(os, 1)] = TE - TP;
+	       TQ = KP707106781 * (TB - TC);
+	       TR = Tx + Tw;
+	       TS = TQ + TR;
+	       TT = TF - TI;
+	       TU = TM - TN;
+	       TV = KP382683432 * TT - KP923879532 * TU;
+	       O[WS(os, 2)] = TS - TV;
+	       TW = TK - TL;
+	       TX = TG - TH;
+	       TY = TW + TX;
+	       TZ = Tj - Tm;
+	       T10 = KP707106781 * (TY - TZ);
+	       T11 = Tz - TA;
+	       T12 = Tt - Tr;
+	       T13 = T11 + T12;
+	       O[WS(os, 3)] = T10 + T13;
+	       T14 = T12 - T11;
+	       T15 = KP707106781 * (TY + TZ);
+	       O[WS(os, 4)] = T14 - T15;
+	       T16 = KP923879532 * TT + KP382683432 * TU;
+	       T17 = TR - TQ;
+	       O[WS(os, 5)] = T16 + T17;
+	       T18 = KP923879532 * TJ - KP382683432 * TO;
+	       T19 = TD + Ty;
+	       O[WS(os, 6)] = T18 + T19;
+	       T1a = Tu - Tq;
+	       T1b = TW - TX;
+	       O[WS(os, 7)] = T1a - T1b;
+	       O[WS(os, 8)] = T1b + T1a;
+	       O[WS(os, 9)] = T19 - T18;
+	       O[WS(os, 10)] = T17 - T16;
+	       O[WS(os, 11)] = T15 + T14;
+	       O[WS(os, 12)] = T13 - T10;
+	       O[WS(os, 13)] = TV + TS;
+	       O[WS(os, 14)] = TP + TE;
+	       O[WS(os, 15)] = Tv - Tn;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 16, "e01_16", {72, 41, 0, 0}, &GENUS, REDFT01 };
+
+void X(codelet_e01_16) (planner *p) {
+     X(kr2r_register) (p, e01_16, &desc);
+}
+
+#endif
@@ -0,0 +1,615 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft01 -n 32 -name e01_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 196 FP additions, 114 FP multiplications,
+ * (or, 128 additions, 46 multiplications, 68 fused multiply/add),
+ * 176 stack variables, 38 constants, and 64 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e01_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = FMA(KP1_028205488, Tm, KP1_715457220 * Tc);
+	       Ty = FMA(KP485960359, Ts, KP1_940062506 * T6);
+	       Tz = Tx + Ty;
+	       TA = FMA(KP1_191398608, Tk, KP1_606415062 * Te);
+	       TB = FMA(KP293460948, Tu, KP1_978353019 * T4);
+	       TC = TA + TB;
+	       TD = Tz + TC;
+	       TE = FMA(KP855110186, To, KP1_807978586 * Ta);
+	       TF = FMA(KP673779706, Tq, KP1_883088130 * T8);
+	       TG = TE + TF;
+	       TH = FMA(KP1_343117909, Ti, KP1_481902250 * Tg);
+	       TI = FMA(KP098135348, Tw, KP1_997590912 * T2);
+	       TJ = TH + TI;
+	       TK = TG + TJ;
+	       TL = TD + TK;
+	       TM = FMA(KP942793473, Tn, KP1_763842528 * Tb);
+	       TN = FMA(KP580569354, Tr, KP1_913880671 * T7);
+	       TO = TM + TN;
+	       TP = FMA(KP1_268786568, Tj, KP1_546020906 * Tf);
+	       TQ = FMA(KP196034280, Tv, KP1_990369453 * T3);
+	       TR = TP + TQ;
+	       TS = TO + TR;
+	       TT = FMA(KP1_111140466, Tl, KP1_662939224 * Td);
+	       TU = FMA(KP390180644, Tt, KP1_961570560 * T5);
+	       TV = TT + TU;
+	       TW = FMA(KP765366864, Tp, KP1_847759065 * T9);
+	       TX = FMA(KP1_414213562, Th, T1);
+	       TY = TW + TX;
+	       TZ = TV + TY;
+	       T10 = TS + TZ;
+	       O[0] = TL + T10;
+	       T11 = FNMS(KP1_414213562, Th, T1);
+	       T12 = FMS(KP1_847759065, Tp, KP765366864 * T9);
+	       T13 = T11 - T12;
+	       T14 = FMS(KP1_662939224, Tl, KP1_111140466 * Td);
+	       T15 = FMS(KP1_961570560, Tt, KP390180644 * T5);
+	       T16 = T14 + T15;
+	       T17 = TT - TU;
+	       T18 = FNMS(KP707106781, T16 + T17, T13);
+	       T19 = FMS(KP1_763842528, Tn, KP942793473 * Tb);
+	       T1a = FMS(KP1_913880671, Tr, KP580569354 * T7);
+	       T1b = T19 + T1a;
+	       T1c = TP - TQ;
+	       T1d = T1b + T1c;
+	       T1e = TM - TN;
+	       T1f = FMS(KP1_546020906, Tj, KP1_268786568 * Tf);
+	       T1g = FMS(KP1_990369453, Tv, KP196034280 * T3);
+	       T1h = T1f + T1g;
+	       T1i = T1e + T1h;
+	       T1j = FMA(KP382683432, T1i, KP923879532 * T1d);
+	       T1k = T18 - T1j;
+	       T1l = FMS(KP1_715457220, Tm, KP1_028205488 * Tc);
+	       T1m = FMS(KP1_940062506, Ts, KP485960359 * T6);
+	       T1n = T1l + T1m;
+	       T1o = TA - TB;
+	       T1p = T1n + T1o;
+	       T1q = Tx - Ty;
+	       T1r = FMS(KP1_606415062, Tk, KP1_191398608 * Te);
+	       T1s = FMS(KP1_978353019, Tu, KP293460948 * T4);
+	       T1t = T1r + T1s;
+	       T1u = T1q + T1t;
+	       T1v = FMA(KP980785280, T1u, KP195090322 * T1p);
+	       T1w = FMS(KP1_807978586, To, KP855110186 * Ta);
+	       T1x = FMS(KP1_883088130, Tq, KP673779706 * T8);
+	       T1y = T1w + T1x;
+	       T1z = TH - TI;
+	       T1A = T1y + T1z;
+	       T1B = TE - TF;
+	       T1C = FMS(KP1_481902250, Ti, KP1_343117909 * Tg);
+	       T1D = FMS(KP1_997590912, Tw, KP098135348 * T2);
+	       T1E = T1C + T1D;
+	       T1F = T1B + T1E;
+	       T1G = FMS(KP555570233, T1F, KP831469612 * T1A);
+	       T1H = T1v - T1G;
+	       T1I = FMS(KP195090322, T1u, KP980785280 * T1p);
+	       T1J = FMA(KP831469612, T1F, KP555570233 * T1A);
+	       T1K = T1I - T1J;
+	       O[WS(os, 1)] = FNMS(KP707106781, T1H - T1K, T1k);
+	       T1L = T12 + T11;
+	       T1M = FMA(KP707106781, T16 - T17, T1L);
+	       T1N = T1b - T1c;
+	       T1O = T1e - T1h;
+	       T1P = FMS(KP382683432, T1O, KP923879532 * T1N);
+	       T1Q = T1M - T1P;
+	       T1R = T1n - T1o;
+	       T1S = T1q - T1t;
+	       T1T = FMS(KP555570233, T1S, KP831469612 * T1R);
+	       T1U = T1y - T1z;
+	       T1V = T1B - T1E;
+	       T1W = FMS(KP195090322, T1V, KP980785280 * T1U);
+	       T1X = T1T + T1W;
+	       O[WS(os, 2)] = T1Q - T1X;
+	       T1Y = T14 - T15;
+	       T1Z = TX - TW;
+	       T20 = T1Y + T1Z;
+	       T21 = T19 - T1a;
+	       T22 = T1f - T1g;
+	       T23 = T21 + T22;
+	       T24 = TO - TR;
+	       T25 = FMA(KP707106781, T23 - T24, T20);
+	       T26 = T1l - T1m;
+	       T27 = T1r - T1s;
+	       T28 = T26 + T27;
+	       T29 = TG - TJ;
+	       T2a = T28 - T29;
+	       T2b = Tz - TC;
+	       T2c = T1w - T1x;
+	       T2d = T1C - T1D;
+	       T2e = T2c + T2d;
+	       T2f = T2b - T2e;
+	       T2g = FMS(KP382683432, T2f, KP923879532 * T2a);
+	       O[WS(os, 3)] = T25 - T2g;
+	       T2h = T1Z - T1Y;
+	       T2i = FNMS(KP707106781, T23 + T24, T2h);
+	       T2j = T28 + T29;
+	       T2k = T2b + T2e;
+	       T2l = FMA(KP382683432, T2k, KP923879532 * T2j);
+	       O[WS(os, 4)] = T2i - T2l;
+	       T2m = FMA(KP923879532, T1O, KP382683432 * T1N);
+	       T2n = FNMS(KP707106781, T16 - T17, T1L);
+	       T2o = T2m + T2n;
+	       T2p = FMA(KP831469612, T1S, KP555570233 * T1R);
+	       T2q = FMA(KP980785280, T1V, KP195090322 * T1U);
+	       T2r = T2p + T2q;
+	       T2s = T1T - T1W;
+	       O[WS(os, 5)] = FMA(KP707106781, T2r + T2s, T2o);
+	       T2t = T1v + T1G;
+	       T2u = FMS(KP923879532, T1i, KP382683432 * T1d);
+	       T2v = FMA(KP707106781, T16 + T17, T13);
+	       T2w = T2u + T2v;
+	       O[WS(os, 6)] = T2t + T2w;
+	       T2x = TY - TV;
+	       T2y = T21 - T22;
+	       T2z = T2x - T2y;
+	       T2A = T26 - T27;
+	       T2B = T2c - T2d;
+	       T2C = T2A + T2B;
+	       T2D = TD - TK;
+	       O[WS(os, 7)] = FNMS(KP707106781, T2C + T2D, T2z);
+	       T2E = T2y + T2x;
+	       O[WS(os, 8)] = FMA(KP707106781, T2C - T2D, T2E);
+	       T2F = T2v - T2u;
+	       T2G = T1I + T1J;
+	       O[WS(os, 9)] = T2F - T2G;
+	       T2H = T2n - T2m;
+	       O[WS(os, 10)] = FNMS(KP707106781, T2r - T2s, T2H);
+	       T2I = FMS(KP923879532, T2k, KP382683432 * T2j);
+	       T2J = FMA(KP707106781, T23 + T24, T2h);
+	       O[WS(os, 11)] = T2I + T2J;
+	       T2K = FMA(KP923879532, T2f, KP382683432 * T2a);
+	       T2L = FNMS(KP707106781, T23 - T24, T20);
+	       O[WS(os, 12)] = T2K + T2L;
+	       T2M = T1P + T1M;
+	       T2N = T2p - T2q;
+	       O[WS(os, 13)] = T2M - T2N;
+	       T2O = T1j + T18;
+	       O[WS(os, 14)] = FNMS(KP707106781, T1K + T1H, T2O);
+	       T2P = T2A - T2B;
+	       T2Q = TZ - TS;
+	       O[WS(os, 15)] = T2P + T2Q;
+	       O[WS(os, 16)] = T2Q - T2P;
+	       O[WS(os, 17)] = FMA(KP707106781, T1K + T1H, T2O);
+	       O[WS(os, 18)] = T2N + T2M;
+	       O[WS(os, 19)] = T2L - T2K;
+	       O[WS(os, 20)] = T2J - T2I;
+	       O[WS(os, 21)] = FMA(KP707106781, T2r - T2s, T2H);
+	       O[WS(os, 22)] = T2G + T2F;
+	       O[WS(os, 23)] = FNMS(KP707106781, T2C - T2D, T2E);
+	       O[WS(os, 24)] = FMA(KP707106781, T2C + T2D, T2z);
+	       O[WS(os, 25)] = T2w - T2t;
+	       O[WS(os, 26)] = FNMS(KP707106781, T2r + T2s, T2o);
+	       O[WS(os, 27)] = T2l + T2i;
+	       O[WS(os, 28)] = T2g + T25;
+	       O[WS(os, 29)] = T1X + T1Q;
+	       O[WS(os, 30)] = FMA(KP707106781, T1H - T1K, T1k);
+	       O[WS(os, 31)] = T10 - TL;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 32, "e01_32", {128, 46, 68, 0}, &GENUS, REDFT01 };
+
+void X(codelet_e01_32) (planner *p) {
+     X(kr2r_register) (p, e01_32, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft01 -n 32 -name e01_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 186 FP additions, 103 FP multiplications,
+ * (or, 186 additions, 103 multiplications, 0 fused multiply/add),
+ * 187 stack variables, 38 constants, and 64 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e01_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V, T2W, T2X, T2Y, T2Z, T30, T31;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = KP1_028205488 * Tm + KP1_715457220 * Tc;
+	       Ty = KP485960359 * Ts + KP1_940062506 * T6;
+	       Tz = Tx + Ty;
+	       TA = KP1_191398608 * Tk + KP1_606415062 * Te;
+	       TB = KP293460948 * Tu + KP1_978353019 * T4;
+	       TC = TA + TB;
+	       TD = Tz + TC;
+	       TE = KP855110186 * To + KP1_807978586 * Ta;
+	       TF = KP673779706 * Tq + KP1_883088130 * T8;
+	       TG = TE + TF;
+	       TH = KP1_343117909 * Ti + KP1_481902250 * Tg;
+	       TI = KP098135348 * Tw + KP1_997590912 * T2;
+	       TJ = TH + TI;
+	       TK = TG + TJ;
+	       TL = TD + TK;
+	       TM = KP942793473 * Tn + KP1_763842528 * Tb;
+	       TN = KP580569354 * Tr + KP1_913880671 * T7;
+	       TO = TM + TN;
+	       TP = KP1_268786568 * Tj + KP1_546020906 * Tf;
+	       TQ = KP196034280 * Tv + KP1_990369453 * T3;
+	       TR = TP + TQ;
+	       TS = TO + TR;
+	       TT = KP1_111140466 * Tl + KP1_662939224 * Td;
+	       TU = KP390180644 * Tt + KP1_961570560 * T5;
+	       TV = TT + TU;
+	       TW = KP765366864 * Tp + KP1_847759065 * T9;
+	       TX = KP1_414213562 * Th;
+	       TY = T1 + TX;
+	       TZ = TW + TY;
+	       T10 = TV + TZ;
+	       T11 = TS + T10;
+	       O[0] = TL + T11;
+	       T12 = T1 - TX;
+	       T13 = KP1_847759065 * Tp - KP765366864 * T9;
+	       T14 = T12 - T13;
+	       T15 = KP1_662939224 * Tl - KP1_111140466 * Td;
+	       T16 = KP1_961570560 * Tt - KP390180644 * T5;
+	       T17 = T15 + T16;
+	       T18 = TT - TU;
+	       T19 = KP707106781 * (T17 + T18);
+	       T1a = T14 - T19;
+	       T1b = TM - TN;
+	       T1c = KP1_546020906 * Tj - KP1_268786568 * Tf;
+	       T1d = KP1_990369453 * Tv - KP196034280 * T3;
+	       T1e = T1c + T1d;
+	       T1f = T1b + T1e;
+	       T1g = KP1_763842528 * Tn - KP942793473 * Tb;
+	       T1h = KP1_913880671 * Tr - KP580569354 * T7;
+	       T1i = T1g + T1h;
+	       T1j = TP - TQ;
+	       T1k = T1i + T1j;
+	       T1l = KP382683432 * T1f + KP923879532 * T1k;
+	       T1m = T1a - T1l;
+	       T1n = Tx - Ty;
+	       T1o = KP1_606415062 * Tk - KP1_191398608 * Te;
+	       T1p = KP1_978353019 * Tu - KP293460948 * T4;
+	       T1q = T1o + T1p;
+	       T1r = T1n + T1q;
+	       T1s = KP1_715457220 * Tm - KP1_028205488 * Tc;
+	       T1t = KP1_940062506 * Ts - KP485960359 * T6;
+	       T1u = T1s + T1t;
+	       T1v = TA - TB;
+	       T1w = T1u + T1v;
+	       T1x = KP980785280 * T1r + KP195090322 * T1w;
+	       T1y = TE - TF;
+	       T1z = KP1_481902250 * Ti - KP1_343117909 * Tg;
+	       T1A = KP1_997590912 * Tw - KP098135348 * T2;
+	       T1B = T1z + T1A;
+	       T1C = T1y + T1B;
+	       T1D = KP1_807978586 * To - KP855110186 * Ta;
+	       T1E = KP1_883088130 * Tq - KP673779706 * T8;
+	       T1F = T1D + T1E;
+	       T1G = TH - TI;
+	       T1H = T1F + T1G;
+	       T1I = KP555570233 * T1C - KP831469612 * T1H;
+	       T1J = T1x - T1I;
+	       T1K = KP195090322 * T1r - KP980785280 * T1w;
+	       T1L = KP831469612 * T1C + KP555570233 * T1H;
+	       T1M = T1K - T1L;
+	       T1N = KP707106781 * (T1J - T1M);
+	       O[WS(os, 1)] = T1m - T1N;
+	       T1O = KP707106781 * (T17 - T18);
+	       T1P = T13 + T12;
+	       T1Q = T1O + T1P;
+	       T1R = T1b - T1e;
+	       T1S = T1i - T1j;
+	       T1T = KP382683432 * T1R - KP923879532 * T1S;
+	       T1U = T1Q - T1T;
+	       T1V = T1n - T1q;
+	       T1W = T1u - T1v;
+	       T1X = KP555570233 * T1V - KP831469612 * T1W;
+	       T1Y = T1y - T1B;
+	       T1Z = T1F - T1G;
+	       T20 = KP195090322 * T1Y - KP980785280 * T1Z;
+	       T21 = T1X + T20;
+	       O[WS(os, 2)] = T1U - T21;
+	       T22 = T1g - T1h;
+	       T23 = T1c - T1d;
+	       T24 = T22 + T23;
+	       T25 = TO - TR;
+	       T26 = KP707106781 * (T24 - T25);
+	       T27 = T15 - T16;
+	       T28 = TY - TW;
+	       T29 = T27 + T28;
+	       T2a = T26 + T29;
+	       T2b = Tz - TC;
+	       T2c = T1D - T1E;
+	       T2d = T1z - T1A;
+	       T2e = T2c + T2d;
+	       T2f = T2b - T2e;
+	       T2g = T1s - T1t;
+	       T2h = T1o - T1p;
+	       T2i = T2g + T2h;
+	       T2j = TG - TJ;
+	       T2k = T2i - T2j;
+	       T2l = KP382683432 * T2f - KP923879532 * T2k;
+	       O[WS(os, 3)] = T2a - T2l;
+	       T2m = T28 - T27;
+	       T2n = KP707106781 * (T24 + T25);
+	       T2o = T2m - T2n;
+	       T2p = T2b + T2e;
+	       T2q = T2i + T2j;
+	       T2r = KP382683432 * T2p + KP923879532 * T2q;
+	       O[WS(os, 4)] = T2o - T2r;
+	       T2s = KP831469612 * T1V + KP555570233 * T1W;
+	       T2t = KP980785280 * T1Y + KP195090322 * T1Z;
+	       T2u = T2s + T2t;
+	       T2v = T1X - T20;
+	       T2w = KP707106781 * (T2u + T2v);
+	       T2x = KP923879532 * T1R + KP382683432 * T1S;
+	       T2y = T1P - T1O;
+	       T2z = T2x + T2y;
+	       O[WS(os, 5)] = T2w + T2z;
+	       T2A = T1x + T1I;
+	       T2B = KP923879532 * T1f - KP382683432 * T1k;
+	       T2C = T19 + T14;
+	       T2D = T2B + T2C;
+	       O[WS(os, 6)] = T2A + T2D;
+	       T2E = TZ - TV;
+	       T2F = T22 - T23;
+	       T2G = T2E - T2F;
+	       T2H = T2g - T2h;
+	       T2I = T2c - T2d;
+	       T2J = T2H + T2I;
+	       T2K = TD - TK;
+	       T2L = KP707106781 * (T2J + T2K);
+	       O[WS(os, 7)] = T2G - T2L;
+	       T2M = KP707106781 * (T2J - T2K);
+	       T2N = T2F + T2E;
+	       O[WS(os, 8)] = T2M + T2N;
+	       T2O = T2C - T2B;
+	       T2P = T1K + T1L;
+	       O[WS(os, 9)] = T2O - T2P;
+	       T2Q = T2y - T2x;
+	       T2R = KP707106781 * (T2u - T2v);
+	       O[WS(os, 10)] = T2Q - T2R;
+	       T2S = KP923879532 * T2p - KP382683432 * T2q;
+	       T2T = T2n + T2m;
+	       O[WS(os, 11)] = T2S + T2T;
+	       T2U = KP923879532 * T2f + KP382683432 * T2k;
+	       T2V = T29 - T26;
+	       O[WS(os, 12)] = T2U + T2V;
+	       T2W = T1T + T1Q;
+	       T2X = T2s - T2t;
+	       O[WS(os, 13)] = T2W - T2X;
+	       T2Y = T1l + T1a;
+	       T2Z = KP707106781 * (T1M + T1J);
+	       O[WS(os, 14)] = T2Y - T2Z;
+	       T30 = T2H - T2I;
+	       T31 = T10 - TS;
+	       O[WS(os, 15)] = T30 + T31;
+	       O[WS(os, 16)] = T31 - T30;
+	       O[WS(os, 17)] = T2Z + T2Y;
+	       O[WS(os, 18)] = T2X + T2W;
+	       O[WS(os, 19)] = T2V - T2U;
+	       O[WS(os, 20)] = T2T - T2S;
+	       O[WS(os, 21)] = T2R + T2Q;
+	       O[WS(os, 22)] = T2P + T2O;
+	       O[WS(os, 23)] = T2N - T2M;
+	       O[WS(os, 24)] = T2L + T2G;
+	       O[WS(os, 25)] = T2D - T2A;
+	       O[WS(os, 26)] = T2z - T2w;
+	       O[WS(os, 27)] = T2r + T2o;
+	       O[WS(os, 28)] = T2l + T2a;
+	       O[WS(os, 29)] = T21 + T1U;
+	       O[WS(os, 30)] = T1N + T1m;
+	       O[WS(os, 31)] = T11 - TL;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 32, "e01_32", {186, 103, 0, 0}, &GENUS, REDFT01 };
+
+void X(codelet_e01_32) (planner *p) {
+     X(kr2r_register) (p, e01_32, &desc);
+}
+
+#endif
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft01 -n 6 -name e01_6 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 21 FP additions, 16 FP multiplications,
+ * (or, 9 additions, 4 multiplications, 12 fused multiply/add),
+ * 19 stack variables, 8 constants, and 12 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e01_6(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DK(KP1_931851652, +1.931851652578136573499486399457794735267809678);
+     DK(KP517638090, +0.517638090205041524697797675248096656698137803);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP750000000, +0.750000000000000000000000000000000000000000000);
+     DK(KP433012701, +0.433012701892219323381861585376468091735701313);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(12, is), MAKE_VOLATILE_STRIDE(12, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = FMA(KP1_732050807, T3, T5);
+	       T8 = FMA(KP517638090, T6, KP1_931851652 * T2);
+	       T9 = T7 + T8;
+	       Ta = FMA(KP1_414213562, T4, T1);
+	       O[0] = T9 + Ta;
+	       Tb = T7 - T8;
+	       Tc = FNMS(KP1_732050807, T5, T3);
+	       Td = FMS(KP1_931851652, T6, KP517638090 * T2);
+	       Te = Tc - Td;
+	       Tf = FMS(KP433012701, Te, KP750000000 * Tb);
+	       Tg = FNMS(KP1_414213562, T4, T1);
+	       Th = FMA(KP866025403, Te, KP500000000 * Tb);
+	       Ti = FMA(KP500000000, Th, Tg);
+	       O[WS(os, 1)] = Tf + Ti;
+	       O[WS(os, 2)] = Tg - Th;
+	       Tj = FNMS(KP500000000, T9, Ta);
+	       O[WS(os, 3)] = FNMS(KP866025403, Tc + Td, Tj);
+	       O[WS(os, 4)] = FMA(KP866025403, Tc + Td, Tj);
+	       O[WS(os, 5)] = Ti - Tf;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 6, "e01_6", {9, 4, 12, 0}, &GENUS, REDFT01 };
+
+void X(codelet_e01_6) (planner *p) {
+     X(kr2r_register) (p, e01_6, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft01 -n 6 -name e01_6 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 20 FP additions, 14 FP multiplications,
+ * (or, 20 additions, 14 multiplications, 0 fused multiply/add),
+ * 21 stack variables, 8 constants, and 12 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e01_6(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DK(KP517638090, +0.517638090205041524697797675248096656698137803);
+     DK(KP1_931851652, +1.931851652578136573499486399457794735267809678);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP433012701, +0.433012701892219323381861585376468091735701313);
+     DK(KP750000000, +0.750000000000000000000000000000000000000000000);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(12, is), MAKE_VOLATILE_STRIDE(12, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = T5 + KP1_732050807 * T3;
+	       T8 = KP517638090 * T6 + KP1_931851652 * T2;
+	       T9 = T7 + T8;
+	       Ta = KP1_414213562 * T4;
+	       Tb = T1 + Ta;
+	       O[0] = T9 + Tb;
+	       Tc = T3 - KP1_732050807 * T5;
+	       Td = KP1_931851652 * T6 - KP517638090 * T2;
+	       Te = Tc - Td;
+	       Tf = T7 - T8;
+	       Tg = KP433012701 * Te - KP750000000 * Tf;
+	       Th = T1 - Ta;
+	       Ti = KP866025403 * Te + KP500000000 * Tf;
+	       Tj = Th + KP500000000 * Ti;
+	       O[WS(os, 1)] = Tg + Tj;
+	       O[WS(os, 2)] = Th - Ti;
+	       Tk = Tb - KP500000000 * T9;
+	       Tl = KP866025403 * (Tc + Td);
+	       O[WS(os, 3)] = Tk - Tl;
+	       O[WS(os, 4)] = Tl + Tk;
+	       O[WS(os, 5)] = Tj - Tg;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 6, "e01_6", {20, 14, 0, 0}, &GENUS, REDFT01 };
+
+void X(codelet_e01_6) (planner *p) {
+     X(kr2r_register) (p, e01_6, &desc);
+}
+
+#endif
@@ -0,0 +1,1334 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft01 -n 64 -name e01_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 476 FP additions, 270 FP multiplications,
+ * (or, 320 additions, 114 multiplications, 156 fused multiply/add),
+ * 436 stack variables, 78 constants, and 128 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e01_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       E T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       E T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       E T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       E T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       E T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       E T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       E T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       E T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       E T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       E T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       E T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       E T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       E T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       E T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       E T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       E T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       E T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       E T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       E T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       E T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       E T6Z, T70, T71, T72;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = I[WS(is, 32)];
+	       Ty = I[WS(is, 33)];
+	       Tz = I[WS(is, 34)];
+	       TA = I[WS(is, 35)];
+	       TB = I[WS(is, 36)];
+	       TC = I[WS(is, 37)];
+	       TD = I[WS(is, 38)];
+	       TE = I[WS(is, 39)];
+	       TF = I[WS(is, 40)];
+	       TG = I[WS(is, 41)];
+	       TH = I[WS(is, 42)];
+	       TI = I[WS(is, 43)];
+	       TJ = I[WS(is, 44)];
+	       TK = I[WS(is, 45)];
+	       TL = I[WS(is, 46)];
+	       TM = I[WS(is, 47)];
+	       TN = I[WS(is, 48)];
+	       TO = I[WS(is, 49)];
+	       TP = I[WS(is, 50)];
+	       TQ = I[WS(is, 51)];
+	       TR = I[WS(is, 52)];
+	       TS = I[WS(is, 53)];
+	       TT = I[WS(is, 54)];
+	       TU = I[WS(is, 55)];
+	       TV = I[WS(is, 56)];
+	       TW = I[WS(is, 57)];
+	       TX = I[WS(is, 58)];
+	       TY = I[WS(is, 59)];
+	       TZ = I[WS(is, 60)];
+	       T10 = I[WS(is, 61)];
+	       T11 = I[WS(is, 62)];
+	       T12 = I[WS(is, 63)];
+	       T13 = FMA(KP985796384, TI, KP1_740173982 * Tm);
+	       T14 = FMA(KP533425514, TS, KP1_927552131 * Tc);
+	       T15 = T13 + T14;
+	       T16 = FMA(KP1_230463181, TC, KP1_576692855 * Ts);
+	       T17 = FMA(KP244821350, TY, KP1_984959069 * T6);
+	       T18 = T16 + T17;
+	       T19 = T15 + T18;
+	       T1a = FMA(KP899222659, TK, KP1_786448602 * Tk);
+	       T1b = FMA(KP627363480, TQ, KP1_899056361 * Te);
+	       T1c = T1a + T1b;
+	       T1d = FMA(KP1_306345685, TA, KP1_514417693 * Tu);
+	       T1e = FMA(KP147129127, T10, KP1_994580913 * T4);
+	       T1f = T1d + T1e;
+	       T1g = T1c + T1f;
+	       T1h = T19 + T1g;
+	       T1i = FMA(KP1_069995239, TG, KP1_689707130 * To);
+	       T1j = FMA(KP438202480, TU, KP1_951404260 * Ta);
+	       T1k = T1i + T1j;
+	       T1l = FMA(KP1_151616382, TE, KP1_635169626 * Tq);
+	       T1m = FMA(KP341923777, TW, KP1_970555284 * T8);
+	       T1n = T1l + T1m;
+	       T1o = T1k + T1n;
+	       T1p = FMA(KP810482628, TM, KP1_828419511 * Ti);
+	       T1q = FMA(KP719790073, TO, KP1_865985597 * Tg);
+	       T1r = T1p + T1q;
+	       T1s = FMA(KP1_379081089, Ty, KP1_448494165 * Tw);
+	       T1t = FMA(KP049082457, T12, KP1_999397637 * T2);
+	       T1u = T1s + T1t;
+	       T1v = T1r + T1u;
+	       T1w = T1o + T1v;
+	       T1x = T1h + T1w;
+	       T1y = FMA(KP1_028205488, TH, KP1_715457220 * Tn);
+	       T1z = FMA(KP485960359, TT, KP1_940062506 * Tb);
+	       T1A = T1y + T1z;
+	       T1B = FMA(KP1_191398608, TD, KP1_606415062 * Tr);
+	       T1C = FMA(KP293460948, TX, KP1_978353019 * T7);
+	       T1D = T1B + T1C;
+	       T1E = T1A + T1D;
+	       T1F = FMA(KP855110186, TL, KP1_807978586 * Tj);
+	       T1G = FMA(KP673779706, TP, KP1_883088130 * Tf);
+	       T1H = T1F + T1G;
+	       T1I = FMA(KP1_343117909, Tz, KP1_481902250 * Tv);
+	       T1J = FMA(KP098135348, T11, KP1_997590912 * T3);
+	       T1K = T1I + T1J;
+	       T1L = T1H + T1K;
+	       T1M = T1E + T1L;
+	       T1N = FMA(KP942793473, TJ, KP1_763842528 * Tl);
+	       T1O = FMA(KP580569354, TR, KP1_913880671 * Td);
+	       T1P = T1N + T1O;
+	       T1Q = FMA(KP1_268786568, TB, KP1_546020906 * Tt);
+	       T1R = FMA(KP196034280, TZ, KP1_990369453 * T5);
+	       T1S = T1Q + T1R;
+	       T1T = T1P + T1S;
+	       T1U = FMA(KP1_111140466, TF, KP1_662939224 * Tp);
+	       T1V = FMA(KP390180644, TV, KP1_961570560 * T9);
+	       T1W = T1U + T1V;
+	       T1X = FMA(KP765366864, TN, KP1_847759065 * Th);
+	       T1Y = FMA(KP1_414213562, Tx, T1);
+	       T1Z = T1X + T1Y;
+	       T20 = T1W + T1Z;
+	       T21 = T1T + T20;
+	       T22 = T1M + T21;
+	       O[0] = T1x + T22;
+	       T23 = FNMS(KP1_414213562, Tx, T1);
+	       T24 = FMS(KP1_847759065, TN, KP765366864 * Th);
+	       T25 = T23 - T24;
+	       T26 = FMS(KP1_662939224, TF, KP1_111140466 * Tp);
+	       T27 = FMS(KP1_961570560, TV, KP390180644 * T9);
+	       T28 = T26 + T27;
+	       T29 = T1U - T1V;
+	       T2a = FNMS(KP707106781, T28 + T29, T25);
+	       T2b = FMS(KP1_763842528, TJ, KP942793473 * Tl);
+	       T2c = FMS(KP1_913880671, TR, KP580569354 * Td);
+	       T2d = T2b + T2c;
+	       T2e = T1Q - T1R;
+	       T2f = T2d + T2e;
+	       T2g = T1N - T1O;
+	       T2h = FMS(KP1_546020906, TB, KP1_268786568 * Tt);
+	       T2i = FMS(KP1_990369453, TZ, KP196034280 * T5);
+	       T2j = T2h + T2i;
+	       T2k = T2g + T2j;
+	       T2l = FMA(KP382683432, T2k, KP923879532 * T2f);
+	       T2m = T2a - T2l;
+	       T2n = FMS(KP1_715457220, TH, KP1_028205488 * Tn);
+	       T2o = FMS(KP1_940062506, TT, KP485960359 * Tb);
+	       T2p = T2n + T2o;
+	       T2q = T1B - T1C;
+	       T2r = T2p + T2q;
+	       T2s = T1y - T1z;
+	       T2t = FMS(KP1_606415062, TD, KP1_191398608 * Tr);
+	       T2u = FMS(KP1_978353019, TX, KP293460948 * T7);
+	       T2v = T2t + T2u;
+	       T2w = T2s + T2v;
+	       T2x = FMS(KP195090322, T2w, KP980785280 * T2r);
+	       T2y = FMS(KP1_807978586, TL, KP855110186 * Tj);
+	       T2z = FMS(KP1_883088130, TP, KP673779706 * Tf);
+	       T2A = T2y + T2z;
+	       T2B = T1I - T1J;
+	       T2C = T2A + T2B;
+	       T2D = T1F - T1G;
+	       T2E = FMS(KP1_481902250, Tz, KP1_343117909 * Tv);
+	       T2F = FMS(KP1_997590912, T11, KP098135348 * T3);
+	       T2G = T2E + T2F;
+	       T2H = T2D + T2G;
+	       T2I = FMA(KP831469612, T2H, KP555570233 * T2C);
+	       T2J = T2x - T2I;
+	       T2K = FMA(KP980785280, T2w, KP195090322 * T2r);
+	       T2L = FMS(KP555570233, T2H, KP831469612 * T2C);
+	       T2M = T2K - T2L;
+	       T2N = FMA(KP707106781, T2J - T2M, T2m);
+	       T2O = FMS(KP1_740173982, TI, KP985796384 * Tm);
+	       T2P = FMS(KP1_927552131, TS, KP533425514 * Tc);
+	       T2Q = T2O + T2P;
+	       T2R = T16 - T17;
+	       T2S = T2Q + T2R;
+	       T2T = T13 - T14;
+	       T2U = FMS(KP1_576692855, TC, KP1_230463181 * Ts);
+	       T2V = FMS(KP1_984959069, TY, KP244821350 * T6);
+	       T2W = T2U + T2V;
+	       T2X = T2T + T2W;
+	       T2Y = FMA(KP098017140, T2X, KP995184726 * T2S);
+	       T2Z = FMS(KP1_786448602, TK, KP899222659 * Tk);
+	       T30 = FMS(KP1_899056361, TQ, KP627363480 * Te);
+	       T31 = T2Z + T30;
+	       T32 = T1d - T1e;
+	       T33 = T31 + T32;
+	       T34 = T1a - T1b;
+	       T35 = FMS(KP1_514417693, TA, KP1_306345685 * Tu);
+	       T36 = FMS(KP1_994580913, T10, KP147129127 * T4);
+	       T37 = T35 + T36;
+	       T38 = T34 + T37;
+	       T39 = FMA(KP634393284, T38, KP773010453 * T33);
+	       T3a = T2Y + T39;
+	       T3b = FMS(KP1_689707130, TG, KP1_069995239 * To);
+	       T3c = FMS(KP1_951404260, TU, KP438202480 * Ta);
+	       T3d = T3b + T3c;
+	       T3e = T1l - T1m;
+	       T3f = T3d + T3e;
+	       T3g = T1i - T1j;
+	       T3h = FMS(KP1_635169626, TE, KP1_151616382 * Tq);
+	       T3i = FMS(KP1_970555284, TW, KP341923777 * T8);
+	       T3j = T3h + T3i;
+	       T3k = T3g + T3j;
+	       T3l = FMA(KP881921264, T3k, KP471396736 * T3f);
+	       T3m = FMS(KP1_828419511, TM, KP810482628 * Ti);
+	       T3n = FMS(KP1_865985597, TO, KP719790073 * Tg);
+	       T3o = T3m + T3n;
+	       T3p = T1s - T1t;
+	       T3q = T3o + T3p;
+	       T3r = T1p - T1q;
+	       T3s = FMS(KP1_448494165, Ty, KP1_379081089 * Tw);
+	       T3t = FMS(KP1_999397637, T12, KP049082457 * T2);
+	       T3u = T3s + T3t;
+	       T3v = T3r + T3u;
+	       T3w = FMS(KP290284677, T3v, KP956940335 * T3q);
+	       T3x = T3l - T3w;
+	       T3y = T3a + T3x;
+	       T3z = FMS(KP995184726, T2X, KP098017140 * T2S);
+	       T3A = FMS(KP773010453, T38, KP634393284 * T33);
+	       T3B = T3z - T3A;
+	       T3C = FMS(KP471396736, T3k, KP881921264 * T3f);
+	       T3D = FMA(KP956940335, T3v, KP290284677 * T3q);
+	       T3E = T3C - T3D;
+	       T3F = T3B - T3E;
+	       T3G = FMA(KP382683432, T3F, KP923879532 * T3y);
+	       O[WS(os, 1)] = T2N - T3G;
+	       T3H = T24 + T23;
+	       T3I = FMA(KP707106781, T28 - T29, T3H);
+	       T3J = T2e - T2d;
+	       T3K = T2g - T2j;
+	       T3L = FMA(KP382683432, T3K, KP923879532 * T3J);
+	       T3M = T3I - T3L;
+	       T3N = T2p - T2q;
+	       T3O = T2s - T2v;
+	       T3P = FMS(KP555570233, T3O, KP831469612 * T3N);
+	       T3Q = T2A - T2B;
+	       T3R = T2D - T2G;
+	       T3S = FMS(KP195090322, T3R, KP980785280 * T3Q);
+	       T3T = T3P + T3S;
+	       T3U = T3M - T3T;
+	       T3V = T2Q - T2R;
+	       T3W = T2T - T2W;
+	       T3X = FMS(KP471396736, T3W, KP881921264 * T3V);
+	       T3Y = T31 - T32;
+	       T3Z = T34 - T37;
+	       T40 = FMS(KP290284677, T3Z, KP956940335 * T3Y);
+	       T41 = T3X + T40;
+	       T42 = T3d - T3e;
+	       T43 = T3g - T3j;
+	       T44 = FMS(KP634393284, T43, KP773010453 * T42);
+	       T45 = T3o - T3p;
+	       T46 = T3r - T3u;
+	       T47 = FMS(KP098017140, T46, KP995184726 * T45);
+	       T48 = T44 + T47;
+	       T49 = T41 + T48;
+	       O[WS(os, 2)] = T3U - T49;
+	       T4a = T26 - T27;
+	       T4b = T1Y - T1X;
+	       T4c = T4a + T4b;
+	       T4d = T2b - T2c;
+	       T4e = T2h - T2i;
+	       T4f = T4d + T4e;
+	       T4g = T1P - T1S;
+	       T4h = FMA(KP707106781, T4f - T4g, T4c);
+	       T4i = T2n - T2o;
+	       T4j = T2t - T2u;
+	       T4k = T4i + T4j;
+	       T4l = T1H - T1K;
+	       T4m = T4k - T4l;
+	       T4n = T1A - T1D;
+	       T4o = T2y - T2z;
+	       T4p = T2E - T2F;
+	       T4q = T4o + T4p;
+	       T4r = T4n - T4q;
+	       T4s = FMS(KP382683432, T4r, KP923879532 * T4m);
+	       T4t = T4h - T4s;
+	       T4u = T2O - T2P;
+	       T4v = T2U - T2V;
+	       T4w = T4u + T4v;
+	       T4x = T1c - T1f;
+	       T4y = T4w - T4x;
+	       T4z = T15 - T18;
+	       T4A = T2Z - T30;
+	       T4B = T35 - T36;
+	       T4C = T4A + T4B;
+	       T4D = T4z - T4C;
+	       T4E = FMA(KP195090322, T4D, KP980785280 * T4y);
+	       T4F = T3b - T3c;
+	       T4G = T3h - T3i;
+	       T4H = T4F + T4G;
+	       T4I = T1r - T1u;
+	       T4J = T4H - T4I;
+	       T4K = T1k - T1n;
+	       T4L = T3m - T3n;
+	       T4M = T3s - T3t;
+	       T4N = T4L + T4M;
+	       T4O = T4K - T4N;
+	       T4P = FMS(KP831469612, T4O, KP555570233 * T4J);
+	       T4Q = T4E - T4P;
+	       T4R = FMS(KP980785280, T4D, KP195090322 * T4y);
+	       T4S = FMA(KP555570233, T4O, KP831469612 * T4J);
+	       T4T = T4R - T4S;
+	       O[WS(os, 3)] = FMA(KP707106781, T4Q - T4T, T4t);
+	       T4U = T4b - T4a;
+	       T4V = FNMS(KP707106781, T4f + T4g, T4U);
+	       T4W = T4k + T4l;
+	       T4X = T4n + T4q;
+	       T4Y = FMA(KP382683432, T4X, KP923879532 * T4W);
+	       T4Z = T4V - T4Y;
+	       T50 = T4w + T4x;
+	       T51 = T4z + T4C;
+	       T52 = FMA(KP555570233, T51, KP831469612 * T50);
+	       T53 = T4H + T4I;
+	       T54 = T4K + T4N;
+	       T55 = FMA(KP195090322, T54, KP980785280 * T53);
+	       T56 = T52 + T55;
+	       O[WS(os, 4)] = T4Z - T56;
+	       T57 = FMA(KP881921264, T3W, KP471396736 * T3V);
+	       T58 = FMA(KP956940335, T3Z, KP290284677 * T3Y);
+	       T59 = T57 + T58;
+	       T5a = T44 - T47;
+	       T5b = T59 + T5a;
+	       T5c = T3X - T40;
+	       T5d = FMA(KP773010453, T43, KP634393284 * T42);
+	       T5e = FMA(KP995184726, T46, KP098017140 * T45);
+	       T5f = T5d + T5e;
+	       T5g = T5c + T5f;
+	       T5h = FMA(KP382683432, T5g, KP923879532 * T5b);
+	       T5i = FNMS(KP707106781, T28 - T29, T3H);
+	       T5j = FMS(KP382683432, T3J, KP923879532 * T3K);
+	       T5k = T5i - T5j;
+	       T5l = FMA(KP831469612, T3O, KP555570233 * T3N);
+	       T5m = FMA(KP980785280, T3R, KP195090322 * T3Q);
+	       T5n = T5l + T5m;
+	       T5o = T3P - T3S;
+	       T5p = FMA(KP707106781, T5n + T5o, T5k);
+	       O[WS(os, 5)] = T5h + T5p;
+	       T5q = T3z + T3A;
+	       T5r = T3l + T3w;
+	       T5s = T5q + T5r;
+	       T5t = T2K + T2L;
+	       T5u = FMS(KP923879532, T2k, KP382683432 * T2f);
+	       T5v = FMA(KP707106781, T28 + T29, T25);
+	       T5w = T5u + T5v;
+	       T5x = T5t + T5w;
+	       O[WS(os, 6)] = T5s + T5x;
+	       T5y = T1Z - T1W;
+	       T5z = T4d - T4e;
+	       T5A = T5y - T5z;
+	       T5B = T4i - T4j;
+	       T5C = T4o - T4p;
+	       T5D = T5B + T5C;
+	       T5E = T1E - T1L;
+	       T5F = FNMS(KP707106781, T5D + T5E, T5A);
+	       T5G = T4u - T4v;
+	       T5H = T4A - T4B;
+	       T5I = T5G + T5H;
+	       T5J = T1o - T1v;
+	       T5K = T5I + T5J;
+	       T5L = T19 - T1g;
+	       T5M = T4F - T4G;
+	       T5N = T4L - T4M;
+	       T5O = T5M + T5N;
+	       T5P = T5L + T5O;
+	       T5Q = FMA(KP382683432, T5P, KP923879532 * T5K);
+	       O[WS(os, 7)] = T5F - T5Q;
+	       T5R = T5z + T5y;
+	       T5S = FMA(KP707106781, T5D - T5E, T5R);
+	       T5T = T5I - T5J;
+	       T5U = T5L - T5O;
+	       T5V = FMS(KP382683432, T5U, KP923879532 * T5T);
+	       O[WS(os, 8)] = T5S - T5V;
+	       T5W = T5v - T5u;
+	       T5X = T2x + T2I;
+	       T5Y = T5W - T5X;
+	       T5Z = T5q - T5r;
+	       T60 = T2Y - T39;
+	       T61 = T3C + T3D;
+	       T62 = T60 - T61;
+	       O[WS(os, 9)] = FNMS(KP707106781, T5Z - T62, T5Y);
+	       T63 = T5j + T5i;
+	       T64 = FNMS(KP707106781, T5n - T5o, T63);
+	       T65 = T5c - T5f;
+	       T66 = T59 - T5a;
+	       T67 = FMS(KP923879532, T66, KP382683432 * T65);
+	       O[WS(os, 10)] = T64 - T67;
+	       T68 = FMS(KP923879532, T4X, KP382683432 * T4W);
+	       T69 = FMA(KP707106781, T4f + T4g, T4U);
+	       T6a = T68 + T69;
+	       T6b = FMS(KP831469612, T51, KP555570233 * T50);
+	       T6c = FMS(KP980785280, T54, KP195090322 * T53);
+	       T6d = T6b + T6c;
+	       T6e = T52 - T55;
+	       O[WS(os, 11)] = FMA(KP707106781, T6d + T6e, T6a);
+	       T6f = T4R + T4S;
+	       T6g = FMA(KP923879532, T4r, KP382683432 * T4m);
+	       T6h = FNMS(KP707106781, T4f - T4g, T4c);
+	       T6i = T6g + T6h;
+	       O[WS(os, 12)] = T6f + T6i;
+	       T6j = T3I + T3L;
+	       T6k = T5l - T5m;
+	       T6l = T6j - T6k;
+	       T6m = T57 - T58;
+	       T6n = T5d - T5e;
+	       T6o = T6m + T6n;
+	       T6p = T41 - T48;
+	       O[WS(os, 13)] = FNMS(KP707106781, T6o - T6p, T6l);
+	       T6q = T2l + T2a;
+	       T6r = FNMS(KP707106781, T2J + T2M, T6q);
+	       T6s = T3a - T3x;
+	       T6t = T3B + T3E;
+	       T6u = FMS(KP382683432, T6t, KP923879532 * T6s);
+	       O[WS(os, 14)] = T6r - T6u;
+	       T6v = T5B - T5C;
+	       T6w = T20 - T1T;
+	       T6x = T6v + T6w;
+	       T6y = T5G - T5H;
+	       T6z = T5M - T5N;
+	       T6A = T6y + T6z;
+	       T6B = T1h - T1w;
+	       O[WS(os, 15)] = FMA(KP707106781, T6A - T6B, T6x);
+	       T6C = T6w - T6v;
+	       O[WS(os, 16)] = FNMS(KP707106781, T6A + T6B, T6C);
+	       T6D = FMA(KP923879532, T6t, KP382683432 * T6s);
+	       T6E = FMA(KP707106781, T2J + T2M, T6q);
+	       O[WS(os, 17)] = T6D + T6E;
+	       T6F = T6k + T6j;
+	       O[WS(os, 18)] = FMA(KP707106781, T6o + T6p, T6F);
+	       T6G = T6h - T6g;
+	       T6H = T4E + T4P;
+	       O[WS(os, 19)] = T6G - T6H;
+	       T6I = T69 - T68;
+	       O[WS(os, 20)] = FNMS(KP707106781, T6d - T6e, T6I);
+	       T6J = FMA(KP707106781, T5n - T5o, T63);
+	       T6K = FMA(KP923879532, T65, KP382683432 * T66);
+	       O[WS(os, 21)] = T6J - T6K;
+	       T6L = T5X + T5W;
+	       O[WS(os, 22)] = FNMS(KP707106781, T62 + T5Z, T6L);
+	       T6M = FMA(KP923879532, T5U, KP382683432 * T5T);
+	       T6N = FNMS(KP707106781, T5D - T5E, T5R);
+	       O[WS(os, 23)] = T6M + T6N;
+	       T6O = FMS(KP923879532, T5P, KP382683432 * T5K);
+	       T6P = FMA(KP707106781, T5D + T5E, T5A);
+	       O[WS(os, 24)] = T6O + T6P;
+	       T6Q = T5w - T5t;
+	       T6R = T60 + T61;
+	       O[WS(os, 25)] = T6Q - T6R;
+	       T6S = FNMS(KP707106781, T5n + T5o, T5k);
+	       T6T = FMS(KP923879532, T5g, KP382683432 * T5b);
+	       O[WS(os, 26)] = T6S - T6T;
+	       T6U = T4Y + T4V;
+	       T6V = T6b - T6c;
+	       O[WS(os, 27)] = T6U - T6V;
+	       T6W = T4s + T4h;
+	       O[WS(os, 28)] = FNMS(KP707106781, T4Q + T4T, T6W);
+	       T6X = T6m - T6n;
+	       T6Y = T3T + T3M;
+	       O[WS(os, 29)] = T6X + T6Y;
+	       T6Z = FNMS(KP707106781, T2J - T2M, T2m);
+	       T70 = FMS(KP382683432, T3y, KP923879532 * T3F);
+	       O[WS(os, 30)] = T6Z - T70;
+	       T71 = T21 - T1M;
+	       T72 = T6y - T6z;
+	       O[WS(os, 31)] = T71 - T72;
+	       O[WS(os, 32)] = T72 + T71;
+	       O[WS(os, 33)] = T70 + T6Z;
+	       O[WS(os, 34)] = T6Y - T6X;
+	       O[WS(os, 35)] = FMA(KP707106781, T4Q + T4T, T6W);
+	       O[WS(os, 36)] = T6V + T6U;
+	       O[WS(os, 37)] = T6T + T6S;
+	       O[WS(os, 38)] = T6R + T6Q;
+	       O[WS(os, 39)] = T6P - T6O;
+	       O[WS(os, 40)] = T6N - T6M;
+	       O[WS(os, 41)] = FMA(KP707106781, T62 + T5Z, T6L);
+	       O[WS(os, 42)] = T6K + T6J;
+	       O[WS(os, 43)] = FMA(KP707106781, T6d - T6e, T6I);
+	       O[WS(os, 44)] = T6H + T6G;
+	       O[WS(os, 45)] = FNMS(KP707106781, T6o + T6p, T6F);
+	       O[WS(os, 46)] = T6E - T6D;
+	       O[WS(os, 47)] = FMA(KP707106781, T6A + T6B, T6C);
+	       O[WS(os, 48)] = FNMS(KP707106781, T6A - T6B, T6x);
+	       O[WS(os, 49)] = T6u + T6r;
+	       O[WS(os, 50)] = FMA(KP707106781, T6o - T6p, T6l);
+	       O[WS(os, 51)] = T6i - T6f;
+	       O[WS(os, 52)] = FNMS(KP707106781, T6d + T6e, T6a);
+	       O[WS(os, 53)] = T67 + T64;
+	       O[WS(os, 54)] = FMA(KP707106781, T5Z - T62, T5Y);
+	       O[WS(os, 55)] = T5V + T5S;
+	       O[WS(os, 56)] = T5Q + T5F;
+	       O[WS(os, 57)] = T5x - T5s;
+	       O[WS(os, 58)] = T5p - T5h;
+	       O[WS(os, 59)] = T56 + T4Z;
+	       O[WS(os, 60)] = FNMS(KP707106781, T4Q - T4T, T4t);
+	       O[WS(os, 61)] = T49 + T3U;
+	       O[WS(os, 62)] = T3G + T2N;
+	       O[WS(os, 63)] = T22 - T1x;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 64, "e01_64", {320, 114, 156, 0}, &GENUS, REDFT01 };
+
+void X(codelet_e01_64) (planner *p) {
+     X(kr2r_register) (p, e01_64, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft01 -n 64 -name e01_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 456 FP additions, 249 FP multiplications,
+ * (or, 456 additions, 249 multiplications, 0 fused multiply/add),
+ * 457 stack variables, 78 constants, and 128 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e01_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       E T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       E T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       E T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       E T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       E T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       E T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       E T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       E T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       E T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       E T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       E T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       E T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       E T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       E T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       E T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       E T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       E T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       E T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       E T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       E T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       E T6Z, T70, T71, T72, T73, T74, T75, T76, T77, T78, T79, T7a;
+	       E T7b, T7c, T7d, T7e, T7f, T7g, T7h, T7i, T7j, T7k, T7l, T7m;
+	       E T7n;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = I[WS(is, 32)];
+	       Ty = I[WS(is, 33)];
+	       Tz = I[WS(is, 34)];
+	       TA = I[WS(is, 35)];
+	       TB = I[WS(is, 36)];
+	       TC = I[WS(is, 37)];
+	       TD = I[WS(is, 38)];
+	       TE = I[WS(is, 39)];
+	       TF = I[WS(is, 40)];
+	       TG = I[WS(is, 41)];
+	       TH = I[WS(is, 42)];
+	       TI = I[WS(is, 43)];
+	       TJ = I[WS(is, 44)];
+	       TK = I[WS(is, 45)];
+	       TL = I[WS(is, 46)];
+	       TM = I[WS(is, 47)];
+	       TN = I[WS(is, 48)];
+	       TO = I[WS(is, 49)];
+	       TP = I[WS(is, 50)];
+	       TQ = I[WS(is, 51)];
+	       TR = I[WS(is, 52)];
+	       TS = I[WS(is, 53)];
+	       TT = I[WS(is, 54)];
+	       TU = I[WS(is, 55)];
+	       TV = I[WS(is, 56)];
+	       TW = I[WS(is, 57)];
+	       TX = I[WS(is, 58)];
+	       TY = I[WS(is, 59)];
+	       TZ = I[WS(is, 60)];
+	       T10 = I[WS(is, 61)];
+	       T11 = I[WS(is, 62)];
+	       T12 = I[WS(is, 63)];
+	       T13 = KP985796384 * TI + KP1_740173982 * Tm;
+	       T14 = KP533425514 * TS + KP1_927552131 * Tc;
+	       T15 = T13 + T14;
+	       T16 = KP1_230463181 * TC + KP1_576692855 * Ts;
+	       T17 = KP244821350 * TY + KP1_984959069 * T6;
+	       T18 = T16 + T17;
+	       T19 = T15 + T18;
+	       T1a = KP899222659 * TK + KP1_786448602 * Tk;
+	       T1b = KP627363480 * TQ + KP1_899056361 * Te;
+	       T1c = T1a + T1b;
+	       T1d = KP1_306345685 * TA + KP1_514417693 * Tu;
+	       T1e = KP147129127 * T10 + KP1_994580913 * T4;
+	       T1f = T1d + T1e;
+	       T1g = T1c + T1f;
+	       T1h = T19 + T1g;
+	       T1i = KP1_069995239 * TG + KP1_689707130 * To;
+	       T1j = KP438202480 * TU + KP1_951404260 * Ta;
+	       T1k = T1i + T1j;
+	       T1l = KP1_151616382 * TE + KP1_635169626 * Tq;
+	       T1m = KP341923777 * TW + KP1_970555284 * T8;
+	       T1n = T1l + T1m;
+	       T1o = T1k + T1n;
+	       T1p = KP810482628 * TM + KP1_828419511 * Ti;
+	       T1q = KP719790073 * TO + KP1_865985597 * Tg;
+	       T1r = T1p + T1q;
+	       T1s = KP1_379081089 * Ty + KP1_448494165 * Tw;
+	       T1t = KP049082457 * T12 + KP1_999397637 * T2;
+	       T1u = T1s + T1t;
+	       T1v = T1r + T1u;
+	       T1w = T1o + T1v;
+	       T1x = T1h + T1w;
+	       T1y = KP1_028205488 * TH + KP1_715457220 * Tn;
+	       T1z = KP485960359 * TT + KP1_940062506 * Tb;
+	       T1A = T1y + T1z;
+	       T1B = KP1_191398608 * TD + KP1_606415062 * Tr;
+	       T1C = KP293460948 * TX + KP1_978353019 * T7;
+	       T1D = T1B + T1C;
+	       T1E = T1A + T1D;
+	       T1F = KP855110186 * TL + KP1_807978586 * Tj;
+	       T1G = KP673779706 * TP + KP1_883088130 * Tf;
+	       T1H = T1F + T1G;
+	       T1I = KP1_343117909 * Tz + KP1_481902250 * Tv;
+	       T1J = KP098135348 * T11 + KP1_997590912 * T3;
+	       T1K = T1I + T1J;
+	       T1L = T1H + T1K;
+	       T1M = T1E + T1L;
+	       T1N = KP942793473 * TJ + KP1_763842528 * Tl;
+	       T1O = KP580569354 * TR + KP1_913880671 * Td;
+	       T1P = T1N + T1O;
+	       T1Q = KP1_268786568 * TB + KP1_546020906 * Tt;
+	       T1R = KP196034280 * TZ + KP1_990369453 * T5;
+	       T1S = T1Q + T1R;
+	       T1T = T1P + T1S;
+	       T1U = KP1_111140466 * TF + KP1_662939224 * Tp;
+	       T1V = KP390180644 * TV + KP1_961570560 * T9;
+	       T1W = T1U + T1V;
+	       T1X = KP765366864 * TN + KP1_847759065 * Th;
+	       T1Y = KP1_414213562 * Tx;
+	       T1Z = T1 + T1Y;
+	       T20 = T1X + T1Z;
+	       T21 = T1W + T20;
+	       T22 = T1T + T21;
+	       T23 = T1M + T22;
+	       O[0] = T1x + T23;
+	       T24 = T1y - T1z;
+	       T25 = KP1_606415062 * TD - KP1_191398608 * Tr;
+	       T26 = KP1_978353019 * TX - KP293460948 * T7;
+	       T27 = T25 + T26;
+	       T28 = T24 + T27;
+	       T29 = KP1_715457220 * TH - KP1_028205488 * Tn;
+	       T2a = KP1_940062506 * TT - KP485960359 * Tb;
+	       T2b = T29 + T2a;
+	       T2c = T1B - T1C;
+	       T2d = T2b + T2c;
+	       T2e = KP195090322 * T28 - KP980785280 * T2d;
+	       T2f = T1F - T1G;
+	       T2g = KP1_481902250 * Tz - KP1_343117909 * Tv;
+	       T2h = KP1_997590912 * T11 - KP098135348 * T3;
+	       T2i = T2g + T2h;
+	       T2j = T2f + T2i;
+	       T2k = KP1_807978586 * TL - KP855110186 * Tj;
+	       T2l = KP1_883088130 * TP - KP673779706 * Tf;
+	       T2m = T2k + T2l;
+	       T2n = T1I - T1J;
+	       T2o = T2m + T2n;
+	       T2p = KP831469612 * T2j + KP555570233 * T2o;
+	       T2q = T2e - T2p;
+	       T2r = KP980785280 * T28 + KP195090322 * T2d;
+	       T2s = KP555570233 * T2j - KP831469612 * T2o;
+	       T2t = T2r - T2s;
+	       T2u = KP707106781 * (T2q - T2t);
+	       T2v = T1 - T1Y;
+	       T2w = KP1_847759065 * TN - KP765366864 * Th;
+	       T2x = T2v - T2w;
+	       T2y = KP1_662939224 * TF - KP1_111140466 * Tp;
+	       T2z = KP1_961570560 * TV - KP390180644 * T9;
+	       T2A = T2y + T2z;
+	       T2B = T1U - T1V;
+	       T2C = KP707106781 * (T2A + T2B);
+	       T2D = T2x - T2C;
+	       T2E = T1N - T1O;
+	       T2F = KP1_546020906 * TB - KP1_268786568 * Tt;
+	       T2G = KP1_990369453 * TZ - KP196034280 * T5;
+	       T2H = T2F + T2G;
+	       T2I = T2E + T2H;
+	       T2J = KP1_763842528 * TJ - KP942793473 * Tl;
+	       T2K = KP1_913880671 * TR - KP580569354 * Td;
+	       T2L = T2J + T2K;
+	       T2M = T1Q - T1R;
+	       T2N = T2L + T2M;
+	       T2O = KP382683432 * T2I + KP923879532 * T2N;
+	       T2P = T2D - T2O;
+	       T2Q = T2u + T2P;
+	       T2R = T13 - T14;
+	       T2S = KP1_576692855 * TC - KP1_230463181 * Ts;
+	       T2T = KP1_984959069 * TY - KP244821350 * T6;
+	       T2U = T2S + T2T;
+	       T2V = T2R + T2U;
+	       T2W = KP1_740173982 * TI - KP985796384 * Tm;
+	       T2X = KP1_927552131 * TS - KP533425514 * Tc;
+	       T2Y = T2W + T2X;
+	       T2Z = T16 - T17;
+	       T30 = T2Y + T2Z;
+	       T31 = KP995184726 * T2V - KP098017140 * T30;
+	       T32 = T1a - T1b;
+	       T33 = KP1_514417693 * TA - KP1_306345685 * Tu;
+	       T34 = KP1_994580913 * T10 - KP147129127 * T4;
+	       T35 = T33 + T34;
+	       T36 = T32 + T35;
+	       T37 = KP1_786448602 * TK - KP899222659 * Tk;
+	       T38 = KP1_899056361 * TQ - KP627363480 * Te;
+	       T39 = T37 + T38;
+	       T3a = T1d - T1e;
+	       T3b = T39 + T3a;
+	       T3c = KP773010453 * T36 - KP634393284 * T3b;
+	       T3d = T31 - T3c;
+	       T3e = T1i - T1j;
+	       T3f = KP1_635169626 * TE - KP1_151616382 * Tq;
+	       T3g = KP1_970555284 * TW - KP341923777 * T8;
+	       T3h = T3f + T3g;
+	       T3i = T3e + T3h;
+	       T3j = KP1_689707130 * TG - KP1_069995239 * To;
+	       T3k = KP1_951404260 * TU - KP438202480 * Ta;
+	       T3l = T3j + T3k;
+	       T3m = T1l - T1m;
+	       T3n = T3l + T3m;
+	       T3o = KP471396736 * T3i - KP881921264 * T3n;
+	       T3p = T1p - T1q;
+	       T3q = KP1_448494165 * Ty - KP1_379081089 * Tw;
+	       T3r = KP1_999397637 * T12 - KP049082457 * T2;
+	       T3s = T3q + T3r;
+	       T3t = T3p + T3s;
+	       T3u = KP1_828419511 * TM - KP810482628 * Ti;
+	       T3v = KP1_865985597 * TO - KP719790073 * Tg;
+	       T3w = T3u + T3v;
+	       T3x = T1s - T1t;
+	       T3y = T3w + T3x;
+	       T3z = KP956940335 * T3t + KP290284677 * T3y;
+	       T3A = T3o - T3z;
+	       T3B = T3d - T3A;
+	       T3C = KP098017140 * T2V + KP995184726 * T30;
+	       T3D = KP634393284 * T36 + KP773010453 * T3b;
+	       T3E = T3C + T3D;
+	       T3F = KP881921264 * T3i + KP471396736 * T3n;
+	       T3G = KP290284677 * T3t - KP956940335 * T3y;
+	       T3H = T3F - T3G;
+	       T3I = T3E + T3H;
+	       T3J = KP382683432 * T3B + KP923879532 * T3I;
+	       O[WS(os, 1)] = T2Q - T3J;
+	       T3K = KP707106781 * (T2A - T2B);
+	       T3L = T2w + T2v;
+	       T3M = T3K + T3L;
+	       T3N = T2E - T2H;
+	       T3O = T2M - T2L;
+	       T3P = KP382683432 * T3N + KP923879532 * T3O;
+	       T3Q = T3M - T3P;
+	       T3R = T24 - T27;
+	       T3S = T2b - T2c;
+	       T3T = KP555570233 * T3R - KP831469612 * T3S;
+	       T3U = T2f - T2i;
+	       T3V = T2m - T2n;
+	       T3W = KP195090322 * T3U - KP980785280 * T3V;
+	       T3X = T3T + T3W;
+	       T3Y = T3Q - T3X;
+	       T3Z = T2R - T2U;
+	       T40 = T2Y - T2Z;
+	       T41 = KP471396736 * T3Z - KP881921264 * T40;
+	       T42 = T32 - T35;
+	       T43 = T39 - T3a;
+	       T44 = KP290284677 * T42 - KP956940335 * T43;
+	       T45 = T41 + T44;
+	       T46 = T3e - T3h;
+	       T47 = T3l - T3m;
+	       T48 = KP634393284 * T46 - KP773010453 * T47;
+	       T49 = T3p - T3s;
+	       T4a = T3w - T3x;
+	       T4b = KP098017140 * T49 - KP995184726 * T4a;
+	       T4c = T48 + T4b;
+	       T4d = T45 + T4c;
+	       O[WS(os, 2)] = T3Y - T4d;
+	       T4e = T15 - T18;
+	       T4f = T37 - T38;
+	       T4g = T33 - T34;
+	       T4h = T4f + T4g;
+	       T4i = T4e - T4h;
+	       T4j = T2W - T2X;
+	       T4k = T2S - T2T;
+	       T4l = T4j + T4k;
+	       T4m = T1c - T1f;
+	       T4n = T4l - T4m;
+	       T4o = KP195090322 * T4i + KP980785280 * T4n;
+	       T4p = T1k - T1n;
+	       T4q = T3u - T3v;
+	       T4r = T3q - T3r;
+	       T4s = T4q + T4r;
+	       T4t = T4p - T4s;
+	       T4u = T3j - T3k;
+	       T4v = T3f - T3g;
+	       T4w = T4u + T4v;
+	       T4x = T1r - T1u;
+	       T4y = T4w - T4x;
+	       T4z = KP831469612 * T4t - KP555570233 * T4y;
+	       T4A = T4o - T4z;
+	       T4B = KP980785280 * T4i - KP195090322 * T4n;
+	       T4C = KP555570233 * T4t + KP831469612 * T4y;
+	       T4D = T4B - T4C;
+	       T4E = KP707106781 * (T4A - T4D);
+	       T4F = T2J - T2K;
+	       T4G = T2F - T2G;
+	       T4H = T4F + T4G;
+	       T4I = T1P - T1S;
+	       T4J = KP707106781 * (T4H - T4I);
+	       T4K = T2y - T2z;
+	       T4L = T1Z - T1X;
+	       T4M = T4K + T4L;
+	       T4N = T4J + T4M;
+	       T4O = T1A - T1D;
+	       T4P = T2k - T2l;
+	       T4Q = T2g - T2h;
+	       T4R = T4P + T4Q;
+	       T4S = T4O - T4R;
+	       T4T = T29 - T2a;
+	       T4U = T25 - T26;
+	       T4V = T4T + T4U;
+	       T4W = T1H - T1K;
+	       T4X = T4V - T4W;
+	       T4Y = KP382683432 * T4S - KP923879532 * T4X;
+	       T4Z = T4N - T4Y;
+	       O[WS(os, 3)] = T4E + T4Z;
+	       T50 = T4L - T4K;
+	       T51 = KP707106781 * (T4H + T4I);
+	       T52 = T50 - T51;
+	       T53 = T4O + T4R;
+	       T54 = T4V + T4W;
+	       T55 = KP382683432 * T53 + KP923879532 * T54;
+	       T56 = T52 - T55;
+	       T57 = T4e + T4h;
+	       T58 = T4l + T4m;
+	       T59 = KP555570233 * T57 + KP831469612 * T58;
+	       T5a = T4p + T4s;
+	       T5b = T4w + T4x;
+	       T5c = KP195090322 * T5a + KP980785280 * T5b;
+	       T5d = T59 + T5c;
+	       O[WS(os, 4)] = T56 - T5d;
+	       T5e = T41 - T44;
+	       T5f = KP773010453 * T46 + KP634393284 * T47;
+	       T5g = KP995184726 * T49 + KP098017140 * T4a;
+	       T5h = T5f + T5g;
+	       T5i = T5e + T5h;
+	       T5j = KP881921264 * T3Z + KP471396736 * T40;
+	       T5k = KP956940335 * T42 + KP290284677 * T43;
+	       T5l = T5j + T5k;
+	       T5m = T48 - T4b;
+	       T5n = T5l + T5m;
+	       T5o = KP382683432 * T5i + KP923879532 * T5n;
+	       T5p = KP831469612 * T3R + KP555570233 * T3S;
+	       T5q = KP980785280 * T3U + KP195090322 * T3V;
+	       T5r = T5p + T5q;
+	       T5s = T3T - T3W;
+	       T5t = KP707106781 * (T5r + T5s);
+	       T5u = T3L - T3K;
+	       T5v = KP382683432 * T3O - KP923879532 * T3N;
+	       T5w = T5u - T5v;
+	       T5x = T5t + T5w;
+	       O[WS(os, 5)] = T5o + T5x;
+	       T5y = T31 + T3c;
+	       T5z = T3F + T3G;
+	       T5A = T5y + T5z;
+	       T5B = T2r + T2s;
+	       T5C = KP923879532 * T2I - KP382683432 * T2N;
+	       T5D = T2C + T2x;
+	       T5E = T5C + T5D;
+	       T5F = T5B + T5E;
+	       O[WS(os, 6)] = T5A + T5F;
+	       T5G = T20 - T1W;
+	       T5H = T4F - T4G;
+	       T5I = T5G - T5H;
+	       T5J = T4T - T4U;
+	       T5K = T4P - T4Q;
+	       T5L = T5J + T5K;
+	       T5M = T1E - T1L;
+	       T5N = KP707106781 * (T5L + T5M);
+	       T5O = T5I - T5N;
+	       T5P = T19 - T1g;
+	       T5Q = T4u - T4v;
+	       T5R = T4q - T4r;
+	       T5S = T5Q + T5R;
+	       T5T = T5P + T5S;
+	       T5U = T4j - T4k;
+	       T5V = T4f - T4g;
+	       T5W = T5U + T5V;
+	       T5X = T1o - T1v;
+	       T5Y = T5W + T5X;
+	       T5Z = KP382683432 * T5T + KP923879532 * T5Y;
+	       O[WS(os, 7)] = T5O - T5Z;
+	       T60 = KP707106781 * (T5L - T5M);
+	       T61 = T5H + T5G;
+	       T62 = T60 + T61;
+	       T63 = T5P - T5S;
+	       T64 = T5W - T5X;
+	       T65 = KP382683432 * T63 - KP923879532 * T64;
+	       O[WS(os, 8)] = T62 - T65;
+	       T66 = T5D - T5C;
+	       T67 = T2e + T2p;
+	       T68 = T66 - T67;
+	       T69 = T5y - T5z;
+	       T6a = T3C - T3D;
+	       T6b = T3o + T3z;
+	       T6c = T6a - T6b;
+	       T6d = KP707106781 * (T69 - T6c);
+	       O[WS(os, 9)] = T68 - T6d;
+	       T6e = T5v + T5u;
+	       T6f = KP707106781 * (T5r - T5s);
+	       T6g = T6e - T6f;
+	       T6h = T5l - T5m;
+	       T6i = T5e - T5h;
+	       T6j = KP923879532 * T6h - KP382683432 * T6i;
+	       O[WS(os, 10)] = T6g - T6j;
+	       T6k = KP831469612 * T57 - KP555570233 * T58;
+	       T6l = KP980785280 * T5a - KP195090322 * T5b;
+	       T6m = T6k + T6l;
+	       T6n = T59 - T5c;
+	       T6o = KP707106781 * (T6m + T6n);
+	       T6p = KP923879532 * T53 - KP382683432 * T54;
+	       T6q = T51 + T50;
+	       T6r = T6p + T6q;
+	       O[WS(os, 11)] = T6o + T6r;
+	       T6s = T4B + T4C;
+	       T6t = KP923879532 * T4S + KP382683432 * T4X;
+	       T6u = T4M - T4J;
+	       T6v = T6t + T6u;
+	       O[WS(os, 12)] = T6s + T6v;
+	       T6w = T3M + T3P;
+	       T6x = T5p - T5q;
+	       T6y = T6w - T6x;
+	       T6z = T5j - T5k;
+	       T6A = T5f - T5g;
+	       T6B = T6z + T6A;
+	       T6C = T45 - T4c;
+	       T6D = KP707106781 * (T6B - T6C);
+	       O[WS(os, 13)] = T6y - T6D;
+	       T6E = T2O + T2D;
+	       T6F = KP707106781 * (T2q + T2t);
+	       T6G = T6E - T6F;
+	       T6H = T3d + T3A;
+	       T6I = T3E - T3H;
+	       T6J = KP382683432 * T6H - KP923879532 * T6I;
+	       O[WS(os, 14)] = T6G - T6J;
+	       T6K = T5U - T5V;
+	       T6L = T5Q - T5R;
+	       T6M = T6K + T6L;
+	       T6N = T1h - T1w;
+	       T6O = KP707106781 * (T6M - T6N);
+	       T6P = T5J - T5K;
+	       T6Q = T21 - T1T;
+	       T6R = T6P + T6Q;
+	       O[WS(os, 15)] = T6O + T6R;
+	       T6S = T6Q - T6P;
+	       T6T = KP707106781 * (T6M + T6N);
+	       O[WS(os, 16)] = T6S - T6T;
+	       T6U = KP923879532 * T6H + KP382683432 * T6I;
+	       T6V = T6F + T6E;
+	       O[WS(os, 17)] = T6U + T6V;
+	       T6W = KP707106781 * (T6B + T6C);
+	       T6X = T6x + T6w;
+	       O[WS(os, 18)] = T6W + T6X;
+	       T6Y = T6u - T6t;
+	       T6Z = T4o + T4z;
+	       O[WS(os, 19)] = T6Y - T6Z;
+	       T70 = T6q - T6p;
+	       T71 = KP707106781 * (T6m - T6n);
+	       O[WS(os, 20)] = T70 - T71;
+	       T72 = T6f + T6e;
+	       T73 = KP923879532 * T6i + KP382683432 * T6h;
+	       O[WS(os, 21)] = T72 - T73;
+	       T74 = T67 + T66;
+	       T75 = KP707106781 * (T6c + T69);
+	       O[WS(os, 22)] = T74 - T75;
+	       T76 = KP923879532 * T63 + KP382683432 * T64;
+	       T77 = T61 - T60;
+	       O[WS(os, 23)] = T76 + T77;
+	       T78 = KP923879532 * T5T - KP382683432 * T5Y;
+	       T79 = T5N + T5I;
+	       O[WS(os, 24)] = T78 + T79;
+	       T7a = T5E - T5B;
+	       T7b = T6a + T6b;
+	       O[WS(os, 25)] = T7a - T7b;
+	       T7c = T5w - T5t;
+	       T7d = KP923879532 * T5i - KP382683432 * T5n;
+	       O[WS(os, 26)] = T7c - T7d;
+	       T7e = T55 + T52;
+	       T7f = T6k - T6l;
+	       O[WS(os, 27)] = T7e - T7f;
+	       T7g = T4Y + T4N;
+	       T7h = KP707106781 * (T4A + T4D);
+	       O[WS(os, 28)] = T7g - T7h;
+	       T7i = T6z - T6A;
+	       T7j = T3X + T3Q;
+	       O[WS(os, 29)] = T7i + T7j;
+	       T7k = T2P - T2u;
+	       T7l = KP382683432 * T3I - KP923879532 * T3B;
+	       O[WS(os, 30)] = T7k - T7l;
+	       T7m = T22 - T1M;
+	       T7n = T6K - T6L;
+	       O[WS(os, 31)] = T7m - T7n;
+	       O[WS(os, 32)] = T7n + T7m;
+	       O[WS(os, 33)] = T7l + T7k;
+	       O[WS(os, 34)] = T7j - T7i;
+	       O[WS(os, 35)] = T7h + T7g;
+	       O[WS(os, 36)] = T7f + T7e;
+	       O[WS(os, 37)] = T7d + T7c;
+	       O[WS(os, 38)] = T7b + T7a;
+	       O[WS(os, 39)] = T79 - T78;
+	       O[WS(os, 40)] = T77 - T76;
+	       O[WS(os, 41)] = T75 + T74;
+	       O[WS(os, 42)] = T73 + T72;
+	       O[WS(os, 43)] = T71 + T70;
+	       O[WS(os, 44)] = T6Z + T6Y;
+	       O[WS(os, 45)] = T6X - T6W;
+	       O[WS(os, 46)] = T6V - T6U;
+	       O[WS(os, 47)] = T6T + T6S;
+	       O[WS(os, 48)] = T6R - T6O;
+	       O[WS(os, 49)] = T6J + T6G;
+	       O[WS(os, 50)] = T6D + T6y;
+	       O[WS(os, 51)] = T6v - T6s;
+	       O[WS(os, 52)] = T6r - T6o;
+	       O[WS(os, 53)] = T6j + T6g;
+	       O[WS(os, 54)] = T6d + T68;
+	       O[WS(os, 55)] = T65 + T62;
+	       O[WS(os, 56)] = T5Z + T5O;
+	       O[WS(os, 57)] = T5F - T5A;
+	       O[WS(os, 58)] = T5x - T5o;
+	       O[WS(os, 59)] = T5d + T56;
+	       O[WS(os, 60)] = T4Z - T4E;
+	       O[WS(os, 61)] = T4d + T3Y;
+	       O[WS(os, 62)] = T3J + T2Q;
+	       O[WS(os, 63)] = T23 - T1x;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 64, "e01_64", {456, 249, 0, 0}, &GENUS, REDFT01 };
+
+void X(codelet_e01_64) (planner *p) {
+     X(kr2r_register) (p, e01_64, &desc);
+}
+
+#endif
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft10 -n 12 -name e10_12 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 54 FP additions, 36 FP multiplications,
+ * (or, 32 additions, 14 multiplications, 22 fused multiply/add),
+ * 50 stack variables, 15 constants, and 24 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e10_12(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP261052384, +0.261052384440103183096812455790978020387481410);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP433012701, +0.433012701892219323381861585376468091735701313);
+     DK(KP750000000, +0.750000000000000000000000000000000000000000000);
+     DK(KP1_982889722, +1.982889722747620822289115053857125742555476549);
+     DK(KP517638090, +0.517638090205041524697797675248096656698137803);
+     DK(KP1_931851652, +1.931851652578136573499486399457794735267809678);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DK(KP1_217522858, +1.217522858017441278832195085796328009032787424);
+     DK(KP1_586706680, +1.586706680582470329159553923002598553257351842);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(24, is), MAKE_VOLATILE_STRIDE(24, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = T8 + T9;
+	       Te = T1 + Td;
+	       Tf = T4 + Tc;
+	       Tg = T5 + Tf;
+	       Th = Te + Tg;
+	       Ti = T6 + Tb;
+	       Tj = T3 + Ti;
+	       Tk = T2 + Ta;
+	       Tl = T7 + Tk;
+	       Tm = Tj + Tl;
+	       O[0] = KP2_000000000 * (Th + Tm);
+	       Tn = FNMS(KP500000000, Tf, T5);
+	       To = T4 - Tc;
+	       Tp = FMS(KP433012701, To, KP866025403 * Tn);
+	       Tq = FMA(KP866025403, T8 - T9, Tp);
+	       Tr = FNMS(KP500000000, Tk, T7);
+	       Ts = FNMS(KP500000000, Ti, T3);
+	       Tt = T6 - Tb;
+	       Tu = FMS(KP750000000, Tt, KP500000000 * Ts);
+	       Tv = Tr - Tu;
+	       Tw = Tq - Tv;
+	       Tx = FNMS(KP500000000, Td, T1);
+	       Ty = FMA(KP500000000, Tn, KP750000000 * To);
+	       Tz = Tx + Ty;
+	       TA = FMA(KP866025403, Ts, KP433012701 * Tt);
+	       TB = FMA(KP866025403, T2 - Ta, TA);
+	       TC = Tz + TB;
+	       O[WS(os, 1)] = FMA(KP1_982889722, TC, KP261052384 * Tw);
+	       TD = FMS(KP866025403, T8 - T9, Tp);
+	       TE = FMS(KP866025403, T2 - Ta, TA);
+	       TF = TD - TE;
+	       TG = Tx - Ty;
+	       TH = Tr + Tu;
+	       TI = TG - TH;
+	       O[WS(os, 2)] = FMS(KP1_931851652, TI, KP517638090 * TF);
+	       TJ = Tj - Tl;
+	       TK = Te - Tg;
+	       O[WS(os, 3)] = FMS(KP1_847759065, TK, KP765366864 * TJ);
+	       TL = TD + TE;
+	       TM = TG + TH;
+	       O[WS(os, 4)] = FMA(KP1_732050807, TM, TL);
+	       TN = Tq + Tv;
+	       TO = Tz - TB;
+	       O[WS(os, 5)] = FMS(KP1_586706680, TO, KP1_217522858 * TN);
+	       O[WS(os, 6)] = KP1_414213562 * (Th - Tm);
+	       O[WS(os, 7)] = FMA(KP1_586706680, TN, KP1_217522858 * TO);
+	       O[WS(os, 8)] = FNMS(KP1_732050807, TL, TM);
+	       O[WS(os, 9)] = FMA(KP1_847759065, TJ, KP765366864 * TK);
+	       O[WS(os, 10)] = FMA(KP1_931851652, TF, KP517638090 * TI);
+	       O[WS(os, 11)] = FMS(KP261052384, TC, KP1_982889722 * Tw);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 12, "e10_12", {32, 14, 22, 0}, &GENUS, REDFT10 };
+
+void X(codelet_e10_12) (planner *p) {
+     X(kr2r_register) (p, e10_12, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft10 -n 12 -name e10_12 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 52 FP additions, 34 FP multiplications,
+ * (or, 52 additions, 34 multiplications, 0 fused multiply/add),
+ * 52 stack variables, 15 constants, and 24 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e10_12(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP1_982889722, +1.982889722747620822289115053857125742555476549);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP750000000, +0.750000000000000000000000000000000000000000000);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP433012701, +0.433012701892219323381861585376468091735701313);
+     DK(KP261052384, +0.261052384440103183096812455790978020387481410);
+     DK(KP1_931851652, +1.931851652578136573499486399457794735267809678);
+     DK(KP517638090, +0.517638090205041524697797675248096656698137803);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DK(KP1_586706680, +1.586706680582470329159553923002598553257351842);
+     DK(KP1_217522858, +1.217522858017441278832195085796328009032787424);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(24, is), MAKE_VOLATILE_STRIDE(24, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = T8 + T9;
+	       Te = T1 + Td;
+	       Tf = T4 + Tc;
+	       Tg = T5 + Tf;
+	       Th = Te + Tg;
+	       Ti = T6 + Tb;
+	       Tj = T3 + Ti;
+	       Tk = T2 + Ta;
+	       Tl = T7 + Tk;
+	       Tm = Tj + Tl;
+	       O[0] = KP2_000000000 * (Th + Tm);
+	       Tn = T1 - KP500000000 * Td;
+	       To = T5 - KP500000000 * Tf;
+	       Tp = T4 - Tc;
+	       Tq = KP500000000 * To + KP750000000 * Tp;
+	       Tr = Tn + Tq;
+	       Ts = KP866025403 * (T2 - Ta);
+	       Tt = T3 - KP500000000 * Ti;
+	       Tu = T6 - Tb;
+	       Tv = KP866025403 * Tt + KP433012701 * Tu;
+	       Tw = Ts + Tv;
+	       Tx = Tr + Tw;
+	       Ty = KP866025403 * (T8 - T9);
+	       Tz = KP433012701 * Tp - KP866025403 * To;
+	       TA = Ty + Tz;
+	       TB = T7 - KP500000000 * Tk;
+	       TC = KP750000000 * Tu - KP500000000 * Tt;
+	       TD = TB - TC;
+	       TE = TA - TD;
+	       O[WS(os, 1)] = KP1_982889722 * Tx + KP261052384 * TE;
+	       TF = Tn - Tq;
+	       TG = TB + TC;
+	       TH = TF - TG;
+	       TI = Ty - Tz;
+	       TJ = Ts - Tv;
+	       TK = TI - TJ;
+	       O[WS(os, 2)] = KP1_931851652 * TH - KP517638090 * TK;
+	       TL = Te - Tg;
+	       TM = Tj - Tl;
+	       O[WS(os, 3)] = KP1_847759065 * TL - KP765366864 * TM;
+	       TN = TI + TJ;
+	       TO = TF + TG;
+	       O[WS(os, 4)] = TN + KP1_732050807 * TO;
+	       TP = Tr - Tw;
+	       TQ = TA + TD;
+	       O[WS(os, 5)] = KP1_586706680 * TP - KP1_217522858 * TQ;
+	       O[WS(os, 6)] = KP1_414213562 * (Th - Tm);
+	       O[WS(os, 7)] = KP1_586706680 * TQ + KP1_217522858 * TP;
+	       O[WS(os, 8)] = TO - KP1_732050807 * TN;
+	       O[WS(os, 9)] = KP1_847759065 * TM + KP765366864 * TL;
+	       O[WS(os, 10)] = KP1_931851652 * TK + KP517638090 * TH;
+	       O[WS(os, 11)] = KP261052384 * Tx - KP1_982889722 * TE;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 12, "e10_12", {52, 34, 0, 0}, &GENUS, REDFT10 };
+
+void X(codelet_e10_12) (planner *p) {
+     X(kr2r_register) (p, e10_12, &desc);
+}
+
+#endif
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft10 -n 16 -name e10_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 74 FP additions, 44 FP multiplications,
+ * (or, 52 additions, 22 multiplications, 22 fused multiply/add),
+ * 70 stack variables, 19 constants, and 32 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e10_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = T1 + Tg;
+	       Ti = T8 + T9;
+	       Tj = Th + Ti;
+	       Tk = T5 + Tc;
+	       Tl = T4 + Td;
+	       Tm = Tk + Tl;
+	       Tn = Tj + Tm;
+	       To = T3 + Te;
+	       Tp = T6 + Tb;
+	       Tq = To + Tp;
+	       Tr = T7 + Ta;
+	       Ts = T2 + Tf;
+	       Tt = Tr + Ts;
+	       Tu = Tq + Tt;
+	       O[0] = KP2_000000000 * (Tn + Tu);
+	       Tv = T8 - T9;
+	       Tw = KP707106781 * (T4 - Td);
+	       Tx = FMS(KP707106781, T5 - Tc, Tw);
+	       Ty = Tv - Tx;
+	       Tz = T3 - Te;
+	       TA = T6 - Tb;
+	       TB = FMS(KP923879532, TA, KP382683432 * Tz);
+	       TC = T7 - Ta;
+	       TD = T2 - Tf;
+	       TE = FMS(KP382683432, TD, KP923879532 * TC);
+	       TF = TB + TE;
+	       TG = Ty + TF;
+	       TH = T1 - Tg;
+	       TI = FMA(KP707106781, T5 - Tc, Tw);
+	       TJ = TH + TI;
+	       TK = FMA(KP923879532, Tz, KP382683432 * TA);
+	       TL = FMA(KP382683432, TC, KP923879532 * TD);
+	       TM = TK + TL;
+	       TN = TJ + TM;
+	       O[WS(os, 1)] = FMA(KP1_990369453, TN, KP196034280 * TG);
+	       TO = Tk - Tl;
+	       TP = KP707106781 * (Tr - Ts);
+	       TQ = FMA(KP707106781, To - Tp, TP);
+	       TR = TO + TQ;
+	       TS = Th - Ti;
+	       TT = FMS(KP707106781, To - Tp, TP);
+	       TU = TS + TT;
+	       O[WS(os, 2)] = FMS(KP1_961570560, TU, KP390180644 * TR);
+	       TV = Tv + Tx;
+	       TW = TK - TL;
+	       TX = TV + TW;
+	       TY = TH - TI;
+	       TZ = TB - TE;
+	       T10 = TY - TZ;
+	       O[WS(os, 3)] = FMS(KP1_913880671, T10, KP580569354 * TX);
+	       T11 = Tq - Tt;
+	       T12 = Tj - Tm;
+	       O[WS(os, 4)] = FMS(KP1_847759065, T12, KP765366864 * T11);
+	       T13 = TV - TW;
+	       T14 = TY + TZ;
+	       O[WS(os, 5)] = FMA(KP1_763842528, T14, KP942793473 * T13);
+	       T15 = TO - TQ;
+	       T16 = TS - TT;
+	       O[WS(os, 6)] = FMA(KP1_662939224, T16, KP1_111140466 * T15);
+	       T17 = Ty - TF;
+	       T18 = TJ - TM;
+	       O[WS(os, 7)] = FMS(KP1_546020906, T18, KP1_268786568 * T17);
+	       O[WS(os, 8)] = KP1_414213562 * (Tn - Tu);
+	       O[WS(os, 9)] = FMA(KP1_546020906, T17, KP1_268786568 * T18);
+	       O[WS(os, 10)] = FMS(KP1_111140466, T16, KP1_662939224 * T15);
+	       O[WS(os, 11)] = FMS(KP942793473, T14, KP1_763842528 * T13);
+	       O[WS(os, 12)] = FMA(KP1_847759065, T11, KP765366864 * T12);
+	       O[WS(os, 13)] = FMA(KP1_913880671, TX, KP580569354 * T10);
+	       O[WS(os, 14)] = FMA(KP1_961570560, TR, KP390180644 * TU);
+	       O[WS(os, 15)] = FMS(KP196034280, TN, KP1_990369453 * TG);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 16, "e10_16", {52, 22, 22, 0}, &GENUS, REDFT10 };
+
+void X(codelet_e10_16) (planner *p) {
+     X(kr2r_register) (p, e10_16, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft10 -n 16 -name e10_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 72 FP additions, 42 FP multiplications,
+ * (or, 72 additions, 42 multiplications, 0 fused multiply/add),
+ * 72 stack variables, 19 constants, and 32 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e10_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = T1 + Tg;
+	       Ti = T8 + T9;
+	       Tj = Th + Ti;
+	       Tk = T5 + Tc;
+	       Tl = T4 + Td;
+	       Tm = Tk + Tl;
+	       Tn = Tj + Tm;
+	       To = T3 + Te;
+	       Tp = T6 + Tb;
+	       Tq = To + Tp;
+	       Tr = T7 + Ta;
+	       Ts = T2 + Tf;
+	       Tt = Tr + Ts;
+	       Tu = Tq + Tt;
+	       O[0] = KP2_000000000 * (Tn + Tu);
+	       Tv = T1 - Tg;
+	       Tw = KP707106781 * (T5 - Tc);
+	       Tx = KP707106781 * (T4 - Td);
+	       Ty = Tw + Tx;
+	       Tz = Tv + Ty;
+	       TA = T3 - Te;
+	       TB = T6 - Tb;
+	       TC = KP923879532 * TA + KP382683432 * TB;
+	       TD = T7 - Ta;
+	       TE = T2 - Tf;
+	       TF = KP382683432 * TD + KP923879532 * TE;
+	       TG = TC + TF;
+	       TH = Tz + TG;
+	       TI = T8 - T9;
+	       TJ = Tw - Tx;
+	       TK = TI - TJ;
+	       TL = KP923879532 * TB - KP382683432 * TA;
+	       TM = KP382683432 * TE - KP923879532 * TD;
+	       TN = TL + TM;
+	       TO = TK + TN;
+	       O[WS(os, 1)] = KP1_990369453 * TH + KP196034280 * TO;
+	       TP = Th - Ti;
+	       TQ = KP707106781 * (To - Tp);
+	       TR = KP707106781 * (Tr - Ts);
+	       TS = TQ - TR;
+	       TT = TP + TS;
+	       TU = Tk - Tl;
+	       TV = TQ + TR;
+	       TW = TU + TV;
+	       O[WS(os, 2)] = KP1_961570560 * TT - KP390180644 * TW;
+	       TX = Tv - Ty;
+	       TY = TL - TM;
+	       TZ = TX - TY;
+	       T10 = TI + TJ;
+	       T11 = TC - TF;
+	       T12 = T10 + T11;
+	       O[WS(os, 3)] = KP1_913880671 * TZ - KP580569354 * T12;
+	       T13 = Tj - Tm;
+	       T14 = Tq - Tt;
+	       O[WS(os, 4)] = KP1_847759065 * T13 - KP765366864 * T14;
+	       T15 = TX + TY;
+	       T16 = T10 - T11;
+	       O[WS(os, 5)] = KP1_763842528 * T15 + KP942793473 * T16;
+	       T17 = TP - TS;
+	       T18 = TU - TV;
+	       O[WS(os, 6)] = KP1_662939224 * T17 + KP1_111140466 * T18;
+	       T19 = Tz - TG;
+	       T1a = TK - TN;
+	       O[WS(os, 7)] = KP1_546020906 * T19 - KP1_268786568 * T1a;
+	       O[WS(os, 8)] = KP1_414213562 * (Tn - Tu);
+	       O[WS(os, 9)] = KP1_546020906 * T1a + KP1_268786568 * T19;
+	       O[WS(os, 10)] = KP1_111140466 * T17 - KP1_662939224 * T18;
+	       O[WS(os, 11)] = KP942793473 * T15 - KP1_763842528 * T16;
+	       O[WS(os, 12)] = KP1_847759065 * T14 + KP765366864 * T13;
+	       O[WS(os, 13)] = KP1_913880671 * T12 + KP580569354 * TZ;
+	       O[WS(os, 14)] = KP1_961570560 * TW + KP390180644 * TT;
+	       O[WS(os, 15)] = KP196034280 * TH - KP1_990369453 * TO;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 16, "e10_16", {72, 42, 0, 0}, &GENUS, REDFT10 };
+
+void X(codelet_e10_16) (planner *p) {
+     X(kr2r_register) (p, e10_16, &desc);
+}
+
+#endif
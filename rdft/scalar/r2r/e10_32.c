@@ -0,0 +1,622 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft10 -n 32 -name e10_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 191 FP additions, 109 FP multiplications,
+ * (or, 135 additions, 53 multiplications, 56 fused multiply/add),
+ * 181 stack variables, 39 constants, and 64 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e10_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = T1 + Tw;
+	       Ty = Tg + Th;
+	       Tz = Tx + Ty;
+	       TA = T9 + To;
+	       TB = T8 + Tp;
+	       TC = TA + TB;
+	       TD = Tz + TC;
+	       TE = T5 + Ts;
+	       TF = Tc + Tl;
+	       TG = TE + TF;
+	       TH = Td + Tk;
+	       TI = T4 + Tt;
+	       TJ = TH + TI;
+	       TK = TG + TJ;
+	       TL = TD + TK;
+	       TM = T3 + Tu;
+	       TN = Te + Tj;
+	       TO = TM + TN;
+	       TP = Tb + Tm;
+	       TQ = T6 + Tr;
+	       TR = TP + TQ;
+	       TS = TO + TR;
+	       TT = T7 + Tq;
+	       TU = Ta + Tn;
+	       TV = TT + TU;
+	       TW = Tf + Ti;
+	       TX = T2 + Tv;
+	       TY = TW + TX;
+	       TZ = TV + TY;
+	       T10 = TS + TZ;
+	       O[0] = KP2_000000000 * (TL + T10);
+	       T11 = Tg - Th;
+	       T12 = KP707106781 * (T8 - Tp);
+	       T13 = FMS(KP707106781, T9 - To, T12);
+	       T14 = T11 - T13;
+	       T15 = T5 - Ts;
+	       T16 = Tc - Tl;
+	       T17 = FMS(KP923879532, T16, KP382683432 * T15);
+	       T18 = Td - Tk;
+	       T19 = T4 - Tt;
+	       T1a = FMS(KP382683432, T19, KP923879532 * T18);
+	       T1b = T17 + T1a;
+	       T1c = T14 + T1b;
+	       T1d = T3 - Tu;
+	       T1e = KP707106781 * (T6 - Tr);
+	       T1f = FMA(KP707106781, Tb - Tm, T1e);
+	       T1g = T1d + T1f;
+	       T1h = Te - Tj;
+	       T1i = FMS(KP707106781, Tb - Tm, T1e);
+	       T1j = T1h - T1i;
+	       T1k = FMS(KP980785280, T1j, KP195090322 * T1g);
+	       T1l = T7 - Tq;
+	       T1m = KP707106781 * (T2 - Tv);
+	       T1n = FMA(KP707106781, Tf - Ti, T1m);
+	       T1o = T1l + T1n;
+	       T1p = Ta - Tn;
+	       T1q = FMS(KP707106781, Tf - Ti, T1m);
+	       T1r = T1p - T1q;
+	       T1s = FMS(KP831469612, T1r, KP555570233 * T1o);
+	       T1t = T1k + T1s;
+	       T1u = T1c + T1t;
+	       T1v = T1 - Tw;
+	       T1w = FMA(KP707106781, T9 - To, T12);
+	       T1x = T1v + T1w;
+	       T1y = FMA(KP923879532, T15, KP382683432 * T16);
+	       T1z = FMA(KP382683432, T18, KP923879532 * T19);
+	       T1A = T1y + T1z;
+	       T1B = T1x + T1A;
+	       T1C = FMA(KP980785280, T1g, KP195090322 * T1j);
+	       T1D = FMA(KP831469612, T1o, KP555570233 * T1r);
+	       T1E = T1C + T1D;
+	       T1F = T1B + T1E;
+	       O[WS(os, 1)] = FMA(KP1_997590912, T1F, KP098135348 * T1u);
+	       T1G = TA - TB;
+	       T1H = KP707106781 * (TH - TI);
+	       T1I = FMA(KP707106781, TE - TF, T1H);
+	       T1J = T1G + T1I;
+	       T1K = TM - TN;
+	       T1L = TP - TQ;
+	       T1M = FMA(KP923879532, T1L, KP382683432 * T1K);
+	       T1N = TT - TU;
+	       T1O = TW - TX;
+	       T1P = FMA(KP382683432, T1O, KP923879532 * T1N);
+	       T1Q = T1M + T1P;
+	       T1R = T1J + T1Q;
+	       T1S = Tx - Ty;
+	       T1T = FMS(KP707106781, TE - TF, T1H);
+	       T1U = T1S + T1T;
+	       T1V = FMS(KP923879532, T1K, KP382683432 * T1L);
+	       T1W = FMS(KP382683432, T1N, KP923879532 * T1O);
+	       T1X = T1V + T1W;
+	       T1Y = T1U + T1X;
+	       O[WS(os, 2)] = FMS(KP1_990369453, T1Y, KP196034280 * T1R);
+	       T1Z = T11 + T13;
+	       T20 = T1y - T1z;
+	       T21 = T1Z + T20;
+	       T22 = T1d - T1f;
+	       T23 = T1h + T1i;
+	       T24 = FMA(KP831469612, T23, KP555570233 * T22);
+	       T25 = T1l - T1n;
+	       T26 = T1p + T1q;
+	       T27 = FMS(KP195090322, T26, KP980785280 * T25);
+	       T28 = T24 - T27;
+	       T29 = T21 + T28;
+	       T2a = T1v - T1w;
+	       T2b = T17 - T1a;
+	       T2c = T2a - T2b;
+	       T2d = FMS(KP831469612, T22, KP555570233 * T23);
+	       T2e = FMA(KP195090322, T25, KP980785280 * T26);
+	       T2f = T2d - T2e;
+	       T2g = T2c + T2f;
+	       O[WS(os, 3)] = FMS(KP1_978353019, T2g, KP293460948 * T29);
+	       T2h = TG - TJ;
+	       T2i = KP707106781 * (TV - TY);
+	       T2j = FMA(KP707106781, TO - TR, T2i);
+	       T2k = T2h + T2j;
+	       T2l = Tz - TC;
+	       T2m = FMS(KP707106781, TO - TR, T2i);
+	       T2n = T2l + T2m;
+	       O[WS(os, 4)] = FMS(KP1_961570560, T2n, KP390180644 * T2k);
+	       T2o = T1Z - T20;
+	       T2p = T2d + T2e;
+	       T2q = T2o - T2p;
+	       T2r = T2a + T2b;
+	       T2s = T24 + T27;
+	       T2t = T2r + T2s;
+	       O[WS(os, 5)] = FMA(KP1_940062506, T2t, KP485960359 * T2q);
+	       T2u = T1G - T1I;
+	       T2v = T1V - T1W;
+	       T2w = T2u - T2v;
+	       T2x = T1S - T1T;
+	       T2y = T1M - T1P;
+	       T2z = T2x + T2y;
+	       O[WS(os, 6)] = FMA(KP1_913880671, T2z, KP580569354 * T2w);
+	       T2A = T14 - T1b;
+	       T2B = T1C - T1D;
+	       T2C = T2A + T2B;
+	       T2D = T1x - T1A;
+	       T2E = T1k - T1s;
+	       T2F = T2D - T2E;
+	       O[WS(os, 7)] = FMS(KP1_883088130, T2F, KP673779706 * T2C);
+	       T2G = TS - TZ;
+	       T2H = TD - TK;
+	       O[WS(os, 8)] = FMS(KP1_847759065, T2H, KP765366864 * T2G);
+	       T2I = T2A - T2B;
+	       T2J = T2D + T2E;
+	       O[WS(os, 9)] = FMA(KP1_807978586, T2J, KP855110186 * T2I);
+	       T2K = T2u + T2v;
+	       T2L = T2x - T2y;
+	       O[WS(os, 10)] = FMS(KP1_763842528, T2L, KP942793473 * T2K);
+	       T2M = T2o + T2p;
+	       T2N = T2r - T2s;
+	       O[WS(os, 11)] = FMS(KP1_715457220, T2N, KP1_028205488 * T2M);
+	       T2O = T2h - T2j;
+	       T2P = T2l - T2m;
+	       O[WS(os, 12)] = FMA(KP1_662939224, T2P, KP1_111140466 * T2O);
+	       T2Q = T21 - T28;
+	       T2R = T2c - T2f;
+	       O[WS(os, 13)] = FMA(KP1_606415062, T2R, KP1_191398608 * T2Q);
+	       T2S = T1J - T1Q;
+	       T2T = T1U - T1X;
+	       O[WS(os, 14)] = FMA(KP1_546020906, T2T, KP1_268786568 * T2S);
+	       T2U = T1c - T1t;
+	       T2V = T1B - T1E;
+	       O[WS(os, 15)] = FMS(KP1_481902250, T2V, KP1_343117909 * T2U);
+	       O[WS(os, 16)] = KP1_414213562 * (TL - T10);
+	       O[WS(os, 17)] = FMA(KP1_481902250, T2U, KP1_343117909 * T2V);
+	       O[WS(os, 18)] = FMS(KP1_268786568, T2T, KP1_546020906 * T2S);
+	       O[WS(os, 19)] = FMS(KP1_191398608, T2R, KP1_606415062 * T2Q);
+	       O[WS(os, 20)] = FMS(KP1_111140466, T2P, KP1_662939224 * T2O);
+	       O[WS(os, 21)] = FMA(KP1_715457220, T2M, KP1_028205488 * T2N);
+	       O[WS(os, 22)] = FMA(KP1_763842528, T2K, KP942793473 * T2L);
+	       O[WS(os, 23)] = FMS(KP855110186, T2J, KP1_807978586 * T2I);
+	       O[WS(os, 24)] = FMA(KP1_847759065, T2G, KP765366864 * T2H);
+	       O[WS(os, 25)] = FMA(KP1_883088130, T2C, KP673779706 * T2F);
+	       O[WS(os, 26)] = FMS(KP580569354, T2z, KP1_913880671 * T2w);
+	       O[WS(os, 27)] = FMS(KP485960359, T2t, KP1_940062506 * T2q);
+	       O[WS(os, 28)] = FMA(KP1_961570560, T2k, KP390180644 * T2n);
+	       O[WS(os, 29)] = FMA(KP1_978353019, T29, KP293460948 * T2g);
+	       O[WS(os, 30)] = FMA(KP1_990369453, T1R, KP196034280 * T1Y);
+	       O[WS(os, 31)] = FMS(KP098135348, T1F, KP1_997590912 * T1u);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 32, "e10_32", {135, 53, 56, 0}, &GENUS, REDFT10 };
+
+void X(codelet_e10_32) (planner *p) {
+     X(kr2r_register) (p, e10_32, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft10 -n 32 -name e10_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 186 FP additions, 104 FP multiplications,
+ * (or, 186 additions, 104 multiplications, 0 fused multiply/add),
+ * 186 stack variables, 39 constants, and 64 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e10_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V, T2W, T2X, T2Y, T2Z, T30;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = T1 + Tw;
+	       Ty = Tg + Th;
+	       Tz = Tx + Ty;
+	       TA = T9 + To;
+	       TB = T8 + Tp;
+	       TC = TA + TB;
+	       TD = Tz + TC;
+	       TE = T5 + Ts;
+	       TF = Tc + Tl;
+	       TG = TE + TF;
+	       TH = Td + Tk;
+	       TI = T4 + Tt;
+	       TJ = TH + TI;
+	       TK = TG + TJ;
+	       TL = TD + TK;
+	       TM = T3 + Tu;
+	       TN = Te + Tj;
+	       TO = TM + TN;
+	       TP = Tb + Tm;
+	       TQ = T6 + Tr;
+	       TR = TP + TQ;
+	       TS = TO + TR;
+	       TT = T7 + Tq;
+	       TU = Ta + Tn;
+	       TV = TT + TU;
+	       TW = Tf + Ti;
+	       TX = T2 + Tv;
+	       TY = TW + TX;
+	       TZ = TV + TY;
+	       T10 = TS + TZ;
+	       O[0] = KP2_000000000 * (TL + T10);
+	       T11 = T1 - Tw;
+	       T12 = KP707106781 * (T9 - To);
+	       T13 = KP707106781 * (T8 - Tp);
+	       T14 = T12 + T13;
+	       T15 = T11 + T14;
+	       T16 = T5 - Ts;
+	       T17 = Tc - Tl;
+	       T18 = KP923879532 * T16 + KP382683432 * T17;
+	       T19 = Td - Tk;
+	       T1a = T4 - Tt;
+	       T1b = KP382683432 * T19 + KP923879532 * T1a;
+	       T1c = T18 + T1b;
+	       T1d = T15 + T1c;
+	       T1e = T3 - Tu;
+	       T1f = KP707106781 * (Tb - Tm);
+	       T1g = KP707106781 * (T6 - Tr);
+	       T1h = T1f + T1g;
+	       T1i = T1e + T1h;
+	       T1j = Te - Tj;
+	       T1k = T1f - T1g;
+	       T1l = T1j - T1k;
+	       T1m = KP980785280 * T1i + KP195090322 * T1l;
+	       T1n = T7 - Tq;
+	       T1o = KP707106781 * (Tf - Ti);
+	       T1p = KP707106781 * (T2 - Tv);
+	       T1q = T1o + T1p;
+	       T1r = T1n + T1q;
+	       T1s = Ta - Tn;
+	       T1t = T1o - T1p;
+	       T1u = T1s - T1t;
+	       T1v = KP831469612 * T1r + KP555570233 * T1u;
+	       T1w = T1m + T1v;
+	       T1x = T1d + T1w;
+	       T1y = Tg - Th;
+	       T1z = T12 - T13;
+	       T1A = T1y - T1z;
+	       T1B = KP923879532 * T17 - KP382683432 * T16;
+	       T1C = KP382683432 * T1a - KP923879532 * T19;
+	       T1D = T1B + T1C;
+	       T1E = T1A + T1D;
+	       T1F = KP980785280 * T1l - KP195090322 * T1i;
+	       T1G = KP831469612 * T1u - KP555570233 * T1r;
+	       T1H = T1F + T1G;
+	       T1I = T1E + T1H;
+	       O[WS(os, 1)] = KP1_997590912 * T1x + KP098135348 * T1I;
+	       T1J = Tx - Ty;
+	       T1K = KP707106781 * (TE - TF);
+	       T1L = KP707106781 * (TH - TI);
+	       T1M = T1K - T1L;
+	       T1N = T1J + T1M;
+	       T1O = TM - TN;
+	       T1P = TP - TQ;
+	       T1Q = KP923879532 * T1O - KP382683432 * T1P;
+	       T1R = TT - TU;
+	       T1S = TW - TX;
+	       T1T = KP382683432 * T1R - KP923879532 * T1S;
+	       T1U = T1Q + T1T;
+	       T1V = T1N + T1U;
+	       T1W = TA - TB;
+	       T1X = T1K + T1L;
+	       T1Y = T1W + T1X;
+	       T1Z = KP923879532 * T1P + KP382683432 * T1O;
+	       T20 = KP382683432 * T1S + KP923879532 * T1R;
+	       T21 = T1Z + T20;
+	       T22 = T1Y + T21;
+	       O[WS(os, 2)] = KP1_990369453 * T1V - KP196034280 * T22;
+	       T23 = T11 - T14;
+	       T24 = T1B - T1C;
+	       T25 = T23 - T24;
+	       T26 = T1e - T1h;
+	       T27 = T1j + T1k;
+	       T28 = KP831469612 * T26 - KP555570233 * T27;
+	       T29 = T1n - T1q;
+	       T2a = T1s + T1t;
+	       T2b = KP195090322 * T29 + KP980785280 * T2a;
+	       T2c = T28 - T2b;
+	       T2d = T25 + T2c;
+	       T2e = T1y + T1z;
+	       T2f = T18 - T1b;
+	       T2g = T2e + T2f;
+	       T2h = KP831469612 * T27 + KP555570233 * T26;
+	       T2i = KP195090322 * T2a - KP980785280 * T29;
+	       T2j = T2h - T2i;
+	       T2k = T2g + T2j;
+	       O[WS(os, 3)] = KP1_978353019 * T2d - KP293460948 * T2k;
+	       T2l = Tz - TC;
+	       T2m = KP707106781 * (TO - TR);
+	       T2n = KP707106781 * (TV - TY);
+	       T2o = T2m - T2n;
+	       T2p = T2l + T2o;
+	       T2q = TG - TJ;
+	       T2r = T2m + T2n;
+	       T2s = T2q + T2r;
+	       O[WS(os, 4)] = KP1_961570560 * T2p - KP390180644 * T2s;
+	       T2t = T23 + T24;
+	       T2u = T2h + T2i;
+	       T2v = T2t + T2u;
+	       T2w = T2e - T2f;
+	       T2x = T28 + T2b;
+	       T2y = T2w - T2x;
+	       O[WS(os, 5)] = KP1_940062506 * T2v + KP485960359 * T2y;
+	       T2z = T1J - T1M;
+	       T2A = T1Z - T20;
+	       T2B = T2z + T2A;
+	       T2C = T1W - T1X;
+	       T2D = T1Q - T1T;
+	       T2E = T2C - T2D;
+	       O[WS(os, 6)] = KP1_913880671 * T2B + KP580569354 * T2E;
+	       T2F = T15 - T1c;
+	       T2G = T1F - T1G;
+	       T2H = T2F - T2G;
+	       T2I = T1A - T1D;
+	       T2J = T1m - T1v;
+	       T2K = T2I + T2J;
+	       O[WS(os, 7)] = KP1_883088130 * T2H - KP673779706 * T2K;
+	       T2L = TD - TK;
+	       T2M = TS - TZ;
+	       O[WS(os, 8)] = KP1_847759065 * T2L - KP765366864 * T2M;
+	       T2N = T2F + T2G;
+	       T2O = T2I - T2J;
+	       O[WS(os, 9)] = KP1_807978586 * T2N + KP855110186 * T2O;
+	       T2P = T2z - T2A;
+	       T2Q = T2C + T2D;
+	       O[WS(os, 10)] = KP1_763842528 * T2P - KP942793473 * T2Q;
+	       T2R = T2t - T2u;
+	       T2S = T2w + T2x;
+	       O[WS(os, 11)] = KP1_715457220 * T2R - KP1_028205488 * T2S;
+	       T2T = T2l - T2o;
+	       T2U = T2q - T2r;
+	       O[WS(os, 12)] = KP1_662939224 * T2T + KP1_111140466 * T2U;
+	       T2V = T25 - T2c;
+	       T2W = T2g - T2j;
+	       O[WS(os, 13)] = KP1_606415062 * T2V + KP1_191398608 * T2W;
+	       T2X = T1N - T1U;
+	       T2Y = T1Y - T21;
+	       O[WS(os, 14)] = KP1_546020906 * T2X + KP1_268786568 * T2Y;
+	       T2Z = T1d - T1w;
+	       T30 = T1E - T1H;
+	       O[WS(os, 15)] = KP1_481902250 * T2Z - KP1_343117909 * T30;
+	       O[WS(os, 16)] = KP1_414213562 * (TL - T10);
+	       O[WS(os, 17)] = KP1_481902250 * T30 + KP1_343117909 * T2Z;
+	       O[WS(os, 18)] = KP1_268786568 * T2X - KP1_546020906 * T2Y;
+	       O[WS(os, 19)] = KP1_191398608 * T2V - KP1_606415062 * T2W;
+	       O[WS(os, 20)] = KP1_111140466 * T2T - KP1_662939224 * T2U;
+	       O[WS(os, 21)] = KP1_715457220 * T2S + KP1_028205488 * T2R;
+	       O[WS(os, 22)] = KP1_763842528 * T2Q + KP942793473 * T2P;
+	       O[WS(os, 23)] = KP855110186 * T2N - KP1_807978586 * T2O;
+	       O[WS(os, 24)] = KP1_847759065 * T2M + KP765366864 * T2L;
+	       O[WS(os, 25)] = KP1_883088130 * T2K + KP673779706 * T2H;
+	       O[WS(os, 26)] = KP580569354 * T2B - KP1_913880671 * T2E;
+	       O[WS(os, 27)] = KP485960359 * T2v - KP1_940062506 * T2y;
+	       O[WS(os, 28)] = KP1_961570560 * T2s + KP390180644 * T2p;
+	       O[WS(os, 29)] = KP1_978353019 * T2k + KP293460948 * T2d;
+	       O[WS(os, 30)] = KP1_990369453 * T22 + KP196034280 * T1V;
+	       O[WS(os, 31)] = KP098135348 * T1x - KP1_997590912 * T1I;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 32, "e10_32", {186, 104, 0, 0}, &GENUS, REDFT10 };
+
+void X(codelet_e10_32) (planner *p) {
+     X(kr2r_register) (p, e10_32, &desc);
+}
+
+#endif
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft10 -n 6 -name e10_6 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 21 FP additions, 16 FP multiplications,
+ * (or, 11 additions, 6 multiplications, 10 fused multiply/add),
+ * 19 stack variables, 9 constants, and 12 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e10_6(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP517638090, +0.517638090205041524697797675248096656698137803);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP433012701, +0.433012701892219323381861585376468091735701313);
+     DK(KP750000000, +0.750000000000000000000000000000000000000000000);
+     DK(KP1_931851652, +1.931851652578136573499486399457794735267809678);
+     DK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(12, is), MAKE_VOLATILE_STRIDE(12, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = T4 + T5;
+	       T8 = T1 + T7;
+	       T9 = T2 + T6;
+	       Ta = T3 + T9;
+	       O[0] = KP2_000000000 * (T8 + Ta);
+	       Tb = FNMS(KP500000000, T9, T3);
+	       Tc = T2 - T6;
+	       Td = FMS(KP433012701, Tc, KP866025403 * Tb);
+	       Te = FMA(KP866025403, T4 - T5, Td);
+	       Tf = FNMS(KP500000000, T7, T1);
+	       Tg = FMA(KP500000000, Tb, KP750000000 * Tc);
+	       Th = Tf + Tg;
+	       O[WS(os, 1)] = FMA(KP1_931851652, Th, KP517638090 * Te);
+	       Ti = FMS(KP866025403, T4 - T5, Td);
+	       Tj = Tf - Tg;
+	       O[WS(os, 2)] = FMS(KP1_732050807, Tj, Ti);
+	       O[WS(os, 3)] = KP1_414213562 * (T8 - Ta);
+	       O[WS(os, 4)] = FMA(KP1_732050807, Ti, Tj);
+	       O[WS(os, 5)] = FMS(KP517638090, Th, KP1_931851652 * Te);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 6, "e10_6", {11, 6, 10, 0}, &GENUS, REDFT10 };
+
+void X(codelet_e10_6) (planner *p) {
+     X(kr2r_register) (p, e10_6, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft10 -n 6 -name e10_6 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 20 FP additions, 15 FP multiplications,
+ * (or, 20 additions, 15 multiplications, 0 fused multiply/add),
+ * 20 stack variables, 9 constants, and 12 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e10_6(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP1_931851652, +1.931851652578136573499486399457794735267809678);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP750000000, +0.750000000000000000000000000000000000000000000);
+     DK(KP517638090, +0.517638090205041524697797675248096656698137803);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP433012701, +0.433012701892219323381861585376468091735701313);
+     DK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(12, is), MAKE_VOLATILE_STRIDE(12, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = T4 + T5;
+	       T8 = T1 + T7;
+	       T9 = T2 + T6;
+	       Ta = T3 + T9;
+	       O[0] = KP2_000000000 * (T8 + Ta);
+	       Tb = T1 - KP500000000 * T7;
+	       Tc = T3 - KP500000000 * T9;
+	       Td = T2 - T6;
+	       Te = KP500000000 * Tc + KP750000000 * Td;
+	       Tf = Tb + Te;
+	       Tg = KP866025403 * (T4 - T5);
+	       Th = KP433012701 * Td - KP866025403 * Tc;
+	       Ti = Tg + Th;
+	       O[WS(os, 1)] = KP1_931851652 * Tf + KP517638090 * Ti;
+	       Tj = Tb - Te;
+	       Tk = Tg - Th;
+	       O[WS(os, 2)] = KP1_732050807 * Tj - Tk;
+	       O[WS(os, 3)] = KP1_414213562 * (T8 - Ta);
+	       O[WS(os, 4)] = Tj + KP1_732050807 * Tk;
+	       O[WS(os, 5)] = KP517638090 * Tf - KP1_931851652 * Ti;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 6, "e10_6", {20, 15, 0, 0}, &GENUS, REDFT10 };
+
+void X(codelet_e10_6) (planner *p) {
+     X(kr2r_register) (p, e10_6, &desc);
+}
+
+#endif
@@ -0,0 +1,1345 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft10 -n 64 -name e10_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 466 FP additions, 260 FP multiplications,
+ * (or, 332 additions, 126 multiplications, 134 fused multiply/add),
+ * 446 stack variables, 79 constants, and 128 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e10_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       E T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       E T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       E T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       E T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       E T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       E T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       E T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       E T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       E T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       E T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       E T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       E T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       E T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       E T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       E T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       E T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       E T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       E T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       E T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       E T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       E T6Z, T70, T71, T72, T73, T74, T75, T76, T77, T78, T79, T7a;
+	       E T7b, T7c;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = I[WS(is, 32)];
+	       Ty = I[WS(is, 33)];
+	       Tz = I[WS(is, 34)];
+	       TA = I[WS(is, 35)];
+	       TB = I[WS(is, 36)];
+	       TC = I[WS(is, 37)];
+	       TD = I[WS(is, 38)];
+	       TE = I[WS(is, 39)];
+	       TF = I[WS(is, 40)];
+	       TG = I[WS(is, 41)];
+	       TH = I[WS(is, 42)];
+	       TI = I[WS(is, 43)];
+	       TJ = I[WS(is, 44)];
+	       TK = I[WS(is, 45)];
+	       TL = I[WS(is, 46)];
+	       TM = I[WS(is, 47)];
+	       TN = I[WS(is, 48)];
+	       TO = I[WS(is, 49)];
+	       TP = I[WS(is, 50)];
+	       TQ = I[WS(is, 51)];
+	       TR = I[WS(is, 52)];
+	       TS = I[WS(is, 53)];
+	       TT = I[WS(is, 54)];
+	       TU = I[WS(is, 55)];
+	       TV = I[WS(is, 56)];
+	       TW = I[WS(is, 57)];
+	       TX = I[WS(is, 58)];
+	       TY = I[WS(is, 59)];
+	       TZ = I[WS(is, 60)];
+	       T10 = I[WS(is, 61)];
+	       T11 = I[WS(is, 62)];
+	       T12 = I[WS(is, 63)];
+	       T13 = T1 + T12;
+	       T14 = Tw + Tx;
+	       T15 = T13 + T14;
+	       T16 = Th + TM;
+	       T17 = Tg + TN;
+	       T18 = T16 + T17;
+	       T19 = T15 + T18;
+	       T1a = T9 + TU;
+	       T1b = To + TF;
+	       T1c = T1a + T1b;
+	       T1d = Tp + TE;
+	       T1e = T8 + TV;
+	       T1f = T1d + T1e;
+	       T1g = T1c + T1f;
+	       T1h = T19 + T1g;
+	       T1i = T5 + TY;
+	       T1j = Ts + TB;
+	       T1k = T1i + T1j;
+	       T1l = Tl + TI;
+	       T1m = Tc + TR;
+	       T1n = T1l + T1m;
+	       T1o = T1k + T1n;
+	       T1p = Td + TQ;
+	       T1q = Tk + TJ;
+	       T1r = T1p + T1q;
+	       T1s = Tt + TA;
+	       T1t = T4 + TZ;
+	       T1u = T1s + T1t;
+	       T1v = T1r + T1u;
+	       T1w = T1o + T1v;
+	       T1x = T1h + T1w;
+	       T1y = T3 + T10;
+	       T1z = Tu + Tz;
+	       T1A = T1y + T1z;
+	       T1B = Tj + TK;
+	       T1C = Te + TP;
+	       T1D = T1B + T1C;
+	       T1E = T1A + T1D;
+	       T1F = Tb + TS;
+	       T1G = Tm + TH;
+	       T1H = T1F + T1G;
+	       T1I = Tr + TC;
+	       T1J = T6 + TX;
+	       T1K = T1I + T1J;
+	       T1L = T1H + T1K;
+	       T1M = T1E + T1L;
+	       T1N = T7 + TW;
+	       T1O = Tq + TD;
+	       T1P = T1N + T1O;
+	       T1Q = Tn + TG;
+	       T1R = Ta + TT;
+	       T1S = T1Q + T1R;
+	       T1T = T1P + T1S;
+	       T1U = Tf + TO;
+	       T1V = Ti + TL;
+	       T1W = T1U + T1V;
+	       T1X = Tv + Ty;
+	       T1Y = T2 + T11;
+	       T1Z = T1X + T1Y;
+	       T20 = T1W + T1Z;
+	       T21 = T1T + T20;
+	       T22 = T1M + T21;
+	       O[0] = KP2_000000000 * (T1x + T22);
+	       T23 = Tw - Tx;
+	       T24 = KP707106781 * (Tg - TN);
+	       T25 = FMS(KP707106781, Th - TM, T24);
+	       T26 = T23 - T25;
+	       T27 = T9 - TU;
+	       T28 = To - TF;
+	       T29 = FMS(KP923879532, T28, KP382683432 * T27);
+	       T2a = Tp - TE;
+	       T2b = T8 - TV;
+	       T2c = FMS(KP382683432, T2b, KP923879532 * T2a);
+	       T2d = T29 + T2c;
+	       T2e = T26 + T2d;
+	       T2f = T5 - TY;
+	       T2g = KP707106781 * (Tc - TR);
+	       T2h = FMA(KP707106781, Tl - TI, T2g);
+	       T2i = T2f + T2h;
+	       T2j = Ts - TB;
+	       T2k = FMS(KP707106781, Tl - TI, T2g);
+	       T2l = T2j - T2k;
+	       T2m = FMS(KP980785280, T2l, KP195090322 * T2i);
+	       T2n = Td - TQ;
+	       T2o = KP707106781 * (T4 - TZ);
+	       T2p = FMA(KP707106781, Tt - TA, T2o);
+	       T2q = T2n + T2p;
+	       T2r = Tk - TJ;
+	       T2s = FMS(KP707106781, Tt - TA, T2o);
+	       T2t = T2r - T2s;
+	       T2u = FMS(KP831469612, T2t, KP555570233 * T2q);
+	       T2v = T2m + T2u;
+	       T2w = T2e + T2v;
+	       T2x = T3 - T10;
+	       T2y = KP707106781 * (Te - TP);
+	       T2z = FMA(KP707106781, Tj - TK, T2y);
+	       T2A = T2x + T2z;
+	       T2B = Tm - TH;
+	       T2C = Tb - TS;
+	       T2D = FMA(KP923879532, T2C, KP382683432 * T2B);
+	       T2E = T6 - TX;
+	       T2F = Tr - TC;
+	       T2G = FMA(KP382683432, T2F, KP923879532 * T2E);
+	       T2H = T2D + T2G;
+	       T2I = T2A + T2H;
+	       T2J = Tu - Tz;
+	       T2K = FMS(KP707106781, Tj - TK, T2y);
+	       T2L = T2J - T2K;
+	       T2M = FMS(KP923879532, T2B, KP382683432 * T2C);
+	       T2N = FMS(KP382683432, T2E, KP923879532 * T2F);
+	       T2O = T2M + T2N;
+	       T2P = T2L + T2O;
+	       T2Q = FMS(KP995184726, T2P, KP098017140 * T2I);
+	       T2R = T7 - TW;
+	       T2S = KP707106781 * (Ta - TT);
+	       T2T = FMA(KP707106781, Tn - TG, T2S);
+	       T2U = T2R + T2T;
+	       T2V = Ti - TL;
+	       T2W = Tf - TO;
+	       T2X = FMA(KP923879532, T2W, KP382683432 * T2V);
+	       T2Y = T2 - T11;
+	       T2Z = Tv - Ty;
+	       T30 = FMA(KP382683432, T2Z, KP923879532 * T2Y);
+	       T31 = T2X + T30;
+	       T32 = T2U + T31;
+	       T33 = Tq - TD;
+	       T34 = FMS(KP707106781, Tn - TG, T2S);
+	       T35 = T33 - T34;
+	       T36 = FMS(KP923879532, T2V, KP382683432 * T2W);
+	       T37 = FMS(KP382683432, T2Y, KP923879532 * T2Z);
+	       T38 = T36 + T37;
+	       T39 = T35 + T38;
+	       T3a = FMS(KP956940335, T39, KP290284677 * T32);
+	       T3b = T2Q + T3a;
+	       T3c = T2w + T3b;
+	       T3d = T1 - T12;
+	       T3e = FMA(KP707106781, Th - TM, T24);
+	       T3f = T3d + T3e;
+	       T3g = FMA(KP923879532, T27, KP382683432 * T28);
+	       T3h = FMA(KP382683432, T2a, KP923879532 * T2b);
+	       T3i = T3g + T3h;
+	       T3j = T3f + T3i;
+	       T3k = FMA(KP980785280, T2i, KP195090322 * T2l);
+	       T3l = FMA(KP831469612, T2q, KP555570233 * T2t);
+	       T3m = T3k + T3l;
+	       T3n = T3j + T3m;
+	       T3o = FMA(KP995184726, T2I, KP098017140 * T2P);
+	       T3p = FMA(KP956940335, T32, KP290284677 * T39);
+	       T3q = T3o + T3p;
+	       T3r = T3n + T3q;
+	       O[WS(os, 1)] = FMA(KP1_999397637, T3r, KP049082457 * T3c);
+	       T3s = T16 - T17;
+	       T3t = KP707106781 * (T1d - T1e);
+	       T3u = FMA(KP707106781, T1a - T1b, T3t);
+	       T3v = T3s + T3u;
+	       T3w = T1i - T1j;
+	       T3x = T1l - T1m;
+	       T3y = FMA(KP923879532, T3x, KP382683432 * T3w);
+	       T3z = T1p - T1q;
+	       T3A = T1s - T1t;
+	       T3B = FMA(KP382683432, T3A, KP923879532 * T3z);
+	       T3C = T3y + T3B;
+	       T3D = T3v + T3C;
+	       T3E = T1y - T1z;
+	       T3F = KP707106781 * (T1I - T1J);
+	       T3G = FMS(KP707106781, T1F - T1G, T3F);
+	       T3H = T3E + T3G;
+	       T3I = T1B - T1C;
+	       T3J = FMA(KP707106781, T1F - T1G, T3F);
+	       T3K = T3I + T3J;
+	       T3L = FMA(KP980785280, T3K, KP195090322 * T3H);
+	       T3M = T1N - T1O;
+	       T3N = KP707106781 * (T1X - T1Y);
+	       T3O = FMS(KP707106781, T1U - T1V, T3N);
+	       T3P = T3M + T3O;
+	       T3Q = T1Q - T1R;
+	       T3R = FMA(KP707106781, T1U - T1V, T3N);
+	       T3S = T3Q + T3R;
+	       T3T = FMA(KP831469612, T3S, KP555570233 * T3P);
+	       T3U = T3L + T3T;
+	       T3V = T3D + T3U;
+	       T3W = T13 - T14;
+	       T3X = FMS(KP707106781, T1a - T1b, T3t);
+	       T3Y = T3W + T3X;
+	       T3Z = FMS(KP923879532, T3w, KP382683432 * T3x);
+	       T40 = FMS(KP382683432, T3z, KP923879532 * T3A);
+	       T41 = T3Z + T40;
+	       T42 = T3Y + T41;
+	       T43 = FMS(KP980785280, T3H, KP195090322 * T3K);
+	       T44 = FMS(KP831469612, T3P, KP555570233 * T3S);
+	       T45 = T43 + T44;
+	       T46 = T42 + T45;
+	       O[WS(os, 2)] = FMS(KP1_997590912, T46, KP098135348 * T3V);
+	       T47 = T23 + T25;
+	       T48 = T3g - T3h;
+	       T49 = T47 + T48;
+	       T4a = T2f - T2h;
+	       T4b = T2j + T2k;
+	       T4c = FMA(KP831469612, T4b, KP555570233 * T4a);
+	       T4d = T2n - T2p;
+	       T4e = T2r + T2s;
+	       T4f = FMS(KP195090322, T4e, KP980785280 * T4d);
+	       T4g = T4c - T4f;
+	       T4h = T49 + T4g;
+	       T4i = T2x - T2z;
+	       T4j = T2M - T2N;
+	       T4k = T4i - T4j;
+	       T4l = T2J + T2K;
+	       T4m = T2D - T2G;
+	       T4n = T4l + T4m;
+	       T4o = FMA(KP956940335, T4n, KP290284677 * T4k);
+	       T4p = T2R - T2T;
+	       T4q = T36 - T37;
+	       T4r = T4p - T4q;
+	       T4s = T33 + T34;
+	       T4t = T2X - T30;
+	       T4u = T4s + T4t;
+	       T4v = FMA(KP634393284, T4u, KP773010453 * T4r);
+	       T4w = T4o + T4v;
+	       T4x = T4h + T4w;
+	       T4y = T3d - T3e;
+	       T4z = T29 - T2c;
+	       T4A = T4y - T4z;
+	       T4B = FMS(KP831469612, T4a, KP555570233 * T4b);
+	       T4C = FMA(KP195090322, T4d, KP980785280 * T4e);
+	       T4D = T4B - T4C;
+	       T4E = T4A + T4D;
+	       T4F = FMS(KP956940335, T4k, KP290284677 * T4n);
+	       T4G = FMS(KP634393284, T4r, KP773010453 * T4u);
+	       T4H = T4F + T4G;
+	       T4I = T4E + T4H;
+	       O[WS(os, 3)] = FMS(KP1_994580913, T4I, KP147129127 * T4x);
+	       T4J = T1c - T1f;
+	       T4K = KP707106781 * (T1r - T1u);
+	       T4L = FMA(KP707106781, T1k - T1n, T4K);
+	       T4M = T4J + T4L;
+	       T4N = T1A - T1D;
+	       T4O = T1H - T1K;
+	       T4P = FMA(KP923879532, T4O, KP382683432 * T4N);
+	       T4Q = T1P - T1S;
+	       T4R = T1W - T1Z;
+	       T4S = FMA(KP382683432, T4R, KP923879532 * T4Q);
+	       T4T = T4P + T4S;
+	       T4U = T4M + T4T;
+	       T4V = T15 - T18;
+	       T4W = FMS(KP707106781, T1k - T1n, T4K);
+	       T4X = T4V + T4W;
+	       T4Y = FMS(KP923879532, T4N, KP382683432 * T4O);
+	       T4Z = FMS(KP382683432, T4Q, KP923879532 * T4R);
+	       T50 = T4Y + T4Z;
+	       T51 = T4X + T50;
+	       O[WS(os, 4)] = FMS(KP1_990369453, T51, KP196034280 * T4U);
+	       T52 = T47 - T48;
+	       T53 = T4B + T4C;
+	       T54 = T52 - T53;
+	       T55 = T4i + T4j;
+	       T56 = T4l - T4m;
+	       T57 = FMS(KP881921264, T56, KP471396736 * T55);
+	       T58 = T4p + T4q;
+	       T59 = T4s - T4t;
+	       T5a = FMS(KP098017140, T59, KP995184726 * T58);
+	       T5b = T57 + T5a;
+	       T5c = T54 + T5b;
+	       T5d = T4y + T4z;
+	       T5e = T4c + T4f;
+	       T5f = T5d + T5e;
+	       T5g = FMA(KP881921264, T55, KP471396736 * T56);
+	       T5h = FMA(KP098017140, T58, KP995184726 * T59);
+	       T5i = T5g + T5h;
+	       T5j = T5f + T5i;
+	       O[WS(os, 5)] = FMA(KP1_984959069, T5j, KP244821350 * T5c);
+	       T5k = T3s - T3u;
+	       T5l = T3Z - T40;
+	       T5m = T5k - T5l;
+	       T5n = T3E - T3G;
+	       T5o = T3I - T3J;
+	       T5p = FMS(KP831469612, T5o, KP555570233 * T5n);
+	       T5q = T3M - T3O;
+	       T5r = T3Q - T3R;
+	       T5s = FMA(KP195090322, T5r, KP980785280 * T5q);
+	       T5t = T5p - T5s;
+	       T5u = T5m + T5t;
+	       T5v = T3W - T3X;
+	       T5w = T3y - T3B;
+	       T5x = T5v + T5w;
+	       T5y = FMA(KP831469612, T5n, KP555570233 * T5o);
+	       T5z = FMS(KP195090322, T5q, KP980785280 * T5r);
+	       T5A = T5y - T5z;
+	       T5B = T5x + T5A;
+	       O[WS(os, 6)] = FMA(KP1_978353019, T5B, KP293460948 * T5u);
+	       T5C = T26 - T2d;
+	       T5D = T3k - T3l;
+	       T5E = T5C + T5D;
+	       T5F = T2A - T2H;
+	       T5G = T2L - T2O;
+	       T5H = FMA(KP773010453, T5G, KP634393284 * T5F);
+	       T5I = T2U - T31;
+	       T5J = T35 - T38;
+	       T5K = FMS(KP471396736, T5J, KP881921264 * T5I);
+	       T5L = T5H - T5K;
+	       T5M = T5E + T5L;
+	       T5N = T3f - T3i;
+	       T5O = T2m - T2u;
+	       T5P = T5N - T5O;
+	       T5Q = FMS(KP773010453, T5F, KP634393284 * T5G);
+	       T5R = FMA(KP471396736, T5I, KP881921264 * T5J);
+	       T5S = T5Q - T5R;
+	       T5T = T5P + T5S;
+	       O[WS(os, 7)] = FMS(KP1_970555284, T5T, KP341923777 * T5M);
+	       T5U = T1o - T1v;
+	       T5V = KP707106781 * (T1T - T20);
+	       T5W = FMA(KP707106781, T1E - T1L, T5V);
+	       T5X = T5U + T5W;
+	       T5Y = T19 - T1g;
+	       T5Z = FMS(KP707106781, T1E - T1L, T5V);
+	       T60 = T5Y + T5Z;
+	       O[WS(os, 8)] = FMS(KP1_961570560, T60, KP390180644 * T5X);
+	       T61 = T5C - T5D;
+	       T62 = T5Q + T5R;
+	       T63 = T61 - T62;
+	       T64 = T5N + T5O;
+	       T65 = T5H + T5K;
+	       T66 = T64 + T65;
+	       O[WS(os, 9)] = FMA(KP1_951404260, T66, KP438202480 * T63);
+	       T67 = T5k + T5l;
+	       T68 = T5y + T5z;
+	       T69 = T67 + T68;
+	       T6a = T5v - T5w;
+	       T6b = T5p + T5s;
+	       T6c = T6a - T6b;
+	       O[WS(os, 10)] = FMS(KP1_940062506, T6c, KP485960359 * T69);
+	       T6d = T52 + T53;
+	       T6e = T5g - T5h;
+	       T6f = T6d + T6e;
+	       T6g = T5d - T5e;
+	       T6h = T57 - T5a;
+	       T6i = T6g - T6h;
+	       O[WS(os, 11)] = FMS(KP1_927552131, T6i, KP533425514 * T6f);
+	       T6j = T4J - T4L;
+	       T6k = T4Y - T4Z;
+	       T6l = T6j - T6k;
+	       T6m = T4V - T4W;
+	       T6n = T4P - T4S;
+	       T6o = T6m + T6n;
+	       O[WS(os, 12)] = FMA(KP1_913880671, T6o, KP580569354 * T6l);
+	       T6p = T49 - T4g;
+	       T6q = T4F - T4G;
+	       T6r = T6p - T6q;
+	       T6s = T4A - T4D;
+	       T6t = T4o - T4v;
+	       T6u = T6s + T6t;
+	       O[WS(os, 13)] = FMA(KP1_899056361, T6u, KP627363480 * T6r);
+	       T6v = T3v - T3C;
+	       T6w = T43 - T44;
+	       T6x = T6v - T6w;
+	       T6y = T3Y - T41;
+	       T6z = T3L - T3T;
+	       T6A = T6y + T6z;
+	       O[WS(os, 14)] = FMA(KP1_883088130, T6A, KP673779706 * T6x);
+	       T6B = T2e - T2v;
+	       T6C = T3o - T3p;
+	       T6D = T6B + T6C;
+	       T6E = T3j - T3m;
+	       T6F = T2Q - T3a;
+	       T6G = T6E - T6F;
+	       O[WS(os, 15)] = FMS(KP1_865985597, T6G, KP719790073 * T6D);
+	       T6H = T1M - T21;
+	       T6I = T1h - T1w;
+	       O[WS(os, 16)] = FMS(KP1_847759065, T6I, KP765366864 * T6H);
+	       T6J = T6B - T6C;
+	       T6K = T6E + T6F;
+	       O[WS(os, 17)] = FMA(KP1_828419511, T6K, KP810482628 * T6J);
+	       T6L = T6v + T6w;
+	       T6M = T6y - T6z;
+	       O[WS(os, 18)] = FMS(KP1_807978586, T6M, KP855110186 * T6L);
+	       T6N = T6p + T6q;
+	       T6O = T6s - T6t;
+	       O[WS(os, 19)] = FMS(KP1_786448602, T6O, KP899222659 * T6N);
+	       T6P = T6j + T6k;
+	       T6Q = T6m - T6n;
+	       O[WS(os, 20)] = FMS(KP1_763842528, T6Q, KP942793473 * T6P);
+	       T6R = T6d - T6e;
+	       T6S = T6g + T6h;
+	       O[WS(os, 21)] = FMA(KP1_740173982, T6S, KP985796384 * T6R);
+	       T6T = T67 - T68;
+	       T6U = T6a + T6b;
+	       O[WS(os, 22)] = FMA(KP1_715457220, T6U, KP1_028205488 * T6T);
+	       T6V = T61 + T62;
+	       T6W = T64 - T65;
+	       O[WS(os, 23)] = FMS(KP1_689707130, T6W, KP1_069995239 * T6V);
+	       T6X = T5U - T5W;
+	       T6Y = T5Y - T5Z;
+	       O[WS(os, 24)] = FMA(KP1_662939224, T6Y, KP1_111140466 * T6X);
+	       T6Z = T5E - T5L;
+	       T70 = T5P - T5S;
+	       O[WS(os, 25)] = FMA(KP1_635169626, T70, KP1_151616382 * T6Z);
+	       T71 = T5m - T5t;
+	       T72 = T5x - T5A;
+	       O[WS(os, 26)] = FMS(KP1_606415062, T72, KP1_191398608 * T71);
+	       T73 = T54 - T5b;
+	       T74 = T5f - T5i;
+	       O[WS(os, 27)] = FMS(KP1_576692855, T74, KP1_230463181 * T73);
+	       T75 = T4M - T4T;
+	       T76 = T4X - T50;
+	       O[WS(os, 28)] = FMA(KP1_546020906, T76, KP1_268786568 * T75);
+	       T77 = T4h - T4w;
+	       T78 = T4E - T4H;
+	       O[WS(os, 29)] = FMA(KP1_514417693, T78, KP1_306345685 * T77);
+	       T79 = T3D - T3U;
+	       T7a = T42 - T45;
+	       O[WS(os, 30)] = FMA(KP1_481902250, T7a, KP1_343117909 * T79);
+	       T7b = T2w - T3b;
+	       T7c = T3n - T3q;
+	       O[WS(os, 31)] = FMS(KP1_448494165, T7c, KP1_379081089 * T7b);
+	       O[WS(os, 32)] = KP1_414213562 * (T1x - T22);
+	       O[WS(os, 33)] = FMA(KP1_448494165, T7b, KP1_379081089 * T7c);
+	       O[WS(os, 34)] = FMS(KP1_343117909, T7a, KP1_481902250 * T79);
+	       O[WS(os, 35)] = FMS(KP1_306345685, T78, KP1_514417693 * T77);
+	       O[WS(os, 36)] = FMS(KP1_268786568, T76, KP1_546020906 * T75);
+	       O[WS(os, 37)] = FMA(KP1_576692855, T73, KP1_230463181 * T74);
+	       O[WS(os, 38)] = FMA(KP1_606415062, T71, KP1_191398608 * T72);
+	       O[WS(os, 39)] = FMS(KP1_151616382, T70, KP1_635169626 * T6Z);
+	       O[WS(os, 40)] = FMS(KP1_111140466, T6Y, KP1_662939224 * T6X);
+	       O[WS(os, 41)] = FMA(KP1_689707130, T6V, KP1_069995239 * T6W);
+	       O[WS(os, 42)] = FMS(KP1_028205488, T6U, KP1_715457220 * T6T);
+	       O[WS(os, 43)] = FMS(KP985796384, T6S, KP1_740173982 * T6R);
+	       O[WS(os, 44)] = FMA(KP1_763842528, T6P, KP942793473 * T6Q);
+	       O[WS(os, 45)] = FMA(KP1_786448602, T6N, KP899222659 * T6O);
+	       O[WS(os, 46)] = FMA(KP1_807978586, T6L, KP855110186 * T6M);
+	       O[WS(os, 47)] = FMS(KP810482628, T6K, KP1_828419511 * T6J);
+	       O[WS(os, 48)] = FMA(KP1_847759065, T6H, KP765366864 * T6I);
+	       O[WS(os, 49)] = FMA(KP1_865985597, T6D, KP719790073 * T6G);
+	       O[WS(os, 50)] = FMS(KP673779706, T6A, KP1_883088130 * T6x);
+	       O[WS(os, 51)] = FMS(KP627363480, T6u, KP1_899056361 * T6r);
+	       O[WS(os, 52)] = FMS(KP580569354, T6o, KP1_913880671 * T6l);
+	       O[WS(os, 53)] = FMA(KP1_927552131, T6f, KP533425514 * T6i);
+	       O[WS(os, 54)] = FMA(KP1_940062506, T69, KP485960359 * T6c);
+	       O[WS(os, 55)] = FMS(KP438202480, T66, KP1_951404260 * T63);
+	       O[WS(os, 56)] = FMA(KP1_961570560, T5X, KP390180644 * T60);
+	       O[WS(os, 57)] = FMA(KP1_970555284, T5M, KP341923777 * T5T);
+	       O[WS(os, 58)] = FMS(KP293460948, T5B, KP1_978353019 * T5u);
+	       O[WS(os, 59)] = FMS(KP244821350, T5j, KP1_984959069 * T5c);
+	       O[WS(os, 60)] = FMA(KP1_990369453, T4U, KP196034280 * T51);
+	       O[WS(os, 61)] = FMA(KP1_994580913, T4x, KP147129127 * T4I);
+	       O[WS(os, 62)] = FMA(KP1_997590912, T3V, KP098135348 * T46);
+	       O[WS(os, 63)] = FMS(KP049082457, T3r, KP1_999397637 * T3c);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 64, "e10_64", {332, 126, 134, 0}, &GENUS, REDFT10 };
+
+void X(codelet_e10_64) (planner *p) {
+     X(kr2r_register) (p, e10_64, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft10 -n 64 -name e10_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 456 FP additions, 250 FP multiplications,
+ * (or, 456 additions, 250 multiplications, 0 fused multiply/add),
+ * 456 stack variables, 79 constants, and 128 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e10_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       E T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       E T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       E T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       E T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       E T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       E T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       E T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       E T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       E T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       E T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       E T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       E T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       E T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       E T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       E T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       E T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       E T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       E T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       E T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       E T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       E T6Z, T70, T71, T72, T73, T74, T75, T76, T77, T78, T79, T7a;
+	       E T7b, T7c, T7d, T7e, T7f, T7g, T7h, T7i, T7j, T7k, T7l, T7m;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = I[WS(is, 32)];
+	       Ty = I[WS(is, 33)];
+	       Tz = I[WS(is, 34)];
+	       TA = I[WS(is, 35)];
+	       TB = I[WS(is, 36)];
+	       TC = I[WS(is, 37)];
+	       TD = I[WS(is, 38)];
+	       TE = I[WS(is, 39)];
+	       TF = I[WS(is, 40)];
+	       TG = I[WS(is, 41)];
+	       TH = I[WS(is, 42)];
+	       TI = I[WS(is, 43)];
+	       TJ = I[WS(is, 44)];
+	       TK = I[WS(is, 45)];
+	       TL = I[WS(is, 46)];
+	       TM = I[WS(is, 47)];
+	       TN = I[WS(is, 48)];
+	       TO = I[WS(is, 49)];
+	       TP = I[WS(is, 50)];
+	       TQ = I[WS(is, 51)];
+	       TR = I[WS(is, 52)];
+	       TS = I[WS(is, 53)];
+	       TT = I[WS(is, 54)];
+	       TU = I[WS(is, 55)];
+	       TV = I[WS(is, 56)];
+	       TW = I[WS(is, 57)];
+	       TX = I[WS(is, 58)];
+	       TY = I[WS(is, 59)];
+	       TZ = I[WS(is, 60)];
+	       T10 = I[WS(is, 61)];
+	       T11 = I[WS(is, 62)];
+	       T12 = I[WS(is, 63)];
+	       T13 = T1 + T12;
+	       T14 = Tw + Tx;
+	       T15 = T13 + T14;
+	       T16 = Th + TM;
+	       T17 = Tg + TN;
+	       T18 = T16 + T17;
+	       T19 = T15 + T18;
+	       T1a = T9 + TU;
+	       T1b = To + TF;
+	       T1c = T1a + T1b;
+	       T1d = Tp + TE;
+	       T1e = T8 + TV;
+	       T1f = T1d + T1e;
+	       T1g = T1c + T1f;
+	       T1h = T19 + T1g;
+	       T1i = T5 + TY;
+	       T1j = Ts + TB;
+	       T1k = T1i + T1j;
+	       T1l = Tl + TI;
+	       T1m = Tc + TR;
+	       T1n = T1l + T1m;
+	       T1o = T1k + T1n;
+	       T1p = Td + TQ;
+	       T1q = Tk + TJ;
+	       T1r = T1p + T1q;
+	       T1s = Tt + TA;
+	       T1t = T4 + TZ;
+	       T1u = T1s + T1t;
+	       T1v = T1r + T1u;
+	       T1w = T1o + T1v;
+	       T1x = T1h + T1w;
+	       T1y = T3 + T10;
+	       T1z = Tu + Tz;
+	       T1A = T1y + T1z;
+	       T1B = Tj + TK;
+	       T1C = Te + TP;
+	       T1D = T1B + T1C;
+	       T1E = T1A + T1D;
+	       T1F = Tb + TS;
+	       T1G = Tm + TH;
+	       T1H = T1F + T1G;
+	       T1I = Tr + TC;
+	       T1J = T6 + TX;
+	       T1K = T1I + T1J;
+	       T1L = T1H + T1K;
+	       T1M = T1E + T1L;
+	       T1N = T7 + TW;
+	       T1O = Tq + TD;
+	       T1P = T1N + T1O;
+	       T1Q = Tn + TG;
+	       T1R = Ta + TT;
+	       T1S = T1Q + T1R;
+	       T1T = T1P + T1S;
+	       T1U = Tf + TO;
+	       T1V = Ti + TL;
+	       T1W = T1U + T1V;
+	       T1X = Tv + Ty;
+	       T1Y = T2 + T11;
+	       T1Z = T1X + T1Y;
+	       T20 = T1W + T1Z;
+	       T21 = T1T + T20;
+	       T22 = T1M + T21;
+	       O[0] = KP2_000000000 * (T1x + T22);
+	       T23 = T1 - T12;
+	       T24 = KP707106781 * (Th - TM);
+	       T25 = KP707106781 * (Tg - TN);
+	       T26 = T24 + T25;
+	       T27 = T23 + T26;
+	       T28 = T9 - TU;
+	       T29 = To - TF;
+	       T2a = KP923879532 * T28 + KP382683432 * T29;
+	       T2b = Tp - TE;
+	       T2c = T8 - TV;
+	       T2d = KP382683432 * T2b + KP923879532 * T2c;
+	       T2e = T2a + T2d;
+	       T2f = T27 + T2e;
+	       T2g = T5 - TY;
+	       T2h = KP707106781 * (Tl - TI);
+	       T2i = KP707106781 * (Tc - TR);
+	       T2j = T2h + T2i;
+	       T2k = T2g + T2j;
+	       T2l = Ts - TB;
+	       T2m = T2h - T2i;
+	       T2n = T2l - T2m;
+	       T2o = KP980785280 * T2k + KP195090322 * T2n;
+	       T2p = Td - TQ;
+	       T2q = KP707106781 * (Tt - TA);
+	       T2r = KP707106781 * (T4 - TZ);
+	       T2s = T2q + T2r;
+	       T2t = T2p + T2s;
+	       T2u = Tk - TJ;
+	       T2v = T2q - T2r;
+	       T2w = T2u - T2v;
+	       T2x = KP831469612 * T2t + KP555570233 * T2w;
+	       T2y = T2o + T2x;
+	       T2z = T2f + T2y;
+	       T2A = T3 - T10;
+	       T2B = KP707106781 * (Tj - TK);
+	       T2C = KP707106781 * (Te - TP);
+	       T2D = T2B + T2C;
+	       T2E = T2A + T2D;
+	       T2F = Tb - TS;
+	       T2G = Tm - TH;
+	       T2H = KP923879532 * T2F + KP382683432 * T2G;
+	       T2I = Tr - TC;
+	       T2J = T6 - TX;
+	       T2K = KP382683432 * T2I + KP923879532 * T2J;
+	       T2L = T2H + T2K;
+	       T2M = T2E + T2L;
+	       T2N = Tu - Tz;
+	       T2O = T2B - T2C;
+	       T2P = T2N - T2O;
+	       T2Q = KP923879532 * T2G - KP382683432 * T2F;
+	       T2R = KP382683432 * T2J - KP923879532 * T2I;
+	       T2S = T2Q + T2R;
+	       T2T = T2P + T2S;
+	       T2U = KP995184726 * T2M + KP098017140 * T2T;
+	       T2V = T7 - TW;
+	       T2W = KP707106781 * (Tn - TG);
+	       T2X = KP707106781 * (Ta - TT);
+	       T2Y = T2W + T2X;
+	       T2Z = T2V + T2Y;
+	       T30 = Tf - TO;
+	       T31 = Ti - TL;
+	       T32 = KP923879532 * T30 + KP382683432 * T31;
+	       T33 = Tv - Ty;
+	       T34 = T2 - T11;
+	       T35 = KP382683432 * T33 + KP923879532 * T34;
+	       T36 = T32 + T35;
+	       T37 = T2Z + T36;
+	       T38 = Tq - TD;
+	       T39 = T2W - T2X;
+	       T3a = T38 - T39;
+	       T3b = KP923879532 * T31 - KP382683432 * T30;
+	       T3c = KP382683432 * T34 - KP923879532 * T33;
+	       T3d = T3b + T3c;
+	       T3e = T3a + T3d;
+	       T3f = KP956940335 * T37 + KP290284677 * T3e;
+	       T3g = T2U + T3f;
+	       T3h = T2z + T3g;
+	       T3i = Tw - Tx;
+	       T3j = T24 - T25;
+	       T3k = T3i - T3j;
+	       T3l = KP923879532 * T29 - KP382683432 * T28;
+	       T3m = KP382683432 * T2c - KP923879532 * T2b;
+	       T3n = T3l + T3m;
+	       T3o = T3k + T3n;
+	       T3p = KP980785280 * T2n - KP195090322 * T2k;
+	       T3q = KP831469612 * T2w - KP555570233 * T2t;
+	       T3r = T3p + T3q;
+	       T3s = T3o + T3r;
+	       T3t = KP995184726 * T2T - KP098017140 * T2M;
+	       T3u = KP956940335 * T3e - KP290284677 * T37;
+	       T3v = T3t + T3u;
+	       T3w = T3s + T3v;
+	       O[WS(os, 1)] = KP1_999397637 * T3h + KP049082457 * T3w;
+	       T3x = T13 - T14;
+	       T3y = KP707106781 * (T1a - T1b);
+	       T3z = KP707106781 * (T1d - T1e);
+	       T3A = T3y - T3z;
+	       T3B = T3x + T3A;
+	       T3C = T1i - T1j;
+	       T3D = T1l - T1m;
+	       T3E = KP923879532 * T3C - KP382683432 * T3D;
+	       T3F = T1p - T1q;
+	       T3G = T1s - T1t;
+	       T3H = KP382683432 * T3F - KP923879532 * T3G;
+	       T3I = T3E + T3H;
+	       T3J = T3B + T3I;
+	       T3K = T1y - T1z;
+	       T3L = KP707106781 * (T1F - T1G);
+	       T3M = KP707106781 * (T1I - T1J);
+	       T3N = T3L - T3M;
+	       T3O = T3K + T3N;
+	       T3P = T1B - T1C;
+	       T3Q = T3L + T3M;
+	       T3R = T3P + T3Q;
+	       T3S = KP980785280 * T3O - KP195090322 * T3R;
+	       T3T = T1N - T1O;
+	       T3U = KP707106781 * (T1U - T1V);
+	       T3V = KP707106781 * (T1X - T1Y);
+	       T3W = T3U - T3V;
+	       T3X = T3T + T3W;
+	       T3Y = T1Q - T1R;
+	       T3Z = T3U + T3V;
+	       T40 = T3Y + T3Z;
+	       T41 = KP831469612 * T3X - KP555570233 * T40;
+	       T42 = T3S + T41;
+	       T43 = T3J + T42;
+	       T44 = T16 - T17;
+	       T45 = T3y + T3z;
+	       T46 = T44 + T45;
+	       T47 = KP923879532 * T3D + KP382683432 * T3C;
+	       T48 = KP382683432 * T3G + KP923879532 * T3F;
+	       T49 = T47 + T48;
+	       T4a = T46 + T49;
+	       T4b = KP980785280 * T3R + KP195090322 * T3O;
+	       T4c = KP831469612 * T40 + KP555570233 * T3X;
+	       T4d = T4b + T4c;
+	       T4e = T4a + T4d;
+	       O[WS(os, 2)] = KP1_997590912 * T43 - KP098135348 * T4e;
+	       T4f = T23 - T26;
+	       T4g = T3l - T3m;
+	       T4h = T4f - T4g;
+	       T4i = T2g - T2j;
+	       T4j = T2l + T2m;
+	       T4k = KP831469612 * T4i - KP555570233 * T4j;
+	       T4l = T2p - T2s;
+	       T4m = T2u + T2v;
+	       T4n = KP195090322 * T4l + KP980785280 * T4m;
+	       T4o = T4k - T4n;
+	       T4p = T4h + T4o;
+	       T4q = T2A - T2D;
+	       T4r = T2Q - T2R;
+	       T4s = T4q - T4r;
+	       T4t = T2N + T2O;
+	       T4u = T2H - T2K;
+	       T4v = T4t + T4u;
+	       T4w = KP956940335 * T4s - KP290284677 * T4v;
+	       T4x = T2V - T2Y;
+	       T4y = T3b - T3c;
+	       T4z = T4x - T4y;
+	       T4A = T38 + T39;
+	       T4B = T32 - T35;
+	       T4C = T4A + T4B;
+	       T4D = KP634393284 * T4z - KP773010453 * T4C;
+	       T4E = T4w + T4D;
+	       T4F = T4p + T4E;
+	       T4G = T3i + T3j;
+	       T4H = T2a - T2d;
+	       T4I = T4G + T4H;
+	       T4J = KP831469612 * T4j + KP555570233 * T4i;
+	       T4K = KP195090322 * T4m - KP980785280 * T4l;
+	       T4L = T4J - T4K;
+	       T4M = T4I + T4L;
+	       T4N = KP956940335 * T4v + KP290284677 * T4s;
+	       T4O = KP634393284 * T4C + KP773010453 * T4z;
+	       T4P = T4N + T4O;
+	       T4Q = T4M + T4P;
+	       O[WS(os, 3)] = KP1_994580913 * T4F - KP147129127 * T4Q;
+	       T4R = T15 - T18;
+	       T4S = KP707106781 * (T1k - T1n);
+	       T4T = KP707106781 * (T1r - T1u);
+	       T4U = T4S - T4T;
+	       T4V = T4R + T4U;
+	       T4W = T1A - T1D;
+	       T4X = T1H - T1K;
+	       T4Y = KP923879532 * T4W - KP382683432 * T4X;
+	       T4Z = T1P - T1S;
+	       T50 = T1W - T1Z;
+	       T51 = KP382683432 * T4Z - KP923879532 * T50;
+	       T52 = T4Y + T51;
+	       T53 = T4V + T52;
+	       T54 = T1c - T1f;
+	       T55 = T4S + T4T;
+	       T56 = T54 + T55;
+	       T57 = KP923879532 * T4X + KP382683432 * T4W;
+	       T58 = KP382683432 * T50 + KP923879532 * T4Z;
+	       T59 = T57 + T58;
+	       T5a = T56 + T59;
+	       O[WS(os, 4)] = KP1_990369453 * T53 - KP196034280 * T5a;
+	       T5b = T4f + T4g;
+	       T5c = T4J + T4K;
+	       T5d = T5b + T5c;
+	       T5e = T4q + T4r;
+	       T5f = T4t - T4u;
+	       T5g = KP881921264 * T5e + KP471396736 * T5f;
+	       T5h = T4x + T4y;
+	       T5i = T4A - T4B;
+	       T5j = KP098017140 * T5h + KP995184726 * T5i;
+	       T5k = T5g + T5j;
+	       T5l = T5d + T5k;
+	       T5m = T4G - T4H;
+	       T5n = T4k + T4n;
+	       T5o = T5m - T5n;
+	       T5p = KP881921264 * T5f - KP471396736 * T5e;
+	       T5q = KP098017140 * T5i - KP995184726 * T5h;
+	       T5r = T5p + T5q;
+	       T5s = T5o + T5r;
+	       O[WS(os, 5)] = KP1_984959069 * T5l + KP244821350 * T5s;
+	       T5t = T3x - T3A;
+	       T5u = T47 - T48;
+	       T5v = T5t + T5u;
+	       T5w = T3K - T3N;
+	       T5x = T3P - T3Q;
+	       T5y = KP831469612 * T5w + KP555570233 * T5x;
+	       T5z = T3T - T3W;
+	       T5A = T3Y - T3Z;
+	       T5B = KP195090322 * T5z - KP980785280 * T5A;
+	       T5C = T5y - T5B;
+	       T5D = T5v + T5C;
+	       T5E = T44 - T45;
+	       T5F = T3E - T3H;
+	       T5G = T5E - T5F;
+	       T5H = KP831469612 * T5x - KP555570233 * T5w;
+	       T5I = KP195090322 * T5A + KP980785280 * T5z;
+	       T5J = T5H - T5I;
+	       T5K = T5G + T5J;
+	       O[WS(os, 6)] = KP1_978353019 * T5D + KP293460948 * T5K;
+	       T5L = T27 - T2e;
+	       T5M = T3p - T3q;
+	       T5N = T5L - T5M;
+	       T5O = T2E - T2L;
+	       T5P = T2P - T2S;
+	       T5Q = KP773010453 * T5O - KP634393284 * T5P;
+	       T5R = T2Z - T36;
+	       T5S = T3a - T3d;
+	       T5T = KP471396736 * T5R + KP881921264 * T5S;
+	       T5U = T5Q - T5T;
+	       T5V = T5N + T5U;
+	       T5W = T3k - T3n;
+	       T5X = T2o - T2x;
+	       T5Y = T5W + T5X;
+	       T5Z = KP773010453 * T5P + KP634393284 * T5O;
+	       T60 = KP471396736 * T5S - KP881921264 * T5R;
+	       T61 = T5Z - T60;
+	       T62 = T5Y + T61;
+	       O[WS(os, 7)] = KP1_970555284 * T5V - KP341923777 * T62;
+	       T63 = T19 - T1g;
+	       T64 = KP707106781 * (T1E - T1L);
+	       T65 = KP707106781 * (T1T - T20);
+	       T66 = T64 - T65;
+	       T67 = T63 + T66;
+	       T68 = T1o - T1v;
+	       T69 = T64 + T65;
+	       T6a = T68 + T69;
+	       O[WS(os, 8)] = KP1_961570560 * T67 - KP390180644 * T6a;
+	       T6b = T5L + T5M;
+	       T6c = T5Z + T60;
+	       T6d = T6b + T6c;
+	       T6e = T5W - T5X;
+	       T6f = T5Q + T5T;
+	       T6g = T6e - T6f;
+	       O[WS(os, 9)] = KP1_951404260 * T6d + KP438202480 * T6g;
+	       T6h = T5t - T5u;
+	       T6i = T5H + T5I;
+	       T6j = T6h - T6i;
+	       T6k = T5E + T5F;
+	       T6l = T5y + T5B;
+	       T6m = T6k + T6l;
+	       O[WS(os, 10)] = KP1_940062506 * T6j - KP485960359 * T6m;
+	       T6n = T5b - T5c;
+	       T6o = T5p - T5q;
+	       T6p = T6n - T6o;
+	       T6q = T5m + T5n;
+	       T6r = T5g - T5j;
+	       T6s = T6q + T6r;
+	       O[WS(os, 11)] = KP1_927552131 * T6p - KP533425514 * T6s;
+	       T6t = T4R - T4U;
+	       T6u = T57 - T58;
+	       T6v = T6t + T6u;
+	       T6w = T54 - T55;
+	       T6x = T4Y - T51;
+	       T6y = T6w - T6x;
+	       O[WS(os, 12)] = KP1_913880671 * T6v + KP580569354 * T6y;
+	       T6z = T4h - T4o;
+	       T6A = T4N - T4O;
+	       T6B = T6z + T6A;
+	       T6C = T4I - T4L;
+	       T6D = T4w - T4D;
+	       T6E = T6C - T6D;
+	       O[WS(os, 13)] = KP1_899056361 * T6B + KP627363480 * T6E;
+	       T6F = T3B - T3I;
+	       T6G = T4b - T4c;
+	       T6H = T6F + T6G;
+	       T6I = T46 - T49;
+	       T6J = T3S - T41;
+	       T6K = T6I - T6J;
+	       O[WS(os, 14)] = KP1_883088130 * T6H + KP673779706 * T6K;
+	       T6L = T2f - T2y;
+	       T6M = T3t - T3u;
+	       T6N = T6L - T6M;
+	       T6O = T3o - T3r;
+	       T6P = T2U - T3f;
+	       T6Q = T6O + T6P;
+	       O[WS(os, 15)] = KP1_865985597 * T6N - KP719790073 * T6Q;
+	       T6R = T1h - T1w;
+	       T6S = T1M - T21;
+	       O[WS(os, 16)] = KP1_847759065 * T6R - KP765366864 * T6S;
+	       T6T = T6L + T6M;
+	       T6U = T6O - T6P;
+	       O[WS(os, 17)] = KP1_828419511 * T6T + KP810482628 * T6U;
+	       T6V = T6F - T6G;
+	       T6W = T6I + T6J;
+	       O[WS(os, 18)] = KP1_807978586 * T6V - KP855110186 * T6W;
+	       T6X = T6z - T6A;
+	       T6Y = T6C + T6D;
+	       O[WS(os, 19)] = KP1_786448602 * T6X - KP899222659 * T6Y;
+	       T6Z = T6t - T6u;
+	       T70 = T6w + T6x;
+	       O[WS(os, 20)] = KP1_763842528 * T6Z - KP942793473 * T70;
+	       T71 = T6n + T6o;
+	       T72 = T6q - T6r;
+	       O[WS(os, 21)] = KP1_740173982 * T71 + KP985796384 * T72;
+	       T73 = T6h + T6i;
+	       T74 = T6k - T6l;
+	       O[WS(os, 22)] = KP1_715457220 * T73 + KP1_028205488 * T74;
+	       T75 = T6b - T6c;
+	       T76 = T6e + T6f;
+	       O[WS(os, 23)] = KP1_689707130 * T75 - KP1_069995239 * T76;
+	       T77 = T63 - T66;
+	       T78 = T68 - T69;
+	       O[WS(os, 24)] = KP1_662939224 * T77 + KP1_111140466 * T78;
+	       T79 = T5N - T5U;
+	       T7a = T5Y - T61;
+	       O[WS(os, 25)] = KP1_635169626 * T79 + KP1_151616382 * T7a;
+	       T7b = T5v - T5C;
+	       T7c = T5G - T5J;
+	       O[WS(os, 26)] = KP1_606415062 * T7b - KP1_191398608 * T7c;
+	       T7d = T5d - T5k;
+	       T7e = T5o - T5r;
+	       O[WS(os, 27)] = KP1_576692855 * T7d - KP1_230463181 * T7e;
+	       T7f = T4V - T52;
+	       T7g = T56 - T59;
+	       O[WS(os, 28)] = KP1_546020906 * T7f + KP1_268786568 * T7g;
+	       T7h = T4p - T4E;
+	       T7i = T4M - T4P;
+	       O[WS(os, 29)] = KP1_514417693 * T7h + KP1_306345685 * T7i;
+	       T7j = T3J - T42;
+	       T7k = T4a - T4d;
+	       O[WS(os, 30)] = KP1_481902250 * T7j + KP1_343117909 * T7k;
+	       T7l = T2z - T3g;
+	       T7m = T3s - T3v;
+	       O[WS(os, 31)] = KP1_448494165 * T7l - KP1_379081089 * T7m;
+	       O[WS(os, 32)] = KP1_414213562 * (T1x - T22);
+	       O[WS(os, 33)] = KP1_448494165 * T7m + KP1_379081089 * T7l;
+	       O[WS(os, 34)] = KP1_343117909 * T7j - KP1_481902250 * T7k;
+	       O[WS(os, 35)] = KP1_306345685 * T7h - KP1_514417693 * T7i;
+	       O[WS(os, 36)] = KP1_268786568 * T7f - KP1_546020906 * T7g;
+	       O[WS(os, 37)] = KP1_576692855 * T7e + KP1_230463181 * T7d;
+	       O[WS(os, 38)] = KP1_606415062 * T7c + KP1_191398608 * T7b;
+	       O[WS(os, 39)] = KP1_151616382 * T79 - KP1_635169626 * T7a;
+	       O[WS(os, 40)] = KP1_111140466 * T77 - KP1_662939224 * T78;
+	       O[WS(os, 41)] = KP1_689707130 * T76 + KP1_069995239 * T75;
+	       O[WS(os, 42)] = KP1_028205488 * T73 - KP1_715457220 * T74;
+	       O[WS(os, 43)] = KP985796384 * T71 - KP1_740173982 * T72;
+	       O[WS(os, 44)] = KP1_763842528 * T70 + KP942793473 * T6Z;
+	       O[WS(os, 45)] = KP1_786448602 * T6Y + KP899222659 * T6X;
+	       O[WS(os, 46)] = KP1_807978586 * T6W + KP855110186 * T6V;
+	       O[WS(os, 47)] = KP810482628 * T6T - KP1_828419511 * T6U;
+	       O[WS(os, 48)] = KP1_847759065 * T6S + KP765366864 * T6R;
+	       O[WS(os, 49)] = KP1_865985597 * T6Q + KP719790073 * T6N;
+	       O[WS(os, 50)] = KP673779706 * T6H - KP1_883088130 * T6K;
+	       O[WS(os, 51)] = KP627363480 * T6B - KP1_899056361 * T6E;
+	       O[WS(os, 52)] = KP580569354 * T6v - KP1_913880671 * T6y;
+	       O[WS(os, 53)] = KP1_927552131 * T6s + KP533425514 * T6p;
+	       O[WS(os, 54)] = KP1_940062506 * T6m + KP485960359 * T6j;
+	       O[WS(os, 55)] = KP438202480 * T6d - KP1_951404260 * T6g;
+	       O[WS(os, 56)] = KP1_961570560 * T6a + KP390180644 * T67;
+	       O[WS(os, 57)] = KP1_970555284 * T62 + KP341923777 * T5V;
+	       O[WS(os, 58)] = KP293460948 * T5D - KP1_978353019 * T5K;
+	       O[WS(os, 59)] = KP244821350 * T5l - KP1_984959069 * T5s;
+	       O[WS(os, 60)] = KP1_990369453 * T5a + KP196034280 * T53;
+	       O[WS(os, 61)] = KP1_994580913 * T4Q + KP147129127 * T4F;
+	       O[WS(os, 62)] = KP1_997590912 * T4e + KP098135348 * T43;
+	       O[WS(os, 63)] = KP049082457 * T3h - KP1_999397637 * T3w;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 64, "e10_64", {456, 250, 0, 0}, &GENUS, REDFT10 };
+
+void X(codelet_e10_64) (planner *p) {
+     X(kr2r_register) (p, e10_64, &desc);
+}
+
+#endif
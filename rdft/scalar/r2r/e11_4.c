@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft11 -n 4 -name e11_4 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 12 FP additions, 12 FP multiplications,
+ * (or, 4 additions, 4 multiplications, 8 fused multiply/add),
+ * 8 stack variables, 5 constants, and 8 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e11_4(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(8, is), MAKE_VOLATILE_STRIDE(8, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = FMA(KP707106781, T2 - T3, T4);
+	       T6 = FMA(KP707106781, T2 + T3, T1);
+	       O[0] = FMA(KP1_961570560, T6, KP390180644 * T5);
+	       T7 = FNMS(KP707106781, T2 - T3, T4);
+	       T8 = FNMS(KP707106781, T2 + T3, T1);
+	       O[WS(os, 1)] = FMS(KP1_662939224, T8, KP1_111140466 * T7);
+	       O[WS(os, 2)] = FMA(KP1_111140466, T8, KP1_662939224 * T7);
+	       O[WS(os, 3)] = FMS(KP390180644, T6, KP1_961570560 * T5);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 4, "e11_4", {4, 4, 8, 0}, &GENUS, REDFT11 };
+
+void X(codelet_e11_4) (planner *p) {
+     X(kr2r_register) (p, e11_4, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft11 -n 4 -name e11_4 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 10 FP additions, 10 FP multiplications,
+ * (or, 10 additions, 10 multiplications, 0 fused multiply/add),
+ * 10 stack variables, 5 constants, and 8 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e11_4(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(8, is), MAKE_VOLATILE_STRIDE(8, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = KP707106781 * (T2 + T3);
+	       T6 = T1 + T5;
+	       T7 = KP707106781 * (T2 - T3);
+	       T8 = T4 + T7;
+	       O[0] = KP1_961570560 * T6 + KP390180644 * T8;
+	       T9 = T1 - T5;
+	       Ta = T4 - T7;
+	       O[WS(os, 1)] = KP1_662939224 * T9 - KP1_111140466 * Ta;
+	       O[WS(os, 2)] = KP1_111140466 * T9 + KP1_662939224 * Ta;
+	       O[WS(os, 3)] = KP390180644 * T6 - KP1_961570560 * T8;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 4, "e11_4", {10, 10, 0, 0}, &GENUS, REDFT11 };
+
+void X(codelet_e11_4) (planner *p) {
+     X(kr2r_register) (p, e11_4, &desc);
+}
+
+#endif
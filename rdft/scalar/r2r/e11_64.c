@@ -0,0 +1,1466 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft11 -n 64 -name e11_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 510 FP additions, 346 FP multiplications,
+ * (or, 330 additions, 166 multiplications, 180 fused multiply/add),
+ * 486 stack variables, 95 constants, and 128 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e11_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP024543076, +0.024543076571439852158816523902006424280744639);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DK(KP049067674, +0.049067674327418014254954976942682658314745363);
+     DK(KP998795456, +0.998795456205172392714771604759100694443203615);
+     DK(KP740951125, +0.740951125354959091175616897495162729728955309);
+     DK(KP671558954, +0.671558954847018400625376850427421803228750632);
+     DK(KP427555093, +0.427555093430282094320966856888798534304578629);
+     DK(KP903989293, +0.903989293123443331586200297230537048710132025);
+     DK(KP941544065, +0.941544065183020778412509402599502357185589796);
+     DK(KP336889853, +0.336889853392220050689253212619147570477766780);
+     DK(KP242980179, +0.242980179903263889948274162077471118320990783);
+     DK(KP970031253, +0.970031253194543992603984207286100251456865962);
+     DK(KP857728610, +0.857728610000272069902269984284770137042490799);
+     DK(KP514102744, +0.514102744193221726593693838968815772608049120);
+     DK(KP595699304, +0.595699304492433343467036528829969889511926338);
+     DK(KP803207531, +0.803207531480644909806676512963141923879569427);
+     DK(KP989176509, +0.989176509964780973451673738016243063983689533);
+     DK(KP146730474, +0.146730474455361751658850129646717819706215317);
+     DK(KP1_999849403, +1.999849403678289081843292982392766448701212938);
+     DK(KP073614445, +0.073614445882717664648665381855902602110463544);
+     DK(KP1_998644769, +1.998644769176699001792442022279820705182273658);
+     DK(KP122641472, +0.122641472604417155565229185834470014387960559);
+     DK(KP1_996236225, +1.996236225800298414250311721367212464228126423);
+     DK(KP171594624, +0.171594624688879780923112664293692343881063031);
+     DK(KP1_992625224, +1.992625224365556025254452379339463221752646973);
+     DK(KP220444414, +0.220444414587766117615798280431355450548949246);
+     DK(KP1_987813940, +1.987813940004712083093845626495599642871190701);
+     DK(KP269161417, +0.269161417014252372632716818507958511262849219);
+     DK(KP1_981805270, +1.981805270855560050216474021054867504395247598);
+     DK(KP317716286, +0.317716286667722883368770719306162603571052921);
+     DK(KP1_974602836, +1.974602836315716764799631603690035456640745121);
+     DK(KP366079775, +0.366079775910281917033065156953840027755126451);
+     DK(KP1_966210974, +1.966210974862432654360602309347890677341203845);
+     DK(KP414222752, +0.414222752384437099416232039573334833534827869);
+     DK(KP1_956634741, +1.956634741439255266212480193790997897332500072);
+     DK(KP462116216, +0.462116216561342239286472036945413330460821261);
+     DK(KP1_945879904, +1.945879904411120290935440227807593140048779507);
+     DK(KP509731319, +0.509731319209029143107961557649407098155849634);
+     DK(KP1_933952942, +1.933952942089704218174440451873572546095967827);
+     DK(KP557039378, +0.557039378770106210415697051914038958725316922);
+     DK(KP1_920861038, +1.920861038831131622398070275310531267099253644);
+     DK(KP604011898, +0.604011898638456134006926463464848782569633911);
+     DK(KP1_906612080, +1.906612080708387673833480765479587669808193802);
+     DK(KP650620584, +0.650620584324525868271909416028393540731493320);
+     DK(KP1_891214650, +1.891214650761042651461890773047690172904047732);
+     DK(KP696837360, +0.696837360498869136838617175389623272906241817);
+     DK(KP1_874678023, +1.874678023825149846403799186744761758057661627);
+     DK(KP742634387, +0.742634387903675086823869934043846532355145060);
+     DK(KP1_857012160, +1.857012160946431131874334791431891281246821974);
+     DK(KP787984080, +0.787984080122096217192377321780626848971304594);
+     DK(KP1_838227703, +1.838227703380115487816955578717183357752050834);
+     DK(KP832859120, +0.832859120195274365125197821578960493711214835);
+     DK(KP1_818335966, +1.818335966181044753127769575415612660958972103);
+     DK(KP877232477, +0.877232477077055275294051475092268719686202909);
+     DK(KP1_797348931, +1.797348931387907686083953487466970194337275016);
+     DK(KP921077421, +0.921077421916480047266362973482976848730915261);
+     DK(KP1_775279240, +1.775279240805707895520363234441813538518658294);
+     DK(KP964367544, +0.964367544158245497034688961594817222479178418);
+     DK(KP1_752140188, +1.752140188390813214191688536535980992230577321);
+     DK(KP1_007076767, +1.007076767451435117383734142520991966902189557);
+     DK(KP1_727945712, +1.727945712243173475836294108691105054148570190);
+     DK(KP1_049179365, +1.049179365356937812430196927867091345112641290);
+     DK(KP1_702710386, +1.702710386210530284522580623451748711350403472);
+     DK(KP1_090649976, +1.090649976844092844627974694347652394372707072);
+     DK(KP1_676449411, +1.676449411109676086373993711608572125272541941);
+     DK(KP1_131463621, +1.131463621567226394779530022738532180948602886);
+     DK(KP1_649178605, +1.649178605570050528949607474169780892657293650);
+     DK(KP1_171595714, +1.171595714912877720656161676237324571534273626);
+     DK(KP1_620914396, +1.620914396505189583453406868489054334100236726);
+     DK(KP1_211022082, +1.211022082808651027841253882659759316365196635);
+     DK(KP1_591673809, +1.591673809217767072525583830963354722100955994);
+     DK(KP1_249718976, +1.249718976284772754168145632562105425115766097);
+     DK(KP1_561474457, +1.561474457144188956603176967559067393332878435);
+     DK(KP1_287663085, +1.287663085779582930136172126353910776883914115);
+     DK(KP1_530334531, +1.530334531244917851777631998129811836097936003);
+     DK(KP1_324831555, +1.324831555180343522226139633913376370594885088);
+     DK(KP1_498272789, +1.498272789046918650938406513533768629611485965);
+     DK(KP1_361201995, +1.361201995590906101188860928912799237069709219);
+     DK(KP1_465308543, +1.465308543344825669231093297798986926585908341);
+     DK(KP1_396752498, +1.396752498817945707109627006123445079672655238);
+     DK(KP1_431461650, +1.431461650567637308251065246910404824429192168);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       E T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       E T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       E T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       E T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       E T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       E T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       E T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       E T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       E T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       E T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       E T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       E T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       E T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       E T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       E T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       E T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       E T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       E T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       E T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       E T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       E T6Z, T70, T71, T72, T73, T74, T75, T76, T77, T78, T79, T7a;
+	       E T7b, T7c, T7d, T7e, T7f, T7g, T7h, T7i, T7j, T7k, T7l, T7m;
+	       E T7n, T7o, T7p, T7q, T7r, T7s, T7t, T7u, T7v, T7w, T7x, T7y;
+	       E T7z, T7A, T7B, T7C, T7D, T7E, T7F, T7G, T7H, T7I, T7J, T7K;
+	       E T7L, T7M, T7N, T7O, T7P, T7Q;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = I[WS(is, 32)];
+	       Ty = I[WS(is, 33)];
+	       Tz = I[WS(is, 34)];
+	       TA = I[WS(is, 35)];
+	       TB = I[WS(is, 36)];
+	       TC = I[WS(is, 37)];
+	       TD = I[WS(is, 38)];
+	       TE = I[WS(is, 39)];
+	       TF = I[WS(is, 40)];
+	       TG = I[WS(is, 41)];
+	       TH = I[WS(is, 42)];
+	       TI = I[WS(is, 43)];
+	       TJ = I[WS(is, 44)];
+	       TK = I[WS(is, 45)];
+	       TL = I[WS(is, 46)];
+	       TM = I[WS(is, 47)];
+	       TN = I[WS(is, 48)];
+	       TO = I[WS(is, 49)];
+	       TP = I[WS(is, 50)];
+	       TQ = I[WS(is, 51)];
+	       TR = I[WS(is, 52)];
+	       TS = I[WS(is, 53)];
+	       TT = I[WS(is, 54)];
+	       TU = I[WS(is, 55)];
+	       TV = I[WS(is, 56)];
+	       TW = I[WS(is, 57)];
+	       TX = I[WS(is, 58)];
+	       TY = I[WS(is, 59)];
+	       TZ = I[WS(is, 60)];
+	       T10 = I[WS(is, 61)];
+	       T11 = I[WS(is, 62)];
+	       T12 = I[WS(is, 63)];
+	       T13 = FMA(KP707106781, Tw - Tx, T12);
+	       T14 = FMS(KP923879532, TM, KP382683432 * Th);
+	       T15 = FMS(KP382683432, Tg, KP923879532 * TN);
+	       T16 = T14 + T15;
+	       T17 = T13 + T16;
+	       T18 = FMS(KP980785280, TU, KP195090322 * T9);
+	       T19 = FMS(KP555570233, To, KP831469612 * TF);
+	       T1a = T18 + T19;
+	       T1b = FMS(KP831469612, TE, KP555570233 * Tp);
+	       T1c = FMS(KP195090322, T8, KP980785280 * TV);
+	       T1d = T1b + T1c;
+	       T1e = T1a + T1d;
+	       T1f = T17 + T1e;
+	       T1g = FMS(KP995184726, TY, KP098017140 * T5);
+	       T1h = FMS(KP634393284, Ts, KP773010453 * TB);
+	       T1i = T1g + T1h;
+	       T1j = FMS(KP881921264, TI, KP471396736 * Tl);
+	       T1k = FMS(KP290284677, Tc, KP956940335 * TR);
+	       T1l = T1j + T1k;
+	       T1m = T1i + T1l;
+	       T1n = FMS(KP956940335, TQ, KP290284677 * Td);
+	       T1o = FMS(KP471396736, Tk, KP881921264 * TJ);
+	       T1p = T1n + T1o;
+	       T1q = FMS(KP773010453, TA, KP634393284 * Tt);
+	       T1r = FMS(KP098017140, T4, KP995184726 * TZ);
+	       T1s = T1q + T1r;
+	       T1t = T1p + T1s;
+	       T1u = T1m + T1t;
+	       T1v = T1f + T1u;
+	       T1w = FMS(KP998795456, T10, KP049067674 * T3);
+	       T1x = FMS(KP671558954, Tu, KP740951125 * Tz);
+	       T1y = T1w + T1x;
+	       T1z = FMS(KP903989293, TK, KP427555093 * Tj);
+	       T1A = FMS(KP336889853, Te, KP941544065 * TP);
+	       T1B = T1z + T1A;
+	       T1C = T1y + T1B;
+	       T1D = FMS(KP970031253, TS, KP242980179 * Tb);
+	       T1E = FMS(KP514102744, Tm, KP857728610 * TH);
+	       T1F = T1D + T1E;
+	       T1G = FMS(KP803207531, TC, KP595699304 * Tr);
+	       T1H = FMS(KP146730474, T6, KP989176509 * TX);
+	       T1I = T1G + T1H;
+	       T1J = T1F + T1I;
+	       T1K = T1C + T1J;
+	       T1L = FMS(KP989176509, TW, KP146730474 * T7);
+	       T1M = FMS(KP595699304, Tq, KP803207531 * TD);
+	       T1N = T1L + T1M;
+	       T1O = FMS(KP857728610, TG, KP514102744 * Tn);
+	       T1P = FMS(KP242980179, Ta, KP970031253 * TT);
+	       T1Q = T1O + T1P;
+	       T1R = T1N + T1Q;
+	       T1S = FMS(KP941544065, TO, KP336889853 * Tf);
+	       T1T = FMS(KP427555093, Ti, KP903989293 * TL);
+	       T1U = T1S + T1T;
+	       T1V = FMS(KP740951125, Ty, KP671558954 * Tv);
+	       T1W = FMS(KP049067674, T2, KP998795456 * T11);
+	       T1X = T1V + T1W;
+	       T1Y = T1U + T1X;
+	       T1Z = T1R + T1Y;
+	       T20 = T1K + T1Z;
+	       T21 = T1v + T20;
+	       T22 = FMA(KP707106781, Tw + Tx, T1);
+	       T23 = FMA(KP923879532, Th, KP382683432 * TM);
+	       T24 = FMA(KP382683432, TN, KP923879532 * Tg);
+	       T25 = T23 + T24;
+	       T26 = T22 + T25;
+	       T27 = FMA(KP980785280, T9, KP195090322 * TU);
+	       T28 = FMA(KP555570233, TF, KP831469612 * To);
+	       T29 = T27 + T28;
+	       T2a = FMA(KP831469612, Tp, KP555570233 * TE);
+	       T2b = FMA(KP195090322, TV, KP980785280 * T8);
+	       T2c = T2a + T2b;
+	       T2d = T29 + T2c;
+	       T2e = T26 + T2d;
+	       T2f = FMA(KP995184726, T5, KP098017140 * TY);
+	       T2g = FMA(KP634393284, TB, KP773010453 * Ts);
+	       T2h = T2f + T2g;
+	       T2i = FMA(KP881921264, Tl, KP471396736 * TI);
+	       T2j = FMA(KP290284677, TR, KP956940335 * Tc);
+	       T2k = T2i + T2j;
+	       T2l = T2h + T2k;
+	       T2m = FMA(KP956940335, Td, KP290284677 * TQ);
+	       T2n = FMA(KP471396736, TJ, KP881921264 * Tk);
+	       T2o = T2m + T2n;
+	       T2p = FMA(KP773010453, Tt, KP634393284 * TA);
+	       T2q = FMA(KP098017140, TZ, KP995184726 * T4);
+	       T2r = T2p + T2q;
+	       T2s = T2o + T2r;
+	       T2t = T2l + T2s;
+	       T2u = T2e + T2t;
+	       T2v = FMA(KP998795456, T3, KP049067674 * T10);
+	       T2w = FMA(KP671558954, Tz, KP740951125 * Tu);
+	       T2x = T2v + T2w;
+	       T2y = FMA(KP903989293, Tj, KP427555093 * TK);
+	       T2z = FMA(KP336889853, TP, KP941544065 * Te);
+	       T2A = T2y + T2z;
+	       T2B = T2x + T2A;
+	       T2C = FMA(KP970031253, Tb, KP242980179 * TS);
+	       T2D = FMA(KP514102744, TH, KP857728610 * Tm);
+	       T2E = T2C + T2D;
+	       T2F = FMA(KP803207531, Tr, KP595699304 * TC);
+	       T2G = FMA(KP146730474, TX, KP989176509 * T6);
+	       T2H = T2F + T2G;
+	       T2I = T2E + T2H;
+	       T2J = T2B + T2I;
+	       T2K = FMA(KP989176509, T7, KP146730474 * TW);
+	       T2L = FMA(KP595699304, TD, KP803207531 * Tq);
+	       T2M = T2K + T2L;
+	       T2N = FMA(KP857728610, Tn, KP514102744 * TG);
+	       T2O = FMA(KP242980179, TT, KP970031253 * Ta);
+	       T2P = T2N + T2O;
+	       T2Q = T2M + T2P;
+	       T2R = FMA(KP941544065, Tf, KP336889853 * TO);
+	       T2S = FMA(KP427555093, TL, KP903989293 * Ti);
+	       T2T = T2R + T2S;
+	       T2U = FMA(KP740951125, Tv, KP671558954 * Ty);
+	       T2V = FMA(KP049067674, T11, KP998795456 * T2);
+	       T2W = T2U + T2V;
+	       T2X = T2T + T2W;
+	       T2Y = T2Q + T2X;
+	       T2Z = T2J + T2Y;
+	       T30 = T2u + T2Z;
+	       O[0] = FMA(KP1_999849403, T30, KP024543076 * T21);
+	       T31 = FNMS(KP707106781, Tw - Tx, T12);
+	       T32 = T23 - T24;
+	       T33 = T31 + T32;
+	       T34 = T2a - T2b;
+	       T35 = T1b - T1c;
+	       T36 = KP707106781 * (T34 - T35);
+	       T37 = T27 - T28;
+	       T38 = T18 - T19;
+	       T39 = FMA(KP707106781, T37 + T38, T36);
+	       T3a = T33 + T39;
+	       T3b = T1g - T1h;
+	       T3c = T2i - T2j;
+	       T3d = T3b + T3c;
+	       T3e = T2f - T2g;
+	       T3f = T1j - T1k;
+	       T3g = T3e - T3f;
+	       T3h = FMA(KP382683432, T3g, KP923879532 * T3d);
+	       T3i = T1n - T1o;
+	       T3j = T2p - T2q;
+	       T3k = T3i + T3j;
+	       T3l = T2m - T2n;
+	       T3m = T1q - T1r;
+	       T3n = T3l - T3m;
+	       T3o = FMA(KP923879532, T3n, KP382683432 * T3k);
+	       T3p = T3h + T3o;
+	       T3q = T3a + T3p;
+	       T3r = T1w - T1x;
+	       T3s = T2y - T2z;
+	       T3t = T3r + T3s;
+	       T3u = T2F - T2G;
+	       T3v = T1G - T1H;
+	       T3w = KP707106781 * (T3u - T3v);
+	       T3x = T2C - T2D;
+	       T3y = T1D - T1E;
+	       T3z = FMA(KP707106781, T3x + T3y, T3w);
+	       T3A = T3t + T3z;
+	       T3B = T2v - T2w;
+	       T3C = T1z - T1A;
+	       T3D = T3B - T3C;
+	       T3E = KP707106781 * (T3u + T3v);
+	       T3F = FMS(KP707106781, T3x - T3y, T3E);
+	       T3G = T3D + T3F;
+	       T3H = FMA(KP195090322, T3G, KP980785280 * T3A);
+	       T3I = T1L - T1M;
+	       T3J = T2N - T2O;
+	       T3K = T3I + T3J;
+	       T3L = T2U - T2V;
+	       T3M = T1V - T1W;
+	       T3N = KP707106781 * (T3L - T3M);
+	       T3O = T2R - T2S;
+	       T3P = T1S - T1T;
+	       T3Q = FMA(KP707106781, T3O + T3P, T3N);
+	       T3R = T3K + T3Q;
+	       T3S = T2K - T2L;
+	       T3T = T1O - T1P;
+	       T3U = T3S - T3T;
+	       T3V = KP707106781 * (T3L + T3M);
+	       T3W = FMS(KP707106781, T3O - T3P, T3V);
+	       T3X = T3U + T3W;
+	       T3Y = FMA(KP555570233, T3X, KP831469612 * T3R);
+	       T3Z = T3H + T3Y;
+	       T40 = T3q + T3Z;
+	       T41 = FNMS(KP707106781, Tw + Tx, T1);
+	       T42 = T14 - T15;
+	       T43 = T41 - T42;
+	       T44 = KP707106781 * (T34 + T35);
+	       T45 = FMS(KP707106781, T37 - T38, T44);
+	       T46 = T43 + T45;
+	       T47 = FMS(KP382683432, T3d, KP923879532 * T3g);
+	       T48 = FMS(KP923879532, T3k, KP382683432 * T3n);
+	       T49 = T47 + T48;
+	       T4a = T46 - T49;
+	       T4b = FMS(KP195090322, T3A, KP980785280 * T3G);
+	       T4c = FMS(KP555570233, T3R, KP831469612 * T3X);
+	       T4d = T4b + T4c;
+	       T4e = T4a - T4d;
+	       O[WS(os, 1)] = FMS(KP1_998644769, T4e, KP073614445 * T40);
+	       T4f = T31 - T32;
+	       T4g = FMA(KP707106781, T37 - T38, T44);
+	       T4h = T4f - T4g;
+	       T4i = T3e + T3f;
+	       T4j = T3b - T3c;
+	       T4k = FMS(KP923879532, T4j, KP382683432 * T4i);
+	       T4l = T3l + T3m;
+	       T4m = T3i - T3j;
+	       T4n = FMS(KP382683432, T4m, KP923879532 * T4l);
+	       T4o = T4k + T4n;
+	       T4p = T4h + T4o;
+	       T4q = T3B + T3C;
+	       T4r = FMS(KP707106781, T3x + T3y, T3w);
+	       T4s = T4q + T4r;
+	       T4t = T3r - T3s;
+	       T4u = FMA(KP707106781, T3x - T3y, T3E);
+	       T4v = T4t - T4u;
+	       T4w = FMS(KP980785280, T4v, KP195090322 * T4s);
+	       T4x = T3S + T3T;
+	       T4y = FMS(KP707106781, T3O + T3P, T3N);
+	       T4z = T4x + T4y;
+	       T4A = T3I - T3J;
+	       T4B = FMA(KP707106781, T3O - T3P, T3V);
+	       T4C = T4A - T4B;
+	       T4D = FMS(KP831469612, T4C, KP555570233 * T4z);
+	       T4E = T4w + T4D;
+	       T4F = T4p + T4E;
+	       T4G = T41 + T42;
+	       T4H = FMS(KP707106781, T37 + T38, T36);
+	       T4I = T4G + T4H;
+	       T4J = FMA(KP923879532, T4i, KP382683432 * T4j);
+	       T4K = FMA(KP382683432, T4l, KP923879532 * T4m);
+	       T4L = T4J + T4K;
+	       T4M = T4I + T4L;
+	       T4N = FMA(KP980785280, T4s, KP195090322 * T4v);
+	       T4O = FMA(KP831469612, T4z, KP555570233 * T4C);
+	       T4P = T4N + T4O;
+	       T4Q = T4M + T4P;
+	       O[WS(os, 2)] = FMA(KP1_996236225, T4Q, KP122641472 * T4F);
+	       T4R = T13 - T16;
+	       T4S = T29 - T2c;
+	       T4T = T4R + T4S;
+	       T4U = T2o - T2r;
+	       T4V = T1p - T1s;
+	       T4W = KP707106781 * (T4U - T4V);
+	       T4X = T2h - T2k;
+	       T4Y = T1i - T1l;
+	       T4Z = FMA(KP707106781, T4X + T4Y, T4W);
+	       T50 = T4T + T4Z;
+	       T51 = T1y - T1B;
+	       T52 = T2E - T2H;
+	       T53 = T51 + T52;
+	       T54 = T2x - T2A;
+	       T55 = T1F - T1I;
+	       T56 = T54 - T55;
+	       T57 = FMA(KP382683432, T56, KP923879532 * T53);
+	       T58 = T1N - T1Q;
+	       T59 = T2T - T2W;
+	       T5a = T58 + T59;
+	       T5b = T2M - T2P;
+	       T5c = T1U - T1X;
+	       T5d = T5b - T5c;
+	       T5e = FMA(KP923879532, T5d, KP382683432 * T5a);
+	       T5f = T57 + T5e;
+	       T5g = T50 + T5f;
+	       T5h = T22 - T25;
+	       T5i = T1a - T1d;
+	       T5j = T5h - T5i;
+	       T5k = KP707106781 * (T4U + T4V);
+	       T5l = FMS(KP707106781, T4X - T4Y, T5k);
+	       T5m = T5j + T5l;
+	       T5n = FMS(KP382683432, T53, KP923879532 * T56);
+	       T5o = FMS(KP923879532, T5a, KP382683432 * T5d);
+	       T5p = T5n + T5o;
+	       T5q = T5m - T5p;
+	       O[WS(os, 3)] = FMS(KP1_992625224, T5q, KP171594624 * T5g);
+	       T5r = T4R - T4S;
+	       T5s = FMA(KP707106781, T4X - T4Y, T5k);
+	       T5t = T5r - T5s;
+	       T5u = T54 + T55;
+	       T5v = T51 - T52;
+	       T5w = FMS(KP923879532, T5v, KP382683432 * T5u);
+	       T5x = T5b + T5c;
+	       T5y = T58 - T59;
+	       T5z = FMS(KP382683432, T5y, KP923879532 * T5x);
+	       T5A = T5w + T5z;
+	       T5B = T5t + T5A;
+	       T5C = T5h + T5i;
+	       T5D = FMS(KP707106781, T4X + T4Y, T4W);
+	       T5E = T5C + T5D;
+	       T5F = FMA(KP923879532, T5u, KP382683432 * T5v);
+	       T5G = FMA(KP382683432, T5x, KP923879532 * T5y);
+	       T5H = T5F + T5G;
+	       T5I = T5E + T5H;
+	       O[WS(os, 4)] = FMA(KP1_987813940, T5I, KP220444414 * T5B);
+	       T5J = T4f + T4g;
+	       T5K = T4J - T4K;
+	       T5L = T5J + T5K;
+	       T5M = T4t + T4u;
+	       T5N = T4q - T4r;
+	       T5O = FMA(KP555570233, T5N, KP831469612 * T5M);
+	       T5P = T4A + T4B;
+	       T5Q = T4x - T4y;
+	       T5R = FMS(KP980785280, T5Q, KP195090322 * T5P);
+	       T5S = T5O + T5R;
+	       T5T = T5L + T5S;
+	       T5U = T4G - T4H;
+	       T5V = T4k - T4n;
+	       T5W = T5U - T5V;
+	       T5X = FMS(KP555570233, T5M, KP831469612 * T5N);
+	       T5Y = FMA(KP980785280, T5P, KP195090322 * T5Q);
+	       T5Z = T5X + T5Y;
+	       T60 = T5W - T5Z;
+	       O[WS(os, 5)] = FMS(KP1_981805270, T60, KP269161417 * T5T);
+	       T61 = T33 - T39;
+	       T62 = T47 - T48;
+	       T63 = T61 + T62;
+	       T64 = T3D - T3F;
+	       T65 = T3t - T3z;
+	       T66 = FMS(KP831469612, T65, KP555570233 * T64);
+	       T67 = T3U - T3W;
+	       T68 = T3K - T3Q;
+	       T69 = FMA(KP195090322, T68, KP980785280 * T67);
+	       T6a = T66 - T69;
+	       T6b = T63 + T6a;
+	       T6c = T43 - T45;
+	       T6d = T3h - T3o;
+	       T6e = T6c + T6d;
+	       T6f = FMA(KP831469612, T64, KP555570233 * T65);
+	       T6g = FMS(KP195090322, T67, KP980785280 * T68);
+	       T6h = T6f - T6g;
+	       T6i = T6e + T6h;
+	       O[WS(os, 6)] = FMA(KP1_974602836, T6i, KP317716286 * T6b);
+	       T6j = T17 - T1e;
+	       T6k = T2l - T2s;
+	       T6l = T6j + T6k;
+	       T6m = T2Q - T2X;
+	       T6n = T1R - T1Y;
+	       T6o = KP707106781 * (T6m - T6n);
+	       T6p = T2B - T2I;
+	       T6q = T1C - T1J;
+	       T6r = FMA(KP707106781, T6p + T6q, T6o);
+	       T6s = T6l + T6r;
+	       T6t = T26 - T2d;
+	       T6u = T1m - T1t;
+	       T6v = T6t - T6u;
+	       T6w = KP707106781 * (T6m + T6n);
+	       T6x = FMS(KP707106781, T6p - T6q, T6w);
+	       T6y = T6v + T6x;
+	       O[WS(os, 7)] = FMS(KP1_966210974, T6y, KP366079775 * T6s);
+	       T6z = T6j - T6k;
+	       T6A = FMA(KP707106781, T6p - T6q, T6w);
+	       T6B = T6z - T6A;
+	       T6C = T6t + T6u;
+	       T6D = FMS(KP707106781, T6p + T6q, T6o);
+	       T6E = T6C + T6D;
+	       O[WS(os, 8)] = FMA(KP1_956634741, T6E, KP414222752 * T6B);
+	       T6F = T61 - T62;
+	       T6G = T6f + T6g;
+	       T6H = T6F + T6G;
+	       T6I = T6c - T6d;
+	       T6J = T66 + T69;
+	       T6K = T6I - T6J;
+	       O[WS(os, 9)] = FMS(KP1_945879904, T6K, KP462116216 * T6H);
+	       T6L = T5J - T5K;
+	       T6M = T5X - T5Y;
+	       T6N = T6L + T6M;
+	       T6O = T5U + T5V;
+	       T6P = T5O - T5R;
+	       T6Q = T6O + T6P;
+	       O[WS(os, 10)] = FMA(KP1_933952942, T6Q, KP509731319 * T6N);
+	       T6R = T5r + T5s;
+	       T6S = T5F - T5G;
+	       T6T = T6R + T6S;
+	       T6U = T5C - T5D;
+	       T6V = T5w - T5z;
+	       T6W = T6U - T6V;
+	       O[WS(os, 11)] = FMS(KP1_920861038, T6W, KP557039378 * T6T);
+	       T6X = T4T - T4Z;
+	       T6Y = T5n - T5o;
+	       T6Z = T6X + T6Y;
+	       T70 = T5j - T5l;
+	       T71 = T57 - T5e;
+	       T72 = T70 + T71;
+	       O[WS(os, 12)] = FMA(KP1_906612080, T72, KP604011898 * T6Z);
+	       T73 = T4h - T4o;
+	       T74 = T4N - T4O;
+	       T75 = T73 + T74;
+	       T76 = T4I - T4L;
+	       T77 = T4w - T4D;
+	       T78 = T76 - T77;
+	       O[WS(os, 13)] = FMS(KP1_891214650, T78, KP650620584 * T75);
+	       T79 = T3a - T3p;
+	       T7a = T4b - T4c;
+	       T7b = T79 + T7a;
+	       T7c = T46 + T49;
+	       T7d = T3H - T3Y;
+	       T7e = T7c + T7d;
+	       O[WS(os, 14)] = FMA(KP1_874678023, T7e, KP696837360 * T7b);
+	       T7f = T1f - T1u;
+	       T7g = T2J - T2Y;
+	       T7h = T7f + T7g;
+	       T7i = T2e - T2t;
+	       T7j = T1K - T1Z;
+	       T7k = T7i - T7j;
+	       O[WS(os, 15)] = FMS(KP1_857012160, T7k, KP742634387 * T7h);
+	       T7l = T7f - T7g;
+	       T7m = T7i + T7j;
+	       O[WS(os, 16)] = FMA(KP1_838227703, T7m, KP787984080 * T7l);
+	       T7n = T79 - T7a;
+	       T7o = T7c - T7d;
+	       O[WS(os, 17)] = FMS(KP1_818335966, T7o, KP832859120 * T7n);
+	       T7p = T73 - T74;
+	       T7q = T76 + T77;
+	       O[WS(os, 18)] = FMA(KP1_797348931, T7q, KP877232477 * T7p);
+	       T7r = T6X - T6Y;
+	       T7s = T70 - T71;
+	       O[WS(os, 19)] = FMS(KP1_775279240, T7s, KP921077421 * T7r);
+	       T7t = T6R - T6S;
+	       T7u = T6U + T6V;
+	       O[WS(os, 20)] = FMA(KP1_752140188, T7u, KP964367544 * T7t);
+	       T7v = T6L - T6M;
+	       T7w = T6O - T6P;
+	       O[WS(os, 21)] = FMS(KP1_727945712, T7w, KP1_007076767 * T7v);
+	       T7x = T6F - T6G;
+	       T7y = T6I + T6J;
+	       O[WS(os, 22)] = FMA(KP1_702710386, T7y, KP1_049179365 * T7x);
+	       T7z = T6z + T6A;
+	       T7A = T6C - T6D;
+	       O[WS(os, 23)] = FMS(KP1_676449411, T7A, KP1_090649976 * T7z);
+	       T7B = T6l - T6r;
+	       T7C = T6v - T6x;
+	       O[WS(os, 24)] = FMA(KP1_649178605, T7C, KP1_131463621 * T7B);
+	       T7D = T63 - T6a;
+	       T7E = T6e - T6h;
+	       O[WS(os, 25)] = FMS(KP1_620914396, T7E, KP1_171595714 * T7D);
+	       T7F = T5L - T5S;
+	       T7G = T5W + T5Z;
+	       O[WS(os, 26)] = FMA(KP1_591673809, T7G, KP1_211022082 * T7F);
+	       T7H = T5t - T5A;
+	       T7I = T5E - T5H;
+	       O[WS(os, 27)] = FMS(KP1_561474457, T7I, KP1_249718976 * T7H);
+	       T7J = T50 - T5f;
+	       T7K = T5m + T5p;
+	       O[WS(os, 28)] = FMA(KP1_530334531, T7K, KP1_287663085 * T7J);
+	       T7L = T4p - T4E;
+	       T7M = T4M - T4P;
+	       O[WS(os, 29)] = FMS(KP1_498272789, T7M, KP1_324831555 * T7L);
+	       T7N = T3q - T3Z;
+	       T7O = T4a + T4d;
+	       O[WS(os, 30)] = FMA(KP1_465308543, T7O, KP1_361201995 * T7N);
+	       T7P = T1v - T20;
+	       T7Q = T2u - T2Z;
+	       O[WS(os, 31)] = FMS(KP1_431461650, T7Q, KP1_396752498 * T7P);
+	       O[WS(os, 32)] = FMA(KP1_396752498, T7Q, KP1_431461650 * T7P);
+	       O[WS(os, 33)] = FMS(KP1_361201995, T7O, KP1_465308543 * T7N);
+	       O[WS(os, 34)] = FMA(KP1_324831555, T7M, KP1_498272789 * T7L);
+	       O[WS(os, 35)] = FMS(KP1_287663085, T7K, KP1_530334531 * T7J);
+	       O[WS(os, 36)] = FMA(KP1_249718976, T7I, KP1_561474457 * T7H);
+	       O[WS(os, 37)] = FMS(KP1_211022082, T7G, KP1_591673809 * T7F);
+	       O[WS(os, 38)] = FMA(KP1_171595714, T7E, KP1_620914396 * T7D);
+	       O[WS(os, 39)] = FMS(KP1_131463621, T7C, KP1_649178605 * T7B);
+	       O[WS(os, 40)] = FMA(KP1_090649976, T7A, KP1_676449411 * T7z);
+	       O[WS(os, 41)] = FMS(KP1_049179365, T7y, KP1_702710386 * T7x);
+	       O[WS(os, 42)] = FMA(KP1_007076767, T7w, KP1_727945712 * T7v);
+	       O[WS(os, 43)] = FMS(KP964367544, T7u, KP1_752140188 * T7t);
+	       O[WS(os, 44)] = FMA(KP921077421, T7s, KP1_775279240 * T7r);
+	       O[WS(os, 45)] = FMS(KP877232477, T7q, KP1_797348931 * T7p);
+	       O[WS(os, 46)] = FMA(KP832859120, T7o, KP1_818335966 * T7n);
+	       O[WS(os, 47)] = FMS(KP787984080, T7m, KP1_838227703 * T7l);
+	       O[WS(os, 48)] = FMA(KP742634387, T7k, KP1_857012160 * T7h);
+	       O[WS(os, 49)] = FMS(KP696837360, T7e, KP1_874678023 * T7b);
+	       O[WS(os, 50)] = FMA(KP650620584, T78, KP1_891214650 * T75);
+	       O[WS(os, 51)] = FMS(KP604011898, T72, KP1_906612080 * T6Z);
+	       O[WS(os, 52)] = FMA(KP557039378, T6W, KP1_920861038 * T6T);
+	       O[WS(os, 53)] = FMS(KP509731319, T6Q, KP1_933952942 * T6N);
+	       O[WS(os, 54)] = FMA(KP462116216, T6K, KP1_945879904 * T6H);
+	       O[WS(os, 55)] = FMS(KP414222752, T6E, KP1_956634741 * T6B);
+	       O[WS(os, 56)] = FMA(KP366079775, T6y, KP1_966210974 * T6s);
+	       O[WS(os, 57)] = FMS(KP317716286, T6i, KP1_974602836 * T6b);
+	       O[WS(os, 58)] = FMA(KP269161417, T60, KP1_981805270 * T5T);
+	       O[WS(os, 59)] = FMS(KP220444414, T5I, KP1_987813940 * T5B);
+	       O[WS(os, 60)] = FMA(KP171594624, T5q, KP1_992625224 * T5g);
+	       O[WS(os, 61)] = FMS(KP122641472, T4Q, KP1_996236225 * T4F);
+	       O[WS(os, 62)] = FMA(KP073614445, T4e, KP1_998644769 * T40);
+	       O[WS(os, 63)] = FMS(KP024543076, T30, KP1_999849403 * T21);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 64, "e11_64", {330, 166, 180, 0}, &GENUS, REDFT11 };
+
+void X(codelet_e11_64) (planner *p) {
+     X(kr2r_register) (p, e11_64, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft11 -n 64 -name e11_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 498 FP additions, 334 FP multiplications,
+ * (or, 498 additions, 334 multiplications, 0 fused multiply/add),
+ * 498 stack variables, 95 constants, and 128 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e11_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_999849403, +1.999849403678289081843292982392766448701212938);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DK(KP998795456, +0.998795456205172392714771604759100694443203615);
+     DK(KP049067674, +0.049067674327418014254954976942682658314745363);
+     DK(KP671558954, +0.671558954847018400625376850427421803228750632);
+     DK(KP740951125, +0.740951125354959091175616897495162729728955309);
+     DK(KP903989293, +0.903989293123443331586200297230537048710132025);
+     DK(KP427555093, +0.427555093430282094320966856888798534304578629);
+     DK(KP336889853, +0.336889853392220050689253212619147570477766780);
+     DK(KP941544065, +0.941544065183020778412509402599502357185589796);
+     DK(KP970031253, +0.970031253194543992603984207286100251456865962);
+     DK(KP242980179, +0.242980179903263889948274162077471118320990783);
+     DK(KP514102744, +0.514102744193221726593693838968815772608049120);
+     DK(KP857728610, +0.857728610000272069902269984284770137042490799);
+     DK(KP803207531, +0.803207531480644909806676512963141923879569427);
+     DK(KP595699304, +0.595699304492433343467036528829969889511926338);
+     DK(KP146730474, +0.146730474455361751658850129646717819706215317);
+     DK(KP989176509, +0.989176509964780973451673738016243063983689533);
+     DK(KP024543076, +0.024543076571439852158816523902006424280744639);
+     DK(KP1_998644769, +1.998644769176699001792442022279820705182273658);
+     DK(KP073614445, +0.073614445882717664648665381855902602110463544);
+     DK(KP1_996236225, +1.996236225800298414250311721367212464228126423);
+     DK(KP122641472, +0.122641472604417155565229185834470014387960559);
+     DK(KP1_992625224, +1.992625224365556025254452379339463221752646973);
+     DK(KP171594624, +0.171594624688879780923112664293692343881063031);
+     DK(KP1_987813940, +1.987813940004712083093845626495599642871190701);
+     DK(KP220444414, +0.220444414587766117615798280431355450548949246);
+     DK(KP1_981805270, +1.981805270855560050216474021054867504395247598);
+     DK(KP269161417, +0.269161417014252372632716818507958511262849219);
+     DK(KP1_974602836, +1.974602836315716764799631603690035456640745121);
+     DK(KP317716286, +0.317716286667722883368770719306162603571052921);
+     DK(KP1_966210974, +1.966210974862432654360602309347890677341203845);
+     DK(KP366079775, +0.366079775910281917033065156953840027755126451);
+     DK(KP1_956634741, +1.956634741439255266212480193790997897332500072);
+     DK(KP414222752, +0.414222752384437099416232039573334833534827869);
+     DK(KP1_945879904, +1.945879904411120290935440227807593140048779507);
+     DK(KP462116216, +0.462116216561342239286472036945413330460821261);
+     DK(KP1_933952942, +1.933952942089704218174440451873572546095967827);
+     DK(KP509731319, +0.509731319209029143107961557649407098155849634);
+     DK(KP1_920861038, +1.920861038831131622398070275310531267099253644);
+     DK(KP557039378, +0.557039378770106210415697051914038958725316922);
+     DK(KP1_906612080, +1.906612080708387673833480765479587669808193802);
+     DK(KP604011898, +0.604011898638456134006926463464848782569633911);
+     DK(KP1_891214650, +1.891214650761042651461890773047690172904047732);
+     DK(KP650620584, +0.650620584324525868271909416028393540731493320);
+     DK(KP1_874678023, +1.874678023825149846403799186744761758057661627);
+     DK(KP696837360, +0.696837360498869136838617175389623272906241817);
+     DK(KP1_857012160, +1.857012160946431131874334791431891281246821974);
+     DK(KP742634387, +0.742634387903675086823869934043846532355145060);
+     DK(KP1_838227703, +1.838227703380115487816955578717183357752050834);
+     DK(KP787984080, +0.787984080122096217192377321780626848971304594);
+     DK(KP1_818335966, +1.818335966181044753127769575415612660958972103);
+     DK(KP832859120, +0.832859120195274365125197821578960493711214835);
+     DK(KP1_797348931, +1.797348931387907686083953487466970194337275016);
+     DK(KP877232477, +0.877232477077055275294051475092268719686202909);
+     DK(KP1_775279240, +1.775279240805707895520363234441813538518658294);
+     DK(KP921077421, +0.921077421916480047266362973482976848730915261);
+     DK(KP1_752140188, +1.752140188390813214191688536535980992230577321);
+     DK(KP964367544, +0.964367544158245497034688961594817222479178418);
+     DK(KP1_727945712, +1.727945712243173475836294108691105054148570190);
+     DK(KP1_007076767, +1.007076767451435117383734142520991966902189557);
+     DK(KP1_702710386, +1.702710386210530284522580623451748711350403472);
+     DK(KP1_049179365, +1.049179365356937812430196927867091345112641290);
+     DK(KP1_676449411, +1.676449411109676086373993711608572125272541941);
+     DK(KP1_090649976, +1.090649976844092844627974694347652394372707072);
+     DK(KP1_649178605, +1.649178605570050528949607474169780892657293650);
+     DK(KP1_131463621, +1.131463621567226394779530022738532180948602886);
+     DK(KP1_620914396, +1.620914396505189583453406868489054334100236726);
+     DK(KP1_171595714, +1.171595714912877720656161676237324571534273626);
+     DK(KP1_591673809, +1.591673809217767072525583830963354722100955994);
+     DK(KP1_211022082, +1.211022082808651027841253882659759316365196635);
+     DK(KP1_561474457, +1.561474457144188956603176967559067393332878435);
+     DK(KP1_249718976, +1.249718976284772754168145632562105425115766097);
+     DK(KP1_530334531, +1.530334531244917851777631998129811836097936003);
+     DK(KP1_287663085, +1.287663085779582930136172126353910776883914115);
+     DK(KP1_498272789, +1.498272789046918650938406513533768629611485965);
+     DK(KP1_324831555, +1.324831555180343522226139633913376370594885088);
+     DK(KP1_465308543, +1.465308543344825669231093297798986926585908341);
+     DK(KP1_361201995, +1.361201995590906101188860928912799237069709219);
+     DK(KP1_431461650, +1.431461650567637308251065246910404824429192168);
+     DK(KP1_396752498, +1.396752498817945707109627006123445079672655238);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       E T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       E T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       E T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       E T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       E T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       E T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       E T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       E T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       E T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       E T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       E T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       E T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       E T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       E T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       E T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       E T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       E T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       E T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       E T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       E T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       E T6Z, T70, T71, T72, T73, T74, T75, T76, T77, T78, T79, T7a;
+	       E T7b, T7c, T7d, T7e, T7f, T7g, T7h, T7i, T7j, T7k, T7l, T7m;
+	       E T7n, T7o, T7p, T7q, T7r, T7s, T7t, T7u, T7v, T7w, T7x, T7y;
+	       E T7z, T7A, T7B, T7C, T7D, T7E, T7F, T7G, T7H, T7I, T7J, T7K;
+	       E T7L, T7M, T7N, T7O, T7P, T7Q, T7R, T7S, T7T, T7U, T7V, T7W;
+	       E T7X, T7Y, T7Z, T80, T81, T82;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = I[WS(is, 32)];
+	       Ty = I[WS(is, 33)];
+	       Tz = I[WS(is, 34)];
+	       TA = I[WS(is, 35)];
+	       TB = I[WS(is, 36)];
+	       TC = I[WS(is, 37)];
+	       TD = I[WS(is, 38)];
+	       TE = I[WS(is, 39)];
+	       TF = I[WS(is, 40)];
+	       TG = I[WS(is, 41)];
+	       TH = I[WS(is, 42)];
+	       TI = I[WS(is, 43)];
+	       TJ = I[WS(is, 44)];
+	       TK = I[WS(is, 45)];
+	       TL = I[WS(is, 46)];
+	       TM = I[WS(is, 47)];
+	       TN = I[WS(is, 48)];
+	       TO = I[WS(is, 49)];
+	       TP = I[WS(is, 50)];
+	       TQ = I[WS(is, 51)];
+	       TR = I[WS(is, 52)];
+	       TS = I[WS(is, 53)];
+	       TT = I[WS(is, 54)];
+	       TU = I[WS(is, 55)];
+	       TV = I[WS(is, 56)];
+	       TW = I[WS(is, 57)];
+	       TX = I[WS(is, 58)];
+	       TY = I[WS(is, 59)];
+	       TZ = I[WS(is, 60)];
+	       T10 = I[WS(is, 61)];
+	       T11 = I[WS(is, 62)];
+	       T12 = I[WS(is, 63)];
+	       T13 = KP707106781 * (Tw + Tx);
+	       T14 = T1 + T13;
+	       T15 = KP923879532 * Th + KP382683432 * TM;
+	       T16 = KP382683432 * TN + KP923879532 * Tg;
+	       T17 = T15 + T16;
+	       T18 = T14 + T17;
+	       T19 = KP980785280 * T9 + KP195090322 * TU;
+	       T1a = KP555570233 * TF + KP831469612 * To;
+	       T1b = T19 + T1a;
+	       T1c = KP831469612 * Tp + KP555570233 * TE;
+	       T1d = KP195090322 * TV + KP980785280 * T8;
+	       T1e = T1c + T1d;
+	       T1f = T1b + T1e;
+	       T1g = T18 + T1f;
+	       T1h = KP995184726 * T5 + KP098017140 * TY;
+	       T1i = KP634393284 * TB + KP773010453 * Ts;
+	       T1j = T1h + T1i;
+	       T1k = KP881921264 * Tl + KP471396736 * TI;
+	       T1l = KP290284677 * TR + KP956940335 * Tc;
+	       T1m = T1k + T1l;
+	       T1n = T1j + T1m;
+	       T1o = KP956940335 * Td + KP290284677 * TQ;
+	       T1p = KP471396736 * TJ + KP881921264 * Tk;
+	       T1q = T1o + T1p;
+	       T1r = KP773010453 * Tt + KP634393284 * TA;
+	       T1s = KP098017140 * TZ + KP995184726 * T4;
+	       T1t = T1r + T1s;
+	       T1u = T1q + T1t;
+	       T1v = T1n + T1u;
+	       T1w = T1g + T1v;
+	       T1x = KP998795456 * T3 + KP049067674 * T10;
+	       T1y = KP671558954 * Tz + KP740951125 * Tu;
+	       T1z = T1x + T1y;
+	       T1A = KP903989293 * Tj + KP427555093 * TK;
+	       T1B = KP336889853 * TP + KP941544065 * Te;
+	       T1C = T1A + T1B;
+	       T1D = T1z + T1C;
+	       T1E = KP970031253 * Tb + KP242980179 * TS;
+	       T1F = KP514102744 * TH + KP857728610 * Tm;
+	       T1G = T1E + T1F;
+	       T1H = KP803207531 * Tr + KP595699304 * TC;
+	       T1I = KP146730474 * TX + KP989176509 * T6;
+	       T1J = T1H + T1I;
+	       T1K = T1G + T1J;
+	       T1L = T1D + T1K;
+	       T1M = KP989176509 * T7 + KP146730474 * TW;
+	       T1N = KP595699304 * TD + KP803207531 * Tq;
+	       T1O = T1M + T1N;
+	       T1P = KP857728610 * Tn + KP514102744 * TG;
+	       T1Q = KP242980179 * TT + KP970031253 * Ta;
+	       T1R = T1P + T1Q;
+	       T1S = T1O + T1R;
+	       T1T = KP941544065 * Tf + KP336889853 * TO;
+	       T1U = KP427555093 * TL + KP903989293 * Ti;
+	       T1V = T1T + T1U;
+	       T1W = KP740951125 * Tv + KP671558954 * Ty;
+	       T1X = KP049067674 * T11 + KP998795456 * T2;
+	       T1Y = T1W + T1X;
+	       T1Z = T1V + T1Y;
+	       T20 = T1S + T1Z;
+	       T21 = T1L + T20;
+	       T22 = T1w + T21;
+	       T23 = KP707106781 * (Tw - Tx);
+	       T24 = T12 + T23;
+	       T25 = KP923879532 * TM - KP382683432 * Th;
+	       T26 = KP382683432 * Tg - KP923879532 * TN;
+	       T27 = T25 + T26;
+	       T28 = T24 + T27;
+	       T29 = KP980785280 * TU - KP195090322 * T9;
+	       T2a = KP555570233 * To - KP831469612 * TF;
+	       T2b = T29 + T2a;
+	       T2c = KP831469612 * TE - KP555570233 * Tp;
+	       T2d = KP195090322 * T8 - KP980785280 * TV;
+	       T2e = T2c + T2d;
+	       T2f = T2b + T2e;
+	       T2g = T28 + T2f;
+	       T2h = KP995184726 * TY - KP098017140 * T5;
+	       T2i = KP634393284 * Ts - KP773010453 * TB;
+	       T2j = T2h + T2i;
+	       T2k = KP881921264 * TI - KP471396736 * Tl;
+	       T2l = KP290284677 * Tc - KP956940335 * TR;
+	       T2m = T2k + T2l;
+	       T2n = T2j + T2m;
+	       T2o = KP956940335 * TQ - KP290284677 * Td;
+	       T2p = KP471396736 * Tk - KP881921264 * TJ;
+	       T2q = T2o + T2p;
+	       T2r = KP773010453 * TA - KP634393284 * Tt;
+	       T2s = KP098017140 * T4 - KP995184726 * TZ;
+	       T2t = T2r + T2s;
+	       T2u = T2q + T2t;
+	       T2v = T2n + T2u;
+	       T2w = T2g + T2v;
+	       T2x = KP998795456 * T10 - KP049067674 * T3;
+	       T2y = KP671558954 * Tu - KP740951125 * Tz;
+	       T2z = T2x + T2y;
+	       T2A = KP903989293 * TK - KP427555093 * Tj;
+	       T2B = KP336889853 * Te - KP941544065 * TP;
+	       T2C = T2A + T2B;
+	       T2D = T2z + T2C;
+	       T2E = KP970031253 * TS - KP242980179 * Tb;
+	       T2F = KP514102744 * Tm - KP857728610 * TH;
+	       T2G = T2E + T2F;
+	       T2H = KP803207531 * TC - KP595699304 * Tr;
+	       T2I = KP146730474 * T6 - KP989176509 * TX;
+	       T2J = T2H + T2I;
+	       T2K = T2G + T2J;
+	       T2L = T2D + T2K;
+	       T2M = KP989176509 * TW - KP146730474 * T7;
+	       T2N = KP595699304 * Tq - KP803207531 * TD;
+	       T2O = T2M + T2N;
+	       T2P = KP857728610 * TG - KP514102744 * Tn;
+	       T2Q = KP242980179 * Ta - KP970031253 * TT;
+	       T2R = T2P + T2Q;
+	       T2S = T2O + T2R;
+	       T2T = KP941544065 * TO - KP336889853 * Tf;
+	       T2U = KP427555093 * Ti - KP903989293 * TL;
+	       T2V = T2T + T2U;
+	       T2W = KP740951125 * Ty - KP671558954 * Tv;
+	       T2X = KP049067674 * T2 - KP998795456 * T11;
+	       T2Y = T2W + T2X;
+	       T2Z = T2V + T2Y;
+	       T30 = T2S + T2Z;
+	       T31 = T2L + T30;
+	       T32 = T2w + T31;
+	       O[0] = KP1_999849403 * T22 + KP024543076 * T32;
+	       T33 = T1 - T13;
+	       T34 = T25 - T26;
+	       T35 = T33 - T34;
+	       T36 = T19 - T1a;
+	       T37 = T29 - T2a;
+	       T38 = KP707106781 * (T36 - T37);
+	       T39 = T1c - T1d;
+	       T3a = T2c - T2d;
+	       T3b = KP707106781 * (T39 + T3a);
+	       T3c = T38 - T3b;
+	       T3d = T35 + T3c;
+	       T3e = T2h - T2i;
+	       T3f = T1k - T1l;
+	       T3g = T3e + T3f;
+	       T3h = T1h - T1i;
+	       T3i = T2k - T2l;
+	       T3j = T3h - T3i;
+	       T3k = KP382683432 * T3g - KP923879532 * T3j;
+	       T3l = T2o - T2p;
+	       T3m = T1r - T1s;
+	       T3n = T3l + T3m;
+	       T3o = T1o - T1p;
+	       T3p = T2r - T2s;
+	       T3q = T3o - T3p;
+	       T3r = KP923879532 * T3n - KP382683432 * T3q;
+	       T3s = T3k + T3r;
+	       T3t = T3d - T3s;
+	       T3u = T2x - T2y;
+	       T3v = T1A - T1B;
+	       T3w = T3u + T3v;
+	       T3x = T1E - T1F;
+	       T3y = T2E - T2F;
+	       T3z = KP707106781 * (T3x + T3y);
+	       T3A = T1H - T1I;
+	       T3B = T2H - T2I;
+	       T3C = KP707106781 * (T3A - T3B);
+	       T3D = T3z + T3C;
+	       T3E = T3w + T3D;
+	       T3F = T1x - T1y;
+	       T3G = T2A - T2B;
+	       T3H = T3F - T3G;
+	       T3I = KP707106781 * (T3x - T3y);
+	       T3J = KP707106781 * (T3A + T3B);
+	       T3K = T3I - T3J;
+	       T3L = T3H + T3K;
+	       T3M = KP195090322 * T3E - KP980785280 * T3L;
+	       T3N = T2M - T2N;
+	       T3O = T1P - T1Q;
+	       T3P = T3N + T3O;
+	       T3Q = T1T - T1U;
+	       T3R = T2T - T2U;
+	       T3S = KP707106781 * (T3Q + T3R);
+	       T3T = T1W - T1X;
+	       T3U = T2W - T2X;
+	       T3V = KP707106781 * (T3T - T3U);
+	       T3W = T3S + T3V;
+	       T3X = T3P + T3W;
+	       T3Y = T1M - T1N;
+	       T3Z = T2P - T2Q;
+	       T40 = T3Y - T3Z;
+	       T41 = KP707106781 * (T3Q - T3R);
+	       T42 = KP707106781 * (T3T + T3U);
+	       T43 = T41 - T42;
+	       T44 = T40 + T43;
+	       T45 = KP555570233 * T3X - KP831469612 * T44;
+	       T46 = T3M + T45;
+	       T47 = T3t - T46;
+	       T48 = T12 - T23;
+	       T49 = T15 - T16;
+	       T4a = T48 + T49;
+	       T4b = KP707106781 * (T36 + T37);
+	       T4c = KP707106781 * (T39 - T3a);
+	       T4d = T4b + T4c;
+	       T4e = T4a + T4d;
+	       T4f = KP382683432 * T3j + KP923879532 * T3g;
+	       T4g = KP923879532 * T3q + KP382683432 * T3n;
+	       T4h = T4f + T4g;
+	       T4i = T4e + T4h;
+	       T4j = KP195090322 * T3L + KP980785280 * T3E;
+	       T4k = KP555570233 * T44 + KP831469612 * T3X;
+	       T4l = T4j + T4k;
+	       T4m = T4i + T4l;
+	       O[WS(os, 1)] = KP1_998644769 * T47 - KP073614445 * T4m;
+	       T4n = T33 + T34;
+	       T4o = T4b - T4c;
+	       T4p = T4n + T4o;
+	       T4q = T3h + T3i;
+	       T4r = T3e - T3f;
+	       T4s = KP923879532 * T4q + KP382683432 * T4r;
+	       T4t = T3o + T3p;
+	       T4u = T3l - T3m;
+	       T4v = KP382683432 * T4t + KP923879532 * T4u;
+	       T4w = T4s + T4v;
+	       T4x = T4p + T4w;
+	       T4y = T3F + T3G;
+	       T4z = T3z - T3C;
+	       T4A = T4y + T4z;
+	       T4B = T3u - T3v;
+	       T4C = T3I + T3J;
+	       T4D = T4B - T4C;
+	       T4E = KP980785280 * T4A + KP195090322 * T4D;
+	       T4F = T3Y + T3Z;
+	       T4G = T3S - T3V;
+	       T4H = T4F + T4G;
+	       T4I = T3N - T3O;
+	       T4J = T41 + T42;
+	       T4K = T4I - T4J;
+	       T4L = KP831469612 * T4H + KP555570233 * T4K;
+	       T4M = T4E + T4L;
+	       T4N = T4x + T4M;
+	       T4O = T48 - T49;
+	       T4P = T38 + T3b;
+	       T4Q = T4O - T4P;
+	       T4R = KP923879532 * T4r - KP382683432 * T4q;
+	       T4S = KP382683432 * T4u - KP923879532 * T4t;
+	       T4T = T4R + T4S;
+	       T4U = T4Q + T4T;
+	       T4V = KP980785280 * T4D - KP195090322 * T4A;
+	       T4W = KP831469612 * T4K - KP555570233 * T4H;
+	       T4X = T4V + T4W;
+	       T4Y = T4U + T4X;
+	       O[WS(os, 2)] = KP1_996236225 * T4N + KP122641472 * T4Y;
+	       T4Z = T14 - T17;
+	       T50 = T2b - T2e;
+	       T51 = T4Z - T50;
+	       T52 = T1j - T1m;
+	       T53 = T2j - T2m;
+	       T54 = KP707106781 * (T52 - T53);
+	       T55 = T1q - T1t;
+	       T56 = T2q - T2t;
+	       T57 = KP707106781 * (T55 + T56);
+	       T58 = T54 - T57;
+	       T59 = T51 + T58;
+	       T5a = T2z - T2C;
+	       T5b = T1G - T1J;
+	       T5c = T5a + T5b;
+	       T5d = T1z - T1C;
+	       T5e = T2G - T2J;
+	       T5f = T5d - T5e;
+	       T5g = KP382683432 * T5c - KP923879532 * T5f;
+	       T5h = T2O - T2R;
+	       T5i = T1V - T1Y;
+	       T5j = T5h + T5i;
+	       T5k = T1O - T1R;
+	       T5l = T2V - T2Y;
+	       T5m = T5k - T5l;
+	       T5n = KP923879532 * T5j - KP382683432 * T5m;
+	       T5o = T5g + T5n;
+	       T5p = T59 - T5o;
+	       T5q = T24 - T27;
+	       T5r = T1b - T1e;
+	       T5s = T5q + T5r;
+	       T5t = KP707106781 * (T52 + T53);
+	       T5u = KP707106781 * (T55 - T56);
+	       T5v = T5t + T5u;
+	       T5w = T5s + T5v;
+	       T5x = KP382683432 * T5f + KP923879532 * T5c;
+	       T5y = KP923879532 * T5m + KP382683432 * T5j;
+	       T5z = T5x + T5y;
+	       T5A = T5w + T5z;
+	       O[WS(os, 3)] = KP1_992625224 * T5p - KP171594624 * T5A;
+	       T5B = T4Z + T50;
+	       T5C = T5t - T5u;
+	       T5D = T5B + T5C;
+	       T5E = T5d + T5e;
+	       T5F = T5a - T5b;
+	       T5G = KP923879532 * T5E + KP382683432 * T5F;
+	       T5H = T5k + T5l;
+	       T5I = T5h - T5i;
+	       T5J = KP382683432 * T5H + KP923879532 * T5I;
+	       T5K = T5G + T5J;
+	       T5L = T5D + T5K;
+	       T5M = T5q - T5r;
+	       T5N = T54 + T57;
+	       T5O = T5M - T5N;
+	       T5P = KP923879532 * T5F - KP382683432 * T5E;
+	       T5Q = KP382683432 * T5I - KP923879532 * T5H;
+	       T5R = T5P + T5Q;
+	       T5S = T5O + T5R;
+	       O[WS(os, 4)] = KP1_987813940 * T5L + KP220444414 * T5S;
+	       T5T = T4n - T4o;
+	       T5U = T4R - T4S;
+	       T5V = T5T - T5U;
+	       T5W = T4B + T4C;
+	       T5X = T4y - T4z;
+	       T5Y = KP555570233 * T5W - KP831469612 * T5X;
+	       T5Z = T4I + T4J;
+	       T60 = T4F - T4G;
+	       T61 = KP980785280 * T5Z + KP195090322 * T60;
+	       T62 = T5Y + T61;
+	       T63 = T5V - T62;
+	       T64 = T4O + T4P;
+	       T65 = T4s - T4v;
+	       T66 = T64 + T65;
+	       T67 = KP555570233 * T5X + KP831469612 * T5W;
+	       T68 = KP980785280 * T60 - KP195090322 * T5Z;
+	       T69 = T67 + T68;
+	       T6a = T66 + T69;
+	       O[WS(os, 5)] = KP1_981805270 * T63 - KP269161417 * T6a;
+	       T6b = T35 - T3c;
+	       T6c = T4f - T4g;
+	       T6d = T6b + T6c;
+	       T6e = T3H - T3K;
+	       T6f = T3w - T3D;
+	       T6g = KP831469612 * T6e + KP555570233 * T6f;
+	       T6h = T40 - T43;
+	       T6i = T3P - T3W;
+	       T6j = KP195090322 * T6h - KP980785280 * T6i;
+	       T6k = T6g - T6j;
+	       T6l = T6d + T6k;
+	       T6m = T4a - T4d;
+	       T6n = T3k - T3r;
+	       T6o = T6m + T6n;
+	       T6p = KP831469612 * T6f - KP555570233 * T6e;
+	       T6q = KP195090322 * T6i + KP980785280 * T6h;
+	       T6r = T6p - T6q;
+	       T6s = T6o + T6r;
+	       O[WS(os, 6)] = KP1_974602836 * T6l + KP317716286 * T6s;
+	       T6t = T18 - T1f;
+	       T6u = T2n - T2u;
+	       T6v = T6t - T6u;
+	       T6w = T1D - T1K;
+	       T6x = T2D - T2K;
+	       T6y = KP707106781 * (T6w - T6x);
+	       T6z = T1S - T1Z;
+	       T6A = T2S - T2Z;
+	       T6B = KP707106781 * (T6z + T6A);
+	       T6C = T6y - T6B;
+	       T6D = T6v + T6C;
+	       T6E = T28 - T2f;
+	       T6F = T1n - T1u;
+	       T6G = T6E + T6F;
+	       T6H = KP707106781 * (T6w + T6x);
+	       T6I = KP707106781 * (T6z - T6A);
+	       T6J = T6H + T6I;
+	       T6K = T6G + T6J;
+	       O[WS(os, 7)] = KP1_966210974 * T6D - KP366079775 * T6K;
+	       T6L = T6t + T6u;
+	       T6M = T6H - T6I;
+	       T6N = T6L + T6M;
+	       T6O = T6E - T6F;
+	       T6P = T6y + T6B;
+	       T6Q = T6O - T6P;
+	       O[WS(os, 8)] = KP1_956634741 * T6N + KP414222752 * T6Q;
+	       T6R = T6b - T6c;
+	       T6S = T6p + T6q;
+	       T6T = T6R - T6S;
+	       T6U = T6m - T6n;
+	       T6V = T6g + T6j;
+	       T6W = T6U + T6V;
+	       O[WS(os, 9)] = KP1_945879904 * T6T - KP462116216 * T6W;
+	       T6X = T5T + T5U;
+	       T6Y = T67 - T68;
+	       T6Z = T6X + T6Y;
+	       T70 = T64 - T65;
+	       T71 = T5Y - T61;
+	       T72 = T70 + T71;
+	       O[WS(os, 10)] = KP1_933952942 * T6Z + KP509731319 * T72;
+	       T73 = T5B - T5C;
+	       T74 = T5P - T5Q;
+	       T75 = T73 - T74;
+	       T76 = T5M + T5N;
+	       T77 = T5G - T5J;
+	       T78 = T76 + T77;
+	       O[WS(os, 11)] = KP1_920861038 * T75 - KP557039378 * T78;
+	       T79 = T51 - T58;
+	       T7a = T5x - T5y;
+	       T7b = T79 + T7a;
+	       T7c = T5s - T5v;
+	       T7d = T5g - T5n;
+	       T7e = T7c + T7d;
+	       O[WS(os, 12)] = KP1_906612080 * T7b + KP604011898 * T7e;
+	       T7f = T4p - T4w;
+	       T7g = T4V - T4W;
+	       T7h = T7f - T7g;
+	       T7i = T4Q - T4T;
+	       T7j = T4E - T4L;
+	       T7k = T7i + T7j;
+	       O[WS(os, 13)] = KP1_891214650 * T7h - KP650620584 * T7k;
+	       T7l = T3d + T3s;
+	       T7m = T4j - T4k;
+	       T7n = T7l + T7m;
+	       T7o = T4e - T4h;
+	       T7p = T3M - T45;
+	       T7q = T7o + T7p;
+	       O[WS(os, 14)] = KP1_874678023 * T7n + KP696837360 * T7q;
+	       T7r = T1g - T1v;
+	       T7s = T2L - T30;
+	       T7t = T7r - T7s;
+	       T7u = T2g - T2v;
+	       T7v = T1L - T20;
+	       T7w = T7u + T7v;
+	       O[WS(os, 15)] = KP1_857012160 * T7t - KP742634387 * T7w;
+	       T7x = T7r + T7s;
+	       T7y = T7u - T7v;
+	       O[WS(os, 16)] = KP1_838227703 * T7x + KP787984080 * T7y;
+	       T7z = T7l - T7m;
+	       T7A = T7o - T7p;
+	       O[WS(os, 17)] = KP1_818335966 * T7z - KP832859120 * T7A;
+	       T7B = T7f + T7g;
+	       T7C = T7i - T7j;
+	       O[WS(os, 18)] = KP1_797348931 * T7B + KP877232477 * T7C;
+	       T7D = T79 - T7a;
+	       T7E = T7c - T7d;
+	       O[WS(os, 19)] = KP1_775279240 * T7D - KP921077421 * T7E;
+	       T7F = T73 + T74;
+	       T7G = T76 - T77;
+	       O[WS(os, 20)] = KP1_752140188 * T7F + KP964367544 * T7G;
+	       T7H = T6X - T6Y;
+	       T7I = T70 - T71;
+	       O[WS(os, 21)] = KP1_727945712 * T7H - KP1_007076767 * T7I;
+	       T7J = T6R + T6S;
+	       T7K = T6U - T6V;
+	       O[WS(os, 22)] = KP1_702710386 * T7J + KP1_049179365 * T7K;
+	       T7L = T6L - T6M;
+	       T7M = T6O + T6P;
+	       O[WS(os, 23)] = KP1_676449411 * T7L - KP1_090649976 * T7M;
+	       T7N = T6v - T6C;
+	       T7O = T6G - T6J;
+	       O[WS(os, 24)] = KP1_649178605 * T7N + KP1_131463621 * T7O;
+	       T7P = T6d - T6k;
+	       T7Q = T6o - T6r;
+	       O[WS(os, 25)] = KP1_620914396 * T7P - KP1_171595714 * T7Q;
+	       T7R = T5V + T62;
+	       T7S = T66 - T69;
+	       O[WS(os, 26)] = KP1_591673809 * T7R + KP1_211022082 * T7S;
+	       T7T = T5D - T5K;
+	       T7U = T5O - T5R;
+	       O[WS(os, 27)] = KP1_561474457 * T7T - KP1_249718976 * T7U;
+	       T7V = T59 + T5o;
+	       T7W = T5w - T5z;
+	       O[WS(os, 28)] = KP1_530334531 * T7V + KP1_287663085 * T7W;
+	       T7X = T4x - T4M;
+	       T7Y = T4U - T4X;
+	       O[WS(os, 29)] = KP1_498272789 * T7X - KP1_324831555 * T7Y;
+	       T7Z = T3t + T46;
+	       T80 = T4i - T4l;
+	       O[WS(os, 30)] = KP1_465308543 * T7Z + KP1_361201995 * T80;
+	       T81 = T1w - T21;
+	       T82 = T2w - T31;
+	       O[WS(os, 31)] = KP1_431461650 * T81 - KP1_396752498 * T82;
+	       O[WS(os, 32)] = KP1_396752498 * T81 + KP1_431461650 * T82;
+	       O[WS(os, 33)] = KP1_361201995 * T7Z - KP1_465308543 * T80;
+	       O[WS(os, 34)] = KP1_324831555 * T7X + KP1_498272789 * T7Y;
+	       O[WS(os, 35)] = KP1_287663085 * T7V - KP1_530334531 * T7W;
+	       O[WS(os, 36)] = KP1_249718976 * T7T + KP1_561474457 * T7U;
+	       O[WS(os, 37)] = KP1_211022082 * T7R - KP1_591673809 * T7S;
+	       O[WS(os, 38)] = KP1_171595714 * T7P + KP1_620914396 * T7Q;
+	       O[WS(os, 39)] = KP1_131463621 * T7N - KP1_649178605 * T7O;
+	       O[WS(os, 40)] = KP1_090649976 * T7L + KP1_676449411 * T7M;
+	       O[WS(os, 41)] = KP1_049179365 * T7J - KP1_702710386 * T7K;
+	       O[WS(os, 42)] = KP1_007076767 * T7H + KP1_727945712 * T7I;
+	       O[WS(os, 43)] = KP964367544 * T7F - KP1_752140188 * T7G;
+	       O[WS(os, 44)] = KP921077421 * T7D + KP1_775279240 * T7E;
+	       O[WS(os, 45)] = KP877232477 * T7B - KP1_797348931 * T7C;
+	       O[WS(os, 46)] = KP832859120 * T7z + KP1_818335966 * T7A;
+	       O[WS(os, 47)] = KP787984080 * T7x - KP1_838227703 * T7y;
+	       O[WS(os, 48)] = KP742634387 * T7t + KP1_857012160 * T7w;
+	       O[WS(os, 49)] = KP696837360 * T7n - KP1_874678023 * T7q;
+	       O[WS(os, 50)] = KP650620584 * T7h + KP1_891214650 * T7k;
+	       O[WS(os, 51)] = KP604011898 * T7b - KP1_906612080 * T7e;
+	       O[WS(os, 52)] = KP557039378 * T75 + KP1_920861038 * T78;
+	       O[WS(os, 53)] = KP509731319 * T6Z - KP1_933952942 * T72;
+	       O[WS(os, 54)] = KP462116216 * T6T + KP1_945879904 * T6W;
+	       O[WS(os, 55)] = KP414222752 * T6N - KP1_956634741 * T6Q;
+	       O[WS(os, 56)] = KP366079775 * T6D + KP1_966210974 * T6K;
+	       O[WS(os, 57)] = KP317716286 * T6l - KP1_974602836 * T6s;
+	       O[WS(os, 58)] = KP269161417 * T63 + KP1_981805270 * T6a;
+	       O[WS(os, 59)] = KP220444414 * T5L - KP1_987813940 * T5S;
+	       O[WS(os, 60)] = KP171594624 * T5p + KP1_992625224 * T5A;
+	       O[WS(os, 61)] = KP122641472 * T4N - KP1_996236225 * T4Y;
+	       O[WS(os, 62)] = KP073614445 * T47 + KP1_998644769 * T4m;
+	       O[WS(os, 63)] = KP024543076 * T22 - KP1_999849403 * T32;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 64, "e11_64", {498, 334, 0, 0}, &GENUS, REDFT11 };
+
+void X(codelet_e11_64) (planner *p) {
+     X(kr2r_register) (p, e11_64, &desc);
+}
+
+#endif
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft11 -n 8 -name e11_8 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 32 FP additions, 28 FP multiplications,
+ * (or, 16 additions, 12 multiplications, 16 fused multiply/add),
+ * 28 stack variables, 11 constants, and 16 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e11_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(16, is), MAKE_VOLATILE_STRIDE(16, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = FMA(KP707106781, T4 - T5, T8);
+	       Ta = FMS(KP923879532, T6, KP382683432 * T3);
+	       Tb = FMS(KP382683432, T2, KP923879532 * T7);
+	       Tc = Ta + Tb;
+	       Td = T9 + Tc;
+	       Te = FMA(KP707106781, T4 + T5, T1);
+	       Tf = FMA(KP923879532, T3, KP382683432 * T6);
+	       Tg = FMA(KP382683432, T7, KP923879532 * T2);
+	       Th = Tf + Tg;
+	       Ti = Te + Th;
+	       O[0] = FMA(KP1_990369453, Ti, KP196034280 * Td);
+	       Tj = FNMS(KP707106781, T4 - T5, T8);
+	       Tk = Tf - Tg;
+	       Tl = Tj + Tk;
+	       Tm = FNMS(KP707106781, T4 + T5, T1);
+	       Tn = Ta - Tb;
+	       To = Tm - Tn;
+	       O[WS(os, 1)] = FMS(KP1_913880671, To, KP580569354 * Tl);
+	       Tp = Tj - Tk;
+	       Tq = Tm + Tn;
+	       O[WS(os, 2)] = FMA(KP1_763842528, Tq, KP942793473 * Tp);
+	       Tr = T9 - Tc;
+	       Ts = Te - Th;
+	       O[WS(os, 3)] = FMS(KP1_546020906, Ts, KP1_268786568 * Tr);
+	       O[WS(os, 4)] = FMA(KP1_268786568, Ts, KP1_546020906 * Tr);
+	       O[WS(os, 5)] = FMS(KP942793473, Tq, KP1_763842528 * Tp);
+	       O[WS(os, 6)] = FMA(KP580569354, To, KP1_913880671 * Tl);
+	       O[WS(os, 7)] = FMS(KP196034280, Ti, KP1_990369453 * Td);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 8, "e11_8", {16, 12, 16, 0}, &GENUS, REDFT11 };
+
+void X(codelet_e11_8) (planner *p) {
+     X(kr2r_register) (p, e11_8, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft11 -n 8 -name e11_8 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 30 FP additions, 26 FP multiplications,
+ * (or, 30 additions, 26 multiplications, 0 fused multiply/add),
+ * 30 stack variables, 11 constants, and 16 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void e11_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(16, is), MAKE_VOLATILE_STRIDE(16, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = KP707106781 * (T4 + T5);
+	       Ta = T1 + T9;
+	       Tb = KP923879532 * T3 + KP382683432 * T6;
+	       Tc = KP382683432 * T7 + KP923879532 * T2;
+	       Td = Tb + Tc;
+	       Te = Ta + Td;
+	       Tf = KP707106781 * (T4 - T5);
+	       Tg = T8 + Tf;
+	       Th = KP923879532 * T6 - KP382683432 * T3;
+	       Ti = KP382683432 * T2 - KP923879532 * T7;
+	       Tj = Th + Ti;
+	       Tk = Tg + Tj;
+	       O[0] = KP1_990369453 * Te + KP196034280 * Tk;
+	       Tl = T1 - T9;
+	       Tm = Th - Ti;
+	       Tn = Tl - Tm;
+	       To = T8 - Tf;
+	       Tp = Tb - Tc;
+	       Tq = To + Tp;
+	       O[WS(os, 1)] = KP1_913880671 * Tn - KP580569354 * Tq;
+	       Tr = Tl + Tm;
+	       Ts = To - Tp;
+	       O[WS(os, 2)] = KP1_763842528 * Tr + KP942793473 * Ts;
+	       Tt = Ta - Td;
+	       Tu = Tg - Tj;
+	       O[WS(os, 3)] = KP1_546020906 * Tt - KP1_268786568 * Tu;
+	       O[WS(os, 4)] = KP1_268786568 * Tt + KP1_546020906 * Tu;
+	       O[WS(os, 5)] = KP942793473 * Tr - KP1_763842528 * Ts;
+	       O[WS(os, 6)] = KP580569354 * Tn + KP1_913880671 * Tq;
+	       O[WS(os, 7)] = KP196034280 * Te - KP1_990369453 * Tk;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 8, "e11_8", {30, 26, 0, 0}, &GENUS, REDFT11 };
+
+void X(codelet_e11_8) (planner *p) {
+     X(kr2r_register) (p, e11_8, &desc);
+}
+
+#endif
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft00 -n 15 -name o00_15 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 63 FP additions, 31 FP multiplications,
+ * (or, 45 additions, 13 multiplications, 18 fused multiply/add),
+ * 53 stack variables, 9 constants, and 30 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o00_15(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(30, is), MAKE_VOLATILE_STRIDE(30, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = T5 + Tb;
+	       Th = T3 + Td;
+	       Ti = FMA(KP1_111140466, Th, KP1_662939224 * Tg);
+	       Tj = T7 + T9;
+	       Tk = T1 + Tf;
+	       Tl = FMA(KP390180644, Tk, KP1_961570560 * Tj);
+	       Tm = Ti + Tl;
+	       Tn = T6 + Ta;
+	       To = T2 + Te;
+	       Tp = FMA(KP765366864, To, KP1_847759065 * Tn);
+	       Tq = KP1_414213562 * (T4 + Tc);
+	       Tr = FMA(KP2_000000000, T8, Tq);
+	       Ts = Tp + Tr;
+	       O[0] = Tm + Ts;
+	       Tt = T3 - Td;
+	       Tu = T5 - Tb;
+	       Tv = Tt + Tu;
+	       Tw = T1 - Tf;
+	       Tx = T7 - T9;
+	       Ty = Tw + Tx;
+	       Tz = FMA(KP765366864, Ty, KP1_847759065 * Tv);
+	       TA = T2 - Te;
+	       TB = T6 - Ta;
+	       TC = KP1_414213562 * (TA + TB);
+	       TD = FMA(KP2_000000000, T4 - Tc, TC);
+	       O[WS(os, 1)] = Tz + TD;
+	       TE = FMS(KP1_847759065, To, KP765366864 * Tn);
+	       TF = FMS(KP2_000000000, T8, Tq);
+	       TG = TE - TF;
+	       TH = FMS(KP1_662939224, Th, KP1_111140466 * Tg);
+	       TI = FMS(KP1_961570560, Tk, KP390180644 * Tj);
+	       TJ = TH + TI;
+	       TK = Ti - Tl;
+	       O[WS(os, 2)] = FMA(KP707106781, TJ + TK, TG);
+	       TL = Tw - Tx;
+	       TM = Tt - Tu;
+	       O[WS(os, 3)] = FMA(KP2_000000000, TA - TB, KP1_414213562 * (TL + TM));
+	       TN = TE + TF;
+	       O[WS(os, 4)] = FMA(KP707106781, TJ - TK, TN);
+	       TO = FMS(KP1_847759065, Ty, KP765366864 * Tv);
+	       TP = FMS(KP2_000000000, T4 - Tc, TC);
+	       O[WS(os, 5)] = TO - TP;
+	       TQ = Tp - Tr;
+	       TR = TI - TH;
+	       O[WS(os, 6)] = TQ + TR;
+	       O[WS(os, 7)] = KP2_000000000 * (TL - TM);
+	       O[WS(os, 8)] = TR - TQ;
+	       O[WS(os, 9)] = TO + TP;
+	       O[WS(os, 10)] = FMS(KP707106781, TJ - TK, TN);
+	       O[WS(os, 11)] = FMS(KP1_414213562, TL + TM, KP2_000000000 * (TA - TB));
+	       O[WS(os, 12)] = FMS(KP707106781, TJ + TK, TG);
+	       O[WS(os, 13)] = Tz - TD;
+	       O[WS(os, 14)] = Tm - Ts;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 15, "o00_15", {45, 13, 18, 0}, &GENUS, RODFT00 };
+
+void X(codelet_o00_15) (planner *p) {
+     X(kr2r_register) (p, o00_15, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft00 -n 15 -name o00_15 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 58 FP additions, 25 FP multiplications,
+ * (or, 58 additions, 25 multiplications, 0 fused multiply/add),
+ * 59 stack variables, 9 constants, and 30 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o00_15(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(30, is), MAKE_VOLATILE_STRIDE(30, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = T3 + Td;
+	       Th = T5 + Tb;
+	       Ti = KP1_111140466 * Tg + KP1_662939224 * Th;
+	       Tj = T1 + Tf;
+	       Tk = T7 + T9;
+	       Tl = KP390180644 * Tj + KP1_961570560 * Tk;
+	       Tm = Ti + Tl;
+	       Tn = T2 + Te;
+	       To = T6 + Ta;
+	       Tp = KP765366864 * Tn + KP1_847759065 * To;
+	       Tq = KP2_000000000 * T8;
+	       Tr = KP1_414213562 * (T4 + Tc);
+	       Ts = Tq + Tr;
+	       Tt = Tp + Ts;
+	       O[0] = Tm + Tt;
+	       Tu = T1 - Tf;
+	       Tv = T7 - T9;
+	       Tw = Tu + Tv;
+	       Tx = T3 - Td;
+	       Ty = T5 - Tb;
+	       Tz = Tx + Ty;
+	       TA = KP765366864 * Tw + KP1_847759065 * Tz;
+	       TB = KP2_000000000 * (T4 - Tc);
+	       TC = T2 - Te;
+	       TD = T6 - Ta;
+	       TE = KP1_414213562 * (TC + TD);
+	       TF = TB + TE;
+	       O[WS(os, 1)] = TA + TF;
+	       TG = KP1_662939224 * Tg - KP1_111140466 * Th;
+	       TH = KP1_961570560 * Tj - KP390180644 * Tk;
+	       TI = TG + TH;
+	       TJ = Ti - Tl;
+	       TK = KP707106781 * (TI + TJ);
+	       TL = KP1_847759065 * Tn - KP765366864 * To;
+	       TM = Tq - Tr;
+	       TN = TL - TM;
+	       O[WS(os, 2)] = TK + TN;
+	       TO = KP2_000000000 * (TC - TD);
+	       TP = Tu - Tv;
+	       TQ = Tx - Ty;
+	       TR = KP1_414213562 * (TP + TQ);
+	       O[WS(os, 3)] = TO + TR;
+	       TS = KP707106781 * (TI - TJ);
+	       TT = TL + TM;
+	       O[WS(os, 4)] = TS + TT;
+	       TU = KP1_847759065 * Tw - KP765366864 * Tz;
+	       TV = TB - TE;
+	       O[WS(os, 5)] = TU - TV;
+	       TW = Tp - Ts;
+	       TX = TH - TG;
+	       O[WS(os, 6)] = TW + TX;
+	       O[WS(os, 7)] = KP2_000000000 * (TP - TQ);
+	       O[WS(os, 8)] = TX - TW;
+	       O[WS(os, 9)] = TU + TV;
+	       O[WS(os, 10)] = TS - TT;
+	       O[WS(os, 11)] = TR - TO;
+	       O[WS(os, 12)] = TK - TN;
+	       O[WS(os, 13)] = TA - TF;
+	       O[WS(os, 14)] = Tm - Tt;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 15, "o00_15", {58, 25, 0, 0}, &GENUS, RODFT00 };
+
+void X(codelet_o00_15) (planner *p) {
+     X(kr2r_register) (p, o00_15, &desc);
+}
+
+#endif
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft00 -n 3 -name o00_3 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 5 FP additions, 5 FP multiplications,
+ * (or, 3 additions, 3 multiplications, 2 fused multiply/add),
+ * 3 stack variables, 2 constants, and 6 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o00_3(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(6, is), MAKE_VOLATILE_STRIDE(6, os)) {
+	       E T1, T2, T3;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       O[0] = FMA(KP2_000000000, T2, KP1_414213562 * (T1 + T3));
+	       O[WS(os, 1)] = KP2_000000000 * (T1 - T3);
+	       O[WS(os, 2)] = FMS(KP1_414213562, T1 + T3, KP2_000000000 * T2);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 3, "o00_3", {3, 3, 2, 0}, &GENUS, RODFT00 };
+
+void X(codelet_o00_3) (planner *p) {
+     X(kr2r_register) (p, o00_3, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft00 -n 3 -name o00_3 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 4 FP additions, 3 FP multiplications,
+ * (or, 4 additions, 3 multiplications, 0 fused multiply/add),
+ * 5 stack variables, 2 constants, and 6 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o00_3(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(6, is), MAKE_VOLATILE_STRIDE(6, os)) {
+	       E T1, T2, T3, T4, T5;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = KP2_000000000 * T2;
+	       T5 = KP1_414213562 * (T1 + T3);
+	       O[0] = T4 + T5;
+	       O[WS(os, 1)] = KP2_000000000 * (T1 - T3);
+	       O[WS(os, 2)] = T5 - T4;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 3, "o00_3", {4, 3, 0, 0}, &GENUS, RODFT00 };
+
+void X(codelet_o00_3) (planner *p) {
+     X(kr2r_register) (p, o00_3, &desc);
+}
+
+#endif
@@ -0,0 +1,519 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft00 -n 31 -name o00_31 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 170 FP additions, 78 FP multiplications,
+ * (or, 124 additions, 32 multiplications, 46 fused multiply/add),
+ * 150 stack variables, 19 constants, and 62 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o00_31(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(62, is), MAKE_VOLATILE_STRIDE(62, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = Tb + Tl;
+	       Tx = T5 + Tr;
+	       Ty = FMA(KP942793473, Tx, KP1_763842528 * Tw);
+	       Tz = Td + Tj;
+	       TA = T3 + Tt;
+	       TB = FMA(KP580569354, TA, KP1_913880671 * Tz);
+	       TC = Ty + TB;
+	       TD = T9 + Tn;
+	       TE = T7 + Tp;
+	       TF = FMA(KP1_268786568, TE, KP1_546020906 * TD);
+	       TG = Tf + Th;
+	       TH = T1 + Tv;
+	       TI = FMA(KP196034280, TH, KP1_990369453 * TG);
+	       TJ = TF + TI;
+	       TK = TC + TJ;
+	       TL = Ta + Tm;
+	       TM = T6 + Tq;
+	       TN = FMA(KP1_111140466, TM, KP1_662939224 * TL);
+	       TO = Te + Ti;
+	       TP = T2 + Tu;
+	       TQ = FMA(KP390180644, TP, KP1_961570560 * TO);
+	       TR = TN + TQ;
+	       TS = Tc + Tk;
+	       TT = T4 + Ts;
+	       TU = FMA(KP765366864, TT, KP1_847759065 * TS);
+	       TV = KP1_414213562 * (T8 + To);
+	       TW = FMA(KP2_000000000, Tg, TV);
+	       TX = TU + TW;
+	       TY = TR + TX;
+	       O[0] = TK + TY;
+	       TZ = T5 - Tr;
+	       T10 = Tb - Tl;
+	       T11 = TZ + T10;
+	       T12 = T3 - Tt;
+	       T13 = Td - Tj;
+	       T14 = T12 + T13;
+	       T15 = FMA(KP1_111140466, T14, KP1_662939224 * T11);
+	       T16 = T7 - Tp;
+	       T17 = T9 - Tn;
+	       T18 = T16 + T17;
+	       T19 = T1 - Tv;
+	       T1a = Tf - Th;
+	       T1b = T19 + T1a;
+	       T1c = FMA(KP390180644, T1b, KP1_961570560 * T18);
+	       T1d = T15 + T1c;
+	       T1e = T6 - Tq;
+	       T1f = Ta - Tm;
+	       T1g = T1e + T1f;
+	       T1h = T2 - Tu;
+	       T1i = Te - Ti;
+	       T1j = T1h + T1i;
+	       T1k = FMA(KP765366864, T1j, KP1_847759065 * T1g);
+	       T1l = T4 - Ts;
+	       T1m = Tc - Tk;
+	       T1n = KP1_414213562 * (T1l + T1m);
+	       T1o = FMA(KP2_000000000, T8 - To, T1n);
+	       T1p = T1k + T1o;
+	       O[WS(os, 1)] = T1d + T1p;
+	       T1q = FMS(KP1_763842528, Tx, KP942793473 * Tw);
+	       T1r = FMS(KP1_913880671, TA, KP580569354 * Tz);
+	       T1s = T1q + T1r;
+	       T1t = TF - TI;
+	       T1u = T1s + T1t;
+	       T1v = Ty - TB;
+	       T1w = FMS(KP1_546020906, TE, KP1_268786568 * TD);
+	       T1x = FMS(KP1_990369453, TH, KP196034280 * TG);
+	       T1y = T1w + T1x;
+	       T1z = T1v + T1y;
+	       T1A = FMA(KP382683432, T1z, KP923879532 * T1u);
+	       T1B = FMS(KP1_847759065, TT, KP765366864 * TS);
+	       T1C = FMS(KP2_000000000, Tg, TV);
+	       T1D = T1B - T1C;
+	       T1E = FMS(KP1_662939224, TM, KP1_111140466 * TL);
+	       T1F = FMS(KP1_961570560, TP, KP390180644 * TO);
+	       T1G = T1E + T1F;
+	       T1H = TN - TQ;
+	       T1I = FMA(KP707106781, T1G + T1H, T1D);
+	       O[WS(os, 2)] = T1A + T1I;
+	       T1J = T12 - T13;
+	       T1K = TZ - T10;
+	       T1L = T1J + T1K;
+	       T1M = T19 - T1a;
+	       T1N = T16 - T17;
+	       T1O = T1M + T1N;
+	       T1P = FMA(KP765366864, T1O, KP1_847759065 * T1L);
+	       T1Q = T1h - T1i;
+	       T1R = T1e - T1f;
+	       T1S = KP1_414213562 * (T1Q + T1R);
+	       T1T = FMA(KP2_000000000, T1l - T1m, T1S);
+	       O[WS(os, 3)] = T1P + T1T;
+	       T1U = T1y - T1v;
+	       T1V = T1s - T1t;
+	       T1W = FMA(KP923879532, T1V, KP382683432 * T1U);
+	       T1X = T1B + T1C;
+	       T1Y = FMS(KP707106781, T1H - T1G, T1X);
+	       O[WS(os, 4)] = T1W - T1Y;
+	       T1Z = FMS(KP1_847759065, T1j, KP765366864 * T1g);
+	       T20 = FMS(KP2_000000000, T8 - To, T1n);
+	       T21 = T1Z - T20;
+	       T22 = FMS(KP1_662939224, T14, KP1_111140466 * T11);
+	       T23 = FMS(KP1_961570560, T1b, KP390180644 * T18);
+	       T24 = T22 + T23;
+	       T25 = T15 - T1c;
+	       O[WS(os, 5)] = FMA(KP707106781, T24 + T25, T21);
+	       T26 = T1E - T1F;
+	       T27 = TU - TW;
+	       T28 = T26 - T27;
+	       T29 = T1x - T1w;
+	       T2a = T1q - T1r;
+	       T2b = T29 - T2a;
+	       T2c = TJ - TC;
+	       O[WS(os, 6)] = FMS(KP707106781, T2b - T2c, T28);
+	       T2d = T1M - T1N;
+	       T2e = T1J - T1K;
+	       O[WS(os, 7)] = FMA(KP2_000000000, T1Q - T1R, KP1_414213562 * (T2d + T2e));
+	       T2f = T26 + T27;
+	       O[WS(os, 8)] = FMS(KP707106781, T2b + T2c, T2f);
+	       T2g = T1Z + T20;
+	       O[WS(os, 9)] = FMA(KP707106781, T24 - T25, T2g);
+	       T2h = FMS(KP923879532, T1U, KP382683432 * T1V);
+	       T2i = FMA(KP707106781, T1H - T1G, T1X);
+	       O[WS(os, 10)] = T2h - T2i;
+	       T2j = FMS(KP1_847759065, T1O, KP765366864 * T1L);
+	       T2k = FMS(KP2_000000000, T1l - T1m, T1S);
+	       O[WS(os, 11)] = T2j - T2k;
+	       T2l = FMS(KP923879532, T1z, KP382683432 * T1u);
+	       T2m = FMS(KP707106781, T1G + T1H, T1D);
+	       O[WS(os, 12)] = T2l + T2m;
+	       T2n = T23 - T22;
+	       T2o = T1o - T1k;
+	       O[WS(os, 13)] = T2n - T2o;
+	       T2p = TR - TX;
+	       T2q = T2a + T29;
+	       O[WS(os, 14)] = T2p + T2q;
+	       O[WS(os, 15)] = KP2_000000000 * (T2d - T2e);
+	       O[WS(os, 16)] = T2q - T2p;
+	       O[WS(os, 17)] = T2n + T2o;
+	       O[WS(os, 18)] = T2l - T2m;
+	       O[WS(os, 19)] = T2j + T2k;
+	       O[WS(os, 20)] = T2h + T2i;
+	       O[WS(os, 21)] = FMS(KP707106781, T24 - T25, T2g);
+	       O[WS(os, 22)] = FMA(KP707106781, T2b + T2c, T2f);
+	       O[WS(os, 23)] = FMS(KP1_414213562, T2d + T2e, KP2_000000000 * (T1Q - T1R));
+	       O[WS(os, 24)] = FMA(KP707106781, T2b - T2c, T28);
+	       O[WS(os, 25)] = FMS(KP707106781, T24 + T25, T21);
+	       O[WS(os, 26)] = T1W + T1Y;
+	       O[WS(os, 27)] = T1P - T1T;
+	       O[WS(os, 28)] = T1A - T1I;
+	       O[WS(os, 29)] = T1d - T1p;
+	       O[WS(os, 30)] = TK - TY;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 31, "o00_31", {124, 32, 46, 0}, &GENUS, RODFT00 };
+
+void X(codelet_o00_31) (planner *p) {
+     X(kr2r_register) (p, o00_31, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft00 -n 31 -name o00_31 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 160 FP additions, 67 FP multiplications,
+ * (or, 160 additions, 67 multiplications, 0 fused multiply/add),
+ * 161 stack variables, 19 constants, and 62 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o00_31(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(62, is), MAKE_VOLATILE_STRIDE(62, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = T5 + Tr;
+	       Tx = Tb + Tl;
+	       Ty = KP942793473 * Tw + KP1_763842528 * Tx;
+	       Tz = T3 + Tt;
+	       TA = Td + Tj;
+	       TB = KP580569354 * Tz + KP1_913880671 * TA;
+	       TC = Ty + TB;
+	       TD = T7 + Tp;
+	       TE = T9 + Tn;
+	       TF = KP1_268786568 * TD + KP1_546020906 * TE;
+	       TG = T1 + Tv;
+	       TH = Tf + Th;
+	       TI = KP196034280 * TG + KP1_990369453 * TH;
+	       TJ = TF + TI;
+	       TK = TC + TJ;
+	       TL = T6 + Tq;
+	       TM = Ta + Tm;
+	       TN = KP1_111140466 * TL + KP1_662939224 * TM;
+	       TO = T2 + Tu;
+	       TP = Te + Ti;
+	       TQ = KP390180644 * TO + KP1_961570560 * TP;
+	       TR = TN + TQ;
+	       TS = T4 + Ts;
+	       TT = Tc + Tk;
+	       TU = KP765366864 * TS + KP1_847759065 * TT;
+	       TV = KP2_000000000 * Tg;
+	       TW = KP1_414213562 * (T8 + To);
+	       TX = TV + TW;
+	       TY = TU + TX;
+	       TZ = TR + TY;
+	       O[0] = TK + TZ;
+	       T10 = T3 - Tt;
+	       T11 = Td - Tj;
+	       T12 = T10 + T11;
+	       T13 = T5 - Tr;
+	       T14 = Tb - Tl;
+	       T15 = T13 + T14;
+	       T16 = KP1_111140466 * T12 + KP1_662939224 * T15;
+	       T17 = T1 - Tv;
+	       T18 = Tf - Th;
+	       T19 = T17 + T18;
+	       T1a = T7 - Tp;
+	       T1b = T9 - Tn;
+	       T1c = T1a + T1b;
+	       T1d = KP390180644 * T19 + KP1_961570560 * T1c;
+	       T1e = T16 + T1d;
+	       T1f = T2 - Tu;
+	       T1g = Te - Ti;
+	       T1h = T1f + T1g;
+	       T1i = T6 - Tq;
+	       T1j = Ta - Tm;
+	       T1k = T1i + T1j;
+	       T1l = KP765366864 * T1h + KP1_847759065 * T1k;
+	       T1m = KP2_000000000 * (T8 - To);
+	       T1n = T4 - Ts;
+	       T1o = Tc - Tk;
+	       T1p = KP1_414213562 * (T1n + T1o);
+	       T1q = T1m + T1p;
+	       T1r = T1l + T1q;
+	       O[WS(os, 1)] = T1e + T1r;
+	       T1s = Ty - TB;
+	       T1t = KP1_546020906 * TD - KP1_268786568 * TE;
+	       T1u = KP1_990369453 * TG - KP196034280 * TH;
+	       T1v = T1t + T1u;
+	       T1w = T1s + T1v;
+	       T1x = KP1_763842528 * Tw - KP942793473 * Tx;
+	       T1y = KP1_913880671 * Tz - KP580569354 * TA;
+	       T1z = T1x + T1y;
+	       T1A = TF - TI;
+	       T1B = T1z + T1A;
+	       T1C = KP382683432 * T1w + KP923879532 * T1B;
+	       T1D = KP1_662939224 * TL - KP1_111140466 * TM;
+	       T1E = KP1_961570560 * TO - KP390180644 * TP;
+	       T1F = T1D + T1E;
+	       T1G = TN - TQ;
+	       T1H = KP707106781 * (T1F + T1G);
+	       T1I = KP1_847759065 * TS - KP765366864 * TT;
+	       T1J = TV - TW;
+	       T1K = T1I - T1J;
+	       T1L = T1H + T1K;
+	       O[WS(os, 2)] = T1C + T1L;
+	       T1M = T17 - T18;
+	       T1N = T1a - T1b;
+	       T1O = T1M + T1N;
+	       T1P = T10 - T11;
+	       T1Q = T13 - T14;
+	       T1R = T1P + T1Q;
+	       T1S = KP765366864 * T1O + KP1_847759065 * T1R;
+	       T1T = KP2_000000000 * (T1n - T1o);
+	       T1U = T1f - T1g;
+	       T1V = T1i - T1j;
+	       T1W = KP1_414213562 * (T1U + T1V);
+	       T1X = T1T + T1W;
+	       O[WS(os, 3)] = T1S + T1X;
+	       T1Y = T1z - T1A;
+	       T1Z = T1v - T1s;
+	       T20 = KP923879532 * T1Y + KP382683432 * T1Z;
+	       T21 = KP707106781 * (T1G - T1F);
+	       T22 = T1I + T1J;
+	       T23 = T21 - T22;
+	       O[WS(os, 4)] = T20 - T23;
+	       T24 = KP1_662939224 * T12 - KP1_111140466 * T15;
+	       T25 = KP1_961570560 * T19 - KP390180644 * T1c;
+	       T26 = T24 + T25;
+	       T27 = T16 - T1d;
+	       T28 = KP707106781 * (T26 + T27);
+	       T29 = KP1_847759065 * T1h - KP765366864 * T1k;
+	       T2a = T1m - T1p;
+	       T2b = T29 - T2a;
+	       O[WS(os, 5)] = T28 + T2b;
+	       T2c = T1u - T1t;
+	       T2d = T1x - T1y;
+	       T2e = T2c - T2d;
+	       T2f = TJ - TC;
+	       T2g = KP707106781 * (T2e - T2f);
+	       T2h = T1D - T1E;
+	       T2i = TU - TX;
+	       T2j = T2h - T2i;
+	       O[WS(os, 6)] = T2g - T2j;
+	       T2k = KP2_000000000 * (T1U - T1V);
+	       T2l = T1M - T1N;
+	       T2m = T1P - T1Q;
+	       T2n = KP1_414213562 * (T2l + T2m);
+	       O[WS(os, 7)] = T2k + T2n;
+	       T2o = KP707106781 * (T2e + T2f);
+	       T2p = T2h + T2i;
+	       O[WS(os, 8)] = T2o - T2p;
+	       T2q = KP707106781 * (T26 - T27);
+	       T2r = T29 + T2a;
+	       O[WS(os, 9)] = T2q + T2r;
+	       T2s = KP923879532 * T1Z - KP382683432 * T1Y;
+	       T2t = T22 + T21;
+	       O[WS(os, 10)] = T2s - T2t;
+	       T2u = KP1_847759065 * T1O - KP765366864 * T1R;
+	       T2v = T1T - T1W;
+	       O[WS(os, 11)] = T2u - T2v;
+	       T2w = KP923879532 * T1w - KP382683432 * T1B;
+	       T2x = T1H - T1K;
+	       O[WS(os, 12)] = T2w + T2x;
+	       T2y = T25 - T24;
+	       T2z = T1q - T1l;
+	       O[WS(os, 13)] = T2y - T2z;
+	       T2A = TR - TY;
+	       T2B = T2d + T2c;
+	       O[WS(os, 14)] = T2A + T2B;
+	       O[WS(os, 15)] = KP2_000000000 * (T2l - T2m);
+	       O[WS(os, 16)] = T2B - T2A;
+	       O[WS(os, 17)] = T2y + T2z;
+	       O[WS(os, 18)] = T2w - T2x;
+	       O[WS(os, 19)] = T2u + T2v;
+	       O[WS(os, 20)] = T2s + T2t;
+	       O[WS(os, 21)] = T2q - T2r;
+	       O[WS(os, 22)] = T2p + T2o;
+	       O[WS(os, 23)] = T2n - T2k;
+	       O[WS(os, 24)] = T2j + T2g;
+	       O[WS(os, 25)] = T28 - T2b;
+	       O[WS(os, 26)] = T20 + T23;
+	       O[WS(os, 27)] = T1S - T1X;
+	       O[WS(os, 28)] = T1C - T1L;
+	       O[WS(os, 29)] = T1e - T1r;
+	       O[WS(os, 30)] = TK - TZ;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 31, "o00_31", {160, 67, 0, 0}, &GENUS, RODFT00 };
+
+void X(codelet_o00_31) (planner *p) {
+     X(kr2r_register) (p, o00_31, &desc);
+}
+
+#endif
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft00 -n 7 -name o00_7 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 20 FP additions, 12 FP multiplications,
+ * (or, 14 additions, 6 multiplications, 6 fused multiply/add),
+ * 16 stack variables, 4 constants, and 14 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o00_7(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(14, is), MAKE_VOLATILE_STRIDE(14, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = T3 + T5;
+	       T9 = T1 + T7;
+	       Ta = FMA(KP765366864, T9, KP1_847759065 * T8);
+	       Tb = KP1_414213562 * (T2 + T6);
+	       Tc = FMA(KP2_000000000, T4, Tb);
+	       O[0] = Ta + Tc;
+	       Td = T1 - T7;
+	       Te = T3 - T5;
+	       O[WS(os, 1)] = FMA(KP2_000000000, T2 - T6, KP1_414213562 * (Td + Te));
+	       Tf = FMS(KP1_847759065, T9, KP765366864 * T8);
+	       Tg = FMS(KP2_000000000, T4, Tb);
+	       O[WS(os, 2)] = Tf - Tg;
+	       O[WS(os, 3)] = KP2_000000000 * (Td - Te);
+	       O[WS(os, 4)] = Tf + Tg;
+	       O[WS(os, 5)] = FMS(KP1_414213562, Td + Te, KP2_000000000 * (T2 - T6));
+	       O[WS(os, 6)] = Ta - Tc;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 7, "o00_7", {14, 6, 6, 0}, &GENUS, RODFT00 };
+
+void X(codelet_o00_7) (planner *p) {
+     X(kr2r_register) (p, o00_7, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft00 -n 7 -name o00_7 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 18 FP additions, 9 FP multiplications,
+ * (or, 18 additions, 9 multiplications, 0 fused multiply/add),
+ * 19 stack variables, 4 constants, and 14 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o00_7(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(14, is), MAKE_VOLATILE_STRIDE(14, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = T1 + T7;
+	       T9 = T3 + T5;
+	       Ta = KP765366864 * T8 + KP1_847759065 * T9;
+	       Tb = KP2_000000000 * T4;
+	       Tc = KP1_414213562 * (T2 + T6);
+	       Td = Tb + Tc;
+	       O[0] = Ta + Td;
+	       Te = KP2_000000000 * (T2 - T6);
+	       Tf = T1 - T7;
+	       Tg = T3 - T5;
+	       Th = KP1_414213562 * (Tf + Tg);
+	       O[WS(os, 1)] = Te + Th;
+	       Ti = KP1_847759065 * T8 - KP765366864 * T9;
+	       Tj = Tb - Tc;
+	       O[WS(os, 2)] = Ti - Tj;
+	       O[WS(os, 3)] = KP2_000000000 * (Tf - Tg);
+	       O[WS(os, 4)] = Ti + Tj;
+	       O[WS(os, 5)] = Th - Te;
+	       O[WS(os, 6)] = Ta - Td;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 7, "o00_7", {18, 9, 0, 0}, &GENUS, RODFT00 };
+
+void X(codelet_o00_7) (planner *p) {
+     X(kr2r_register) (p, o00_7, &desc);
+}
+
+#endif
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft01 -n 12 -name o01_12 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 54 FP additions, 36 FP multiplications,
+ * (or, 30 additions, 12 multiplications, 24 fused multiply/add),
+ * 50 stack variables, 14 constants, and 24 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o01_12(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DK(KP1_931851652, +1.931851652578136573499486399457794735267809678);
+     DK(KP517638090, +0.517638090205041524697797675248096656698137803);
+     DK(KP1_586706680, +1.586706680582470329159553923002598553257351842);
+     DK(KP1_217522858, +1.217522858017441278832195085796328009032787424);
+     DK(KP1_982889722, +1.982889722747620822289115053857125742555476549);
+     DK(KP261052384, +0.261052384440103183096812455790978020387481410);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP433012701, +0.433012701892219323381861585376468091735701313);
+     DK(KP750000000, +0.750000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(24, is), MAKE_VOLATILE_STRIDE(24, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = FMA(KP1_732050807, T8, T4);
+	       Te = FMA(KP517638090, T2, KP1_931851652 * Ta);
+	       Tf = Td + Te;
+	       Tg = FMA(KP1_217522858, T5, KP1_586706680 * T7);
+	       Th = FMA(KP261052384, T1, KP1_982889722 * Tb);
+	       Ti = Tg + Th;
+	       Tj = Tf + Ti;
+	       Tk = FMA(KP765366864, T3, KP1_847759065 * T9);
+	       Tl = FMA(KP1_414213562, T6, Tc);
+	       Tm = Tk + Tl;
+	       O[0] = Tj + Tm;
+	       Tn = FMS(KP1_847759065, T3, KP765366864 * T9);
+	       To = FNMS(KP1_414213562, T6, Tc);
+	       Tp = Tn - To;
+	       Tq = Td - Te;
+	       Tr = FMS(KP1_586706680, T5, KP1_217522858 * T7);
+	       Ts = FMS(KP1_982889722, T1, KP261052384 * Tb);
+	       Tt = Tr + Ts;
+	       Tu = Tq + Tt;
+	       Tv = FMA(KP500000000, Tu, Tp);
+	       Tw = FNMS(KP1_732050807, T4, T8);
+	       Tx = FMS(KP1_931851652, T2, KP517638090 * Ta);
+	       Ty = Tw - Tx;
+	       Tz = Tg - Th;
+	       O[WS(os, 1)] = FNMS(KP866025403, Ty - Tz, Tv);
+	       TA = Tn + To;
+	       TB = Ty + Tz;
+	       TC = Tq - Tt;
+	       TD = FMA(KP500000000, TC, KP866025403 * TB);
+	       O[WS(os, 2)] = TA - TD;
+	       TE = Tw + Tx;
+	       TF = Ts - Tr;
+	       TG = TE + TF;
+	       TH = Tf - Ti;
+	       TI = FMA(KP750000000, TH, KP433012701 * TG);
+	       TJ = Tk - Tl;
+	       TK = FMS(KP866025403, TG, KP500000000 * TH);
+	       TL = FMA(KP500000000, TK, TJ);
+	       O[WS(os, 3)] = TI + TL;
+	       O[WS(os, 4)] = TK - TJ;
+	       TM = FMS(KP433012701, TB, KP750000000 * TC);
+	       TN = FMA(KP500000000, TD, TA);
+	       O[WS(os, 5)] = TM - TN;
+	       O[WS(os, 6)] = Tu - Tp;
+	       TO = FMS(KP500000000, Tj, Tm);
+	       O[WS(os, 7)] = FMA(KP866025403, TF - TE, TO);
+	       O[WS(os, 8)] = FMS(KP866025403, TF - TE, TO);
+	       O[WS(os, 9)] = FMA(KP866025403, Ty - Tz, Tv);
+	       O[WS(os, 10)] = TN + TM;
+	       O[WS(os, 11)] = TL - TI;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 12, "o01_12", {30, 12, 24, 0}, &GENUS, RODFT01 };
+
+void X(codelet_o01_12) (planner *p) {
+     X(kr2r_register) (p, o01_12, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft01 -n 12 -name o01_12 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 52 FP additions, 33 FP multiplications,
+ * (or, 52 additions, 33 multiplications, 0 fused multiply/add),
+ * 53 stack variables, 14 constants, and 24 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o01_12(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DK(KP517638090, +0.517638090205041524697797675248096656698137803);
+     DK(KP1_931851652, +1.931851652578136573499486399457794735267809678);
+     DK(KP1_217522858, +1.217522858017441278832195085796328009032787424);
+     DK(KP1_586706680, +1.586706680582470329159553923002598553257351842);
+     DK(KP261052384, +0.261052384440103183096812455790978020387481410);
+     DK(KP1_982889722, +1.982889722747620822289115053857125742555476549);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP750000000, +0.750000000000000000000000000000000000000000000);
+     DK(KP433012701, +0.433012701892219323381861585376468091735701313);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(24, is), MAKE_VOLATILE_STRIDE(24, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = T4 + KP1_732050807 * T8;
+	       Te = KP517638090 * T2 + KP1_931851652 * Ta;
+	       Tf = Td + Te;
+	       Tg = KP1_217522858 * T5 + KP1_586706680 * T7;
+	       Th = KP261052384 * T1 + KP1_982889722 * Tb;
+	       Ti = Tg + Th;
+	       Tj = Tf + Ti;
+	       Tk = KP765366864 * T3 + KP1_847759065 * T9;
+	       Tl = KP1_414213562 * T6;
+	       Tm = Tc + Tl;
+	       Tn = Tk + Tm;
+	       O[0] = Tj + Tn;
+	       To = KP1_847759065 * T3 - KP765366864 * T9;
+	       Tp = Tc - Tl;
+	       Tq = To - Tp;
+	       Tr = Td - Te;
+	       Ts = KP1_586706680 * T5 - KP1_217522858 * T7;
+	       Tt = KP1_982889722 * T1 - KP261052384 * Tb;
+	       Tu = Ts + Tt;
+	       Tv = Tr + Tu;
+	       Tw = Tq + KP500000000 * Tv;
+	       Tx = T8 - KP1_732050807 * T4;
+	       Ty = KP1_931851652 * T2 - KP517638090 * Ta;
+	       Tz = Tx - Ty;
+	       TA = Tg - Th;
+	       TB = KP866025403 * (Tz - TA);
+	       O[WS(os, 1)] = Tw - TB;
+	       TC = To + Tp;
+	       TD = Tr - Tu;
+	       TE = Tz + TA;
+	       TF = KP500000000 * TD + KP866025403 * TE;
+	       O[WS(os, 2)] = TC - TF;
+	       TG = Tf - Ti;
+	       TH = Tx + Ty;
+	       TI = Tt - Ts;
+	       TJ = TH + TI;
+	       TK = KP750000000 * TG + KP433012701 * TJ;
+	       TL = Tk - Tm;
+	       TM = KP866025403 * TJ - KP500000000 * TG;
+	       TN = TL + KP500000000 * TM;
+	       O[WS(os, 3)] = TK + TN;
+	       O[WS(os, 4)] = TM - TL;
+	       TO = KP433012701 * TE - KP750000000 * TD;
+	       TP = TC + KP500000000 * TF;
+	       O[WS(os, 5)] = TO - TP;
+	       O[WS(os, 6)] = Tv - Tq;
+	       TQ = KP866025403 * (TI - TH);
+	       TR = KP500000000 * Tj - Tn;
+	       O[WS(os, 7)] = TQ + TR;
+	       O[WS(os, 8)] = TQ - TR;
+	       O[WS(os, 9)] = TB + Tw;
+	       O[WS(os, 10)] = TP + TO;
+	       O[WS(os, 11)] = TN - TK;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 12, "o01_12", {52, 33, 0, 0}, &GENUS, RODFT01 };
+
+void X(codelet_o01_12) (planner *p) {
+     X(kr2r_register) (p, o01_12, &desc);
+}
+
+#endif
@@ -0,0 +1,615 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft01 -n 32 -name o01_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 196 FP additions, 114 FP multiplications,
+ * (or, 128 additions, 46 multiplications, 68 fused multiply/add),
+ * 176 stack variables, 38 constants, and 64 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o01_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = FMA(KP1_028205488, Tb, KP1_715457220 * Tl);
+	       Ty = FMA(KP485960359, T5, KP1_940062506 * Tr);
+	       Tz = Tx + Ty;
+	       TA = FMA(KP1_191398608, Td, KP1_606415062 * Tj);
+	       TB = FMA(KP293460948, T3, KP1_978353019 * Tt);
+	       TC = TA + TB;
+	       TD = Tz + TC;
+	       TE = FMA(KP855110186, T9, KP1_807978586 * Tn);
+	       TF = FMA(KP673779706, T7, KP1_883088130 * Tp);
+	       TG = TE + TF;
+	       TH = FMA(KP1_343117909, Tf, KP1_481902250 * Th);
+	       TI = FMA(KP098135348, T1, KP1_997590912 * Tv);
+	       TJ = TH + TI;
+	       TK = TG + TJ;
+	       TL = TD + TK;
+	       TM = FMA(KP942793473, Ta, KP1_763842528 * Tm);
+	       TN = FMA(KP580569354, T6, KP1_913880671 * Tq);
+	       TO = TM + TN;
+	       TP = FMA(KP1_268786568, Te, KP1_546020906 * Ti);
+	       TQ = FMA(KP196034280, T2, KP1_990369453 * Tu);
+	       TR = TP + TQ;
+	       TS = TO + TR;
+	       TT = FMA(KP1_111140466, Tc, KP1_662939224 * Tk);
+	       TU = FMA(KP390180644, T4, KP1_961570560 * Ts);
+	       TV = TT + TU;
+	       TW = FMA(KP765366864, T8, KP1_847759065 * To);
+	       TX = FMA(KP1_414213562, Tg, Tw);
+	       TY = TW + TX;
+	       TZ = TV + TY;
+	       T10 = TS + TZ;
+	       O[0] = TL + T10;
+	       T11 = FMS(KP1_763842528, Ta, KP942793473 * Tm);
+	       T12 = FMS(KP1_913880671, T6, KP580569354 * Tq);
+	       T13 = T11 + T12;
+	       T14 = TP - TQ;
+	       T15 = T13 + T14;
+	       T16 = TM - TN;
+	       T17 = FMS(KP1_546020906, Te, KP1_268786568 * Ti);
+	       T18 = FMS(KP1_990369453, T2, KP196034280 * Tu);
+	       T19 = T17 + T18;
+	       T1a = T16 + T19;
+	       T1b = FMA(KP382683432, T1a, KP923879532 * T15);
+	       T1c = FMS(KP1_847759065, T8, KP765366864 * To);
+	       T1d = FNMS(KP1_414213562, Tg, Tw);
+	       T1e = T1c - T1d;
+	       T1f = FMS(KP1_662939224, Tc, KP1_111140466 * Tk);
+	       T1g = FMS(KP1_961570560, T4, KP390180644 * Ts);
+	       T1h = T1f + T1g;
+	       T1i = TT - TU;
+	       T1j = FMA(KP707106781, T1h + T1i, T1e);
+	       T1k = T1b + T1j;
+	       T1l = FMS(KP1_715457220, Tb, KP1_028205488 * Tl);
+	       T1m = FMS(KP1_940062506, T5, KP485960359 * Tr);
+	       T1n = T1l + T1m;
+	       T1o = TA - TB;
+	       T1p = T1n + T1o;
+	       T1q = Tx - Ty;
+	       T1r = FMS(KP1_606415062, Td, KP1_191398608 * Tj);
+	       T1s = FMS(KP1_978353019, T3, KP293460948 * Tt);
+	       T1t = T1r + T1s;
+	       T1u = T1q + T1t;
+	       T1v = FMA(KP980785280, T1u, KP195090322 * T1p);
+	       T1w = FMS(KP1_807978586, T9, KP855110186 * Tn);
+	       T1x = FMS(KP1_883088130, T7, KP673779706 * Tp);
+	       T1y = T1w + T1x;
+	       T1z = TH - TI;
+	       T1A = T1y + T1z;
+	       T1B = TE - TF;
+	       T1C = FMS(KP1_481902250, Tf, KP1_343117909 * Th);
+	       T1D = FMS(KP1_997590912, T1, KP098135348 * Tv);
+	       T1E = T1C + T1D;
+	       T1F = T1B + T1E;
+	       T1G = FMS(KP555570233, T1F, KP831469612 * T1A);
+	       T1H = T1v - T1G;
+	       T1I = FMA(KP831469612, T1F, KP555570233 * T1A);
+	       T1J = FMS(KP195090322, T1u, KP980785280 * T1p);
+	       T1K = T1I - T1J;
+	       O[WS(os, 1)] = FMA(KP707106781, T1H + T1K, T1k);
+	       T1L = T1q - T1t;
+	       T1M = T1n - T1o;
+	       T1N = FMS(KP831469612, T1M, KP555570233 * T1L);
+	       T1O = T1E - T1B;
+	       T1P = T1y - T1z;
+	       T1Q = FMA(KP980785280, T1P, KP195090322 * T1O);
+	       T1R = T1N + T1Q;
+	       T1S = T13 - T14;
+	       T1T = T16 - T19;
+	       T1U = FMS(KP382683432, T1T, KP923879532 * T1S);
+	       T1V = T1c + T1d;
+	       T1W = FMA(KP707106781, T1h - T1i, T1V);
+	       T1X = T1U - T1W;
+	       O[WS(os, 2)] = T1R - T1X;
+	       T1Y = T1l - T1m;
+	       T1Z = T1r - T1s;
+	       T20 = T1Y + T1Z;
+	       T21 = TG - TJ;
+	       T22 = T20 - T21;
+	       T23 = Tz - TC;
+	       T24 = T1D - T1C;
+	       T25 = T1w - T1x;
+	       T26 = T24 - T25;
+	       T27 = T23 + T26;
+	       T28 = FMS(KP382683432, T27, KP923879532 * T22);
+	       T29 = T1f - T1g;
+	       T2a = TX - TW;
+	       T2b = T29 + T2a;
+	       T2c = T11 - T12;
+	       T2d = T17 - T18;
+	       T2e = T2c + T2d;
+	       T2f = TO - TR;
+	       T2g = FMA(KP707106781, T2e - T2f, T2b);
+	       O[WS(os, 3)] = T28 - T2g;
+	       T2h = T20 + T21;
+	       T2i = T26 - T23;
+	       T2j = FMS(KP382683432, T2i, KP923879532 * T2h);
+	       T2k = T2a - T29;
+	       T2l = FMS(KP707106781, T2e + T2f, T2k);
+	       O[WS(os, 4)] = T2j - T2l;
+	       T2m = FMA(KP923879532, T1T, KP382683432 * T1S);
+	       T2n = FNMS(KP707106781, T1h - T1i, T1V);
+	       T2o = T2m + T2n;
+	       T2p = FMS(KP980785280, T1O, KP195090322 * T1P);
+	       T2q = FMA(KP831469612, T1L, KP555570233 * T1M);
+	       T2r = T2p - T2q;
+	       T2s = T1N - T1Q;
+	       O[WS(os, 5)] = FMS(KP707106781, T2r + T2s, T2o);
+	       T2t = T1v + T1G;
+	       T2u = FMS(KP923879532, T1a, KP382683432 * T15);
+	       T2v = FMS(KP707106781, T1h + T1i, T1e);
+	       T2w = T2u + T2v;
+	       O[WS(os, 6)] = T2t + T2w;
+	       T2x = T2c - T2d;
+	       T2y = TV - TY;
+	       T2z = T2x + T2y;
+	       T2A = TD - TK;
+	       T2B = T1Y - T1Z;
+	       T2C = T25 + T24;
+	       T2D = T2B + T2C;
+	       O[WS(os, 7)] = FMA(KP707106781, T2A + T2D, T2z);
+	       T2E = T2x - T2y;
+	       O[WS(os, 8)] = FMA(KP707106781, T2D - T2A, T2E);
+	       T2F = T1J + T1I;
+	       T2G = T2u - T2v;
+	       O[WS(os, 9)] = T2F + T2G;
+	       T2H = T2m - T2n;
+	       O[WS(os, 10)] = FMS(KP707106781, T2r - T2s, T2H);
+	       T2I = FMA(KP382683432, T2h, KP923879532 * T2i);
+	       T2J = FMA(KP707106781, T2e + T2f, T2k);
+	       O[WS(os, 11)] = T2I - T2J;
+	       T2K = FMA(KP382683432, T22, KP923879532 * T27);
+	       T2L = FMS(KP707106781, T2e - T2f, T2b);
+	       O[WS(os, 12)] = T2K - T2L;
+	       T2M = T2q + T2p;
+	       T2N = T1U + T1W;
+	       O[WS(os, 13)] = T2M - T2N;
+	       T2O = T1b - T1j;
+	       O[WS(os, 14)] = FMA(KP707106781, T1K - T1H, T2O);
+	       T2P = TS - TZ;
+	       T2Q = T2C - T2B;
+	       O[WS(os, 15)] = T2P + T2Q;
+	       O[WS(os, 16)] = T2Q - T2P;
+	       O[WS(os, 17)] = FMS(KP707106781, T1K - T1H, T2O);
+	       O[WS(os, 18)] = T2N + T2M;
+	       O[WS(os, 19)] = T2K + T2L;
+	       O[WS(os, 20)] = T2I + T2J;
+	       O[WS(os, 21)] = FMA(KP707106781, T2r - T2s, T2H);
+	       O[WS(os, 22)] = T2F - T2G;
+	       O[WS(os, 23)] = FMS(KP707106781, T2D - T2A, T2E);
+	       O[WS(os, 24)] = FMS(KP707106781, T2A + T2D, T2z);
+	       O[WS(os, 25)] = T2t - T2w;
+	       O[WS(os, 26)] = FMA(KP707106781, T2r + T2s, T2o);
+	       O[WS(os, 27)] = T2j + T2l;
+	       O[WS(os, 28)] = T28 + T2g;
+	       O[WS(os, 29)] = T1X + T1R;
+	       O[WS(os, 30)] = FMS(KP707106781, T1H + T1K, T1k);
+	       O[WS(os, 31)] = TL - T10;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 32, "o01_32", {128, 46, 68, 0}, &GENUS, RODFT01 };
+
+void X(codelet_o01_32) (planner *p) {
+     X(kr2r_register) (p, o01_32, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft01 -n 32 -name o01_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 186 FP additions, 103 FP multiplications,
+ * (or, 186 additions, 103 multiplications, 0 fused multiply/add),
+ * 187 stack variables, 38 constants, and 64 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o01_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V, T2W, T2X, T2Y, T2Z, T30, T31;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = KP1_028205488 * Tb + KP1_715457220 * Tl;
+	       Ty = KP485960359 * T5 + KP1_940062506 * Tr;
+	       Tz = Tx + Ty;
+	       TA = KP1_191398608 * Td + KP1_606415062 * Tj;
+	       TB = KP293460948 * T3 + KP1_978353019 * Tt;
+	       TC = TA + TB;
+	       TD = Tz + TC;
+	       TE = KP855110186 * T9 + KP1_807978586 * Tn;
+	       TF = KP673779706 * T7 + KP1_883088130 * Tp;
+	       TG = TE + TF;
+	       TH = KP1_343117909 * Tf + KP1_481902250 * Th;
+	       TI = KP098135348 * T1 + KP1_997590912 * Tv;
+	       TJ = TH + TI;
+	       TK = TG + TJ;
+	       TL = TD + TK;
+	       TM = KP942793473 * Ta + KP1_763842528 * Tm;
+	       TN = KP580569354 * T6 + KP1_913880671 * Tq;
+	       TO = TM + TN;
+	       TP = KP1_268786568 * Te + KP1_546020906 * Ti;
+	       TQ = KP196034280 * T2 + KP1_990369453 * Tu;
+	       TR = TP + TQ;
+	       TS = TO + TR;
+	       TT = KP1_111140466 * Tc + KP1_662939224 * Tk;
+	       TU = KP390180644 * T4 + KP1_961570560 * Ts;
+	       TV = TT + TU;
+	       TW = KP765366864 * T8 + KP1_847759065 * To;
+	       TX = KP1_414213562 * Tg;
+	       TY = Tw + TX;
+	       TZ = TW + TY;
+	       T10 = TV + TZ;
+	       T11 = TS + T10;
+	       O[0] = TL + T11;
+	       T12 = TM - TN;
+	       T13 = KP1_546020906 * Te - KP1_268786568 * Ti;
+	       T14 = KP1_990369453 * T2 - KP196034280 * Tu;
+	       T15 = T13 + T14;
+	       T16 = T12 + T15;
+	       T17 = KP1_763842528 * Ta - KP942793473 * Tm;
+	       T18 = KP1_913880671 * T6 - KP580569354 * Tq;
+	       T19 = T17 + T18;
+	       T1a = TP - TQ;
+	       T1b = T19 + T1a;
+	       T1c = KP382683432 * T16 + KP923879532 * T1b;
+	       T1d = KP1_662939224 * Tc - KP1_111140466 * Tk;
+	       T1e = KP1_961570560 * T4 - KP390180644 * Ts;
+	       T1f = T1d + T1e;
+	       T1g = TT - TU;
+	       T1h = KP707106781 * (T1f + T1g);
+	       T1i = KP1_847759065 * T8 - KP765366864 * To;
+	       T1j = Tw - TX;
+	       T1k = T1i - T1j;
+	       T1l = T1h + T1k;
+	       T1m = T1c + T1l;
+	       T1n = Tx - Ty;
+	       T1o = KP1_606415062 * Td - KP1_191398608 * Tj;
+	       T1p = KP1_978353019 * T3 - KP293460948 * Tt;
+	       T1q = T1o + T1p;
+	       T1r = T1n + T1q;
+	       T1s = KP1_715457220 * Tb - KP1_028205488 * Tl;
+	       T1t = KP1_940062506 * T5 - KP485960359 * Tr;
+	       T1u = T1s + T1t;
+	       T1v = TA - TB;
+	       T1w = T1u + T1v;
+	       T1x = KP980785280 * T1r + KP195090322 * T1w;
+	       T1y = TE - TF;
+	       T1z = KP1_481902250 * Tf - KP1_343117909 * Th;
+	       T1A = KP1_997590912 * T1 - KP098135348 * Tv;
+	       T1B = T1z + T1A;
+	       T1C = T1y + T1B;
+	       T1D = KP1_807978586 * T9 - KP855110186 * Tn;
+	       T1E = KP1_883088130 * T7 - KP673779706 * Tp;
+	       T1F = T1D + T1E;
+	       T1G = TH - TI;
+	       T1H = T1F + T1G;
+	       T1I = KP555570233 * T1C - KP831469612 * T1H;
+	       T1J = T1x - T1I;
+	       T1K = KP831469612 * T1C + KP555570233 * T1H;
+	       T1L = KP195090322 * T1r - KP980785280 * T1w;
+	       T1M = T1K - T1L;
+	       T1N = KP707106781 * (T1J + T1M);
+	       O[WS(os, 1)] = T1m + T1N;
+	       T1O = T1u - T1v;
+	       T1P = T1n - T1q;
+	       T1Q = KP831469612 * T1O - KP555570233 * T1P;
+	       T1R = T1F - T1G;
+	       T1S = T1B - T1y;
+	       T1T = KP980785280 * T1R + KP195090322 * T1S;
+	       T1U = T1Q + T1T;
+	       T1V = T12 - T15;
+	       T1W = T19 - T1a;
+	       T1X = KP382683432 * T1V - KP923879532 * T1W;
+	       T1Y = KP707106781 * (T1f - T1g);
+	       T1Z = T1i + T1j;
+	       T20 = T1Y + T1Z;
+	       T21 = T1X - T20;
+	       O[WS(os, 2)] = T1U - T21;
+	       T22 = Tz - TC;
+	       T23 = T1A - T1z;
+	       T24 = T1D - T1E;
+	       T25 = T23 - T24;
+	       T26 = T22 + T25;
+	       T27 = T1s - T1t;
+	       T28 = T1o - T1p;
+	       T29 = T27 + T28;
+	       T2a = TG - TJ;
+	       T2b = T29 - T2a;
+	       T2c = KP382683432 * T26 - KP923879532 * T2b;
+	       T2d = T17 - T18;
+	       T2e = T13 - T14;
+	       T2f = T2d + T2e;
+	       T2g = TO - TR;
+	       T2h = KP707106781 * (T2f - T2g);
+	       T2i = T1d - T1e;
+	       T2j = TY - TW;
+	       T2k = T2i + T2j;
+	       T2l = T2h + T2k;
+	       O[WS(os, 3)] = T2c - T2l;
+	       T2m = T25 - T22;
+	       T2n = T29 + T2a;
+	       T2o = KP382683432 * T2m - KP923879532 * T2n;
+	       T2p = KP707106781 * (T2f + T2g);
+	       T2q = T2j - T2i;
+	       T2r = T2p - T2q;
+	       O[WS(os, 4)] = T2o - T2r;
+	       T2s = KP980785280 * T1S - KP195090322 * T1R;
+	       T2t = KP831469612 * T1P + KP555570233 * T1O;
+	       T2u = T2s - T2t;
+	       T2v = T1Q - T1T;
+	       T2w = KP707106781 * (T2u + T2v);
+	       T2x = KP923879532 * T1V + KP382683432 * T1W;
+	       T2y = T1Z - T1Y;
+	       T2z = T2x + T2y;
+	       O[WS(os, 5)] = T2w - T2z;
+	       T2A = T1x + T1I;
+	       T2B = KP923879532 * T16 - KP382683432 * T1b;
+	       T2C = T1h - T1k;
+	       T2D = T2B + T2C;
+	       O[WS(os, 6)] = T2A + T2D;
+	       T2E = T2d - T2e;
+	       T2F = TV - TZ;
+	       T2G = T2E + T2F;
+	       T2H = TD - TK;
+	       T2I = T27 - T28;
+	       T2J = T24 + T23;
+	       T2K = T2I + T2J;
+	       T2L = KP707106781 * (T2H + T2K);
+	       O[WS(os, 7)] = T2G + T2L;
+	       T2M = T2E - T2F;
+	       T2N = KP707106781 * (T2K - T2H);
+	       O[WS(os, 8)] = T2M + T2N;
+	       T2O = T1L + T1K;
+	       T2P = T2B - T2C;
+	       O[WS(os, 9)] = T2O + T2P;
+	       T2Q = KP707106781 * (T2u - T2v);
+	       T2R = T2x - T2y;
+	       O[WS(os, 10)] = T2Q - T2R;
+	       T2S = KP382683432 * T2n + KP923879532 * T2m;
+	       T2T = T2p + T2q;
+	       O[WS(os, 11)] = T2S - T2T;
+	       T2U = KP382683432 * T2b + KP923879532 * T26;
+	       T2V = T2h - T2k;
+	       O[WS(os, 12)] = T2U - T2V;
+	       T2W = T2t + T2s;
+	       T2X = T1X + T20;
+	       O[WS(os, 13)] = T2W - T2X;
+	       T2Y = T1c - T1l;
+	       T2Z = KP707106781 * (T1M - T1J);
+	       O[WS(os, 14)] = T2Y + T2Z;
+	       T30 = TS - T10;
+	       T31 = T2J - T2I;
+	       O[WS(os, 15)] = T30 + T31;
+	       O[WS(os, 16)] = T31 - T30;
+	       O[WS(os, 17)] = T2Z - T2Y;
+	       O[WS(os, 18)] = T2X + T2W;
+	       O[WS(os, 19)] = T2U + T2V;
+	       O[WS(os, 20)] = T2S + T2T;
+	       O[WS(os, 21)] = T2Q + T2R;
+	       O[WS(os, 22)] = T2O - T2P;
+	       O[WS(os, 23)] = T2N - T2M;
+	       O[WS(os, 24)] = T2L - T2G;
+	       O[WS(os, 25)] = T2A - T2D;
+	       O[WS(os, 26)] = T2w + T2z;
+	       O[WS(os, 27)] = T2o + T2r;
+	       O[WS(os, 28)] = T2c + T2l;
+	       O[WS(os, 29)] = T21 + T1U;
+	       O[WS(os, 30)] = T1N - T1m;
+	       O[WS(os, 31)] = TL - T11;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 32, "o01_32", {186, 103, 0, 0}, &GENUS, RODFT01 };
+
+void X(codelet_o01_32) (planner *p) {
+     X(kr2r_register) (p, o01_32, &desc);
+}
+
+#endif
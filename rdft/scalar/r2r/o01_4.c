@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft01 -n 4 -name o01_4 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 8 FP additions, 6 FP multiplications,
+ * (or, 4 additions, 2 multiplications, 4 fused multiply/add),
+ * 8 stack variables, 3 constants, and 8 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o01_4(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(8, is), MAKE_VOLATILE_STRIDE(8, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = FMA(KP765366864, T1, KP1_847759065 * T3);
+	       T6 = FMA(KP1_414213562, T2, T4);
+	       O[0] = T5 + T6;
+	       T7 = FMS(KP1_847759065, T1, KP765366864 * T3);
+	       T8 = FNMS(KP1_414213562, T2, T4);
+	       O[WS(os, 1)] = T7 - T8;
+	       O[WS(os, 2)] = T7 + T8;
+	       O[WS(os, 3)] = T5 - T6;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 4, "o01_4", {4, 2, 4, 0}, &GENUS, RODFT01 };
+
+void X(codelet_o01_4) (planner *p) {
+     X(kr2r_register) (p, o01_4, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft01 -n 4 -name o01_4 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 8 FP additions, 5 FP multiplications,
+ * (or, 8 additions, 5 multiplications, 0 fused multiply/add),
+ * 9 stack variables, 3 constants, and 8 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o01_4(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(8, is), MAKE_VOLATILE_STRIDE(8, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = KP765366864 * T1 + KP1_847759065 * T3;
+	       T6 = KP1_414213562 * T2;
+	       T7 = T4 + T6;
+	       O[0] = T5 + T7;
+	       T8 = KP1_847759065 * T1 - KP765366864 * T3;
+	       T9 = T4 - T6;
+	       O[WS(os, 1)] = T8 - T9;
+	       O[WS(os, 2)] = T8 + T9;
+	       O[WS(os, 3)] = T5 - T7;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 4, "o01_4", {8, 5, 0, 0}, &GENUS, RODFT01 };
+
+void X(codelet_o01_4) (planner *p) {
+     X(kr2r_register) (p, o01_4, &desc);
+}
+
+#endif
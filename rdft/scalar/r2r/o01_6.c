@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft01 -n 6 -name o01_6 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 21 FP additions, 16 FP multiplications,
+ * (or, 9 additions, 4 multiplications, 12 fused multiply/add),
+ * 19 stack variables, 8 constants, and 12 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o01_6(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DK(KP1_931851652, +1.931851652578136573499486399457794735267809678);
+     DK(KP517638090, +0.517638090205041524697797675248096656698137803);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP750000000, +0.750000000000000000000000000000000000000000000);
+     DK(KP433012701, +0.433012701892219323381861585376468091735701313);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(12, is), MAKE_VOLATILE_STRIDE(12, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = FMA(KP1_732050807, T4, T2);
+	       T8 = FMA(KP517638090, T1, KP1_931851652 * T5);
+	       T9 = T7 + T8;
+	       Ta = FMA(KP1_414213562, T3, T6);
+	       O[0] = T9 + Ta;
+	       Tb = FNMS(KP1_414213562, T3, T6);
+	       Tc = FNMS(KP1_732050807, T2, T4);
+	       Td = FMS(KP1_931851652, T1, KP517638090 * T5);
+	       Te = Tc - Td;
+	       Tf = T8 - T7;
+	       Tg = FMS(KP500000000, Tf, KP866025403 * Te);
+	       Th = FMS(KP500000000, Tg, Tb);
+	       Ti = FMA(KP433012701, Te, KP750000000 * Tf);
+	       O[WS(os, 1)] = Th - Ti;
+	       O[WS(os, 2)] = Tb + Tg;
+	       Tj = FNMS(KP500000000, T9, Ta);
+	       O[WS(os, 3)] = FMS(KP866025403, Tc + Td, Tj);
+	       O[WS(os, 4)] = FMA(KP866025403, Tc + Td, Tj);
+	       O[WS(os, 5)] = Ti + Th;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 6, "o01_6", {9, 4, 12, 0}, &GENUS, RODFT01 };
+
+void X(codelet_o01_6) (planner *p) {
+     X(kr2r_register) (p, o01_6, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft01 -n 6 -name o01_6 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 20 FP additions, 14 FP multiplications,
+ * (or, 20 additions, 14 multiplications, 0 fused multiply/add),
+ * 21 stack variables, 8 constants, and 12 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o01_6(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DK(KP517638090, +0.517638090205041524697797675248096656698137803);
+     DK(KP1_931851652, +1.931851652578136573499486399457794735267809678);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP433012701, +0.433012701892219323381861585376468091735701313);
+     DK(KP750000000, +0.750000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(12, is), MAKE_VOLATILE_STRIDE(12, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = T2 + KP1_732050807 * T4;
+	       T8 = KP517638090 * T1 + KP1_931851652 * T5;
+	       T9 = T7 + T8;
+	       Ta = KP1_414213562 * T3;
+	       Tb = T6 + Ta;
+	       O[0] = T9 + Tb;
+	       Tc = T8 - T7;
+	       Td = T4 - KP1_732050807 * T2;
+	       Te = KP1_931851652 * T1 - KP517638090 * T5;
+	       Tf = Td - Te;
+	       Tg = KP500000000 * Tc - KP866025403 * Tf;
+	       Th = T6 - Ta;
+	       Ti = KP500000000 * Tg - Th;
+	       Tj = KP433012701 * Tf + KP750000000 * Tc;
+	       O[WS(os, 1)] = Ti - Tj;
+	       O[WS(os, 2)] = Th + Tg;
+	       Tk = KP866025403 * (Td + Te);
+	       Tl = Tb - KP500000000 * T9;
+	       O[WS(os, 3)] = Tk - Tl;
+	       O[WS(os, 4)] = Tk + Tl;
+	       O[WS(os, 5)] = Tj + Ti;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 6, "o01_6", {20, 14, 0, 0}, &GENUS, RODFT01 };
+
+void X(codelet_o01_6) (planner *p) {
+     X(kr2r_register) (p, o01_6, &desc);
+}
+
+#endif
@@ -0,0 +1,1334 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft01 -n 64 -name o01_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 476 FP additions, 270 FP multiplications,
+ * (or, 320 additions, 114 multiplications, 156 fused multiply/add),
+ * 436 stack variables, 78 constants, and 128 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o01_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       E T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       E T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       E T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       E T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       E T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       E T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       E T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       E T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       E T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       E T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       E T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       E T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       E T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       E T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       E T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       E T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       E T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       E T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       E T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       E T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       E T6Z, T70, T71, T72;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = I[WS(is, 32)];
+	       Ty = I[WS(is, 33)];
+	       Tz = I[WS(is, 34)];
+	       TA = I[WS(is, 35)];
+	       TB = I[WS(is, 36)];
+	       TC = I[WS(is, 37)];
+	       TD = I[WS(is, 38)];
+	       TE = I[WS(is, 39)];
+	       TF = I[WS(is, 40)];
+	       TG = I[WS(is, 41)];
+	       TH = I[WS(is, 42)];
+	       TI = I[WS(is, 43)];
+	       TJ = I[WS(is, 44)];
+	       TK = I[WS(is, 45)];
+	       TL = I[WS(is, 46)];
+	       TM = I[WS(is, 47)];
+	       TN = I[WS(is, 48)];
+	       TO = I[WS(is, 49)];
+	       TP = I[WS(is, 50)];
+	       TQ = I[WS(is, 51)];
+	       TR = I[WS(is, 52)];
+	       TS = I[WS(is, 53)];
+	       TT = I[WS(is, 54)];
+	       TU = I[WS(is, 55)];
+	       TV = I[WS(is, 56)];
+	       TW = I[WS(is, 57)];
+	       TX = I[WS(is, 58)];
+	       TY = I[WS(is, 59)];
+	       TZ = I[WS(is, 60)];
+	       T10 = I[WS(is, 61)];
+	       T11 = I[WS(is, 62)];
+	       T12 = I[WS(is, 63)];
+	       T13 = FMA(KP985796384, Tl, KP1_740173982 * TH);
+	       T14 = FMA(KP533425514, Tb, KP1_927552131 * TR);
+	       T15 = T13 + T14;
+	       T16 = FMA(KP1_230463181, Tr, KP1_576692855 * TB);
+	       T17 = FMA(KP244821350, T5, KP1_984959069 * TX);
+	       T18 = T16 + T17;
+	       T19 = T15 + T18;
+	       T1a = FMA(KP899222659, Tj, KP1_786448602 * TJ);
+	       T1b = FMA(KP627363480, Td, KP1_899056361 * TP);
+	       T1c = T1a + T1b;
+	       T1d = FMA(KP1_306345685, Tt, KP1_514417693 * Tz);
+	       T1e = FMA(KP147129127, T3, KP1_994580913 * TZ);
+	       T1f = T1d + T1e;
+	       T1g = T1c + T1f;
+	       T1h = T19 + T1g;
+	       T1i = FMA(KP1_069995239, Tn, KP1_689707130 * TF);
+	       T1j = FMA(KP438202480, T9, KP1_951404260 * TT);
+	       T1k = T1i + T1j;
+	       T1l = FMA(KP1_151616382, Tp, KP1_635169626 * TD);
+	       T1m = FMA(KP341923777, T7, KP1_970555284 * TV);
+	       T1n = T1l + T1m;
+	       T1o = T1k + T1n;
+	       T1p = FMA(KP810482628, Th, KP1_828419511 * TL);
+	       T1q = FMA(KP719790073, Tf, KP1_865985597 * TN);
+	       T1r = T1p + T1q;
+	       T1s = FMA(KP1_379081089, Tv, KP1_448494165 * Tx);
+	       T1t = FMA(KP049082457, T1, KP1_999397637 * T11);
+	       T1u = T1s + T1t;
+	       T1v = T1r + T1u;
+	       T1w = T1o + T1v;
+	       T1x = T1h + T1w;
+	       T1y = FMA(KP1_028205488, Tm, KP1_715457220 * TG);
+	       T1z = FMA(KP485960359, Ta, KP1_940062506 * TS);
+	       T1A = T1y + T1z;
+	       T1B = FMA(KP1_191398608, Tq, KP1_606415062 * TC);
+	       T1C = FMA(KP293460948, T6, KP1_978353019 * TW);
+	       T1D = T1B + T1C;
+	       T1E = T1A + T1D;
+	       T1F = FMA(KP855110186, Ti, KP1_807978586 * TK);
+	       T1G = FMA(KP673779706, Te, KP1_883088130 * TO);
+	       T1H = T1F + T1G;
+	       T1I = FMA(KP1_343117909, Tu, KP1_481902250 * Ty);
+	       T1J = FMA(KP098135348, T2, KP1_997590912 * T10);
+	       T1K = T1I + T1J;
+	       T1L = T1H + T1K;
+	       T1M = T1E + T1L;
+	       T1N = FMA(KP942793473, Tk, KP1_763842528 * TI);
+	       T1O = FMA(KP580569354, Tc, KP1_913880671 * TQ);
+	       T1P = T1N + T1O;
+	       T1Q = FMA(KP1_268786568, Ts, KP1_546020906 * TA);
+	       T1R = FMA(KP196034280, T4, KP1_990369453 * TY);
+	       T1S = T1Q + T1R;
+	       T1T = T1P + T1S;
+	       T1U = FMA(KP1_111140466, To, KP1_662939224 * TE);
+	       T1V = FMA(KP390180644, T8, KP1_961570560 * TU);
+	       T1W = T1U + T1V;
+	       T1X = FMA(KP765366864, Tg, KP1_847759065 * TM);
+	       T1Y = FMA(KP1_414213562, Tw, T12);
+	       T1Z = T1X + T1Y;
+	       T20 = T1W + T1Z;
+	       T21 = T1T + T20;
+	       T22 = T1M + T21;
+	       O[0] = T1x + T22;
+	       T23 = FMS(KP1_740173982, Tl, KP985796384 * TH);
+	       T24 = FMS(KP1_927552131, Tb, KP533425514 * TR);
+	       T25 = T23 + T24;
+	       T26 = T16 - T17;
+	       T27 = T25 + T26;
+	       T28 = T13 - T14;
+	       T29 = FMS(KP1_576692855, Tr, KP1_230463181 * TB);
+	       T2a = FMS(KP1_984959069, T5, KP244821350 * TX);
+	       T2b = T29 + T2a;
+	       T2c = T28 + T2b;
+	       T2d = FMS(KP995184726, T2c, KP098017140 * T27);
+	       T2e = FMS(KP1_786448602, Tj, KP899222659 * TJ);
+	       T2f = FMS(KP1_899056361, Td, KP627363480 * TP);
+	       T2g = T2e + T2f;
+	       T2h = T1d - T1e;
+	       T2i = T2g + T2h;
+	       T2j = T1a - T1b;
+	       T2k = FMS(KP1_514417693, Tt, KP1_306345685 * Tz);
+	       T2l = FMS(KP1_994580913, T3, KP147129127 * TZ);
+	       T2m = T2k + T2l;
+	       T2n = T2j + T2m;
+	       T2o = FMS(KP773010453, T2n, KP634393284 * T2i);
+	       T2p = T2d - T2o;
+	       T2q = FMS(KP1_828419511, Th, KP810482628 * TL);
+	       T2r = FMS(KP1_865985597, Tf, KP719790073 * TN);
+	       T2s = T2q + T2r;
+	       T2t = T1s - T1t;
+	       T2u = T2s + T2t;
+	       T2v = T1p - T1q;
+	       T2w = FMS(KP1_448494165, Tv, KP1_379081089 * Tx);
+	       T2x = FMS(KP1_999397637, T1, KP049082457 * T11);
+	       T2y = T2w + T2x;
+	       T2z = T2v + T2y;
+	       T2A = FMA(KP956940335, T2z, KP290284677 * T2u);
+	       T2B = FMS(KP1_689707130, Tn, KP1_069995239 * TF);
+	       T2C = FMS(KP1_951404260, T9, KP438202480 * TT);
+	       T2D = T2B + T2C;
+	       T2E = T1l - T1m;
+	       T2F = T2D + T2E;
+	       T2G = T1i - T1j;
+	       T2H = FMS(KP1_635169626, Tp, KP1_151616382 * TD);
+	       T2I = FMS(KP1_970555284, T7, KP341923777 * TV);
+	       T2J = T2H + T2I;
+	       T2K = T2G + T2J;
+	       T2L = FMS(KP471396736, T2K, KP881921264 * T2F);
+	       T2M = T2A - T2L;
+	       T2N = T2p + T2M;
+	       T2O = FMA(KP098017140, T2c, KP995184726 * T27);
+	       T2P = FMA(KP634393284, T2n, KP773010453 * T2i);
+	       T2Q = T2O + T2P;
+	       T2R = FMA(KP881921264, T2K, KP471396736 * T2F);
+	       T2S = FMS(KP290284677, T2z, KP956940335 * T2u);
+	       T2T = T2R - T2S;
+	       T2U = T2Q + T2T;
+	       T2V = FMA(KP923879532, T2U, KP382683432 * T2N);
+	       T2W = FMS(KP1_763842528, Tk, KP942793473 * TI);
+	       T2X = FMS(KP1_913880671, Tc, KP580569354 * TQ);
+	       T2Y = T2W + T2X;
+	       T2Z = T1Q - T1R;
+	       T30 = T2Y + T2Z;
+	       T31 = T1N - T1O;
+	       T32 = FMS(KP1_546020906, Ts, KP1_268786568 * TA);
+	       T33 = FMS(KP1_990369453, T4, KP196034280 * TY);
+	       T34 = T32 + T33;
+	       T35 = T31 + T34;
+	       T36 = FMA(KP382683432, T35, KP923879532 * T30);
+	       T37 = FMS(KP1_847759065, Tg, KP765366864 * TM);
+	       T38 = FNMS(KP1_414213562, Tw, T12);
+	       T39 = T37 - T38;
+	       T3a = FMS(KP1_662939224, To, KP1_111140466 * TE);
+	       T3b = FMS(KP1_961570560, T8, KP390180644 * TU);
+	       T3c = T3a + T3b;
+	       T3d = T1U - T1V;
+	       T3e = FMA(KP707106781, T3c + T3d, T39);
+	       T3f = T36 + T3e;
+	       T3g = FMS(KP1_715457220, Tm, KP1_028205488 * TG);
+	       T3h = FMS(KP1_940062506, Ta, KP485960359 * TS);
+	       T3i = T3g + T3h;
+	       T3j = T1B - T1C;
+	       T3k = T3i + T3j;
+	       T3l = T1y - T1z;
+	       T3m = FMS(KP1_606415062, Tq, KP1_191398608 * TC);
+	       T3n = FMS(KP1_978353019, T6, KP293460948 * TW);
+	       T3o = T3m + T3n;
+	       T3p = T3l + T3o;
+	       T3q = FMS(KP195090322, T3p, KP980785280 * T3k);
+	       T3r = FMS(KP1_807978586, Ti, KP855110186 * TK);
+	       T3s = FMS(KP1_883088130, Te, KP673779706 * TO);
+	       T3t = T3r + T3s;
+	       T3u = T1I - T1J;
+	       T3v = T3t + T3u;
+	       T3w = T1F - T1G;
+	       T3x = FMS(KP1_481902250, Tu, KP1_343117909 * Ty);
+	       T3y = FMS(KP1_997590912, T2, KP098135348 * T10);
+	       T3z = T3x + T3y;
+	       T3A = T3w + T3z;
+	       T3B = FMA(KP831469612, T3A, KP555570233 * T3v);
+	       T3C = T3q - T3B;
+	       T3D = FMS(KP555570233, T3A, KP831469612 * T3v);
+	       T3E = FMA(KP980785280, T3p, KP195090322 * T3k);
+	       T3F = T3D - T3E;
+	       T3G = FMS(KP707106781, T3C + T3F, T3f);
+	       O[WS(os, 1)] = T2V - T3G;
+	       T3H = T2y - T2v;
+	       T3I = T2s - T2t;
+	       T3J = FMA(KP995184726, T3I, KP098017140 * T3H);
+	       T3K = T2D - T2E;
+	       T3L = T2G - T2J;
+	       T3M = FMS(KP634393284, T3L, KP773010453 * T3K);
+	       T3N = T3J - T3M;
+	       T3O = T25 - T26;
+	       T3P = T28 - T2b;
+	       T3Q = FMS(KP471396736, T3P, KP881921264 * T3O);
+	       T3R = T2g - T2h;
+	       T3S = T2j - T2m;
+	       T3T = FMS(KP290284677, T3S, KP956940335 * T3R);
+	       T3U = T3Q + T3T;
+	       T3V = T3N - T3U;
+	       T3W = T3i - T3j;
+	       T3X = T3l - T3o;
+	       T3Y = FMS(KP555570233, T3X, KP831469612 * T3W);
+	       T3Z = T3t - T3u;
+	       T40 = T3w - T3z;
+	       T41 = FMS(KP195090322, T40, KP980785280 * T3Z);
+	       T42 = T3Y + T41;
+	       T43 = T2Y - T2Z;
+	       T44 = T31 - T34;
+	       T45 = FMS(KP382683432, T44, KP923879532 * T43);
+	       T46 = T37 + T38;
+	       T47 = FMA(KP707106781, T3c - T3d, T46);
+	       T48 = T45 - T47;
+	       T49 = T42 + T48;
+	       O[WS(os, 2)] = T3V - T49;
+	       T4a = T3g - T3h;
+	       T4b = T3m - T3n;
+	       T4c = T4a + T4b;
+	       T4d = T1H - T1K;
+	       T4e = T4c - T4d;
+	       T4f = T1A - T1D;
+	       T4g = T3r - T3s;
+	       T4h = T3x - T3y;
+	       T4i = T4g + T4h;
+	       T4j = T4f - T4i;
+	       T4k = FMS(KP382683432, T4j, KP923879532 * T4e);
+	       T4l = T3a - T3b;
+	       T4m = T1X - T1Y;
+	       T4n = T4l - T4m;
+	       T4o = T2W - T2X;
+	       T4p = T32 - T33;
+	       T4q = T4o + T4p;
+	       T4r = T1P - T1S;
+	       T4s = FMA(KP707106781, T4q - T4r, T4n);
+	       T4t = T4k - T4s;
+	       T4u = T2B - T2C;
+	       T4v = T2H - T2I;
+	       T4w = T4u + T4v;
+	       T4x = T1u - T1r;
+	       T4y = T4w + T4x;
+	       T4z = T2x - T2w;
+	       T4A = T2q - T2r;
+	       T4B = T4z - T4A;
+	       T4C = T1n - T1k;
+	       T4D = T4B - T4C;
+	       T4E = FMS(KP831469612, T4D, KP555570233 * T4y);
+	       T4F = T23 - T24;
+	       T4G = T29 - T2a;
+	       T4H = T4F + T4G;
+	       T4I = T1c - T1f;
+	       T4J = T4H - T4I;
+	       T4K = T15 - T18;
+	       T4L = T2e - T2f;
+	       T4M = T2k - T2l;
+	       T4N = T4L + T4M;
+	       T4O = T4K - T4N;
+	       T4P = FMA(KP195090322, T4O, KP980785280 * T4J);
+	       T4Q = T4E - T4P;
+	       T4R = FMS(KP980785280, T4O, KP195090322 * T4J);
+	       T4S = FMA(KP555570233, T4D, KP831469612 * T4y);
+	       T4T = T4R - T4S;
+	       O[WS(os, 3)] = FMA(KP707106781, T4Q + T4T, T4t);
+	       T4U = T4x - T4w;
+	       T4V = T4C + T4B;
+	       T4W = FMA(KP195090322, T4V, KP980785280 * T4U);
+	       T4X = T4H + T4I;
+	       T4Y = T4K + T4N;
+	       T4Z = FMA(KP555570233, T4Y, KP831469612 * T4X);
+	       T50 = T4W - T4Z;
+	       T51 = T4c + T4d;
+	       T52 = T4f + T4i;
+	       T53 = FMA(KP382683432, T52, KP923879532 * T51);
+	       T54 = T4l + T4m;
+	       T55 = FMA(KP707106781, T4q + T4r, T54);
+	       T56 = T53 + T55;
+	       O[WS(os, 4)] = T50 - T56;
+	       T57 = FMA(KP881921264, T3P, KP471396736 * T3O);
+	       T58 = FMA(KP956940335, T3S, KP290284677 * T3R);
+	       T59 = T57 + T58;
+	       T5a = T3M + T3J;
+	       T5b = T59 + T5a;
+	       T5c = T3T - T3Q;
+	       T5d = FMS(KP995184726, T3H, KP098017140 * T3I);
+	       T5e = FMA(KP773010453, T3L, KP634393284 * T3K);
+	       T5f = T5d - T5e;
+	       T5g = T5c + T5f;
+	       T5h = FMS(KP382683432, T5g, KP923879532 * T5b);
+	       T5i = FMS(KP707106781, T3c - T3d, T46);
+	       T5j = FMA(KP923879532, T44, KP382683432 * T43);
+	       T5k = T5i - T5j;
+	       T5l = FMA(KP831469612, T3X, KP555570233 * T3W);
+	       T5m = FMA(KP980785280, T40, KP195090322 * T3Z);
+	       T5n = T5l + T5m;
+	       T5o = T3Y - T41;
+	       T5p = FNMS(KP707106781, T5n + T5o, T5k);
+	       O[WS(os, 5)] = T5h + T5p;
+	       T5q = T2d + T2o;
+	       T5r = T2R + T2S;
+	       T5s = T5q + T5r;
+	       T5t = T3E + T3D;
+	       T5u = FMS(KP923879532, T35, KP382683432 * T30);
+	       T5v = FMS(KP707106781, T3c + T3d, T39);
+	       T5w = T5u + T5v;
+	       T5x = T5t + T5w;
+	       O[WS(os, 6)] = T5s + T5x;
+	       T5y = T4o - T4p;
+	       T5z = T1W - T1Z;
+	       T5A = T5y + T5z;
+	       T5B = T4a - T4b;
+	       T5C = T4g - T4h;
+	       T5D = T5B + T5C;
+	       T5E = T1E - T1L;
+	       T5F = FMA(KP707106781, T5D + T5E, T5A);
+	       T5G = T19 - T1g;
+	       T5H = T4u - T4v;
+	       T5I = T4A + T4z;
+	       T5J = T5H + T5I;
+	       T5K = T5G + T5J;
+	       T5L = T4F - T4G;
+	       T5M = T4L - T4M;
+	       T5N = T5L + T5M;
+	       T5O = T1o - T1v;
+	       T5P = T5N + T5O;
+	       T5Q = FMA(KP923879532, T5P, KP382683432 * T5K);
+	       O[WS(os, 7)] = T5F + T5Q;
+	       T5R = T5y - T5z;
+	       T5S = FMA(KP707106781, T5D - T5E, T5R);
+	       T5T = T5J - T5G;
+	       T5U = T5N - T5O;
+	       T5V = FMA(KP923879532, T5U, KP382683432 * T5T);
+	       O[WS(os, 8)] = T5S + T5V;
+	       T5W = T3q + T3B;
+	       T5X = T5u - T5v;
+	       T5Y = T5W + T5X;
+	       T5Z = T5q - T5r;
+	       T60 = T2L + T2A;
+	       T61 = T2O - T2P;
+	       T62 = T60 - T61;
+	       O[WS(os, 9)] = FMA(KP707106781, T5Z + T62, T5Y);
+	       T63 = T59 - T5a;
+	       T64 = T5f - T5c;
+	       T65 = FMS(KP382683432, T64, KP923879532 * T63);
+	       T66 = T5j + T5i;
+	       T67 = FMA(KP707106781, T5n - T5o, T66);
+	       O[WS(os, 10)] = T65 - T67;
+	       T68 = FNMS(KP707106781, T4q + T4r, T54);
+	       T69 = FMS(KP923879532, T52, KP382683432 * T51);
+	       T6a = T68 - T69;
+	       T6b = FMS(KP555570233, T4X, KP831469612 * T4Y);
+	       T6c = FMS(KP980785280, T4V, KP195090322 * T4U);
+	       T6d = T6b + T6c;
+	       T6e = T4Z + T4W;
+	       O[WS(os, 11)] = FMA(KP707106781, T6d - T6e, T6a);
+	       T6f = FMA(KP923879532, T4j, KP382683432 * T4e);
+	       T6g = FMS(KP707106781, T4q - T4r, T4n);
+	       T6h = T6f - T6g;
+	       T6i = T4R + T4S;
+	       O[WS(os, 12)] = T6h + T6i;
+	       T6j = T5l - T5m;
+	       T6k = T45 + T47;
+	       T6l = T6j - T6k;
+	       T6m = T57 - T58;
+	       T6n = T5e + T5d;
+	       T6o = T6m + T6n;
+	       T6p = T3U + T3N;
+	       O[WS(os, 13)] = FMA(KP707106781, T6o - T6p, T6l);
+	       T6q = T2M - T2p;
+	       T6r = T2Q - T2T;
+	       T6s = FMA(KP923879532, T6r, KP382683432 * T6q);
+	       T6t = T36 - T3e;
+	       T6u = FMA(KP707106781, T3F - T3C, T6t);
+	       O[WS(os, 14)] = T6s + T6u;
+	       T6v = T5B - T5C;
+	       T6w = T1T - T20;
+	       T6x = T6v - T6w;
+	       T6y = T1h - T1w;
+	       T6z = T5I - T5H;
+	       T6A = T5L - T5M;
+	       T6B = T6z - T6A;
+	       O[WS(os, 15)] = FMS(KP707106781, T6y + T6B, T6x);
+	       T6C = T6v + T6w;
+	       O[WS(os, 16)] = FMS(KP707106781, T6B - T6y, T6C);
+	       T6D = FMS(KP923879532, T6q, KP382683432 * T6r);
+	       T6E = FNMS(KP707106781, T3F - T3C, T6t);
+	       O[WS(os, 17)] = T6D - T6E;
+	       T6F = T6j + T6k;
+	       O[WS(os, 18)] = FMA(KP707106781, T6o + T6p, T6F);
+	       T6G = T6f + T6g;
+	       T6H = T4P + T4E;
+	       O[WS(os, 19)] = T6G + T6H;
+	       T6I = T69 + T68;
+	       O[WS(os, 20)] = FMS(KP707106781, T6d + T6e, T6I);
+	       T6J = FMA(KP923879532, T64, KP382683432 * T63);
+	       T6K = FMS(KP707106781, T5n - T5o, T66);
+	       O[WS(os, 21)] = T6J - T6K;
+	       T6L = T5X - T5W;
+	       O[WS(os, 22)] = FMS(KP707106781, T62 - T5Z, T6L);
+	       T6M = FMS(KP707106781, T5D - T5E, T5R);
+	       T6N = FMS(KP923879532, T5T, KP382683432 * T5U);
+	       O[WS(os, 23)] = T6M + T6N;
+	       T6O = FMS(KP707106781, T5D + T5E, T5A);
+	       T6P = FMS(KP923879532, T5K, KP382683432 * T5P);
+	       O[WS(os, 24)] = T6O + T6P;
+	       T6Q = T61 + T60;
+	       T6R = T5t - T5w;
+	       O[WS(os, 25)] = T6Q + T6R;
+	       T6S = FMA(KP923879532, T5g, KP382683432 * T5b);
+	       T6T = FMA(KP707106781, T5n + T5o, T5k);
+	       O[WS(os, 26)] = T6S - T6T;
+	       T6U = T6c - T6b;
+	       T6V = T53 - T55;
+	       O[WS(os, 27)] = T6U - T6V;
+	       T6W = T4k + T4s;
+	       O[WS(os, 28)] = FMA(KP707106781, T4Q - T4T, T6W);
+	       T6X = T6n - T6m;
+	       T6Y = T42 - T48;
+	       O[WS(os, 29)] = T6X - T6Y;
+	       T6Z = FMS(KP923879532, T2N, KP382683432 * T2U);
+	       T70 = FMA(KP707106781, T3C + T3F, T3f);
+	       O[WS(os, 30)] = T6Z - T70;
+	       T71 = T1M - T21;
+	       T72 = T6A + T6z;
+	       O[WS(os, 31)] = T71 + T72;
+	       O[WS(os, 32)] = T72 - T71;
+	       O[WS(os, 33)] = T6Z + T70;
+	       O[WS(os, 34)] = T6Y + T6X;
+	       O[WS(os, 35)] = FMS(KP707106781, T4Q - T4T, T6W);
+	       O[WS(os, 36)] = T6V + T6U;
+	       O[WS(os, 37)] = T6S + T6T;
+	       O[WS(os, 38)] = T6Q - T6R;
+	       O[WS(os, 39)] = T6P - T6O;
+	       O[WS(os, 40)] = T6N - T6M;
+	       O[WS(os, 41)] = FMA(KP707106781, T62 - T5Z, T6L);
+	       O[WS(os, 42)] = T6K + T6J;
+	       O[WS(os, 43)] = FMA(KP707106781, T6d + T6e, T6I);
+	       O[WS(os, 44)] = T6H - T6G;
+	       O[WS(os, 45)] = FMS(KP707106781, T6o + T6p, T6F);
+	       O[WS(os, 46)] = T6D + T6E;
+	       O[WS(os, 47)] = FMA(KP707106781, T6B - T6y, T6C);
+	       O[WS(os, 48)] = FMA(KP707106781, T6y + T6B, T6x);
+	       O[WS(os, 49)] = T6s - T6u;
+	       O[WS(os, 50)] = FMS(KP707106781, T6o - T6p, T6l);
+	       O[WS(os, 51)] = T6i - T6h;
+	       O[WS(os, 52)] = FMS(KP707106781, T6d - T6e, T6a);
+	       O[WS(os, 53)] = T67 + T65;
+	       O[WS(os, 54)] = FMS(KP707106781, T5Z + T62, T5Y);
+	       O[WS(os, 55)] = T5V - T5S;
+	       O[WS(os, 56)] = T5Q - T5F;
+	       O[WS(os, 57)] = T5s - T5x;
+	       O[WS(os, 58)] = T5h - T5p;
+	       O[WS(os, 59)] = T56 + T50;
+	       O[WS(os, 60)] = FMS(KP707106781, T4Q + T4T, T4t);
+	       O[WS(os, 61)] = T49 + T3V;
+	       O[WS(os, 62)] = T2V + T3G;
+	       O[WS(os, 63)] = T1x - T22;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 64, "o01_64", {320, 114, 156, 0}, &GENUS, RODFT01 };
+
+void X(codelet_o01_64) (planner *p) {
+     X(kr2r_register) (p, o01_64, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft01 -n 64 -name o01_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 456 FP additions, 249 FP multiplications,
+ * (or, 456 additions, 249 multiplications, 0 fused multiply/add),
+ * 457 stack variables, 78 constants, and 128 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o01_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       E T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       E T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       E T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       E T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       E T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       E T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       E T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       E T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       E T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       E T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       E T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       E T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       E T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       E T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       E T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       E T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       E T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       E T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       E T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       E T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       E T6Z, T70, T71, T72, T73, T74, T75, T76, T77, T78, T79, T7a;
+	       E T7b, T7c, T7d, T7e, T7f, T7g, T7h, T7i, T7j, T7k, T7l, T7m;
+	       E T7n;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = I[WS(is, 32)];
+	       Ty = I[WS(is, 33)];
+	       Tz = I[WS(is, 34)];
+	       TA = I[WS(is, 35)];
+	       TB = I[WS(is, 36)];
+	       TC = I[WS(is, 37)];
+	       TD = I[WS(is, 38)];
+	       TE = I[WS(is, 39)];
+	       TF = I[WS(is, 40)];
+	       TG = I[WS(is, 41)];
+	       TH = I[WS(is, 42)];
+	       TI = I[WS(is, 43)];
+	       TJ = I[WS(is, 44)];
+	       TK = I[WS(is, 45)];
+	       TL = I[WS(is, 46)];
+	       TM = I[WS(is, 47)];
+	       TN = I[WS(is, 48)];
+	       TO = I[WS(is, 49)];
+	       TP = I[WS(is, 50)];
+	       TQ = I[WS(is, 51)];
+	       TR = I[WS(is, 52)];
+	       TS = I[WS(is, 53)];
+	       TT = I[WS(is, 54)];
+	       TU = I[WS(is, 55)];
+	       TV = I[WS(is, 56)];
+	       TW = I[WS(is, 57)];
+	       TX = I[WS(is, 58)];
+	       TY = I[WS(is, 59)];
+	       TZ = I[WS(is, 60)];
+	       T10 = I[WS(is, 61)];
+	       T11 = I[WS(is, 62)];
+	       T12 = I[WS(is, 63)];
+	       T13 = KP985796384 * Tl + KP1_740173982 * TH;
+	       T14 = KP533425514 * Tb + KP1_927552131 * TR;
+	       T15 = T13 + T14;
+	       T16 = KP1_230463181 * Tr + KP1_576692855 * TB;
+	       T17 = KP244821350 * T5 + KP1_984959069 * TX;
+	       T18 = T16 + T17;
+	       T19 = T15 + T18;
+	       T1a = KP899222659 * Tj + KP1_786448602 * TJ;
+	       T1b = KP627363480 * Td + KP1_899056361 * TP;
+	       T1c = T1a + T1b;
+	       T1d = KP1_306345685 * Tt + KP1_514417693 * Tz;
+	       T1e = KP147129127 * T3 + KP1_994580913 * TZ;
+	       T1f = T1d + T1e;
+	       T1g = T1c + T1f;
+	       T1h = T19 + T1g;
+	       T1i = KP1_069995239 * Tn + KP1_689707130 * TF;
+	       T1j = KP438202480 * T9 + KP1_951404260 * TT;
+	       T1k = T1i + T1j;
+	       T1l = KP1_151616382 * Tp + KP1_635169626 * TD;
+	       T1m = KP341923777 * T7 + KP1_970555284 * TV;
+	       T1n = T1l + T1m;
+	       T1o = T1k + T1n;
+	       T1p = KP810482628 * Th + KP1_828419511 * TL;
+	       T1q = KP719790073 * Tf + KP1_865985597 * TN;
+	       T1r = T1p + T1q;
+	       T1s = KP1_379081089 * Tv + KP1_448494165 * Tx;
+	       T1t = KP049082457 * T1 + KP1_999397637 * T11;
+	       T1u = T1s + T1t;
+	       T1v = T1r + T1u;
+	       T1w = T1o + T1v;
+	       T1x = T1h + T1w;
+	       T1y = KP1_028205488 * Tm + KP1_715457220 * TG;
+	       T1z = KP485960359 * Ta + KP1_940062506 * TS;
+	       T1A = T1y + T1z;
+	       T1B = KP1_191398608 * Tq + KP1_606415062 * TC;
+	       T1C = KP293460948 * T6 + KP1_978353019 * TW;
+	       T1D = T1B + T1C;
+	       T1E = T1A + T1D;
+	       T1F = KP855110186 * Ti + KP1_807978586 * TK;
+	       T1G = KP673779706 * Te + KP1_883088130 * TO;
+	       T1H = T1F + T1G;
+	       T1I = KP1_343117909 * Tu + KP1_481902250 * Ty;
+	       T1J = KP098135348 * T2 + KP1_997590912 * T10;
+	       T1K = T1I + T1J;
+	       T1L = T1H + T1K;
+	       T1M = T1E + T1L;
+	       T1N = KP942793473 * Tk + KP1_763842528 * TI;
+	       T1O = KP580569354 * Tc + KP1_913880671 * TQ;
+	       T1P = T1N + T1O;
+	       T1Q = KP1_268786568 * Ts + KP1_546020906 * TA;
+	       T1R = KP196034280 * T4 + KP1_990369453 * TY;
+	       T1S = T1Q + T1R;
+	       T1T = T1P + T1S;
+	       T1U = KP1_111140466 * To + KP1_662939224 * TE;
+	       T1V = KP390180644 * T8 + KP1_961570560 * TU;
+	       T1W = T1U + T1V;
+	       T1X = KP765366864 * Tg + KP1_847759065 * TM;
+	       T1Y = KP1_414213562 * Tw;
+	       T1Z = T12 + T1Y;
+	       T20 = T1X + T1Z;
+	       T21 = T1W + T20;
+	       T22 = T1T + T21;
+	       T23 = T1M + T22;
+	       O[0] = T1x + T23;
+	       T24 = T13 - T14;
+	       T25 = KP1_576692855 * Tr - KP1_230463181 * TB;
+	       T26 = KP1_984959069 * T5 - KP244821350 * TX;
+	       T27 = T25 + T26;
+	       T28 = T24 + T27;
+	       T29 = KP1_740173982 * Tl - KP985796384 * TH;
+	       T2a = KP1_927552131 * Tb - KP533425514 * TR;
+	       T2b = T29 + T2a;
+	       T2c = T16 - T17;
+	       T2d = T2b + T2c;
+	       T2e = KP098017140 * T28 + KP995184726 * T2d;
+	       T2f = T1a - T1b;
+	       T2g = KP1_514417693 * Tt - KP1_306345685 * Tz;
+	       T2h = KP1_994580913 * T3 - KP147129127 * TZ;
+	       T2i = T2g + T2h;
+	       T2j = T2f + T2i;
+	       T2k = KP1_786448602 * Tj - KP899222659 * TJ;
+	       T2l = KP1_899056361 * Td - KP627363480 * TP;
+	       T2m = T2k + T2l;
+	       T2n = T1d - T1e;
+	       T2o = T2m + T2n;
+	       T2p = KP634393284 * T2j + KP773010453 * T2o;
+	       T2q = T2e + T2p;
+	       T2r = T1i - T1j;
+	       T2s = KP1_635169626 * Tp - KP1_151616382 * TD;
+	       T2t = KP1_970555284 * T7 - KP341923777 * TV;
+	       T2u = T2s + T2t;
+	       T2v = T2r + T2u;
+	       T2w = KP1_689707130 * Tn - KP1_069995239 * TF;
+	       T2x = KP1_951404260 * T9 - KP438202480 * TT;
+	       T2y = T2w + T2x;
+	       T2z = T1l - T1m;
+	       T2A = T2y + T2z;
+	       T2B = KP881921264 * T2v + KP471396736 * T2A;
+	       T2C = T1p - T1q;
+	       T2D = KP1_448494165 * Tv - KP1_379081089 * Tx;
+	       T2E = KP1_999397637 * T1 - KP049082457 * T11;
+	       T2F = T2D + T2E;
+	       T2G = T2C + T2F;
+	       T2H = KP1_828419511 * Th - KP810482628 * TL;
+	       T2I = KP1_865985597 * Tf - KP719790073 * TN;
+	       T2J = T2H + T2I;
+	       T2K = T1s - T1t;
+	       T2L = T2J + T2K;
+	       T2M = KP290284677 * T2G - KP956940335 * T2L;
+	       T2N = T2B - T2M;
+	       T2O = T2q + T2N;
+	       T2P = KP995184726 * T28 - KP098017140 * T2d;
+	       T2Q = KP773010453 * T2j - KP634393284 * T2o;
+	       T2R = T2P - T2Q;
+	       T2S = KP956940335 * T2G + KP290284677 * T2L;
+	       T2T = KP471396736 * T2v - KP881921264 * T2A;
+	       T2U = T2S - T2T;
+	       T2V = T2R + T2U;
+	       T2W = KP923879532 * T2O + KP382683432 * T2V;
+	       T2X = T1y - T1z;
+	       T2Y = KP1_606415062 * Tq - KP1_191398608 * TC;
+	       T2Z = KP1_978353019 * T6 - KP293460948 * TW;
+	       T30 = T2Y + T2Z;
+	       T31 = T2X + T30;
+	       T32 = KP1_715457220 * Tm - KP1_028205488 * TG;
+	       T33 = KP1_940062506 * Ta - KP485960359 * TS;
+	       T34 = T32 + T33;
+	       T35 = T1B - T1C;
+	       T36 = T34 + T35;
+	       T37 = KP195090322 * T31 - KP980785280 * T36;
+	       T38 = T1F - T1G;
+	       T39 = KP1_481902250 * Tu - KP1_343117909 * Ty;
+	       T3a = KP1_997590912 * T2 - KP098135348 * T10;
+	       T3b = T39 + T3a;
+	       T3c = T38 + T3b;
+	       T3d = KP1_807978586 * Ti - KP855110186 * TK;
+	       T3e = KP1_883088130 * Te - KP673779706 * TO;
+	       T3f = T3d + T3e;
+	       T3g = T1I - T1J;
+	       T3h = T3f + T3g;
+	       T3i = KP831469612 * T3c + KP555570233 * T3h;
+	       T3j = T37 - T3i;
+	       T3k = KP555570233 * T3c - KP831469612 * T3h;
+	       T3l = KP980785280 * T31 + KP195090322 * T36;
+	       T3m = T3k - T3l;
+	       T3n = KP707106781 * (T3j + T3m);
+	       T3o = T1N - T1O;
+	       T3p = KP1_546020906 * Ts - KP1_268786568 * TA;
+	       T3q = KP1_990369453 * T4 - KP196034280 * TY;
+	       T3r = T3p + T3q;
+	       T3s = T3o + T3r;
+	       T3t = KP1_763842528 * Tk - KP942793473 * TI;
+	       T3u = KP1_913880671 * Tc - KP580569354 * TQ;
+	       T3v = T3t + T3u;
+	       T3w = T1Q - T1R;
+	       T3x = T3v + T3w;
+	       T3y = KP382683432 * T3s + KP923879532 * T3x;
+	       T3z = KP1_662939224 * To - KP1_111140466 * TE;
+	       T3A = KP1_961570560 * T8 - KP390180644 * TU;
+	       T3B = T3z + T3A;
+	       T3C = T1U - T1V;
+	       T3D = KP707106781 * (T3B + T3C);
+	       T3E = KP1_847759065 * Tg - KP765366864 * TM;
+	       T3F = T12 - T1Y;
+	       T3G = T3E - T3F;
+	       T3H = T3D + T3G;
+	       T3I = T3y + T3H;
+	       T3J = T3n - T3I;
+	       O[WS(os, 1)] = T2W - T3J;
+	       T3K = T2J - T2K;
+	       T3L = T2F - T2C;
+	       T3M = KP995184726 * T3K + KP098017140 * T3L;
+	       T3N = T2r - T2u;
+	       T3O = T2y - T2z;
+	       T3P = KP634393284 * T3N - KP773010453 * T3O;
+	       T3Q = T3M - T3P;
+	       T3R = T24 - T27;
+	       T3S = T2b - T2c;
+	       T3T = KP471396736 * T3R - KP881921264 * T3S;
+	       T3U = T2f - T2i;
+	       T3V = T2m - T2n;
+	       T3W = KP290284677 * T3U - KP956940335 * T3V;
+	       T3X = T3T + T3W;
+	       T3Y = T3Q - T3X;
+	       T3Z = T2X - T30;
+	       T40 = T34 - T35;
+	       T41 = KP555570233 * T3Z - KP831469612 * T40;
+	       T42 = T38 - T3b;
+	       T43 = T3f - T3g;
+	       T44 = KP195090322 * T42 - KP980785280 * T43;
+	       T45 = T41 + T44;
+	       T46 = T3o - T3r;
+	       T47 = T3v - T3w;
+	       T48 = KP382683432 * T46 - KP923879532 * T47;
+	       T49 = KP707106781 * (T3B - T3C);
+	       T4a = T3E + T3F;
+	       T4b = T49 + T4a;
+	       T4c = T48 - T4b;
+	       T4d = T45 + T4c;
+	       O[WS(os, 2)] = T3Y - T4d;
+	       T4e = T1A - T1D;
+	       T4f = T3d - T3e;
+	       T4g = T39 - T3a;
+	       T4h = T4f + T4g;
+	       T4i = T4e - T4h;
+	       T4j = T32 - T33;
+	       T4k = T2Y - T2Z;
+	       T4l = T4j + T4k;
+	       T4m = T1H - T1K;
+	       T4n = T4l - T4m;
+	       T4o = KP382683432 * T4i - KP923879532 * T4n;
+	       T4p = T3t - T3u;
+	       T4q = T3p - T3q;
+	       T4r = T4p + T4q;
+	       T4s = T1P - T1S;
+	       T4t = KP707106781 * (T4r - T4s);
+	       T4u = T3z - T3A;
+	       T4v = T1X - T1Z;
+	       T4w = T4u - T4v;
+	       T4x = T4t + T4w;
+	       T4y = T4o - T4x;
+	       T4z = T2E - T2D;
+	       T4A = T2H - T2I;
+	       T4B = T4z - T4A;
+	       T4C = T1n - T1k;
+	       T4D = T4B - T4C;
+	       T4E = T2w - T2x;
+	       T4F = T2s - T2t;
+	       T4G = T4E + T4F;
+	       T4H = T1u - T1r;
+	       T4I = T4G + T4H;
+	       T4J = KP831469612 * T4D - KP555570233 * T4I;
+	       T4K = T15 - T18;
+	       T4L = T2k - T2l;
+	       T4M = T2g - T2h;
+	       T4N = T4L + T4M;
+	       T4O = T4K - T4N;
+	       T4P = T29 - T2a;
+	       T4Q = T25 - T26;
+	       T4R = T4P + T4Q;
+	       T4S = T1c - T1f;
+	       T4T = T4R - T4S;
+	       T4U = KP195090322 * T4O + KP980785280 * T4T;
+	       T4V = T4J - T4U;
+	       T4W = KP980785280 * T4O - KP195090322 * T4T;
+	       T4X = KP555570233 * T4D + KP831469612 * T4I;
+	       T4Y = T4W - T4X;
+	       T4Z = KP707106781 * (T4V + T4Y);
+	       O[WS(os, 3)] = T4y + T4Z;
+	       T50 = T4C + T4B;
+	       T51 = T4H - T4G;
+	       T52 = KP195090322 * T50 + KP980785280 * T51;
+	       T53 = T4K + T4N;
+	       T54 = T4R + T4S;
+	       T55 = KP555570233 * T53 + KP831469612 * T54;
+	       T56 = T52 - T55;
+	       T57 = T4e + T4h;
+	       T58 = T4l + T4m;
+	       T59 = KP382683432 * T57 + KP923879532 * T58;
+	       T5a = KP707106781 * (T4r + T4s);
+	       T5b = T4u + T4v;
+	       T5c = T5a + T5b;
+	       T5d = T59 + T5c;
+	       O[WS(os, 4)] = T56 - T5d;
+	       T5e = T3W - T3T;
+	       T5f = KP995184726 * T3L - KP098017140 * T3K;
+	       T5g = KP773010453 * T3N + KP634393284 * T3O;
+	       T5h = T5f - T5g;
+	       T5i = T5e + T5h;
+	       T5j = KP881921264 * T3R + KP471396736 * T3S;
+	       T5k = KP956940335 * T3U + KP290284677 * T3V;
+	       T5l = T5j + T5k;
+	       T5m = T3P + T3M;
+	       T5n = T5l + T5m;
+	       T5o = KP382683432 * T5i - KP923879532 * T5n;
+	       T5p = T49 - T4a;
+	       T5q = KP923879532 * T46 + KP382683432 * T47;
+	       T5r = T5p - T5q;
+	       T5s = KP831469612 * T3Z + KP555570233 * T40;
+	       T5t = KP980785280 * T42 + KP195090322 * T43;
+	       T5u = T5s + T5t;
+	       T5v = T41 - T44;
+	       T5w = KP707106781 * (T5u + T5v);
+	       T5x = T5r - T5w;
+	       O[WS(os, 5)] = T5o + T5x;
+	       T5y = T2P + T2Q;
+	       T5z = T2B + T2M;
+	       T5A = T5y + T5z;
+	       T5B = T3l + T3k;
+	       T5C = KP923879532 * T3s - KP382683432 * T3x;
+	       T5D = T3D - T3G;
+	       T5E = T5C + T5D;
+	       T5F = T5B + T5E;
+	       O[WS(os, 6)] = T5A + T5F;
+	       T5G = T4j - T4k;
+	       T5H = T4f - T4g;
+	       T5I = T5G + T5H;
+	       T5J = T1E - T1L;
+	       T5K = KP707106781 * (T5I + T5J);
+	       T5L = T4p - T4q;
+	       T5M = T1W - T20;
+	       T5N = T5L + T5M;
+	       T5O = T5K + T5N;
+	       T5P = T4P - T4Q;
+	       T5Q = T4L - T4M;
+	       T5R = T5P + T5Q;
+	       T5S = T1o - T1v;
+	       T5T = T5R + T5S;
+	       T5U = T19 - T1g;
+	       T5V = T4E - T4F;
+	       T5W = T4A + T4z;
+	       T5X = T5V + T5W;
+	       T5Y = T5U + T5X;
+	       T5Z = KP923879532 * T5T + KP382683432 * T5Y;
+	       O[WS(os, 7)] = T5O + T5Z;
+	       T60 = KP707106781 * (T5I - T5J);
+	       T61 = T5L - T5M;
+	       T62 = T60 + T61;
+	       T63 = T5R - T5S;
+	       T64 = T5X - T5U;
+	       T65 = KP923879532 * T63 + KP382683432 * T64;
+	       O[WS(os, 8)] = T62 + T65;
+	       T66 = T37 + T3i;
+	       T67 = T5C - T5D;
+	       T68 = T66 + T67;
+	       T69 = T5y - T5z;
+	       T6a = T2T + T2S;
+	       T6b = T2e - T2p;
+	       T6c = T6a - T6b;
+	       T6d = KP707106781 * (T69 + T6c);
+	       O[WS(os, 9)] = T68 + T6d;
+	       T6e = T5h - T5e;
+	       T6f = T5l - T5m;
+	       T6g = KP382683432 * T6e - KP923879532 * T6f;
+	       T6h = KP707106781 * (T5u - T5v);
+	       T6i = T5q + T5p;
+	       T6j = T6h + T6i;
+	       O[WS(os, 10)] = T6g - T6j;
+	       T6k = KP555570233 * T54 - KP831469612 * T53;
+	       T6l = KP980785280 * T50 - KP195090322 * T51;
+	       T6m = T6k + T6l;
+	       T6n = T55 + T52;
+	       T6o = KP707106781 * (T6m - T6n);
+	       T6p = T5b - T5a;
+	       T6q = KP923879532 * T57 - KP382683432 * T58;
+	       T6r = T6p - T6q;
+	       O[WS(os, 11)] = T6o + T6r;
+	       T6s = KP923879532 * T4i + KP382683432 * T4n;
+	       T6t = T4t - T4w;
+	       T6u = T6s - T6t;
+	       T6v = T4W + T4X;
+	       O[WS(os, 12)] = T6u + T6v;
+	       T6w = T5s - T5t;
+	       T6x = T48 + T4b;
+	       T6y = T6w - T6x;
+	       T6z = T5j - T5k;
+	       T6A = T5g + T5f;
+	       T6B = T6z + T6A;
+	       T6C = T3X + T3Q;
+	       T6D = KP707106781 * (T6B - T6C);
+	       O[WS(os, 13)] = T6y + T6D;
+	       T6E = T2q - T2N;
+	       T6F = T2U - T2R;
+	       T6G = KP923879532 * T6E + KP382683432 * T6F;
+	       T6H = T3y - T3H;
+	       T6I = KP707106781 * (T3m - T3j);
+	       T6J = T6H + T6I;
+	       O[WS(os, 14)] = T6G + T6J;
+	       T6K = T1h - T1w;
+	       T6L = T5W - T5V;
+	       T6M = T5P - T5Q;
+	       T6N = T6L - T6M;
+	       T6O = KP707106781 * (T6K + T6N);
+	       T6P = T5G - T5H;
+	       T6Q = T1T - T21;
+	       T6R = T6P - T6Q;
+	       O[WS(os, 15)] = T6O - T6R;
+	       T6S = KP707106781 * (T6N - T6K);
+	       T6T = T6P + T6Q;
+	       O[WS(os, 16)] = T6S - T6T;
+	       T6U = KP923879532 * T6F - KP382683432 * T6E;
+	       T6V = T6H - T6I;
+	       O[WS(os, 17)] = T6U - T6V;
+	       T6W = T6w + T6x;
+	       T6X = KP707106781 * (T6B + T6C);
+	       O[WS(os, 18)] = T6W + T6X;
+	       T6Y = T6s + T6t;
+	       T6Z = T4U + T4J;
+	       O[WS(os, 19)] = T6Y + T6Z;
+	       T70 = KP707106781 * (T6m + T6n);
+	       T71 = T6q + T6p;
+	       O[WS(os, 20)] = T70 - T71;
+	       T72 = KP923879532 * T6e + KP382683432 * T6f;
+	       T73 = T6h - T6i;
+	       O[WS(os, 21)] = T72 - T73;
+	       T74 = KP707106781 * (T6c - T69);
+	       T75 = T67 - T66;
+	       O[WS(os, 22)] = T74 - T75;
+	       T76 = T60 - T61;
+	       T77 = KP923879532 * T64 - KP382683432 * T63;
+	       O[WS(os, 23)] = T76 + T77;
+	       T78 = T5K - T5N;
+	       T79 = KP923879532 * T5Y - KP382683432 * T5T;
+	       O[WS(os, 24)] = T78 + T79;
+	       T7a = T6b + T6a;
+	       T7b = T5B - T5E;
+	       O[WS(os, 25)] = T7a + T7b;
+	       T7c = KP923879532 * T5i + KP382683432 * T5n;
+	       T7d = T5w + T5r;
+	       O[WS(os, 26)] = T7c - T7d;
+	       T7e = T6l - T6k;
+	       T7f = T59 - T5c;
+	       O[WS(os, 27)] = T7e - T7f;
+	       T7g = T4o + T4x;
+	       T7h = KP707106781 * (T4V - T4Y);
+	       O[WS(os, 28)] = T7g + T7h;
+	       T7i = T6A - T6z;
+	       T7j = T45 - T4c;
+	       O[WS(os, 29)] = T7i - T7j;
+	       T7k = KP923879532 * T2V - KP382683432 * T2O;
+	       T7l = T3I + T3n;
+	       O[WS(os, 30)] = T7k - T7l;
+	       T7m = T1M - T22;
+	       T7n = T6M + T6L;
+	       O[WS(os, 31)] = T7m + T7n;
+	       O[WS(os, 32)] = T7n - T7m;
+	       O[WS(os, 33)] = T7k + T7l;
+	       O[WS(os, 34)] = T7j + T7i;
+	       O[WS(os, 35)] = T7h - T7g;
+	       O[WS(os, 36)] = T7f + T7e;
+	       O[WS(os, 37)] = T7c + T7d;
+	       O[WS(os, 38)] = T7a - T7b;
+	       O[WS(os, 39)] = T79 - T78;
+	       O[WS(os, 40)] = T77 - T76;
+	       O[WS(os, 41)] = T74 + T75;
+	       O[WS(os, 42)] = T73 + T72;
+	       O[WS(os, 43)] = T70 + T71;
+	       O[WS(os, 44)] = T6Z - T6Y;
+	       O[WS(os, 45)] = T6X - T6W;
+	       O[WS(os, 46)] = T6U + T6V;
+	       O[WS(os, 47)] = T6T + T6S;
+	       O[WS(os, 48)] = T6R + T6O;
+	       O[WS(os, 49)] = T6G - T6J;
+	       O[WS(os, 50)] = T6D - T6y;
+	       O[WS(os, 51)] = T6v - T6u;
+	       O[WS(os, 52)] = T6o - T6r;
+	       O[WS(os, 53)] = T6j + T6g;
+	       O[WS(os, 54)] = T6d - T68;
+	       O[WS(os, 55)] = T65 - T62;
+	       O[WS(os, 56)] = T5Z - T5O;
+	       O[WS(os, 57)] = T5A - T5F;
+	       O[WS(os, 58)] = T5o - T5x;
+	       O[WS(os, 59)] = T5d + T56;
+	       O[WS(os, 60)] = T4Z - T4y;
+	       O[WS(os, 61)] = T4d + T3Y;
+	       O[WS(os, 62)] = T2W + T3J;
+	       O[WS(os, 63)] = T1x - T23;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 64, "o01_64", {456, 249, 0, 0}, &GENUS, RODFT01 };
+
+void X(codelet_o01_64) (planner *p) {
+     X(kr2r_register) (p, o01_64, &desc);
+}
+
+#endif
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft01 -n 8 -name o01_8 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 28 FP additions, 18 FP multiplications,
+ * (or, 16 additions, 6 multiplications, 12 fused multiply/add),
+ * 24 stack variables, 8 constants, and 16 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o01_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(16, is), MAKE_VOLATILE_STRIDE(16, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = FMA(KP1_111140466, T3, KP1_662939224 * T5);
+	       Ta = FMA(KP390180644, T1, KP1_961570560 * T7);
+	       Tb = T9 + Ta;
+	       Tc = FMA(KP765366864, T2, KP1_847759065 * T6);
+	       Td = FMA(KP1_414213562, T4, T8);
+	       Te = Tc + Td;
+	       O[0] = Tb + Te;
+	       Tf = FMS(KP1_847759065, T2, KP765366864 * T6);
+	       Tg = FNMS(KP1_414213562, T4, T8);
+	       Th = Tf - Tg;
+	       Ti = FMS(KP1_662939224, T3, KP1_111140466 * T5);
+	       Tj = FMS(KP1_961570560, T1, KP390180644 * T7);
+	       Tk = Ti + Tj;
+	       Tl = T9 - Ta;
+	       O[WS(os, 1)] = FMA(KP707106781, Tk + Tl, Th);
+	       Tm = Tf + Tg;
+	       O[WS(os, 2)] = FMA(KP707106781, Tk - Tl, Tm);
+	       Tn = Tc - Td;
+	       To = Tj - Ti;
+	       O[WS(os, 3)] = Tn + To;
+	       O[WS(os, 4)] = To - Tn;
+	       O[WS(os, 5)] = FMS(KP707106781, Tk - Tl, Tm);
+	       O[WS(os, 6)] = FMS(KP707106781, Tk + Tl, Th);
+	       O[WS(os, 7)] = Tb - Te;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 8, "o01_8", {16, 6, 12, 0}, &GENUS, RODFT01 };
+
+void X(codelet_o01_8) (planner *p) {
+     X(kr2r_register) (p, o01_8, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft01 -n 8 -name o01_8 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 26 FP additions, 15 FP multiplications,
+ * (or, 26 additions, 15 multiplications, 0 fused multiply/add),
+ * 27 stack variables, 8 constants, and 16 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o01_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(16, is), MAKE_VOLATILE_STRIDE(16, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = KP1_111140466 * T3 + KP1_662939224 * T5;
+	       Ta = KP390180644 * T1 + KP1_961570560 * T7;
+	       Tb = T9 + Ta;
+	       Tc = KP765366864 * T2 + KP1_847759065 * T6;
+	       Td = KP1_414213562 * T4;
+	       Te = T8 + Td;
+	       Tf = Tc + Te;
+	       O[0] = Tb + Tf;
+	       Tg = KP1_662939224 * T3 - KP1_111140466 * T5;
+	       Th = KP1_961570560 * T1 - KP390180644 * T7;
+	       Ti = Tg + Th;
+	       Tj = T9 - Ta;
+	       Tk = KP707106781 * (Ti + Tj);
+	       Tl = KP1_847759065 * T2 - KP765366864 * T6;
+	       Tm = T8 - Td;
+	       Tn = Tl - Tm;
+	       O[WS(os, 1)] = Tk + Tn;
+	       To = KP707106781 * (Ti - Tj);
+	       Tp = Tl + Tm;
+	       O[WS(os, 2)] = To + Tp;
+	       Tq = Tc - Te;
+	       Tr = Th - Tg;
+	       O[WS(os, 3)] = Tq + Tr;
+	       O[WS(os, 4)] = Tr - Tq;
+	       O[WS(os, 5)] = To - Tp;
+	       O[WS(os, 6)] = Tk - Tn;
+	       O[WS(os, 7)] = Tb - Tf;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 8, "o01_8", {26, 15, 0, 0}, &GENUS, RODFT01 };
+
+void X(codelet_o01_8) (planner *p) {
+     X(kr2r_register) (p, o01_8, &desc);
+}
+
+#endif
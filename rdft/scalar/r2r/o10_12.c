@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft10 -n 12 -name o10_12 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 54 FP additions, 36 FP multiplications,
+ * (or, 32 additions, 14 multiplications, 22 fused multiply/add),
+ * 50 stack variables, 15 constants, and 24 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o10_12(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP261052384, +0.261052384440103183096812455790978020387481410);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP750000000, +0.750000000000000000000000000000000000000000000);
+     DK(KP433012701, +0.433012701892219323381861585376468091735701313);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP1_982889722, +1.982889722747620822289115053857125742555476549);
+     DK(KP1_931851652, +1.931851652578136573499486399457794735267809678);
+     DK(KP517638090, +0.517638090205041524697797675248096656698137803);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DK(KP1_586706680, +1.586706680582470329159553923002598553257351842);
+     DK(KP1_217522858, +1.217522858017441278832195085796328009032787424);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(24, is), MAKE_VOLATILE_STRIDE(24, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = T8 - T9;
+	       Te = FMA(KP500000000, Td, T1);
+	       Tf = T4 - Tc;
+	       Tg = T4 + Tc;
+	       Th = FMA(KP500000000, Tg, T5);
+	       Ti = FMS(KP500000000, Th, KP750000000 * Tf);
+	       Tj = Te + Ti;
+	       Tk = T6 + Tb;
+	       Tl = T6 - Tb;
+	       Tm = FMA(KP500000000, Tl, T3);
+	       Tn = FMS(KP866025403, Tm, KP433012701 * Tk);
+	       To = FMS(KP866025403, T2 - Ta, Tn);
+	       Tp = Tj - To;
+	       Tq = FMA(KP433012701, Tf, KP866025403 * Th);
+	       Tr = FMA(KP866025403, T8 + T9, Tq);
+	       Ts = T2 + Ta;
+	       Tt = FMA(KP500000000, Ts, T7);
+	       Tu = FMA(KP750000000, Tk, KP500000000 * Tm);
+	       Tv = Tt + Tu;
+	       Tw = Tr + Tv;
+	       O[0] = FMA(KP1_982889722, Tw, KP261052384 * Tp);
+	       Tx = FMS(KP866025403, T8 + T9, Tq);
+	       Ty = FMA(KP866025403, T2 - Ta, Tn);
+	       Tz = Tx - Ty;
+	       TA = Te - Ti;
+	       TB = Tt - Tu;
+	       TC = TA - TB;
+	       O[WS(os, 1)] = FMS(KP517638090, TC, KP1_931851652 * Tz);
+	       TD = T1 - Td;
+	       TE = T5 - Tg;
+	       TF = TD - TE;
+	       TG = T3 - Tl;
+	       TH = T7 - Ts;
+	       TI = TG - TH;
+	       O[WS(os, 2)] = FMA(KP1_847759065, TI, KP765366864 * TF);
+	       TJ = TA + TB;
+	       TK = Tx + Ty;
+	       O[WS(os, 3)] = FMA(KP1_732050807, TK, TJ);
+	       TL = Tr - Tv;
+	       TM = Tj + To;
+	       O[WS(os, 4)] = FMS(KP1_217522858, TM, KP1_586706680 * TL);
+	       TN = TD + TE;
+	       TO = TG + TH;
+	       O[WS(os, 5)] = KP1_414213562 * (TN - TO);
+	       O[WS(os, 6)] = FMA(KP1_586706680, TM, KP1_217522858 * TL);
+	       O[WS(os, 7)] = FMS(KP1_732050807, TJ, TK);
+	       O[WS(os, 8)] = FMS(KP1_847759065, TF, KP765366864 * TI);
+	       O[WS(os, 9)] = FMA(KP1_931851652, TC, KP517638090 * Tz);
+	       O[WS(os, 10)] = FMS(KP1_982889722, Tp, KP261052384 * Tw);
+	       O[WS(os, 11)] = KP2_000000000 * (TN + TO);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 12, "o10_12", {32, 14, 22, 0}, &GENUS, RODFT10 };
+
+void X(codelet_o10_12) (planner *p) {
+     X(kr2r_register) (p, o10_12, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft10 -n 12 -name o10_12 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 52 FP additions, 34 FP multiplications,
+ * (or, 52 additions, 34 multiplications, 0 fused multiply/add),
+ * 52 stack variables, 15 constants, and 24 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o10_12(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_982889722, +1.982889722747620822289115053857125742555476549);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP433012701, +0.433012701892219323381861585376468091735701313);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP750000000, +0.750000000000000000000000000000000000000000000);
+     DK(KP261052384, +0.261052384440103183096812455790978020387481410);
+     DK(KP517638090, +0.517638090205041524697797675248096656698137803);
+     DK(KP1_931851652, +1.931851652578136573499486399457794735267809678);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DK(KP1_217522858, +1.217522858017441278832195085796328009032787424);
+     DK(KP1_586706680, +1.586706680582470329159553923002598553257351842);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(24, is), MAKE_VOLATILE_STRIDE(24, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = KP866025403 * (T8 + T9);
+	       Te = T4 - Tc;
+	       Tf = T4 + Tc;
+	       Tg = T5 + KP500000000 * Tf;
+	       Th = KP433012701 * Te + KP866025403 * Tg;
+	       Ti = Td + Th;
+	       Tj = T2 + Ta;
+	       Tk = T7 + KP500000000 * Tj;
+	       Tl = T6 + Tb;
+	       Tm = T6 - Tb;
+	       Tn = T3 + KP500000000 * Tm;
+	       To = KP750000000 * Tl + KP500000000 * Tn;
+	       Tp = Tk + To;
+	       Tq = Ti + Tp;
+	       Tr = T8 - T9;
+	       Ts = T1 + KP500000000 * Tr;
+	       Tt = KP500000000 * Tg - KP750000000 * Te;
+	       Tu = Ts + Tt;
+	       Tv = KP866025403 * (T2 - Ta);
+	       Tw = KP866025403 * Tn - KP433012701 * Tl;
+	       Tx = Tv - Tw;
+	       Ty = Tu - Tx;
+	       O[0] = KP1_982889722 * Tq + KP261052384 * Ty;
+	       Tz = Ts - Tt;
+	       TA = Tk - To;
+	       TB = Tz - TA;
+	       TC = Td - Th;
+	       TD = Tv + Tw;
+	       TE = TC - TD;
+	       O[WS(os, 1)] = KP517638090 * TB - KP1_931851652 * TE;
+	       TF = T3 - Tm;
+	       TG = T7 - Tj;
+	       TH = TF - TG;
+	       TI = T1 - Tr;
+	       TJ = T5 - Tf;
+	       TK = TI - TJ;
+	       O[WS(os, 2)] = KP1_847759065 * TH + KP765366864 * TK;
+	       TL = Tz + TA;
+	       TM = TC + TD;
+	       O[WS(os, 3)] = TL + KP1_732050807 * TM;
+	       TN = Tu + Tx;
+	       TO = Ti - Tp;
+	       O[WS(os, 4)] = KP1_217522858 * TN - KP1_586706680 * TO;
+	       TP = TI + TJ;
+	       TQ = TF + TG;
+	       O[WS(os, 5)] = KP1_414213562 * (TP - TQ);
+	       O[WS(os, 6)] = KP1_586706680 * TN + KP1_217522858 * TO;
+	       O[WS(os, 7)] = KP1_732050807 * TL - TM;
+	       O[WS(os, 8)] = KP1_847759065 * TK - KP765366864 * TH;
+	       O[WS(os, 9)] = KP1_931851652 * TB + KP517638090 * TE;
+	       O[WS(os, 10)] = KP1_982889722 * Ty - KP261052384 * Tq;
+	       O[WS(os, 11)] = KP2_000000000 * (TP + TQ);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 12, "o10_12", {52, 34, 0, 0}, &GENUS, RODFT10 };
+
+void X(codelet_o10_12) (planner *p) {
+     X(kr2r_register) (p, o10_12, &desc);
+}
+
+#endif
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft10 -n 16 -name o10_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 74 FP additions, 44 FP multiplications,
+ * (or, 52 additions, 22 multiplications, 22 fused multiply/add),
+ * 70 stack variables, 19 constants, and 32 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o10_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = T1 + Tg;
+	       Ti = KP707106781 * (T4 + Td);
+	       Tj = FMS(KP707106781, T5 + Tc, Ti);
+	       Tk = Th + Tj;
+	       Tl = T6 + Tb;
+	       Tm = T3 + Te;
+	       Tn = FMS(KP923879532, Tm, KP382683432 * Tl);
+	       To = T2 + Tf;
+	       Tp = T7 + Ta;
+	       Tq = FMS(KP382683432, Tp, KP923879532 * To);
+	       Tr = Tn + Tq;
+	       Ts = Tk + Tr;
+	       Tt = T8 + T9;
+	       Tu = FMA(KP707106781, T5 + Tc, Ti);
+	       Tv = Tt + Tu;
+	       Tw = FMA(KP923879532, Tl, KP382683432 * Tm);
+	       Tx = FMA(KP382683432, To, KP923879532 * Tp);
+	       Ty = Tw + Tx;
+	       Tz = Tv + Ty;
+	       O[0] = FMA(KP1_990369453, Tz, KP196034280 * Ts);
+	       TA = T1 - Tg;
+	       TB = T8 - T9;
+	       TC = TA + TB;
+	       TD = T7 - Ta;
+	       TE = T2 - Tf;
+	       TF = KP707106781 * (TD + TE);
+	       TG = T3 - Te;
+	       TH = T6 - Tb;
+	       TI = FMS(KP707106781, TG + TH, TF);
+	       TJ = TC + TI;
+	       TK = T5 - Tc;
+	       TL = T4 - Td;
+	       TM = TK + TL;
+	       TN = FMA(KP707106781, TG + TH, TF);
+	       TO = TM + TN;
+	       O[WS(os, 1)] = FMA(KP1_961570560, TO, KP390180644 * TJ);
+	       TP = Tt - Tu;
+	       TQ = Tn - Tq;
+	       TR = TP - TQ;
+	       TS = Th - Tj;
+	       TT = Tw - Tx;
+	       TU = TS + TT;
+	       O[WS(os, 2)] = FMS(KP580569354, TU, KP1_913880671 * TR);
+	       TV = TA - TB;
+	       TW = TK - TL;
+	       TX = TV - TW;
+	       TY = TG - TH;
+	       TZ = TD - TE;
+	       T10 = TY - TZ;
+	       O[WS(os, 3)] = FMA(KP1_847759065, T10, KP765366864 * TX);
+	       T11 = TS - TT;
+	       T12 = TP + TQ;
+	       O[WS(os, 4)] = FMA(KP1_763842528, T12, KP942793473 * T11);
+	       T13 = TM - TN;
+	       T14 = TC - TI;
+	       O[WS(os, 5)] = FMS(KP1_111140466, T14, KP1_662939224 * T13);
+	       T15 = Tv - Ty;
+	       T16 = Tk - Tr;
+	       O[WS(os, 6)] = FMS(KP1_268786568, T16, KP1_546020906 * T15);
+	       T17 = TV + TW;
+	       T18 = TY + TZ;
+	       O[WS(os, 7)] = KP1_414213562 * (T17 - T18);
+	       O[WS(os, 8)] = FMA(KP1_546020906, T16, KP1_268786568 * T15);
+	       O[WS(os, 9)] = FMA(KP1_662939224, T14, KP1_111140466 * T13);
+	       O[WS(os, 10)] = FMS(KP1_763842528, T11, KP942793473 * T12);
+	       O[WS(os, 11)] = FMS(KP1_847759065, TX, KP765366864 * T10);
+	       O[WS(os, 12)] = FMA(KP1_913880671, TU, KP580569354 * TR);
+	       O[WS(os, 13)] = FMS(KP1_961570560, TJ, KP390180644 * TO);
+	       O[WS(os, 14)] = FMS(KP1_990369453, Ts, KP196034280 * Tz);
+	       O[WS(os, 15)] = KP2_000000000 * (T17 + T18);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 16, "o10_16", {52, 22, 22, 0}, &GENUS, RODFT10 };
+
+void X(codelet_o10_16) (planner *p) {
+     X(kr2r_register) (p, o10_16, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft10 -n 16 -name o10_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 72 FP additions, 42 FP multiplications,
+ * (or, 72 additions, 42 multiplications, 0 fused multiply/add),
+ * 72 stack variables, 19 constants, and 32 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o10_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = T8 + T9;
+	       Ti = KP707106781 * (T5 + Tc);
+	       Tj = KP707106781 * (T4 + Td);
+	       Tk = Ti + Tj;
+	       Tl = Th + Tk;
+	       Tm = T6 + Tb;
+	       Tn = T3 + Te;
+	       To = KP923879532 * Tm + KP382683432 * Tn;
+	       Tp = T2 + Tf;
+	       Tq = T7 + Ta;
+	       Tr = KP382683432 * Tp + KP923879532 * Tq;
+	       Ts = To + Tr;
+	       Tt = Tl + Ts;
+	       Tu = T1 + Tg;
+	       Tv = Ti - Tj;
+	       Tw = Tu + Tv;
+	       Tx = KP923879532 * Tn - KP382683432 * Tm;
+	       Ty = KP382683432 * Tq - KP923879532 * Tp;
+	       Tz = Tx + Ty;
+	       TA = Tw + Tz;
+	       O[0] = KP1_990369453 * Tt + KP196034280 * TA;
+	       TB = T5 - Tc;
+	       TC = T4 - Td;
+	       TD = TB + TC;
+	       TE = T3 - Te;
+	       TF = T6 - Tb;
+	       TG = KP707106781 * (TE + TF);
+	       TH = T7 - Ta;
+	       TI = T2 - Tf;
+	       TJ = KP707106781 * (TH + TI);
+	       TK = TG + TJ;
+	       TL = TD + TK;
+	       TM = T1 - Tg;
+	       TN = T8 - T9;
+	       TO = TM + TN;
+	       TP = TG - TJ;
+	       TQ = TO + TP;
+	       O[WS(os, 1)] = KP1_961570560 * TL + KP390180644 * TQ;
+	       TR = Tu - Tv;
+	       TS = To - Tr;
+	       TT = TR + TS;
+	       TU = Th - Tk;
+	       TV = Tx - Ty;
+	       TW = TU - TV;
+	       O[WS(os, 2)] = KP580569354 * TT - KP1_913880671 * TW;
+	       TX = TE - TF;
+	       TY = TH - TI;
+	       TZ = TX - TY;
+	       T10 = TM - TN;
+	       T11 = TB - TC;
+	       T12 = T10 - T11;
+	       O[WS(os, 3)] = KP1_847759065 * TZ + KP765366864 * T12;
+	       T13 = TU + TV;
+	       T14 = TR - TS;
+	       O[WS(os, 4)] = KP1_763842528 * T13 + KP942793473 * T14;
+	       T15 = TO - TP;
+	       T16 = TD - TK;
+	       O[WS(os, 5)] = KP1_111140466 * T15 - KP1_662939224 * T16;
+	       T17 = Tw - Tz;
+	       T18 = Tl - Ts;
+	       O[WS(os, 6)] = KP1_268786568 * T17 - KP1_546020906 * T18;
+	       T19 = T10 + T11;
+	       T1a = TX + TY;
+	       O[WS(os, 7)] = KP1_414213562 * (T19 - T1a);
+	       O[WS(os, 8)] = KP1_546020906 * T17 + KP1_268786568 * T18;
+	       O[WS(os, 9)] = KP1_662939224 * T15 + KP1_111140466 * T16;
+	       O[WS(os, 10)] = KP1_763842528 * T14 - KP942793473 * T13;
+	       O[WS(os, 11)] = KP1_847759065 * T12 - KP765366864 * TZ;
+	       O[WS(os, 12)] = KP1_913880671 * TT + KP580569354 * TW;
+	       O[WS(os, 13)] = KP1_961570560 * TQ - KP390180644 * TL;
+	       O[WS(os, 14)] = KP1_990369453 * TA - KP196034280 * Tt;
+	       O[WS(os, 15)] = KP2_000000000 * (T19 + T1a);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 16, "o10_16", {72, 42, 0, 0}, &GENUS, RODFT10 };
+
+void X(codelet_o10_16) (planner *p) {
+     X(kr2r_register) (p, o10_16, &desc);
+}
+
+#endif
@@ -0,0 +1,622 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft10 -n 32 -name o10_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 191 FP additions, 109 FP multiplications,
+ * (or, 135 additions, 53 multiplications, 56 fused multiply/add),
+ * 181 stack variables, 39 constants, and 64 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o10_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = T1 + Tw;
+	       Ty = KP707106781 * (T8 + Tp);
+	       Tz = FMS(KP707106781, T9 + To, Ty);
+	       TA = Tx + Tz;
+	       TB = Tc + Tl;
+	       TC = T5 + Ts;
+	       TD = FMS(KP923879532, TC, KP382683432 * TB);
+	       TE = T4 + Tt;
+	       TF = Td + Tk;
+	       TG = FMS(KP382683432, TF, KP923879532 * TE);
+	       TH = TD + TG;
+	       TI = TA + TH;
+	       TJ = Te + Tj;
+	       TK = KP707106781 * (T6 + Tr);
+	       TL = FMA(KP707106781, Tb + Tm, TK);
+	       TM = TJ + TL;
+	       TN = T3 + Tu;
+	       TO = FMS(KP707106781, Tb + Tm, TK);
+	       TP = TN + TO;
+	       TQ = FMS(KP980785280, TP, KP195090322 * TM);
+	       TR = Ta + Tn;
+	       TS = KP707106781 * (T2 + Tv);
+	       TT = FMA(KP707106781, Tf + Ti, TS);
+	       TU = TR + TT;
+	       TV = T7 + Tq;
+	       TW = FMS(KP707106781, Tf + Ti, TS);
+	       TX = TV + TW;
+	       TY = FMS(KP831469612, TX, KP555570233 * TU);
+	       TZ = TQ + TY;
+	       T10 = TI + TZ;
+	       T11 = Tg + Th;
+	       T12 = FMA(KP707106781, T9 + To, Ty);
+	       T13 = T11 + T12;
+	       T14 = FMA(KP923879532, TB, KP382683432 * TC);
+	       T15 = FMA(KP382683432, TE, KP923879532 * TF);
+	       T16 = T14 + T15;
+	       T17 = T13 + T16;
+	       T18 = FMA(KP980785280, TM, KP195090322 * TP);
+	       T19 = FMA(KP831469612, TU, KP555570233 * TX);
+	       T1a = T18 + T19;
+	       T1b = T17 + T1a;
+	       O[0] = FMA(KP1_997590912, T1b, KP098135348 * T10);
+	       T1c = T1 - Tw;
+	       T1d = Tg - Th;
+	       T1e = T1c + T1d;
+	       T1f = Td - Tk;
+	       T1g = T4 - Tt;
+	       T1h = KP707106781 * (T1f + T1g);
+	       T1i = T5 - Ts;
+	       T1j = Tc - Tl;
+	       T1k = FMS(KP707106781, T1i + T1j, T1h);
+	       T1l = T1e + T1k;
+	       T1m = Tb - Tm;
+	       T1n = T6 - Tr;
+	       T1o = T1m + T1n;
+	       T1p = T3 - Tu;
+	       T1q = Te - Tj;
+	       T1r = T1p + T1q;
+	       T1s = FMS(KP923879532, T1r, KP382683432 * T1o);
+	       T1t = Tf - Ti;
+	       T1u = T2 - Tv;
+	       T1v = T1t + T1u;
+	       T1w = T7 - Tq;
+	       T1x = Ta - Tn;
+	       T1y = T1w + T1x;
+	       T1z = FMS(KP382683432, T1y, KP923879532 * T1v);
+	       T1A = T1s + T1z;
+	       T1B = T1l + T1A;
+	       T1C = T9 - To;
+	       T1D = T8 - Tp;
+	       T1E = T1C + T1D;
+	       T1F = FMA(KP707106781, T1i + T1j, T1h);
+	       T1G = T1E + T1F;
+	       T1H = FMA(KP923879532, T1o, KP382683432 * T1r);
+	       T1I = FMA(KP382683432, T1v, KP923879532 * T1y);
+	       T1J = T1H + T1I;
+	       T1K = T1G + T1J;
+	       O[WS(os, 1)] = FMA(KP1_990369453, T1K, KP196034280 * T1B);
+	       T1L = T11 - T12;
+	       T1M = TD - TG;
+	       T1N = T1L - T1M;
+	       T1O = TN - TO;
+	       T1P = TJ - TL;
+	       T1Q = FMS(KP831469612, T1P, KP555570233 * T1O);
+	       T1R = TV - TW;
+	       T1S = TR - TT;
+	       T1T = FMA(KP195090322, T1S, KP980785280 * T1R);
+	       T1U = T1Q - T1T;
+	       T1V = T1N + T1U;
+	       T1W = Tx - Tz;
+	       T1X = T14 - T15;
+	       T1Y = T1W + T1X;
+	       T1Z = FMA(KP831469612, T1O, KP555570233 * T1P);
+	       T20 = FMS(KP195090322, T1R, KP980785280 * T1S);
+	       T21 = T1Z - T20;
+	       T22 = T1Y + T21;
+	       O[WS(os, 2)] = FMS(KP293460948, T22, KP1_978353019 * T1V);
+	       T23 = T1c - T1d;
+	       T24 = T1C - T1D;
+	       T25 = T23 - T24;
+	       T26 = T1w - T1x;
+	       T27 = T1t - T1u;
+	       T28 = KP707106781 * (T26 - T27);
+	       T29 = T1p - T1q;
+	       T2a = T1m - T1n;
+	       T2b = FMS(KP707106781, T29 - T2a, T28);
+	       T2c = T25 + T2b;
+	       T2d = T1i - T1j;
+	       T2e = T1f - T1g;
+	       T2f = T2d - T2e;
+	       T2g = FMA(KP707106781, T29 - T2a, T28);
+	       T2h = T2f + T2g;
+	       O[WS(os, 3)] = FMA(KP1_961570560, T2h, KP390180644 * T2c);
+	       T2i = T1W - T1X;
+	       T2j = T1Q + T1T;
+	       T2k = T2i - T2j;
+	       T2l = T1L + T1M;
+	       T2m = T1Z + T20;
+	       T2n = T2l + T2m;
+	       O[WS(os, 4)] = FMA(KP1_940062506, T2n, KP485960359 * T2k);
+	       T2o = T1E - T1F;
+	       T2p = T1s - T1z;
+	       T2q = T2o - T2p;
+	       T2r = T1e - T1k;
+	       T2s = T1H - T1I;
+	       T2t = T2r + T2s;
+	       O[WS(os, 5)] = FMS(KP580569354, T2t, KP1_913880671 * T2q);
+	       T2u = T13 - T16;
+	       T2v = TQ - TY;
+	       T2w = T2u - T2v;
+	       T2x = TA - TH;
+	       T2y = T18 - T19;
+	       T2z = T2x + T2y;
+	       O[WS(os, 6)] = FMS(KP673779706, T2z, KP1_883088130 * T2w);
+	       T2A = T23 + T24;
+	       T2B = T2d + T2e;
+	       T2C = T2A - T2B;
+	       T2D = T29 + T2a;
+	       T2E = T26 + T27;
+	       T2F = T2D - T2E;
+	       O[WS(os, 7)] = FMA(KP1_847759065, T2F, KP765366864 * T2C);
+	       T2G = T2x - T2y;
+	       T2H = T2u + T2v;
+	       O[WS(os, 8)] = FMA(KP1_807978586, T2H, KP855110186 * T2G);
+	       T2I = T2r - T2s;
+	       T2J = T2o + T2p;
+	       O[WS(os, 9)] = FMA(KP1_763842528, T2J, KP942793473 * T2I);
+	       T2K = T2l - T2m;
+	       T2L = T2i + T2j;
+	       O[WS(os, 10)] = FMS(KP1_028205488, T2L, KP1_715457220 * T2K);
+	       T2M = T2f - T2g;
+	       T2N = T25 - T2b;
+	       O[WS(os, 11)] = FMS(KP1_111140466, T2N, KP1_662939224 * T2M);
+	       T2O = T1Y - T21;
+	       T2P = T1N - T1U;
+	       O[WS(os, 12)] = FMA(KP1_606415062, T2P, KP1_191398608 * T2O);
+	       T2Q = T1G - T1J;
+	       T2R = T1l - T1A;
+	       O[WS(os, 13)] = FMS(KP1_268786568, T2R, KP1_546020906 * T2Q);
+	       T2S = T17 - T1a;
+	       T2T = TI - TZ;
+	       O[WS(os, 14)] = FMS(KP1_343117909, T2T, KP1_481902250 * T2S);
+	       T2U = T2A + T2B;
+	       T2V = T2D + T2E;
+	       O[WS(os, 15)] = KP1_414213562 * (T2U - T2V);
+	       O[WS(os, 16)] = FMA(KP1_481902250, T2T, KP1_343117909 * T2S);
+	       O[WS(os, 17)] = FMA(KP1_546020906, T2R, KP1_268786568 * T2Q);
+	       O[WS(os, 18)] = FMS(KP1_606415062, T2O, KP1_191398608 * T2P);
+	       O[WS(os, 19)] = FMA(KP1_662939224, T2N, KP1_111140466 * T2M);
+	       O[WS(os, 20)] = FMA(KP1_715457220, T2L, KP1_028205488 * T2K);
+	       O[WS(os, 21)] = FMS(KP1_763842528, T2I, KP942793473 * T2J);
+	       O[WS(os, 22)] = FMS(KP1_807978586, T2G, KP855110186 * T2H);
+	       O[WS(os, 23)] = FMS(KP1_847759065, T2C, KP765366864 * T2F);
+	       O[WS(os, 24)] = FMA(KP1_883088130, T2z, KP673779706 * T2w);
+	       O[WS(os, 25)] = FMA(KP1_913880671, T2t, KP580569354 * T2q);
+	       O[WS(os, 26)] = FMS(KP1_940062506, T2k, KP485960359 * T2n);
+	       O[WS(os, 27)] = FMS(KP1_961570560, T2c, KP390180644 * T2h);
+	       O[WS(os, 28)] = FMA(KP1_978353019, T22, KP293460948 * T1V);
+	       O[WS(os, 29)] = FMS(KP1_990369453, T1B, KP196034280 * T1K);
+	       O[WS(os, 30)] = FMS(KP1_997590912, T10, KP098135348 * T1b);
+	       O[WS(os, 31)] = KP2_000000000 * (T2U + T2V);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 32, "o10_32", {135, 53, 56, 0}, &GENUS, RODFT10 };
+
+void X(codelet_o10_32) (planner *p) {
+     X(kr2r_register) (p, o10_32, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft10 -n 32 -name o10_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 186 FP additions, 104 FP multiplications,
+ * (or, 186 additions, 104 multiplications, 0 fused multiply/add),
+ * 186 stack variables, 39 constants, and 64 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o10_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V, T2W, T2X, T2Y, T2Z, T30;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = Tg + Th;
+	       Ty = KP707106781 * (T9 + To);
+	       Tz = KP707106781 * (T8 + Tp);
+	       TA = Ty + Tz;
+	       TB = Tx + TA;
+	       TC = Tc + Tl;
+	       TD = T5 + Ts;
+	       TE = KP923879532 * TC + KP382683432 * TD;
+	       TF = T4 + Tt;
+	       TG = Td + Tk;
+	       TH = KP382683432 * TF + KP923879532 * TG;
+	       TI = TE + TH;
+	       TJ = TB + TI;
+	       TK = Te + Tj;
+	       TL = KP707106781 * (Tb + Tm);
+	       TM = KP707106781 * (T6 + Tr);
+	       TN = TL + TM;
+	       TO = TK + TN;
+	       TP = T3 + Tu;
+	       TQ = TL - TM;
+	       TR = TP + TQ;
+	       TS = KP980785280 * TO + KP195090322 * TR;
+	       TT = Ta + Tn;
+	       TU = KP707106781 * (Tf + Ti);
+	       TV = KP707106781 * (T2 + Tv);
+	       TW = TU + TV;
+	       TX = TT + TW;
+	       TY = T7 + Tq;
+	       TZ = TU - TV;
+	       T10 = TY + TZ;
+	       T11 = KP831469612 * TX + KP555570233 * T10;
+	       T12 = TS + T11;
+	       T13 = TJ + T12;
+	       T14 = T1 + Tw;
+	       T15 = Ty - Tz;
+	       T16 = T14 + T15;
+	       T17 = KP923879532 * TD - KP382683432 * TC;
+	       T18 = KP382683432 * TG - KP923879532 * TF;
+	       T19 = T17 + T18;
+	       T1a = T16 + T19;
+	       T1b = KP980785280 * TR - KP195090322 * TO;
+	       T1c = KP831469612 * T10 - KP555570233 * TX;
+	       T1d = T1b + T1c;
+	       T1e = T1a + T1d;
+	       O[0] = KP1_997590912 * T13 + KP098135348 * T1e;
+	       T1f = T9 - To;
+	       T1g = T8 - Tp;
+	       T1h = T1f + T1g;
+	       T1i = T5 - Ts;
+	       T1j = Tc - Tl;
+	       T1k = KP707106781 * (T1i + T1j);
+	       T1l = Td - Tk;
+	       T1m = T4 - Tt;
+	       T1n = KP707106781 * (T1l + T1m);
+	       T1o = T1k + T1n;
+	       T1p = T1h + T1o;
+	       T1q = Tb - Tm;
+	       T1r = T6 - Tr;
+	       T1s = T1q + T1r;
+	       T1t = T3 - Tu;
+	       T1u = Te - Tj;
+	       T1v = T1t + T1u;
+	       T1w = KP923879532 * T1s + KP382683432 * T1v;
+	       T1x = Tf - Ti;
+	       T1y = T2 - Tv;
+	       T1z = T1x + T1y;
+	       T1A = T7 - Tq;
+	       T1B = Ta - Tn;
+	       T1C = T1A + T1B;
+	       T1D = KP382683432 * T1z + KP923879532 * T1C;
+	       T1E = T1w + T1D;
+	       T1F = T1p + T1E;
+	       T1G = T1 - Tw;
+	       T1H = Tg - Th;
+	       T1I = T1G + T1H;
+	       T1J = T1k - T1n;
+	       T1K = T1I + T1J;
+	       T1L = KP923879532 * T1v - KP382683432 * T1s;
+	       T1M = KP382683432 * T1C - KP923879532 * T1z;
+	       T1N = T1L + T1M;
+	       T1O = T1K + T1N;
+	       O[WS(os, 1)] = KP1_990369453 * T1F + KP196034280 * T1O;
+	       T1P = T14 - T15;
+	       T1Q = TE - TH;
+	       T1R = T1P + T1Q;
+	       T1S = TP - TQ;
+	       T1T = TK - TN;
+	       T1U = KP831469612 * T1S + KP555570233 * T1T;
+	       T1V = TY - TZ;
+	       T1W = TT - TW;
+	       T1X = KP195090322 * T1V - KP980785280 * T1W;
+	       T1Y = T1U - T1X;
+	       T1Z = T1R + T1Y;
+	       T20 = Tx - TA;
+	       T21 = T17 - T18;
+	       T22 = T20 - T21;
+	       T23 = KP831469612 * T1T - KP555570233 * T1S;
+	       T24 = KP195090322 * T1W + KP980785280 * T1V;
+	       T25 = T23 - T24;
+	       T26 = T22 + T25;
+	       O[WS(os, 2)] = KP293460948 * T1Z - KP1_978353019 * T26;
+	       T27 = T1i - T1j;
+	       T28 = T1l - T1m;
+	       T29 = T27 - T28;
+	       T2a = T1t - T1u;
+	       T2b = T1q - T1r;
+	       T2c = KP707106781 * (T2a - T2b);
+	       T2d = T1A - T1B;
+	       T2e = T1x - T1y;
+	       T2f = KP707106781 * (T2d - T2e);
+	       T2g = T2c + T2f;
+	       T2h = T29 + T2g;
+	       T2i = T1G - T1H;
+	       T2j = T1f - T1g;
+	       T2k = T2i - T2j;
+	       T2l = T2c - T2f;
+	       T2m = T2k + T2l;
+	       O[WS(os, 3)] = KP1_961570560 * T2h + KP390180644 * T2m;
+	       T2n = T20 + T21;
+	       T2o = T1U + T1X;
+	       T2p = T2n + T2o;
+	       T2q = T1P - T1Q;
+	       T2r = T23 + T24;
+	       T2s = T2q - T2r;
+	       O[WS(os, 4)] = KP1_940062506 * T2p + KP485960359 * T2s;
+	       T2t = T1I - T1J;
+	       T2u = T1w - T1D;
+	       T2v = T2t + T2u;
+	       T2w = T1h - T1o;
+	       T2x = T1L - T1M;
+	       T2y = T2w - T2x;
+	       O[WS(os, 5)] = KP580569354 * T2v - KP1_913880671 * T2y;
+	       T2z = T16 - T19;
+	       T2A = TS - T11;
+	       T2B = T2z + T2A;
+	       T2C = TB - TI;
+	       T2D = T1b - T1c;
+	       T2E = T2C - T2D;
+	       O[WS(os, 6)] = KP673779706 * T2B - KP1_883088130 * T2E;
+	       T2F = T2a + T2b;
+	       T2G = T2d + T2e;
+	       T2H = T2F - T2G;
+	       T2I = T2i + T2j;
+	       T2J = T27 + T28;
+	       T2K = T2I - T2J;
+	       O[WS(os, 7)] = KP1_847759065 * T2H + KP765366864 * T2K;
+	       T2L = T2C + T2D;
+	       T2M = T2z - T2A;
+	       O[WS(os, 8)] = KP1_807978586 * T2L + KP855110186 * T2M;
+	       T2N = T2w + T2x;
+	       T2O = T2t - T2u;
+	       O[WS(os, 9)] = KP1_763842528 * T2N + KP942793473 * T2O;
+	       T2P = T2q + T2r;
+	       T2Q = T2n - T2o;
+	       O[WS(os, 10)] = KP1_028205488 * T2P - KP1_715457220 * T2Q;
+	       T2R = T2k - T2l;
+	       T2S = T29 - T2g;
+	       O[WS(os, 11)] = KP1_111140466 * T2R - KP1_662939224 * T2S;
+	       T2T = T22 - T25;
+	       T2U = T1R - T1Y;
+	       O[WS(os, 12)] = KP1_606415062 * T2T + KP1_191398608 * T2U;
+	       T2V = T1K - T1N;
+	       T2W = T1p - T1E;
+	       O[WS(os, 13)] = KP1_268786568 * T2V - KP1_546020906 * T2W;
+	       T2X = T1a - T1d;
+	       T2Y = TJ - T12;
+	       O[WS(os, 14)] = KP1_343117909 * T2X - KP1_481902250 * T2Y;
+	       T2Z = T2I + T2J;
+	       T30 = T2F + T2G;
+	       O[WS(os, 15)] = KP1_414213562 * (T2Z - T30);
+	       O[WS(os, 16)] = KP1_481902250 * T2X + KP1_343117909 * T2Y;
+	       O[WS(os, 17)] = KP1_546020906 * T2V + KP1_268786568 * T2W;
+	       O[WS(os, 18)] = KP1_606415062 * T2U - KP1_191398608 * T2T;
+	       O[WS(os, 19)] = KP1_662939224 * T2R + KP1_111140466 * T2S;
+	       O[WS(os, 20)] = KP1_715457220 * T2P + KP1_028205488 * T2Q;
+	       O[WS(os, 21)] = KP1_763842528 * T2O - KP942793473 * T2N;
+	       O[WS(os, 22)] = KP1_807978586 * T2M - KP855110186 * T2L;
+	       O[WS(os, 23)] = KP1_847759065 * T2K - KP765366864 * T2H;
+	       O[WS(os, 24)] = KP1_883088130 * T2B + KP673779706 * T2E;
+	       O[WS(os, 25)] = KP1_913880671 * T2v + KP580569354 * T2y;
+	       O[WS(os, 26)] = KP1_940062506 * T2s - KP485960359 * T2p;
+	       O[WS(os, 27)] = KP1_961570560 * T2m - KP390180644 * T2h;
+	       O[WS(os, 28)] = KP1_978353019 * T1Z + KP293460948 * T26;
+	       O[WS(os, 29)] = KP1_990369453 * T1O - KP196034280 * T1F;
+	       O[WS(os, 30)] = KP1_997590912 * T1e - KP098135348 * T13;
+	       O[WS(os, 31)] = KP2_000000000 * (T2Z + T30);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 32, "o10_32", {186, 104, 0, 0}, &GENUS, RODFT10 };
+
+void X(codelet_o10_32) (planner *p) {
+     X(kr2r_register) (p, o10_32, &desc);
+}
+
+#endif
@@ -0,0 +1,1345 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft10 -n 64 -name o10_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 466 FP additions, 260 FP multiplications,
+ * (or, 332 additions, 126 multiplications, 134 fused multiply/add),
+ * 446 stack variables, 79 constants, and 128 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o10_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       E T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       E T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       E T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       E T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       E T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       E T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       E T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       E T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       E T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       E T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       E T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       E T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       E T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       E T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       E T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       E T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       E T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       E T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       E T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       E T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       E T6Z, T70, T71, T72, T73, T74, T75, T76, T77, T78, T79, T7a;
+	       E T7b, T7c;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = I[WS(is, 32)];
+	       Ty = I[WS(is, 33)];
+	       Tz = I[WS(is, 34)];
+	       TA = I[WS(is, 35)];
+	       TB = I[WS(is, 36)];
+	       TC = I[WS(is, 37)];
+	       TD = I[WS(is, 38)];
+	       TE = I[WS(is, 39)];
+	       TF = I[WS(is, 40)];
+	       TG = I[WS(is, 41)];
+	       TH = I[WS(is, 42)];
+	       TI = I[WS(is, 43)];
+	       TJ = I[WS(is, 44)];
+	       TK = I[WS(is, 45)];
+	       TL = I[WS(is, 46)];
+	       TM = I[WS(is, 47)];
+	       TN = I[WS(is, 48)];
+	       TO = I[WS(is, 49)];
+	       TP = I[WS(is, 50)];
+	       TQ = I[WS(is, 51)];
+	       TR = I[WS(is, 52)];
+	       TS = I[WS(is, 53)];
+	       TT = I[WS(is, 54)];
+	       TU = I[WS(is, 55)];
+	       TV = I[WS(is, 56)];
+	       TW = I[WS(is, 57)];
+	       TX = I[WS(is, 58)];
+	       TY = I[WS(is, 59)];
+	       TZ = I[WS(is, 60)];
+	       T10 = I[WS(is, 61)];
+	       T11 = I[WS(is, 62)];
+	       T12 = I[WS(is, 63)];
+	       T13 = T1 + T12;
+	       T14 = KP707106781 * (Tg + TN);
+	       T15 = FMS(KP707106781, Th + TM, T14);
+	       T16 = T13 + T15;
+	       T17 = To + TF;
+	       T18 = T9 + TU;
+	       T19 = FMS(KP923879532, T18, KP382683432 * T17);
+	       T1a = T8 + TV;
+	       T1b = Tp + TE;
+	       T1c = FMS(KP382683432, T1b, KP923879532 * T1a);
+	       T1d = T19 + T1c;
+	       T1e = T16 + T1d;
+	       T1f = Ts + TB;
+	       T1g = KP707106781 * (Tc + TR);
+	       T1h = FMA(KP707106781, Tl + TI, T1g);
+	       T1i = T1f + T1h;
+	       T1j = T5 + TY;
+	       T1k = FMS(KP707106781, Tl + TI, T1g);
+	       T1l = T1j + T1k;
+	       T1m = FMS(KP980785280, T1l, KP195090322 * T1i);
+	       T1n = Tk + TJ;
+	       T1o = KP707106781 * (T4 + TZ);
+	       T1p = FMA(KP707106781, Tt + TA, T1o);
+	       T1q = T1n + T1p;
+	       T1r = Td + TQ;
+	       T1s = FMS(KP707106781, Tt + TA, T1o);
+	       T1t = T1r + T1s;
+	       T1u = FMS(KP831469612, T1t, KP555570233 * T1q);
+	       T1v = T1m + T1u;
+	       T1w = T1e + T1v;
+	       T1x = Tu + Tz;
+	       T1y = KP707106781 * (Te + TP);
+	       T1z = FMA(KP707106781, Tj + TK, T1y);
+	       T1A = T1x + T1z;
+	       T1B = Tb + TS;
+	       T1C = Tm + TH;
+	       T1D = FMA(KP923879532, T1C, KP382683432 * T1B);
+	       T1E = Tr + TC;
+	       T1F = T6 + TX;
+	       T1G = FMA(KP382683432, T1F, KP923879532 * T1E);
+	       T1H = T1D + T1G;
+	       T1I = T1A + T1H;
+	       T1J = T3 + T10;
+	       T1K = FMS(KP707106781, Tj + TK, T1y);
+	       T1L = T1J + T1K;
+	       T1M = FMS(KP923879532, T1B, KP382683432 * T1C);
+	       T1N = FMS(KP382683432, T1E, KP923879532 * T1F);
+	       T1O = T1M + T1N;
+	       T1P = T1L + T1O;
+	       T1Q = FMS(KP995184726, T1P, KP098017140 * T1I);
+	       T1R = Tq + TD;
+	       T1S = KP707106781 * (Ta + TT);
+	       T1T = FMA(KP707106781, Tn + TG, T1S);
+	       T1U = T1R + T1T;
+	       T1V = Tf + TO;
+	       T1W = Ti + TL;
+	       T1X = FMA(KP923879532, T1W, KP382683432 * T1V);
+	       T1Y = Tv + Ty;
+	       T1Z = T2 + T11;
+	       T20 = FMA(KP382683432, T1Z, KP923879532 * T1Y);
+	       T21 = T1X + T20;
+	       T22 = T1U + T21;
+	       T23 = T7 + TW;
+	       T24 = FMS(KP707106781, Tn + TG, T1S);
+	       T25 = T23 + T24;
+	       T26 = FMS(KP923879532, T1V, KP382683432 * T1W);
+	       T27 = FMS(KP382683432, T1Y, KP923879532 * T1Z);
+	       T28 = T26 + T27;
+	       T29 = T25 + T28;
+	       T2a = FMS(KP956940335, T29, KP290284677 * T22);
+	       T2b = T1Q + T2a;
+	       T2c = T1w + T2b;
+	       T2d = Tw + Tx;
+	       T2e = FMA(KP707106781, Th + TM, T14);
+	       T2f = T2d + T2e;
+	       T2g = FMA(KP923879532, T17, KP382683432 * T18);
+	       T2h = FMA(KP382683432, T1a, KP923879532 * T1b);
+	       T2i = T2g + T2h;
+	       T2j = T2f + T2i;
+	       T2k = FMA(KP980785280, T1i, KP195090322 * T1l);
+	       T2l = FMA(KP831469612, T1q, KP555570233 * T1t);
+	       T2m = T2k + T2l;
+	       T2n = T2j + T2m;
+	       T2o = FMA(KP995184726, T1I, KP098017140 * T1P);
+	       T2p = FMA(KP956940335, T22, KP290284677 * T29);
+	       T2q = T2o + T2p;
+	       T2r = T2n + T2q;
+	       O[0] = FMA(KP1_999397637, T2r, KP049082457 * T2c);
+	       T2s = T1 - T12;
+	       T2t = Tw - Tx;
+	       T2u = T2s + T2t;
+	       T2v = Tp - TE;
+	       T2w = T8 - TV;
+	       T2x = KP707106781 * (T2v + T2w);
+	       T2y = T9 - TU;
+	       T2z = To - TF;
+	       T2A = FMS(KP707106781, T2y + T2z, T2x);
+	       T2B = T2u + T2A;
+	       T2C = Tl - TI;
+	       T2D = Tc - TR;
+	       T2E = T2C + T2D;
+	       T2F = T5 - TY;
+	       T2G = Ts - TB;
+	       T2H = T2F + T2G;
+	       T2I = FMS(KP923879532, T2H, KP382683432 * T2E);
+	       T2J = Tt - TA;
+	       T2K = T4 - TZ;
+	       T2L = T2J + T2K;
+	       T2M = Td - TQ;
+	       T2N = Tk - TJ;
+	       T2O = T2M + T2N;
+	       T2P = FMS(KP382683432, T2O, KP923879532 * T2L);
+	       T2Q = T2I + T2P;
+	       T2R = T2B + T2Q;
+	       T2S = Tj - TK;
+	       T2T = Te - TP;
+	       T2U = T2S + T2T;
+	       T2V = Tr - TC;
+	       T2W = T6 - TX;
+	       T2X = KP707106781 * (T2V + T2W);
+	       T2Y = Tb - TS;
+	       T2Z = Tm - TH;
+	       T30 = FMA(KP707106781, T2Y + T2Z, T2X);
+	       T31 = T2U + T30;
+	       T32 = T3 - T10;
+	       T33 = Tu - Tz;
+	       T34 = T32 + T33;
+	       T35 = FMS(KP707106781, T2Y + T2Z, T2X);
+	       T36 = T34 + T35;
+	       T37 = FMS(KP980785280, T36, KP195090322 * T31);
+	       T38 = Tn - TG;
+	       T39 = Ta - TT;
+	       T3a = T38 + T39;
+	       T3b = Tv - Ty;
+	       T3c = T2 - T11;
+	       T3d = KP707106781 * (T3b + T3c);
+	       T3e = Tf - TO;
+	       T3f = Ti - TL;
+	       T3g = FMA(KP707106781, T3e + T3f, T3d);
+	       T3h = T3a + T3g;
+	       T3i = T7 - TW;
+	       T3j = Tq - TD;
+	       T3k = T3i + T3j;
+	       T3l = FMS(KP707106781, T3e + T3f, T3d);
+	       T3m = T3k + T3l;
+	       T3n = FMS(KP831469612, T3m, KP555570233 * T3h);
+	       T3o = T37 + T3n;
+	       T3p = T2R + T3o;
+	       T3q = Th - TM;
+	       T3r = Tg - TN;
+	       T3s = T3q + T3r;
+	       T3t = FMA(KP707106781, T2y + T2z, T2x);
+	       T3u = T3s + T3t;
+	       T3v = FMA(KP923879532, T2E, KP382683432 * T2H);
+	       T3w = FMA(KP382683432, T2L, KP923879532 * T2O);
+	       T3x = T3v + T3w;
+	       T3y = T3u + T3x;
+	       T3z = FMA(KP980785280, T31, KP195090322 * T36);
+	       T3A = FMA(KP831469612, T3h, KP555570233 * T3m);
+	       T3B = T3z + T3A;
+	       T3C = T3y + T3B;
+	       O[WS(os, 1)] = FMA(KP1_997590912, T3C, KP098135348 * T3p);
+	       T3D = T2d - T2e;
+	       T3E = T19 - T1c;
+	       T3F = T3D - T3E;
+	       T3G = T1j - T1k;
+	       T3H = T1f - T1h;
+	       T3I = FMS(KP831469612, T3H, KP555570233 * T3G);
+	       T3J = T1r - T1s;
+	       T3K = T1n - T1p;
+	       T3L = FMA(KP195090322, T3K, KP980785280 * T3J);
+	       T3M = T3I - T3L;
+	       T3N = T3F + T3M;
+	       T3O = T1J - T1K;
+	       T3P = T1D - T1G;
+	       T3Q = T3O + T3P;
+	       T3R = T1x - T1z;
+	       T3S = T1M - T1N;
+	       T3T = T3R - T3S;
+	       T3U = FMS(KP956940335, T3T, KP290284677 * T3Q);
+	       T3V = T23 - T24;
+	       T3W = T1X - T20;
+	       T3X = T3V + T3W;
+	       T3Y = T1R - T1T;
+	       T3Z = T26 - T27;
+	       T40 = T3Y - T3Z;
+	       T41 = FMS(KP634393284, T40, KP773010453 * T3X);
+	       T42 = T3U + T41;
+	       T43 = T3N + T42;
+	       T44 = T13 - T15;
+	       T45 = T2g - T2h;
+	       T46 = T44 + T45;
+	       T47 = FMA(KP831469612, T3G, KP555570233 * T3H);
+	       T48 = FMS(KP195090322, T3J, KP980785280 * T3K);
+	       T49 = T47 - T48;
+	       T4a = T46 + T49;
+	       T4b = FMA(KP956940335, T3Q, KP290284677 * T3T);
+	       T4c = FMA(KP634393284, T3X, KP773010453 * T40);
+	       T4d = T4b + T4c;
+	       T4e = T4a + T4d;
+	       O[WS(os, 2)] = FMS(KP147129127, T4e, KP1_994580913 * T43);
+	       T4f = T2s - T2t;
+	       T4g = T3q - T3r;
+	       T4h = T4f - T4g;
+	       T4i = T2M - T2N;
+	       T4j = T2J - T2K;
+	       T4k = KP707106781 * (T4i - T4j);
+	       T4l = T2F - T2G;
+	       T4m = T2C - T2D;
+	       T4n = FMS(KP707106781, T4l - T4m, T4k);
+	       T4o = T4h + T4n;
+	       T4p = T2Y - T2Z;
+	       T4q = T2V - T2W;
+	       T4r = T4p - T4q;
+	       T4s = T32 - T33;
+	       T4t = T2S - T2T;
+	       T4u = T4s - T4t;
+	       T4v = FMS(KP923879532, T4u, KP382683432 * T4r);
+	       T4w = T3e - T3f;
+	       T4x = T3b - T3c;
+	       T4y = T4w - T4x;
+	       T4z = T3i - T3j;
+	       T4A = T38 - T39;
+	       T4B = T4z - T4A;
+	       T4C = FMS(KP382683432, T4B, KP923879532 * T4y);
+	       T4D = T4v + T4C;
+	       T4E = T4o + T4D;
+	       T4F = T2y - T2z;
+	       T4G = T2v - T2w;
+	       T4H = T4F - T4G;
+	       T4I = FMA(KP707106781, T4l - T4m, T4k);
+	       T4J = T4H + T4I;
+	       T4K = FMA(KP923879532, T4r, KP382683432 * T4u);
+	       T4L = FMA(KP382683432, T4y, KP923879532 * T4B);
+	       T4M = T4K + T4L;
+	       T4N = T4J + T4M;
+	       O[WS(os, 3)] = FMA(KP1_990369453, T4N, KP196034280 * T4E);
+	       T4O = T44 - T45;
+	       T4P = T3I + T3L;
+	       T4Q = T4O - T4P;
+	       T4R = T3R + T3S;
+	       T4S = T3O - T3P;
+	       T4T = FMS(KP881921264, T4S, KP471396736 * T4R);
+	       T4U = T3Y + T3Z;
+	       T4V = T3V - T3W;
+	       T4W = FMS(KP098017140, T4V, KP995184726 * T4U);
+	       T4X = T4T + T4W;
+	       T4Y = T4Q + T4X;
+	       T4Z = T3D + T3E;
+	       T50 = T47 + T48;
+	       T51 = T4Z + T50;
+	       T52 = FMA(KP881921264, T4R, KP471396736 * T4S);
+	       T53 = FMA(KP098017140, T4U, KP995184726 * T4V);
+	       T54 = T52 + T53;
+	       T55 = T51 + T54;
+	       O[WS(os, 4)] = FMA(KP1_984959069, T55, KP244821350 * T4Y);
+	       T56 = T3s - T3t;
+	       T57 = T2I - T2P;
+	       T58 = T56 - T57;
+	       T59 = T34 - T35;
+	       T5a = T2U - T30;
+	       T5b = FMS(KP831469612, T5a, KP555570233 * T59);
+	       T5c = T3k - T3l;
+	       T5d = T3a - T3g;
+	       T5e = FMA(KP195090322, T5d, KP980785280 * T5c);
+	       T5f = T5b - T5e;
+	       T5g = T58 + T5f;
+	       T5h = T2u - T2A;
+	       T5i = T3v - T3w;
+	       T5j = T5h + T5i;
+	       T5k = FMA(KP831469612, T59, KP555570233 * T5a);
+	       T5l = FMS(KP195090322, T5c, KP980785280 * T5d);
+	       T5m = T5k - T5l;
+	       T5n = T5j + T5m;
+	       O[WS(os, 5)] = FMS(KP293460948, T5n, KP1_978353019 * T5g);
+	       T5o = T2f - T2i;
+	       T5p = T1m - T1u;
+	       T5q = T5o - T5p;
+	       T5r = T1L - T1O;
+	       T5s = T1A - T1H;
+	       T5t = FMS(KP773010453, T5s, KP634393284 * T5r);
+	       T5u = T25 - T28;
+	       T5v = T1U - T21;
+	       T5w = FMA(KP471396736, T5v, KP881921264 * T5u);
+	       T5x = T5t - T5w;
+	       T5y = T5q + T5x;
+	       T5z = T16 - T1d;
+	       T5A = T2k - T2l;
+	       T5B = T5z + T5A;
+	       T5C = FMA(KP773010453, T5r, KP634393284 * T5s);
+	       T5D = FMS(KP471396736, T5u, KP881921264 * T5v);
+	       T5E = T5C - T5D;
+	       T5F = T5B + T5E;
+	       O[WS(os, 6)] = FMS(KP341923777, T5F, KP1_970555284 * T5y);
+	       T5G = T4f + T4g;
+	       T5H = T4F + T4G;
+	       T5I = T5G - T5H;
+	       T5J = T4z + T4A;
+	       T5K = T4w + T4x;
+	       T5L = KP707106781 * (T5J - T5K);
+	       T5M = T4s + T4t;
+	       T5N = T4p + T4q;
+	       T5O = FMS(KP707106781, T5M - T5N, T5L);
+	       T5P = T5I + T5O;
+	       T5Q = T4l + T4m;
+	       T5R = T4i + T4j;
+	       T5S = T5Q - T5R;
+	       T5T = FMA(KP707106781, T5M - T5N, T5L);
+	       T5U = T5S + T5T;
+	       O[WS(os, 7)] = FMA(KP1_961570560, T5U, KP390180644 * T5P);
+	       T5V = T5z - T5A;
+	       T5W = T5t + T5w;
+	       T5X = T5V - T5W;
+	       T5Y = T5o + T5p;
+	       T5Z = T5C + T5D;
+	       T60 = T5Y + T5Z;
+	       O[WS(os, 8)] = FMA(KP1_951404260, T60, KP438202480 * T5X);
+	       T61 = T5h - T5i;
+	       T62 = T5b + T5e;
+	       T63 = T61 - T62;
+	       T64 = T56 + T57;
+	       T65 = T5k + T5l;
+	       T66 = T64 + T65;
+	       O[WS(os, 9)] = FMA(KP1_940062506, T66, KP485960359 * T63);
+	       T67 = T4Z - T50;
+	       T68 = T4T - T4W;
+	       T69 = T67 - T68;
+	       T6a = T4O + T4P;
+	       T6b = T52 - T53;
+	       T6c = T6a + T6b;
+	       O[WS(os, 10)] = FMS(KP533425514, T6c, KP1_927552131 * T69);
+	       T6d = T4H - T4I;
+	       T6e = T4v - T4C;
+	       T6f = T6d - T6e;
+	       T6g = T4h - T4n;
+	       T6h = T4K - T4L;
+	       T6i = T6g + T6h;
+	       O[WS(os, 11)] = FMS(KP580569354, T6i, KP1_913880671 * T6f);
+	       T6j = T46 - T49;
+	       T6k = T3U - T41;
+	       T6l = T6j - T6k;
+	       T6m = T3F - T3M;
+	       T6n = T4b - T4c;
+	       T6o = T6m + T6n;
+	       O[WS(os, 12)] = FMA(KP1_899056361, T6o, KP627363480 * T6l);
+	       T6p = T3u - T3x;
+	       T6q = T37 - T3n;
+	       T6r = T6p - T6q;
+	       T6s = T2B - T2Q;
+	       T6t = T3z - T3A;
+	       T6u = T6s + T6t;
+	       O[WS(os, 13)] = FMS(KP673779706, T6u, KP1_883088130 * T6r);
+	       T6v = T2j - T2m;
+	       T6w = T1Q - T2a;
+	       T6x = T6v - T6w;
+	       T6y = T1e - T1v;
+	       T6z = T2o - T2p;
+	       T6A = T6y + T6z;
+	       O[WS(os, 14)] = FMS(KP719790073, T6A, KP1_865985597 * T6x);
+	       T6B = T5G + T5H;
+	       T6C = T5Q + T5R;
+	       T6D = T6B - T6C;
+	       T6E = T5M + T5N;
+	       T6F = T5J + T5K;
+	       T6G = T6E - T6F;
+	       O[WS(os, 15)] = FMA(KP1_847759065, T6G, KP765366864 * T6D);
+	       T6H = T6y - T6z;
+	       T6I = T6v + T6w;
+	       O[WS(os, 16)] = FMA(KP1_828419511, T6I, KP810482628 * T6H);
+	       T6J = T6s - T6t;
+	       T6K = T6p + T6q;
+	       O[WS(os, 17)] = FMA(KP1_807978586, T6K, KP855110186 * T6J);
+	       T6L = T6m - T6n;
+	       T6M = T6j + T6k;
+	       O[WS(os, 18)] = FMS(KP899222659, T6M, KP1_786448602 * T6L);
+	       T6N = T6g - T6h;
+	       T6O = T6d + T6e;
+	       O[WS(os, 19)] = FMA(KP1_763842528, T6O, KP942793473 * T6N);
+	       T6P = T6a - T6b;
+	       T6Q = T67 + T68;
+	       O[WS(os, 20)] = FMA(KP1_740173982, T6Q, KP985796384 * T6P);
+	       T6R = T64 - T65;
+	       T6S = T61 + T62;
+	       O[WS(os, 21)] = FMS(KP1_028205488, T6S, KP1_715457220 * T6R);
+	       T6T = T5Y - T5Z;
+	       T6U = T5V + T5W;
+	       O[WS(os, 22)] = FMS(KP1_069995239, T6U, KP1_689707130 * T6T);
+	       T6V = T5S - T5T;
+	       T6W = T5I - T5O;
+	       O[WS(os, 23)] = FMS(KP1_111140466, T6W, KP1_662939224 * T6V);
+	       T6X = T5B - T5E;
+	       T6Y = T5q - T5x;
+	       O[WS(os, 24)] = FMA(KP1_635169626, T6Y, KP1_151616382 * T6X);
+	       T6Z = T5j - T5m;
+	       T70 = T58 - T5f;
+	       O[WS(os, 25)] = FMA(KP1_606415062, T70, KP1_191398608 * T6Z);
+	       T71 = T51 - T54;
+	       T72 = T4Q - T4X;
+	       O[WS(os, 26)] = FMS(KP1_230463181, T72, KP1_576692855 * T71);
+	       T73 = T4J - T4M;
+	       T74 = T4o - T4D;
+	       O[WS(os, 27)] = FMS(KP1_268786568, T74, KP1_546020906 * T73);
+	       T75 = T4a - T4d;
+	       T76 = T3N - T42;
+	       O[WS(os, 28)] = FMA(KP1_514417693, T76, KP1_306345685 * T75);
+	       T77 = T3y - T3B;
+	       T78 = T2R - T3o;
+	       O[WS(os, 29)] = FMS(KP1_343117909, T78, KP1_481902250 * T77);
+	       T79 = T2n - T2q;
+	       T7a = T1w - T2b;
+	       O[WS(os, 30)] = FMS(KP1_379081089, T7a, KP1_448494165 * T79);
+	       T7b = T6B + T6C;
+	       T7c = T6E + T6F;
+	       O[WS(os, 31)] = KP1_414213562 * (T7b - T7c);
+	       O[WS(os, 32)] = FMA(KP1_448494165, T7a, KP1_379081089 * T79);
+	       O[WS(os, 33)] = FMA(KP1_481902250, T78, KP1_343117909 * T77);
+	       O[WS(os, 34)] = FMS(KP1_514417693, T75, KP1_306345685 * T76);
+	       O[WS(os, 35)] = FMA(KP1_546020906, T74, KP1_268786568 * T73);
+	       O[WS(os, 36)] = FMA(KP1_576692855, T72, KP1_230463181 * T71);
+	       O[WS(os, 37)] = FMS(KP1_606415062, T6Z, KP1_191398608 * T70);
+	       O[WS(os, 38)] = FMS(KP1_635169626, T6X, KP1_151616382 * T6Y);
+	       O[WS(os, 39)] = FMA(KP1_662939224, T6W, KP1_111140466 * T6V);
+	       O[WS(os, 40)] = FMA(KP1_689707130, T6U, KP1_069995239 * T6T);
+	       O[WS(os, 41)] = FMA(KP1_715457220, T6S, KP1_028205488 * T6R);
+	       O[WS(os, 42)] = FMS(KP1_740173982, T6P, KP985796384 * T6Q);
+	       O[WS(os, 43)] = FMS(KP1_763842528, T6N, KP942793473 * T6O);
+	       O[WS(os, 44)] = FMA(KP1_786448602, T6M, KP899222659 * T6L);
+	       O[WS(os, 45)] = FMS(KP1_807978586, T6J, KP855110186 * T6K);
+	       O[WS(os, 46)] = FMS(KP1_828419511, T6H, KP810482628 * T6I);
+	       O[WS(os, 47)] = FMS(KP1_847759065, T6D, KP765366864 * T6G);
+	       O[WS(os, 48)] = FMA(KP1_865985597, T6A, KP719790073 * T6x);
+	       O[WS(os, 49)] = FMA(KP1_883088130, T6u, KP673779706 * T6r);
+	       O[WS(os, 50)] = FMS(KP1_899056361, T6l, KP627363480 * T6o);
+	       O[WS(os, 51)] = FMA(KP1_913880671, T6i, KP580569354 * T6f);
+	       O[WS(os, 52)] = FMA(KP1_927552131, T6c, KP533425514 * T69);
+	       O[WS(os, 53)] = FMS(KP1_940062506, T63, KP485960359 * T66);
+	       O[WS(os, 54)] = FMS(KP1_951404260, T5X, KP438202480 * T60);
+	       O[WS(os, 55)] = FMS(KP1_961570560, T5P, KP390180644 * T5U);
+	       O[WS(os, 56)] = FMA(KP1_970555284, T5F, KP341923777 * T5y);
+	       O[WS(os, 57)] = FMA(KP1_978353019, T5n, KP293460948 * T5g);
+	       O[WS(os, 58)] = FMS(KP1_984959069, T4Y, KP244821350 * T55);
+	       O[WS(os, 59)] = FMS(KP1_990369453, T4E, KP196034280 * T4N);
+	       O[WS(os, 60)] = FMA(KP1_994580913, T4e, KP147129127 * T43);
+	       O[WS(os, 61)] = FMS(KP1_997590912, T3p, KP098135348 * T3C);
+	       O[WS(os, 62)] = FMS(KP1_999397637, T2c, KP049082457 * T2r);
+	       O[WS(os, 63)] = KP2_000000000 * (T7b + T7c);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 64, "o10_64", {332, 126, 134, 0}, &GENUS, RODFT10 };
+
+void X(codelet_o10_64) (planner *p) {
+     X(kr2r_register) (p, o10_64, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft10 -n 64 -name o10_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 456 FP additions, 250 FP multiplications,
+ * (or, 456 additions, 250 multiplications, 0 fused multiply/add),
+ * 456 stack variables, 79 constants, and 128 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o10_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       E T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       E T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       E T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       E T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       E T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       E T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       E T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       E T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       E T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       E T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       E T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       E T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       E T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       E T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       E T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       E T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       E T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       E T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       E T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       E T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       E T6Z, T70, T71, T72, T73, T74, T75, T76, T77, T78, T79, T7a;
+	       E T7b, T7c, T7d, T7e, T7f, T7g, T7h, T7i, T7j, T7k, T7l, T7m;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = I[WS(is, 32)];
+	       Ty = I[WS(is, 33)];
+	       Tz = I[WS(is, 34)];
+	       TA = I[WS(is, 35)];
+	       TB = I[WS(is, 36)];
+	       TC = I[WS(is, 37)];
+	       TD = I[WS(is, 38)];
+	       TE = I[WS(is, 39)];
+	       TF = I[WS(is, 40)];
+	       TG = I[WS(is, 41)];
+	       TH = I[WS(is, 42)];
+	       TI = I[WS(is, 43)];
+	       TJ = I[WS(is, 44)];
+	       TK = I[WS(is, 45)];
+	       TL = I[WS(is, 46)];
+	       TM = I[WS(is, 47)];
+	       TN = I[WS(is, 48)];
+	       TO = I[WS(is, 49)];
+	       TP = I[WS(is, 50)];
+	       TQ = I[WS(is, 51)];
+	       TR = I[WS(is, 52)];
+	       TS = I[WS(is, 53)];
+	       TT = I[WS(is, 54)];
+	       TU = I[WS(is, 55)];
+	       TV = I[WS(is, 56)];
+	       TW = I[WS(is, 57)];
+	       TX = I[WS(is, 58)];
+	       TY = I[WS(is, 59)];
+	       TZ = I[WS(is, 60)];
+	       T10 = I[WS(is, 61)];
+	       T11 = I[WS(is, 62)];
+	       T12 = I[WS(is, 63)];
+	       T13 = Tw + Tx;
+	       T14 = KP707106781 * (Th + TM);
+	       T15 = KP707106781 * (Tg + TN);
+	       T16 = T14 + T15;
+	       T17 = T13 + T16;
+	       T18 = To + TF;
+	       T19 = T9 + TU;
+	       T1a = KP923879532 * T18 + KP382683432 * T19;
+	       T1b = T8 + TV;
+	       T1c = Tp + TE;
+	       T1d = KP382683432 * T1b + KP923879532 * T1c;
+	       T1e = T1a + T1d;
+	       T1f = T17 + T1e;
+	       T1g = Ts + TB;
+	       T1h = KP707106781 * (Tl + TI);
+	       T1i = KP707106781 * (Tc + TR);
+	       T1j = T1h + T1i;
+	       T1k = T1g + T1j;
+	       T1l = T5 + TY;
+	       T1m = T1h - T1i;
+	       T1n = T1l + T1m;
+	       T1o = KP980785280 * T1k + KP195090322 * T1n;
+	       T1p = Tk + TJ;
+	       T1q = KP707106781 * (Tt + TA);
+	       T1r = KP707106781 * (T4 + TZ);
+	       T1s = T1q + T1r;
+	       T1t = T1p + T1s;
+	       T1u = Td + TQ;
+	       T1v = T1q - T1r;
+	       T1w = T1u + T1v;
+	       T1x = KP831469612 * T1t + KP555570233 * T1w;
+	       T1y = T1o + T1x;
+	       T1z = T1f + T1y;
+	       T1A = Tu + Tz;
+	       T1B = KP707106781 * (Tj + TK);
+	       T1C = KP707106781 * (Te + TP);
+	       T1D = T1B + T1C;
+	       T1E = T1A + T1D;
+	       T1F = Tm + TH;
+	       T1G = Tb + TS;
+	       T1H = KP923879532 * T1F + KP382683432 * T1G;
+	       T1I = T6 + TX;
+	       T1J = Tr + TC;
+	       T1K = KP382683432 * T1I + KP923879532 * T1J;
+	       T1L = T1H + T1K;
+	       T1M = T1E + T1L;
+	       T1N = T3 + T10;
+	       T1O = T1B - T1C;
+	       T1P = T1N + T1O;
+	       T1Q = KP923879532 * T1G - KP382683432 * T1F;
+	       T1R = KP382683432 * T1J - KP923879532 * T1I;
+	       T1S = T1Q + T1R;
+	       T1T = T1P + T1S;
+	       T1U = KP995184726 * T1M + KP098017140 * T1T;
+	       T1V = Tq + TD;
+	       T1W = KP707106781 * (Tn + TG);
+	       T1X = KP707106781 * (Ta + TT);
+	       T1Y = T1W + T1X;
+	       T1Z = T1V + T1Y;
+	       T20 = Ti + TL;
+	       T21 = Tf + TO;
+	       T22 = KP923879532 * T20 + KP382683432 * T21;
+	       T23 = T2 + T11;
+	       T24 = Tv + Ty;
+	       T25 = KP382683432 * T23 + KP923879532 * T24;
+	       T26 = T22 + T25;
+	       T27 = T1Z + T26;
+	       T28 = T7 + TW;
+	       T29 = T1W - T1X;
+	       T2a = T28 + T29;
+	       T2b = KP923879532 * T21 - KP382683432 * T20;
+	       T2c = KP382683432 * T24 - KP923879532 * T23;
+	       T2d = T2b + T2c;
+	       T2e = T2a + T2d;
+	       T2f = KP956940335 * T27 + KP290284677 * T2e;
+	       T2g = T1U + T2f;
+	       T2h = T1z + T2g;
+	       T2i = T1 + T12;
+	       T2j = T14 - T15;
+	       T2k = T2i + T2j;
+	       T2l = KP923879532 * T19 - KP382683432 * T18;
+	       T2m = KP382683432 * T1c - KP923879532 * T1b;
+	       T2n = T2l + T2m;
+	       T2o = T2k + T2n;
+	       T2p = KP980785280 * T1n - KP195090322 * T1k;
+	       T2q = KP831469612 * T1w - KP555570233 * T1t;
+	       T2r = T2p + T2q;
+	       T2s = T2o + T2r;
+	       T2t = KP995184726 * T1T - KP098017140 * T1M;
+	       T2u = KP956940335 * T2e - KP290284677 * T27;
+	       T2v = T2t + T2u;
+	       T2w = T2s + T2v;
+	       O[0] = KP1_999397637 * T2h + KP049082457 * T2w;
+	       T2x = Th - TM;
+	       T2y = Tg - TN;
+	       T2z = T2x + T2y;
+	       T2A = T9 - TU;
+	       T2B = To - TF;
+	       T2C = KP707106781 * (T2A + T2B);
+	       T2D = Tp - TE;
+	       T2E = T8 - TV;
+	       T2F = KP707106781 * (T2D + T2E);
+	       T2G = T2C + T2F;
+	       T2H = T2z + T2G;
+	       T2I = Tl - TI;
+	       T2J = Tc - TR;
+	       T2K = T2I + T2J;
+	       T2L = T5 - TY;
+	       T2M = Ts - TB;
+	       T2N = T2L + T2M;
+	       T2O = KP923879532 * T2K + KP382683432 * T2N;
+	       T2P = Tt - TA;
+	       T2Q = T4 - TZ;
+	       T2R = T2P + T2Q;
+	       T2S = Td - TQ;
+	       T2T = Tk - TJ;
+	       T2U = T2S + T2T;
+	       T2V = KP382683432 * T2R + KP923879532 * T2U;
+	       T2W = T2O + T2V;
+	       T2X = T2H + T2W;
+	       T2Y = Tj - TK;
+	       T2Z = Te - TP;
+	       T30 = T2Y + T2Z;
+	       T31 = Tb - TS;
+	       T32 = Tm - TH;
+	       T33 = KP707106781 * (T31 + T32);
+	       T34 = Tr - TC;
+	       T35 = T6 - TX;
+	       T36 = KP707106781 * (T34 + T35);
+	       T37 = T33 + T36;
+	       T38 = T30 + T37;
+	       T39 = T3 - T10;
+	       T3a = Tu - Tz;
+	       T3b = T39 + T3a;
+	       T3c = T33 - T36;
+	       T3d = T3b + T3c;
+	       T3e = KP980785280 * T38 + KP195090322 * T3d;
+	       T3f = Tn - TG;
+	       T3g = Ta - TT;
+	       T3h = T3f + T3g;
+	       T3i = Tf - TO;
+	       T3j = Ti - TL;
+	       T3k = KP707106781 * (T3i + T3j);
+	       T3l = Tv - Ty;
+	       T3m = T2 - T11;
+	       T3n = KP707106781 * (T3l + T3m);
+	       T3o = T3k + T3n;
+	       T3p = T3h + T3o;
+	       T3q = T7 - TW;
+	       T3r = Tq - TD;
+	       T3s = T3q + T3r;
+	       T3t = T3k - T3n;
+	       T3u = T3s + T3t;
+	       T3v = KP831469612 * T3p + KP555570233 * T3u;
+	       T3w = T3e + T3v;
+	       T3x = T2X + T3w;
+	       T3y = T1 - T12;
+	       T3z = Tw - Tx;
+	       T3A = T3y + T3z;
+	       T3B = T2C - T2F;
+	       T3C = T3A + T3B;
+	       T3D = KP923879532 * T2N - KP382683432 * T2K;
+	       T3E = KP382683432 * T2U - KP923879532 * T2R;
+	       T3F = T3D + T3E;
+	       T3G = T3C + T3F;
+	       T3H = KP980785280 * T3d - KP195090322 * T38;
+	       T3I = KP831469612 * T3u - KP555570233 * T3p;
+	       T3J = T3H + T3I;
+	       T3K = T3G + T3J;
+	       O[WS(os, 1)] = KP1_997590912 * T3x + KP098135348 * T3K;
+	       T3L = T2i - T2j;
+	       T3M = T1a - T1d;
+	       T3N = T3L + T3M;
+	       T3O = T1l - T1m;
+	       T3P = T1g - T1j;
+	       T3Q = KP831469612 * T3O + KP555570233 * T3P;
+	       T3R = T1u - T1v;
+	       T3S = T1p - T1s;
+	       T3T = KP195090322 * T3R - KP980785280 * T3S;
+	       T3U = T3Q - T3T;
+	       T3V = T3N + T3U;
+	       T3W = T1N - T1O;
+	       T3X = T1H - T1K;
+	       T3Y = T3W + T3X;
+	       T3Z = T1A - T1D;
+	       T40 = T1Q - T1R;
+	       T41 = T3Z - T40;
+	       T42 = KP956940335 * T3Y + KP290284677 * T41;
+	       T43 = T28 - T29;
+	       T44 = T22 - T25;
+	       T45 = T43 + T44;
+	       T46 = T1V - T1Y;
+	       T47 = T2b - T2c;
+	       T48 = T46 - T47;
+	       T49 = KP634393284 * T45 + KP773010453 * T48;
+	       T4a = T42 + T49;
+	       T4b = T3V + T4a;
+	       T4c = T13 - T16;
+	       T4d = T2l - T2m;
+	       T4e = T4c - T4d;
+	       T4f = KP831469612 * T3P - KP555570233 * T3O;
+	       T4g = KP195090322 * T3S + KP980785280 * T3R;
+	       T4h = T4f - T4g;
+	       T4i = T4e + T4h;
+	       T4j = KP956940335 * T41 - KP290284677 * T3Y;
+	       T4k = KP634393284 * T48 - KP773010453 * T45;
+	       T4l = T4j + T4k;
+	       T4m = T4i + T4l;
+	       O[WS(os, 2)] = KP147129127 * T4b - KP1_994580913 * T4m;
+	       T4n = T2A - T2B;
+	       T4o = T2D - T2E;
+	       T4p = T4n - T4o;
+	       T4q = T2L - T2M;
+	       T4r = T2I - T2J;
+	       T4s = KP707106781 * (T4q - T4r);
+	       T4t = T2S - T2T;
+	       T4u = T2P - T2Q;
+	       T4v = KP707106781 * (T4t - T4u);
+	       T4w = T4s + T4v;
+	       T4x = T4p + T4w;
+	       T4y = T31 - T32;
+	       T4z = T34 - T35;
+	       T4A = T4y - T4z;
+	       T4B = T39 - T3a;
+	       T4C = T2Y - T2Z;
+	       T4D = T4B - T4C;
+	       T4E = KP923879532 * T4A + KP382683432 * T4D;
+	       T4F = T3i - T3j;
+	       T4G = T3l - T3m;
+	       T4H = T4F - T4G;
+	       T4I = T3q - T3r;
+	       T4J = T3f - T3g;
+	       T4K = T4I - T4J;
+	       T4L = KP382683432 * T4H + KP923879532 * T4K;
+	       T4M = T4E + T4L;
+	       T4N = T4x + T4M;
+	       T4O = T3y - T3z;
+	       T4P = T2x - T2y;
+	       T4Q = T4O - T4P;
+	       T4R = T4s - T4v;
+	       T4S = T4Q + T4R;
+	       T4T = KP923879532 * T4D - KP382683432 * T4A;
+	       T4U = KP382683432 * T4K - KP923879532 * T4H;
+	       T4V = T4T + T4U;
+	       T4W = T4S + T4V;
+	       O[WS(os, 3)] = KP1_990369453 * T4N + KP196034280 * T4W;
+	       T4X = T4c + T4d;
+	       T4Y = T3Q + T3T;
+	       T4Z = T4X + T4Y;
+	       T50 = T3Z + T40;
+	       T51 = T3W - T3X;
+	       T52 = KP881921264 * T50 + KP471396736 * T51;
+	       T53 = T46 + T47;
+	       T54 = T43 - T44;
+	       T55 = KP098017140 * T53 + KP995184726 * T54;
+	       T56 = T52 + T55;
+	       T57 = T4Z + T56;
+	       T58 = T3L - T3M;
+	       T59 = T4f + T4g;
+	       T5a = T58 - T59;
+	       T5b = KP881921264 * T51 - KP471396736 * T50;
+	       T5c = KP098017140 * T54 - KP995184726 * T53;
+	       T5d = T5b + T5c;
+	       T5e = T5a + T5d;
+	       O[WS(os, 4)] = KP1_984959069 * T57 + KP244821350 * T5e;
+	       T5f = T3A - T3B;
+	       T5g = T2O - T2V;
+	       T5h = T5f + T5g;
+	       T5i = T3b - T3c;
+	       T5j = T30 - T37;
+	       T5k = KP831469612 * T5i + KP555570233 * T5j;
+	       T5l = T3s - T3t;
+	       T5m = T3h - T3o;
+	       T5n = KP195090322 * T5l - KP980785280 * T5m;
+	       T5o = T5k - T5n;
+	       T5p = T5h + T5o;
+	       T5q = T2z - T2G;
+	       T5r = T3D - T3E;
+	       T5s = T5q - T5r;
+	       T5t = KP831469612 * T5j - KP555570233 * T5i;
+	       T5u = KP195090322 * T5m + KP980785280 * T5l;
+	       T5v = T5t - T5u;
+	       T5w = T5s + T5v;
+	       O[WS(os, 5)] = KP293460948 * T5p - KP1_978353019 * T5w;
+	       T5x = T2k - T2n;
+	       T5y = T1o - T1x;
+	       T5z = T5x + T5y;
+	       T5A = T1P - T1S;
+	       T5B = T1E - T1L;
+	       T5C = KP773010453 * T5A + KP634393284 * T5B;
+	       T5D = T2a - T2d;
+	       T5E = T1Z - T26;
+	       T5F = KP471396736 * T5D - KP881921264 * T5E;
+	       T5G = T5C - T5F;
+	       T5H = T5z + T5G;
+	       T5I = T17 - T1e;
+	       T5J = T2p - T2q;
+	       T5K = T5I - T5J;
+	       T5L = KP773010453 * T5B - KP634393284 * T5A;
+	       T5M = KP471396736 * T5E + KP881921264 * T5D;
+	       T5N = T5L - T5M;
+	       T5O = T5K + T5N;
+	       O[WS(os, 6)] = KP341923777 * T5H - KP1_970555284 * T5O;
+	       T5P = T4q + T4r;
+	       T5Q = T4t + T4u;
+	       T5R = T5P - T5Q;
+	       T5S = T4B + T4C;
+	       T5T = T4y + T4z;
+	       T5U = KP707106781 * (T5S - T5T);
+	       T5V = T4I + T4J;
+	       T5W = T4F + T4G;
+	       T5X = KP707106781 * (T5V - T5W);
+	       T5Y = T5U + T5X;
+	       T5Z = T5R + T5Y;
+	       T60 = T4O + T4P;
+	       T61 = T4n + T4o;
+	       T62 = T60 - T61;
+	       T63 = T5U - T5X;
+	       T64 = T62 + T63;
+	       O[WS(os, 7)] = KP1_961570560 * T5Z + KP390180644 * T64;
+	       T65 = T5I + T5J;
+	       T66 = T5C + T5F;
+	       T67 = T65 + T66;
+	       T68 = T5x - T5y;
+	       T69 = T5L + T5M;
+	       T6a = T68 - T69;
+	       O[WS(os, 8)] = KP1_951404260 * T67 + KP438202480 * T6a;
+	       T6b = T5q + T5r;
+	       T6c = T5k + T5n;
+	       T6d = T6b + T6c;
+	       T6e = T5f - T5g;
+	       T6f = T5t + T5u;
+	       T6g = T6e - T6f;
+	       O[WS(os, 9)] = KP1_940062506 * T6d + KP485960359 * T6g;
+	       T6h = T58 + T59;
+	       T6i = T52 - T55;
+	       T6j = T6h + T6i;
+	       T6k = T4X - T4Y;
+	       T6l = T5b - T5c;
+	       T6m = T6k - T6l;
+	       O[WS(os, 10)] = KP533425514 * T6j - KP1_927552131 * T6m;
+	       T6n = T4Q - T4R;
+	       T6o = T4E - T4L;
+	       T6p = T6n + T6o;
+	       T6q = T4p - T4w;
+	       T6r = T4T - T4U;
+	       T6s = T6q - T6r;
+	       O[WS(os, 11)] = KP580569354 * T6p - KP1_913880671 * T6s;
+	       T6t = T4e - T4h;
+	       T6u = T42 - T49;
+	       T6v = T6t + T6u;
+	       T6w = T3N - T3U;
+	       T6x = T4j - T4k;
+	       T6y = T6w - T6x;
+	       O[WS(os, 12)] = KP1_899056361 * T6v + KP627363480 * T6y;
+	       T6z = T3C - T3F;
+	       T6A = T3e - T3v;
+	       T6B = T6z + T6A;
+	       T6C = T2H - T2W;
+	       T6D = T3H - T3I;
+	       T6E = T6C - T6D;
+	       O[WS(os, 13)] = KP673779706 * T6B - KP1_883088130 * T6E;
+	       T6F = T2o - T2r;
+	       T6G = T1U - T2f;
+	       T6H = T6F + T6G;
+	       T6I = T1f - T1y;
+	       T6J = T2t - T2u;
+	       T6K = T6I - T6J;
+	       O[WS(os, 14)] = KP719790073 * T6H - KP1_865985597 * T6K;
+	       T6L = T5S + T5T;
+	       T6M = T5V + T5W;
+	       T6N = T6L - T6M;
+	       T6O = T60 + T61;
+	       T6P = T5P + T5Q;
+	       T6Q = T6O - T6P;
+	       O[WS(os, 15)] = KP1_847759065 * T6N + KP765366864 * T6Q;
+	       T6R = T6I + T6J;
+	       T6S = T6F - T6G;
+	       O[WS(os, 16)] = KP1_828419511 * T6R + KP810482628 * T6S;
+	       T6T = T6C + T6D;
+	       T6U = T6z - T6A;
+	       O[WS(os, 17)] = KP1_807978586 * T6T + KP855110186 * T6U;
+	       T6V = T6w + T6x;
+	       T6W = T6t - T6u;
+	       O[WS(os, 18)] = KP899222659 * T6V - KP1_786448602 * T6W;
+	       T6X = T6q + T6r;
+	       T6Y = T6n - T6o;
+	       O[WS(os, 19)] = KP1_763842528 * T6X + KP942793473 * T6Y;
+	       T6Z = T6k + T6l;
+	       T70 = T6h - T6i;
+	       O[WS(os, 20)] = KP1_740173982 * T6Z + KP985796384 * T70;
+	       T71 = T6e + T6f;
+	       T72 = T6b - T6c;
+	       O[WS(os, 21)] = KP1_028205488 * T71 - KP1_715457220 * T72;
+	       T73 = T68 + T69;
+	       T74 = T65 - T66;
+	       O[WS(os, 22)] = KP1_069995239 * T73 - KP1_689707130 * T74;
+	       T75 = T62 - T63;
+	       T76 = T5R - T5Y;
+	       O[WS(os, 23)] = KP1_111140466 * T75 - KP1_662939224 * T76;
+	       T77 = T5K - T5N;
+	       T78 = T5z - T5G;
+	       O[WS(os, 24)] = KP1_635169626 * T77 + KP1_151616382 * T78;
+	       T79 = T5s - T5v;
+	       T7a = T5h - T5o;
+	       O[WS(os, 25)] = KP1_606415062 * T79 + KP1_191398608 * T7a;
+	       T7b = T5a - T5d;
+	       T7c = T4Z - T56;
+	       O[WS(os, 26)] = KP1_230463181 * T7b - KP1_576692855 * T7c;
+	       T7d = T4S - T4V;
+	       T7e = T4x - T4M;
+	       O[WS(os, 27)] = KP1_268786568 * T7d - KP1_546020906 * T7e;
+	       T7f = T4i - T4l;
+	       T7g = T3V - T4a;
+	       O[WS(os, 28)] = KP1_514417693 * T7f + KP1_306345685 * T7g;
+	       T7h = T3G - T3J;
+	       T7i = T2X - T3w;
+	       O[WS(os, 29)] = KP1_343117909 * T7h - KP1_481902250 * T7i;
+	       T7j = T2s - T2v;
+	       T7k = T1z - T2g;
+	       O[WS(os, 30)] = KP1_379081089 * T7j - KP1_448494165 * T7k;
+	       T7l = T6O + T6P;
+	       T7m = T6L + T6M;
+	       O[WS(os, 31)] = KP1_414213562 * (T7l - T7m);
+	       O[WS(os, 32)] = KP1_448494165 * T7j + KP1_379081089 * T7k;
+	       O[WS(os, 33)] = KP1_481902250 * T7h + KP1_343117909 * T7i;
+	       O[WS(os, 34)] = KP1_514417693 * T7g - KP1_306345685 * T7f;
+	       O[WS(os, 35)] = KP1_546020906 * T7d + KP1_268786568 * T7e;
+	       O[WS(os, 36)] = KP1_576692855 * T7b + KP1_230463181 * T7c;
+	       O[WS(os, 37)] = KP1_606415062 * T7a - KP1_191398608 * T79;
+	       O[WS(os, 38)] = KP1_635169626 * T78 - KP1_151616382 * T77;
+	       O[WS(os, 39)] = KP1_662939224 * T75 + KP1_111140466 * T76;
+	       O[WS(os, 40)] = KP1_689707130 * T73 + KP1_069995239 * T74;
+	       O[WS(os, 41)] = KP1_715457220 * T71 + KP1_028205488 * T72;
+	       O[WS(os, 42)] = KP1_740173982 * T70 - KP985796384 * T6Z;
+	       O[WS(os, 43)] = KP1_763842528 * T6Y - KP942793473 * T6X;
+	       O[WS(os, 44)] = KP1_786448602 * T6V + KP899222659 * T6W;
+	       O[WS(os, 45)] = KP1_807978586 * T6U - KP855110186 * T6T;
+	       O[WS(os, 46)] = KP1_828419511 * T6S - KP810482628 * T6R;
+	       O[WS(os, 47)] = KP1_847759065 * T6Q - KP765366864 * T6N;
+	       O[WS(os, 48)] = KP1_865985597 * T6H + KP719790073 * T6K;
+	       O[WS(os, 49)] = KP1_883088130 * T6B + KP673779706 * T6E;
+	       O[WS(os, 50)] = KP1_899056361 * T6y - KP627363480 * T6v;
+	       O[WS(os, 51)] = KP1_913880671 * T6p + KP580569354 * T6s;
+	       O[WS(os, 52)] = KP1_927552131 * T6j + KP533425514 * T6m;
+	       O[WS(os, 53)] = KP1_940062506 * T6g - KP485960359 * T6d;
+	       O[WS(os, 54)] = KP1_951404260 * T6a - KP438202480 * T67;
+	       O[WS(os, 55)] = KP1_961570560 * T64 - KP390180644 * T5Z;
+	       O[WS(os, 56)] = KP1_970555284 * T5H + KP341923777 * T5O;
+	       O[WS(os, 57)] = KP1_978353019 * T5p + KP293460948 * T5w;
+	       O[WS(os, 58)] = KP1_984959069 * T5e - KP244821350 * T57;
+	       O[WS(os, 59)] = KP1_990369453 * T4W - KP196034280 * T4N;
+	       O[WS(os, 60)] = KP1_994580913 * T4b + KP147129127 * T4m;
+	       O[WS(os, 61)] = KP1_997590912 * T3K - KP098135348 * T3x;
+	       O[WS(os, 62)] = KP1_999397637 * T2w - KP049082457 * T2h;
+	       O[WS(os, 63)] = KP2_000000000 * (T7l + T7m);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 64, "o10_64", {456, 250, 0, 0}, &GENUS, RODFT10 };
+
+void X(codelet_o10_64) (planner *p) {
+     X(kr2r_register) (p, o10_64, &desc);
+}
+
+#endif
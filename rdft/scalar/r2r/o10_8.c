@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft10 -n 8 -name o10_8 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 27 FP additions, 17 FP multiplications,
+ * (or, 19 additions, 9 multiplications, 8 fused multiply/add),
+ * 25 stack variables, 9 constants, and 16 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o10_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(16, is), MAKE_VOLATILE_STRIDE(16, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = T1 + T8;
+	       Ta = KP707106781 * (T2 + T7);
+	       Tb = FMS(KP707106781, T3 + T6, Ta);
+	       Tc = T9 + Tb;
+	       Td = T4 + T5;
+	       Te = FMA(KP707106781, T3 + T6, Ta);
+	       Tf = Td + Te;
+	       O[0] = FMA(KP1_961570560, Tf, KP390180644 * Tc);
+	       Tg = T1 - T8;
+	       Th = T4 - T5;
+	       Ti = Tg + Th;
+	       Tj = T3 - T6;
+	       Tk = T2 - T7;
+	       Tl = Tj + Tk;
+	       O[WS(os, 1)] = FMA(KP1_847759065, Tl, KP765366864 * Ti);
+	       Tm = Td - Te;
+	       Tn = T9 - Tb;
+	       O[WS(os, 2)] = FMS(KP1_111140466, Tn, KP1_662939224 * Tm);
+	       To = Tg - Th;
+	       Tp = Tj - Tk;
+	       O[WS(os, 3)] = KP1_414213562 * (To - Tp);
+	       O[WS(os, 4)] = FMA(KP1_662939224, Tn, KP1_111140466 * Tm);
+	       O[WS(os, 5)] = FMS(KP1_847759065, Ti, KP765366864 * Tl);
+	       O[WS(os, 6)] = FMS(KP1_961570560, Tc, KP390180644 * Tf);
+	       O[WS(os, 7)] = KP2_000000000 * (To + Tp);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 8, "o10_8", {19, 9, 8, 0}, &GENUS, RODFT10 };
+
+void X(codelet_o10_8) (planner *p) {
+     X(kr2r_register) (p, o10_8, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft10 -n 8 -name o10_8 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 26 FP additions, 16 FP multiplications,
+ * (or, 26 additions, 16 multiplications, 0 fused multiply/add),
+ * 26 stack variables, 9 constants, and 16 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o10_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(16, is), MAKE_VOLATILE_STRIDE(16, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = T4 + T5;
+	       Ta = KP707106781 * (T3 + T6);
+	       Tb = KP707106781 * (T2 + T7);
+	       Tc = Ta + Tb;
+	       Td = T9 + Tc;
+	       Te = T1 + T8;
+	       Tf = Ta - Tb;
+	       Tg = Te + Tf;
+	       O[0] = KP1_961570560 * Td + KP390180644 * Tg;
+	       Th = T3 - T6;
+	       Ti = T2 - T7;
+	       Tj = Th + Ti;
+	       Tk = T1 - T8;
+	       Tl = T4 - T5;
+	       Tm = Tk + Tl;
+	       O[WS(os, 1)] = KP1_847759065 * Tj + KP765366864 * Tm;
+	       Tn = Te - Tf;
+	       To = T9 - Tc;
+	       O[WS(os, 2)] = KP1_111140466 * Tn - KP1_662939224 * To;
+	       Tp = Tk - Tl;
+	       Tq = Th - Ti;
+	       O[WS(os, 3)] = KP1_414213562 * (Tp - Tq);
+	       O[WS(os, 4)] = KP1_662939224 * Tn + KP1_111140466 * To;
+	       O[WS(os, 5)] = KP1_847759065 * Tm - KP765366864 * Tj;
+	       O[WS(os, 6)] = KP1_961570560 * Tg - KP390180644 * Td;
+	       O[WS(os, 7)] = KP2_000000000 * (Tp + Tq);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 8, "o10_8", {26, 16, 0, 0}, &GENUS, RODFT10 };
+
+void X(codelet_o10_8) (planner *p) {
+     X(kr2r_register) (p, o10_8, &desc);
+}
+
+#endif
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft11 -n 12 -name o11_12 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 70 FP additions, 66 FP multiplications,
+ * (or, 28 additions, 24 multiplications, 42 fused multiply/add),
+ * 56 stack variables, 17 constants, and 24 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o11_12(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP130806258, +0.130806258460286133630631117550350882881264608);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP258819045, +0.258819045102520762348898837624048328349068901);
+     DK(KP965925826, +0.965925826289068286749743199728897367633904839);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP1_995717846, +1.995717846477207013476139582545555209063732793);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP642878930, +0.642878930606323161402115248157803172116928916);
+     DK(KP1_893860258, +1.893860258990211328511608549707967367397665667);
+     DK(KP1_793745483, +1.793745483065376607788207872786162396358386232);
+     DK(KP884577380, +0.884577380438002563990477954648489460313858411);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_503679614, +1.503679614957954792815038812753922885542282431);
+     DK(KP1_318691630, +1.318691630200137736850249224110674901830938546);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(24, is), MAKE_VOLATILE_STRIDE(24, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = FMS(KP866025403, T5, KP500000000 * T8);
+	       Te = FMS(KP500000000, T9, KP866025403 * T4);
+	       Tf = Td + Te;
+	       Tg = T1 + Tf;
+	       Th = FMS(KP965925826, T3, KP258819045 * Ta);
+	       Ti = FMS(KP258819045, Tb, KP965925826 * T2);
+	       Tj = FMS(KP707106781, T6 - T7, Ti);
+	       Tk = Th - Tj;
+	       Tl = Tg + Tk;
+	       Tm = FMA(KP866025403, T8, KP500000000 * T5);
+	       Tn = FMA(KP500000000, T4, KP866025403 * T9);
+	       To = Tm + Tn;
+	       Tp = Tc + To;
+	       Tq = FMA(KP965925826, Ta, KP258819045 * T3);
+	       Tr = FMA(KP258819045, T2, KP965925826 * Tb);
+	       Ts = FMA(KP707106781, T6 + T7, Tr);
+	       Tt = Tq + Ts;
+	       Tu = Tp + Tt;
+	       O[0] = FMA(KP1_995717846, Tu, KP130806258 * Tl);
+	       Tv = FNMS(KP500000000, To, Tc);
+	       Tw = FNMS(KP866025403, Td - Te, Tv);
+	       Tx = FMA(KP500000000, Tj, Th);
+	       Ty = FMA(KP866025403, FMS(KP707106781, T6 + T7, Tr), Tx);
+	       Tz = FNMS(KP500000000, Ts, Tq);
+	       TA = FMA(KP866025403, FMA(KP707106781, T6 - T7, Ti), Tz);
+	       TB = FMS(KP500000000, TA, KP866025403 * Ty);
+	       TC = Tw + TB;
+	       TD = FNMS(KP500000000, Tf, T1);
+	       TE = FMA(KP866025403, Tm - Tn, TD);
+	       TF = FMA(KP500000000, Ty, KP866025403 * TA);
+	       TG = TE + TF;
+	       O[WS(os, 1)] = FMS(KP390180644, TG, KP1_961570560 * TC);
+	       TH = FNMS(KP866025403, Tm - Tn, TD);
+	       TI = FNMS(KP866025403, FMA(KP707106781, T6 - T7, Ti), Tz);
+	       TJ = FNMS(KP866025403, FMS(KP707106781, T6 + T7, Tr), Tx);
+	       TK = FMS(KP500000000, TJ, KP866025403 * TI);
+	       TL = TH + TK;
+	       TM = FMA(KP866025403, Td - Te, Tv);
+	       TN = FMA(KP500000000, TI, KP866025403 * TJ);
+	       TO = TM + TN;
+	       O[WS(os, 2)] = FMA(KP1_893860258, TO, KP642878930 * TL);
+	       TP = TM - TN;
+	       TQ = TH - TK;
+	       O[WS(os, 3)] = FMS(KP884577380, TQ, KP1_793745483 * TP);
+	       TR = TE - TF;
+	       TS = Tw - TB;
+	       O[WS(os, 4)] = FMA(KP1_662939224, TS, KP1_111140466 * TR);
+	       TT = Tp - Tt;
+	       TU = Tg - Tk;
+	       O[WS(os, 5)] = FMS(KP1_318691630, TU, KP1_503679614 * TT);
+	       O[WS(os, 6)] = FMA(KP1_318691630, TT, KP1_503679614 * TU);
+	       O[WS(os, 7)] = FMS(KP1_662939224, TR, KP1_111140466 * TS);
+	       O[WS(os, 8)] = FMA(KP884577380, TP, KP1_793745483 * TQ);
+	       O[WS(os, 9)] = FMS(KP1_893860258, TL, KP642878930 * TO);
+	       O[WS(os, 10)] = FMA(KP390180644, TC, KP1_961570560 * TG);
+	       O[WS(os, 11)] = FMS(KP1_995717846, Tl, KP130806258 * Tu);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 12, "o11_12", {28, 24, 42, 0}, &GENUS, RODFT11 };
+
+void X(codelet_o11_12) (planner *p) {
+     X(kr2r_register) (p, o11_12, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft11 -n 12 -name o11_12 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 62 FP additions, 58 FP multiplications,
+ * (or, 62 additions, 58 multiplications, 0 fused multiply/add),
+ * 62 stack variables, 17 constants, and 24 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o11_12(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_995717846, +1.995717846477207013476139582545555209063732793);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP965925826, +0.965925826289068286749743199728897367633904839);
+     DK(KP258819045, +0.258819045102520762348898837624048328349068901);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP130806258, +0.130806258460286133630631117550350882881264608);
+     DK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DK(KP1_893860258, +1.893860258990211328511608549707967367397665667);
+     DK(KP642878930, +0.642878930606323161402115248157803172116928916);
+     DK(KP884577380, +0.884577380438002563990477954648489460313858411);
+     DK(KP1_793745483, +1.793745483065376607788207872786162396358386232);
+     DK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DK(KP1_318691630, +1.318691630200137736850249224110674901830938546);
+     DK(KP1_503679614, +1.503679614957954792815038812753922885542282431);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(24, is), MAKE_VOLATILE_STRIDE(24, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = KP866025403 * T8 + KP500000000 * T5;
+	       Te = KP500000000 * T4 + KP866025403 * T9;
+	       Tf = Td + Te;
+	       Tg = Tc + Tf;
+	       Th = KP965925826 * Ta + KP258819045 * T3;
+	       Ti = KP707106781 * (T6 + T7);
+	       Tj = KP258819045 * T2 + KP965925826 * Tb;
+	       Tk = Ti + Tj;
+	       Tl = Th + Tk;
+	       Tm = Tg + Tl;
+	       Tn = KP866025403 * T5 - KP500000000 * T8;
+	       To = KP500000000 * T9 - KP866025403 * T4;
+	       Tp = Tn + To;
+	       Tq = T1 + Tp;
+	       Tr = KP965925826 * T3 - KP258819045 * Ta;
+	       Ts = KP707106781 * (T6 - T7);
+	       Tt = KP258819045 * Tb - KP965925826 * T2;
+	       Tu = Ts - Tt;
+	       Tv = Tr - Tu;
+	       Tw = Tq + Tv;
+	       O[0] = KP1_995717846 * Tm + KP130806258 * Tw;
+	       Tx = T1 - KP500000000 * Tp;
+	       Ty = KP866025403 * (Td - Te);
+	       Tz = Tx + Ty;
+	       TA = Tr + KP500000000 * Tu;
+	       TB = KP866025403 * (Ti - Tj);
+	       TC = TA + TB;
+	       TD = Th - KP500000000 * Tk;
+	       TE = KP866025403 * (Ts + Tt);
+	       TF = TD + TE;
+	       TG = KP500000000 * TC + KP866025403 * TF;
+	       TH = Tz + TG;
+	       TI = Tc - KP500000000 * Tf;
+	       TJ = KP866025403 * (Tn - To);
+	       TK = TI - TJ;
+	       TL = KP500000000 * TF - KP866025403 * TC;
+	       TM = TK + TL;
+	       O[WS(os, 1)] = KP390180644 * TH - KP1_961570560 * TM;
+	       TN = TI + TJ;
+	       TO = TD - TE;
+	       TP = TA - TB;
+	       TQ = KP500000000 * TO + KP866025403 * TP;
+	       TR = TN + TQ;
+	       TS = Tx - Ty;
+	       TT = KP500000000 * TP - KP866025403 * TO;
+	       TU = TS + TT;
+	       O[WS(os, 2)] = KP1_893860258 * TR + KP642878930 * TU;
+	       TV = TS - TT;
+	       TW = TN - TQ;
+	       O[WS(os, 3)] = KP884577380 * TV - KP1_793745483 * TW;
+	       TX = TK - TL;
+	       TY = Tz - TG;
+	       O[WS(os, 4)] = KP1_662939224 * TX + KP1_111140466 * TY;
+	       TZ = Tq - Tv;
+	       T10 = Tg - Tl;
+	       O[WS(os, 5)] = KP1_318691630 * TZ - KP1_503679614 * T10;
+	       O[WS(os, 6)] = KP1_318691630 * T10 + KP1_503679614 * TZ;
+	       O[WS(os, 7)] = KP1_662939224 * TY - KP1_111140466 * TX;
+	       O[WS(os, 8)] = KP884577380 * TW + KP1_793745483 * TV;
+	       O[WS(os, 9)] = KP1_893860258 * TU - KP642878930 * TR;
+	       O[WS(os, 10)] = KP390180644 * TM + KP1_961570560 * TH;
+	       O[WS(os, 11)] = KP1_995717846 * Tw - KP130806258 * Tm;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 12, "o11_12", {62, 58, 0, 0}, &GENUS, RODFT11 };
+
+void X(codelet_o11_12) (planner *p) {
+     X(kr2r_register) (p, o11_12, &desc);
+}
+
+#endif
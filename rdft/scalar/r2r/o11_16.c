@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft11 -n 16 -name o11_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 86 FP additions, 66 FP multiplications,
+ * (or, 50 additions, 30 multiplications, 36 fused multiply/add),
+ * 78 stack variables, 23 constants, and 32 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o11_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = FNMS(KP707106781, T8 - T9, T1);
+	       Ti = FMS(KP923879532, T5, KP382683432 * Tc);
+	       Tj = FMS(KP382683432, Td, KP923879532 * T4);
+	       Tk = Ti + Tj;
+	       Tl = Th + Tk;
+	       Tm = FMS(KP980785280, T3, KP195090322 * Te);
+	       Tn = FMS(KP555570233, Tb, KP831469612 * T6);
+	       To = Tm + Tn;
+	       Tp = FMS(KP831469612, T7, KP555570233 * Ta);
+	       Tq = FMS(KP195090322, Tf, KP980785280 * T2);
+	       Tr = Tp + Tq;
+	       Ts = To + Tr;
+	       Tt = Tl + Ts;
+	       Tu = FMA(KP707106781, T8 + T9, Tg);
+	       Tv = FMA(KP923879532, Tc, KP382683432 * T5);
+	       Tw = FMA(KP382683432, T4, KP923879532 * Td);
+	       Tx = Tv + Tw;
+	       Ty = Tu + Tx;
+	       Tz = FMA(KP980785280, Te, KP195090322 * T3);
+	       TA = FMA(KP555570233, T6, KP831469612 * Tb);
+	       TB = Tz + TA;
+	       TC = FMA(KP831469612, Ta, KP555570233 * T7);
+	       TD = FMA(KP195090322, T2, KP980785280 * Tf);
+	       TE = TC + TD;
+	       TF = TB + TE;
+	       TG = Ty + TF;
+	       O[0] = FMA(KP1_997590912, TG, KP098135348 * Tt);
+	       TH = FNMS(KP707106781, T8 + T9, Tg);
+	       TI = Ti - Tj;
+	       TJ = TH - TI;
+	       TK = Tp - Tq;
+	       TL = TC - TD;
+	       TM = KP707106781 * (TK + TL);
+	       TN = Tm - Tn;
+	       TO = Tz - TA;
+	       TP = FMA(KP707106781, TN - TO, TM);
+	       TQ = TJ - TP;
+	       TR = FMA(KP707106781, T8 - T9, T1);
+	       TS = Tv - Tw;
+	       TT = TR + TS;
+	       TU = KP707106781 * (TK - TL);
+	       TV = FMS(KP707106781, TN + TO, TU);
+	       TW = TT + TV;
+	       O[WS(os, 1)] = FMS(KP293460948, TW, KP1_978353019 * TQ);
+	       TX = TR - TS;
+	       TY = FMS(KP707106781, TN - TO, TM);
+	       TZ = TX + TY;
+	       T10 = TH + TI;
+	       T11 = FMA(KP707106781, TN + TO, TU);
+	       T12 = T10 + T11;
+	       O[WS(os, 2)] = FMA(KP1_940062506, T12, KP485960359 * TZ);
+	       T13 = Tu - Tx;
+	       T14 = To - Tr;
+	       T15 = T13 - T14;
+	       T16 = Th - Tk;
+	       T17 = TB - TE;
+	       T18 = T16 + T17;
+	       O[WS(os, 3)] = FMS(KP673779706, T18, KP1_883088130 * T15);
+	       T19 = T16 - T17;
+	       T1a = T13 + T14;
+	       O[WS(os, 4)] = FMA(KP1_807978586, T1a, KP855110186 * T19);
+	       T1b = T10 - T11;
+	       T1c = TX - TY;
+	       O[WS(os, 5)] = FMS(KP1_028205488, T1c, KP1_715457220 * T1b);
+	       T1d = TT - TV;
+	       T1e = TJ + TP;
+	       O[WS(os, 6)] = FMA(KP1_606415062, T1e, KP1_191398608 * T1d);
+	       T1f = Ty - TF;
+	       T1g = Tl - Ts;
+	       O[WS(os, 7)] = FMS(KP1_343117909, T1g, KP1_481902250 * T1f);
+	       O[WS(os, 8)] = FMA(KP1_343117909, T1f, KP1_481902250 * T1g);
+	       O[WS(os, 9)] = FMS(KP1_606415062, T1d, KP1_191398608 * T1e);
+	       O[WS(os, 10)] = FMA(KP1_028205488, T1b, KP1_715457220 * T1c);
+	       O[WS(os, 11)] = FMS(KP1_807978586, T19, KP855110186 * T1a);
+	       O[WS(os, 12)] = FMA(KP673779706, T15, KP1_883088130 * T18);
+	       O[WS(os, 13)] = FMS(KP1_940062506, TZ, KP485960359 * T12);
+	       O[WS(os, 14)] = FMA(KP293460948, TQ, KP1_978353019 * TW);
+	       O[WS(os, 15)] = FMS(KP1_997590912, Tt, KP098135348 * TG);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 16, "o11_16", {50, 30, 36, 0}, &GENUS, RODFT11 };
+
+void X(codelet_o11_16) (planner *p) {
+     X(kr2r_register) (p, o11_16, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft11 -n 16 -name o11_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 82 FP additions, 62 FP multiplications,
+ * (or, 82 additions, 62 multiplications, 0 fused multiply/add),
+ * 82 stack variables, 23 constants, and 32 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o11_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = KP707106781 * (T8 + T9);
+	       Ti = Tg + Th;
+	       Tj = KP923879532 * Tc + KP382683432 * T5;
+	       Tk = KP382683432 * T4 + KP923879532 * Td;
+	       Tl = Tj + Tk;
+	       Tm = Ti + Tl;
+	       Tn = KP980785280 * Te + KP195090322 * T3;
+	       To = KP555570233 * T6 + KP831469612 * Tb;
+	       Tp = Tn + To;
+	       Tq = KP831469612 * Ta + KP555570233 * T7;
+	       Tr = KP195090322 * T2 + KP980785280 * Tf;
+	       Ts = Tq + Tr;
+	       Tt = Tp + Ts;
+	       Tu = Tm + Tt;
+	       Tv = KP707106781 * (T8 - T9);
+	       Tw = T1 - Tv;
+	       Tx = KP923879532 * T5 - KP382683432 * Tc;
+	       Ty = KP382683432 * Td - KP923879532 * T4;
+	       Tz = Tx + Ty;
+	       TA = Tw + Tz;
+	       TB = KP980785280 * T3 - KP195090322 * Te;
+	       TC = KP555570233 * Tb - KP831469612 * T6;
+	       TD = TB + TC;
+	       TE = KP831469612 * T7 - KP555570233 * Ta;
+	       TF = KP195090322 * Tf - KP980785280 * T2;
+	       TG = TE + TF;
+	       TH = TD + TG;
+	       TI = TA + TH;
+	       O[0] = KP1_997590912 * Tu + KP098135348 * TI;
+	       TJ = T1 + Tv;
+	       TK = Tj - Tk;
+	       TL = TJ + TK;
+	       TM = TB - TC;
+	       TN = Tn - To;
+	       TO = KP707106781 * (TM + TN);
+	       TP = TE - TF;
+	       TQ = Tq - Tr;
+	       TR = KP707106781 * (TP - TQ);
+	       TS = TO - TR;
+	       TT = TL + TS;
+	       TU = Tg - Th;
+	       TV = Tx - Ty;
+	       TW = TU - TV;
+	       TX = KP707106781 * (TM - TN);
+	       TY = KP707106781 * (TP + TQ);
+	       TZ = TX + TY;
+	       T10 = TW - TZ;
+	       O[WS(os, 1)] = KP293460948 * TT - KP1_978353019 * T10;
+	       T11 = TU + TV;
+	       T12 = TO + TR;
+	       T13 = T11 + T12;
+	       T14 = TJ - TK;
+	       T15 = TX - TY;
+	       T16 = T14 + T15;
+	       O[WS(os, 2)] = KP1_940062506 * T13 + KP485960359 * T16;
+	       T17 = Tw - Tz;
+	       T18 = Tp - Ts;
+	       T19 = T17 + T18;
+	       T1a = Ti - Tl;
+	       T1b = TD - TG;
+	       T1c = T1a - T1b;
+	       O[WS(os, 3)] = KP673779706 * T19 - KP1_883088130 * T1c;
+	       T1d = T1a + T1b;
+	       T1e = T17 - T18;
+	       O[WS(os, 4)] = KP1_807978586 * T1d + KP855110186 * T1e;
+	       T1f = T14 - T15;
+	       T1g = T11 - T12;
+	       O[WS(os, 5)] = KP1_028205488 * T1f - KP1_715457220 * T1g;
+	       T1h = TW + TZ;
+	       T1i = TL - TS;
+	       O[WS(os, 6)] = KP1_606415062 * T1h + KP1_191398608 * T1i;
+	       T1j = TA - TH;
+	       T1k = Tm - Tt;
+	       O[WS(os, 7)] = KP1_343117909 * T1j - KP1_481902250 * T1k;
+	       O[WS(os, 8)] = KP1_343117909 * T1k + KP1_481902250 * T1j;
+	       O[WS(os, 9)] = KP1_606415062 * T1i - KP1_191398608 * T1h;
+	       O[WS(os, 10)] = KP1_028205488 * T1g + KP1_715457220 * T1f;
+	       O[WS(os, 11)] = KP1_807978586 * T1e - KP855110186 * T1d;
+	       O[WS(os, 12)] = KP673779706 * T1c + KP1_883088130 * T19;
+	       O[WS(os, 13)] = KP1_940062506 * T16 - KP485960359 * T13;
+	       O[WS(os, 14)] = KP293460948 * T10 + KP1_978353019 * TT;
+	       O[WS(os, 15)] = KP1_997590912 * TI - KP098135348 * Tu;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 16, "o11_16", {82, 62, 0, 0}, &GENUS, RODFT11 };
+
+void X(codelet_o11_16) (planner *p) {
+     X(kr2r_register) (p, o11_16, &desc);
+}
+
+#endif
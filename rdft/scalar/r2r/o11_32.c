@@ -0,0 +1,680 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft11 -n 32 -name o11_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 212 FP additions, 152 FP multiplications,
+ * (or, 132 additions, 72 multiplications, 80 fused multiply/add),
+ * 200 stack variables, 47 constants, and 64 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o11_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       E T37, T38, T39, T3a, T3b, T3c, T3d, T3e;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = FNMS(KP707106781, Tg - Th, T1);
+	       Ty = FMS(KP923879532, T9, KP382683432 * To);
+	       Tz = FMS(KP382683432, Tp, KP923879532 * T8);
+	       TA = Ty + Tz;
+	       TB = Tx + TA;
+	       TC = FMS(KP980785280, T5, KP195090322 * Ts);
+	       TD = FMS(KP555570233, Tl, KP831469612 * Tc);
+	       TE = TC + TD;
+	       TF = FMS(KP831469612, Td, KP555570233 * Tk);
+	       TG = FMS(KP195090322, Tt, KP980785280 * T4);
+	       TH = TF + TG;
+	       TI = TE + TH;
+	       TJ = TB + TI;
+	       TK = FMS(KP995184726, T3, KP098017140 * Tu);
+	       TL = FMS(KP634393284, Tj, KP773010453 * Te);
+	       TM = TK + TL;
+	       TN = FMS(KP881921264, Tb, KP471396736 * Tm);
+	       TO = FMS(KP290284677, Tr, KP956940335 * T6);
+	       TP = TN + TO;
+	       TQ = TM + TP;
+	       TR = FMS(KP956940335, T7, KP290284677 * Tq);
+	       TS = FMS(KP471396736, Tn, KP881921264 * Ta);
+	       TT = TR + TS;
+	       TU = FMS(KP773010453, Tf, KP634393284 * Ti);
+	       TV = FMS(KP098017140, Tv, KP995184726 * T2);
+	       TW = TU + TV;
+	       TX = TT + TW;
+	       TY = TQ + TX;
+	       TZ = TJ + TY;
+	       T10 = FMA(KP707106781, Tg + Th, Tw);
+	       T11 = FMA(KP923879532, To, KP382683432 * T9);
+	       T12 = FMA(KP382683432, T8, KP923879532 * Tp);
+	       T13 = T11 + T12;
+	       T14 = T10 + T13;
+	       T15 = FMA(KP980785280, Ts, KP195090322 * T5);
+	       T16 = FMA(KP555570233, Tc, KP831469612 * Tl);
+	       T17 = T15 + T16;
+	       T18 = FMA(KP831469612, Tk, KP555570233 * Td);
+	       T19 = FMA(KP195090322, T4, KP980785280 * Tt);
+	       T1a = T18 + T19;
+	       T1b = T17 + T1a;
+	       T1c = T14 + T1b;
+	       T1d = FMA(KP995184726, Tu, KP098017140 * T3);
+	       T1e = FMA(KP634393284, Te, KP773010453 * Tj);
+	       T1f = T1d + T1e;
+	       T1g = FMA(KP881921264, Tm, KP471396736 * Tb);
+	       T1h = FMA(KP290284677, T6, KP956940335 * Tr);
+	       T1i = T1g + T1h;
+	       T1j = T1f + T1i;
+	       T1k = FMA(KP956940335, Tq, KP290284677 * T7);
+	       T1l = FMA(KP471396736, Ta, KP881921264 * Tn);
+	       T1m = T1k + T1l;
+	       T1n = FMA(KP773010453, Ti, KP634393284 * Tf);
+	       T1o = FMA(KP098017140, T2, KP995184726 * Tv);
+	       T1p = T1n + T1o;
+	       T1q = T1m + T1p;
+	       T1r = T1j + T1q;
+	       T1s = T1c + T1r;
+	       O[0] = FMA(KP1_999397637, T1s, KP049082457 * TZ);
+	       T1t = FNMS(KP707106781, Tg + Th, Tw);
+	       T1u = Ty - Tz;
+	       T1v = T1t - T1u;
+	       T1w = TF - TG;
+	       T1x = T18 - T19;
+	       T1y = KP707106781 * (T1w + T1x);
+	       T1z = TC - TD;
+	       T1A = T15 - T16;
+	       T1B = FMA(KP707106781, T1z - T1A, T1y);
+	       T1C = T1v - T1B;
+	       T1D = T1d - T1e;
+	       T1E = TN - TO;
+	       T1F = T1D - T1E;
+	       T1G = TK - TL;
+	       T1H = T1g - T1h;
+	       T1I = T1G + T1H;
+	       T1J = FMS(KP382683432, T1I, KP923879532 * T1F);
+	       T1K = T1k - T1l;
+	       T1L = TU - TV;
+	       T1M = T1K - T1L;
+	       T1N = TR - TS;
+	       T1O = T1n - T1o;
+	       T1P = T1N + T1O;
+	       T1Q = FMS(KP923879532, T1P, KP382683432 * T1M);
+	       T1R = T1J + T1Q;
+	       T1S = T1C - T1R;
+	       T1T = FMA(KP707106781, Tg - Th, T1);
+	       T1U = T11 - T12;
+	       T1V = T1T + T1U;
+	       T1W = KP707106781 * (T1w - T1x);
+	       T1X = FMS(KP707106781, T1z + T1A, T1W);
+	       T1Y = T1V + T1X;
+	       T1Z = FMA(KP382683432, T1F, KP923879532 * T1I);
+	       T20 = FMA(KP923879532, T1M, KP382683432 * T1P);
+	       T21 = T1Z + T20;
+	       T22 = T1Y + T21;
+	       O[WS(os, 1)] = FMS(KP147129127, T22, KP1_994580913 * T1S);
+	       T23 = T1T - T1U;
+	       T24 = FMS(KP707106781, T1z - T1A, T1y);
+	       T25 = T23 + T24;
+	       T26 = T1D + T1E;
+	       T27 = T1G - T1H;
+	       T28 = FMS(KP923879532, T27, KP382683432 * T26);
+	       T29 = T1K + T1L;
+	       T2a = T1N - T1O;
+	       T2b = FMS(KP382683432, T2a, KP923879532 * T29);
+	       T2c = T28 + T2b;
+	       T2d = T25 + T2c;
+	       T2e = T1t + T1u;
+	       T2f = FMA(KP707106781, T1z + T1A, T1W);
+	       T2g = T2e + T2f;
+	       T2h = FMA(KP923879532, T26, KP382683432 * T27);
+	       T2i = FMA(KP382683432, T29, KP923879532 * T2a);
+	       T2j = T2h + T2i;
+	       T2k = T2g + T2j;
+	       O[WS(os, 2)] = FMA(KP1_984959069, T2k, KP244821350 * T2d);
+	       T2l = T10 - T13;
+	       T2m = TE - TH;
+	       T2n = T2l - T2m;
+	       T2o = TT - TW;
+	       T2p = T1m - T1p;
+	       T2q = KP707106781 * (T2o + T2p);
+	       T2r = TM - TP;
+	       T2s = T1f - T1i;
+	       T2t = FMA(KP707106781, T2r - T2s, T2q);
+	       T2u = T2n - T2t;
+	       T2v = Tx - TA;
+	       T2w = T17 - T1a;
+	       T2x = T2v + T2w;
+	       T2y = KP707106781 * (T2o - T2p);
+	       T2z = FMS(KP707106781, T2r + T2s, T2y);
+	       T2A = T2x + T2z;
+	       O[WS(os, 3)] = FMS(KP341923777, T2A, KP1_970555284 * T2u);
+	       T2B = T2v - T2w;
+	       T2C = FMS(KP707106781, T2r - T2s, T2q);
+	       T2D = T2B + T2C;
+	       T2E = T2l + T2m;
+	       T2F = FMA(KP707106781, T2r + T2s, T2y);
+	       T2G = T2E + T2F;
+	       O[WS(os, 4)] = FMA(KP1_951404260, T2G, KP438202480 * T2D);
+	       T2H = T2e - T2f;
+	       T2I = T28 - T2b;
+	       T2J = T2H - T2I;
+	       T2K = T23 - T24;
+	       T2L = T2h - T2i;
+	       T2M = T2K + T2L;
+	       O[WS(os, 5)] = FMS(KP533425514, T2M, KP1_927552131 * T2J);
+	       T2N = T1V - T1X;
+	       T2O = T1J - T1Q;
+	       T2P = T2N + T2O;
+	       T2Q = T1v + T1B;
+	       T2R = T1Z - T20;
+	       T2S = T2Q + T2R;
+	       O[WS(os, 6)] = FMA(KP1_899056361, T2S, KP627363480 * T2P);
+	       T2T = T14 - T1b;
+	       T2U = TQ - TX;
+	       T2V = T2T - T2U;
+	       T2W = TB - TI;
+	       T2X = T1j - T1q;
+	       T2Y = T2W + T2X;
+	       O[WS(os, 7)] = FMS(KP719790073, T2Y, KP1_865985597 * T2V);
+	       T2Z = T2W - T2X;
+	       T30 = T2T + T2U;
+	       O[WS(os, 8)] = FMA(KP1_828419511, T30, KP810482628 * T2Z);
+	       T31 = T2Q - T2R;
+	       T32 = T2N - T2O;
+	       O[WS(os, 9)] = FMS(KP899222659, T32, KP1_786448602 * T31);
+	       T33 = T2K - T2L;
+	       T34 = T2H + T2I;
+	       O[WS(os, 10)] = FMA(KP1_740173982, T34, KP985796384 * T33);
+	       T35 = T2E - T2F;
+	       T36 = T2B - T2C;
+	       O[WS(os, 11)] = FMS(KP1_069995239, T36, KP1_689707130 * T35);
+	       T37 = T2x - T2z;
+	       T38 = T2n + T2t;
+	       O[WS(os, 12)] = FMA(KP1_635169626, T38, KP1_151616382 * T37);
+	       T39 = T2g - T2j;
+	       T3a = T25 - T2c;
+	       O[WS(os, 13)] = FMS(KP1_230463181, T3a, KP1_576692855 * T39);
+	       T3b = T1Y - T21;
+	       T3c = T1C + T1R;
+	       O[WS(os, 14)] = FMA(KP1_514417693, T3c, KP1_306345685 * T3b);
+	       T3d = T1c - T1r;
+	       T3e = TJ - TY;
+	       O[WS(os, 15)] = FMS(KP1_379081089, T3e, KP1_448494165 * T3d);
+	       O[WS(os, 16)] = FMA(KP1_379081089, T3d, KP1_448494165 * T3e);
+	       O[WS(os, 17)] = FMS(KP1_514417693, T3b, KP1_306345685 * T3c);
+	       O[WS(os, 18)] = FMA(KP1_230463181, T39, KP1_576692855 * T3a);
+	       O[WS(os, 19)] = FMS(KP1_635169626, T37, KP1_151616382 * T38);
+	       O[WS(os, 20)] = FMA(KP1_069995239, T35, KP1_689707130 * T36);
+	       O[WS(os, 21)] = FMS(KP1_740173982, T33, KP985796384 * T34);
+	       O[WS(os, 22)] = FMA(KP899222659, T31, KP1_786448602 * T32);
+	       O[WS(os, 23)] = FMS(KP1_828419511, T2Z, KP810482628 * T30);
+	       O[WS(os, 24)] = FMA(KP719790073, T2V, KP1_865985597 * T2Y);
+	       O[WS(os, 25)] = FMS(KP1_899056361, T2P, KP627363480 * T2S);
+	       O[WS(os, 26)] = FMA(KP533425514, T2J, KP1_927552131 * T2M);
+	       O[WS(os, 27)] = FMS(KP1_951404260, T2D, KP438202480 * T2G);
+	       O[WS(os, 28)] = FMA(KP341923777, T2u, KP1_970555284 * T2A);
+	       O[WS(os, 29)] = FMS(KP1_984959069, T2d, KP244821350 * T2k);
+	       O[WS(os, 30)] = FMA(KP147129127, T1S, KP1_994580913 * T22);
+	       O[WS(os, 31)] = FMS(KP1_999397637, TZ, KP049082457 * T1s);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 32, "o11_32", {132, 72, 80, 0}, &GENUS, RODFT11 };
+
+void X(codelet_o11_32) (planner *p) {
+     X(kr2r_register) (p, o11_32, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft11 -n 32 -name o11_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 206 FP additions, 146 FP multiplications,
+ * (or, 206 additions, 146 multiplications, 0 fused multiply/add),
+ * 206 stack variables, 47 constants, and 64 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o11_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       E Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       E TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       E TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       E TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       E T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       E T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       E T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       E T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       E T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       E T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       E T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       E T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       E T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       E T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       E T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       E T3j, T3k;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = I[WS(is, 6)];
+	       T8 = I[WS(is, 7)];
+	       T9 = I[WS(is, 8)];
+	       Ta = I[WS(is, 9)];
+	       Tb = I[WS(is, 10)];
+	       Tc = I[WS(is, 11)];
+	       Td = I[WS(is, 12)];
+	       Te = I[WS(is, 13)];
+	       Tf = I[WS(is, 14)];
+	       Tg = I[WS(is, 15)];
+	       Th = I[WS(is, 16)];
+	       Ti = I[WS(is, 17)];
+	       Tj = I[WS(is, 18)];
+	       Tk = I[WS(is, 19)];
+	       Tl = I[WS(is, 20)];
+	       Tm = I[WS(is, 21)];
+	       Tn = I[WS(is, 22)];
+	       To = I[WS(is, 23)];
+	       Tp = I[WS(is, 24)];
+	       Tq = I[WS(is, 25)];
+	       Tr = I[WS(is, 26)];
+	       Ts = I[WS(is, 27)];
+	       Tt = I[WS(is, 28)];
+	       Tu = I[WS(is, 29)];
+	       Tv = I[WS(is, 30)];
+	       Tw = I[WS(is, 31)];
+	       Tx = KP707106781 * (Tg + Th);
+	       Ty = Tw + Tx;
+	       Tz = KP923879532 * To + KP382683432 * T9;
+	       TA = KP382683432 * T8 + KP923879532 * Tp;
+	       TB = Tz + TA;
+	       TC = Ty + TB;
+	       TD = KP980785280 * Ts + KP195090322 * T5;
+	       TE = KP555570233 * Tc + KP831469612 * Tl;
+	       TF = TD + TE;
+	       TG = KP831469612 * Tk + KP555570233 * Td;
+	       TH = KP195090322 * T4 + KP980785280 * Tt;
+	       TI = TG + TH;
+	       TJ = TF + TI;
+	       TK = TC + TJ;
+	       TL = KP995184726 * Tu + KP098017140 * T3;
+	       TM = KP634393284 * Te + KP773010453 * Tj;
+	       TN = TL + TM;
+	       TO = KP881921264 * Tm + KP471396736 * Tb;
+	       TP = KP290284677 * T6 + KP956940335 * Tr;
+	       TQ = TO + TP;
+	       TR = TN + TQ;
+	       TS = KP956940335 * Tq + KP290284677 * T7;
+	       TT = KP471396736 * Ta + KP881921264 * Tn;
+	       TU = TS + TT;
+	       TV = KP773010453 * Ti + KP634393284 * Tf;
+	       TW = KP098017140 * T2 + KP995184726 * Tv;
+	       TX = TV + TW;
+	       TY = TU + TX;
+	       TZ = TR + TY;
+	       T10 = TK + TZ;
+	       T11 = KP707106781 * (Tg - Th);
+	       T12 = T1 - T11;
+	       T13 = KP923879532 * T9 - KP382683432 * To;
+	       T14 = KP382683432 * Tp - KP923879532 * T8;
+	       T15 = T13 + T14;
+	       T16 = T12 + T15;
+	       T17 = KP980785280 * T5 - KP195090322 * Ts;
+	       T18 = KP555570233 * Tl - KP831469612 * Tc;
+	       T19 = T17 + T18;
+	       T1a = KP831469612 * Td - KP555570233 * Tk;
+	       T1b = KP195090322 * Tt - KP980785280 * T4;
+	       T1c = T1a + T1b;
+	       T1d = T19 + T1c;
+	       T1e = T16 + T1d;
+	       T1f = KP995184726 * T3 - KP098017140 * Tu;
+	       T1g = KP634393284 * Tj - KP773010453 * Te;
+	       T1h = T1f + T1g;
+	       T1i = KP881921264 * Tb - KP471396736 * Tm;
+	       T1j = KP290284677 * Tr - KP956940335 * T6;
+	       T1k = T1i + T1j;
+	       T1l = T1h + T1k;
+	       T1m = KP956940335 * T7 - KP290284677 * Tq;
+	       T1n = KP471396736 * Tn - KP881921264 * Ta;
+	       T1o = T1m + T1n;
+	       T1p = KP773010453 * Tf - KP634393284 * Ti;
+	       T1q = KP098017140 * Tv - KP995184726 * T2;
+	       T1r = T1p + T1q;
+	       T1s = T1o + T1r;
+	       T1t = T1l + T1s;
+	       T1u = T1e + T1t;
+	       O[0] = KP1_999397637 * T10 + KP049082457 * T1u;
+	       T1v = T1 + T11;
+	       T1w = Tz - TA;
+	       T1x = T1v + T1w;
+	       T1y = T17 - T18;
+	       T1z = TD - TE;
+	       T1A = KP707106781 * (T1y + T1z);
+	       T1B = T1a - T1b;
+	       T1C = TG - TH;
+	       T1D = KP707106781 * (T1B - T1C);
+	       T1E = T1A - T1D;
+	       T1F = T1x + T1E;
+	       T1G = TL - TM;
+	       T1H = T1i - T1j;
+	       T1I = T1G - T1H;
+	       T1J = T1f - T1g;
+	       T1K = TO - TP;
+	       T1L = T1J + T1K;
+	       T1M = KP382683432 * T1I + KP923879532 * T1L;
+	       T1N = TS - TT;
+	       T1O = T1p - T1q;
+	       T1P = T1N - T1O;
+	       T1Q = T1m - T1n;
+	       T1R = TV - TW;
+	       T1S = T1Q + T1R;
+	       T1T = KP923879532 * T1P + KP382683432 * T1S;
+	       T1U = T1M + T1T;
+	       T1V = T1F + T1U;
+	       T1W = Tw - Tx;
+	       T1X = T13 - T14;
+	       T1Y = T1W - T1X;
+	       T1Z = KP707106781 * (T1y - T1z);
+	       T20 = KP707106781 * (T1B + T1C);
+	       T21 = T1Z + T20;
+	       T22 = T1Y - T21;
+	       T23 = KP382683432 * T1L - KP923879532 * T1I;
+	       T24 = KP923879532 * T1S - KP382683432 * T1P;
+	       T25 = T23 + T24;
+	       T26 = T22 - T25;
+	       O[WS(os, 1)] = KP147129127 * T1V - KP1_994580913 * T26;
+	       T27 = T1W + T1X;
+	       T28 = T1A + T1D;
+	       T29 = T27 + T28;
+	       T2a = T1G + T1H;
+	       T2b = T1J - T1K;
+	       T2c = KP923879532 * T2a + KP382683432 * T2b;
+	       T2d = T1N + T1O;
+	       T2e = T1Q - T1R;
+	       T2f = KP382683432 * T2d + KP923879532 * T2e;
+	       T2g = T2c + T2f;
+	       T2h = T29 + T2g;
+	       T2i = T1v - T1w;
+	       T2j = T1Z - T20;
+	       T2k = T2i + T2j;
+	       T2l = KP923879532 * T2b - KP382683432 * T2a;
+	       T2m = KP382683432 * T2e - KP923879532 * T2d;
+	       T2n = T2l + T2m;
+	       T2o = T2k + T2n;
+	       O[WS(os, 2)] = KP1_984959069 * T2h + KP244821350 * T2o;
+	       T2p = T12 - T15;
+	       T2q = TF - TI;
+	       T2r = T2p + T2q;
+	       T2s = T1h - T1k;
+	       T2t = TN - TQ;
+	       T2u = KP707106781 * (T2s + T2t);
+	       T2v = T1o - T1r;
+	       T2w = TU - TX;
+	       T2x = KP707106781 * (T2v - T2w);
+	       T2y = T2u - T2x;
+	       T2z = T2r + T2y;
+	       T2A = Ty - TB;
+	       T2B = T19 - T1c;
+	       T2C = T2A - T2B;
+	       T2D = KP707106781 * (T2s - T2t);
+	       T2E = KP707106781 * (T2v + T2w);
+	       T2F = T2D + T2E;
+	       T2G = T2C - T2F;
+	       O[WS(os, 3)] = KP341923777 * T2z - KP1_970555284 * T2G;
+	       T2H = T2A + T2B;
+	       T2I = T2u + T2x;
+	       T2J = T2H + T2I;
+	       T2K = T2p - T2q;
+	       T2L = T2D - T2E;
+	       T2M = T2K + T2L;
+	       O[WS(os, 4)] = KP1_951404260 * T2J + KP438202480 * T2M;
+	       T2N = T2i - T2j;
+	       T2O = T2c - T2f;
+	       T2P = T2N + T2O;
+	       T2Q = T27 - T28;
+	       T2R = T2l - T2m;
+	       T2S = T2Q - T2R;
+	       O[WS(os, 5)] = KP533425514 * T2P - KP1_927552131 * T2S;
+	       T2T = T1Y + T21;
+	       T2U = T1M - T1T;
+	       T2V = T2T + T2U;
+	       T2W = T1x - T1E;
+	       T2X = T23 - T24;
+	       T2Y = T2W + T2X;
+	       O[WS(os, 6)] = KP1_899056361 * T2V + KP627363480 * T2Y;
+	       T2Z = T16 - T1d;
+	       T30 = TR - TY;
+	       T31 = T2Z + T30;
+	       T32 = TC - TJ;
+	       T33 = T1l - T1s;
+	       T34 = T32 - T33;
+	       O[WS(os, 7)] = KP719790073 * T31 - KP1_865985597 * T34;
+	       T35 = T32 + T33;
+	       T36 = T2Z - T30;
+	       O[WS(os, 8)] = KP1_828419511 * T35 + KP810482628 * T36;
+	       T37 = T2W - T2X;
+	       T38 = T2T - T2U;
+	       O[WS(os, 9)] = KP899222659 * T37 - KP1_786448602 * T38;
+	       T39 = T2Q + T2R;
+	       T3a = T2N - T2O;
+	       O[WS(os, 10)] = KP1_740173982 * T39 + KP985796384 * T3a;
+	       T3b = T2K - T2L;
+	       T3c = T2H - T2I;
+	       O[WS(os, 11)] = KP1_069995239 * T3b - KP1_689707130 * T3c;
+	       T3d = T2C + T2F;
+	       T3e = T2r - T2y;
+	       O[WS(os, 12)] = KP1_635169626 * T3d + KP1_151616382 * T3e;
+	       T3f = T2k - T2n;
+	       T3g = T29 - T2g;
+	       O[WS(os, 13)] = KP1_230463181 * T3f - KP1_576692855 * T3g;
+	       T3h = T22 + T25;
+	       T3i = T1F - T1U;
+	       O[WS(os, 14)] = KP1_514417693 * T3h + KP1_306345685 * T3i;
+	       T3j = T1e - T1t;
+	       T3k = TK - TZ;
+	       O[WS(os, 15)] = KP1_379081089 * T3j - KP1_448494165 * T3k;
+	       O[WS(os, 16)] = KP1_379081089 * T3k + KP1_448494165 * T3j;
+	       O[WS(os, 17)] = KP1_514417693 * T3i - KP1_306345685 * T3h;
+	       O[WS(os, 18)] = KP1_230463181 * T3g + KP1_576692855 * T3f;
+	       O[WS(os, 19)] = KP1_635169626 * T3e - KP1_151616382 * T3d;
+	       O[WS(os, 20)] = KP1_069995239 * T3c + KP1_689707130 * T3b;
+	       O[WS(os, 21)] = KP1_740173982 * T3a - KP985796384 * T39;
+	       O[WS(os, 22)] = KP899222659 * T38 + KP1_786448602 * T37;
+	       O[WS(os, 23)] = KP1_828419511 * T36 - KP810482628 * T35;
+	       O[WS(os, 24)] = KP719790073 * T34 + KP1_865985597 * T31;
+	       O[WS(os, 25)] = KP1_899056361 * T2Y - KP627363480 * T2V;
+	       O[WS(os, 26)] = KP533425514 * T2S + KP1_927552131 * T2P;
+	       O[WS(os, 27)] = KP1_951404260 * T2M - KP438202480 * T2J;
+	       O[WS(os, 28)] = KP341923777 * T2G + KP1_970555284 * T2z;
+	       O[WS(os, 29)] = KP1_984959069 * T2o - KP244821350 * T2h;
+	       O[WS(os, 30)] = KP147129127 * T26 + KP1_994580913 * T1V;
+	       O[WS(os, 31)] = KP1_999397637 * T1u - KP049082457 * T10;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 32, "o11_32", {206, 146, 0, 0}, &GENUS, RODFT11 };
+
+void X(codelet_o11_32) (planner *p) {
+     X(kr2r_register) (p, o11_32, &desc);
+}
+
+#endif
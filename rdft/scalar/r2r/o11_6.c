@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft11 -n 6 -name o11_6 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 24 FP additions, 26 FP multiplications,
+ * (or, 8 additions, 10 multiplications, 16 fused multiply/add),
+ * 20 stack variables, 8 constants, and 12 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o11_6(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP261052384, +0.261052384440103183096812455790978020387481410);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP1_982889722, +1.982889722747620822289115053857125742555476549);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_217522858, +1.217522858017441278832195085796328009032787424);
+     DK(KP1_586706680, +1.586706680582470329159553923002598553257351842);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(12, is), MAKE_VOLATILE_STRIDE(12, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = FMS(KP866025403, T3, KP500000000 * T4);
+	       T8 = FMS(KP500000000, T5, KP866025403 * T2);
+	       T9 = T7 + T8;
+	       Ta = T1 + T9;
+	       Tb = FMA(KP866025403, T4, KP500000000 * T3);
+	       Tc = FMA(KP500000000, T2, KP866025403 * T5);
+	       Td = Tb + Tc;
+	       Te = T6 + Td;
+	       O[0] = FMA(KP1_982889722, Te, KP261052384 * Ta);
+	       Tf = FNMS(KP500000000, Td, T6);
+	       Tg = FNMS(KP866025403, T7 - T8, Tf);
+	       Th = FNMS(KP500000000, T9, T1);
+	       Ti = FMA(KP866025403, Tb - Tc, Th);
+	       O[WS(os, 1)] = FMS(KP765366864, Ti, KP1_847759065 * Tg);
+	       Tj = FNMS(KP866025403, Tb - Tc, Th);
+	       Tk = FMA(KP866025403, T7 - T8, Tf);
+	       O[WS(os, 2)] = FMA(KP1_586706680, Tk, KP1_217522858 * Tj);
+	       O[WS(os, 3)] = FMS(KP1_586706680, Tj, KP1_217522858 * Tk);
+	       O[WS(os, 4)] = FMA(KP765366864, Tg, KP1_847759065 * Ti);
+	       O[WS(os, 5)] = FMS(KP1_982889722, Ta, KP261052384 * Te);
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 6, "o11_6", {8, 10, 16, 0}, &GENUS, RODFT11 };
+
+void X(codelet_o11_6) (planner *p) {
+     X(kr2r_register) (p, o11_6, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft11 -n 6 -name o11_6 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 22 FP additions, 24 FP multiplications,
+ * (or, 22 additions, 24 multiplications, 0 fused multiply/add),
+ * 22 stack variables, 8 constants, and 12 memory accesses
+ */
+#include "rdft/scalar/r2r.h"
+
+static void o11_6(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_982889722, +1.982889722747620822289115053857125742555476549);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP261052384, +0.261052384440103183096812455790978020387481410);
+     DK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DK(KP1_586706680, +1.586706680582470329159553923002598553257351842);
+     DK(KP1_217522858, +1.217522858017441278832195085796328009032787424);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, MAKE_VOLATILE_STRIDE(12, is), MAKE_VOLATILE_STRIDE(12, os)) {
+	       E T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       E Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm;
+	       T1 = I[0];
+	       T2 = I[WS(is, 1)];
+	       T3 = I[WS(is, 2)];
+	       T4 = I[WS(is, 3)];
+	       T5 = I[WS(is, 4)];
+	       T6 = I[WS(is, 5)];
+	       T7 = KP866025403 * T4 + KP500000000 * T3;
+	       T8 = KP500000000 * T2 + KP866025403 * T5;
+	       T9 = T7 + T8;
+	       Ta = T6 + T9;
+	       Tb = KP866025403 * T3 - KP500000000 * T4;
+	       Tc = KP500000000 * T5 - KP866025403 * T2;
+	       Td = Tb + Tc;
+	       Te = T1 + Td;
+	       O[0] = KP1_982889722 * Ta + KP261052384 * Te;
+	       Tf = T1 - KP500000000 * Td;
+	       Tg = KP866025403 * (T7 - T8);
+	       Th = Tf + Tg;
+	       Ti = T6 - KP500000000 * T9;
+	       Tj = KP866025403 * (Tb - Tc);
+	       Tk = Ti - Tj;
+	       O[WS(os, 1)] = KP765366864 * Th - KP1_847759065 * Tk;
+	       Tl = Ti + Tj;
+	       Tm = Tf - Tg;
+	       O[WS(os, 2)] = KP1_586706680 * Tl + KP1_217522858 * Tm;
+	       O[WS(os, 3)] = KP1_586706680 * Tm - KP1_217522858 * Tl;
+	       O[WS(os, 4)] = KP765366864 * Tk + KP1_847759065 * Th;
+	       O[WS(os, 5)] = KP1_982889722 * Te - KP261052384 * Ta;
+	  }
+     }
+}
+
+static const kr2r_desc desc = { 6, "o11_6", {22, 24, 0, 0}, &GENUS, RODFT11 };
+
+void X(codelet_o11_6) (planner *p) {
+     X(kr2r_register) (p, o11_6, &desc);
+}
+
+#endif
@@ -0,0 +1,3 @@
+/* Generated automatically.  DO NOT EDIT! */
+#define SIMD_HEADER "simd-support/simd-altivec.h"
+#include "../common/e01v_16.c"
@@ -18,5 +18,23 @@ HC2CBDFTV = hc2cbdftv_2.c hc2cbdftv_4.c hc2cbdftv_6.c hc2cbdftv_8.c	\
 hc2cbdftv_10.c hc2cbdftv_12.c hc2cbdftv_16.c hc2cbdftv_32.c		\
 hc2cbdftv_20.c
 
+# r2cf/r2cb codelets computing one transform per vector lane, obtained
+# from the scalar ones by support/vectorize-r2c.py
+R2CFV = r2cfv_2.c r2cfv_3.c r2cfv_4.c r2cfv_5.c r2cfv_6.c r2cfv_7.c	\
+r2cfv_8.c r2cfv_9.c r2cfv_10.c r2cfv_12.c r2cfv_16.c r2cfv_32.c
+
+R2CBV = r2cbv_2.c r2cbv_3.c r2cbv_4.c r2cbv_5.c r2cbv_6.c r2cbv_7.c	\
+r2cbv_8.c r2cbv_9.c r2cbv_10.c r2cbv_12.c r2cbv_16.c r2cbv_32.c
+
+# REDFT/RODFT codelets computing one transform per vector lane, obtained
+# from the scalar ones of rdft/scalar/r2r by support/vectorize-r2c.py
+E10V = e10v_8.c e10v_16.c e10v_32.c e10v_64.c
+E01V = e01v_8.c e01v_16.c e01v_32.c e01v_64.c
+E11V = e11v_8.c e11v_16.c e11v_32.c
+O10V = o10v_8.c o10v_16.c o10v_32.c o10v_64.c
+O01V = o01v_8.c o01v_16.c o01v_32.c o01v_64.c
+O11V = o11v_8.c o11v_16.c o11v_32.c
+R2RV = $(E10V) $(E01V) $(E11V) $(O10V) $(O01V) $(O11V)
+
 ###########################################################################
-SIMD_CODELETS = $(HC2CFDFTV) $(HC2CBDFTV)
+SIMD_CODELETS = $(HC2CFDFTV) $(HC2CBDFTV) $(R2CFV) $(R2CBV) $(R2RV)
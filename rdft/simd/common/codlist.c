@@ -19,6 +19,52 @@ extern void XSIMD(codelet_hc2cbdftv_12)(planner *);
 extern void XSIMD(codelet_hc2cbdftv_16)(planner *);
 extern void XSIMD(codelet_hc2cbdftv_32)(planner *);
 extern void XSIMD(codelet_hc2cbdftv_20)(planner *);
+extern void XSIMD(codelet_r2cfv_2)(planner *);
+extern void XSIMD(codelet_r2cfv_3)(planner *);
+extern void XSIMD(codelet_r2cfv_4)(planner *);
+extern void XSIMD(codelet_r2cfv_5)(planner *);
+extern void XSIMD(codelet_r2cfv_6)(planner *);
+extern void XSIMD(codelet_r2cfv_7)(planner *);
+extern void XSIMD(codelet_r2cfv_8)(planner *);
+extern void XSIMD(codelet_r2cfv_9)(planner *);
+extern void XSIMD(codelet_r2cfv_10)(planner *);
+extern void XSIMD(codelet_r2cfv_12)(planner *);
+extern void XSIMD(codelet_r2cfv_16)(planner *);
+extern void XSIMD(codelet_r2cfv_32)(planner *);
+extern void XSIMD(codelet_r2cbv_2)(planner *);
+extern void XSIMD(codelet_r2cbv_3)(planner *);
+extern void XSIMD(codelet_r2cbv_4)(planner *);
+extern void XSIMD(codelet_r2cbv_5)(planner *);
+extern void XSIMD(codelet_r2cbv_6)(planner *);
+extern void XSIMD(codelet_r2cbv_7)(planner *);
+extern void XSIMD(codelet_r2cbv_8)(planner *);
+extern void XSIMD(codelet_r2cbv_9)(planner *);
+extern void XSIMD(codelet_r2cbv_10)(planner *);
+extern void XSIMD(codelet_r2cbv_12)(planner *);
+extern void XSIMD(codelet_r2cbv_16)(planner *);
+extern void XSIMD(codelet_r2cbv_32)(planner *);
+extern void XSIMD(codelet_e10v_8)(planner *);
+extern void XSIMD(codelet_e10v_16)(planner *);
+extern void XSIMD(codelet_e10v_32)(planner *);
+extern void XSIMD(codelet_e10v_64)(planner *);
+extern void XSIMD(codelet_e01v_8)(planner *);
+extern void XSIMD(codelet_e01v_16)(planner *);
+extern void XSIMD(codelet_e01v_32)(planner *);
+extern void XSIMD(codelet_e01v_64)(planner *);
+extern void XSIMD(codelet_e11v_8)(planner *);
+extern void XSIMD(codelet_e11v_16)(planner *);
+extern void XSIMD(codelet_e11v_32)(planner *);
+extern void XSIMD(codelet_o10v_8)(planner *);
+extern void XSIMD(codelet_o10v_16)(planner *);
+extern void XSIMD(codelet_o10v_32)(planner *);
+extern void XSIMD(codelet_o10v_64)(planner *);
+extern void XSIMD(codelet_o01v_8)(planner *);
+extern void XSIMD(codelet_o01v_16)(planner *);
+extern void XSIMD(codelet_o01v_32)(planner *);
+extern void XSIMD(codelet_o01v_64)(planner *);
+extern void XSIMD(codelet_o11v_8)(planner *);
+extern void XSIMD(codelet_o11v_16)(planner *);
+extern void XSIMD(codelet_o11v_32)(planner *);
 
 
 extern const solvtab XSIMD(solvtab_rdft);
@@ -41,5 +87,51 @@ const solvtab XSIMD(solvtab_rdft) = {
    SOLVTAB(XSIMD(codelet_hc2cbdftv_16)),
    SOLVTAB(XSIMD(codelet_hc2cbdftv_32)),
    SOLVTAB(XSIMD(codelet_hc2cbdftv_20)),
+   SOLVTAB(XSIMD(codelet_r2cfv_2)),
+   SOLVTAB(XSIMD(codelet_r2cfv_3)),
+   SOLVTAB(XSIMD(codelet_r2cfv_4)),
+   SOLVTAB(XSIMD(codelet_r2cfv_5)),
+   SOLVTAB(XSIMD(codelet_r2cfv_6)),
+   SOLVTAB(XSIMD(codelet_r2cfv_7)),
+   SOLVTAB(XSIMD(codelet_r2cfv_8)),
+   SOLVTAB(XSIMD(codelet_r2cfv_9)),
+   SOLVTAB(XSIMD(codelet_r2cfv_10)),
+   SOLVTAB(XSIMD(codelet_r2cfv_12)),
+   SOLVTAB(XSIMD(codelet_r2cfv_16)),
+   SOLVTAB(XSIMD(codelet_r2cfv_32)),
+   SOLVTAB(XSIMD(codelet_r2cbv_2)),
+   SOLVTAB(XSIMD(codelet_r2cbv_3)),
+   SOLVTAB(XSIMD(codelet_r2cbv_4)),
+   SOLVTAB(XSIMD(codelet_r2cbv_5)),
+   SOLVTAB(XSIMD(codelet_r2cbv_6)),
+   SOLVTAB(XSIMD(codelet_r2cbv_7)),
+   SOLVTAB(XSIMD(codelet_r2cbv_8)),
+   SOLVTAB(XSIMD(codelet_r2cbv_9)),
+   SOLVTAB(XSIMD(codelet_r2cbv_10)),
+   SOLVTAB(XSIMD(codelet_r2cbv_12)),
+   SOLVTAB(XSIMD(codelet_r2cbv_16)),
+   SOLVTAB(XSIMD(codelet_r2cbv_32)),
+   SOLVTAB(XSIMD(codelet_e10v_8)),
+   SOLVTAB(XSIMD(codelet_e10v_16)),
+   SOLVTAB(XSIMD(codelet_e10v_32)),
+   SOLVTAB(XSIMD(codelet_e10v_64)),
+   SOLVTAB(XSIMD(codelet_e01v_8)),
+   SOLVTAB(XSIMD(codelet_e01v_16)),
+   SOLVTAB(XSIMD(codelet_e01v_32)),
+   SOLVTAB(XSIMD(codelet_e01v_64)),
+   SOLVTAB(XSIMD(codelet_e11v_8)),
+   SOLVTAB(XSIMD(codelet_e11v_16)),
+   SOLVTAB(XSIMD(codelet_e11v_32)),
+   SOLVTAB(XSIMD(codelet_o10v_8)),
+   SOLVTAB(XSIMD(codelet_o10v_16)),
+   SOLVTAB(XSIMD(codelet_o10v_32)),
+   SOLVTAB(XSIMD(codelet_o10v_64)),
+   SOLVTAB(XSIMD(codelet_o01v_8)),
+   SOLVTAB(XSIMD(codelet_o01v_16)),
+   SOLVTAB(XSIMD(codelet_o01v_32)),
+   SOLVTAB(XSIMD(codelet_o01v_64)),
+   SOLVTAB(XSIMD(codelet_o11v_8)),
+   SOLVTAB(XSIMD(codelet_o11v_16)),
+   SOLVTAB(XSIMD(codelet_o11v_32)),
    SOLVTAB_END
 };
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e01v_16 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft01 -n 16 -name e01_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 76 FP additions, 46 FP multiplications,
+ * (or, 48 additions, 18 multiplications, 28 fused multiply/add),
+ * 68 stack variables, 18 constants, and 32 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e01v_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = VFMA(LDK(KP942793473), Tc, VMUL(LDK(KP1_763842528), T6));
+	       Ti = VFMA(LDK(KP580569354), Te, VMUL(LDK(KP1_913880671), T4));
+	       Tj = VADD(Th, Ti);
+	       Tk = VFMA(LDK(KP1_268786568), Ta, VMUL(LDK(KP1_546020906), T8));
+	       Tl = VFMA(LDK(KP196034280), Tg, VMUL(LDK(KP1_990369453), T2));
+	       Tm = VADD(Tk, Tl);
+	       Tn = VADD(Tj, Tm);
+	       To = VFMA(LDK(KP1_111140466), Tb, VMUL(LDK(KP1_662939224), T7));
+	       Tp = VFMA(LDK(KP390180644), Tf, VMUL(LDK(KP1_961570560), T3));
+	       Tq = VADD(To, Tp);
+	       Tr = VFMA(LDK(KP765366864), Td, VMUL(LDK(KP1_847759065), T5));
+	       Ts = VFMA(LDK(KP1_414213562), T9, T1);
+	       Tt = VADD(Tr, Ts);
+	       Tu = VADD(Tq, Tt);
+	       STA(&(O[0]), VADD(Tn, Tu), ovs, &(O[0]));
+	       Tv = VFNMS(LDK(KP1_414213562), T9, T1);
+	       Tw = VFMS(LDK(KP1_847759065), Td, VMUL(LDK(KP765366864), T5));
+	       Tx = VSUB(Tv, Tw);
+	       Ty = VFMS(LDK(KP1_662939224), Tb, VMUL(LDK(KP1_111140466), T7));
+	       Tz = VFMS(LDK(KP1_961570560), Tf, VMUL(LDK(KP390180644), T3));
+	       TA = VADD(Ty, Tz);
+	       TB = VSUB(To, Tp);
+	       TC = VFNMS(LDK(KP707106781), VADD(TA, TB), Tx);
+	       TD = VFMS(LDK(KP1_763842528), Tc, VMUL(LDK(KP942793473), T6));
+	       TE = VFMS(LDK(KP1_913880671), Te, VMUL(LDK(KP580569354), T4));
+	       TF = VADD(TD, TE);
+	       TG = VSUB(Tk, Tl);
+	       TH = VADD(TF, TG);
+	       TI = VSUB(Th, Ti);
+	       TJ = VFMS(LDK(KP1_546020906), Ta, VMUL(LDK(KP1_268786568), T8));
+	       TK = VFMS(LDK(KP1_990369453), Tg, VMUL(LDK(KP196034280), T2));
+	       TL = VADD(TJ, TK);
+	       TM = VADD(TI, TL);
+	       TN = VFMA(LDK(KP382683432), TM, VMUL(LDK(KP923879532), TH));
+	       STA(&(O[WS(os, 1)]), VSUB(TC, TN), ovs, &(O[0]));
+	       TO = VADD(Tw, Tv);
+	       TP = VFMA(LDK(KP707106781), VSUB(TA, TB), TO);
+	       TQ = VSUB(TF, TG);
+	       TR = VSUB(TI, TL);
+	       TS = VFMS(LDK(KP382683432), TR, VMUL(LDK(KP923879532), TQ));
+	       STA(&(O[WS(os, 2)]), VSUB(TP, TS), ovs, &(O[0]));
+	       TT = VSUB(Ty, Tz);
+	       TU = VSUB(Ts, Tr);
+	       TV = VADD(TT, TU);
+	       TW = VSUB(TD, TE);
+	       TX = VSUB(TJ, TK);
+	       TY = VADD(TW, TX);
+	       TZ = VSUB(Tj, Tm);
+	       STA(&(O[WS(os, 3)]), VFMA(LDK(KP707106781), VSUB(TY, TZ), TV), ovs, &(O[0]));
+	       T10 = VSUB(TU, TT);
+	       STA(&(O[WS(os, 4)]), VFNMS(LDK(KP707106781), VADD(TY, TZ), T10), ovs, &(O[0]));
+	       T11 = VFMA(LDK(KP923879532), TR, VMUL(LDK(KP382683432), TQ));
+	       T12 = VFNMS(LDK(KP707106781), VSUB(TA, TB), TO);
+	       STA(&(O[WS(os, 5)]), VADD(T11, T12), ovs, &(O[0]));
+	       T13 = VFMS(LDK(KP923879532), TM, VMUL(LDK(KP382683432), TH));
+	       T14 = VFMA(LDK(KP707106781), VADD(TA, TB), Tx);
+	       STA(&(O[WS(os, 6)]), VADD(T13, T14), ovs, &(O[0]));
+	       T15 = VSUB(Tt, Tq);
+	       T16 = VSUB(TW, TX);
+	       STA(&(O[WS(os, 7)]), VSUB(T15, T16), ovs, &(O[0]));
+	       STA(&(O[WS(os, 8)]), VADD(T16, T15), ovs, &(O[0]));
+	       STA(&(O[WS(os, 9)]), VSUB(T14, T13), ovs, &(O[0]));
+	       STA(&(O[WS(os, 10)]), VSUB(T12, T11), ovs, &(O[0]));
+	       STA(&(O[WS(os, 11)]), VFMA(LDK(KP707106781), VADD(TY, TZ), T10), ovs, &(O[0]));
+	       STA(&(O[WS(os, 12)]), VFNMS(LDK(KP707106781), VSUB(TY, TZ), TV), ovs, &(O[0]));
+	       STA(&(O[WS(os, 13)]), VADD(TS, TP), ovs, &(O[0]));
+	       STA(&(O[WS(os, 14)]), VADD(TN, TC), ovs, &(O[0]));
+	       STA(&(O[WS(os, 15)]), VSUB(Tu, Tn), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 16, XSIMD_STRING("e01v_16"), {48, 18, 28, 0}, &GENUS, REDFT01 };
+
+void XSIMD(codelet_e01v_16) (planner *p) {
+     X(kr2r_register) (p, e01v_16, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e01v_16 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft01 -n 16 -name e01_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 72 FP additions, 41 FP multiplications,
+ * (or, 72 additions, 41 multiplications, 0 fused multiply/add),
+ * 73 stack variables, 18 constants, and 32 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e01v_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = VADD(VMUL(LDK(KP942793473), Tc), VMUL(LDK(KP1_763842528), T6));
+	       Ti = VADD(VMUL(LDK(KP580569354), Te), VMUL(LDK(KP1_913880671), T4));
+	       Tj = VADD(Th, Ti);
+	       Tk = VADD(VMUL(LDK(KP1_268786568), Ta), VMUL(LDK(KP1_546020906), T8));
+	       Tl = VADD(VMUL(LDK(KP196034280), Tg), VMUL(LDK(KP1_990369453), T2));
+	       Tm = VADD(Tk, Tl);
+	       Tn = VADD(Tj, Tm);
+	       To = VADD(VMUL(LDK(KP1_111140466), Tb), VMUL(LDK(KP1_662939224), T7));
+	       Tp = VADD(VMUL(LDK(KP390180644), Tf), VMUL(LDK(KP1_961570560), T3));
+	       Tq = VADD(To, Tp);
+	       Tr = VADD(VMUL(LDK(KP765366864), Td), VMUL(LDK(KP1_847759065), T5));
+	       Ts = VMUL(LDK(KP1_414213562), T9);
+	       Tt = VADD(T1, Ts);
+	       Tu = VADD(Tr, Tt);
+	       Tv = VADD(Tq, Tu);
+	       STA(&(O[0]), VADD(Tn, Tv), ovs, &(O[0]));
+	       Tw = VSUB(T1, Ts);
+	       Tx = VSUB(VMUL(LDK(KP1_847759065), Td), VMUL(LDK(KP765366864), T5));
+	       Ty = VSUB(Tw, Tx);
+	       Tz = VSUB(VMUL(LDK(KP1_662939224), Tb), VMUL(LDK(KP1_111140466), T7));
+	       TA = VSUB(VMUL(LDK(KP1_961570560), Tf), VMUL(LDK(KP390180644), T3));
+	       TB = VADD(Tz, TA);
+	       TC = VSUB(To, Tp);
+	       TD = VMUL(LDK(KP707106781), VADD(TB, TC));
+	       TE = VSUB(Ty, TD);
+	       TF = VSUB(Th, Ti);
+	       TG = VSUB(VMUL(LDK(KP1_546020906), Ta), VMUL(LDK(KP1_268786568), T8));
+	       TH = VSUB(VMUL(LDK(KP1_990369453), Tg), VMUL(LDK(KP196034280), T2));
+	       TI = VADD(TG, TH);
+	       TJ = VADD(TF, TI);
+	       TK = VSUB(VMUL(LDK(KP1_763842528), Tc), VMUL(LDK(KP942793473), T6));
+	       TL = VSUB(VMUL(LDK(KP1_913880671), Te), VMUL(LDK(KP580569354), T4));
+	       TM = VADD(TK, TL);
+	       TN = VSUB(Tk, Tl);
+	       TO = VADD(TM, TN);
+	       TP = VADD(VMUL(LDK(KP382683432), TJ), VMUL(LDK(KP923879532), TO));
+	       STA(&(O[WS(os, 1)]), VSUB(TE, TP), ovs, &(O[0]));
+	       TQ = VMUL(LDK(KP707106781), VSUB(TB, TC));
+	       TR = VADD(Tx, Tw);
+	       TS = VADD(TQ, TR);
+	       TT = VSUB(TF, TI);
+	       TU = VSUB(TM, TN);
+	       TV = VSUB(VMUL(LDK(KP382683432), TT), VMUL(LDK(KP923879532), TU));
+	       STA(&(O[WS(os, 2)]), VSUB(TS, TV), ovs, &(O[0]));
+	       TW = VSUB(TK, TL);
+	       TX = VSUB(TG, TH);
+	       TY = VADD(TW, TX);
+	       TZ = VSUB(Tj, Tm);
+	       T10 = VMUL(LDK(KP707106781), VSUB(TY, TZ));
+	       T11 = VSUB(Tz, TA);
+	       T12 = VSUB(Tt, Tr);
+	       T13 = VADD(T11, T12);
+	       STA(&(O[WS(os, 3)]), VADD(T10, T13), ovs, &(O[0]));
+	       T14 = VSUB(T12, T11);
+	       T15 = VMUL(LDK(KP707106781), VADD(TY, TZ));
+	       STA(&(O[WS(os, 4)]), VSUB(T14, T15), ovs, &(O[0]));
+	       T16 = VADD(VMUL(LDK(KP923879532), TT), VMUL(LDK(KP382683432), TU));
+	       T17 = VSUB(TR, TQ);
+	       STA(&(O[WS(os, 5)]), VADD(T16, T17), ovs, &(O[0]));
+	       T18 = VSUB(VMUL(LDK(KP923879532), TJ), VMUL(LDK(KP382683432), TO));
+	       T19 = VADD(TD, Ty);
+	       STA(&(O[WS(os, 6)]), VADD(T18, T19), ovs, &(O[0]));
+	       T1a = VSUB(Tu, Tq);
+	       T1b = VSUB(TW, TX);
+	       STA(&(O[WS(os, 7)]), VSUB(T1a, T1b), ovs, &(O[0]));
+	       STA(&(O[WS(os, 8)]), VADD(T1b, T1a), ovs, &(O[0]));
+	       STA(&(O[WS(os, 9)]), VSUB(T19, T18), ovs, &(O[0]));
+	       STA(&(O[WS(os, 10)]), VSUB(T17, T16), ovs, &(O[0]));
+	       STA(&(O[WS(os, 11)]), VADD(T15, T14), ovs, &(O[0]));
+	       STA(&(O[WS(os, 12)]), VSUB(T13, T10), ovs, &(O[0]));
+	       STA(&(O[WS(os, 13)]), VADD(TV, TS), ovs, &(O[0]));
+	       STA(&(O[WS(os, 14)]), VADD(TP, TE), ovs, &(O[0]));
+	       STA(&(O[WS(os, 15)]), VSUB(Tv, Tn), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 16, XSIMD_STRING("e01v_16"), {72, 41, 0, 0}, &GENUS, REDFT01 };
+
+void XSIMD(codelet_e01v_16) (planner *p) {
+     X(kr2r_register) (p, e01v_16, &desc);
+}
+
+#endif
@@ -0,0 +1,617 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e01v_32 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft01 -n 32 -name e01_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 196 FP additions, 114 FP multiplications,
+ * (or, 128 additions, 46 multiplications, 68 fused multiply/add),
+ * 176 stack variables, 38 constants, and 64 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e01v_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = VFMA(LDK(KP1_028205488), Tm, VMUL(LDK(KP1_715457220), Tc));
+	       Ty = VFMA(LDK(KP485960359), Ts, VMUL(LDK(KP1_940062506), T6));
+	       Tz = VADD(Tx, Ty);
+	       TA = VFMA(LDK(KP1_191398608), Tk, VMUL(LDK(KP1_606415062), Te));
+	       TB = VFMA(LDK(KP293460948), Tu, VMUL(LDK(KP1_978353019), T4));
+	       TC = VADD(TA, TB);
+	       TD = VADD(Tz, TC);
+	       TE = VFMA(LDK(KP855110186), To, VMUL(LDK(KP1_807978586), Ta));
+	       TF = VFMA(LDK(KP673779706), Tq, VMUL(LDK(KP1_883088130), T8));
+	       TG = VADD(TE, TF);
+	       TH = VFMA(LDK(KP1_343117909), Ti, VMUL(LDK(KP1_481902250), Tg));
+	       TI = VFMA(LDK(KP098135348), Tw, VMUL(LDK(KP1_997590912), T2));
+	       TJ = VADD(TH, TI);
+	       TK = VADD(TG, TJ);
+	       TL = VADD(TD, TK);
+	       TM = VFMA(LDK(KP942793473), Tn, VMUL(LDK(KP1_763842528), Tb));
+	       TN = VFMA(LDK(KP580569354), Tr, VMUL(LDK(KP1_913880671), T7));
+	       TO = VADD(TM, TN);
+	       TP = VFMA(LDK(KP1_268786568), Tj, VMUL(LDK(KP1_546020906), Tf));
+	       TQ = VFMA(LDK(KP196034280), Tv, VMUL(LDK(KP1_990369453), T3));
+	       TR = VADD(TP, TQ);
+	       TS = VADD(TO, TR);
+	       TT = VFMA(LDK(KP1_111140466), Tl, VMUL(LDK(KP1_662939224), Td));
+	       TU = VFMA(LDK(KP390180644), Tt, VMUL(LDK(KP1_961570560), T5));
+	       TV = VADD(TT, TU);
+	       TW = VFMA(LDK(KP765366864), Tp, VMUL(LDK(KP1_847759065), T9));
+	       TX = VFMA(LDK(KP1_414213562), Th, T1);
+	       TY = VADD(TW, TX);
+	       TZ = VADD(TV, TY);
+	       T10 = VADD(TS, TZ);
+	       STA(&(O[0]), VADD(TL, T10), ovs, &(O[0]));
+	       T11 = VFNMS(LDK(KP1_414213562), Th, T1);
+	       T12 = VFMS(LDK(KP1_847759065), Tp, VMUL(LDK(KP765366864), T9));
+	       T13 = VSUB(T11, T12);
+	       T14 = VFMS(LDK(KP1_662939224), Tl, VMUL(LDK(KP1_111140466), Td));
+	       T15 = VFMS(LDK(KP1_961570560), Tt, VMUL(LDK(KP390180644), T5));
+	       T16 = VADD(T14, T15);
+	       T17 = VSUB(TT, TU);
+	       T18 = VFNMS(LDK(KP707106781), VADD(T16, T17), T13);
+	       T19 = VFMS(LDK(KP1_763842528), Tn, VMUL(LDK(KP942793473), Tb));
+	       T1a = VFMS(LDK(KP1_913880671), Tr, VMUL(LDK(KP580569354), T7));
+	       T1b = VADD(T19, T1a);
+	       T1c = VSUB(TP, TQ);
+	       T1d = VADD(T1b, T1c);
+	       T1e = VSUB(TM, TN);
+	       T1f = VFMS(LDK(KP1_546020906), Tj, VMUL(LDK(KP1_268786568), Tf));
+	       T1g = VFMS(LDK(KP1_990369453), Tv, VMUL(LDK(KP196034280), T3));
+	       T1h = VADD(T1f, T1g);
+	       T1i = VADD(T1e, T1h);
+	       T1j = VFMA(LDK(KP382683432), T1i, VMUL(LDK(KP923879532), T1d));
+	       T1k = VSUB(T18, T1j);
+	       T1l = VFMS(LDK(KP1_715457220), Tm, VMUL(LDK(KP1_028205488), Tc));
+	       T1m = VFMS(LDK(KP1_940062506), Ts, VMUL(LDK(KP485960359), T6));
+	       T1n = VADD(T1l, T1m);
+	       T1o = VSUB(TA, TB);
+	       T1p = VADD(T1n, T1o);
+	       T1q = VSUB(Tx, Ty);
+	       T1r = VFMS(LDK(KP1_606415062), Tk, VMUL(LDK(KP1_191398608), Te));
+	       T1s = VFMS(LDK(KP1_978353019), Tu, VMUL(LDK(KP293460948), T4));
+	       T1t = VADD(T1r, T1s);
+	       T1u = VADD(T1q, T1t);
+	       T1v = VFMA(LDK(KP980785280), T1u, VMUL(LDK(KP195090322), T1p));
+	       T1w = VFMS(LDK(KP1_807978586), To, VMUL(LDK(KP855110186), Ta));
+	       T1x = VFMS(LDK(KP1_883088130), Tq, VMUL(LDK(KP673779706), T8));
+	       T1y = VADD(T1w, T1x);
+	       T1z = VSUB(TH, TI);
+	       T1A = VADD(T1y, T1z);
+	       T1B = VSUB(TE, TF);
+	       T1C = VFMS(LDK(KP1_481902250), Ti, VMUL(LDK(KP1_343117909), Tg));
+	       T1D = VFMS(LDK(KP1_997590912), Tw, VMUL(LDK(KP098135348), T2));
+	       T1E = VADD(T1C, T1D);
+	       T1F = VADD(T1B, T1E);
+	       T1G = VFMS(LDK(KP555570233), T1F, VMUL(LDK(KP831469612), T1A));
+	       T1H = VSUB(T1v, T1G);
+	       T1I = VFMS(LDK(KP195090322), T1u, VMUL(LDK(KP980785280), T1p));
+	       T1J = VFMA(LDK(KP831469612), T1F, VMUL(LDK(KP555570233), T1A));
+	       T1K = VSUB(T1I, T1J);
+	       STA(&(O[WS(os, 1)]), VFNMS(LDK(KP707106781), VSUB(T1H, T1K), T1k), ovs, &(O[0]));
+	       T1L = VADD(T12, T11);
+	       T1M = VFMA(LDK(KP707106781), VSUB(T16, T17), T1L);
+	       T1N = VSUB(T1b, T1c);
+	       T1O = VSUB(T1e, T1h);
+	       T1P = VFMS(LDK(KP382683432), T1O, VMUL(LDK(KP923879532), T1N));
+	       T1Q = VSUB(T1M, T1P);
+	       T1R = VSUB(T1n, T1o);
+	       T1S = VSUB(T1q, T1t);
+	       T1T = VFMS(LDK(KP555570233), T1S, VMUL(LDK(KP831469612), T1R));
+	       T1U = VSUB(T1y, T1z);
+	       T1V = VSUB(T1B, T1E);
+	       T1W = VFMS(LDK(KP195090322), T1V, VMUL(LDK(KP980785280), T1U));
+	       T1X = VADD(T1T, T1W);
+	       STA(&(O[WS(os, 2)]), VSUB(T1Q, T1X), ovs, &(O[0]));
+	       T1Y = VSUB(T14, T15);
+	       T1Z = VSUB(TX, TW);
+	       T20 = VADD(T1Y, T1Z);
+	       T21 = VSUB(T19, T1a);
+	       T22 = VSUB(T1f, T1g);
+	       T23 = VADD(T21, T22);
+	       T24 = VSUB(TO, TR);
+	       T25 = VFMA(LDK(KP707106781), VSUB(T23, T24), T20);
+	       T26 = VSUB(T1l, T1m);
+	       T27 = VSUB(T1r, T1s);
+	       T28 = VADD(T26, T27);
+	       T29 = VSUB(TG, TJ);
+	       T2a = VSUB(T28, T29);
+	       T2b = VSUB(Tz, TC);
+	       T2c = VSUB(T1w, T1x);
+	       T2d = VSUB(T1C, T1D);
+	       T2e = VADD(T2c, T2d);
+	       T2f = VSUB(T2b, T2e);
+	       T2g = VFMS(LDK(KP382683432), T2f, VMUL(LDK(KP923879532), T2a));
+	       STA(&(O[WS(os, 3)]), VSUB(T25, T2g), ovs, &(O[0]));
+	       T2h = VSUB(T1Z, T1Y);
+	       T2i = VFNMS(LDK(KP707106781), VADD(T23, T24), T2h);
+	       T2j = VADD(T28, T29);
+	       T2k = VADD(T2b, T2e);
+	       T2l = VFMA(LDK(KP382683432), T2k, VMUL(LDK(KP923879532), T2j));
+	       STA(&(O[WS(os, 4)]), VSUB(T2i, T2l), ovs, &(O[0]));
+	       T2m = VFMA(LDK(KP923879532), T1O, VMUL(LDK(KP382683432), T1N));
+	       T2n = VFNMS(LDK(KP707106781), VSUB(T16, T17), T1L);
+	       T2o = VADD(T2m, T2n);
+	       T2p = VFMA(LDK(KP831469612), T1S, VMUL(LDK(KP555570233), T1R));
+	       T2q = VFMA(LDK(KP980785280), T1V, VMUL(LDK(KP195090322), T1U));
+	       T2r = VADD(T2p, T2q);
+	       T2s = VSUB(T1T, T1W);
+	       STA(&(O[WS(os, 5)]), VFMA(LDK(KP707106781), VADD(T2r, T2s), T2o), ovs, &(O[0]));
+	       T2t = VADD(T1v, T1G);
+	       T2u = VFMS(LDK(KP923879532), T1i, VMUL(LDK(KP382683432), T1d));
+	       T2v = VFMA(LDK(KP707106781), VADD(T16, T17), T13);
+	       T2w = VADD(T2u, T2v);
+	       STA(&(O[WS(os, 6)]), VADD(T2t, T2w), ovs, &(O[0]));
+	       T2x = VSUB(TY, TV);
+	       T2y = VSUB(T21, T22);
+	       T2z = VSUB(T2x, T2y);
+	       T2A = VSUB(T26, T27);
+	       T2B = VSUB(T2c, T2d);
+	       T2C = VADD(T2A, T2B);
+	       T2D = VSUB(TD, TK);
+	       STA(&(O[WS(os, 7)]), VFNMS(LDK(KP707106781), VADD(T2C, T2D), T2z), ovs, &(O[0]));
+	       T2E = VADD(T2y, T2x);
+	       STA(&(O[WS(os, 8)]), VFMA(LDK(KP707106781), VSUB(T2C, T2D), T2E), ovs, &(O[0]));
+	       T2F = VSUB(T2v, T2u);
+	       T2G = VADD(T1I, T1J);
+	       STA(&(O[WS(os, 9)]), VSUB(T2F, T2G), ovs, &(O[0]));
+	       T2H = VSUB(T2n, T2m);
+	       STA(&(O[WS(os, 10)]), VFNMS(LDK(KP707106781), VSUB(T2r, T2s), T2H), ovs, &(O[0]));
+	       T2I = VFMS(LDK(KP923879532), T2k, VMUL(LDK(KP382683432), T2j));
+	       T2J = VFMA(LDK(KP707106781), VADD(T23, T24), T2h);
+	       STA(&(O[WS(os, 11)]), VADD(T2I, T2J), ovs, &(O[0]));
+	       T2K = VFMA(LDK(KP923879532), T2f, VMUL(LDK(KP382683432), T2a));
+	       T2L = VFNMS(LDK(KP707106781), VSUB(T23, T24), T20);
+	       STA(&(O[WS(os, 12)]), VADD(T2K, T2L), ovs, &(O[0]));
+	       T2M = VADD(T1P, T1M);
+	       T2N = VSUB(T2p, T2q);
+	       STA(&(O[WS(os, 13)]), VSUB(T2M, T2N), ovs, &(O[0]));
+	       T2O = VADD(T1j, T18);
+	       STA(&(O[WS(os, 14)]), VFNMS(LDK(KP707106781), VADD(T1K, T1H), T2O), ovs, &(O[0]));
+	       T2P = VSUB(T2A, T2B);
+	       T2Q = VSUB(TZ, TS);
+	       STA(&(O[WS(os, 15)]), VADD(T2P, T2Q), ovs, &(O[0]));
+	       STA(&(O[WS(os, 16)]), VSUB(T2Q, T2P), ovs, &(O[0]));
+	       STA(&(O[WS(os, 17)]), VFMA(LDK(KP707106781), VADD(T1K, T1H), T2O), ovs, &(O[0]));
+	       STA(&(O[WS(os, 18)]), VADD(T2N, T2M), ovs, &(O[0]));
+	       STA(&(O[WS(os, 19)]), VSUB(T2L, T2K), ovs, &(O[0]));
+	       STA(&(O[WS(os, 20)]), VSUB(T2J, T2I), ovs, &(O[0]));
+	       STA(&(O[WS(os, 21)]), VFMA(LDK(KP707106781), VSUB(T2r, T2s), T2H), ovs, &(O[0]));
+	       STA(&(O[WS(os, 22)]), VADD(T2G, T2F), ovs, &(O[0]));
+	       STA(&(O[WS(os, 23)]), VFNMS(LDK(KP707106781), VSUB(T2C, T2D), T2E), ovs, &(O[0]));
+	       STA(&(O[WS(os, 24)]), VFMA(LDK(KP707106781), VADD(T2C, T2D), T2z), ovs, &(O[0]));
+	       STA(&(O[WS(os, 25)]), VSUB(T2w, T2t), ovs, &(O[0]));
+	       STA(&(O[WS(os, 26)]), VFNMS(LDK(KP707106781), VADD(T2r, T2s), T2o), ovs, &(O[0]));
+	       STA(&(O[WS(os, 27)]), VADD(T2l, T2i), ovs, &(O[0]));
+	       STA(&(O[WS(os, 28)]), VADD(T2g, T25), ovs, &(O[0]));
+	       STA(&(O[WS(os, 29)]), VADD(T1X, T1Q), ovs, &(O[0]));
+	       STA(&(O[WS(os, 30)]), VFMA(LDK(KP707106781), VSUB(T1H, T1K), T1k), ovs, &(O[0]));
+	       STA(&(O[WS(os, 31)]), VSUB(T10, TL), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 32, XSIMD_STRING("e01v_32"), {128, 46, 68, 0}, &GENUS, REDFT01 };
+
+void XSIMD(codelet_e01v_32) (planner *p) {
+     X(kr2r_register) (p, e01v_32, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e01v_32 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft01 -n 32 -name e01_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 186 FP additions, 103 FP multiplications,
+ * (or, 186 additions, 103 multiplications, 0 fused multiply/add),
+ * 187 stack variables, 38 constants, and 64 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e01v_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       V T2V, T2W, T2X, T2Y, T2Z, T30, T31;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = VADD(VMUL(LDK(KP1_028205488), Tm), VMUL(LDK(KP1_715457220), Tc));
+	       Ty = VADD(VMUL(LDK(KP485960359), Ts), VMUL(LDK(KP1_940062506), T6));
+	       Tz = VADD(Tx, Ty);
+	       TA = VADD(VMUL(LDK(KP1_191398608), Tk), VMUL(LDK(KP1_606415062), Te));
+	       TB = VADD(VMUL(LDK(KP293460948), Tu), VMUL(LDK(KP1_978353019), T4));
+	       TC = VADD(TA, TB);
+	       TD = VADD(Tz, TC);
+	       TE = VADD(VMUL(LDK(KP855110186), To), VMUL(LDK(KP1_807978586), Ta));
+	       TF = VADD(VMUL(LDK(KP673779706), Tq), VMUL(LDK(KP1_883088130), T8));
+	       TG = VADD(TE, TF);
+	       TH = VADD(VMUL(LDK(KP1_343117909), Ti), VMUL(LDK(KP1_481902250), Tg));
+	       TI = VADD(VMUL(LDK(KP098135348), Tw), VMUL(LDK(KP1_997590912), T2));
+	       TJ = VADD(TH, TI);
+	       TK = VADD(TG, TJ);
+	       TL = VADD(TD, TK);
+	       TM = VADD(VMUL(LDK(KP942793473), Tn), VMUL(LDK(KP1_763842528), Tb));
+	       TN = VADD(VMUL(LDK(KP580569354), Tr), VMUL(LDK(KP1_913880671), T7));
+	       TO = VADD(TM, TN);
+	       TP = VADD(VMUL(LDK(KP1_268786568), Tj), VMUL(LDK(KP1_546020906), Tf));
+	       TQ = VADD(VMUL(LDK(KP196034280), Tv), VMUL(LDK(KP1_990369453), T3));
+	       TR = VADD(TP, TQ);
+	       TS = VADD(TO, TR);
+	       TT = VADD(VMUL(LDK(KP1_111140466), Tl), VMUL(LDK(KP1_662939224), Td));
+	       TU = VADD(VMUL(LDK(KP390180644), Tt), VMUL(LDK(KP1_961570560), T5));
+	       TV = VADD(TT, TU);
+	       TW = VADD(VMUL(LDK(KP765366864), Tp), VMUL(LDK(KP1_847759065), T9));
+	       TX = VMUL(LDK(KP1_414213562), Th);
+	       TY = VADD(T1, TX);
+	       TZ = VADD(TW, TY);
+	       T10 = VADD(TV, TZ);
+	       T11 = VADD(TS, T10);
+	       STA(&(O[0]), VADD(TL, T11), ovs, &(O[0]));
+	       T12 = VSUB(T1, TX);
+	       T13 = VSUB(VMUL(LDK(KP1_847759065), Tp), VMUL(LDK(KP765366864), T9));
+	       T14 = VSUB(T12, T13);
+	       T15 = VSUB(VMUL(LDK(KP1_662939224), Tl), VMUL(LDK(KP1_111140466), Td));
+	       T16 = VSUB(VMUL(LDK(KP1_961570560), Tt), VMUL(LDK(KP390180644), T5));
+	       T17 = VADD(T15, T16);
+	       T18 = VSUB(TT, TU);
+	       T19 = VMUL(LDK(KP707106781), VADD(T17, T18));
+	       T1a = VSUB(T14, T19);
+	       T1b = VSUB(TM, TN);
+	       T1c = VSUB(VMUL(LDK(KP1_546020906), Tj), VMUL(LDK(KP1_268786568), Tf));
+	       T1d = VSUB(VMUL(LDK(KP1_990369453), Tv), VMUL(LDK(KP196034280), T3));
+	       T1e = VADD(T1c, T1d);
+	       T1f = VADD(T1b, T1e);
+	       T1g = VSUB(VMUL(LDK(KP1_763842528), Tn), VMUL(LDK(KP942793473), Tb));
+	       T1h = VSUB(VMUL(LDK(KP1_913880671), Tr), VMUL(LDK(KP580569354), T7));
+	       T1i = VADD(T1g, T1h);
+	       T1j = VSUB(TP, TQ);
+	       T1k = VADD(T1i, T1j);
+	       T1l = VADD(VMUL(LDK(KP382683432), T1f), VMUL(LDK(KP923879532), T1k));
+	       T1m = VSUB(T1a, T1l);
+	       T1n = VSUB(Tx, Ty);
+	       T1o = VSUB(VMUL(LDK(KP1_606415062), Tk), VMUL(LDK(KP1_191398608), Te));
+	       T1p = VSUB(VMUL(LDK(KP1_978353019), Tu), VMUL(LDK(KP293460948), T4));
+	       T1q = VADD(T1o, T1p);
+	       T1r = VADD(T1n, T1q);
+	       T1s = VSUB(VMUL(LDK(KP1_715457220), Tm), VMUL(LDK(KP1_028205488), Tc));
+	       T1t = VSUB(VMUL(LDK(KP1_940062506), Ts), VMUL(LDK(KP485960359), T6));
+	       T1u = VADD(T1s, T1t);
+	       T1v = VSUB(TA, TB);
+	       T1w = VADD(T1u, T1v);
+	       T1x = VADD(VMUL(LDK(KP980785280), T1r), VMUL(LDK(KP195090322), T1w));
+	       T1y = VSUB(TE, TF);
+	       T1z = VSUB(VMUL(LDK(KP1_481902250), Ti), VMUL(LDK(KP1_343117909), Tg));
+	       T1A = VSUB(VMUL(LDK(KP1_997590912), Tw), VMUL(LDK(KP098135348), T2));
+	       T1B = VADD(T1z, T1A);
+	       T1C = VADD(T1y, T1B);
+	       T1D = VSUB(VMUL(LDK(KP1_807978586), To), VMUL(LDK(KP855110186), Ta));
+	       T1E = VSUB(VMUL(LDK(KP1_883088130), Tq), VMUL(LDK(KP673779706), T8));
+	       T1F = VADD(T1D, T1E);
+	       T1G = VSUB(TH, TI);
+	       T1H = VADD(T1F, T1G);
+	       T1I = VSUB(VMUL(LDK(KP555570233), T1C), VMUL(LDK(KP831469612), T1H));
+	       T1J = VSUB(T1x, T1I);
+	       T1K = VSUB(VMUL(LDK(KP195090322), T1r), VMUL(LDK(KP980785280), T1w));
+	       T1L = VADD(VMUL(LDK(KP831469612), T1C), VMUL(LDK(KP555570233), T1H));
+	       T1M = VSUB(T1K, T1L);
+	       T1N = VMUL(LDK(KP707106781), VSUB(T1J, T1M));
+	       STA(&(O[WS(os, 1)]), VSUB(T1m, T1N), ovs, &(O[0]));
+	       T1O = VMUL(LDK(KP707106781), VSUB(T17, T18));
+	       T1P = VADD(T13, T12);
+	       T1Q = VADD(T1O, T1P);
+	       T1R = VSUB(T1b, T1e);
+	       T1S = VSUB(T1i, T1j);
+	       T1T = VSUB(VMUL(LDK(KP382683432), T1R), VMUL(LDK(KP923879532), T1S));
+	       T1U = VSUB(T1Q, T1T);
+	       T1V = VSUB(T1n, T1q);
+	       T1W = VSUB(T1u, T1v);
+	       T1X = VSUB(VMUL(LDK(KP555570233), T1V), VMUL(LDK(KP831469612), T1W));
+	       T1Y = VSUB(T1y, T1B);
+	       T1Z = VSUB(T1F, T1G);
+	       T20 = VSUB(VMUL(LDK(KP195090322), T1Y), VMUL(LDK(KP980785280), T1Z));
+	       T21 = VADD(T1X, T20);
+	       STA(&(O[WS(os, 2)]), VSUB(T1U, T21), ovs, &(O[0]));
+	       T22 = VSUB(T1g, T1h);
+	       T23 = VSUB(T1c, T1d);
+	       T24 = VADD(T22, T23);
+	       T25 = VSUB(TO, TR);
+	       T26 = VMUL(LDK(KP707106781), VSUB(T24, T25));
+	       T27 = VSUB(T15, T16);
+	       T28 = VSUB(TY, TW);
+	       T29 = VADD(T27, T28);
+	       T2a = VADD(T26, T29);
+	       T2b = VSUB(Tz, TC);
+	       T2c = VSUB(T1D, T1E);
+	       T2d = VSUB(T1z, T1A);
+	       T2e = VADD(T2c, T2d);
+	       T2f = VSUB(T2b, T2e);
+	       T2g = VSUB(T1s, T1t);
+	       T2h = VSUB(T1o, T1p);
+	       T2i = VADD(T2g, T2h);
+	       T2j = VSUB(TG, TJ);
+	       T2k = VSUB(T2i, T2j);
+	       T2l = VSUB(VMUL(LDK(KP382683432), T2f), VMUL(LDK(KP923879532), T2k));
+	       STA(&(O[WS(os, 3)]), VSUB(T2a, T2l), ovs, &(O[0]));
+	       T2m = VSUB(T28, T27);
+	       T2n = VMUL(LDK(KP707106781), VADD(T24, T25));
+	       T2o = VSUB(T2m, T2n);
+	       T2p = VADD(T2b, T2e);
+	       T2q = VADD(T2i, T2j);
+	       T2r = VADD(VMUL(LDK(KP382683432), T2p), VMUL(LDK(KP923879532), T2q));
+	       STA(&(O[WS(os, 4)]), VSUB(T2o, T2r), ovs, &(O[0]));
+	       T2s = VADD(VMUL(LDK(KP831469612), T1V), VMUL(LDK(KP555570233), T1W));
+	       T2t = VADD(VMUL(LDK(KP980785280), T1Y), VMUL(LDK(KP195090322), T1Z));
+	       T2u = VADD(T2s, T2t);
+	       T2v = VSUB(T1X, T20);
+	       T2w = VMUL(LDK(KP707106781), VADD(T2u, T2v));
+	       T2x = VADD(VMUL(LDK(KP923879532), T1R), VMUL(LDK(KP382683432), T1S));
+	       T2y = VSUB(T1P, T1O);
+	       T2z = VADD(T2x, T2y);
+	       STA(&(O[WS(os, 5)]), VADD(T2w, T2z), ovs, &(O[0]));
+	       T2A = VADD(T1x, T1I);
+	       T2B = VSUB(VMUL(LDK(KP923879532), T1f), VMUL(LDK(KP382683432), T1k));
+	       T2C = VADD(T19, T14);
+	       T2D = VADD(T2B, T2C);
+	       STA(&(O[WS(os, 6)]), VADD(T2A, T2D), ovs, &(O[0]));
+	       T2E = VSUB(TZ, TV);
+	       T2F = VSUB(T22, T23);
+	       T2G = VSUB(T2E, T2F);
+	       T2H = VSUB(T2g, T2h);
+	       T2I = VSUB(T2c, T2d);
+	       T2J = VADD(T2H, T2I);
+	       T2K = VSUB(TD, TK);
+	       T2L = VMUL(LDK(KP707106781), VADD(T2J, T2K));
+	       STA(&(O[WS(os, 7)]), VSUB(T2G, T2L), ovs, &(O[0]));
+	       T2M = VMUL(LDK(KP707106781), VSUB(T2J, T2K));
+	       T2N = VADD(T2F, T2E);
+	       STA(&(O[WS(os, 8)]), VADD(T2M, T2N), ovs, &(O[0]));
+	       T2O = VSUB(T2C, T2B);
+	       T2P = VADD(T1K, T1L);
+	       STA(&(O[WS(os, 9)]), VSUB(T2O, T2P), ovs, &(O[0]));
+	       T2Q = VSUB(T2y, T2x);
+	       T2R = VMUL(LDK(KP707106781), VSUB(T2u, T2v));
+	       STA(&(O[WS(os, 10)]), VSUB(T2Q, T2R), ovs, &(O[0]));
+	       T2S = VSUB(VMUL(LDK(KP923879532), T2p), VMUL(LDK(KP382683432), T2q));
+	       T2T = VADD(T2n, T2m);
+	       STA(&(O[WS(os, 11)]), VADD(T2S, T2T), ovs, &(O[0]));
+	       T2U = VADD(VMUL(LDK(KP923879532), T2f), VMUL(LDK(KP382683432), T2k));
+	       T2V = VSUB(T29, T26);
+	       STA(&(O[WS(os, 12)]), VADD(T2U, T2V), ovs, &(O[0]));
+	       T2W = VADD(T1T, T1Q);
+	       T2X = VSUB(T2s, T2t);
+	       STA(&(O[WS(os, 13)]), VSUB(T2W, T2X), ovs, &(O[0]));
+	       T2Y = VADD(T1l, T1a);
+	       T2Z = VMUL(LDK(KP707106781), VADD(T1M, T1J));
+	       STA(&(O[WS(os, 14)]), VSUB(T2Y, T2Z), ovs, &(O[0]));
+	       T30 = VSUB(T2H, T2I);
+	       T31 = VSUB(T10, TS);
+	       STA(&(O[WS(os, 15)]), VADD(T30, T31), ovs, &(O[0]));
+	       STA(&(O[WS(os, 16)]), VSUB(T31, T30), ovs, &(O[0]));
+	       STA(&(O[WS(os, 17)]), VADD(T2Z, T2Y), ovs, &(O[0]));
+	       STA(&(O[WS(os, 18)]), VADD(T2X, T2W), ovs, &(O[0]));
+	       STA(&(O[WS(os, 19)]), VSUB(T2V, T2U), ovs, &(O[0]));
+	       STA(&(O[WS(os, 20)]), VSUB(T2T, T2S), ovs, &(O[0]));
+	       STA(&(O[WS(os, 21)]), VADD(T2R, T2Q), ovs, &(O[0]));
+	       STA(&(O[WS(os, 22)]), VADD(T2P, T2O), ovs, &(O[0]));
+	       STA(&(O[WS(os, 23)]), VSUB(T2N, T2M), ovs, &(O[0]));
+	       STA(&(O[WS(os, 24)]), VADD(T2L, T2G), ovs, &(O[0]));
+	       STA(&(O[WS(os, 25)]), VSUB(T2D, T2A), ovs, &(O[0]));
+	       STA(&(O[WS(os, 26)]), VSUB(T2z, T2w), ovs, &(O[0]));
+	       STA(&(O[WS(os, 27)]), VADD(T2r, T2o), ovs, &(O[0]));
+	       STA(&(O[WS(os, 28)]), VADD(T2l, T2a), ovs, &(O[0]));
+	       STA(&(O[WS(os, 29)]), VADD(T21, T1U), ovs, &(O[0]));
+	       STA(&(O[WS(os, 30)]), VADD(T1N, T1m), ovs, &(O[0]));
+	       STA(&(O[WS(os, 31)]), VSUB(T11, TL), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 32, XSIMD_STRING("e01v_32"), {186, 103, 0, 0}, &GENUS, REDFT01 };
+
+void XSIMD(codelet_e01v_32) (planner *p) {
+     X(kr2r_register) (p, e01v_32, &desc);
+}
+
+#endif
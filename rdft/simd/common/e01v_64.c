@@ -0,0 +1,1336 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e01v_64 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft01 -n 64 -name e01_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 476 FP additions, 270 FP multiplications,
+ * (or, 320 additions, 114 multiplications, 156 fused multiply/add),
+ * 436 stack variables, 78 constants, and 128 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e01v_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DVK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DVK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DVK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DVK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DVK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DVK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DVK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DVK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DVK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DVK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DVK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DVK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DVK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DVK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DVK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DVK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DVK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DVK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DVK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DVK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DVK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DVK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DVK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DVK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DVK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DVK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DVK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DVK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DVK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DVK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DVK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DVK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DVK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DVK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DVK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DVK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DVK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DVK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       V T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       V T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       V T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       V T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       V T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       V T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       V T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       V T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       V T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       V T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       V T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       V T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       V T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       V T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       V T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       V T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       V T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       V T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       V T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       V T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       V T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       V T6Z, T70, T71, T72;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = LDA(&(I[WS(is, 32)]), ivs, &(I[0]));
+	       Ty = LDA(&(I[WS(is, 33)]), ivs, &(I[0]));
+	       Tz = LDA(&(I[WS(is, 34)]), ivs, &(I[0]));
+	       TA = LDA(&(I[WS(is, 35)]), ivs, &(I[0]));
+	       TB = LDA(&(I[WS(is, 36)]), ivs, &(I[0]));
+	       TC = LDA(&(I[WS(is, 37)]), ivs, &(I[0]));
+	       TD = LDA(&(I[WS(is, 38)]), ivs, &(I[0]));
+	       TE = LDA(&(I[WS(is, 39)]), ivs, &(I[0]));
+	       TF = LDA(&(I[WS(is, 40)]), ivs, &(I[0]));
+	       TG = LDA(&(I[WS(is, 41)]), ivs, &(I[0]));
+	       TH = LDA(&(I[WS(is, 42)]), ivs, &(I[0]));
+	       TI = LDA(&(I[WS(is, 43)]), ivs, &(I[0]));
+	       TJ = LDA(&(I[WS(is, 44)]), ivs, &(I[0]));
+	       TK = LDA(&(I[WS(is, 45)]), ivs, &(I[0]));
+	       TL = LDA(&(I[WS(is, 46)]), ivs, &(I[0]));
+	       TM = LDA(&(I[WS(is, 47)]), ivs, &(I[0]));
+	       TN = LDA(&(I[WS(is, 48)]), ivs, &(I[0]));
+	       TO = LDA(&(I[WS(is, 49)]), ivs, &(I[0]));
+	       TP = LDA(&(I[WS(is, 50)]), ivs, &(I[0]));
+	       TQ = LDA(&(I[WS(is, 51)]), ivs, &(I[0]));
+	       TR = LDA(&(I[WS(is, 52)]), ivs, &(I[0]));
+	       TS = LDA(&(I[WS(is, 53)]), ivs, &(I[0]));
+	       TT = LDA(&(I[WS(is, 54)]), ivs, &(I[0]));
+	       TU = LDA(&(I[WS(is, 55)]), ivs, &(I[0]));
+	       TV = LDA(&(I[WS(is, 56)]), ivs, &(I[0]));
+	       TW = LDA(&(I[WS(is, 57)]), ivs, &(I[0]));
+	       TX = LDA(&(I[WS(is, 58)]), ivs, &(I[0]));
+	       TY = LDA(&(I[WS(is, 59)]), ivs, &(I[0]));
+	       TZ = LDA(&(I[WS(is, 60)]), ivs, &(I[0]));
+	       T10 = LDA(&(I[WS(is, 61)]), ivs, &(I[0]));
+	       T11 = LDA(&(I[WS(is, 62)]), ivs, &(I[0]));
+	       T12 = LDA(&(I[WS(is, 63)]), ivs, &(I[0]));
+	       T13 = VFMA(LDK(KP985796384), TI, VMUL(LDK(KP1_740173982), Tm));
+	       T14 = VFMA(LDK(KP533425514), TS, VMUL(LDK(KP1_927552131), Tc));
+	       T15 = VADD(T13, T14);
+	       T16 = VFMA(LDK(KP1_230463181), TC, VMUL(LDK(KP1_576692855), Ts));
+	       T17 = VFMA(LDK(KP244821350), TY, VMUL(LDK(KP1_984959069), T6));
+	       T18 = VADD(T16, T17);
+	       T19 = VADD(T15, T18);
+	       T1a = VFMA(LDK(KP899222659), TK, VMUL(LDK(KP1_786448602), Tk));
+	       T1b = VFMA(LDK(KP627363480), TQ, VMUL(LDK(KP1_899056361), Te));
+	       T1c = VADD(T1a, T1b);
+	       T1d = VFMA(LDK(KP1_306345685), TA, VMUL(LDK(KP1_514417693), Tu));
+	       T1e = VFMA(LDK(KP147129127), T10, VMUL(LDK(KP1_994580913), T4));
+	       T1f = VADD(T1d, T1e);
+	       T1g = VADD(T1c, T1f);
+	       T1h = VADD(T19, T1g);
+	       T1i = VFMA(LDK(KP1_069995239), TG, VMUL(LDK(KP1_689707130), To));
+	       T1j = VFMA(LDK(KP438202480), TU, VMUL(LDK(KP1_951404260), Ta));
+	       T1k = VADD(T1i, T1j);
+	       T1l = VFMA(LDK(KP1_151616382), TE, VMUL(LDK(KP1_635169626), Tq));
+	       T1m = VFMA(LDK(KP341923777), TW, VMUL(LDK(KP1_970555284), T8));
+	       T1n = VADD(T1l, T1m);
+	       T1o = VADD(T1k, T1n);
+	       T1p = VFMA(LDK(KP810482628), TM, VMUL(LDK(KP1_828419511), Ti));
+	       T1q = VFMA(LDK(KP719790073), TO, VMUL(LDK(KP1_865985597), Tg));
+	       T1r = VADD(T1p, T1q);
+	       T1s = VFMA(LDK(KP1_379081089), Ty, VMUL(LDK(KP1_448494165), Tw));
+	       T1t = VFMA(LDK(KP049082457), T12, VMUL(LDK(KP1_999397637), T2));
+	       T1u = VADD(T1s, T1t);
+	       T1v = VADD(T1r, T1u);
+	       T1w = VADD(T1o, T1v);
+	       T1x = VADD(T1h, T1w);
+	       T1y = VFMA(LDK(KP1_028205488), TH, VMUL(LDK(KP1_715457220), Tn));
+	       T1z = VFMA(LDK(KP485960359), TT, VMUL(LDK(KP1_940062506), Tb));
+	       T1A = VADD(T1y, T1z);
+	       T1B = VFMA(LDK(KP1_191398608), TD, VMUL(LDK(KP1_606415062), Tr));
+	       T1C = VFMA(LDK(KP293460948), TX, VMUL(LDK(KP1_978353019), T7));
+	       T1D = VADD(T1B, T1C);
+	       T1E = VADD(T1A, T1D);
+	       T1F = VFMA(LDK(KP855110186), TL, VMUL(LDK(KP1_807978586), Tj));
+	       T1G = VFMA(LDK(KP673779706), TP, VMUL(LDK(KP1_883088130), Tf));
+	       T1H = VADD(T1F, T1G);
+	       T1I = VFMA(LDK(KP1_343117909), Tz, VMUL(LDK(KP1_481902250), Tv));
+	       T1J = VFMA(LDK(KP098135348), T11, VMUL(LDK(KP1_997590912), T3));
+	       T1K = VADD(T1I, T1J);
+	       T1L = VADD(T1H, T1K);
+	       T1M = VADD(T1E, T1L);
+	       T1N = VFMA(LDK(KP942793473), TJ, VMUL(LDK(KP1_763842528), Tl));
+	       T1O = VFMA(LDK(KP580569354), TR, VMUL(LDK(KP1_913880671), Td));
+	       T1P = VADD(T1N, T1O);
+	       T1Q = VFMA(LDK(KP1_268786568), TB, VMUL(LDK(KP1_546020906), Tt));
+	       T1R = VFMA(LDK(KP196034280), TZ, VMUL(LDK(KP1_990369453), T5));
+	       T1S = VADD(T1Q, T1R);
+	       T1T = VADD(T1P, T1S);
+	       T1U = VFMA(LDK(KP1_111140466), TF, VMUL(LDK(KP1_662939224), Tp));
+	       T1V = VFMA(LDK(KP390180644), TV, VMUL(LDK(KP1_961570560), T9));
+	       T1W = VADD(T1U, T1V);
+	       T1X = VFMA(LDK(KP765366864), TN, VMUL(LDK(KP1_847759065), Th));
+	       T1Y = VFMA(LDK(KP1_414213562), Tx, T1);
+	       T1Z = VADD(T1X, T1Y);
+	       T20 = VADD(T1W, T1Z);
+	       T21 = VADD(T1T, T20);
+	       T22 = VADD(T1M, T21);
+	       STA(&(O[0]), VADD(T1x, T22), ovs, &(O[0]));
+	       T23 = VFNMS(LDK(KP1_414213562), Tx, T1);
+	       T24 = VFMS(LDK(KP1_847759065), TN, VMUL(LDK(KP765366864), Th));
+	       T25 = VSUB(T23, T24);
+	       T26 = VFMS(LDK(KP1_662939224), TF, VMUL(LDK(KP1_111140466), Tp));
+	       T27 = VFMS(LDK(KP1_961570560), TV, VMUL(LDK(KP390180644), T9));
+	       T28 = VADD(T26, T27);
+	       T29 = VSUB(T1U, T1V);
+	       T2a = VFNMS(LDK(KP707106781), VADD(T28, T29), T25);
+	       T2b = VFMS(LDK(KP1_763842528), TJ, VMUL(LDK(KP942793473), Tl));
+	       T2c = VFMS(LDK(KP1_913880671), TR, VMUL(LDK(KP580569354), Td));
+	       T2d = VADD(T2b, T2c);
+	       T2e = VSUB(T1Q, T1R);
+	       T2f = VADD(T2d, T2e);
+	       T2g = VSUB(T1N, T1O);
+	       T2h = VFMS(LDK(KP1_546020906), TB, VMUL(LDK(KP1_268786568), Tt));
+	       T2i = VFMS(LDK(KP1_990369453), TZ, VMUL(LDK(KP196034280), T5));
+	       T2j = VADD(T2h, T2i);
+	       T2k = VADD(T2g, T2j);
+	       T2l = VFMA(LDK(KP382683432), T2k, VMUL(LDK(KP923879532), T2f));
+	       T2m = VSUB(T2a, T2l);
+	       T2n = VFMS(LDK(KP1_715457220), TH, VMUL(LDK(KP1_028205488), Tn));
+	       T2o = VFMS(LDK(KP1_940062506), TT, VMUL(LDK(KP485960359), Tb));
+	       T2p = VADD(T2n, T2o);
+	       T2q = VSUB(T1B, T1C);
+	       T2r = VADD(T2p, T2q);
+	       T2s = VSUB(T1y, T1z);
+	       T2t = VFMS(LDK(KP1_606415062), TD, VMUL(LDK(KP1_191398608), Tr));
+	       T2u = VFMS(LDK(KP1_978353019), TX, VMUL(LDK(KP293460948), T7));
+	       T2v = VADD(T2t, T2u);
+	       T2w = VADD(T2s, T2v);
+	       T2x = VFMS(LDK(KP195090322), T2w, VMUL(LDK(KP980785280), T2r));
+	       T2y = VFMS(LDK(KP1_807978586), TL, VMUL(LDK(KP855110186), Tj));
+	       T2z = VFMS(LDK(KP1_883088130), TP, VMUL(LDK(KP673779706), Tf));
+	       T2A = VADD(T2y, T2z);
+	       T2B = VSUB(T1I, T1J);
+	       T2C = VADD(T2A, T2B);
+	       T2D = VSUB(T1F, T1G);
+	       T2E = VFMS(LDK(KP1_481902250), Tz, VMUL(LDK(KP1_343117909), Tv));
+	       T2F = VFMS(LDK(KP1_997590912), T11, VMUL(LDK(KP098135348), T3));
+	       T2G = VADD(T2E, T2F);
+	       T2H = VADD(T2D, T2G);
+	       T2I = VFMA(LDK(KP831469612), T2H, VMUL(LDK(KP555570233), T2C));
+	       T2J = VSUB(T2x, T2I);
+	       T2K = VFMA(LDK(KP980785280), T2w, VMUL(LDK(KP195090322), T2r));
+	       T2L = VFMS(LDK(KP555570233), T2H, VMUL(LDK(KP831469612), T2C));
+	       T2M = VSUB(T2K, T2L);
+	       T2N = VFMA(LDK(KP707106781), VSUB(T2J, T2M), T2m);
+	       T2O = VFMS(LDK(KP1_740173982), TI, VMUL(LDK(KP985796384), Tm));
+	       T2P = VFMS(LDK(KP1_927552131), TS, VMUL(LDK(KP533425514), Tc));
+	       T2Q = VADD(T2O, T2P);
+	       T2R = VSUB(T16, T17);
+	       T2S = VADD(T2Q, T2R);
+	       T2T = VSUB(T13, T14);
+	       T2U = VFMS(LDK(KP1_576692855), TC, VMUL(LDK(KP1_230463181), Ts));
+	       T2V = VFMS(LDK(KP1_984959069), TY, VMUL(LDK(KP244821350), T6));
+	       T2W = VADD(T2U, T2V);
+	       T2X = VADD(T2T, T2W);
+	       T2Y = VFMA(LDK(KP098017140), T2X, VMUL(LDK(KP995184726), T2S));
+	       T2Z = VFMS(LDK(KP1_786448602), TK, VMUL(LDK(KP899222659), Tk));
+	       T30 = VFMS(LDK(KP1_899056361), TQ, VMUL(LDK(KP627363480), Te));
+	       T31 = VADD(T2Z, T30);
+	       T32 = VSUB(T1d, T1e);
+	       T33 = VADD(T31, T32);
+	       T34 = VSUB(T1a, T1b);
+	       T35 = VFMS(LDK(KP1_514417693), TA, VMUL(LDK(KP1_306345685), Tu));
+	       T36 = VFMS(LDK(KP1_994580913), T10, VMUL(LDK(KP147129127), T4));
+	       T37 = VADD(T35, T36);
+	       T38 = VADD(T34, T37);
+	       T39 = VFMA(LDK(KP634393284), T38, VMUL(LDK(KP773010453), T33));
+	       T3a = VADD(T2Y, T39);
+	       T3b = VFMS(LDK(KP1_689707130), TG, VMUL(LDK(KP1_069995239), To));
+	       T3c = VFMS(LDK(KP1_951404260), TU, VMUL(LDK(KP438202480), Ta));
+	       T3d = VADD(T3b, T3c);
+	       T3e = VSUB(T1l, T1m);
+	       T3f = VADD(T3d, T3e);
+	       T3g = VSUB(T1i, T1j);
+	       T3h = VFMS(LDK(KP1_635169626), TE, VMUL(LDK(KP1_151616382), Tq));
+	       T3i = VFMS(LDK(KP1_970555284), TW, VMUL(LDK(KP341923777), T8));
+	       T3j = VADD(T3h, T3i);
+	       T3k = VADD(T3g, T3j);
+	       T3l = VFMA(LDK(KP881921264), T3k, VMUL(LDK(KP471396736), T3f));
+	       T3m = VFMS(LDK(KP1_828419511), TM, VMUL(LDK(KP810482628), Ti));
+	       T3n = VFMS(LDK(KP1_865985597), TO, VMUL(LDK(KP719790073), Tg));
+	       T3o = VADD(T3m, T3n);
+	       T3p = VSUB(T1s, T1t);
+	       T3q = VADD(T3o, T3p);
+	       T3r = VSUB(T1p, T1q);
+	       T3s = VFMS(LDK(KP1_448494165), Ty, VMUL(LDK(KP1_379081089), Tw));
+	       T3t = VFMS(LDK(KP1_999397637), T12, VMUL(LDK(KP049082457), T2));
+	       T3u = VADD(T3s, T3t);
+	       T3v = VADD(T3r, T3u);
+	       T3w = VFMS(LDK(KP290284677), T3v, VMUL(LDK(KP956940335), T3q));
+	       T3x = VSUB(T3l, T3w);
+	       T3y = VADD(T3a, T3x);
+	       T3z = VFMS(LDK(KP995184726), T2X, VMUL(LDK(KP098017140), T2S));
+	       T3A = VFMS(LDK(KP773010453), T38, VMUL(LDK(KP634393284), T33));
+	       T3B = VSUB(T3z, T3A);
+	       T3C = VFMS(LDK(KP471396736), T3k, VMUL(LDK(KP881921264), T3f));
+	       T3D = VFMA(LDK(KP956940335), T3v, VMUL(LDK(KP290284677), T3q));
+	       T3E = VSUB(T3C, T3D);
+	       T3F = VSUB(T3B, T3E);
+	       T3G = VFMA(LDK(KP382683432), T3F, VMUL(LDK(KP923879532), T3y));
+	       STA(&(O[WS(os, 1)]), VSUB(T2N, T3G), ovs, &(O[0]));
+	       T3H = VADD(T24, T23);
+	       T3I = VFMA(LDK(KP707106781), VSUB(T28, T29), T3H);
+	       T3J = VSUB(T2e, T2d);
+	       T3K = VSUB(T2g, T2j);
+	       T3L = VFMA(LDK(KP382683432), T3K, VMUL(LDK(KP923879532), T3J));
+	       T3M = VSUB(T3I, T3L);
+	       T3N = VSUB(T2p, T2q);
+	       T3O = VSUB(T2s, T2v);
+	       T3P = VFMS(LDK(KP555570233), T3O, VMUL(LDK(KP831469612), T3N));
+	       T3Q = VSUB(T2A, T2B);
+	       T3R = VSUB(T2D, T2G);
+	       T3S = VFMS(LDK(KP195090322), T3R, VMUL(LDK(KP980785280), T3Q));
+	       T3T = VADD(T3P, T3S);
+	       T3U = VSUB(T3M, T3T);
+	       T3V = VSUB(T2Q, T2R);
+	       T3W = VSUB(T2T, T2W);
+	       T3X = VFMS(LDK(KP471396736), T3W, VMUL(LDK(KP881921264), T3V));
+	       T3Y = VSUB(T31, T32);
+	       T3Z = VSUB(T34, T37);
+	       T40 = VFMS(LDK(KP290284677), T3Z, VMUL(LDK(KP956940335), T3Y));
+	       T41 = VADD(T3X, T40);
+	       T42 = VSUB(T3d, T3e);
+	       T43 = VSUB(T3g, T3j);
+	       T44 = VFMS(LDK(KP634393284), T43, VMUL(LDK(KP773010453), T42));
+	       T45 = VSUB(T3o, T3p);
+	       T46 = VSUB(T3r, T3u);
+	       T47 = VFMS(LDK(KP098017140), T46, VMUL(LDK(KP995184726), T45));
+	       T48 = VADD(T44, T47);
+	       T49 = VADD(T41, T48);
+	       STA(&(O[WS(os, 2)]), VSUB(T3U, T49), ovs, &(O[0]));
+	       T4a = VSUB(T26, T27);
+	       T4b = VSUB(T1Y, T1X);
+	       T4c = VADD(T4a, T4b);
+	       T4d = VSUB(T2b, T2c);
+	       T4e = VSUB(T2h, T2i);
+	       T4f = VADD(T4d, T4e);
+	       T4g = VSUB(T1P, T1S);
+	       T4h = VFMA(LDK(KP707106781), VSUB(T4f, T4g), T4c);
+	       T4i = VSUB(T2n, T2o);
+	       T4j = VSUB(T2t, T2u);
+	       T4k = VADD(T4i, T4j);
+	       T4l = VSUB(T1H, T1K);
+	       T4m = VSUB(T4k, T4l);
+	       T4n = VSUB(T1A, T1D);
+	       T4o = VSUB(T2y, T2z);
+	       T4p = VSUB(T2E, T2F);
+	       T4q = VADD(T4o, T4p);
+	       T4r = VSUB(T4n, T4q);
+	       T4s = VFMS(LDK(KP382683432), T4r, VMUL(LDK(KP923879532), T4m));
+	       T4t = VSUB(T4h, T4s);
+	       T4u = VSUB(T2O, T2P);
+	       T4v = VSUB(T2U, T2V);
+	       T4w = VADD(T4u, T4v);
+	       T4x = VSUB(T1c, T1f);
+	       T4y = VSUB(T4w, T4x);
+	       T4z = VSUB(T15, T18);
+	       T4A = VSUB(T2Z, T30);
+	       T4B = VSUB(T35, T36);
+	       T4C = VADD(T4A, T4B);
+	       T4D = VSUB(T4z, T4C);
+	       T4E = VFMA(LDK(KP195090322), T4D, VMUL(LDK(KP980785280), T4y));
+	       T4F = VSUB(T3b, T3c);
+	       T4G = VSUB(T3h, T3i);
+	       T4H = VADD(T4F, T4G);
+	       T4I = VSUB(T1r, T1u);
+	       T4J = VSUB(T4H, T4I);
+	       T4K = VSUB(T1k, T1n);
+	       T4L = VSUB(T3m, T3n);
+	       T4M = VSUB(T3s, T3t);
+	       T4N = VADD(T4L, T4M);
+	       T4O = VSUB(T4K, T4N);
+	       T4P = VFMS(LDK(KP831469612), T4O, VMUL(LDK(KP555570233), T4J));
+	       T4Q = VSUB(T4E, T4P);
+	       T4R = VFMS(LDK(KP980785280), T4D, VMUL(LDK(KP195090322), T4y));
+	       T4S = VFMA(LDK(KP555570233), T4O, VMUL(LDK(KP831469612), T4J));
+	       T4T = VSUB(T4R, T4S);
+	       STA(&(O[WS(os, 3)]), VFMA(LDK(KP707106781), VSUB(T4Q, T4T), T4t), ovs, &(O[0]));
+	       T4U = VSUB(T4b, T4a);
+	       T4V = VFNMS(LDK(KP707106781), VADD(T4f, T4g), T4U);
+	       T4W = VADD(T4k, T4l);
+	       T4X = VADD(T4n, T4q);
+	       T4Y = VFMA(LDK(KP382683432), T4X, VMUL(LDK(KP923879532), T4W));
+	       T4Z = VSUB(T4V, T4Y);
+	       T50 = VADD(T4w, T4x);
+	       T51 = VADD(T4z, T4C);
+	       T52 = VFMA(LDK(KP555570233), T51, VMUL(LDK(KP831469612), T50));
+	       T53 = VADD(T4H, T4I);
+	       T54 = VADD(T4K, T4N);
+	       T55 = VFMA(LDK(KP195090322), T54, VMUL(LDK(KP980785280), T53));
+	       T56 = VADD(T52, T55);
+	       STA(&(O[WS(os, 4)]), VSUB(T4Z, T56), ovs, &(O[0]));
+	       T57 = VFMA(LDK(KP881921264), T3W, VMUL(LDK(KP471396736), T3V));
+	       T58 = VFMA(LDK(KP956940335), T3Z, VMUL(LDK(KP290284677), T3Y));
+	       T59 = VADD(T57, T58);
+	       T5a = VSUB(T44, T47);
+	       T5b = VADD(T59, T5a);
+	       T5c = VSUB(T3X, T40);
+	       T5d = VFMA(LDK(KP773010453), T43, VMUL(LDK(KP634393284), T42));
+	       T5e = VFMA(LDK(KP995184726), T46, VMUL(LDK(KP098017140), T45));
+	       T5f = VADD(T5d, T5e);
+	       T5g = VADD(T5c, T5f);
+	       T5h = VFMA(LDK(KP382683432), T5g, VMUL(LDK(KP923879532), T5b));
+	       T5i = VFNMS(LDK(KP707106781), VSUB(T28, T29), T3H);
+	       T5j = VFMS(LDK(KP382683432), T3J, VMUL(LDK(KP923879532), T3K));
+	       T5k = VSUB(T5i, T5j);
+	       T5l = VFMA(LDK(KP831469612), T3O, VMUL(LDK(KP555570233), T3N));
+	       T5m = VFMA(LDK(KP980785280), T3R, VMUL(LDK(KP195090322), T3Q));
+	       T5n = VADD(T5l, T5m);
+	       T5o = VSUB(T3P, T3S);
+	       T5p = VFMA(LDK(KP707106781), VADD(T5n, T5o), T5k);
+	       STA(&(O[WS(os, 5)]), VADD(T5h, T5p), ovs, &(O[0]));
+	       T5q = VADD(T3z, T3A);
+	       T5r = VADD(T3l, T3w);
+	       T5s = VADD(T5q, T5r);
+	       T5t = VADD(T2K, T2L);
+	       T5u = VFMS(LDK(KP923879532), T2k, VMUL(LDK(KP382683432), T2f));
+	       T5v = VFMA(LDK(KP707106781), VADD(T28, T29), T25);
+	       T5w = VADD(T5u, T5v);
+	       T5x = VADD(T5t, T5w);
+	       STA(&(O[WS(os, 6)]), VADD(T5s, T5x), ovs, &(O[0]));
+	       T5y = VSUB(T1Z, T1W);
+	       T5z = VSUB(T4d, T4e);
+	       T5A = VSUB(T5y, T5z);
+	       T5B = VSUB(T4i, T4j);
+	       T5C = VSUB(T4o, T4p);
+	       T5D = VADD(T5B, T5C);
+	       T5E = VSUB(T1E, T1L);
+	       T5F = VFNMS(LDK(KP707106781), VADD(T5D, T5E), T5A);
+	       T5G = VSUB(T4u, T4v);
+	       T5H = VSUB(T4A, T4B);
+	       T5I = VADD(T5G, T5H);
+	       T5J = VSUB(T1o, T1v);
+	       T5K = VADD(T5I, T5J);
+	       T5L = VSUB(T19, T1g);
+	       T5M = VSUB(T4F, T4G);
+	       T5N = VSUB(T4L, T4M);
+	       T5O = VADD(T5M, T5N);
+	       T5P = VADD(T5L, T5O);
+	       T5Q = VFMA(LDK(KP382683432), T5P, VMUL(LDK(KP923879532), T5K));
+	       STA(&(O[WS(os, 7)]), VSUB(T5F, T5Q), ovs, &(O[0]));
+	       T5R = VADD(T5z, T5y);
+	       T5S = VFMA(LDK(KP707106781), VSUB(T5D, T5E), T5R);
+	       T5T = VSUB(T5I, T5J);
+	       T5U = VSUB(T5L, T5O);
+	       T5V = VFMS(LDK(KP382683432), T5U, VMUL(LDK(KP923879532), T5T));
+	       STA(&(O[WS(os, 8)]), VSUB(T5S, T5V), ovs, &(O[0]));
+	       T5W = VSUB(T5v, T5u);
+	       T5X = VADD(T2x, T2I);
+	       T5Y = VSUB(T5W, T5X);
+	       T5Z = VSUB(T5q, T5r);
+	       T60 = VSUB(T2Y, T39);
+	       T61 = VADD(T3C, T3D);
+	       T62 = VSUB(T60, T61);
+	       STA(&(O[WS(os, 9)]), VFNMS(LDK(KP707106781), VSUB(T5Z, T62), T5Y), ovs, &(O[0]));
+	       T63 = VADD(T5j, T5i);
+	       T64 = VFNMS(LDK(KP707106781), VSUB(T5n, T5o), T63);
+	       T65 = VSUB(T5c, T5f);
+	       T66 = VSUB(T59, T5a);
+	       T67 = VFMS(LDK(KP923879532), T66, VMUL(LDK(KP382683432), T65));
+	       STA(&(O[WS(os, 10)]), VSUB(T64, T67), ovs, &(O[0]));
+	       T68 = VFMS(LDK(KP923879532), T4X, VMUL(LDK(KP382683432), T4W));
+	       T69 = VFMA(LDK(KP707106781), VADD(T4f, T4g), T4U);
+	       T6a = VADD(T68, T69);
+	       T6b = VFMS(LDK(KP831469612), T51, VMUL(LDK(KP555570233), T50));
+	       T6c = VFMS(LDK(KP980785280), T54, VMUL(LDK(KP195090322), T53));
+	       T6d = VADD(T6b, T6c);
+	       T6e = VSUB(T52, T55);
+	       STA(&(O[WS(os, 11)]), VFMA(LDK(KP707106781), VADD(T6d, T6e), T6a), ovs, &(O[0]));
+	       T6f = VADD(T4R, T4S);
+	       T6g = VFMA(LDK(KP923879532), T4r, VMUL(LDK(KP382683432), T4m));
+	       T6h = VFNMS(LDK(KP707106781), VSUB(T4f, T4g), T4c);
+	       T6i = VADD(T6g, T6h);
+	       STA(&(O[WS(os, 12)]), VADD(T6f, T6i), ovs, &(O[0]));
+	       T6j = VADD(T3I, T3L);
+	       T6k = VSUB(T5l, T5m);
+	       T6l = VSUB(T6j, T6k);
+	       T6m = VSUB(T57, T58);
+	       T6n = VSUB(T5d, T5e);
+	       T6o = VADD(T6m, T6n);
+	       T6p = VSUB(T41, T48);
+	       STA(&(O[WS(os, 13)]), VFNMS(LDK(KP707106781), VSUB(T6o, T6p), T6l), ovs, &(O[0]));
+	       T6q = VADD(T2l, T2a);
+	       T6r = VFNMS(LDK(KP707106781), VADD(T2J, T2M), T6q);
+	       T6s = VSUB(T3a, T3x);
+	       T6t = VADD(T3B, T3E);
+	       T6u = VFMS(LDK(KP382683432), T6t, VMUL(LDK(KP923879532), T6s));
+	       STA(&(O[WS(os, 14)]), VSUB(T6r, T6u), ovs, &(O[0]));
+	       T6v = VSUB(T5B, T5C);
+	       T6w = VSUB(T20, T1T);
+	       T6x = VADD(T6v, T6w);
+	       T6y = VSUB(T5G, T5H);
+	       T6z = VSUB(T5M, T5N);
+	       T6A = VADD(T6y, T6z);
+	       T6B = VSUB(T1h, T1w);
+	       STA(&(O[WS(os, 15)]), VFMA(LDK(KP707106781), VSUB(T6A, T6B), T6x), ovs, &(O[0]));
+	       T6C = VSUB(T6w, T6v);
+	       STA(&(O[WS(os, 16)]), VFNMS(LDK(KP707106781), VADD(T6A, T6B), T6C), ovs, &(O[0]));
+	       T6D = VFMA(LDK(KP923879532), T6t, VMUL(LDK(KP382683432), T6s));
+	       T6E = VFMA(LDK(KP707106781), VADD(T2J, T2M), T6q);
+	       STA(&(O[WS(os, 17)]), VADD(T6D, T6E), ovs, &(O[0]));
+	       T6F = VADD(T6k, T6j);
+	       STA(&(O[WS(os, 18)]), VFMA(LDK(KP707106781), VADD(T6o, T6p), T6F), ovs, &(O[0]));
+	       T6G = VSUB(T6h, T6g);
+	       T6H = VADD(T4E, T4P);
+	       STA(&(O[WS(os, 19)]), VSUB(T6G, T6H), ovs, &(O[0]));
+	       T6I = VSUB(T69, T68);
+	       STA(&(O[WS(os, 20)]), VFNMS(LDK(KP707106781), VSUB(T6d, T6e), T6I), ovs, &(O[0]));
+	       T6J = VFMA(LDK(KP707106781), VSUB(T5n, T5o), T63);
+	       T6K = VFMA(LDK(KP923879532), T65, VMUL(LDK(KP382683432), T66));
+	       STA(&(O[WS(os, 21)]), VSUB(T6J, T6K), ovs, &(O[0]));
+	       T6L = VADD(T5X, T5W);
+	       STA(&(O[WS(os, 22)]), VFNMS(LDK(KP707106781), VADD(T62, T5Z), T6L), ovs, &(O[0]));
+	       T6M = VFMA(LDK(KP923879532), T5U, VMUL(LDK(KP382683432), T5T));
+	       T6N = VFNMS(LDK(KP707106781), VSUB(T5D, T5E), T5R);
+	       STA(&(O[WS(os, 23)]), VADD(T6M, T6N), ovs, &(O[0]));
+	       T6O = VFMS(LDK(KP923879532), T5P, VMUL(LDK(KP382683432), T5K));
+	       T6P = VFMA(LDK(KP707106781), VADD(T5D, T5E), T5A);
+	       STA(&(O[WS(os, 24)]), VADD(T6O, T6P), ovs, &(O[0]));
+	       T6Q = VSUB(T5w, T5t);
+	       T6R = VADD(T60, T61);
+	       STA(&(O[WS(os, 25)]), VSUB(T6Q, T6R), ovs, &(O[0]));
+	       T6S = VFNMS(LDK(KP707106781), VADD(T5n, T5o), T5k);
+	       T6T = VFMS(LDK(KP923879532), T5g, VMUL(LDK(KP382683432), T5b));
+	       STA(&(O[WS(os, 26)]), VSUB(T6S, T6T), ovs, &(O[0]));
+	       T6U = VADD(T4Y, T4V);
+	       T6V = VSUB(T6b, T6c);
+	       STA(&(O[WS(os, 27)]), VSUB(T6U, T6V), ovs, &(O[0]));
+	       T6W = VADD(T4s, T4h);
+	       STA(&(O[WS(os, 28)]), VFNMS(LDK(KP707106781), VADD(T4Q, T4T), T6W), ovs, &(O[0]));
+	       T6X = VSUB(T6m, T6n);
+	       T6Y = VADD(T3T, T3M);
+	       STA(&(O[WS(os, 29)]), VADD(T6X, T6Y), ovs, &(O[0]));
+	       T6Z = VFNMS(LDK(KP707106781), VSUB(T2J, T2M), T2m);
+	       T70 = VFMS(LDK(KP382683432), T3y, VMUL(LDK(KP923879532), T3F));
+	       STA(&(O[WS(os, 30)]), VSUB(T6Z, T70), ovs, &(O[0]));
+	       T71 = VSUB(T21, T1M);
+	       T72 = VSUB(T6y, T6z);
+	       STA(&(O[WS(os, 31)]), VSUB(T71, T72), ovs, &(O[0]));
+	       STA(&(O[WS(os, 32)]), VADD(T72, T71), ovs, &(O[0]));
+	       STA(&(O[WS(os, 33)]), VADD(T70, T6Z), ovs, &(O[0]));
+	       STA(&(O[WS(os, 34)]), VSUB(T6Y, T6X), ovs, &(O[0]));
+	       STA(&(O[WS(os, 35)]), VFMA(LDK(KP707106781), VADD(T4Q, T4T), T6W), ovs, &(O[0]));
+	       STA(&(O[WS(os, 36)]), VADD(T6V, T6U), ovs, &(O[0]));
+	       STA(&(O[WS(os, 37)]), VADD(T6T, T6S), ovs, &(O[0]));
+	       STA(&(O[WS(os, 38)]), VADD(T6R, T6Q), ovs, &(O[0]));
+	       STA(&(O[WS(os, 39)]), VSUB(T6P, T6O), ovs, &(O[0]));
+	       STA(&(O[WS(os, 40)]), VSUB(T6N, T6M), ovs, &(O[0]));
+	       STA(&(O[WS(os, 41)]), VFMA(LDK(KP707106781), VADD(T62, T5Z), T6L), ovs, &(O[0]));
+	       STA(&(O[WS(os, 42)]), VADD(T6K, T6J), ovs, &(O[0]));
+	       STA(&(O[WS(os, 43)]), VFMA(LDK(KP707106781), VSUB(T6d, T6e), T6I), ovs, &(O[0]));
+	       STA(&(O[WS(os, 44)]), VADD(T6H, T6G), ovs, &(O[0]));
+	       STA(&(O[WS(os, 45)]), VFNMS(LDK(KP707106781), VADD(T6o, T6p), T6F), ovs, &(O[0]));
+	       STA(&(O[WS(os, 46)]), VSUB(T6E, T6D), ovs, &(O[0]));
+	       STA(&(O[WS(os, 47)]), VFMA(LDK(KP707106781), VADD(T6A, T6B), T6C), ovs, &(O[0]));
+	       STA(&(O[WS(os, 48)]), VFNMS(LDK(KP707106781), VSUB(T6A, T6B), T6x), ovs, &(O[0]));
+	       STA(&(O[WS(os, 49)]), VADD(T6u, T6r), ovs, &(O[0]));
+	       STA(&(O[WS(os, 50)]), VFMA(LDK(KP707106781), VSUB(T6o, T6p), T6l), ovs, &(O[0]));
+	       STA(&(O[WS(os, 51)]), VSUB(T6i, T6f), ovs, &(O[0]));
+	       STA(&(O[WS(os, 52)]), VFNMS(LDK(KP707106781), VADD(T6d, T6e), T6a), ovs, &(O[0]));
+	       STA(&(O[WS(os, 53)]), VADD(T67, T64), ovs, &(O[0]));
+	       STA(&(O[WS(os, 54)]), VFMA(LDK(KP707106781), VSUB(T5Z, T62), T5Y), ovs, &(O[0]));
+	       STA(&(O[WS(os, 55)]), VADD(T5V, T5S), ovs, &(O[0]));
+	       STA(&(O[WS(os, 56)]), VADD(T5Q, T5F), ovs, &(O[0]));
+	       STA(&(O[WS(os, 57)]), VSUB(T5x, T5s), ovs, &(O[0]));
+	       STA(&(O[WS(os, 58)]), VSUB(T5p, T5h), ovs, &(O[0]));
+	       STA(&(O[WS(os, 59)]), VADD(T56, T4Z), ovs, &(O[0]));
+	       STA(&(O[WS(os, 60)]), VFNMS(LDK(KP707106781), VSUB(T4Q, T4T), T4t), ovs, &(O[0]));
+	       STA(&(O[WS(os, 61)]), VADD(T49, T3U), ovs, &(O[0]));
+	       STA(&(O[WS(os, 62)]), VADD(T3G, T2N), ovs, &(O[0]));
+	       STA(&(O[WS(os, 63)]), VSUB(T22, T1x), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 64, XSIMD_STRING("e01v_64"), {320, 114, 156, 0}, &GENUS, REDFT01 };
+
+void XSIMD(codelet_e01v_64) (planner *p) {
+     X(kr2r_register) (p, e01v_64, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e01v_64 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft01 -n 64 -name e01_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 456 FP additions, 249 FP multiplications,
+ * (or, 456 additions, 249 multiplications, 0 fused multiply/add),
+ * 457 stack variables, 78 constants, and 128 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e01v_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DVK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DVK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DVK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DVK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DVK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DVK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DVK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DVK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DVK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DVK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DVK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DVK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DVK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DVK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DVK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DVK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DVK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DVK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DVK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DVK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DVK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DVK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DVK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DVK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DVK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DVK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DVK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DVK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DVK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DVK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DVK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DVK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DVK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DVK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DVK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DVK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DVK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DVK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       V T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       V T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       V T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       V T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       V T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       V T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       V T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       V T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       V T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       V T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       V T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       V T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       V T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       V T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       V T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       V T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       V T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       V T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       V T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       V T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       V T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       V T6Z, T70, T71, T72, T73, T74, T75, T76, T77, T78, T79, T7a;
+	       V T7b, T7c, T7d, T7e, T7f, T7g, T7h, T7i, T7j, T7k, T7l, T7m;
+	       V T7n;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = LDA(&(I[WS(is, 32)]), ivs, &(I[0]));
+	       Ty = LDA(&(I[WS(is, 33)]), ivs, &(I[0]));
+	       Tz = LDA(&(I[WS(is, 34)]), ivs, &(I[0]));
+	       TA = LDA(&(I[WS(is, 35)]), ivs, &(I[0]));
+	       TB = LDA(&(I[WS(is, 36)]), ivs, &(I[0]));
+	       TC = LDA(&(I[WS(is, 37)]), ivs, &(I[0]));
+	       TD = LDA(&(I[WS(is, 38)]), ivs, &(I[0]));
+	       TE = LDA(&(I[WS(is, 39)]), ivs, &(I[0]));
+	       TF = LDA(&(I[WS(is, 40)]), ivs, &(I[0]));
+	       TG = LDA(&(I[WS(is, 41)]), ivs, &(I[0]));
+	       TH = LDA(&(I[WS(is, 42)]), ivs, &(I[0]));
+	       TI = LDA(&(I[WS(is, 43)]), ivs, &(I[0]));
+	       TJ = LDA(&(I[WS(is, 44)]), ivs, &(I[0]));
+	       TK = LDA(&(I[WS(is, 45)]), ivs, &(I[0]));
+	       TL = LDA(&(I[WS(is, 46)]), ivs, &(I[0]));
+	       TM = LDA(&(I[WS(is, 47)]), ivs, &(I[0]));
+	       TN = LDA(&(I[WS(is, 48)]), ivs, &(I[0]));
+	       TO = LDA(&(I[WS(is, 49)]), ivs, &(I[0]));
+	       TP = LDA(&(I[WS(is, 50)]), ivs, &(I[0]));
+	       TQ = LDA(&(I[WS(is, 51)]), ivs, &(I[0]));
+	       TR = LDA(&(I[WS(is, 52)]), ivs, &(I[0]));
+	       TS = LDA(&(I[WS(is, 53)]), ivs, &(I[0]));
+	       TT = LDA(&(I[WS(is, 54)]), ivs, &(I[0]));
+	       TU = LDA(&(I[WS(is, 55)]), ivs, &(I[0]));
+	       TV = LDA(&(I[WS(is, 56)]), ivs, &(I[0]));
+	       TW = LDA(&(I[WS(is, 57)]), ivs, &(I[0]));
+	       TX = LDA(&(I[WS(is, 58)]), ivs, &(I[0]));
+	       TY = LDA(&(I[WS(is, 59)]), ivs, &(I[0]));
+	       TZ = LDA(&(I[WS(is, 60)]), ivs, &(I[0]));
+	       T10 = LDA(&(I[WS(is, 61)]), ivs, &(I[0]));
+	       T11 = LDA(&(I[WS(is, 62)]), ivs, &(I[0]));
+	       T12 = LDA(&(I[WS(is, 63)]), ivs, &(I[0]));
+	       T13 = VADD(VMUL(LDK(KP985796384), TI), VMUL(LDK(KP1_740173982), Tm));
+	       T14 = VADD(VMUL(LDK(KP533425514), TS), VMUL(LDK(KP1_927552131), Tc));
+	       T15 = VADD(T13, T14);
+	       T16 = VADD(VMUL(LDK(KP1_230463181), TC), VMUL(LDK(KP1_576692855), Ts));
+	       T17 = VADD(VMUL(LDK(KP244821350), TY), VMUL(LDK(KP1_984959069), T6));
+	       T18 = VADD(T16, T17);
+	       T19 = VADD(T15, T18);
+	       T1a = VADD(VMUL(LDK(KP899222659), TK), VMUL(LDK(KP1_786448602), Tk));
+	       T1b = VADD(VMUL(LDK(KP627363480), TQ), VMUL(LDK(KP1_899056361), Te));
+	       T1c = VADD(T1a, T1b);
+	       T1d = VADD(VMUL(LDK(KP1_306345685), TA), VMUL(LDK(KP1_514417693), Tu));
+	       T1e = VADD(VMUL(LDK(KP147129127), T10), VMUL(LDK(KP1_994580913), T4));
+	       T1f = VADD(T1d, T1e);
+	       T1g = VADD(T1c, T1f);
+	       T1h = VADD(T19, T1g);
+	       T1i = VADD(VMUL(LDK(KP1_069995239), TG), VMUL(LDK(KP1_689707130), To));
+	       T1j = VADD(VMUL(LDK(KP438202480), TU), VMUL(LDK(KP1_951404260), Ta));
+	       T1k = VADD(T1i, T1j);
+	       T1l = VADD(VMUL(LDK(KP1_151616382), TE), VMUL(LDK(KP1_635169626), Tq));
+	       T1m = VADD(VMUL(LDK(KP341923777), TW), VMUL(LDK(KP1_970555284), T8));
+	       T1n = VADD(T1l, T1m);
+	       T1o = VADD(T1k, T1n);
+	       T1p = VADD(VMUL(LDK(KP810482628), TM), VMUL(LDK(KP1_828419511), Ti));
+	       T1q = VADD(VMUL(LDK(KP719790073), TO), VMUL(LDK(KP1_865985597), Tg));
+	       T1r = VADD(T1p, T1q);
+	       T1s = VADD(VMUL(LDK(KP1_379081089), Ty), VMUL(LDK(KP1_448494165), Tw));
+	       T1t = VADD(VMUL(LDK(KP049082457), T12), VMUL(LDK(KP1_999397637), T2));
+	       T1u = VADD(T1s, T1t);
+	       T1v = VADD(T1r, T1u);
+	       T1w = VADD(T1o, T1v);
+	       T1x = VADD(T1h, T1w);
+	       T1y = VADD(VMUL(LDK(KP1_028205488), TH), VMUL(LDK(KP1_715457220), Tn));
+	       T1z = VADD(VMUL(LDK(KP485960359), TT), VMUL(LDK(KP1_940062506), Tb));
+	       T1A = VADD(T1y, T1z);
+	       T1B = VADD(VMUL(LDK(KP1_191398608), TD), VMUL(LDK(KP1_606415062), Tr));
+	       T1C = VADD(VMUL(LDK(KP293460948), TX), VMUL(LDK(KP1_978353019), T7));
+	       T1D = VADD(T1B, T1C);
+	       T1E = VADD(T1A, T1D);
+	       T1F = VADD(VMUL(LDK(KP855110186), TL), VMUL(LDK(KP1_807978586), Tj));
+	       T1G = VADD(VMUL(LDK(KP673779706), TP), VMUL(LDK(KP1_883088130), Tf));
+	       T1H = VADD(T1F, T1G);
+	       T1I = VADD(VMUL(LDK(KP1_343117909), Tz), VMUL(LDK(KP1_481902250), Tv));
+	       T1J = VADD(VMUL(LDK(KP098135348), T11), VMUL(LDK(KP1_997590912), T3));
+	       T1K = VADD(T1I, T1J);
+	       T1L = VADD(T1H, T1K);
+	       T1M = VADD(T1E, T1L);
+	       T1N = VADD(VMUL(LDK(KP942793473), TJ), VMUL(LDK(KP1_763842528), Tl));
+	       T1O = VADD(VMUL(LDK(KP580569354), TR), VMUL(LDK(KP1_913880671), Td));
+	       T1P = VADD(T1N, T1O);
+	       T1Q = VADD(VMUL(LDK(KP1_268786568), TB), VMUL(LDK(KP1_546020906), Tt));
+	       T1R = VADD(VMUL(LDK(KP196034280), TZ), VMUL(LDK(KP1_990369453), T5));
+	       T1S = VADD(T1Q, T1R);
+	       T1T = VADD(T1P, T1S);
+	       T1U = VADD(VMUL(LDK(KP1_111140466), TF), VMUL(LDK(KP1_662939224), Tp));
+	       T1V = VADD(VMUL(LDK(KP390180644), TV), VMUL(LDK(KP1_961570560), T9));
+	       T1W = VADD(T1U, T1V);
+	       T1X = VADD(VMUL(LDK(KP765366864), TN), VMUL(LDK(KP1_847759065), Th));
+	       T1Y = VMUL(LDK(KP1_414213562), Tx);
+	       T1Z = VADD(T1, T1Y);
+	       T20 = VADD(T1X, T1Z);
+	       T21 = VADD(T1W, T20);
+	       T22 = VADD(T1T, T21);
+	       T23 = VADD(T1M, T22);
+	       STA(&(O[0]), VADD(T1x, T23), ovs, &(O[0]));
+	       T24 = VSUB(T1y, T1z);
+	       T25 = VSUB(VMUL(LDK(KP1_606415062), TD), VMUL(LDK(KP1_191398608), Tr));
+	       T26 = VSUB(VMUL(LDK(KP1_978353019), TX), VMUL(LDK(KP293460948), T7));
+	       T27 = VADD(T25, T26);
+	       T28 = VADD(T24, T27);
+	       T29 = VSUB(VMUL(LDK(KP1_715457220), TH), VMUL(LDK(KP1_028205488), Tn));
+	       T2a = VSUB(VMUL(LDK(KP1_940062506), TT), VMUL(LDK(KP485960359), Tb));
+	       T2b = VADD(T29, T2a);
+	       T2c = VSUB(T1B, T1C);
+	       T2d = VADD(T2b, T2c);
+	       T2e = VSUB(VMUL(LDK(KP195090322), T28), VMUL(LDK(KP980785280), T2d));
+	       T2f = VSUB(T1F, T1G);
+	       T2g = VSUB(VMUL(LDK(KP1_481902250), Tz), VMUL(LDK(KP1_343117909), Tv));
+	       T2h = VSUB(VMUL(LDK(KP1_997590912), T11), VMUL(LDK(KP098135348), T3));
+	       T2i = VADD(T2g, T2h);
+	       T2j = VADD(T2f, T2i);
+	       T2k = VSUB(VMUL(LDK(KP1_807978586), TL), VMUL(LDK(KP855110186), Tj));
+	       T2l = VSUB(VMUL(LDK(KP1_883088130), TP), VMUL(LDK(KP673779706), Tf));
+	       T2m = VADD(T2k, T2l);
+	       T2n = VSUB(T1I, T1J);
+	       T2o = VADD(T2m, T2n);
+	       T2p = VADD(VMUL(LDK(KP831469612), T2j), VMUL(LDK(KP555570233), T2o));
+	       T2q = VSUB(T2e, T2p);
+	       T2r = VADD(VMUL(LDK(KP980785280), T28), VMUL(LDK(KP195090322), T2d));
+	       T2s = VSUB(VMUL(LDK(KP555570233), T2j), VMUL(LDK(KP831469612), T2o));
+	       T2t = VSUB(T2r, T2s);
+	       T2u = VMUL(LDK(KP707106781), VSUB(T2q, T2t));
+	       T2v = VSUB(T1, T1Y);
+	       T2w = VSUB(VMUL(LDK(KP1_847759065), TN), VMUL(LDK(KP765366864), Th));
+	       T2x = VSUB(T2v, T2w);
+	       T2y = VSUB(VMUL(LDK(KP1_662939224), TF), VMUL(LDK(KP1_111140466), Tp));
+	       T2z = VSUB(VMUL(LDK(KP1_961570560), TV), VMUL(LDK(KP390180644), T9));
+	       T2A = VADD(T2y, T2z);
+	       T2B = VSUB(T1U, T1V);
+	       T2C = VMUL(LDK(KP707106781), VADD(T2A, T2B));
+	       T2D = VSUB(T2x, T2C);
+	       T2E = VSUB(T1N, T1O);
+	       T2F = VSUB(VMUL(LDK(KP1_546020906), TB), VMUL(LDK(KP1_268786568), Tt));
+	       T2G = VSUB(VMUL(LDK(KP1_990369453), TZ), VMUL(LDK(KP196034280), T5));
+	       T2H = VADD(T2F, T2G);
+	       T2I = VADD(T2E, T2H);
+	       T2J = VSUB(VMUL(LDK(KP1_763842528), TJ), VMUL(LDK(KP942793473), Tl));
+	       T2K = VSUB(VMUL(LDK(KP1_913880671), TR), VMUL(LDK(KP580569354), Td));
+	       T2L = VADD(T2J, T2K);
+	       T2M = VSUB(T1Q, T1R);
+	       T2N = VADD(T2L, T2M);
+	       T2O = VADD(VMUL(LDK(KP382683432), T2I), VMUL(LDK(KP923879532), T2N));
+	       T2P = VSUB(T2D, T2O);
+	       T2Q = VADD(T2u, T2P);
+	       T2R = VSUB(T13, T14);
+	       T2S = VSUB(VMUL(LDK(KP1_576692855), TC), VMUL(LDK(KP1_230463181), Ts));
+	       T2T = VSUB(VMUL(LDK(KP1_984959069), TY), VMUL(LDK(KP244821350), T6));
+	       T2U = VADD(T2S, T2T);
+	       T2V = VADD(T2R, T2U);
+	       T2W = VSUB(VMUL(LDK(KP1_740173982), TI), VMUL(LDK(KP985796384), Tm));
+	       T2X = VSUB(VMUL(LDK(KP1_927552131), TS), VMUL(LDK(KP533425514), Tc));
+	       T2Y = VADD(T2W, T2X);
+	       T2Z = VSUB(T16, T17);
+	       T30 = VADD(T2Y, T2Z);
+	       T31 = VSUB(VMUL(LDK(KP995184726), T2V), VMUL(LDK(KP098017140), T30));
+	       T32 = VSUB(T1a, T1b);
+	       T33 = VSUB(VMUL(LDK(KP1_514417693), TA), VMUL(LDK(KP1_306345685), Tu));
+	       T34 = VSUB(VMUL(LDK(KP1_994580913), T10), VMUL(LDK(KP147129127), T4));
+	       T35 = VADD(T33, T34);
+	       T36 = VADD(T32, T35);
+	       T37 = VSUB(VMUL(LDK(KP1_786448602), TK), VMUL(LDK(KP899222659), Tk));
+	       T38 = VSUB(VMUL(LDK(KP1_899056361), TQ), VMUL(LDK(KP627363480), Te));
+	       T39 = VADD(T37, T38);
+	       T3a = VSUB(T1d, T1e);
+	       T3b = VADD(T39, T3a);
+	       T3c = VSUB(VMUL(LDK(KP773010453), T36), VMUL(LDK(KP634393284), T3b));
+	       T3d = VSUB(T31, T3c);
+	       T3e = VSUB(T1i, T1j);
+	       T3f = VSUB(VMUL(LDK(KP1_635169626), TE), VMUL(LDK(KP1_151616382), Tq));
+	       T3g = VSUB(VMUL(LDK(KP1_970555284), TW), VMUL(LDK(KP341923777), T8));
+	       T3h = VADD(T3f, T3g);
+	       T3i = VADD(T3e, T3h);
+	       T3j = VSUB(VMUL(LDK(KP1_689707130), TG), VMUL(LDK(KP1_069995239), To));
+	       T3k = VSUB(VMUL(LDK(KP1_951404260), TU), VMUL(LDK(KP438202480), Ta));
+	       T3l = VADD(T3j, T3k);
+	       T3m = VSUB(T1l, T1m);
+	       T3n = VADD(T3l, T3m);
+	       T3o = VSUB(VMUL(LDK(KP471396736), T3i), VMUL(LDK(KP881921264), T3n));
+	       T3p = VSUB(T1p, T1q);
+	       T3q = VSUB(VMUL(LDK(KP1_448494165), Ty), VMUL(LDK(KP1_379081089), Tw));
+	       T3r = VSUB(VMUL(LDK(KP1_999397637), T12), VMUL(LDK(KP049082457), T2));
+	       T3s = VADD(T3q, T3r);
+	       T3t = VADD(T3p, T3s);
+	       T3u = VSUB(VMUL(LDK(KP1_828419511), TM), VMUL(LDK(KP810482628), Ti));
+	       T3v = VSUB(VMUL(LDK(KP1_865985597), TO), VMUL(LDK(KP719790073), Tg));
+	       T3w = VADD(T3u, T3v);
+	       T3x = VSUB(T1s, T1t);
+	       T3y = VADD(T3w, T3x);
+	       T3z = VADD(VMUL(LDK(KP956940335), T3t), VMUL(LDK(KP290284677), T3y));
+	       T3A = VSUB(T3o, T3z);
+	       T3B = VSUB(T3d, T3A);
+	       T3C = VADD(VMUL(LDK(KP098017140), T2V), VMUL(LDK(KP995184726), T30));
+	       T3D = VADD(VMUL(LDK(KP634393284), T36), VMUL(LDK(KP773010453), T3b));
+	       T3E = VADD(T3C, T3D);
+	       T3F = VADD(VMUL(LDK(KP881921264), T3i), VMUL(LDK(KP471396736), T3n));
+	       T3G = VSUB(VMUL(LDK(KP290284677), T3t), VMUL(LDK(KP956940335), T3y));
+	       T3H = VSUB(T3F, T3G);
+	       T3I = VADD(T3E, T3H);
+	       T3J = VADD(VMUL(LDK(KP382683432), T3B), VMUL(LDK(KP923879532), T3I));
+	       STA(&(O[WS(os, 1)]), VSUB(T2Q, T3J), ovs, &(O[0]));
+	       T3K = VMUL(LDK(KP707106781), VSUB(T2A, T2B));
+	       T3L = VADD(T2w, T2v);
+	       T3M = VADD(T3K, T3L);
+	       T3N = VSUB(T2E, T2H);
+	       T3O = VSUB(T2M, T2L);
+	       T3P = VADD(VMUL(LDK(KP382683432), T3N), VMUL(LDK(KP923879532), T3O));
+	       T3Q = VSUB(T3M, T3P);
+	       T3R = VSUB(T24, T27);
+	       T3S = VSUB(T2b, T2c);
+	       T3T = VSUB(VMUL(LDK(KP555570233), T3R), VMUL(LDK(KP831469612), T3S));
+	       T3U = VSUB(T2f, T2i);
+	       T3V = VSUB(T2m, T2n);
+	       T3W = VSUB(VMUL(LDK(KP195090322), T3U), VMUL(LDK(KP980785280), T3V));
+	       T3X = VADD(T3T, T3W);
+	       T3Y = VSUB(T3Q, T3X);
+	       T3Z = VSUB(T2R, T2U);
+	       T40 = VSUB(T2Y, T2Z);
+	       T41 = VSUB(VMUL(LDK(KP471396736), T3Z), VMUL(LDK(KP881921264), T40));
+	       T42 = VSUB(T32, T35);
+	       T43 = VSUB(T39, T3a);
+	       T44 = VSUB(VMUL(LDK(KP290284677), T42), VMUL(LDK(KP956940335), T43));
+	       T45 = VADD(T41, T44);
+	       T46 = VSUB(T3e, T3h);
+	       T47 = VSUB(T3l, T3m);
+	       T48 = VSUB(VMUL(LDK(KP634393284), T46), VMUL(LDK(KP773010453), T47));
+	       T49 = VSUB(T3p, T3s);
+	       T4a = VSUB(T3w, T3x);
+	       T4b = VSUB(VMUL(LDK(KP098017140), T49), VMUL(LDK(KP995184726), T4a));
+	       T4c = VADD(T48, T4b);
+	       T4d = VADD(T45, T4c);
+	       STA(&(O[WS(os, 2)]), VSUB(T3Y, T4d), ovs, &(O[0]));
+	       T4e = VSUB(T15, T18);
+	       T4f = VSUB(T37, T38);
+	       T4g = VSUB(T33, T34);
+	       T4h = VADD(T4f, T4g);
+	       T4i = VSUB(T4e, T4h);
+	       T4j = VSUB(T2W, T2X);
+	       T4k = VSUB(T2S, T2T);
+	       T4l = VADD(T4j, T4k);
+	       T4m = VSUB(T1c, T1f);
+	       T4n = VSUB(T4l, T4m);
+	       T4o = VADD(VMUL(LDK(KP195090322), T4i), VMUL(LDK(KP980785280), T4n));
+	       T4p = VSUB(T1k, T1n);
+	       T4q = VSUB(T3u, T3v);
+	       T4r = VSUB(T3q, T3r);
+	       T4s = VADD(T4q, T4r);
+	       T4t = VSUB(T4p, T4s);
+	       T4u = VSUB(T3j, T3k);
+	       T4v = VSUB(T3f, T3g);
+	       T4w = VADD(T4u, T4v);
+	       T4x = VSUB(T1r, T1u);
+	       T4y = VSUB(T4w, T4x);
+	       T4z = VSUB(VMUL(LDK(KP831469612), T4t), VMUL(LDK(KP555570233), T4y));
+	       T4A = VSUB(T4o, T4z);
+	       T4B = VSUB(VMUL(LDK(KP980785280), T4i), VMUL(LDK(KP195090322), T4n));
+	       T4C = VADD(VMUL(LDK(KP555570233), T4t), VMUL(LDK(KP831469612), T4y));
+	       T4D = VSUB(T4B, T4C);
+	       T4E = VMUL(LDK(KP707106781), VSUB(T4A, T4D));
+	       T4F = VSUB(T2J, T2K);
+	       T4G = VSUB(T2F, T2G);
+	       T4H = VADD(T4F, T4G);
+	       T4I = VSUB(T1P, T1S);
+	       T4J = VMUL(LDK(KP707106781), VSUB(T4H, T4I));
+	       T4K = VSUB(T2y, T2z);
+	       T4L = VSUB(T1Z, T1X);
+	       T4M = VADD(T4K, T4L);
+	       T4N = VADD(T4J, T4M);
+	       T4O = VSUB(T1A, T1D);
+	       T4P = VSUB(T2k, T2l);
+	       T4Q = VSUB(T2g, T2h);
+	       T4R = VADD(T4P, T4Q);
+	       T4S = VSUB(T4O, T4R);
+	       T4T = VSUB(T29, T2a);
+	       T4U = VSUB(T25, T26);
+	       T4V = VADD(T4T, T4U);
+	       T4W = VSUB(T1H, T1K);
+	       T4X = VSUB(T4V, T4W);
+	       T4Y = VSUB(VMUL(LDK(KP382683432), T4S), VMUL(LDK(KP923879532), T4X));
+	       T4Z = VSUB(T4N, T4Y);
+	       STA(&(O[WS(os, 3)]), VADD(T4E, T4Z), ovs, &(O[0]));
+	       T50 = VSUB(T4L, T4K);
+	       T51 = VMUL(LDK(KP707106781), VADD(T4H, T4I));
+	       T52 = VSUB(T50, T51);
+	       T53 = VADD(T4O, T4R);
+	       T54 = VADD(T4V, T4W);
+	       T55 = VADD(VMUL(LDK(KP382683432), T53), VMUL(LDK(KP923879532), T54));
+	       T56 = VSUB(T52, T55);
+	       T57 = VADD(T4e, T4h);
+	       T58 = VADD(T4l, T4m);
+	       T59 = VADD(VMUL(LDK(KP555570233), T57), VMUL(LDK(KP831469612), T58));
+	       T5a = VADD(T4p, T4s);
+	       T5b = VADD(T4w, T4x);
+	       T5c = VADD(VMUL(LDK(KP195090322), T5a), VMUL(LDK(KP980785280), T5b));
+	       T5d = VADD(T59, T5c);
+	       STA(&(O[WS(os, 4)]), VSUB(T56, T5d), ovs, &(O[0]));
+	       T5e = VSUB(T41, T44);
+	       T5f = VADD(VMUL(LDK(KP773010453), T46), VMUL(LDK(KP634393284), T47));
+	       T5g = VADD(VMUL(LDK(KP995184726), T49), VMUL(LDK(KP098017140), T4a));
+	       T5h = VADD(T5f, T5g);
+	       T5i = VADD(T5e, T5h);
+	       T5j = VADD(VMUL(LDK(KP881921264), T3Z), VMUL(LDK(KP471396736), T40));
+	       T5k = VADD(VMUL(LDK(KP956940335), T42), VMUL(LDK(KP290284677), T43));
+	       T5l = VADD(T5j, T5k);
+	       T5m = VSUB(T48, T4b);
+	       T5n = VADD(T5l, T5m);
+	       T5o = VADD(VMUL(LDK(KP382683432), T5i), VMUL(LDK(KP923879532), T5n));
+	       T5p = VADD(VMUL(LDK(KP831469612), T3R), VMUL(LDK(KP555570233), T3S));
+	       T5q = VADD(VMUL(LDK(KP980785280), T3U), VMUL(LDK(KP195090322), T3V));
+	       T5r = VADD(T5p, T5q);
+	       T5s = VSUB(T3T, T3W);
+	       T5t = VMUL(LDK(KP707106781), VADD(T5r, T5s));
+	       T5u = VSUB(T3L, T3K);
+	       T5v = VSUB(VMUL(LDK(KP382683432), T3O), VMUL(LDK(KP923879532), T3N));
+	       T5w = VSUB(T5u, T5v);
+	       T5x = VADD(T5t, T5w);
+	       STA(&(O[WS(os, 5)]), VADD(T5o, T5x), ovs, &(O[0]));
+	       T5y = VADD(T31, T3c);
+	       T5z = VADD(T3F, T3G);
+	       T5A = VADD(T5y, T5z);
+	       T5B = VADD(T2r, T2s);
+	       T5C = VSUB(VMUL(LDK(KP923879532), T2I), VMUL(LDK(KP382683432), T2N));
+	       T5D = VADD(T2C, T2x);
+	       T5E = VADD(T5C, T5D);
+	       T5F = VADD(T5B, T5E);
+	       STA(&(O[WS(os, 6)]), VADD(T5A, T5F), ovs, &(O[0]));
+	       T5G = VSUB(T20, T1W);
+	       T5H = VSUB(T4F, T4G);
+	       T5I = VSUB(T5G, T5H);
+	       T5J = VSUB(T4T, T4U);
+	       T5K = VSUB(T4P, T4Q);
+	       T5L = VADD(T5J, T5K);
+	       T5M = VSUB(T1E, T1L);
+	       T5N = VMUL(LDK(KP707106781), VADD(T5L, T5M));
+	       T5O = VSUB(T5I, T5N);
+	       T5P = VSUB(T19, T1g);
+	       T5Q = VSUB(T4u, T4v);
+	       T5R = VSUB(T4q, T4r);
+	       T5S = VADD(T5Q, T5R);
+	       T5T = VADD(T5P, T5S);
+	       T5U = VSUB(T4j, T4k);
+	       T5V = VSUB(T4f, T4g);
+	       T5W = VADD(T5U, T5V);
+	       T5X = VSUB(T1o, T1v);
+	       T5Y = VADD(T5W, T5X);
+	       T5Z = VADD(VMUL(LDK(KP382683432), T5T), VMUL(LDK(KP923879532), T5Y));
+	       STA(&(O[WS(os, 7)]), VSUB(T5O, T5Z), ovs, &(O[0]));
+	       T60 = VMUL(LDK(KP707106781), VSUB(T5L, T5M));
+	       T61 = VADD(T5H, T5G);
+	       T62 = VADD(T60, T61);
+	       T63 = VSUB(T5P, T5S);
+	       T64 = VSUB(T5W, T5X);
+	       T65 = VSUB(VMUL(LDK(KP382683432), T63), VMUL(LDK(KP923879532), T64));
+	       STA(&(O[WS(os, 8)]), VSUB(T62, T65), ovs, &(O[0]));
+	       T66 = VSUB(T5D, T5C);
+	       T67 = VADD(T2e, T2p);
+	       T68 = VSUB(T66, T67);
+	       T69 = VSUB(T5y, T5z);
+	       T6a = VSUB(T3C, T3D);
+	       T6b = VADD(T3o, T3z);
+	       T6c = VSUB(T6a, T6b);
+	       T6d = VMUL(LDK(KP707106781), VSUB(T69, T6c));
+	       STA(&(O[WS(os, 9)]), VSUB(T68, T6d), ovs, &(O[0]));
+	       T6e = VADD(T5v, T5u);
+	       T6f = VMUL(LDK(KP707106781), VSUB(T5r, T5s));
+	       T6g = VSUB(T6e, T6f);
+	       T6h = VSUB(T5l, T5m);
+	       T6i = VSUB(T5e, T5h);
+	       T6j = VSUB(VMUL(LDK(KP923879532), T6h), VMUL(LDK(KP382683432), T6i));
+	       STA(&(O[WS(os, 10)]), VSUB(T6g, T6j), ovs, &(O[0]));
+	       T6k = VSUB(VMUL(LDK(KP831469612), T57), VMUL(LDK(KP555570233), T58));
+	       T6l = VSUB(VMUL(LDK(KP980785280), T5a), VMUL(LDK(KP195090322), T5b));
+	       T6m = VADD(T6k, T6l);
+	       T6n = VSUB(T59, T5c);
+	       T6o = VMUL(LDK(KP707106781), VADD(T6m, T6n));
+	       T6p = VSUB(VMUL(LDK(KP923879532), T53), VMUL(LDK(KP382683432), T54));
+	       T6q = VADD(T51, T50);
+	       T6r = VADD(T6p, T6q);
+	       STA(&(O[WS(os, 11)]), VADD(T6o, T6r), ovs, &(O[0]));
+	       T6s = VADD(T4B, T4C);
+	       T6t = VADD(VMUL(LDK(KP923879532), T4S), VMUL(LDK(KP382683432), T4X));
+	       T6u = VSUB(T4M, T4J);
+	       T6v = VADD(T6t, T6u);
+	       STA(&(O[WS(os, 12)]), VADD(T6s, T6v), ovs, &(O[0]));
+	       T6w = VADD(T3M, T3P);
+	       T6x = VSUB(T5p, T5q);
+	       T6y = VSUB(T6w, T6x);
+	       T6z = VSUB(T5j, T5k);
+	       T6A = VSUB(T5f, T5g);
+	       T6B = VADD(T6z, T6A);
+	       T6C = VSUB(T45, T4c);
+	       T6D = VMUL(LDK(KP707106781), VSUB(T6B, T6C));
+	       STA(&(O[WS(os, 13)]), VSUB(T6y, T6D), ovs, &(O[0]));
+	       T6E = VADD(T2O, T2D);
+	       T6F = VMUL(LDK(KP707106781), VADD(T2q, T2t));
+	       T6G = VSUB(T6E, T6F);
+	       T6H = VADD(T3d, T3A);
+	       T6I = VSUB(T3E, T3H);
+	       T6J = VSUB(VMUL(LDK(KP382683432), T6H), VMUL(LDK(KP923879532), T6I));
+	       STA(&(O[WS(os, 14)]), VSUB(T6G, T6J), ovs, &(O[0]));
+	       T6K = VSUB(T5U, T5V);
+	       T6L = VSUB(T5Q, T5R);
+	       T6M = VADD(T6K, T6L);
+	       T6N = VSUB(T1h, T1w);
+	       T6O = VMUL(LDK(KP707106781), VSUB(T6M, T6N));
+	       T6P = VSUB(T5J, T5K);
+	       T6Q = VSUB(T21, T1T);
+	       T6R = VADD(T6P, T6Q);
+	       STA(&(O[WS(os, 15)]), VADD(T6O, T6R), ovs, &(O[0]));
+	       T6S = VSUB(T6Q, T6P);
+	       T6T = VMUL(LDK(KP707106781), VADD(T6M, T6N));
+	       STA(&(O[WS(os, 16)]), VSUB(T6S, T6T), ovs, &(O[0]));
+	       T6U = VADD(VMUL(LDK(KP923879532), T6H), VMUL(LDK(KP382683432), T6I));
+	       T6V = VADD(T6F, T6E);
+	       STA(&(O[WS(os, 17)]), VADD(T6U, T6V), ovs, &(O[0]));
+	       T6W = VMUL(LDK(KP707106781), VADD(T6B, T6C));
+	       T6X = VADD(T6x, T6w);
+	       STA(&(O[WS(os, 18)]), VADD(T6W, T6X), ovs, &(O[0]));
+	       T6Y = VSUB(T6u, T6t);
+	       T6Z = VADD(T4o, T4z);
+	       STA(&(O[WS(os, 19)]), VSUB(T6Y, T6Z), ovs, &(O[0]));
+	       T70 = VSUB(T6q, T6p);
+	       T71 = VMUL(LDK(KP707106781), VSUB(T6m, T6n));
+	       STA(&(O[WS(os, 20)]), VSUB(T70, T71), ovs, &(O[0]));
+	       T72 = VADD(T6f, T6e);
+	       T73 = VADD(VMUL(LDK(KP923879532), T6i), VMUL(LDK(KP382683432), T6h));
+	       STA(&(O[WS(os, 21)]), VSUB(T72, T73), ovs, &(O[0]));
+	       T74 = VADD(T67, T66);
+	       T75 = VMUL(LDK(KP707106781), VADD(T6c, T69));
+	       STA(&(O[WS(os, 22)]), VSUB(T74, T75), ovs, &(O[0]));
+	       T76 = VADD(VMUL(LDK(KP923879532), T63), VMUL(LDK(KP382683432), T64));
+	       T77 = VSUB(T61, T60);
+	       STA(&(O[WS(os, 23)]), VADD(T76, T77), ovs, &(O[0]));
+	       T78 = VSUB(VMUL(LDK(KP923879532), T5T), VMUL(LDK(KP382683432), T5Y));
+	       T79 = VADD(T5N, T5I);
+	       STA(&(O[WS(os, 24)]), VADD(T78, T79), ovs, &(O[0]));
+	       T7a = VSUB(T5E, T5B);
+	       T7b = VADD(T6a, T6b);
+	       STA(&(O[WS(os, 25)]), VSUB(T7a, T7b), ovs, &(O[0]));
+	       T7c = VSUB(T5w, T5t);
+	       T7d = VSUB(VMUL(LDK(KP923879532), T5i), VMUL(LDK(KP382683432), T5n));
+	       STA(&(O[WS(os, 26)]), VSUB(T7c, T7d), ovs, &(O[0]));
+	       T7e = VADD(T55, T52);
+	       T7f = VSUB(T6k, T6l);
+	       STA(&(O[WS(os, 27)]), VSUB(T7e, T7f), ovs, &(O[0]));
+	       T7g = VADD(T4Y, T4N);
+	       T7h = VMUL(LDK(KP707106781), VADD(T4A, T4D));
+	       STA(&(O[WS(os, 28)]), VSUB(T7g, T7h), ovs, &(O[0]));
+	       T7i = VSUB(T6z, T6A);
+	       T7j = VADD(T3X, T3Q);
+	       STA(&(O[WS(os, 29)]), VADD(T7i, T7j), ovs, &(O[0]));
+	       T7k = VSUB(T2P, T2u);
+	       T7l = VSUB(VMUL(LDK(KP382683432), T3I), VMUL(LDK(KP923879532), T3B));
+	       STA(&(O[WS(os, 30)]), VSUB(T7k, T7l), ovs, &(O[0]));
+	       T7m = VSUB(T22, T1M);
+	       T7n = VSUB(T6K, T6L);
+	       STA(&(O[WS(os, 31)]), VSUB(T7m, T7n), ovs, &(O[0]));
+	       STA(&(O[WS(os, 32)]), VADD(T7n, T7m), ovs, &(O[0]));
+	       STA(&(O[WS(os, 33)]), VADD(T7l, T7k), ovs, &(O[0]));
+	       STA(&(O[WS(os, 34)]), VSUB(T7j, T7i), ovs, &(O[0]));
+	       STA(&(O[WS(os, 35)]), VADD(T7h, T7g), ovs, &(O[0]));
+	       STA(&(O[WS(os, 36)]), VADD(T7f, T7e), ovs, &(O[0]));
+	       STA(&(O[WS(os, 37)]), VADD(T7d, T7c), ovs, &(O[0]));
+	       STA(&(O[WS(os, 38)]), VADD(T7b, T7a), ovs, &(O[0]));
+	       STA(&(O[WS(os, 39)]), VSUB(T79, T78), ovs, &(O[0]));
+	       STA(&(O[WS(os, 40)]), VSUB(T77, T76), ovs, &(O[0]));
+	       STA(&(O[WS(os, 41)]), VADD(T75, T74), ovs, &(O[0]));
+	       STA(&(O[WS(os, 42)]), VADD(T73, T72), ovs, &(O[0]));
+	       STA(&(O[WS(os, 43)]), VADD(T71, T70), ovs, &(O[0]));
+	       STA(&(O[WS(os, 44)]), VADD(T6Z, T6Y), ovs, &(O[0]));
+	       STA(&(O[WS(os, 45)]), VSUB(T6X, T6W), ovs, &(O[0]));
+	       STA(&(O[WS(os, 46)]), VSUB(T6V, T6U), ovs, &(O[0]));
+	       STA(&(O[WS(os, 47)]), VADD(T6T, T6S), ovs, &(O[0]));
+	       STA(&(O[WS(os, 48)]), VSUB(T6R, T6O), ovs, &(O[0]));
+	       STA(&(O[WS(os, 49)]), VADD(T6J, T6G), ovs, &(O[0]));
+	       STA(&(O[WS(os, 50)]), VADD(T6D, T6y), ovs, &(O[0]));
+	       STA(&(O[WS(os, 51)]), VSUB(T6v, T6s), ovs, &(O[0]));
+	       STA(&(O[WS(os, 52)]), VSUB(T6r, T6o), ovs, &(O[0]));
+	       STA(&(O[WS(os, 53)]), VADD(T6j, T6g), ovs, &(O[0]));
+	       STA(&(O[WS(os, 54)]), VADD(T6d, T68), ovs, &(O[0]));
+	       STA(&(O[WS(os, 55)]), VADD(T65, T62), ovs, &(O[0]));
+	       STA(&(O[WS(os, 56)]), VADD(T5Z, T5O), ovs, &(O[0]));
+	       STA(&(O[WS(os, 57)]), VSUB(T5F, T5A), ovs, &(O[0]));
+	       STA(&(O[WS(os, 58)]), VSUB(T5x, T5o), ovs, &(O[0]));
+	       STA(&(O[WS(os, 59)]), VADD(T5d, T56), ovs, &(O[0]));
+	       STA(&(O[WS(os, 60)]), VSUB(T4Z, T4E), ovs, &(O[0]));
+	       STA(&(O[WS(os, 61)]), VADD(T4d, T3Y), ovs, &(O[0]));
+	       STA(&(O[WS(os, 62)]), VADD(T3J, T2Q), ovs, &(O[0]));
+	       STA(&(O[WS(os, 63)]), VSUB(T23, T1x), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 64, XSIMD_STRING("e01v_64"), {456, 249, 0, 0}, &GENUS, REDFT01 };
+
+void XSIMD(codelet_e01v_64) (planner *p) {
+     X(kr2r_register) (p, e01v_64, &desc);
+}
+
+#endif
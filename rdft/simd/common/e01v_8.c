@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:08:10 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e01v_8 -include rdft/simd/r2rv.h from: ../../../genfft/gen_r2r.native -fma -compact -variables 4 -pipeline-latency 4 -redft01 -n 8 -name e01_8 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 26 FP additions, 24 FP multiplications,
+ * (or, 2 additions, 0 multiplications, 24 fused multiply/add),
+ * 27 stack variables, 8 constants, and 16 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e01v_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP668178637, +0.668178637919298919997757686523080761552472251);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP198912367, +0.198912367379658006911597622644676228597850501);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP414213562, +0.414213562373095048801688724209698078569671875);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(16, is), MAKE_VOLATILE_STRIDE(16, os)) {
+	       V T3, Tj, T6, Tk, Tc, Tn, Tf, Tm;
+	       {
+		    V T1, T2, T4, T5;
+		    T1 = LDA(&(I[0]), ivs, &(I[0]));
+		    T2 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+		    T3 = VFMA(LDK(KP1_414213562), T2, T1);
+		    Tj = VFNMS(LDK(KP1_414213562), T2, T1);
+		    T4 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+		    T5 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+		    T6 = VFMA(LDK(KP414213562), T5, T4);
+		    Tk = VFMS(LDK(KP414213562), T4, T5);
+		    {
+			 V T8, Td, Tb, Te, T9, Ta;
+			 T8 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+			 Td = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+			 T9 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+			 Ta = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+			 Tb = VADD(T9, Ta);
+			 Te = VSUB(Ta, T9);
+			 Tc = VFMA(LDK(KP707106781), Tb, T8);
+			 Tn = VFNMS(LDK(KP707106781), Te, Td);
+			 Tf = VFMA(LDK(KP707106781), Te, Td);
+			 Tm = VFNMS(LDK(KP707106781), Tb, T8);
+		    }
+	       }
+	       {
+		    V T7, Tg, Tp, Tq;
+		    T7 = VFMA(LDK(KP1_847759065), T6, T3);
+		    Tg = VFMA(LDK(KP198912367), Tf, Tc);
+		    STA(&(O[WS(os, 7)]), VFNMS(LDK(KP1_961570560), Tg, T7), ovs, &(O[0]));
+		    STA(&(O[0]), VFMA(LDK(KP1_961570560), Tg, T7), ovs, &(O[0]));
+		    Tp = VFNMS(LDK(KP1_847759065), Tk, Tj);
+		    Tq = VFMA(LDK(KP668178637), Tm, Tn);
+		    STA(&(O[WS(os, 5)]), VFNMS(LDK(KP1_662939224), Tq, Tp), ovs, &(O[0]));
+		    STA(&(O[WS(os, 2)]), VFMA(LDK(KP1_662939224), Tq, Tp), ovs, &(O[0]));
+	       }
+	       {
+		    V Th, Ti, Tl, To;
+		    Th = VFNMS(LDK(KP1_847759065), T6, T3);
+		    Ti = VFNMS(LDK(KP198912367), Tc, Tf);
+		    STA(&(O[WS(os, 3)]), VFNMS(LDK(KP1_961570560), Ti, Th), ovs, &(O[0]));
+		    STA(&(O[WS(os, 4)]), VFMA(LDK(KP1_961570560), Ti, Th), ovs, &(O[0]));
+		    Tl = VFMA(LDK(KP1_847759065), Tk, Tj);
+		    To = VFNMS(LDK(KP668178637), Tn, Tm);
+		    STA(&(O[WS(os, 6)]), VFNMS(LDK(KP1_662939224), To, Tl), ovs, &(O[0]));
+		    STA(&(O[WS(os, 1)]), VFMA(LDK(KP1_662939224), To, Tl), ovs, &(O[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 8, XSIMD_STRING("e01v_8"), {2, 0, 24, 0}, &GENUS, REDFT01 };
+
+void XSIMD(codelet_e01v_8) (planner *p) {
+     X(kr2r_register) (p, e01v_8, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e01v_8 -include rdft/simd/r2rv.h from: ../../../genfft/gen_r2r.native -compact -variables 4 -pipeline-latency 4 -redft01 -n 8 -name e01_8 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 26 FP additions, 15 FP multiplications,
+ * (or, 20 additions, 9 multiplications, 6 fused multiply/add),
+ * 28 stack variables, 8 constants, and 16 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e01v_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(16, is), MAKE_VOLATILE_STRIDE(16, os)) {
+	       V T7, Tl, T4, Tk, Td, To, Tg, Tn;
+	       {
+		    V T5, T6, T1, T3, T2;
+		    T5 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+		    T6 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+		    T7 = VFMA(LDK(KP1_847759065), T5, VMUL(LDK(KP765366864), T6));
+		    Tl = VFNMS(LDK(KP1_847759065), T6, VMUL(LDK(KP765366864), T5));
+		    T1 = LDA(&(I[0]), ivs, &(I[0]));
+		    T2 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+		    T3 = VMUL(LDK(KP1_414213562), T2);
+		    T4 = VADD(T1, T3);
+		    Tk = VSUB(T1, T3);
+		    {
+			 V T9, Tf, Tc, Te, Ta, Tb;
+			 T9 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+			 Tf = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+			 Ta = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+			 Tb = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+			 Tc = VMUL(LDK(KP707106781), VADD(Ta, Tb));
+			 Te = VMUL(LDK(KP707106781), VSUB(Ta, Tb));
+			 Td = VADD(T9, Tc);
+			 To = VADD(Te, Tf);
+			 Tg = VSUB(Te, Tf);
+			 Tn = VSUB(T9, Tc);
+		    }
+	       }
+	       {
+		    V T8, Th, Tq, Tr;
+		    T8 = VADD(T4, T7);
+		    Th = VFNMS(LDK(KP390180644), Tg, VMUL(LDK(KP1_961570560), Td));
+		    STA(&(O[WS(os, 7)]), VSUB(T8, Th), ovs, &(O[0]));
+		    STA(&(O[0]), VADD(T8, Th), ovs, &(O[0]));
+		    Tq = VSUB(Tk, Tl);
+		    Tr = VFMA(LDK(KP1_111140466), Tn, VMUL(LDK(KP1_662939224), To));
+		    STA(&(O[WS(os, 5)]), VSUB(Tq, Tr), ovs, &(O[0]));
+		    STA(&(O[WS(os, 2)]), VADD(Tq, Tr), ovs, &(O[0]));
+	       }
+	       {
+		    V Ti, Tj, Tm, Tp;
+		    Ti = VSUB(T4, T7);
+		    Tj = VFMA(LDK(KP390180644), Td, VMUL(LDK(KP1_961570560), Tg));
+		    STA(&(O[WS(os, 4)]), VSUB(Ti, Tj), ovs, &(O[0]));
+		    STA(&(O[WS(os, 3)]), VADD(Ti, Tj), ovs, &(O[0]));
+		    Tm = VADD(Tk, Tl);
+		    Tp = VFNMS(LDK(KP1_111140466), To, VMUL(LDK(KP1_662939224), Tn));
+		    STA(&(O[WS(os, 6)]), VSUB(Tm, Tp), ovs, &(O[0]));
+		    STA(&(O[WS(os, 1)]), VADD(Tm, Tp), ovs, &(O[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 8, XSIMD_STRING("e01v_8"), {20, 9, 6, 0}, &GENUS, REDFT01 };
+
+void XSIMD(codelet_e01v_8) (planner *p) {
+     X(kr2r_register) (p, e01v_8, &desc);
+}
+
+#endif
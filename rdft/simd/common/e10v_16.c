@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e10v_16 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft10 -n 16 -name e10_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 74 FP additions, 44 FP multiplications,
+ * (or, 52 additions, 22 multiplications, 22 fused multiply/add),
+ * 70 stack variables, 19 constants, and 32 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e10v_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = VADD(T1, Tg);
+	       Ti = VADD(T8, T9);
+	       Tj = VADD(Th, Ti);
+	       Tk = VADD(T5, Tc);
+	       Tl = VADD(T4, Td);
+	       Tm = VADD(Tk, Tl);
+	       Tn = VADD(Tj, Tm);
+	       To = VADD(T3, Te);
+	       Tp = VADD(T6, Tb);
+	       Tq = VADD(To, Tp);
+	       Tr = VADD(T7, Ta);
+	       Ts = VADD(T2, Tf);
+	       Tt = VADD(Tr, Ts);
+	       Tu = VADD(Tq, Tt);
+	       STA(&(O[0]), VMUL(LDK(KP2_000000000), VADD(Tn, Tu)), ovs, &(O[0]));
+	       Tv = VSUB(T8, T9);
+	       Tw = VMUL(LDK(KP707106781), VSUB(T4, Td));
+	       Tx = VFMS(LDK(KP707106781), VSUB(T5, Tc), Tw);
+	       Ty = VSUB(Tv, Tx);
+	       Tz = VSUB(T3, Te);
+	       TA = VSUB(T6, Tb);
+	       TB = VFMS(LDK(KP923879532), TA, VMUL(LDK(KP382683432), Tz));
+	       TC = VSUB(T7, Ta);
+	       TD = VSUB(T2, Tf);
+	       TE = VFMS(LDK(KP382683432), TD, VMUL(LDK(KP923879532), TC));
+	       TF = VADD(TB, TE);
+	       TG = VADD(Ty, TF);
+	       TH = VSUB(T1, Tg);
+	       TI = VFMA(LDK(KP707106781), VSUB(T5, Tc), Tw);
+	       TJ = VADD(TH, TI);
+	       TK = VFMA(LDK(KP923879532), Tz, VMUL(LDK(KP382683432), TA));
+	       TL = VFMA(LDK(KP382683432), TC, VMUL(LDK(KP923879532), TD));
+	       TM = VADD(TK, TL);
+	       TN = VADD(TJ, TM);
+	       STA(&(O[WS(os, 1)]), VFMA(LDK(KP1_990369453), TN, VMUL(LDK(KP196034280), TG)), ovs, &(O[0]));
+	       TO = VSUB(Tk, Tl);
+	       TP = VMUL(LDK(KP707106781), VSUB(Tr, Ts));
+	       TQ = VFMA(LDK(KP707106781), VSUB(To, Tp), TP);
+	       TR = VADD(TO, TQ);
+	       TS = VSUB(Th, Ti);
+	       TT = VFMS(LDK(KP707106781), VSUB(To, Tp), TP);
+	       TU = VADD(TS, TT);
+	       STA(&(O[WS(os, 2)]), VFMS(LDK(KP1_961570560), TU, VMUL(LDK(KP390180644), TR)), ovs, &(O[0]));
+	       TV = VADD(Tv, Tx);
+	       TW = VSUB(TK, TL);
+	       TX = VADD(TV, TW);
+	       TY = VSUB(TH, TI);
+	       TZ = VSUB(TB, TE);
+	       T10 = VSUB(TY, TZ);
+	       STA(&(O[WS(os, 3)]), VFMS(LDK(KP1_913880671), T10, VMUL(LDK(KP580569354), TX)), ovs, &(O[0]));
+	       T11 = VSUB(Tq, Tt);
+	       T12 = VSUB(Tj, Tm);
+	       STA(&(O[WS(os, 4)]), VFMS(LDK(KP1_847759065), T12, VMUL(LDK(KP765366864), T11)), ovs, &(O[0]));
+	       T13 = VSUB(TV, TW);
+	       T14 = VADD(TY, TZ);
+	       STA(&(O[WS(os, 5)]), VFMA(LDK(KP1_763842528), T14, VMUL(LDK(KP942793473), T13)), ovs, &(O[0]));
+	       T15 = VSUB(TO, TQ);
+	       T16 = VSUB(TS, TT);
+	       STA(&(O[WS(os, 6)]), VFMA(LDK(KP1_662939224), T16, VMUL(LDK(KP1_111140466), T15)), ovs, &(O[0]));
+	       T17 = VSUB(Ty, TF);
+	       T18 = VSUB(TJ, TM);
+	       STA(&(O[WS(os, 7)]), VFMS(LDK(KP1_546020906), T18, VMUL(LDK(KP1_268786568), T17)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 8)]), VMUL(LDK(KP1_414213562), VSUB(Tn, Tu)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 9)]), VFMA(LDK(KP1_546020906), T17, VMUL(LDK(KP1_268786568), T18)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 10)]), VFMS(LDK(KP1_111140466), T16, VMUL(LDK(KP1_662939224), T15)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 11)]), VFMS(LDK(KP942793473), T14, VMUL(LDK(KP1_763842528), T13)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 12)]), VFMA(LDK(KP1_847759065), T11, VMUL(LDK(KP765366864), T12)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 13)]), VFMA(LDK(KP1_913880671), TX, VMUL(LDK(KP580569354), T10)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 14)]), VFMA(LDK(KP1_961570560), TR, VMUL(LDK(KP390180644), TU)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 15)]), VFMS(LDK(KP196034280), TN, VMUL(LDK(KP1_990369453), TG)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 16, XSIMD_STRING("e10v_16"), {52, 22, 22, 0}, &GENUS, REDFT10 };
+
+void XSIMD(codelet_e10v_16) (planner *p) {
+     X(kr2r_register) (p, e10v_16, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e10v_16 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft10 -n 16 -name e10_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 72 FP additions, 42 FP multiplications,
+ * (or, 72 additions, 42 multiplications, 0 fused multiply/add),
+ * 72 stack variables, 19 constants, and 32 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e10v_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = VADD(T1, Tg);
+	       Ti = VADD(T8, T9);
+	       Tj = VADD(Th, Ti);
+	       Tk = VADD(T5, Tc);
+	       Tl = VADD(T4, Td);
+	       Tm = VADD(Tk, Tl);
+	       Tn = VADD(Tj, Tm);
+	       To = VADD(T3, Te);
+	       Tp = VADD(T6, Tb);
+	       Tq = VADD(To, Tp);
+	       Tr = VADD(T7, Ta);
+	       Ts = VADD(T2, Tf);
+	       Tt = VADD(Tr, Ts);
+	       Tu = VADD(Tq, Tt);
+	       STA(&(O[0]), VMUL(LDK(KP2_000000000), VADD(Tn, Tu)), ovs, &(O[0]));
+	       Tv = VSUB(T1, Tg);
+	       Tw = VMUL(LDK(KP707106781), VSUB(T5, Tc));
+	       Tx = VMUL(LDK(KP707106781), VSUB(T4, Td));
+	       Ty = VADD(Tw, Tx);
+	       Tz = VADD(Tv, Ty);
+	       TA = VSUB(T3, Te);
+	       TB = VSUB(T6, Tb);
+	       TC = VADD(VMUL(LDK(KP923879532), TA), VMUL(LDK(KP382683432), TB));
+	       TD = VSUB(T7, Ta);
+	       TE = VSUB(T2, Tf);
+	       TF = VADD(VMUL(LDK(KP382683432), TD), VMUL(LDK(KP923879532), TE));
+	       TG = VADD(TC, TF);
+	       TH = VADD(Tz, TG);
+	       TI = VSUB(T8, T9);
+	       TJ = VSUB(Tw, Tx);
+	       TK = VSUB(TI, TJ);
+	       TL = VSUB(VMUL(LDK(KP923879532), TB), VMUL(LDK(KP382683432), TA));
+	       TM = VSUB(VMUL(LDK(KP382683432), TE), VMUL(LDK(KP923879532), TD));
+	       TN = VADD(TL, TM);
+	       TO = VADD(TK, TN);
+	       STA(&(O[WS(os, 1)]), VADD(VMUL(LDK(KP1_990369453), TH), VMUL(LDK(KP196034280), TO)), ovs, &(O[0]));
+	       TP = VSUB(Th, Ti);
+	       TQ = VMUL(LDK(KP707106781), VSUB(To, Tp));
+	       TR = VMUL(LDK(KP707106781), VSUB(Tr, Ts));
+	       TS = VSUB(TQ, TR);
+	       TT = VADD(TP, TS);
+	       TU = VSUB(Tk, Tl);
+	       TV = VADD(TQ, TR);
+	       TW = VADD(TU, TV);
+	       STA(&(O[WS(os, 2)]), VSUB(VMUL(LDK(KP1_961570560), TT), VMUL(LDK(KP390180644), TW)), ovs, &(O[0]));
+	       TX = VSUB(Tv, Ty);
+	       TY = VSUB(TL, TM);
+	       TZ = VSUB(TX, TY);
+	       T10 = VADD(TI, TJ);
+	       T11 = VSUB(TC, TF);
+	       T12 = VADD(T10, T11);
+	       STA(&(O[WS(os, 3)]), VSUB(VMUL(LDK(KP1_913880671), TZ), VMUL(LDK(KP580569354), T12)), ovs, &(O[0]));
+	       T13 = VSUB(Tj, Tm);
+	       T14 = VSUB(Tq, Tt);
+	       STA(&(O[WS(os, 4)]), VSUB(VMUL(LDK(KP1_847759065), T13), VMUL(LDK(KP765366864), T14)), ovs, &(O[0]));
+	       T15 = VADD(TX, TY);
+	       T16 = VSUB(T10, T11);
+	       STA(&(O[WS(os, 5)]), VADD(VMUL(LDK(KP1_763842528), T15), VMUL(LDK(KP942793473), T16)), ovs, &(O[0]));
+	       T17 = VSUB(TP, TS);
+	       T18 = VSUB(TU, TV);
+	       STA(&(O[WS(os, 6)]), VADD(VMUL(LDK(KP1_662939224), T17), VMUL(LDK(KP1_111140466), T18)), ovs, &(O[0]));
+	       T19 = VSUB(Tz, TG);
+	       T1a = VSUB(TK, TN);
+	       STA(&(O[WS(os, 7)]), VSUB(VMUL(LDK(KP1_546020906), T19), VMUL(LDK(KP1_268786568), T1a)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 8)]), VMUL(LDK(KP1_414213562), VSUB(Tn, Tu)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 9)]), VADD(VMUL(LDK(KP1_546020906), T1a), VMUL(LDK(KP1_268786568), T19)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 10)]), VSUB(VMUL(LDK(KP1_111140466), T17), VMUL(LDK(KP1_662939224), T18)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 11)]), VSUB(VMUL(LDK(KP942793473), T15), VMUL(LDK(KP1_763842528), T16)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 12)]), VADD(VMUL(LDK(KP1_847759065), T14), VMUL(LDK(KP765366864), T13)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 13)]), VADD(VMUL(LDK(KP1_913880671), T12), VMUL(LDK(KP580569354), TZ)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 14)]), VADD(VMUL(LDK(KP1_961570560), TW), VMUL(LDK(KP390180644), TT)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 15)]), VSUB(VMUL(LDK(KP196034280), TH), VMUL(LDK(KP1_990369453), TO)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 16, XSIMD_STRING("e10v_16"), {72, 42, 0, 0}, &GENUS, REDFT10 };
+
+void XSIMD(codelet_e10v_16) (planner *p) {
+     X(kr2r_register) (p, e10v_16, &desc);
+}
+
+#endif
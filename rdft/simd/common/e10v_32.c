@@ -0,0 +1,624 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e10v_32 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft10 -n 32 -name e10_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 191 FP additions, 109 FP multiplications,
+ * (or, 135 additions, 53 multiplications, 56 fused multiply/add),
+ * 181 stack variables, 39 constants, and 64 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e10v_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       V T2V;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = VADD(T1, Tw);
+	       Ty = VADD(Tg, Th);
+	       Tz = VADD(Tx, Ty);
+	       TA = VADD(T9, To);
+	       TB = VADD(T8, Tp);
+	       TC = VADD(TA, TB);
+	       TD = VADD(Tz, TC);
+	       TE = VADD(T5, Ts);
+	       TF = VADD(Tc, Tl);
+	       TG = VADD(TE, TF);
+	       TH = VADD(Td, Tk);
+	       TI = VADD(T4, Tt);
+	       TJ = VADD(TH, TI);
+	       TK = VADD(TG, TJ);
+	       TL = VADD(TD, TK);
+	       TM = VADD(T3, Tu);
+	       TN = VADD(Te, Tj);
+	       TO = VADD(TM, TN);
+	       TP = VADD(Tb, Tm);
+	       TQ = VADD(T6, Tr);
+	       TR = VADD(TP, TQ);
+	       TS = VADD(TO, TR);
+	       TT = VADD(T7, Tq);
+	       TU = VADD(Ta, Tn);
+	       TV = VADD(TT, TU);
+	       TW = VADD(Tf, Ti);
+	       TX = VADD(T2, Tv);
+	       TY = VADD(TW, TX);
+	       TZ = VADD(TV, TY);
+	       T10 = VADD(TS, TZ);
+	       STA(&(O[0]), VMUL(LDK(KP2_000000000), VADD(TL, T10)), ovs, &(O[0]));
+	       T11 = VSUB(Tg, Th);
+	       T12 = VMUL(LDK(KP707106781), VSUB(T8, Tp));
+	       T13 = VFMS(LDK(KP707106781), VSUB(T9, To), T12);
+	       T14 = VSUB(T11, T13);
+	       T15 = VSUB(T5, Ts);
+	       T16 = VSUB(Tc, Tl);
+	       T17 = VFMS(LDK(KP923879532), T16, VMUL(LDK(KP382683432), T15));
+	       T18 = VSUB(Td, Tk);
+	       T19 = VSUB(T4, Tt);
+	       T1a = VFMS(LDK(KP382683432), T19, VMUL(LDK(KP923879532), T18));
+	       T1b = VADD(T17, T1a);
+	       T1c = VADD(T14, T1b);
+	       T1d = VSUB(T3, Tu);
+	       T1e = VMUL(LDK(KP707106781), VSUB(T6, Tr));
+	       T1f = VFMA(LDK(KP707106781), VSUB(Tb, Tm), T1e);
+	       T1g = VADD(T1d, T1f);
+	       T1h = VSUB(Te, Tj);
+	       T1i = VFMS(LDK(KP707106781), VSUB(Tb, Tm), T1e);
+	       T1j = VSUB(T1h, T1i);
+	       T1k = VFMS(LDK(KP980785280), T1j, VMUL(LDK(KP195090322), T1g));
+	       T1l = VSUB(T7, Tq);
+	       T1m = VMUL(LDK(KP707106781), VSUB(T2, Tv));
+	       T1n = VFMA(LDK(KP707106781), VSUB(Tf, Ti), T1m);
+	       T1o = VADD(T1l, T1n);
+	       T1p = VSUB(Ta, Tn);
+	       T1q = VFMS(LDK(KP707106781), VSUB(Tf, Ti), T1m);
+	       T1r = VSUB(T1p, T1q);
+	       T1s = VFMS(LDK(KP831469612), T1r, VMUL(LDK(KP555570233), T1o));
+	       T1t = VADD(T1k, T1s);
+	       T1u = VADD(T1c, T1t);
+	       T1v = VSUB(T1, Tw);
+	       T1w = VFMA(LDK(KP707106781), VSUB(T9, To), T12);
+	       T1x = VADD(T1v, T1w);
+	       T1y = VFMA(LDK(KP923879532), T15, VMUL(LDK(KP382683432), T16));
+	       T1z = VFMA(LDK(KP382683432), T18, VMUL(LDK(KP923879532), T19));
+	       T1A = VADD(T1y, T1z);
+	       T1B = VADD(T1x, T1A);
+	       T1C = VFMA(LDK(KP980785280), T1g, VMUL(LDK(KP195090322), T1j));
+	       T1D = VFMA(LDK(KP831469612), T1o, VMUL(LDK(KP555570233), T1r));
+	       T1E = VADD(T1C, T1D);
+	       T1F = VADD(T1B, T1E);
+	       STA(&(O[WS(os, 1)]), VFMA(LDK(KP1_997590912), T1F, VMUL(LDK(KP098135348), T1u)), ovs, &(O[0]));
+	       T1G = VSUB(TA, TB);
+	       T1H = VMUL(LDK(KP707106781), VSUB(TH, TI));
+	       T1I = VFMA(LDK(KP707106781), VSUB(TE, TF), T1H);
+	       T1J = VADD(T1G, T1I);
+	       T1K = VSUB(TM, TN);
+	       T1L = VSUB(TP, TQ);
+	       T1M = VFMA(LDK(KP923879532), T1L, VMUL(LDK(KP382683432), T1K));
+	       T1N = VSUB(TT, TU);
+	       T1O = VSUB(TW, TX);
+	       T1P = VFMA(LDK(KP382683432), T1O, VMUL(LDK(KP923879532), T1N));
+	       T1Q = VADD(T1M, T1P);
+	       T1R = VADD(T1J, T1Q);
+	       T1S = VSUB(Tx, Ty);
+	       T1T = VFMS(LDK(KP707106781), VSUB(TE, TF), T1H);
+	       T1U = VADD(T1S, T1T);
+	       T1V = VFMS(LDK(KP923879532), T1K, VMUL(LDK(KP382683432), T1L));
+	       T1W = VFMS(LDK(KP382683432), T1N, VMUL(LDK(KP923879532), T1O));
+	       T1X = VADD(T1V, T1W);
+	       T1Y = VADD(T1U, T1X);
+	       STA(&(O[WS(os, 2)]), VFMS(LDK(KP1_990369453), T1Y, VMUL(LDK(KP196034280), T1R)), ovs, &(O[0]));
+	       T1Z = VADD(T11, T13);
+	       T20 = VSUB(T1y, T1z);
+	       T21 = VADD(T1Z, T20);
+	       T22 = VSUB(T1d, T1f);
+	       T23 = VADD(T1h, T1i);
+	       T24 = VFMA(LDK(KP831469612), T23, VMUL(LDK(KP555570233), T22));
+	       T25 = VSUB(T1l, T1n);
+	       T26 = VADD(T1p, T1q);
+	       T27 = VFMS(LDK(KP195090322), T26, VMUL(LDK(KP980785280), T25));
+	       T28 = VSUB(T24, T27);
+	       T29 = VADD(T21, T28);
+	       T2a = VSUB(T1v, T1w);
+	       T2b = VSUB(T17, T1a);
+	       T2c = VSUB(T2a, T2b);
+	       T2d = VFMS(LDK(KP831469612), T22, VMUL(LDK(KP555570233), T23));
+	       T2e = VFMA(LDK(KP195090322), T25, VMUL(LDK(KP980785280), T26));
+	       T2f = VSUB(T2d, T2e);
+	       T2g = VADD(T2c, T2f);
+	       STA(&(O[WS(os, 3)]), VFMS(LDK(KP1_978353019), T2g, VMUL(LDK(KP293460948), T29)), ovs, &(O[0]));
+	       T2h = VSUB(TG, TJ);
+	       T2i = VMUL(LDK(KP707106781), VSUB(TV, TY));
+	       T2j = VFMA(LDK(KP707106781), VSUB(TO, TR), T2i);
+	       T2k = VADD(T2h, T2j);
+	       T2l = VSUB(Tz, TC);
+	       T2m = VFMS(LDK(KP707106781), VSUB(TO, TR), T2i);
+	       T2n = VADD(T2l, T2m);
+	       STA(&(O[WS(os, 4)]), VFMS(LDK(KP1_961570560), T2n, VMUL(LDK(KP390180644), T2k)), ovs, &(O[0]));
+	       T2o = VSUB(T1Z, T20);
+	       T2p = VADD(T2d, T2e);
+	       T2q = VSUB(T2o, T2p);
+	       T2r = VADD(T2a, T2b);
+	       T2s = VADD(T24, T27);
+	       T2t = VADD(T2r, T2s);
+	       STA(&(O[WS(os, 5)]), VFMA(LDK(KP1_940062506), T2t, VMUL(LDK(KP485960359), T2q)), ovs, &(O[0]));
+	       T2u = VSUB(T1G, T1I);
+	       T2v = VSUB(T1V, T1W);
+	       T2w = VSUB(T2u, T2v);
+	       T2x = VSUB(T1S, T1T);
+	       T2y = VSUB(T1M, T1P);
+	       T2z = VADD(T2x, T2y);
+	       STA(&(O[WS(os, 6)]), VFMA(LDK(KP1_913880671), T2z, VMUL(LDK(KP580569354), T2w)), ovs, &(O[0]));
+	       T2A = VSUB(T14, T1b);
+	       T2B = VSUB(T1C, T1D);
+	       T2C = VADD(T2A, T2B);
+	       T2D = VSUB(T1x, T1A);
+	       T2E = VSUB(T1k, T1s);
+	       T2F = VSUB(T2D, T2E);
+	       STA(&(O[WS(os, 7)]), VFMS(LDK(KP1_883088130), T2F, VMUL(LDK(KP673779706), T2C)), ovs, &(O[0]));
+	       T2G = VSUB(TS, TZ);
+	       T2H = VSUB(TD, TK);
+	       STA(&(O[WS(os, 8)]), VFMS(LDK(KP1_847759065), T2H, VMUL(LDK(KP765366864), T2G)), ovs, &(O[0]));
+	       T2I = VSUB(T2A, T2B);
+	       T2J = VADD(T2D, T2E);
+	       STA(&(O[WS(os, 9)]), VFMA(LDK(KP1_807978586), T2J, VMUL(LDK(KP855110186), T2I)), ovs, &(O[0]));
+	       T2K = VADD(T2u, T2v);
+	       T2L = VSUB(T2x, T2y);
+	       STA(&(O[WS(os, 10)]), VFMS(LDK(KP1_763842528), T2L, VMUL(LDK(KP942793473), T2K)), ovs, &(O[0]));
+	       T2M = VADD(T2o, T2p);
+	       T2N = VSUB(T2r, T2s);
+	       STA(&(O[WS(os, 11)]), VFMS(LDK(KP1_715457220), T2N, VMUL(LDK(KP1_028205488), T2M)), ovs, &(O[0]));
+	       T2O = VSUB(T2h, T2j);
+	       T2P = VSUB(T2l, T2m);
+	       STA(&(O[WS(os, 12)]), VFMA(LDK(KP1_662939224), T2P, VMUL(LDK(KP1_111140466), T2O)), ovs, &(O[0]));
+	       T2Q = VSUB(T21, T28);
+	       T2R = VSUB(T2c, T2f);
+	       STA(&(O[WS(os, 13)]), VFMA(LDK(KP1_606415062), T2R, VMUL(LDK(KP1_191398608), T2Q)), ovs, &(O[0]));
+	       T2S = VSUB(T1J, T1Q);
+	       T2T = VSUB(T1U, T1X);
+	       STA(&(O[WS(os, 14)]), VFMA(LDK(KP1_546020906), T2T, VMUL(LDK(KP1_268786568), T2S)), ovs, &(O[0]));
+	       T2U = VSUB(T1c, T1t);
+	       T2V = VSUB(T1B, T1E);
+	       STA(&(O[WS(os, 15)]), VFMS(LDK(KP1_481902250), T2V, VMUL(LDK(KP1_343117909), T2U)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 16)]), VMUL(LDK(KP1_414213562), VSUB(TL, T10)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 17)]), VFMA(LDK(KP1_481902250), T2U, VMUL(LDK(KP1_343117909), T2V)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 18)]), VFMS(LDK(KP1_268786568), T2T, VMUL(LDK(KP1_546020906), T2S)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 19)]), VFMS(LDK(KP1_191398608), T2R, VMUL(LDK(KP1_606415062), T2Q)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 20)]), VFMS(LDK(KP1_111140466), T2P, VMUL(LDK(KP1_662939224), T2O)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 21)]), VFMA(LDK(KP1_715457220), T2M, VMUL(LDK(KP1_028205488), T2N)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 22)]), VFMA(LDK(KP1_763842528), T2K, VMUL(LDK(KP942793473), T2L)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 23)]), VFMS(LDK(KP855110186), T2J, VMUL(LDK(KP1_807978586), T2I)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 24)]), VFMA(LDK(KP1_847759065), T2G, VMUL(LDK(KP765366864), T2H)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 25)]), VFMA(LDK(KP1_883088130), T2C, VMUL(LDK(KP673779706), T2F)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 26)]), VFMS(LDK(KP580569354), T2z, VMUL(LDK(KP1_913880671), T2w)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 27)]), VFMS(LDK(KP485960359), T2t, VMUL(LDK(KP1_940062506), T2q)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 28)]), VFMA(LDK(KP1_961570560), T2k, VMUL(LDK(KP390180644), T2n)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 29)]), VFMA(LDK(KP1_978353019), T29, VMUL(LDK(KP293460948), T2g)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 30)]), VFMA(LDK(KP1_990369453), T1R, VMUL(LDK(KP196034280), T1Y)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 31)]), VFMS(LDK(KP098135348), T1F, VMUL(LDK(KP1_997590912), T1u)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 32, XSIMD_STRING("e10v_32"), {135, 53, 56, 0}, &GENUS, REDFT10 };
+
+void XSIMD(codelet_e10v_32) (planner *p) {
+     X(kr2r_register) (p, e10v_32, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e10v_32 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft10 -n 32 -name e10_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 186 FP additions, 104 FP multiplications,
+ * (or, 186 additions, 104 multiplications, 0 fused multiply/add),
+ * 186 stack variables, 39 constants, and 64 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e10v_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       V T2V, T2W, T2X, T2Y, T2Z, T30;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = VADD(T1, Tw);
+	       Ty = VADD(Tg, Th);
+	       Tz = VADD(Tx, Ty);
+	       TA = VADD(T9, To);
+	       TB = VADD(T8, Tp);
+	       TC = VADD(TA, TB);
+	       TD = VADD(Tz, TC);
+	       TE = VADD(T5, Ts);
+	       TF = VADD(Tc, Tl);
+	       TG = VADD(TE, TF);
+	       TH = VADD(Td, Tk);
+	       TI = VADD(T4, Tt);
+	       TJ = VADD(TH, TI);
+	       TK = VADD(TG, TJ);
+	       TL = VADD(TD, TK);
+	       TM = VADD(T3, Tu);
+	       TN = VADD(Te, Tj);
+	       TO = VADD(TM, TN);
+	       TP = VADD(Tb, Tm);
+	       TQ = VADD(T6, Tr);
+	       TR = VADD(TP, TQ);
+	       TS = VADD(TO, TR);
+	       TT = VADD(T7, Tq);
+	       TU = VADD(Ta, Tn);
+	       TV = VADD(TT, TU);
+	       TW = VADD(Tf, Ti);
+	       TX = VADD(T2, Tv);
+	       TY = VADD(TW, TX);
+	       TZ = VADD(TV, TY);
+	       T10 = VADD(TS, TZ);
+	       STA(&(O[0]), VMUL(LDK(KP2_000000000), VADD(TL, T10)), ovs, &(O[0]));
+	       T11 = VSUB(T1, Tw);
+	       T12 = VMUL(LDK(KP707106781), VSUB(T9, To));
+	       T13 = VMUL(LDK(KP707106781), VSUB(T8, Tp));
+	       T14 = VADD(T12, T13);
+	       T15 = VADD(T11, T14);
+	       T16 = VSUB(T5, Ts);
+	       T17 = VSUB(Tc, Tl);
+	       T18 = VADD(VMUL(LDK(KP923879532), T16), VMUL(LDK(KP382683432), T17));
+	       T19 = VSUB(Td, Tk);
+	       T1a = VSUB(T4, Tt);
+	       T1b = VADD(VMUL(LDK(KP382683432), T19), VMUL(LDK(KP923879532), T1a));
+	       T1c = VADD(T18, T1b);
+	       T1d = VADD(T15, T1c);
+	       T1e = VSUB(T3, Tu);
+	       T1f = VMUL(LDK(KP707106781), VSUB(Tb, Tm));
+	       T1g = VMUL(LDK(KP707106781), VSUB(T6, Tr));
+	       T1h = VADD(T1f, T1g);
+	       T1i = VADD(T1e, T1h);
+	       T1j = VSUB(Te, Tj);
+	       T1k = VSUB(T1f, T1g);
+	       T1l = VSUB(T1j, T1k);
+	       T1m = VADD(VMUL(LDK(KP980785280), T1i), VMUL(LDK(KP195090322), T1l));
+	       T1n = VSUB(T7, Tq);
+	       T1o = VMUL(LDK(KP707106781), VSUB(Tf, Ti));
+	       T1p = VMUL(LDK(KP707106781), VSUB(T2, Tv));
+	       T1q = VADD(T1o, T1p);
+	       T1r = VADD(T1n, T1q);
+	       T1s = VSUB(Ta, Tn);
+	       T1t = VSUB(T1o, T1p);
+	       T1u = VSUB(T1s, T1t);
+	       T1v = VADD(VMUL(LDK(KP831469612), T1r), VMUL(LDK(KP555570233), T1u));
+	       T1w = VADD(T1m, T1v);
+	       T1x = VADD(T1d, T1w);
+	       T1y = VSUB(Tg, Th);
+	       T1z = VSUB(T12, T13);
+	       T1A = VSUB(T1y, T1z);
+	       T1B = VSUB(VMUL(LDK(KP923879532), T17), VMUL(LDK(KP382683432), T16));
+	       T1C = VSUB(VMUL(LDK(KP382683432), T1a), VMUL(LDK(KP923879532), T19));
+	       T1D = VADD(T1B, T1C);
+	       T1E = VADD(T1A, T1D);
+	       T1F = VSUB(VMUL(LDK(KP980785280), T1l), VMUL(LDK(KP195090322), T1i));
+	       T1G = VSUB(VMUL(LDK(KP831469612), T1u), VMUL(LDK(KP555570233), T1r));
+	       T1H = VADD(T1F, T1G);
+	       T1I = VADD(T1E, T1H);
+	       STA(&(O[WS(os, 1)]), VADD(VMUL(LDK(KP1_997590912), T1x), VMUL(LDK(KP098135348), T1I)), ovs, &(O[0]));
+	       T1J = VSUB(Tx, Ty);
+	       T1K = VMUL(LDK(KP707106781), VSUB(TE, TF));
+	       T1L = VMUL(LDK(KP707106781), VSUB(TH, TI));
+	       T1M = VSUB(T1K, T1L);
+	       T1N = VADD(T1J, T1M);
+	       T1O = VSUB(TM, TN);
+	       T1P = VSUB(TP, TQ);
+	       T1Q = VSUB(VMUL(LDK(KP923879532), T1O), VMUL(LDK(KP382683432), T1P));
+	       T1R = VSUB(TT, TU);
+	       T1S = VSUB(TW, TX);
+	       T1T = VSUB(VMUL(LDK(KP382683432), T1R), VMUL(LDK(KP923879532), T1S));
+	       T1U = VADD(T1Q, T1T);
+	       T1V = VADD(T1N, T1U);
+	       T1W = VSUB(TA, TB);
+	       T1X = VADD(T1K, T1L);
+	       T1Y = VADD(T1W, T1X);
+	       T1Z = VADD(VMUL(LDK(KP923879532), T1P), VMUL(LDK(KP382683432), T1O));
+	       T20 = VADD(VMUL(LDK(KP382683432), T1S), VMUL(LDK(KP923879532), T1R));
+	       T21 = VADD(T1Z, T20);
+	       T22 = VADD(T1Y, T21);
+	       STA(&(O[WS(os, 2)]), VSUB(VMUL(LDK(KP1_990369453), T1V), VMUL(LDK(KP196034280), T22)), ovs, &(O[0]));
+	       T23 = VSUB(T11, T14);
+	       T24 = VSUB(T1B, T1C);
+	       T25 = VSUB(T23, T24);
+	       T26 = VSUB(T1e, T1h);
+	       T27 = VADD(T1j, T1k);
+	       T28 = VSUB(VMUL(LDK(KP831469612), T26), VMUL(LDK(KP555570233), T27));
+	       T29 = VSUB(T1n, T1q);
+	       T2a = VADD(T1s, T1t);
+	       T2b = VADD(VMUL(LDK(KP195090322), T29), VMUL(LDK(KP980785280), T2a));
+	       T2c = VSUB(T28, T2b);
+	       T2d = VADD(T25, T2c);
+	       T2e = VADD(T1y, T1z);
+	       T2f = VSUB(T18, T1b);
+	       T2g = VADD(T2e, T2f);
+	       T2h = VADD(VMUL(LDK(KP831469612), T27), VMUL(LDK(KP555570233), T26));
+	       T2i = VSUB(VMUL(LDK(KP195090322), T2a), VMUL(LDK(KP980785280), T29));
+	       T2j = VSUB(T2h, T2i);
+	       T2k = VADD(T2g, T2j);
+	       STA(&(O[WS(os, 3)]), VSUB(VMUL(LDK(KP1_978353019), T2d), VMUL(LDK(KP293460948), T2k)), ovs, &(O[0]));
+	       T2l = VSUB(Tz, TC);
+	       T2m = VMUL(LDK(KP707106781), VSUB(TO, TR));
+	       T2n = VMUL(LDK(KP707106781), VSUB(TV, TY));
+	       T2o = VSUB(T2m, T2n);
+	       T2p = VADD(T2l, T2o);
+	       T2q = VSUB(TG, TJ);
+	       T2r = VADD(T2m, T2n);
+	       T2s = VADD(T2q, T2r);
+	       STA(&(O[WS(os, 4)]), VSUB(VMUL(LDK(KP1_961570560), T2p), VMUL(LDK(KP390180644), T2s)), ovs, &(O[0]));
+	       T2t = VADD(T23, T24);
+	       T2u = VADD(T2h, T2i);
+	       T2v = VADD(T2t, T2u);
+	       T2w = VSUB(T2e, T2f);
+	       T2x = VADD(T28, T2b);
+	       T2y = VSUB(T2w, T2x);
+	       STA(&(O[WS(os, 5)]), VADD(VMUL(LDK(KP1_940062506), T2v), VMUL(LDK(KP485960359), T2y)), ovs, &(O[0]));
+	       T2z = VSUB(T1J, T1M);
+	       T2A = VSUB(T1Z, T20);
+	       T2B = VADD(T2z, T2A);
+	       T2C = VSUB(T1W, T1X);
+	       T2D = VSUB(T1Q, T1T);
+	       T2E = VSUB(T2C, T2D);
+	       STA(&(O[WS(os, 6)]), VADD(VMUL(LDK(KP1_913880671), T2B), VMUL(LDK(KP580569354), T2E)), ovs, &(O[0]));
+	       T2F = VSUB(T15, T1c);
+	       T2G = VSUB(T1F, T1G);
+	       T2H = VSUB(T2F, T2G);
+	       T2I = VSUB(T1A, T1D);
+	       T2J = VSUB(T1m, T1v);
+	       T2K = VADD(T2I, T2J);
+	       STA(&(O[WS(os, 7)]), VSUB(VMUL(LDK(KP1_883088130), T2H), VMUL(LDK(KP673779706), T2K)), ovs, &(O[0]));
+	       T2L = VSUB(TD, TK);
+	       T2M = VSUB(TS, TZ);
+	       STA(&(O[WS(os, 8)]), VSUB(VMUL(LDK(KP1_847759065), T2L), VMUL(LDK(KP765366864), T2M)), ovs, &(O[0]));
+	       T2N = VADD(T2F, T2G);
+	       T2O = VSUB(T2I, T2J);
+	       STA(&(O[WS(os, 9)]), VADD(VMUL(LDK(KP1_807978586), T2N), VMUL(LDK(KP855110186), T2O)), ovs, &(O[0]));
+	       T2P = VSUB(T2z, T2A);
+	       T2Q = VADD(T2C, T2D);
+	       STA(&(O[WS(os, 10)]), VSUB(VMUL(LDK(KP1_763842528), T2P), VMUL(LDK(KP942793473), T2Q)), ovs, &(O[0]));
+	       T2R = VSUB(T2t, T2u);
+	       T2S = VADD(T2w, T2x);
+	       STA(&(O[WS(os, 11)]), VSUB(VMUL(LDK(KP1_715457220), T2R), VMUL(LDK(KP1_028205488), T2S)), ovs, &(O[0]));
+	       T2T = VSUB(T2l, T2o);
+	       T2U = VSUB(T2q, T2r);
+	       STA(&(O[WS(os, 12)]), VADD(VMUL(LDK(KP1_662939224), T2T), VMUL(LDK(KP1_111140466), T2U)), ovs, &(O[0]));
+	       T2V = VSUB(T25, T2c);
+	       T2W = VSUB(T2g, T2j);
+	       STA(&(O[WS(os, 13)]), VADD(VMUL(LDK(KP1_606415062), T2V), VMUL(LDK(KP1_191398608), T2W)), ovs, &(O[0]));
+	       T2X = VSUB(T1N, T1U);
+	       T2Y = VSUB(T1Y, T21);
+	       STA(&(O[WS(os, 14)]), VADD(VMUL(LDK(KP1_546020906), T2X), VMUL(LDK(KP1_268786568), T2Y)), ovs, &(O[0]));
+	       T2Z = VSUB(T1d, T1w);
+	       T30 = VSUB(T1E, T1H);
+	       STA(&(O[WS(os, 15)]), VSUB(VMUL(LDK(KP1_481902250), T2Z), VMUL(LDK(KP1_343117909), T30)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 16)]), VMUL(LDK(KP1_414213562), VSUB(TL, T10)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 17)]), VADD(VMUL(LDK(KP1_481902250), T30), VMUL(LDK(KP1_343117909), T2Z)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 18)]), VSUB(VMUL(LDK(KP1_268786568), T2X), VMUL(LDK(KP1_546020906), T2Y)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 19)]), VSUB(VMUL(LDK(KP1_191398608), T2V), VMUL(LDK(KP1_606415062), T2W)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 20)]), VSUB(VMUL(LDK(KP1_111140466), T2T), VMUL(LDK(KP1_662939224), T2U)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 21)]), VADD(VMUL(LDK(KP1_715457220), T2S), VMUL(LDK(KP1_028205488), T2R)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 22)]), VADD(VMUL(LDK(KP1_763842528), T2Q), VMUL(LDK(KP942793473), T2P)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 23)]), VSUB(VMUL(LDK(KP855110186), T2N), VMUL(LDK(KP1_807978586), T2O)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 24)]), VADD(VMUL(LDK(KP1_847759065), T2M), VMUL(LDK(KP765366864), T2L)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 25)]), VADD(VMUL(LDK(KP1_883088130), T2K), VMUL(LDK(KP673779706), T2H)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 26)]), VSUB(VMUL(LDK(KP580569354), T2B), VMUL(LDK(KP1_913880671), T2E)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 27)]), VSUB(VMUL(LDK(KP485960359), T2v), VMUL(LDK(KP1_940062506), T2y)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 28)]), VADD(VMUL(LDK(KP1_961570560), T2s), VMUL(LDK(KP390180644), T2p)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 29)]), VADD(VMUL(LDK(KP1_978353019), T2k), VMUL(LDK(KP293460948), T2d)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 30)]), VADD(VMUL(LDK(KP1_990369453), T22), VMUL(LDK(KP196034280), T1V)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 31)]), VSUB(VMUL(LDK(KP098135348), T1x), VMUL(LDK(KP1_997590912), T1I)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 32, XSIMD_STRING("e10v_32"), {186, 104, 0, 0}, &GENUS, REDFT10 };
+
+void XSIMD(codelet_e10v_32) (planner *p) {
+     X(kr2r_register) (p, e10v_32, &desc);
+}
+
+#endif
@@ -0,0 +1,1347 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e10v_64 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft10 -n 64 -name e10_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 466 FP additions, 260 FP multiplications,
+ * (or, 332 additions, 126 multiplications, 134 fused multiply/add),
+ * 446 stack variables, 79 constants, and 128 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e10v_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DVK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DVK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DVK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DVK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DVK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DVK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DVK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DVK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DVK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DVK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DVK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DVK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DVK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DVK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DVK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DVK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DVK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DVK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DVK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DVK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DVK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DVK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DVK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DVK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       V T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       V T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       V T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       V T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       V T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       V T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       V T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       V T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       V T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       V T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       V T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       V T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       V T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       V T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       V T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       V T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       V T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       V T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       V T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       V T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       V T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       V T6Z, T70, T71, T72, T73, T74, T75, T76, T77, T78, T79, T7a;
+	       V T7b, T7c;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = LDA(&(I[WS(is, 32)]), ivs, &(I[0]));
+	       Ty = LDA(&(I[WS(is, 33)]), ivs, &(I[0]));
+	       Tz = LDA(&(I[WS(is, 34)]), ivs, &(I[0]));
+	       TA = LDA(&(I[WS(is, 35)]), ivs, &(I[0]));
+	       TB = LDA(&(I[WS(is, 36)]), ivs, &(I[0]));
+	       TC = LDA(&(I[WS(is, 37)]), ivs, &(I[0]));
+	       TD = LDA(&(I[WS(is, 38)]), ivs, &(I[0]));
+	       TE = LDA(&(I[WS(is, 39)]), ivs, &(I[0]));
+	       TF = LDA(&(I[WS(is, 40)]), ivs, &(I[0]));
+	       TG = LDA(&(I[WS(is, 41)]), ivs, &(I[0]));
+	       TH = LDA(&(I[WS(is, 42)]), ivs, &(I[0]));
+	       TI = LDA(&(I[WS(is, 43)]), ivs, &(I[0]));
+	       TJ = LDA(&(I[WS(is, 44)]), ivs, &(I[0]));
+	       TK = LDA(&(I[WS(is, 45)]), ivs, &(I[0]));
+	       TL = LDA(&(I[WS(is, 46)]), ivs, &(I[0]));
+	       TM = LDA(&(I[WS(is, 47)]), ivs, &(I[0]));
+	       TN = LDA(&(I[WS(is, 48)]), ivs, &(I[0]));
+	       TO = LDA(&(I[WS(is, 49)]), ivs, &(I[0]));
+	       TP = LDA(&(I[WS(is, 50)]), ivs, &(I[0]));
+	       TQ = LDA(&(I[WS(is, 51)]), ivs, &(I[0]));
+	       TR = LDA(&(I[WS(is, 52)]), ivs, &(I[0]));
+	       TS = LDA(&(I[WS(is, 53)]), ivs, &(I[0]));
+	       TT = LDA(&(I[WS(is, 54)]), ivs, &(I[0]));
+	       TU = LDA(&(I[WS(is, 55)]), ivs, &(I[0]));
+	       TV = LDA(&(I[WS(is, 56)]), ivs, &(I[0]));
+	       TW = LDA(&(I[WS(is, 57)]), ivs, &(I[0]));
+	       TX = LDA(&(I[WS(is, 58)]), ivs, &(I[0]));
+	       TY = LDA(&(I[WS(is, 59)]), ivs, &(I[0]));
+	       TZ = LDA(&(I[WS(is, 60)]), ivs, &(I[0]));
+	       T10 = LDA(&(I[WS(is, 61)]), ivs, &(I[0]));
+	       T11 = LDA(&(I[WS(is, 62)]), ivs, &(I[0]));
+	       T12 = LDA(&(I[WS(is, 63)]), ivs, &(I[0]));
+	       T13 = VADD(T1, T12);
+	       T14 = VADD(Tw, Tx);
+	       T15 = VADD(T13, T14);
+	       T16 = VADD(Th, TM);
+	       T17 = VADD(Tg, TN);
+	       T18 = VADD(T16, T17);
+	       T19 = VADD(T15, T18);
+	       T1a = VADD(T9, TU);
+	       T1b = VADD(To, TF);
+	       T1c = VADD(T1a, T1b);
+	       T1d = VADD(Tp, TE);
+	       T1e = VADD(T8, TV);
+	       T1f = VADD(T1d, T1e);
+	       T1g = VADD(T1c, T1f);
+	       T1h = VADD(T19, T1g);
+	       T1i = VADD(T5, TY);
+	       T1j = VADD(Ts, TB);
+	       T1k = VADD(T1i, T1j);
+	       T1l = VADD(Tl, TI);
+	       T1m = VADD(Tc, TR);
+	       T1n = VADD(T1l, T1m);
+	       T1o = VADD(T1k, T1n);
+	       T1p = VADD(Td, TQ);
+	       T1q = VADD(Tk, TJ);
+	       T1r = VADD(T1p, T1q);
+	       T1s = VADD(Tt, TA);
+	       T1t = VADD(T4, TZ);
+	       T1u = VADD(T1s, T1t);
+	       T1v = VADD(T1r, T1u);
+	       T1w = VADD(T1o, T1v);
+	       T1x = VADD(T1h, T1w);
+	       T1y = VADD(T3, T10);
+	       T1z = VADD(Tu, Tz);
+	       T1A = VADD(T1y, T1z);
+	       T1B = VADD(Tj, TK);
+	       T1C = VADD(Te, TP);
+	       T1D = VADD(T1B, T1C);
+	       T1E = VADD(T1A, T1D);
+	       T1F = VADD(Tb, TS);
+	       T1G = VADD(Tm, TH);
+	       T1H = VADD(T1F, T1G);
+	       T1I = VADD(Tr, TC);
+	       T1J = VADD(T6, TX);
+	       T1K = VADD(T1I, T1J);
+	       T1L = VADD(T1H, T1K);
+	       T1M = VADD(T1E, T1L);
+	       T1N = VADD(T7, TW);
+	       T1O = VADD(Tq, TD);
+	       T1P = VADD(T1N, T1O);
+	       T1Q = VADD(Tn, TG);
+	       T1R = VADD(Ta, TT);
+	       T1S = VADD(T1Q, T1R);
+	       T1T = VADD(T1P, T1S);
+	       T1U = VADD(Tf, TO);
+	       T1V = VADD(Ti, TL);
+	       T1W = VADD(T1U, T1V);
+	       T1X = VADD(Tv, Ty);
+	       T1Y = VADD(T2, T11);
+	       T1Z = VADD(T1X, T1Y);
+	       T20 = VADD(T1W, T1Z);
+	       T21 = VADD(T1T, T20);
+	       T22 = VADD(T1M, T21);
+	       STA(&(O[0]), VMUL(LDK(KP2_000000000), VADD(T1x, T22)), ovs, &(O[0]));
+	       T23 = VSUB(Tw, Tx);
+	       T24 = VMUL(LDK(KP707106781), VSUB(Tg, TN));
+	       T25 = VFMS(LDK(KP707106781), VSUB(Th, TM), T24);
+	       T26 = VSUB(T23, T25);
+	       T27 = VSUB(T9, TU);
+	       T28 = VSUB(To, TF);
+	       T29 = VFMS(LDK(KP923879532), T28, VMUL(LDK(KP382683432), T27));
+	       T2a = VSUB(Tp, TE);
+	       T2b = VSUB(T8, TV);
+	       T2c = VFMS(LDK(KP382683432), T2b, VMUL(LDK(KP923879532), T2a));
+	       T2d = VADD(T29, T2c);
+	       T2e = VADD(T26, T2d);
+	       T2f = VSUB(T5, TY);
+	       T2g = VMUL(LDK(KP707106781), VSUB(Tc, TR));
+	       T2h = VFMA(LDK(KP707106781), VSUB(Tl, TI), T2g);
+	       T2i = VADD(T2f, T2h);
+	       T2j = VSUB(Ts, TB);
+	       T2k = VFMS(LDK(KP707106781), VSUB(Tl, TI), T2g);
+	       T2l = VSUB(T2j, T2k);
+	       T2m = VFMS(LDK(KP980785280), T2l, VMUL(LDK(KP195090322), T2i));
+	       T2n = VSUB(Td, TQ);
+	       T2o = VMUL(LDK(KP707106781), VSUB(T4, TZ));
+	       T2p = VFMA(LDK(KP707106781), VSUB(Tt, TA), T2o);
+	       T2q = VADD(T2n, T2p);
+	       T2r = VSUB(Tk, TJ);
+	       T2s = VFMS(LDK(KP707106781), VSUB(Tt, TA), T2o);
+	       T2t = VSUB(T2r, T2s);
+	       T2u = VFMS(LDK(KP831469612), T2t, VMUL(LDK(KP555570233), T2q));
+	       T2v = VADD(T2m, T2u);
+	       T2w = VADD(T2e, T2v);
+	       T2x = VSUB(T3, T10);
+	       T2y = VMUL(LDK(KP707106781), VSUB(Te, TP));
+	       T2z = VFMA(LDK(KP707106781), VSUB(Tj, TK), T2y);
+	       T2A = VADD(T2x, T2z);
+	       T2B = VSUB(Tm, TH);
+	       T2C = VSUB(Tb, TS);
+	       T2D = VFMA(LDK(KP923879532), T2C, VMUL(LDK(KP382683432), T2B));
+	       T2E = VSUB(T6, TX);
+	       T2F = VSUB(Tr, TC);
+	       T2G = VFMA(LDK(KP382683432), T2F, VMUL(LDK(KP923879532), T2E));
+	       T2H = VADD(T2D, T2G);
+	       T2I = VADD(T2A, T2H);
+	       T2J = VSUB(Tu, Tz);
+	       T2K = VFMS(LDK(KP707106781), VSUB(Tj, TK), T2y);
+	       T2L = VSUB(T2J, T2K);
+	       T2M = VFMS(LDK(KP923879532), T2B, VMUL(LDK(KP382683432), T2C));
+	       T2N = VFMS(LDK(KP382683432), T2E, VMUL(LDK(KP923879532), T2F));
+	       T2O = VADD(T2M, T2N);
+	       T2P = VADD(T2L, T2O);
+	       T2Q = VFMS(LDK(KP995184726), T2P, VMUL(LDK(KP098017140), T2I));
+	       T2R = VSUB(T7, TW);
+	       T2S = VMUL(LDK(KP707106781), VSUB(Ta, TT));
+	       T2T = VFMA(LDK(KP707106781), VSUB(Tn, TG), T2S);
+	       T2U = VADD(T2R, T2T);
+	       T2V = VSUB(Ti, TL);
+	       T2W = VSUB(Tf, TO);
+	       T2X = VFMA(LDK(KP923879532), T2W, VMUL(LDK(KP382683432), T2V));
+	       T2Y = VSUB(T2, T11);
+	       T2Z = VSUB(Tv, Ty);
+	       T30 = VFMA(LDK(KP382683432), T2Z, VMUL(LDK(KP923879532), T2Y));
+	       T31 = VADD(T2X, T30);
+	       T32 = VADD(T2U, T31);
+	       T33 = VSUB(Tq, TD);
+	       T34 = VFMS(LDK(KP707106781), VSUB(Tn, TG), T2S);
+	       T35 = VSUB(T33, T34);
+	       T36 = VFMS(LDK(KP923879532), T2V, VMUL(LDK(KP382683432), T2W));
+	       T37 = VFMS(LDK(KP382683432), T2Y, VMUL(LDK(KP923879532), T2Z));
+	       T38 = VADD(T36, T37);
+	       T39 = VADD(T35, T38);
+	       T3a = VFMS(LDK(KP956940335), T39, VMUL(LDK(KP290284677), T32));
+	       T3b = VADD(T2Q, T3a);
+	       T3c = VADD(T2w, T3b);
+	       T3d = VSUB(T1, T12);
+	       T3e = VFMA(LDK(KP707106781), VSUB(Th, TM), T24);
+	       T3f = VADD(T3d, T3e);
+	       T3g = VFMA(LDK(KP923879532), T27, VMUL(LDK(KP382683432), T28));
+	       T3h = VFMA(LDK(KP382683432), T2a, VMUL(LDK(KP923879532), T2b));
+	       T3i = VADD(T3g, T3h);
+	       T3j = VADD(T3f, T3i);
+	       T3k = VFMA(LDK(KP980785280), T2i, VMUL(LDK(KP195090322), T2l));
+	       T3l = VFMA(LDK(KP831469612), T2q, VMUL(LDK(KP555570233), T2t));
+	       T3m = VADD(T3k, T3l);
+	       T3n = VADD(T3j, T3m);
+	       T3o = VFMA(LDK(KP995184726), T2I, VMUL(LDK(KP098017140), T2P));
+	       T3p = VFMA(LDK(KP956940335), T32, VMUL(LDK(KP290284677), T39));
+	       T3q = VADD(T3o, T3p);
+	       T3r = VADD(T3n, T3q);
+	       STA(&(O[WS(os, 1)]), VFMA(LDK(KP1_999397637), T3r, VMUL(LDK(KP049082457), T3c)), ovs, &(O[0]));
+	       T3s = VSUB(T16, T17);
+	       T3t = VMUL(LDK(KP707106781), VSUB(T1d, T1e));
+	       T3u = VFMA(LDK(KP707106781), VSUB(T1a, T1b), T3t);
+	       T3v = VADD(T3s, T3u);
+	       T3w = VSUB(T1i, T1j);
+	       T3x = VSUB(T1l, T1m);
+	       T3y = VFMA(LDK(KP923879532), T3x, VMUL(LDK(KP382683432), T3w));
+	       T3z = VSUB(T1p, T1q);
+	       T3A = VSUB(T1s, T1t);
+	       T3B = VFMA(LDK(KP382683432), T3A, VMUL(LDK(KP923879532), T3z));
+	       T3C = VADD(T3y, T3B);
+	       T3D = VADD(T3v, T3C);
+	       T3E = VSUB(T1y, T1z);
+	       T3F = VMUL(LDK(KP707106781), VSUB(T1I, T1J));
+	       T3G = VFMS(LDK(KP707106781), VSUB(T1F, T1G), T3F);
+	       T3H = VADD(T3E, T3G);
+	       T3I = VSUB(T1B, T1C);
+	       T3J = VFMA(LDK(KP707106781), VSUB(T1F, T1G), T3F);
+	       T3K = VADD(T3I, T3J);
+	       T3L = VFMA(LDK(KP980785280), T3K, VMUL(LDK(KP195090322), T3H));
+	       T3M = VSUB(T1N, T1O);
+	       T3N = VMUL(LDK(KP707106781), VSUB(T1X, T1Y));
+	       T3O = VFMS(LDK(KP707106781), VSUB(T1U, T1V), T3N);
+	       T3P = VADD(T3M, T3O);
+	       T3Q = VSUB(T1Q, T1R);
+	       T3R = VFMA(LDK(KP707106781), VSUB(T1U, T1V), T3N);
+	       T3S = VADD(T3Q, T3R);
+	       T3T = VFMA(LDK(KP831469612), T3S, VMUL(LDK(KP555570233), T3P));
+	       T3U = VADD(T3L, T3T);
+	       T3V = VADD(T3D, T3U);
+	       T3W = VSUB(T13, T14);
+	       T3X = VFMS(LDK(KP707106781), VSUB(T1a, T1b), T3t);
+	       T3Y = VADD(T3W, T3X);
+	       T3Z = VFMS(LDK(KP923879532), T3w, VMUL(LDK(KP382683432), T3x));
+	       T40 = VFMS(LDK(KP382683432), T3z, VMUL(LDK(KP923879532), T3A));
+	       T41 = VADD(T3Z, T40);
+	       T42 = VADD(T3Y, T41);
+	       T43 = VFMS(LDK(KP980785280), T3H, VMUL(LDK(KP195090322), T3K));
+	       T44 = VFMS(LDK(KP831469612), T3P, VMUL(LDK(KP555570233), T3S));
+	       T45 = VADD(T43, T44);
+	       T46 = VADD(T42, T45);
+	       STA(&(O[WS(os, 2)]), VFMS(LDK(KP1_997590912), T46, VMUL(LDK(KP098135348), T3V)), ovs, &(O[0]));
+	       T47 = VADD(T23, T25);
+	       T48 = VSUB(T3g, T3h);
+	       T49 = VADD(T47, T48);
+	       T4a = VSUB(T2f, T2h);
+	       T4b = VADD(T2j, T2k);
+	       T4c = VFMA(LDK(KP831469612), T4b, VMUL(LDK(KP555570233), T4a));
+	       T4d = VSUB(T2n, T2p);
+	       T4e = VADD(T2r, T2s);
+	       T4f = VFMS(LDK(KP195090322), T4e, VMUL(LDK(KP980785280), T4d));
+	       T4g = VSUB(T4c, T4f);
+	       T4h = VADD(T49, T4g);
+	       T4i = VSUB(T2x, T2z);
+	       T4j = VSUB(T2M, T2N);
+	       T4k = VSUB(T4i, T4j);
+	       T4l = VADD(T2J, T2K);
+	       T4m = VSUB(T2D, T2G);
+	       T4n = VADD(T4l, T4m);
+	       T4o = VFMA(LDK(KP956940335), T4n, VMUL(LDK(KP290284677), T4k));
+	       T4p = VSUB(T2R, T2T);
+	       T4q = VSUB(T36, T37);
+	       T4r = VSUB(T4p, T4q);
+	       T4s = VADD(T33, T34);
+	       T4t = VSUB(T2X, T30);
+	       T4u = VADD(T4s, T4t);
+	       T4v = VFMA(LDK(KP634393284), T4u, VMUL(LDK(KP773010453), T4r));
+	       T4w = VADD(T4o, T4v);
+	       T4x = VADD(T4h, T4w);
+	       T4y = VSUB(T3d, T3e);
+	       T4z = VSUB(T29, T2c);
+	       T4A = VSUB(T4y, T4z);
+	       T4B = VFMS(LDK(KP831469612), T4a, VMUL(LDK(KP555570233), T4b));
+	       T4C = VFMA(LDK(KP195090322), T4d, VMUL(LDK(KP980785280), T4e));
+	       T4D = VSUB(T4B, T4C);
+	       T4E = VADD(T4A, T4D);
+	       T4F = VFMS(LDK(KP956940335), T4k, VMUL(LDK(KP290284677), T4n));
+	       T4G = VFMS(LDK(KP634393284), T4r, VMUL(LDK(KP773010453), T4u));
+	       T4H = VADD(T4F, T4G);
+	       T4I = VADD(T4E, T4H);
+	       STA(&(O[WS(os, 3)]), VFMS(LDK(KP1_994580913), T4I, VMUL(LDK(KP147129127), T4x)), ovs, &(O[0]));
+	       T4J = VSUB(T1c, T1f);
+	       T4K = VMUL(LDK(KP707106781), VSUB(T1r, T1u));
+	       T4L = VFMA(LDK(KP707106781), VSUB(T1k, T1n), T4K);
+	       T4M = VADD(T4J, T4L);
+	       T4N = VSUB(T1A, T1D);
+	       T4O = VSUB(T1H, T1K);
+	       T4P = VFMA(LDK(KP923879532), T4O, VMUL(LDK(KP382683432), T4N));
+	       T4Q = VSUB(T1P, T1S);
+	       T4R = VSUB(T1W, T1Z);
+	       T4S = VFMA(LDK(KP382683432), T4R, VMUL(LDK(KP923879532), T4Q));
+	       T4T = VADD(T4P, T4S);
+	       T4U = VADD(T4M, T4T);
+	       T4V = VSUB(T15, T18);
+	       T4W = VFMS(LDK(KP707106781), VSUB(T1k, T1n), T4K);
+	       T4X = VADD(T4V, T4W);
+	       T4Y = VFMS(LDK(KP923879532), T4N, VMUL(LDK(KP382683432), T4O));
+	       T4Z = VFMS(LDK(KP382683432), T4Q, VMUL(LDK(KP923879532), T4R));
+	       T50 = VADD(T4Y, T4Z);
+	       T51 = VADD(T4X, T50);
+	       STA(&(O[WS(os, 4)]), VFMS(LDK(KP1_990369453), T51, VMUL(LDK(KP196034280), T4U)), ovs, &(O[0]));
+	       T52 = VSUB(T47, T48);
+	       T53 = VADD(T4B, T4C);
+	       T54 = VSUB(T52, T53);
+	       T55 = VADD(T4i, T4j);
+	       T56 = VSUB(T4l, T4m);
+	       T57 = VFMS(LDK(KP881921264), T56, VMUL(LDK(KP471396736), T55));
+	       T58 = VADD(T4p, T4q);
+	       T59 = VSUB(T4s, T4t);
+	       T5a = VFMS(LDK(KP098017140), T59, VMUL(LDK(KP995184726), T58));
+	       T5b = VADD(T57, T5a);
+	       T5c = VADD(T54, T5b);
+	       T5d = VADD(T4y, T4z);
+	       T5e = VADD(T4c, T4f);
+	       T5f = VADD(T5d, T5e);
+	       T5g = VFMA(LDK(KP881921264), T55, VMUL(LDK(KP471396736), T56));
+	       T5h = VFMA(LDK(KP098017140), T58, VMUL(LDK(KP995184726), T59));
+	       T5i = VADD(T5g, T5h);
+	       T5j = VADD(T5f, T5i);
+	       STA(&(O[WS(os, 5)]), VFMA(LDK(KP1_984959069), T5j, VMUL(LDK(KP244821350), T5c)), ovs, &(O[0]));
+	       T5k = VSUB(T3s, T3u);
+	       T5l = VSUB(T3Z, T40);
+	       T5m = VSUB(T5k, T5l);
+	       T5n = VSUB(T3E, T3G);
+	       T5o = VSUB(T3I, T3J);
+	       T5p = VFMS(LDK(KP831469612), T5o, VMUL(LDK(KP555570233), T5n));
+	       T5q = VSUB(T3M, T3O);
+	       T5r = VSUB(T3Q, T3R);
+	       T5s = VFMA(LDK(KP195090322), T5r, VMUL(LDK(KP980785280), T5q));
+	       T5t = VSUB(T5p, T5s);
+	       T5u = VADD(T5m, T5t);
+	       T5v = VSUB(T3W, T3X);
+	       T5w = VSUB(T3y, T3B);
+	       T5x = VADD(T5v, T5w);
+	       T5y = VFMA(LDK(KP831469612), T5n, VMUL(LDK(KP555570233), T5o));
+	       T5z = VFMS(LDK(KP195090322), T5q, VMUL(LDK(KP980785280), T5r));
+	       T5A = VSUB(T5y, T5z);
+	       T5B = VADD(T5x, T5A);
+	       STA(&(O[WS(os, 6)]), VFMA(LDK(KP1_978353019), T5B, VMUL(LDK(KP293460948), T5u)), ovs, &(O[0]));
+	       T5C = VSUB(T26, T2d);
+	       T5D = VSUB(T3k, T3l);
+	       T5E = VADD(T5C, T5D);
+	       T5F = VSUB(T2A, T2H);
+	       T5G = VSUB(T2L, T2O);
+	       T5H = VFMA(LDK(KP773010453), T5G, VMUL(LDK(KP634393284), T5F));
+	       T5I = VSUB(T2U, T31);
+	       T5J = VSUB(T35, T38);
+	       T5K = VFMS(LDK(KP471396736), T5J, VMUL(LDK(KP881921264), T5I));
+	       T5L = VSUB(T5H, T5K);
+	       T5M = VADD(T5E, T5L);
+	       T5N = VSUB(T3f, T3i);
+	       T5O = VSUB(T2m, T2u);
+	       T5P = VSUB(T5N, T5O);
+	       T5Q = VFMS(LDK(KP773010453), T5F, VMUL(LDK(KP634393284), T5G));
+	       T5R = VFMA(LDK(KP471396736), T5I, VMUL(LDK(KP881921264), T5J));
+	       T5S = VSUB(T5Q, T5R);
+	       T5T = VADD(T5P, T5S);
+	       STA(&(O[WS(os, 7)]), VFMS(LDK(KP1_970555284), T5T, VMUL(LDK(KP341923777), T5M)), ovs, &(O[0]));
+	       T5U = VSUB(T1o, T1v);
+	       T5V = VMUL(LDK(KP707106781), VSUB(T1T, T20));
+	       T5W = VFMA(LDK(KP707106781), VSUB(T1E, T1L), T5V);
+	       T5X = VADD(T5U, T5W);
+	       T5Y = VSUB(T19, T1g);
+	       T5Z = VFMS(LDK(KP707106781), VSUB(T1E, T1L), T5V);
+	       T60 = VADD(T5Y, T5Z);
+	       STA(&(O[WS(os, 8)]), VFMS(LDK(KP1_961570560), T60, VMUL(LDK(KP390180644), T5X)), ovs, &(O[0]));
+	       T61 = VSUB(T5C, T5D);
+	       T62 = VADD(T5Q, T5R);
+	       T63 = VSUB(T61, T62);
+	       T64 = VADD(T5N, T5O);
+	       T65 = VADD(T5H, T5K);
+	       T66 = VADD(T64, T65);
+	       STA(&(O[WS(os, 9)]), VFMA(LDK(KP1_951404260), T66, VMUL(LDK(KP438202480), T63)), ovs, &(O[0]));
+	       T67 = VADD(T5k, T5l);
+	       T68 = VADD(T5y, T5z);
+	       T69 = VADD(T67, T68);
+	       T6a = VSUB(T5v, T5w);
+	       T6b = VADD(T5p, T5s);
+	       T6c = VSUB(T6a, T6b);
+	       STA(&(O[WS(os, 10)]), VFMS(LDK(KP1_940062506), T6c, VMUL(LDK(KP485960359), T69)), ovs, &(O[0]));
+	       T6d = VADD(T52, T53);
+	       T6e = VSUB(T5g, T5h);
+	       T6f = VADD(T6d, T6e);
+	       T6g = VSUB(T5d, T5e);
+	       T6h = VSUB(T57, T5a);
+	       T6i = VSUB(T6g, T6h);
+	       STA(&(O[WS(os, 11)]), VFMS(LDK(KP1_927552131), T6i, VMUL(LDK(KP533425514), T6f)), ovs, &(O[0]));
+	       T6j = VSUB(T4J, T4L);
+	       T6k = VSUB(T4Y, T4Z);
+	       T6l = VSUB(T6j, T6k);
+	       T6m = VSUB(T4V, T4W);
+	       T6n = VSUB(T4P, T4S);
+	       T6o = VADD(T6m, T6n);
+	       STA(&(O[WS(os, 12)]), VFMA(LDK(KP1_913880671), T6o, VMUL(LDK(KP580569354), T6l)), ovs, &(O[0]));
+	       T6p = VSUB(T49, T4g);
+	       T6q = VSUB(T4F, T4G);
+	       T6r = VSUB(T6p, T6q);
+	       T6s = VSUB(T4A, T4D);
+	       T6t = VSUB(T4o, T4v);
+	       T6u = VADD(T6s, T6t);
+	       STA(&(O[WS(os, 13)]), VFMA(LDK(KP1_899056361), T6u, VMUL(LDK(KP627363480), T6r)), ovs, &(O[0]));
+	       T6v = VSUB(T3v, T3C);
+	       T6w = VSUB(T43, T44);
+	       T6x = VSUB(T6v, T6w);
+	       T6y = VSUB(T3Y, T41);
+	       T6z = VSUB(T3L, T3T);
+	       T6A = VADD(T6y, T6z);
+	       STA(&(O[WS(os, 14)]), VFMA(LDK(KP1_883088130), T6A, VMUL(LDK(KP673779706), T6x)), ovs, &(O[0]));
+	       T6B = VSUB(T2e, T2v);
+	       T6C = VSUB(T3o, T3p);
+	       T6D = VADD(T6B, T6C);
+	       T6E = VSUB(T3j, T3m);
+	       T6F = VSUB(T2Q, T3a);
+	       T6G = VSUB(T6E, T6F);
+	       STA(&(O[WS(os, 15)]), VFMS(LDK(KP1_865985597), T6G, VMUL(LDK(KP719790073), T6D)), ovs, &(O[0]));
+	       T6H = VSUB(T1M, T21);
+	       T6I = VSUB(T1h, T1w);
+	       STA(&(O[WS(os, 16)]), VFMS(LDK(KP1_847759065), T6I, VMUL(LDK(KP765366864), T6H)), ovs, &(O[0]));
+	       T6J = VSUB(T6B, T6C);
+	       T6K = VADD(T6E, T6F);
+	       STA(&(O[WS(os, 17)]), VFMA(LDK(KP1_828419511), T6K, VMUL(LDK(KP810482628), T6J)), ovs, &(O[0]));
+	       T6L = VADD(T6v, T6w);
+	       T6M = VSUB(T6y, T6z);
+	       STA(&(O[WS(os, 18)]), VFMS(LDK(KP1_807978586), T6M, VMUL(LDK(KP855110186), T6L)), ovs, &(O[0]));
+	       T6N = VADD(T6p, T6q);
+	       T6O = VSUB(T6s, T6t);
+	       STA(&(O[WS(os, 19)]), VFMS(LDK(KP1_786448602), T6O, VMUL(LDK(KP899222659), T6N)), ovs, &(O[0]));
+	       T6P = VADD(T6j, T6k);
+	       T6Q = VSUB(T6m, T6n);
+	       STA(&(O[WS(os, 20)]), VFMS(LDK(KP1_763842528), T6Q, VMUL(LDK(KP942793473), T6P)), ovs, &(O[0]));
+	       T6R = VSUB(T6d, T6e);
+	       T6S = VADD(T6g, T6h);
+	       STA(&(O[WS(os, 21)]), VFMA(LDK(KP1_740173982), T6S, VMUL(LDK(KP985796384), T6R)), ovs, &(O[0]));
+	       T6T = VSUB(T67, T68);
+	       T6U = VADD(T6a, T6b);
+	       STA(&(O[WS(os, 22)]), VFMA(LDK(KP1_715457220), T6U, VMUL(LDK(KP1_028205488), T6T)), ovs, &(O[0]));
+	       T6V = VADD(T61, T62);
+	       T6W = VSUB(T64, T65);
+	       STA(&(O[WS(os, 23)]), VFMS(LDK(KP1_689707130), T6W, VMUL(LDK(KP1_069995239), T6V)), ovs, &(O[0]));
+	       T6X = VSUB(T5U, T5W);
+	       T6Y = VSUB(T5Y, T5Z);
+	       STA(&(O[WS(os, 24)]), VFMA(LDK(KP1_662939224), T6Y, VMUL(LDK(KP1_111140466), T6X)), ovs, &(O[0]));
+	       T6Z = VSUB(T5E, T5L);
+	       T70 = VSUB(T5P, T5S);
+	       STA(&(O[WS(os, 25)]), VFMA(LDK(KP1_635169626), T70, VMUL(LDK(KP1_151616382), T6Z)), ovs, &(O[0]));
+	       T71 = VSUB(T5m, T5t);
+	       T72 = VSUB(T5x, T5A);
+	       STA(&(O[WS(os, 26)]), VFMS(LDK(KP1_606415062), T72, VMUL(LDK(KP1_191398608), T71)), ovs, &(O[0]));
+	       T73 = VSUB(T54, T5b);
+	       T74 = VSUB(T5f, T5i);
+	       STA(&(O[WS(os, 27)]), VFMS(LDK(KP1_576692855), T74, VMUL(LDK(KP1_230463181), T73)), ovs, &(O[0]));
+	       T75 = VSUB(T4M, T4T);
+	       T76 = VSUB(T4X, T50);
+	       STA(&(O[WS(os, 28)]), VFMA(LDK(KP1_546020906), T76, VMUL(LDK(KP1_268786568), T75)), ovs, &(O[0]));
+	       T77 = VSUB(T4h, T4w);
+	       T78 = VSUB(T4E, T4H);
+	       STA(&(O[WS(os, 29)]), VFMA(LDK(KP1_514417693), T78, VMUL(LDK(KP1_306345685), T77)), ovs, &(O[0]));
+	       T79 = VSUB(T3D, T3U);
+	       T7a = VSUB(T42, T45);
+	       STA(&(O[WS(os, 30)]), VFMA(LDK(KP1_481902250), T7a, VMUL(LDK(KP1_343117909), T79)), ovs, &(O[0]));
+	       T7b = VSUB(T2w, T3b);
+	       T7c = VSUB(T3n, T3q);
+	       STA(&(O[WS(os, 31)]), VFMS(LDK(KP1_448494165), T7c, VMUL(LDK(KP1_379081089), T7b)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 32)]), VMUL(LDK(KP1_414213562), VSUB(T1x, T22)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 33)]), VFMA(LDK(KP1_448494165), T7b, VMUL(LDK(KP1_379081089), T7c)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 34)]), VFMS(LDK(KP1_343117909), T7a, VMUL(LDK(KP1_481902250), T79)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 35)]), VFMS(LDK(KP1_306345685), T78, VMUL(LDK(KP1_514417693), T77)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 36)]), VFMS(LDK(KP1_268786568), T76, VMUL(LDK(KP1_546020906), T75)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 37)]), VFMA(LDK(KP1_576692855), T73, VMUL(LDK(KP1_230463181), T74)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 38)]), VFMA(LDK(KP1_606415062), T71, VMUL(LDK(KP1_191398608), T72)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 39)]), VFMS(LDK(KP1_151616382), T70, VMUL(LDK(KP1_635169626), T6Z)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 40)]), VFMS(LDK(KP1_111140466), T6Y, VMUL(LDK(KP1_662939224), T6X)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 41)]), VFMA(LDK(KP1_689707130), T6V, VMUL(LDK(KP1_069995239), T6W)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 42)]), VFMS(LDK(KP1_028205488), T6U, VMUL(LDK(KP1_715457220), T6T)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 43)]), VFMS(LDK(KP985796384), T6S, VMUL(LDK(KP1_740173982), T6R)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 44)]), VFMA(LDK(KP1_763842528), T6P, VMUL(LDK(KP942793473), T6Q)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 45)]), VFMA(LDK(KP1_786448602), T6N, VMUL(LDK(KP899222659), T6O)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 46)]), VFMA(LDK(KP1_807978586), T6L, VMUL(LDK(KP855110186), T6M)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 47)]), VFMS(LDK(KP810482628), T6K, VMUL(LDK(KP1_828419511), T6J)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 48)]), VFMA(LDK(KP1_847759065), T6H, VMUL(LDK(KP765366864), T6I)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 49)]), VFMA(LDK(KP1_865985597), T6D, VMUL(LDK(KP719790073), T6G)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 50)]), VFMS(LDK(KP673779706), T6A, VMUL(LDK(KP1_883088130), T6x)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 51)]), VFMS(LDK(KP627363480), T6u, VMUL(LDK(KP1_899056361), T6r)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 52)]), VFMS(LDK(KP580569354), T6o, VMUL(LDK(KP1_913880671), T6l)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 53)]), VFMA(LDK(KP1_927552131), T6f, VMUL(LDK(KP533425514), T6i)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 54)]), VFMA(LDK(KP1_940062506), T69, VMUL(LDK(KP485960359), T6c)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 55)]), VFMS(LDK(KP438202480), T66, VMUL(LDK(KP1_951404260), T63)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 56)]), VFMA(LDK(KP1_961570560), T5X, VMUL(LDK(KP390180644), T60)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 57)]), VFMA(LDK(KP1_970555284), T5M, VMUL(LDK(KP341923777), T5T)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 58)]), VFMS(LDK(KP293460948), T5B, VMUL(LDK(KP1_978353019), T5u)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 59)]), VFMS(LDK(KP244821350), T5j, VMUL(LDK(KP1_984959069), T5c)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 60)]), VFMA(LDK(KP1_990369453), T4U, VMUL(LDK(KP196034280), T51)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 61)]), VFMA(LDK(KP1_994580913), T4x, VMUL(LDK(KP147129127), T4I)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 62)]), VFMA(LDK(KP1_997590912), T3V, VMUL(LDK(KP098135348), T46)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 63)]), VFMS(LDK(KP049082457), T3r, VMUL(LDK(KP1_999397637), T3c)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 64, XSIMD_STRING("e10v_64"), {332, 126, 134, 0}, &GENUS, REDFT10 };
+
+void XSIMD(codelet_e10v_64) (planner *p) {
+     X(kr2r_register) (p, e10v_64, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e10v_64 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft10 -n 64 -name e10_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 456 FP additions, 250 FP multiplications,
+ * (or, 456 additions, 250 multiplications, 0 fused multiply/add),
+ * 456 stack variables, 79 constants, and 128 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e10v_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DVK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DVK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DVK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DVK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DVK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DVK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DVK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DVK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DVK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DVK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DVK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DVK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DVK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DVK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DVK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DVK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DVK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DVK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DVK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DVK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DVK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DVK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DVK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DVK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       V T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       V T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       V T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       V T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       V T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       V T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       V T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       V T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       V T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       V T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       V T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       V T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       V T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       V T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       V T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       V T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       V T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       V T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       V T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       V T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       V T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       V T6Z, T70, T71, T72, T73, T74, T75, T76, T77, T78, T79, T7a;
+	       V T7b, T7c, T7d, T7e, T7f, T7g, T7h, T7i, T7j, T7k, T7l, T7m;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = LDA(&(I[WS(is, 32)]), ivs, &(I[0]));
+	       Ty = LDA(&(I[WS(is, 33)]), ivs, &(I[0]));
+	       Tz = LDA(&(I[WS(is, 34)]), ivs, &(I[0]));
+	       TA = LDA(&(I[WS(is, 35)]), ivs, &(I[0]));
+	       TB = LDA(&(I[WS(is, 36)]), ivs, &(I[0]));
+	       TC = LDA(&(I[WS(is, 37)]), ivs, &(I[0]));
+	       TD = LDA(&(I[WS(is, 38)]), ivs, &(I[0]));
+	       TE = LDA(&(I[WS(is, 39)]), ivs, &(I[0]));
+	       TF = LDA(&(I[WS(is, 40)]), ivs, &(I[0]));
+	       TG = LDA(&(I[WS(is, 41)]), ivs, &(I[0]));
+	       TH = LDA(&(I[WS(is, 42)]), ivs, &(I[0]));
+	       TI = LDA(&(I[WS(is, 43)]), ivs, &(I[0]));
+	       TJ = LDA(&(I[WS(is, 44)]), ivs, &(I[0]));
+	       TK = LDA(&(I[WS(is, 45)]), ivs, &(I[0]));
+	       TL = LDA(&(I[WS(is, 46)]), ivs, &(I[0]));
+	       TM = LDA(&(I[WS(is, 47)]), ivs, &(I[0]));
+	       TN = LDA(&(I[WS(is, 48)]), ivs, &(I[0]));
+	       TO = LDA(&(I[WS(is, 49)]), ivs, &(I[0]));
+	       TP = LDA(&(I[WS(is, 50)]), ivs, &(I[0]));
+	       TQ = LDA(&(I[WS(is, 51)]), ivs, &(I[0]));
+	       TR = LDA(&(I[WS(is, 52)]), ivs, &(I[0]));
+	       TS = LDA(&(I[WS(is, 53)]), ivs, &(I[0]));
+	       TT = LDA(&(I[WS(is, 54)]), ivs, &(I[0]));
+	       TU = LDA(&(I[WS(is, 55)]), ivs, &(I[0]));
+	       TV = LDA(&(I[WS(is, 56)]), ivs, &(I[0]));
+	       TW = LDA(&(I[WS(is, 57)]), ivs, &(I[0]));
+	       TX = LDA(&(I[WS(is, 58)]), ivs, &(I[0]));
+	       TY = LDA(&(I[WS(is, 59)]), ivs, &(I[0]));
+	       TZ = LDA(&(I[WS(is, 60)]), ivs, &(I[0]));
+	       T10 = LDA(&(I[WS(is, 61)]), ivs, &(I[0]));
+	       T11 = LDA(&(I[WS(is, 62)]), ivs, &(I[0]));
+	       T12 = LDA(&(I[WS(is, 63)]), ivs, &(I[0]));
+	       T13 = VADD(T1, T12);
+	       T14 = VADD(Tw, Tx);
+	       T15 = VADD(T13, T14);
+	       T16 = VADD(Th, TM);
+	       T17 = VADD(Tg, TN);
+	       T18 = VADD(T16, T17);
+	       T19 = VADD(T15, T18);
+	       T1a = VADD(T9, TU);
+	       T1b = VADD(To, TF);
+	       T1c = VADD(T1a, T1b);
+	       T1d = VADD(Tp, TE);
+	       T1e = VADD(T8, TV);
+	       T1f = VADD(T1d, T1e);
+	       T1g = VADD(T1c, T1f);
+	       T1h = VADD(T19, T1g);
+	       T1i = VADD(T5, TY);
+	       T1j = VADD(Ts, TB);
+	       T1k = VADD(T1i, T1j);
+	       T1l = VADD(Tl, TI);
+	       T1m = VADD(Tc, TR);
+	       T1n = VADD(T1l, T1m);
+	       T1o = VADD(T1k, T1n);
+	       T1p = VADD(Td, TQ);
+	       T1q = VADD(Tk, TJ);
+	       T1r = VADD(T1p, T1q);
+	       T1s = VADD(Tt, TA);
+	       T1t = VADD(T4, TZ);
+	       T1u = VADD(T1s, T1t);
+	       T1v = VADD(T1r, T1u);
+	       T1w = VADD(T1o, T1v);
+	       T1x = VADD(T1h, T1w);
+	       T1y = VADD(T3, T10);
+	       T1z = VADD(Tu, Tz);
+	       T1A = VADD(T1y, T1z);
+	       T1B = VADD(Tj, TK);
+	       T1C = VADD(Te, TP);
+	       T1D = VADD(T1B, T1C);
+	       T1E = VADD(T1A, T1D);
+	       T1F = VADD(Tb, TS);
+	       T1G = VADD(Tm, TH);
+	       T1H = VADD(T1F, T1G);
+	       T1I = VADD(Tr, TC);
+	       T1J = VADD(T6, TX);
+	       T1K = VADD(T1I, T1J);
+	       T1L = VADD(T1H, T1K);
+	       T1M = VADD(T1E, T1L);
+	       T1N = VADD(T7, TW);
+	       T1O = VADD(Tq, TD);
+	       T1P = VADD(T1N, T1O);
+	       T1Q = VADD(Tn, TG);
+	       T1R = VADD(Ta, TT);
+	       T1S = VADD(T1Q, T1R);
+	       T1T = VADD(T1P, T1S);
+	       T1U = VADD(Tf, TO);
+	       T1V = VADD(Ti, TL);
+	       T1W = VADD(T1U, T1V);
+	       T1X = VADD(Tv, Ty);
+	       T1Y = VADD(T2, T11);
+	       T1Z = VADD(T1X, T1Y);
+	       T20 = VADD(T1W, T1Z);
+	       T21 = VADD(T1T, T20);
+	       T22 = VADD(T1M, T21);
+	       STA(&(O[0]), VMUL(LDK(KP2_000000000), VADD(T1x, T22)), ovs, &(O[0]));
+	       T23 = VSUB(T1, T12);
+	       T24 = VMUL(LDK(KP707106781), VSUB(Th, TM));
+	       T25 = VMUL(LDK(KP707106781), VSUB(Tg, TN));
+	       T26 = VADD(T24, T25);
+	       T27 = VADD(T23, T26);
+	       T28 = VSUB(T9, TU);
+	       T29 = VSUB(To, TF);
+	       T2a = VADD(VMUL(LDK(KP923879532), T28), VMUL(LDK(KP382683432), T29));
+	       T2b = VSUB(Tp, TE);
+	       T2c = VSUB(T8, TV);
+	       T2d = VADD(VMUL(LDK(KP382683432), T2b), VMUL(LDK(KP923879532), T2c));
+	       T2e = VADD(T2a, T2d);
+	       T2f = VADD(T27, T2e);
+	       T2g = VSUB(T5, TY);
+	       T2h = VMUL(LDK(KP707106781), VSUB(Tl, TI));
+	       T2i = VMUL(LDK(KP707106781), VSUB(Tc, TR));
+	       T2j = VADD(T2h, T2i);
+	       T2k = VADD(T2g, T2j);
+	       T2l = VSUB(Ts, TB);
+	       T2m = VSUB(T2h, T2i);
+	       T2n = VSUB(T2l, T2m);
+	       T2o = VADD(VMUL(LDK(KP980785280), T2k), VMUL(LDK(KP195090322), T2n));
+	       T2p = VSUB(Td, TQ);
+	       T2q = VMUL(LDK(KP707106781), VSUB(Tt, TA));
+	       T2r = VMUL(LDK(KP707106781), VSUB(T4, TZ));
+	       T2s = VADD(T2q, T2r);
+	       T2t = VADD(T2p, T2s);
+	       T2u = VSUB(Tk, TJ);
+	       T2v = VSUB(T2q, T2r);
+	       T2w = VSUB(T2u, T2v);
+	       T2x = VADD(VMUL(LDK(KP831469612), T2t), VMUL(LDK(KP555570233), T2w));
+	       T2y = VADD(T2o, T2x);
+	       T2z = VADD(T2f, T2y);
+	       T2A = VSUB(T3, T10);
+	       T2B = VMUL(LDK(KP707106781), VSUB(Tj, TK));
+	       T2C = VMUL(LDK(KP707106781), VSUB(Te, TP));
+	       T2D = VADD(T2B, T2C);
+	       T2E = VADD(T2A, T2D);
+	       T2F = VSUB(Tb, TS);
+	       T2G = VSUB(Tm, TH);
+	       T2H = VADD(VMUL(LDK(KP923879532), T2F), VMUL(LDK(KP382683432), T2G));
+	       T2I = VSUB(Tr, TC);
+	       T2J = VSUB(T6, TX);
+	       T2K = VADD(VMUL(LDK(KP382683432), T2I), VMUL(LDK(KP923879532), T2J));
+	       T2L = VADD(T2H, T2K);
+	       T2M = VADD(T2E, T2L);
+	       T2N = VSUB(Tu, Tz);
+	       T2O = VSUB(T2B, T2C);
+	       T2P = VSUB(T2N, T2O);
+	       T2Q = VSUB(VMUL(LDK(KP923879532), T2G), VMUL(LDK(KP382683432), T2F));
+	       T2R = VSUB(VMUL(LDK(KP382683432), T2J), VMUL(LDK(KP923879532), T2I));
+	       T2S = VADD(T2Q, T2R);
+	       T2T = VADD(T2P, T2S);
+	       T2U = VADD(VMUL(LDK(KP995184726), T2M), VMUL(LDK(KP098017140), T2T));
+	       T2V = VSUB(T7, TW);
+	       T2W = VMUL(LDK(KP707106781), VSUB(Tn, TG));
+	       T2X = VMUL(LDK(KP707106781), VSUB(Ta, TT));
+	       T2Y = VADD(T2W, T2X);
+	       T2Z = VADD(T2V, T2Y);
+	       T30 = VSUB(Tf, TO);
+	       T31 = VSUB(Ti, TL);
+	       T32 = VADD(VMUL(LDK(KP923879532), T30), VMUL(LDK(KP382683432), T31));
+	       T33 = VSUB(Tv, Ty);
+	       T34 = VSUB(T2, T11);
+	       T35 = VADD(VMUL(LDK(KP382683432), T33), VMUL(LDK(KP923879532), T34));
+	       T36 = VADD(T32, T35);
+	       T37 = VADD(T2Z, T36);
+	       T38 = VSUB(Tq, TD);
+	       T39 = VSUB(T2W, T2X);
+	       T3a = VSUB(T38, T39);
+	       T3b = VSUB(VMUL(LDK(KP923879532), T31), VMUL(LDK(KP382683432), T30));
+	       T3c = VSUB(VMUL(LDK(KP382683432), T34), VMUL(LDK(KP923879532), T33));
+	       T3d = VADD(T3b, T3c);
+	       T3e = VADD(T3a, T3d);
+	       T3f = VADD(VMUL(LDK(KP956940335), T37), VMUL(LDK(KP290284677), T3e));
+	       T3g = VADD(T2U, T3f);
+	       T3h = VADD(T2z, T3g);
+	       T3i = VSUB(Tw, Tx);
+	       T3j = VSUB(T24, T25);
+	       T3k = VSUB(T3i, T3j);
+	       T3l = VSUB(VMUL(LDK(KP923879532), T29), VMUL(LDK(KP382683432), T28));
+	       T3m = VSUB(VMUL(LDK(KP382683432), T2c), VMUL(LDK(KP923879532), T2b));
+	       T3n = VADD(T3l, T3m);
+	       T3o = VADD(T3k, T3n);
+	       T3p = VSUB(VMUL(LDK(KP980785280), T2n), VMUL(LDK(KP195090322), T2k));
+	       T3q = VSUB(VMUL(LDK(KP831469612), T2w), VMUL(LDK(KP555570233), T2t));
+	       T3r = VADD(T3p, T3q);
+	       T3s = VADD(T3o, T3r);
+	       T3t = VSUB(VMUL(LDK(KP995184726), T2T), VMUL(LDK(KP098017140), T2M));
+	       T3u = VSUB(VMUL(LDK(KP956940335), T3e), VMUL(LDK(KP290284677), T37));
+	       T3v = VADD(T3t, T3u);
+	       T3w = VADD(T3s, T3v);
+	       STA(&(O[WS(os, 1)]), VADD(VMUL(LDK(KP1_999397637), T3h), VMUL(LDK(KP049082457), T3w)), ovs, &(O[0]));
+	       T3x = VSUB(T13, T14);
+	       T3y = VMUL(LDK(KP707106781), VSUB(T1a, T1b));
+	       T3z = VMUL(LDK(KP707106781), VSUB(T1d, T1e));
+	       T3A = VSUB(T3y, T3z);
+	       T3B = VADD(T3x, T3A);
+	       T3C = VSUB(T1i, T1j);
+	       T3D = VSUB(T1l, T1m);
+	       T3E = VSUB(VMUL(LDK(KP923879532), T3C), VMUL(LDK(KP382683432), T3D));
+	       T3F = VSUB(T1p, T1q);
+	       T3G = VSUB(T1s, T1t);
+	       T3H = VSUB(VMUL(LDK(KP382683432), T3F), VMUL(LDK(KP923879532), T3G));
+	       T3I = VADD(T3E, T3H);
+	       T3J = VADD(T3B, T3I);
+	       T3K = VSUB(T1y, T1z);
+	       T3L = VMUL(LDK(KP707106781), VSUB(T1F, T1G));
+	       T3M = VMUL(LDK(KP707106781), VSUB(T1I, T1J));
+	       T3N = VSUB(T3L, T3M);
+	       T3O = VADD(T3K, T3N);
+	       T3P = VSUB(T1B, T1C);
+	       T3Q = VADD(T3L, T3M);
+	       T3R = VADD(T3P, T3Q);
+	       T3S = VSUB(VMUL(LDK(KP980785280), T3O), VMUL(LDK(KP195090322), T3R));
+	       T3T = VSUB(T1N, T1O);
+	       T3U = VMUL(LDK(KP707106781), VSUB(T1U, T1V));
+	       T3V = VMUL(LDK(KP707106781), VSUB(T1X, T1Y));
+	       T3W = VSUB(T3U, T3V);
+	       T3X = VADD(T3T, T3W);
+	       T3Y = VSUB(T1Q, T1R);
+	       T3Z = VADD(T3U, T3V);
+	       T40 = VADD(T3Y, T3Z);
+	       T41 = VSUB(VMUL(LDK(KP831469612), T3X), VMUL(LDK(KP555570233), T40));
+	       T42 = VADD(T3S, T41);
+	       T43 = VADD(T3J, T42);
+	       T44 = VSUB(T16, T17);
+	       T45 = VADD(T3y, T3z);
+	       T46 = VADD(T44, T45);
+	       T47 = VADD(VMUL(LDK(KP923879532), T3D), VMUL(LDK(KP382683432), T3C));
+	       T48 = VADD(VMUL(LDK(KP382683432), T3G), VMUL(LDK(KP923879532), T3F));
+	       T49 = VADD(T47, T48);
+	       T4a = VADD(T46, T49);
+	       T4b = VADD(VMUL(LDK(KP980785280), T3R), VMUL(LDK(KP195090322), T3O));
+	       T4c = VADD(VMUL(LDK(KP831469612), T40), VMUL(LDK(KP555570233), T3X));
+	       T4d = VADD(T4b, T4c);
+	       T4e = VADD(T4a, T4d);
+	       STA(&(O[WS(os, 2)]), VSUB(VMUL(LDK(KP1_997590912), T43), VMUL(LDK(KP098135348), T4e)), ovs, &(O[0]));
+	       T4f = VSUB(T23, T26);
+	       T4g = VSUB(T3l, T3m);
+	       T4h = VSUB(T4f, T4g);
+	       T4i = VSUB(T2g, T2j);
+	       T4j = VADD(T2l, T2m);
+	       T4k = VSUB(VMUL(LDK(KP831469612), T4i), VMUL(LDK(KP555570233), T4j));
+	       T4l = VSUB(T2p, T2s);
+	       T4m = VADD(T2u, T2v);
+	       T4n = VADD(VMUL(LDK(KP195090322), T4l), VMUL(LDK(KP980785280), T4m));
+	       T4o = VSUB(T4k, T4n);
+	       T4p = VADD(T4h, T4o);
+	       T4q = VSUB(T2A, T2D);
+	       T4r = VSUB(T2Q, T2R);
+	       T4s = VSUB(T4q, T4r);
+	       T4t = VADD(T2N, T2O);
+	       T4u = VSUB(T2H, T2K);
+	       T4v = VADD(T4t, T4u);
+	       T4w = VSUB(VMUL(LDK(KP956940335), T4s), VMUL(LDK(KP290284677), T4v));
+	       T4x = VSUB(T2V, T2Y);
+	       T4y = VSUB(T3b, T3c);
+	       T4z = VSUB(T4x, T4y);
+	       T4A = VADD(T38, T39);
+	       T4B = VSUB(T32, T35);
+	       T4C = VADD(T4A, T4B);
+	       T4D = VSUB(VMUL(LDK(KP634393284), T4z), VMUL(LDK(KP773010453), T4C));
+	       T4E = VADD(T4w, T4D);
+	       T4F = VADD(T4p, T4E);
+	       T4G = VADD(T3i, T3j);
+	       T4H = VSUB(T2a, T2d);
+	       T4I = VADD(T4G, T4H);
+	       T4J = VADD(VMUL(LDK(KP831469612), T4j), VMUL(LDK(KP555570233), T4i));
+	       T4K = VSUB(VMUL(LDK(KP195090322), T4m), VMUL(LDK(KP980785280), T4l));
+	       T4L = VSUB(T4J, T4K);
+	       T4M = VADD(T4I, T4L);
+	       T4N = VADD(VMUL(LDK(KP956940335), T4v), VMUL(LDK(KP290284677), T4s));
+	       T4O = VADD(VMUL(LDK(KP634393284), T4C), VMUL(LDK(KP773010453), T4z));
+	       T4P = VADD(T4N, T4O);
+	       T4Q = VADD(T4M, T4P);
+	       STA(&(O[WS(os, 3)]), VSUB(VMUL(LDK(KP1_994580913), T4F), VMUL(LDK(KP147129127), T4Q)), ovs, &(O[0]));
+	       T4R = VSUB(T15, T18);
+	       T4S = VMUL(LDK(KP707106781), VSUB(T1k, T1n));
+	       T4T = VMUL(LDK(KP707106781), VSUB(T1r, T1u));
+	       T4U = VSUB(T4S, T4T);
+	       T4V = VADD(T4R, T4U);
+	       T4W = VSUB(T1A, T1D);
+	       T4X = VSUB(T1H, T1K);
+	       T4Y = VSUB(VMUL(LDK(KP923879532), T4W), VMUL(LDK(KP382683432), T4X));
+	       T4Z = VSUB(T1P, T1S);
+	       T50 = VSUB(T1W, T1Z);
+	       T51 = VSUB(VMUL(LDK(KP382683432), T4Z), VMUL(LDK(KP923879532), T50));
+	       T52 = VADD(T4Y, T51);
+	       T53 = VADD(T4V, T52);
+	       T54 = VSUB(T1c, T1f);
+	       T55 = VADD(T4S, T4T);
+	       T56 = VADD(T54, T55);
+	       T57 = VADD(VMUL(LDK(KP923879532), T4X), VMUL(LDK(KP382683432), T4W));
+	       T58 = VADD(VMUL(LDK(KP382683432), T50), VMUL(LDK(KP923879532), T4Z));
+	       T59 = VADD(T57, T58);
+	       T5a = VADD(T56, T59);
+	       STA(&(O[WS(os, 4)]), VSUB(VMUL(LDK(KP1_990369453), T53), VMUL(LDK(KP196034280), T5a)), ovs, &(O[0]));
+	       T5b = VADD(T4f, T4g);
+	       T5c = VADD(T4J, T4K);
+	       T5d = VADD(T5b, T5c);
+	       T5e = VADD(T4q, T4r);
+	       T5f = VSUB(T4t, T4u);
+	       T5g = VADD(VMUL(LDK(KP881921264), T5e), VMUL(LDK(KP471396736), T5f));
+	       T5h = VADD(T4x, T4y);
+	       T5i = VSUB(T4A, T4B);
+	       T5j = VADD(VMUL(LDK(KP098017140), T5h), VMUL(LDK(KP995184726), T5i));
+	       T5k = VADD(T5g, T5j);
+	       T5l = VADD(T5d, T5k);
+	       T5m = VSUB(T4G, T4H);
+	       T5n = VADD(T4k, T4n);
+	       T5o = VSUB(T5m, T5n);
+	       T5p = VSUB(VMUL(LDK(KP881921264), T5f), VMUL(LDK(KP471396736), T5e));
+	       T5q = VSUB(VMUL(LDK(KP098017140), T5i), VMUL(LDK(KP995184726), T5h));
+	       T5r = VADD(T5p, T5q);
+	       T5s = VADD(T5o, T5r);
+	       STA(&(O[WS(os, 5)]), VADD(VMUL(LDK(KP1_984959069), T5l), VMUL(LDK(KP244821350), T5s)), ovs, &(O[0]));
+	       T5t = VSUB(T3x, T3A);
+	       T5u = VSUB(T47, T48);
+	       T5v = VADD(T5t, T5u);
+	       T5w = VSUB(T3K, T3N);
+	       T5x = VSUB(T3P, T3Q);
+	       T5y = VADD(VMUL(LDK(KP831469612), T5w), VMUL(LDK(KP555570233), T5x));
+	       T5z = VSUB(T3T, T3W);
+	       T5A = VSUB(T3Y, T3Z);
+	       T5B = VSUB(VMUL(LDK(KP195090322), T5z), VMUL(LDK(KP980785280), T5A));
+	       T5C = VSUB(T5y, T5B);
+	       T5D = VADD(T5v, T5C);
+	       T5E = VSUB(T44, T45);
+	       T5F = VSUB(T3E, T3H);
+	       T5G = VSUB(T5E, T5F);
+	       T5H = VSUB(VMUL(LDK(KP831469612), T5x), VMUL(LDK(KP555570233), T5w));
+	       T5I = VADD(VMUL(LDK(KP195090322), T5A), VMUL(LDK(KP980785280), T5z));
+	       T5J = VSUB(T5H, T5I);
+	       T5K = VADD(T5G, T5J);
+	       STA(&(O[WS(os, 6)]), VADD(VMUL(LDK(KP1_978353019), T5D), VMUL(LDK(KP293460948), T5K)), ovs, &(O[0]));
+	       T5L = VSUB(T27, T2e);
+	       T5M = VSUB(T3p, T3q);
+	       T5N = VSUB(T5L, T5M);
+	       T5O = VSUB(T2E, T2L);
+	       T5P = VSUB(T2P, T2S);
+	       T5Q = VSUB(VMUL(LDK(KP773010453), T5O), VMUL(LDK(KP634393284), T5P));
+	       T5R = VSUB(T2Z, T36);
+	       T5S = VSUB(T3a, T3d);
+	       T5T = VADD(VMUL(LDK(KP471396736), T5R), VMUL(LDK(KP881921264), T5S));
+	       T5U = VSUB(T5Q, T5T);
+	       T5V = VADD(T5N, T5U);
+	       T5W = VSUB(T3k, T3n);
+	       T5X = VSUB(T2o, T2x);
+	       T5Y = VADD(T5W, T5X);
+	       T5Z = VADD(VMUL(LDK(KP773010453), T5P), VMUL(LDK(KP634393284), T5O));
+	       T60 = VSUB(VMUL(LDK(KP471396736), T5S), VMUL(LDK(KP881921264), T5R));
+	       T61 = VSUB(T5Z, T60);
+	       T62 = VADD(T5Y, T61);
+	       STA(&(O[WS(os, 7)]), VSUB(VMUL(LDK(KP1_970555284), T5V), VMUL(LDK(KP341923777), T62)), ovs, &(O[0]));
+	       T63 = VSUB(T19, T1g);
+	       T64 = VMUL(LDK(KP707106781), VSUB(T1E, T1L));
+	       T65 = VMUL(LDK(KP707106781), VSUB(T1T, T20));
+	       T66 = VSUB(T64, T65);
+	       T67 = VADD(T63, T66);
+	       T68 = VSUB(T1o, T1v);
+	       T69 = VADD(T64, T65);
+	       T6a = VADD(T68, T69);
+	       STA(&(O[WS(os, 8)]), VSUB(VMUL(LDK(KP1_961570560), T67), VMUL(LDK(KP390180644), T6a)), ovs, &(O[0]));
+	       T6b = VADD(T5L, T5M);
+	       T6c = VADD(T5Z, T60);
+	       T6d = VADD(T6b, T6c);
+	       T6e = VSUB(T5W, T5X);
+	       T6f = VADD(T5Q, T5T);
+	       T6g = VSUB(T6e, T6f);
+	       STA(&(O[WS(os, 9)]), VADD(VMUL(LDK(KP1_951404260), T6d), VMUL(LDK(KP438202480), T6g)), ovs, &(O[0]));
+	       T6h = VSUB(T5t, T5u);
+	       T6i = VADD(T5H, T5I);
+	       T6j = VSUB(T6h, T6i);
+	       T6k = VADD(T5E, T5F);
+	       T6l = VADD(T5y, T5B);
+	       T6m = VADD(T6k, T6l);
+	       STA(&(O[WS(os, 10)]), VSUB(VMUL(LDK(KP1_940062506), T6j), VMUL(LDK(KP485960359), T6m)), ovs, &(O[0]));
+	       T6n = VSUB(T5b, T5c);
+	       T6o = VSUB(T5p, T5q);
+	       T6p = VSUB(T6n, T6o);
+	       T6q = VADD(T5m, T5n);
+	       T6r = VSUB(T5g, T5j);
+	       T6s = VADD(T6q, T6r);
+	       STA(&(O[WS(os, 11)]), VSUB(VMUL(LDK(KP1_927552131), T6p), VMUL(LDK(KP533425514), T6s)), ovs, &(O[0]));
+	       T6t = VSUB(T4R, T4U);
+	       T6u = VSUB(T57, T58);
+	       T6v = VADD(T6t, T6u);
+	       T6w = VSUB(T54, T55);
+	       T6x = VSUB(T4Y, T51);
+	       T6y = VSUB(T6w, T6x);
+	       STA(&(O[WS(os, 12)]), VADD(VMUL(LDK(KP1_913880671), T6v), VMUL(LDK(KP580569354), T6y)), ovs, &(O[0]));
+	       T6z = VSUB(T4h, T4o);
+	       T6A = VSUB(T4N, T4O);
+	       T6B = VADD(T6z, T6A);
+	       T6C = VSUB(T4I, T4L);
+	       T6D = VSUB(T4w, T4D);
+	       T6E = VSUB(T6C, T6D);
+	       STA(&(O[WS(os, 13)]), VADD(VMUL(LDK(KP1_899056361), T6B), VMUL(LDK(KP627363480), T6E)), ovs, &(O[0]));
+	       T6F = VSUB(T3B, T3I);
+	       T6G = VSUB(T4b, T4c);
+	       T6H = VADD(T6F, T6G);
+	       T6I = VSUB(T46, T49);
+	       T6J = VSUB(T3S, T41);
+	       T6K = VSUB(T6I, T6J);
+	       STA(&(O[WS(os, 14)]), VADD(VMUL(LDK(KP1_883088130), T6H), VMUL(LDK(KP673779706), T6K)), ovs, &(O[0]));
+	       T6L = VSUB(T2f, T2y);
+	       T6M = VSUB(T3t, T3u);
+	       T6N = VSUB(T6L, T6M);
+	       T6O = VSUB(T3o, T3r);
+	       T6P = VSUB(T2U, T3f);
+	       T6Q = VADD(T6O, T6P);
+	       STA(&(O[WS(os, 15)]), VSUB(VMUL(LDK(KP1_865985597), T6N), VMUL(LDK(KP719790073), T6Q)), ovs, &(O[0]));
+	       T6R = VSUB(T1h, T1w);
+	       T6S = VSUB(T1M, T21);
+	       STA(&(O[WS(os, 16)]), VSUB(VMUL(LDK(KP1_847759065), T6R), VMUL(LDK(KP765366864), T6S)), ovs, &(O[0]));
+	       T6T = VADD(T6L, T6M);
+	       T6U = VSUB(T6O, T6P);
+	       STA(&(O[WS(os, 17)]), VADD(VMUL(LDK(KP1_828419511), T6T), VMUL(LDK(KP810482628), T6U)), ovs, &(O[0]));
+	       T6V = VSUB(T6F, T6G);
+	       T6W = VADD(T6I, T6J);
+	       STA(&(O[WS(os, 18)]), VSUB(VMUL(LDK(KP1_807978586), T6V), VMUL(LDK(KP855110186), T6W)), ovs, &(O[0]));
+	       T6X = VSUB(T6z, T6A);
+	       T6Y = VADD(T6C, T6D);
+	       STA(&(O[WS(os, 19)]), VSUB(VMUL(LDK(KP1_786448602), T6X), VMUL(LDK(KP899222659), T6Y)), ovs, &(O[0]));
+	       T6Z = VSUB(T6t, T6u);
+	       T70 = VADD(T6w, T6x);
+	       STA(&(O[WS(os, 20)]), VSUB(VMUL(LDK(KP1_763842528), T6Z), VMUL(LDK(KP942793473), T70)), ovs, &(O[0]));
+	       T71 = VADD(T6n, T6o);
+	       T72 = VSUB(T6q, T6r);
+	       STA(&(O[WS(os, 21)]), VADD(VMUL(LDK(KP1_740173982), T71), VMUL(LDK(KP985796384), T72)), ovs, &(O[0]));
+	       T73 = VADD(T6h, T6i);
+	       T74 = VSUB(T6k, T6l);
+	       STA(&(O[WS(os, 22)]), VADD(VMUL(LDK(KP1_715457220), T73), VMUL(LDK(KP1_028205488), T74)), ovs, &(O[0]));
+	       T75 = VSUB(T6b, T6c);
+	       T76 = VADD(T6e, T6f);
+	       STA(&(O[WS(os, 23)]), VSUB(VMUL(LDK(KP1_689707130), T75), VMUL(LDK(KP1_069995239), T76)), ovs, &(O[0]));
+	       T77 = VSUB(T63, T66);
+	       T78 = VSUB(T68, T69);
+	       STA(&(O[WS(os, 24)]), VADD(VMUL(LDK(KP1_662939224), T77), VMUL(LDK(KP1_111140466), T78)), ovs, &(O[0]));
+	       T79 = VSUB(T5N, T5U);
+	       T7a = VSUB(T5Y, T61);
+	       STA(&(O[WS(os, 25)]), VADD(VMUL(LDK(KP1_635169626), T79), VMUL(LDK(KP1_151616382), T7a)), ovs, &(O[0]));
+	       T7b = VSUB(T5v, T5C);
+	       T7c = VSUB(T5G, T5J);
+	       STA(&(O[WS(os, 26)]), VSUB(VMUL(LDK(KP1_606415062), T7b), VMUL(LDK(KP1_191398608), T7c)), ovs, &(O[0]));
+	       T7d = VSUB(T5d, T5k);
+	       T7e = VSUB(T5o, T5r);
+	       STA(&(O[WS(os, 27)]), VSUB(VMUL(LDK(KP1_576692855), T7d), VMUL(LDK(KP1_230463181), T7e)), ovs, &(O[0]));
+	       T7f = VSUB(T4V, T52);
+	       T7g = VSUB(T56, T59);
+	       STA(&(O[WS(os, 28)]), VADD(VMUL(LDK(KP1_546020906), T7f), VMUL(LDK(KP1_268786568), T7g)), ovs, &(O[0]));
+	       T7h = VSUB(T4p, T4E);
+	       T7i = VSUB(T4M, T4P);
+	       STA(&(O[WS(os, 29)]), VADD(VMUL(LDK(KP1_514417693), T7h), VMUL(LDK(KP1_306345685), T7i)), ovs, &(O[0]));
+	       T7j = VSUB(T3J, T42);
+	       T7k = VSUB(T4a, T4d);
+	       STA(&(O[WS(os, 30)]), VADD(VMUL(LDK(KP1_481902250), T7j), VMUL(LDK(KP1_343117909), T7k)), ovs, &(O[0]));
+	       T7l = VSUB(T2z, T3g);
+	       T7m = VSUB(T3s, T3v);
+	       STA(&(O[WS(os, 31)]), VSUB(VMUL(LDK(KP1_448494165), T7l), VMUL(LDK(KP1_379081089), T7m)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 32)]), VMUL(LDK(KP1_414213562), VSUB(T1x, T22)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 33)]), VADD(VMUL(LDK(KP1_448494165), T7m), VMUL(LDK(KP1_379081089), T7l)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 34)]), VSUB(VMUL(LDK(KP1_343117909), T7j), VMUL(LDK(KP1_481902250), T7k)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 35)]), VSUB(VMUL(LDK(KP1_306345685), T7h), VMUL(LDK(KP1_514417693), T7i)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 36)]), VSUB(VMUL(LDK(KP1_268786568), T7f), VMUL(LDK(KP1_546020906), T7g)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 37)]), VADD(VMUL(LDK(KP1_576692855), T7e), VMUL(LDK(KP1_230463181), T7d)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 38)]), VADD(VMUL(LDK(KP1_606415062), T7c), VMUL(LDK(KP1_191398608), T7b)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 39)]), VSUB(VMUL(LDK(KP1_151616382), T79), VMUL(LDK(KP1_635169626), T7a)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 40)]), VSUB(VMUL(LDK(KP1_111140466), T77), VMUL(LDK(KP1_662939224), T78)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 41)]), VADD(VMUL(LDK(KP1_689707130), T76), VMUL(LDK(KP1_069995239), T75)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 42)]), VSUB(VMUL(LDK(KP1_028205488), T73), VMUL(LDK(KP1_715457220), T74)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 43)]), VSUB(VMUL(LDK(KP985796384), T71), VMUL(LDK(KP1_740173982), T72)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 44)]), VADD(VMUL(LDK(KP1_763842528), T70), VMUL(LDK(KP942793473), T6Z)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 45)]), VADD(VMUL(LDK(KP1_786448602), T6Y), VMUL(LDK(KP899222659), T6X)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 46)]), VADD(VMUL(LDK(KP1_807978586), T6W), VMUL(LDK(KP855110186), T6V)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 47)]), VSUB(VMUL(LDK(KP810482628), T6T), VMUL(LDK(KP1_828419511), T6U)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 48)]), VADD(VMUL(LDK(KP1_847759065), T6S), VMUL(LDK(KP765366864), T6R)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 49)]), VADD(VMUL(LDK(KP1_865985597), T6Q), VMUL(LDK(KP719790073), T6N)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 50)]), VSUB(VMUL(LDK(KP673779706), T6H), VMUL(LDK(KP1_883088130), T6K)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 51)]), VSUB(VMUL(LDK(KP627363480), T6B), VMUL(LDK(KP1_899056361), T6E)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 52)]), VSUB(VMUL(LDK(KP580569354), T6v), VMUL(LDK(KP1_913880671), T6y)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 53)]), VADD(VMUL(LDK(KP1_927552131), T6s), VMUL(LDK(KP533425514), T6p)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 54)]), VADD(VMUL(LDK(KP1_940062506), T6m), VMUL(LDK(KP485960359), T6j)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 55)]), VSUB(VMUL(LDK(KP438202480), T6d), VMUL(LDK(KP1_951404260), T6g)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 56)]), VADD(VMUL(LDK(KP1_961570560), T6a), VMUL(LDK(KP390180644), T67)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 57)]), VADD(VMUL(LDK(KP1_970555284), T62), VMUL(LDK(KP341923777), T5V)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 58)]), VSUB(VMUL(LDK(KP293460948), T5D), VMUL(LDK(KP1_978353019), T5K)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 59)]), VSUB(VMUL(LDK(KP244821350), T5l), VMUL(LDK(KP1_984959069), T5s)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 60)]), VADD(VMUL(LDK(KP1_990369453), T5a), VMUL(LDK(KP196034280), T53)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 61)]), VADD(VMUL(LDK(KP1_994580913), T4Q), VMUL(LDK(KP147129127), T4F)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 62)]), VADD(VMUL(LDK(KP1_997590912), T4e), VMUL(LDK(KP098135348), T43)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 63)]), VSUB(VMUL(LDK(KP049082457), T3h), VMUL(LDK(KP1_999397637), T3w)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 64, XSIMD_STRING("e10v_64"), {456, 250, 0, 0}, &GENUS, REDFT10 };
+
+void XSIMD(codelet_e10v_64) (planner *p) {
+     X(kr2r_register) (p, e10v_64, &desc);
+}
+
+#endif
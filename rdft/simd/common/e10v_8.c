@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:08:10 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e10v_8 -include rdft/simd/r2rv.h from: ../../../genfft/gen_r2r.native -fma -compact -variables 4 -pipeline-latency 4 -redft10 -n 8 -name e10_8 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 26 FP additions, 18 FP multiplications,
+ * (or, 16 additions, 8 multiplications, 10 fused multiply/add),
+ * 28 stack variables, 9 constants, and 16 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e10v_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP414213562, +0.414213562373095048801688724209698078569671875);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP198912367, +0.198912367379658006911597622644676228597850501);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP668178637, +0.668178637919298919997757686523080761552472251);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(16, is), MAKE_VOLATILE_STRIDE(16, os)) {
+	       V T3, Tj, Te, Tk, Ta, Tn, Tf, Tm;
+	       {
+		    V T1, T2, Tc, Td;
+		    T1 = LDA(&(I[0]), ivs, &(I[0]));
+		    T2 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+		    T3 = VSUB(T1, T2);
+		    Tj = VADD(T1, T2);
+		    Tc = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+		    Td = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+		    Te = VSUB(Tc, Td);
+		    Tk = VADD(Tc, Td);
+		    {
+			 V T4, T5, T6, T7, T8, T9;
+			 T4 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+			 T5 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+			 T6 = VSUB(T4, T5);
+			 T7 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+			 T8 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+			 T9 = VSUB(T7, T8);
+			 Ta = VADD(T6, T9);
+			 Tn = VADD(T7, T8);
+			 Tf = VSUB(T6, T9);
+			 Tm = VADD(T4, T5);
+		    }
+	       }
+	       {
+		    V Tb, Tg, Tp, Tq;
+		    Tb = VFNMS(LDK(KP707106781), Ta, T3);
+		    Tg = VFNMS(LDK(KP707106781), Tf, Te);
+		    STA(&(O[WS(os, 3)]), VMUL(LDK(KP1_662939224), VFMA(LDK(KP668178637), Tg, Tb)), ovs, &(O[0]));
+		    STA(&(O[WS(os, 5)]), VMUL(LDK(KP1_662939224), VFMS(LDK(KP668178637), Tb, Tg)), ovs, &(O[0]));
+		    Tp = VADD(Tj, Tk);
+		    Tq = VADD(Tm, Tn);
+		    STA(&(O[WS(os, 4)]), VMUL(LDK(KP1_414213562), VSUB(Tp, Tq)), ovs, &(O[0]));
+		    STA(&(O[0]), VMUL(LDK(KP2_000000000), VADD(Tp, Tq)), ovs, &(O[0]));
+	       }
+	       {
+		    V Th, Ti, Tl, To;
+		    Th = VFMA(LDK(KP707106781), Ta, T3);
+		    Ti = VFMA(LDK(KP707106781), Tf, Te);
+		    STA(&(O[WS(os, 1)]), VMUL(LDK(KP1_961570560), VFNMS(LDK(KP198912367), Ti, Th)), ovs, &(O[0]));
+		    STA(&(O[WS(os, 7)]), VMUL(LDK(KP1_961570560), VFMA(LDK(KP198912367), Th, Ti)), ovs, &(O[0]));
+		    Tl = VSUB(Tj, Tk);
+		    To = VSUB(Tm, Tn);
+		    STA(&(O[WS(os, 2)]), VMUL(LDK(KP1_847759065), VFNMS(LDK(KP414213562), To, Tl)), ovs, &(O[0]));
+		    STA(&(O[WS(os, 6)]), VMUL(LDK(KP1_847759065), VFMA(LDK(KP414213562), Tl, To)), ovs, &(O[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 8, XSIMD_STRING("e10v_8"), {16, 8, 10, 0}, &GENUS, REDFT10 };
+
+void XSIMD(codelet_e10v_8) (planner *p) {
+     X(kr2r_register) (p, e10v_8, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e10v_8 -include rdft/simd/r2rv.h from: ../../../genfft/gen_r2r.native -compact -variables 4 -pipeline-latency 4 -redft10 -n 8 -name e10_8 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 26 FP additions, 16 FP multiplications,
+ * (or, 20 additions, 10 multiplications, 6 fused multiply/add),
+ * 28 stack variables, 9 constants, and 16 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e10v_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(16, is), MAKE_VOLATILE_STRIDE(16, os)) {
+	       V T3, Tj, Tf, Tk, Ta, Tn, Tc, Tm;
+	       {
+		    V T1, T2, Td, Te;
+		    T1 = LDA(&(I[0]), ivs, &(I[0]));
+		    T2 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+		    T3 = VSUB(T1, T2);
+		    Tj = VADD(T1, T2);
+		    Td = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+		    Te = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+		    Tf = VSUB(Td, Te);
+		    Tk = VADD(Td, Te);
+		    {
+			 V T4, T5, T6, T7, T8, T9;
+			 T4 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+			 T5 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+			 T6 = VSUB(T4, T5);
+			 T7 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+			 T8 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+			 T9 = VSUB(T7, T8);
+			 Ta = VMUL(LDK(KP707106781), VADD(T6, T9));
+			 Tn = VADD(T7, T8);
+			 Tc = VMUL(LDK(KP707106781), VSUB(T6, T9));
+			 Tm = VADD(T4, T5);
+		    }
+	       }
+	       {
+		    V Tb, Tg, Tp, Tq;
+		    Tb = VSUB(T3, Ta);
+		    Tg = VSUB(Tc, Tf);
+		    STA(&(O[WS(os, 3)]), VFNMS(LDK(KP1_111140466), Tg, VMUL(LDK(KP1_662939224), Tb)), ovs, &(O[0]));
+		    STA(&(O[WS(os, 5)]), VFMA(LDK(KP1_662939224), Tg, VMUL(LDK(KP1_111140466), Tb)), ovs, &(O[0]));
+		    Tp = VADD(Tj, Tk);
+		    Tq = VADD(Tm, Tn);
+		    STA(&(O[WS(os, 4)]), VMUL(LDK(KP1_414213562), VSUB(Tp, Tq)), ovs, &(O[0]));
+		    STA(&(O[0]), VMUL(LDK(KP2_000000000), VADD(Tp, Tq)), ovs, &(O[0]));
+	       }
+	       {
+		    V Th, Ti, Tl, To;
+		    Th = VADD(T3, Ta);
+		    Ti = VADD(Tf, Tc);
+		    STA(&(O[WS(os, 1)]), VFNMS(LDK(KP390180644), Ti, VMUL(LDK(KP1_961570560), Th)), ovs, &(O[0]));
+		    STA(&(O[WS(os, 7)]), VFMA(LDK(KP1_961570560), Ti, VMUL(LDK(KP390180644), Th)), ovs, &(O[0]));
+		    Tl = VSUB(Tj, Tk);
+		    To = VSUB(Tm, Tn);
+		    STA(&(O[WS(os, 2)]), VFNMS(LDK(KP765366864), To, VMUL(LDK(KP1_847759065), Tl)), ovs, &(O[0]));
+		    STA(&(O[WS(os, 6)]), VFMA(LDK(KP765366864), Tl, VMUL(LDK(KP1_847759065), To)), ovs, &(O[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 8, XSIMD_STRING("e10v_8"), {20, 10, 6, 0}, &GENUS, REDFT10 };
+
+void XSIMD(codelet_e10v_8) (planner *p) {
+     X(kr2r_register) (p, e10v_8, &desc);
+}
+
+#endif
@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e11v_16 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft11 -n 16 -name e11_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 86 FP additions, 66 FP multiplications,
+ * (or, 50 additions, 30 multiplications, 36 fused multiply/add),
+ * 78 stack variables, 23 constants, and 32 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e11v_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = VFMA(LDK(KP707106781), VSUB(T8, T9), Tg);
+	       Ti = VFMS(LDK(KP923879532), Tc, VMUL(LDK(KP382683432), T5));
+	       Tj = VFMS(LDK(KP382683432), T4, VMUL(LDK(KP923879532), Td));
+	       Tk = VADD(Ti, Tj);
+	       Tl = VADD(Th, Tk);
+	       Tm = VFMS(LDK(KP980785280), Te, VMUL(LDK(KP195090322), T3));
+	       Tn = VFMS(LDK(KP555570233), T6, VMUL(LDK(KP831469612), Tb));
+	       To = VADD(Tm, Tn);
+	       Tp = VFMS(LDK(KP831469612), Ta, VMUL(LDK(KP555570233), T7));
+	       Tq = VFMS(LDK(KP195090322), T2, VMUL(LDK(KP980785280), Tf));
+	       Tr = VADD(Tp, Tq);
+	       Ts = VADD(To, Tr);
+	       Tt = VADD(Tl, Ts);
+	       Tu = VFMA(LDK(KP707106781), VADD(T8, T9), T1);
+	       Tv = VFMA(LDK(KP923879532), T5, VMUL(LDK(KP382683432), Tc));
+	       Tw = VFMA(LDK(KP382683432), Td, VMUL(LDK(KP923879532), T4));
+	       Tx = VADD(Tv, Tw);
+	       Ty = VADD(Tu, Tx);
+	       Tz = VFMA(LDK(KP980785280), T3, VMUL(LDK(KP195090322), Te));
+	       TA = VFMA(LDK(KP555570233), Tb, VMUL(LDK(KP831469612), T6));
+	       TB = VADD(Tz, TA);
+	       TC = VFMA(LDK(KP831469612), T7, VMUL(LDK(KP555570233), Ta));
+	       TD = VFMA(LDK(KP195090322), Tf, VMUL(LDK(KP980785280), T2));
+	       TE = VADD(TC, TD);
+	       TF = VADD(TB, TE);
+	       TG = VADD(Ty, TF);
+	       STA(&(O[0]), VFMA(LDK(KP1_997590912), TG, VMUL(LDK(KP098135348), Tt)), ovs, &(O[0]));
+	       TH = VFNMS(LDK(KP707106781), VSUB(T8, T9), Tg);
+	       TI = VSUB(Tv, Tw);
+	       TJ = VADD(TH, TI);
+	       TK = VSUB(TC, TD);
+	       TL = VSUB(Tp, Tq);
+	       TM = VMUL(LDK(KP707106781), VSUB(TK, TL));
+	       TN = VSUB(Tz, TA);
+	       TO = VSUB(Tm, Tn);
+	       TP = VFMA(LDK(KP707106781), VADD(TN, TO), TM);
+	       TQ = VADD(TJ, TP);
+	       TR = VFNMS(LDK(KP707106781), VADD(T8, T9), T1);
+	       TS = VSUB(Ti, Tj);
+	       TT = VSUB(TR, TS);
+	       TU = VMUL(LDK(KP707106781), VADD(TK, TL));
+	       TV = VFMS(LDK(KP707106781), VSUB(TN, TO), TU);
+	       TW = VADD(TT, TV);
+	       STA(&(O[WS(os, 1)]), VFMS(LDK(KP1_978353019), TW, VMUL(LDK(KP293460948), TQ)), ovs, &(O[0]));
+	       TX = VSUB(TH, TI);
+	       TY = VFMA(LDK(KP707106781), VSUB(TN, TO), TU);
+	       TZ = VSUB(TX, TY);
+	       T10 = VADD(TR, TS);
+	       T11 = VFMS(LDK(KP707106781), VADD(TN, TO), TM);
+	       T12 = VADD(T10, T11);
+	       STA(&(O[WS(os, 2)]), VFMA(LDK(KP1_940062506), T12, VMUL(LDK(KP485960359), TZ)), ovs, &(O[0]));
+	       T13 = VSUB(Th, Tk);
+	       T14 = VSUB(TB, TE);
+	       T15 = VADD(T13, T14);
+	       T16 = VSUB(Tu, Tx);
+	       T17 = VSUB(To, Tr);
+	       T18 = VSUB(T16, T17);
+	       STA(&(O[WS(os, 3)]), VFMS(LDK(KP1_883088130), T18, VMUL(LDK(KP673779706), T15)), ovs, &(O[0]));
+	       T19 = VSUB(T13, T14);
+	       T1a = VADD(T16, T17);
+	       STA(&(O[WS(os, 4)]), VFMA(LDK(KP1_807978586), T1a, VMUL(LDK(KP855110186), T19)), ovs, &(O[0]));
+	       T1b = VADD(TX, TY);
+	       T1c = VSUB(T10, T11);
+	       STA(&(O[WS(os, 5)]), VFMS(LDK(KP1_715457220), T1c, VMUL(LDK(KP1_028205488), T1b)), ovs, &(O[0]));
+	       T1d = VSUB(TJ, TP);
+	       T1e = VSUB(TT, TV);
+	       STA(&(O[WS(os, 6)]), VFMA(LDK(KP1_606415062), T1e, VMUL(LDK(KP1_191398608), T1d)), ovs, &(O[0]));
+	       T1f = VSUB(Tl, Ts);
+	       T1g = VSUB(Ty, TF);
+	       STA(&(O[WS(os, 7)]), VFMS(LDK(KP1_481902250), T1g, VMUL(LDK(KP1_343117909), T1f)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 8)]), VFMA(LDK(KP1_343117909), T1g, VMUL(LDK(KP1_481902250), T1f)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 9)]), VFMS(LDK(KP1_191398608), T1e, VMUL(LDK(KP1_606415062), T1d)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 10)]), VFMA(LDK(KP1_028205488), T1c, VMUL(LDK(KP1_715457220), T1b)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 11)]), VFMS(LDK(KP855110186), T1a, VMUL(LDK(KP1_807978586), T19)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 12)]), VFMA(LDK(KP673779706), T18, VMUL(LDK(KP1_883088130), T15)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 13)]), VFMS(LDK(KP485960359), T12, VMUL(LDK(KP1_940062506), TZ)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 14)]), VFMA(LDK(KP293460948), TW, VMUL(LDK(KP1_978353019), TQ)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 15)]), VFMS(LDK(KP098135348), TG, VMUL(LDK(KP1_997590912), Tt)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 16, XSIMD_STRING("e11v_16"), {50, 30, 36, 0}, &GENUS, REDFT11 };
+
+void XSIMD(codelet_e11v_16) (planner *p) {
+     X(kr2r_register) (p, e11v_16, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e11v_16 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft11 -n 16 -name e11_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 82 FP additions, 62 FP multiplications,
+ * (or, 82 additions, 62 multiplications, 0 fused multiply/add),
+ * 82 stack variables, 23 constants, and 32 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e11v_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = VMUL(LDK(KP707106781), VADD(T8, T9));
+	       Ti = VADD(T1, Th);
+	       Tj = VADD(VMUL(LDK(KP923879532), T5), VMUL(LDK(KP382683432), Tc));
+	       Tk = VADD(VMUL(LDK(KP382683432), Td), VMUL(LDK(KP923879532), T4));
+	       Tl = VADD(Tj, Tk);
+	       Tm = VADD(Ti, Tl);
+	       Tn = VADD(VMUL(LDK(KP980785280), T3), VMUL(LDK(KP195090322), Te));
+	       To = VADD(VMUL(LDK(KP555570233), Tb), VMUL(LDK(KP831469612), T6));
+	       Tp = VADD(Tn, To);
+	       Tq = VADD(VMUL(LDK(KP831469612), T7), VMUL(LDK(KP555570233), Ta));
+	       Tr = VADD(VMUL(LDK(KP195090322), Tf), VMUL(LDK(KP980785280), T2));
+	       Ts = VADD(Tq, Tr);
+	       Tt = VADD(Tp, Ts);
+	       Tu = VADD(Tm, Tt);
+	       Tv = VMUL(LDK(KP707106781), VSUB(T8, T9));
+	       Tw = VADD(Tg, Tv);
+	       Tx = VSUB(VMUL(LDK(KP923879532), Tc), VMUL(LDK(KP382683432), T5));
+	       Ty = VSUB(VMUL(LDK(KP382683432), T4), VMUL(LDK(KP923879532), Td));
+	       Tz = VADD(Tx, Ty);
+	       TA = VADD(Tw, Tz);
+	       TB = VSUB(VMUL(LDK(KP980785280), Te), VMUL(LDK(KP195090322), T3));
+	       TC = VSUB(VMUL(LDK(KP555570233), T6), VMUL(LDK(KP831469612), Tb));
+	       TD = VADD(TB, TC);
+	       TE = VSUB(VMUL(LDK(KP831469612), Ta), VMUL(LDK(KP555570233), T7));
+	       TF = VSUB(VMUL(LDK(KP195090322), T2), VMUL(LDK(KP980785280), Tf));
+	       TG = VADD(TE, TF);
+	       TH = VADD(TD, TG);
+	       TI = VADD(TA, TH);
+	       STA(&(O[0]), VADD(VMUL(LDK(KP1_997590912), Tu), VMUL(LDK(KP098135348), TI)), ovs, &(O[0]));
+	       TJ = VSUB(T1, Th);
+	       TK = VSUB(Tx, Ty);
+	       TL = VSUB(TJ, TK);
+	       TM = VSUB(Tn, To);
+	       TN = VSUB(TB, TC);
+	       TO = VMUL(LDK(KP707106781), VSUB(TM, TN));
+	       TP = VSUB(Tq, Tr);
+	       TQ = VSUB(TE, TF);
+	       TR = VMUL(LDK(KP707106781), VADD(TP, TQ));
+	       TS = VSUB(TO, TR);
+	       TT = VADD(TL, TS);
+	       TU = VSUB(Tg, Tv);
+	       TV = VSUB(Tj, Tk);
+	       TW = VADD(TU, TV);
+	       TX = VMUL(LDK(KP707106781), VADD(TM, TN));
+	       TY = VMUL(LDK(KP707106781), VSUB(TP, TQ));
+	       TZ = VADD(TX, TY);
+	       T10 = VADD(TW, TZ);
+	       STA(&(O[WS(os, 1)]), VSUB(VMUL(LDK(KP1_978353019), TT), VMUL(LDK(KP293460948), T10)), ovs, &(O[0]));
+	       T11 = VADD(TJ, TK);
+	       T12 = VSUB(TX, TY);
+	       T13 = VADD(T11, T12);
+	       T14 = VSUB(TU, TV);
+	       T15 = VADD(TO, TR);
+	       T16 = VSUB(T14, T15);
+	       STA(&(O[WS(os, 2)]), VADD(VMUL(LDK(KP1_940062506), T13), VMUL(LDK(KP485960359), T16)), ovs, &(O[0]));
+	       T17 = VSUB(Ti, Tl);
+	       T18 = VSUB(TD, TG);
+	       T19 = VSUB(T17, T18);
+	       T1a = VSUB(Tw, Tz);
+	       T1b = VSUB(Tp, Ts);
+	       T1c = VADD(T1a, T1b);
+	       STA(&(O[WS(os, 3)]), VSUB(VMUL(LDK(KP1_883088130), T19), VMUL(LDK(KP673779706), T1c)), ovs, &(O[0]));
+	       T1d = VADD(T17, T18);
+	       T1e = VSUB(T1a, T1b);
+	       STA(&(O[WS(os, 4)]), VADD(VMUL(LDK(KP1_807978586), T1d), VMUL(LDK(KP855110186), T1e)), ovs, &(O[0]));
+	       T1f = VSUB(T11, T12);
+	       T1g = VADD(T14, T15);
+	       STA(&(O[WS(os, 5)]), VSUB(VMUL(LDK(KP1_715457220), T1f), VMUL(LDK(KP1_028205488), T1g)), ovs, &(O[0]));
+	       T1h = VSUB(TL, TS);
+	       T1i = VSUB(TW, TZ);
+	       STA(&(O[WS(os, 6)]), VADD(VMUL(LDK(KP1_606415062), T1h), VMUL(LDK(KP1_191398608), T1i)), ovs, &(O[0]));
+	       T1j = VSUB(Tm, Tt);
+	       T1k = VSUB(TA, TH);
+	       STA(&(O[WS(os, 7)]), VSUB(VMUL(LDK(KP1_481902250), T1j), VMUL(LDK(KP1_343117909), T1k)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 8)]), VADD(VMUL(LDK(KP1_343117909), T1j), VMUL(LDK(KP1_481902250), T1k)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 9)]), VSUB(VMUL(LDK(KP1_191398608), T1h), VMUL(LDK(KP1_606415062), T1i)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 10)]), VADD(VMUL(LDK(KP1_028205488), T1f), VMUL(LDK(KP1_715457220), T1g)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 11)]), VSUB(VMUL(LDK(KP855110186), T1d), VMUL(LDK(KP1_807978586), T1e)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 12)]), VADD(VMUL(LDK(KP673779706), T19), VMUL(LDK(KP1_883088130), T1c)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 13)]), VSUB(VMUL(LDK(KP485960359), T13), VMUL(LDK(KP1_940062506), T16)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 14)]), VADD(VMUL(LDK(KP293460948), TT), VMUL(LDK(KP1_978353019), T10)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 15)]), VSUB(VMUL(LDK(KP098135348), Tu), VMUL(LDK(KP1_997590912), TI)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 16, XSIMD_STRING("e11v_16"), {82, 62, 0, 0}, &GENUS, REDFT11 };
+
+void XSIMD(codelet_e11v_16) (planner *p) {
+     X(kr2r_register) (p, e11v_16, &desc);
+}
+
+#endif
@@ -0,0 +1,682 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e11v_32 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -redft11 -n 32 -name e11_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 212 FP additions, 152 FP multiplications,
+ * (or, 132 additions, 72 multiplications, 80 fused multiply/add),
+ * 200 stack variables, 47 constants, and 64 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e11v_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DVK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DVK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DVK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DVK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DVK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DVK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DVK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DVK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DVK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DVK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DVK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DVK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DVK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DVK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DVK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DVK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DVK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DVK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DVK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DVK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DVK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DVK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DVK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DVK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DVK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DVK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DVK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DVK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DVK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DVK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DVK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DVK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DVK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DVK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DVK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DVK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DVK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DVK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       V T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       V T37, T38, T39, T3a, T3b, T3c, T3d, T3e;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = VFMA(LDK(KP707106781), VSUB(Tg, Th), Tw);
+	       Ty = VFMS(LDK(KP923879532), To, VMUL(LDK(KP382683432), T9));
+	       Tz = VFMS(LDK(KP382683432), T8, VMUL(LDK(KP923879532), Tp));
+	       TA = VADD(Ty, Tz);
+	       TB = VADD(Tx, TA);
+	       TC = VFMS(LDK(KP980785280), Ts, VMUL(LDK(KP195090322), T5));
+	       TD = VFMS(LDK(KP555570233), Tc, VMUL(LDK(KP831469612), Tl));
+	       TE = VADD(TC, TD);
+	       TF = VFMS(LDK(KP831469612), Tk, VMUL(LDK(KP555570233), Td));
+	       TG = VFMS(LDK(KP195090322), T4, VMUL(LDK(KP980785280), Tt));
+	       TH = VADD(TF, TG);
+	       TI = VADD(TE, TH);
+	       TJ = VADD(TB, TI);
+	       TK = VFMS(LDK(KP995184726), Tu, VMUL(LDK(KP098017140), T3));
+	       TL = VFMS(LDK(KP634393284), Te, VMUL(LDK(KP773010453), Tj));
+	       TM = VADD(TK, TL);
+	       TN = VFMS(LDK(KP881921264), Tm, VMUL(LDK(KP471396736), Tb));
+	       TO = VFMS(LDK(KP290284677), T6, VMUL(LDK(KP956940335), Tr));
+	       TP = VADD(TN, TO);
+	       TQ = VADD(TM, TP);
+	       TR = VFMS(LDK(KP956940335), Tq, VMUL(LDK(KP290284677), T7));
+	       TS = VFMS(LDK(KP471396736), Ta, VMUL(LDK(KP881921264), Tn));
+	       TT = VADD(TR, TS);
+	       TU = VFMS(LDK(KP773010453), Ti, VMUL(LDK(KP634393284), Tf));
+	       TV = VFMS(LDK(KP098017140), T2, VMUL(LDK(KP995184726), Tv));
+	       TW = VADD(TU, TV);
+	       TX = VADD(TT, TW);
+	       TY = VADD(TQ, TX);
+	       TZ = VADD(TJ, TY);
+	       T10 = VFMA(LDK(KP707106781), VADD(Tg, Th), T1);
+	       T11 = VFMA(LDK(KP923879532), T9, VMUL(LDK(KP382683432), To));
+	       T12 = VFMA(LDK(KP382683432), Tp, VMUL(LDK(KP923879532), T8));
+	       T13 = VADD(T11, T12);
+	       T14 = VADD(T10, T13);
+	       T15 = VFMA(LDK(KP980785280), T5, VMUL(LDK(KP195090322), Ts));
+	       T16 = VFMA(LDK(KP555570233), Tl, VMUL(LDK(KP831469612), Tc));
+	       T17 = VADD(T15, T16);
+	       T18 = VFMA(LDK(KP831469612), Td, VMUL(LDK(KP555570233), Tk));
+	       T19 = VFMA(LDK(KP195090322), Tt, VMUL(LDK(KP980785280), T4));
+	       T1a = VADD(T18, T19);
+	       T1b = VADD(T17, T1a);
+	       T1c = VADD(T14, T1b);
+	       T1d = VFMA(LDK(KP995184726), T3, VMUL(LDK(KP098017140), Tu));
+	       T1e = VFMA(LDK(KP634393284), Tj, VMUL(LDK(KP773010453), Te));
+	       T1f = VADD(T1d, T1e);
+	       T1g = VFMA(LDK(KP881921264), Tb, VMUL(LDK(KP471396736), Tm));
+	       T1h = VFMA(LDK(KP290284677), Tr, VMUL(LDK(KP956940335), T6));
+	       T1i = VADD(T1g, T1h);
+	       T1j = VADD(T1f, T1i);
+	       T1k = VFMA(LDK(KP956940335), T7, VMUL(LDK(KP290284677), Tq));
+	       T1l = VFMA(LDK(KP471396736), Tn, VMUL(LDK(KP881921264), Ta));
+	       T1m = VADD(T1k, T1l);
+	       T1n = VFMA(LDK(KP773010453), Tf, VMUL(LDK(KP634393284), Ti));
+	       T1o = VFMA(LDK(KP098017140), Tv, VMUL(LDK(KP995184726), T2));
+	       T1p = VADD(T1n, T1o);
+	       T1q = VADD(T1m, T1p);
+	       T1r = VADD(T1j, T1q);
+	       T1s = VADD(T1c, T1r);
+	       STA(&(O[0]), VFMA(LDK(KP1_999397637), T1s, VMUL(LDK(KP049082457), TZ)), ovs, &(O[0]));
+	       T1t = VFNMS(LDK(KP707106781), VSUB(Tg, Th), Tw);
+	       T1u = VSUB(T11, T12);
+	       T1v = VADD(T1t, T1u);
+	       T1w = VSUB(T18, T19);
+	       T1x = VSUB(TF, TG);
+	       T1y = VMUL(LDK(KP707106781), VSUB(T1w, T1x));
+	       T1z = VSUB(T15, T16);
+	       T1A = VSUB(TC, TD);
+	       T1B = VFMA(LDK(KP707106781), VADD(T1z, T1A), T1y);
+	       T1C = VADD(T1v, T1B);
+	       T1D = VSUB(TK, TL);
+	       T1E = VSUB(T1g, T1h);
+	       T1F = VADD(T1D, T1E);
+	       T1G = VSUB(T1d, T1e);
+	       T1H = VSUB(TN, TO);
+	       T1I = VSUB(T1G, T1H);
+	       T1J = VFMA(LDK(KP382683432), T1I, VMUL(LDK(KP923879532), T1F));
+	       T1K = VSUB(TR, TS);
+	       T1L = VSUB(T1n, T1o);
+	       T1M = VADD(T1K, T1L);
+	       T1N = VSUB(T1k, T1l);
+	       T1O = VSUB(TU, TV);
+	       T1P = VSUB(T1N, T1O);
+	       T1Q = VFMA(LDK(KP923879532), T1P, VMUL(LDK(KP382683432), T1M));
+	       T1R = VADD(T1J, T1Q);
+	       T1S = VADD(T1C, T1R);
+	       T1T = VFNMS(LDK(KP707106781), VADD(Tg, Th), T1);
+	       T1U = VSUB(Ty, Tz);
+	       T1V = VSUB(T1T, T1U);
+	       T1W = VMUL(LDK(KP707106781), VADD(T1w, T1x));
+	       T1X = VFMS(LDK(KP707106781), VSUB(T1z, T1A), T1W);
+	       T1Y = VADD(T1V, T1X);
+	       T1Z = VFMS(LDK(KP382683432), T1F, VMUL(LDK(KP923879532), T1I));
+	       T20 = VFMS(LDK(KP923879532), T1M, VMUL(LDK(KP382683432), T1P));
+	       T21 = VADD(T1Z, T20);
+	       T22 = VSUB(T1Y, T21);
+	       STA(&(O[WS(os, 1)]), VFMS(LDK(KP1_994580913), T22, VMUL(LDK(KP147129127), T1S)), ovs, &(O[0]));
+	       T23 = VSUB(T1t, T1u);
+	       T24 = VFMA(LDK(KP707106781), VSUB(T1z, T1A), T1W);
+	       T25 = VSUB(T23, T24);
+	       T26 = VADD(T1G, T1H);
+	       T27 = VSUB(T1D, T1E);
+	       T28 = VFMS(LDK(KP923879532), T27, VMUL(LDK(KP382683432), T26));
+	       T29 = VADD(T1N, T1O);
+	       T2a = VSUB(T1K, T1L);
+	       T2b = VFMS(LDK(KP382683432), T2a, VMUL(LDK(KP923879532), T29));
+	       T2c = VADD(T28, T2b);
+	       T2d = VADD(T25, T2c);
+	       T2e = VADD(T1T, T1U);
+	       T2f = VFMS(LDK(KP707106781), VADD(T1z, T1A), T1y);
+	       T2g = VADD(T2e, T2f);
+	       T2h = VFMA(LDK(KP923879532), T26, VMUL(LDK(KP382683432), T27));
+	       T2i = VFMA(LDK(KP382683432), T29, VMUL(LDK(KP923879532), T2a));
+	       T2j = VADD(T2h, T2i);
+	       T2k = VADD(T2g, T2j);
+	       STA(&(O[WS(os, 2)]), VFMA(LDK(KP1_984959069), T2k, VMUL(LDK(KP244821350), T2d)), ovs, &(O[0]));
+	       T2l = VSUB(Tx, TA);
+	       T2m = VSUB(T17, T1a);
+	       T2n = VADD(T2l, T2m);
+	       T2o = VSUB(T1m, T1p);
+	       T2p = VSUB(TT, TW);
+	       T2q = VMUL(LDK(KP707106781), VSUB(T2o, T2p));
+	       T2r = VSUB(T1f, T1i);
+	       T2s = VSUB(TM, TP);
+	       T2t = VFMA(LDK(KP707106781), VADD(T2r, T2s), T2q);
+	       T2u = VADD(T2n, T2t);
+	       T2v = VSUB(T10, T13);
+	       T2w = VSUB(TE, TH);
+	       T2x = VSUB(T2v, T2w);
+	       T2y = VMUL(LDK(KP707106781), VADD(T2o, T2p));
+	       T2z = VFMS(LDK(KP707106781), VSUB(T2r, T2s), T2y);
+	       T2A = VADD(T2x, T2z);
+	       STA(&(O[WS(os, 3)]), VFMS(LDK(KP1_970555284), T2A, VMUL(LDK(KP341923777), T2u)), ovs, &(O[0]));
+	       T2B = VSUB(T2l, T2m);
+	       T2C = VFMA(LDK(KP707106781), VSUB(T2r, T2s), T2y);
+	       T2D = VSUB(T2B, T2C);
+	       T2E = VADD(T2v, T2w);
+	       T2F = VFMS(LDK(KP707106781), VADD(T2r, T2s), T2q);
+	       T2G = VADD(T2E, T2F);
+	       STA(&(O[WS(os, 4)]), VFMA(LDK(KP1_951404260), T2G, VMUL(LDK(KP438202480), T2D)), ovs, &(O[0]));
+	       T2H = VADD(T23, T24);
+	       T2I = VSUB(T2h, T2i);
+	       T2J = VADD(T2H, T2I);
+	       T2K = VSUB(T2e, T2f);
+	       T2L = VSUB(T28, T2b);
+	       T2M = VSUB(T2K, T2L);
+	       STA(&(O[WS(os, 5)]), VFMS(LDK(KP1_927552131), T2M, VMUL(LDK(KP533425514), T2J)), ovs, &(O[0]));
+	       T2N = VSUB(T1v, T1B);
+	       T2O = VSUB(T1Z, T20);
+	       T2P = VADD(T2N, T2O);
+	       T2Q = VSUB(T1V, T1X);
+	       T2R = VSUB(T1J, T1Q);
+	       T2S = VADD(T2Q, T2R);
+	       STA(&(O[WS(os, 6)]), VFMA(LDK(KP1_899056361), T2S, VMUL(LDK(KP627363480), T2P)), ovs, &(O[0]));
+	       T2T = VSUB(TB, TI);
+	       T2U = VSUB(T1j, T1q);
+	       T2V = VADD(T2T, T2U);
+	       T2W = VSUB(T14, T1b);
+	       T2X = VSUB(TQ, TX);
+	       T2Y = VSUB(T2W, T2X);
+	       STA(&(O[WS(os, 7)]), VFMS(LDK(KP1_865985597), T2Y, VMUL(LDK(KP719790073), T2V)), ovs, &(O[0]));
+	       T2Z = VSUB(T2T, T2U);
+	       T30 = VADD(T2W, T2X);
+	       STA(&(O[WS(os, 8)]), VFMA(LDK(KP1_828419511), T30, VMUL(LDK(KP810482628), T2Z)), ovs, &(O[0]));
+	       T31 = VSUB(T2N, T2O);
+	       T32 = VSUB(T2Q, T2R);
+	       STA(&(O[WS(os, 9)]), VFMS(LDK(KP1_786448602), T32, VMUL(LDK(KP899222659), T31)), ovs, &(O[0]));
+	       T33 = VSUB(T2H, T2I);
+	       T34 = VADD(T2K, T2L);
+	       STA(&(O[WS(os, 10)]), VFMA(LDK(KP1_740173982), T34, VMUL(LDK(KP985796384), T33)), ovs, &(O[0]));
+	       T35 = VADD(T2B, T2C);
+	       T36 = VSUB(T2E, T2F);
+	       STA(&(O[WS(os, 11)]), VFMS(LDK(KP1_689707130), T36, VMUL(LDK(KP1_069995239), T35)), ovs, &(O[0]));
+	       T37 = VSUB(T2n, T2t);
+	       T38 = VSUB(T2x, T2z);
+	       STA(&(O[WS(os, 12)]), VFMA(LDK(KP1_635169626), T38, VMUL(LDK(KP1_151616382), T37)), ovs, &(O[0]));
+	       T39 = VSUB(T25, T2c);
+	       T3a = VSUB(T2g, T2j);
+	       STA(&(O[WS(os, 13)]), VFMS(LDK(KP1_576692855), T3a, VMUL(LDK(KP1_230463181), T39)), ovs, &(O[0]));
+	       T3b = VSUB(T1C, T1R);
+	       T3c = VADD(T1Y, T21);
+	       STA(&(O[WS(os, 14)]), VFMA(LDK(KP1_514417693), T3c, VMUL(LDK(KP1_306345685), T3b)), ovs, &(O[0]));
+	       T3d = VSUB(TJ, TY);
+	       T3e = VSUB(T1c, T1r);
+	       STA(&(O[WS(os, 15)]), VFMS(LDK(KP1_448494165), T3e, VMUL(LDK(KP1_379081089), T3d)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 16)]), VFMA(LDK(KP1_379081089), T3e, VMUL(LDK(KP1_448494165), T3d)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 17)]), VFMS(LDK(KP1_306345685), T3c, VMUL(LDK(KP1_514417693), T3b)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 18)]), VFMA(LDK(KP1_230463181), T3a, VMUL(LDK(KP1_576692855), T39)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 19)]), VFMS(LDK(KP1_151616382), T38, VMUL(LDK(KP1_635169626), T37)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 20)]), VFMA(LDK(KP1_069995239), T36, VMUL(LDK(KP1_689707130), T35)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 21)]), VFMS(LDK(KP985796384), T34, VMUL(LDK(KP1_740173982), T33)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 22)]), VFMA(LDK(KP899222659), T32, VMUL(LDK(KP1_786448602), T31)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 23)]), VFMS(LDK(KP810482628), T30, VMUL(LDK(KP1_828419511), T2Z)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 24)]), VFMA(LDK(KP719790073), T2Y, VMUL(LDK(KP1_865985597), T2V)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 25)]), VFMS(LDK(KP627363480), T2S, VMUL(LDK(KP1_899056361), T2P)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 26)]), VFMA(LDK(KP533425514), T2M, VMUL(LDK(KP1_927552131), T2J)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 27)]), VFMS(LDK(KP438202480), T2G, VMUL(LDK(KP1_951404260), T2D)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 28)]), VFMA(LDK(KP341923777), T2A, VMUL(LDK(KP1_970555284), T2u)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 29)]), VFMS(LDK(KP244821350), T2k, VMUL(LDK(KP1_984959069), T2d)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 30)]), VFMA(LDK(KP147129127), T22, VMUL(LDK(KP1_994580913), T1S)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 31)]), VFMS(LDK(KP049082457), T1s, VMUL(LDK(KP1_999397637), TZ)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 32, XSIMD_STRING("e11v_32"), {132, 72, 80, 0}, &GENUS, REDFT11 };
+
+void XSIMD(codelet_e11v_32) (planner *p) {
+     X(kr2r_register) (p, e11v_32, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name e11v_32 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -redft11 -n 32 -name e11_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 206 FP additions, 146 FP multiplications,
+ * (or, 206 additions, 146 multiplications, 0 fused multiply/add),
+ * 206 stack variables, 47 constants, and 64 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void e11v_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DVK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DVK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DVK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DVK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DVK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DVK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DVK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DVK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DVK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DVK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DVK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DVK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DVK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DVK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DVK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DVK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DVK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DVK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DVK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DVK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DVK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DVK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DVK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DVK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DVK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DVK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DVK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DVK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DVK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DVK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DVK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DVK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DVK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DVK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DVK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DVK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DVK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DVK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       V T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       V T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       V T3j, T3k;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = VMUL(LDK(KP707106781), VADD(Tg, Th));
+	       Ty = VADD(T1, Tx);
+	       Tz = VADD(VMUL(LDK(KP923879532), T9), VMUL(LDK(KP382683432), To));
+	       TA = VADD(VMUL(LDK(KP382683432), Tp), VMUL(LDK(KP923879532), T8));
+	       TB = VADD(Tz, TA);
+	       TC = VADD(Ty, TB);
+	       TD = VADD(VMUL(LDK(KP980785280), T5), VMUL(LDK(KP195090322), Ts));
+	       TE = VADD(VMUL(LDK(KP555570233), Tl), VMUL(LDK(KP831469612), Tc));
+	       TF = VADD(TD, TE);
+	       TG = VADD(VMUL(LDK(KP831469612), Td), VMUL(LDK(KP555570233), Tk));
+	       TH = VADD(VMUL(LDK(KP195090322), Tt), VMUL(LDK(KP980785280), T4));
+	       TI = VADD(TG, TH);
+	       TJ = VADD(TF, TI);
+	       TK = VADD(TC, TJ);
+	       TL = VADD(VMUL(LDK(KP995184726), T3), VMUL(LDK(KP098017140), Tu));
+	       TM = VADD(VMUL(LDK(KP634393284), Tj), VMUL(LDK(KP773010453), Te));
+	       TN = VADD(TL, TM);
+	       TO = VADD(VMUL(LDK(KP881921264), Tb), VMUL(LDK(KP471396736), Tm));
+	       TP = VADD(VMUL(LDK(KP290284677), Tr), VMUL(LDK(KP956940335), T6));
+	       TQ = VADD(TO, TP);
+	       TR = VADD(TN, TQ);
+	       TS = VADD(VMUL(LDK(KP956940335), T7), VMUL(LDK(KP290284677), Tq));
+	       TT = VADD(VMUL(LDK(KP471396736), Tn), VMUL(LDK(KP881921264), Ta));
+	       TU = VADD(TS, TT);
+	       TV = VADD(VMUL(LDK(KP773010453), Tf), VMUL(LDK(KP634393284), Ti));
+	       TW = VADD(VMUL(LDK(KP098017140), Tv), VMUL(LDK(KP995184726), T2));
+	       TX = VADD(TV, TW);
+	       TY = VADD(TU, TX);
+	       TZ = VADD(TR, TY);
+	       T10 = VADD(TK, TZ);
+	       T11 = VMUL(LDK(KP707106781), VSUB(Tg, Th));
+	       T12 = VADD(Tw, T11);
+	       T13 = VSUB(VMUL(LDK(KP923879532), To), VMUL(LDK(KP382683432), T9));
+	       T14 = VSUB(VMUL(LDK(KP382683432), T8), VMUL(LDK(KP923879532), Tp));
+	       T15 = VADD(T13, T14);
+	       T16 = VADD(T12, T15);
+	       T17 = VSUB(VMUL(LDK(KP980785280), Ts), VMUL(LDK(KP195090322), T5));
+	       T18 = VSUB(VMUL(LDK(KP555570233), Tc), VMUL(LDK(KP831469612), Tl));
+	       T19 = VADD(T17, T18);
+	       T1a = VSUB(VMUL(LDK(KP831469612), Tk), VMUL(LDK(KP555570233), Td));
+	       T1b = VSUB(VMUL(LDK(KP195090322), T4), VMUL(LDK(KP980785280), Tt));
+	       T1c = VADD(T1a, T1b);
+	       T1d = VADD(T19, T1c);
+	       T1e = VADD(T16, T1d);
+	       T1f = VSUB(VMUL(LDK(KP995184726), Tu), VMUL(LDK(KP098017140), T3));
+	       T1g = VSUB(VMUL(LDK(KP634393284), Te), VMUL(LDK(KP773010453), Tj));
+	       T1h = VADD(T1f, T1g);
+	       T1i = VSUB(VMUL(LDK(KP881921264), Tm), VMUL(LDK(KP471396736), Tb));
+	       T1j = VSUB(VMUL(LDK(KP290284677), T6), VMUL(LDK(KP956940335), Tr));
+	       T1k = VADD(T1i, T1j);
+	       T1l = VADD(T1h, T1k);
+	       T1m = VSUB(VMUL(LDK(KP956940335), Tq), VMUL(LDK(KP290284677), T7));
+	       T1n = VSUB(VMUL(LDK(KP471396736), Ta), VMUL(LDK(KP881921264), Tn));
+	       T1o = VADD(T1m, T1n);
+	       T1p = VSUB(VMUL(LDK(KP773010453), Ti), VMUL(LDK(KP634393284), Tf));
+	       T1q = VSUB(VMUL(LDK(KP098017140), T2), VMUL(LDK(KP995184726), Tv));
+	       T1r = VADD(T1p, T1q);
+	       T1s = VADD(T1o, T1r);
+	       T1t = VADD(T1l, T1s);
+	       T1u = VADD(T1e, T1t);
+	       STA(&(O[0]), VADD(VMUL(LDK(KP1_999397637), T10), VMUL(LDK(KP049082457), T1u)), ovs, &(O[0]));
+	       T1v = VSUB(T1, Tx);
+	       T1w = VSUB(T13, T14);
+	       T1x = VSUB(T1v, T1w);
+	       T1y = VSUB(TD, TE);
+	       T1z = VSUB(T17, T18);
+	       T1A = VMUL(LDK(KP707106781), VSUB(T1y, T1z));
+	       T1B = VSUB(TG, TH);
+	       T1C = VSUB(T1a, T1b);
+	       T1D = VMUL(LDK(KP707106781), VADD(T1B, T1C));
+	       T1E = VSUB(T1A, T1D);
+	       T1F = VADD(T1x, T1E);
+	       T1G = VSUB(T1f, T1g);
+	       T1H = VSUB(TO, TP);
+	       T1I = VADD(T1G, T1H);
+	       T1J = VSUB(TL, TM);
+	       T1K = VSUB(T1i, T1j);
+	       T1L = VSUB(T1J, T1K);
+	       T1M = VSUB(VMUL(LDK(KP382683432), T1I), VMUL(LDK(KP923879532), T1L));
+	       T1N = VSUB(T1m, T1n);
+	       T1O = VSUB(TV, TW);
+	       T1P = VADD(T1N, T1O);
+	       T1Q = VSUB(TS, TT);
+	       T1R = VSUB(T1p, T1q);
+	       T1S = VSUB(T1Q, T1R);
+	       T1T = VSUB(VMUL(LDK(KP923879532), T1P), VMUL(LDK(KP382683432), T1S));
+	       T1U = VADD(T1M, T1T);
+	       T1V = VSUB(T1F, T1U);
+	       T1W = VSUB(Tw, T11);
+	       T1X = VSUB(Tz, TA);
+	       T1Y = VADD(T1W, T1X);
+	       T1Z = VMUL(LDK(KP707106781), VADD(T1y, T1z));
+	       T20 = VMUL(LDK(KP707106781), VSUB(T1B, T1C));
+	       T21 = VADD(T1Z, T20);
+	       T22 = VADD(T1Y, T21);
+	       T23 = VADD(VMUL(LDK(KP382683432), T1L), VMUL(LDK(KP923879532), T1I));
+	       T24 = VADD(VMUL(LDK(KP923879532), T1S), VMUL(LDK(KP382683432), T1P));
+	       T25 = VADD(T23, T24);
+	       T26 = VADD(T22, T25);
+	       STA(&(O[WS(os, 1)]), VSUB(VMUL(LDK(KP1_994580913), T1V), VMUL(LDK(KP147129127), T26)), ovs, &(O[0]));
+	       T27 = VADD(T1v, T1w);
+	       T28 = VSUB(T1Z, T20);
+	       T29 = VADD(T27, T28);
+	       T2a = VADD(T1J, T1K);
+	       T2b = VSUB(T1G, T1H);
+	       T2c = VADD(VMUL(LDK(KP923879532), T2a), VMUL(LDK(KP382683432), T2b));
+	       T2d = VADD(T1Q, T1R);
+	       T2e = VSUB(T1N, T1O);
+	       T2f = VADD(VMUL(LDK(KP382683432), T2d), VMUL(LDK(KP923879532), T2e));
+	       T2g = VADD(T2c, T2f);
+	       T2h = VADD(T29, T2g);
+	       T2i = VSUB(T1W, T1X);
+	       T2j = VADD(T1A, T1D);
+	       T2k = VSUB(T2i, T2j);
+	       T2l = VSUB(VMUL(LDK(KP923879532), T2b), VMUL(LDK(KP382683432), T2a));
+	       T2m = VSUB(VMUL(LDK(KP382683432), T2e), VMUL(LDK(KP923879532), T2d));
+	       T2n = VADD(T2l, T2m);
+	       T2o = VADD(T2k, T2n);
+	       STA(&(O[WS(os, 2)]), VADD(VMUL(LDK(KP1_984959069), T2h), VMUL(LDK(KP244821350), T2o)), ovs, &(O[0]));
+	       T2p = VSUB(Ty, TB);
+	       T2q = VSUB(T19, T1c);
+	       T2r = VSUB(T2p, T2q);
+	       T2s = VSUB(TN, TQ);
+	       T2t = VSUB(T1h, T1k);
+	       T2u = VMUL(LDK(KP707106781), VSUB(T2s, T2t));
+	       T2v = VSUB(TU, TX);
+	       T2w = VSUB(T1o, T1r);
+	       T2x = VMUL(LDK(KP707106781), VADD(T2v, T2w));
+	       T2y = VSUB(T2u, T2x);
+	       T2z = VADD(T2r, T2y);
+	       T2A = VSUB(T12, T15);
+	       T2B = VSUB(TF, TI);
+	       T2C = VADD(T2A, T2B);
+	       T2D = VMUL(LDK(KP707106781), VADD(T2s, T2t));
+	       T2E = VMUL(LDK(KP707106781), VSUB(T2v, T2w));
+	       T2F = VADD(T2D, T2E);
+	       T2G = VADD(T2C, T2F);
+	       STA(&(O[WS(os, 3)]), VSUB(VMUL(LDK(KP1_970555284), T2z), VMUL(LDK(KP341923777), T2G)), ovs, &(O[0]));
+	       T2H = VADD(T2p, T2q);
+	       T2I = VSUB(T2D, T2E);
+	       T2J = VADD(T2H, T2I);
+	       T2K = VSUB(T2A, T2B);
+	       T2L = VADD(T2u, T2x);
+	       T2M = VSUB(T2K, T2L);
+	       STA(&(O[WS(os, 4)]), VADD(VMUL(LDK(KP1_951404260), T2J), VMUL(LDK(KP438202480), T2M)), ovs, &(O[0]));
+	       T2N = VSUB(T27, T28);
+	       T2O = VSUB(T2l, T2m);
+	       T2P = VSUB(T2N, T2O);
+	       T2Q = VADD(T2i, T2j);
+	       T2R = VSUB(T2c, T2f);
+	       T2S = VADD(T2Q, T2R);
+	       STA(&(O[WS(os, 5)]), VSUB(VMUL(LDK(KP1_927552131), T2P), VMUL(LDK(KP533425514), T2S)), ovs, &(O[0]));
+	       T2T = VSUB(T1x, T1E);
+	       T2U = VSUB(T23, T24);
+	       T2V = VADD(T2T, T2U);
+	       T2W = VSUB(T1Y, T21);
+	       T2X = VSUB(T1M, T1T);
+	       T2Y = VADD(T2W, T2X);
+	       STA(&(O[WS(os, 6)]), VADD(VMUL(LDK(KP1_899056361), T2V), VMUL(LDK(KP627363480), T2Y)), ovs, &(O[0]));
+	       T2Z = VSUB(TC, TJ);
+	       T30 = VSUB(T1l, T1s);
+	       T31 = VSUB(T2Z, T30);
+	       T32 = VSUB(T16, T1d);
+	       T33 = VSUB(TR, TY);
+	       T34 = VADD(T32, T33);
+	       STA(&(O[WS(os, 7)]), VSUB(VMUL(LDK(KP1_865985597), T31), VMUL(LDK(KP719790073), T34)), ovs, &(O[0]));
+	       T35 = VADD(T2Z, T30);
+	       T36 = VSUB(T32, T33);
+	       STA(&(O[WS(os, 8)]), VADD(VMUL(LDK(KP1_828419511), T35), VMUL(LDK(KP810482628), T36)), ovs, &(O[0]));
+	       T37 = VSUB(T2T, T2U);
+	       T38 = VSUB(T2W, T2X);
+	       STA(&(O[WS(os, 9)]), VSUB(VMUL(LDK(KP1_786448602), T37), VMUL(LDK(KP899222659), T38)), ovs, &(O[0]));
+	       T39 = VADD(T2N, T2O);
+	       T3a = VSUB(T2Q, T2R);
+	       STA(&(O[WS(os, 10)]), VADD(VMUL(LDK(KP1_740173982), T39), VMUL(LDK(KP985796384), T3a)), ovs, &(O[0]));
+	       T3b = VSUB(T2H, T2I);
+	       T3c = VADD(T2K, T2L);
+	       STA(&(O[WS(os, 11)]), VSUB(VMUL(LDK(KP1_689707130), T3b), VMUL(LDK(KP1_069995239), T3c)), ovs, &(O[0]));
+	       T3d = VSUB(T2r, T2y);
+	       T3e = VSUB(T2C, T2F);
+	       STA(&(O[WS(os, 12)]), VADD(VMUL(LDK(KP1_635169626), T3d), VMUL(LDK(KP1_151616382), T3e)), ovs, &(O[0]));
+	       T3f = VSUB(T29, T2g);
+	       T3g = VSUB(T2k, T2n);
+	       STA(&(O[WS(os, 13)]), VSUB(VMUL(LDK(KP1_576692855), T3f), VMUL(LDK(KP1_230463181), T3g)), ovs, &(O[0]));
+	       T3h = VADD(T1F, T1U);
+	       T3i = VSUB(T22, T25);
+	       STA(&(O[WS(os, 14)]), VADD(VMUL(LDK(KP1_514417693), T3h), VMUL(LDK(KP1_306345685), T3i)), ovs, &(O[0]));
+	       T3j = VSUB(TK, TZ);
+	       T3k = VSUB(T1e, T1t);
+	       STA(&(O[WS(os, 15)]), VSUB(VMUL(LDK(KP1_448494165), T3j), VMUL(LDK(KP1_379081089), T3k)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 16)]), VADD(VMUL(LDK(KP1_379081089), T3j), VMUL(LDK(KP1_448494165), T3k)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 17)]), VSUB(VMUL(LDK(KP1_306345685), T3h), VMUL(LDK(KP1_514417693), T3i)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 18)]), VADD(VMUL(LDK(KP1_230463181), T3f), VMUL(LDK(KP1_576692855), T3g)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 19)]), VSUB(VMUL(LDK(KP1_151616382), T3d), VMUL(LDK(KP1_635169626), T3e)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 20)]), VADD(VMUL(LDK(KP1_069995239), T3b), VMUL(LDK(KP1_689707130), T3c)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 21)]), VSUB(VMUL(LDK(KP985796384), T39), VMUL(LDK(KP1_740173982), T3a)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 22)]), VADD(VMUL(LDK(KP899222659), T37), VMUL(LDK(KP1_786448602), T38)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 23)]), VSUB(VMUL(LDK(KP810482628), T35), VMUL(LDK(KP1_828419511), T36)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 24)]), VADD(VMUL(LDK(KP719790073), T31), VMUL(LDK(KP1_865985597), T34)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 25)]), VSUB(VMUL(LDK(KP627363480), T2V), VMUL(LDK(KP1_899056361), T2Y)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 26)]), VADD(VMUL(LDK(KP533425514), T2P), VMUL(LDK(KP1_927552131), T2S)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 27)]), VSUB(VMUL(LDK(KP438202480), T2J), VMUL(LDK(KP1_951404260), T2M)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 28)]), VADD(VMUL(LDK(KP341923777), T2z), VMUL(LDK(KP1_970555284), T2G)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 29)]), VSUB(VMUL(LDK(KP244821350), T2h), VMUL(LDK(KP1_984959069), T2o)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 30)]), VADD(VMUL(LDK(KP147129127), T1V), VMUL(LDK(KP1_994580913), T26)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 31)]), VSUB(VMUL(LDK(KP049082457), T10), VMUL(LDK(KP1_999397637), T1u)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 32, XSIMD_STRING("e11v_32"), {206, 146, 0, 0}, &GENUS, REDFT11 };
+
+void XSIMD(codelet_e11v_32) (planner *p) {
+     X(kr2r_register) (p, e11v_32, &desc);
+}
+
+#endif
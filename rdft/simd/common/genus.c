@@ -58,3 +58,42 @@ static int hc2cfv_okp(const R *Rp, const R *Ip, const R *Rm, const R *Im,
 }
 
 EXTERN_CONST(hc2c_genus, XSIMD(rdft_hc2cfv_genus)) = { hc2cfv_okp, R2HC, VL };
+
+/* r2cfv/r2cbv codelets compute one transform per real vector lane */
+static int r2cv_okp(const R *R0, const R *R1, const R *Cr, const R *Ci,
+		    INT rs, INT csr, INT csi, INT vl, INT ivs, INT ovs,
+		    const planner *plnr)
+{
+     return (1
+	     && !NO_SIMDP(plnr)
+	     && ALIGNEDA(R0)
+	     && ALIGNEDA(R1)
+	     && ALIGNEDA(Cr)
+	     && ALIGNEDA(Ci)
+	     && SIMD_STRIDE_OKA(rs)
+	     && SIMD_STRIDE_OKA(csr)
+	     && SIMD_STRIDE_OKA(csi)
+	     && ivs == 1
+	     && ovs == 1
+	     && (vl % (2 * VL)) == 0);
+}
+
+EXTERN_CONST(kr2c_genus, XSIMD(rdft_r2cfv_genus)) = { r2cv_okp, R2HC, 2 * VL };
+EXTERN_CONST(kr2c_genus, XSIMD(rdft_r2cbv_genus)) = { r2cv_okp, HC2R, 2 * VL };
+
+/* r2rv codelets compute one REDFT/RODFT transform per real vector lane */
+static int r2rv_okp(const R *I, const R *O, INT is, INT os,
+		    INT vl, INT ivs, INT ovs, const planner *plnr)
+{
+     return (1
+	     && !NO_SIMDP(plnr)
+	     && ALIGNEDA(I)
+	     && ALIGNEDA(O)
+	     && SIMD_STRIDE_OKA(is)
+	     && SIMD_STRIDE_OKA(os)
+	     && ivs == 1
+	     && ovs == 1
+	     && (vl % (2 * VL)) == 0);
+}
+
+EXTERN_CONST(kr2r_genus, XSIMD(rdft_r2rv_genus)) = { r2rv_okp, 2 * VL };
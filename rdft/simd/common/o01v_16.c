@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o01v_16 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft01 -n 16 -name o01_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 76 FP additions, 46 FP multiplications,
+ * (or, 48 additions, 18 multiplications, 28 fused multiply/add),
+ * 68 stack variables, 18 constants, and 32 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o01v_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = VFMA(LDK(KP942793473), T5, VMUL(LDK(KP1_763842528), Tb));
+	       Ti = VFMA(LDK(KP580569354), T3, VMUL(LDK(KP1_913880671), Td));
+	       Tj = VADD(Th, Ti);
+	       Tk = VFMA(LDK(KP1_268786568), T7, VMUL(LDK(KP1_546020906), T9));
+	       Tl = VFMA(LDK(KP196034280), T1, VMUL(LDK(KP1_990369453), Tf));
+	       Tm = VADD(Tk, Tl);
+	       Tn = VADD(Tj, Tm);
+	       To = VFMA(LDK(KP1_111140466), T6, VMUL(LDK(KP1_662939224), Ta));
+	       Tp = VFMA(LDK(KP390180644), T2, VMUL(LDK(KP1_961570560), Te));
+	       Tq = VADD(To, Tp);
+	       Tr = VFMA(LDK(KP765366864), T4, VMUL(LDK(KP1_847759065), Tc));
+	       Ts = VFMA(LDK(KP1_414213562), T8, Tg);
+	       Tt = VADD(Tr, Ts);
+	       Tu = VADD(Tq, Tt);
+	       STA(&(O[0]), VADD(Tn, Tu), ovs, &(O[0]));
+	       Tv = VFMS(LDK(KP1_763842528), T5, VMUL(LDK(KP942793473), Tb));
+	       Tw = VFMS(LDK(KP1_913880671), T3, VMUL(LDK(KP580569354), Td));
+	       Tx = VADD(Tv, Tw);
+	       Ty = VSUB(Tk, Tl);
+	       Tz = VADD(Tx, Ty);
+	       TA = VSUB(Th, Ti);
+	       TB = VFMS(LDK(KP1_546020906), T7, VMUL(LDK(KP1_268786568), T9));
+	       TC = VFMS(LDK(KP1_990369453), T1, VMUL(LDK(KP196034280), Tf));
+	       TD = VADD(TB, TC);
+	       TE = VADD(TA, TD);
+	       TF = VFMA(LDK(KP382683432), TE, VMUL(LDK(KP923879532), Tz));
+	       TG = VFMS(LDK(KP1_847759065), T4, VMUL(LDK(KP765366864), Tc));
+	       TH = VFNMS(LDK(KP1_414213562), T8, Tg);
+	       TI = VSUB(TG, TH);
+	       TJ = VFMS(LDK(KP1_662939224), T6, VMUL(LDK(KP1_111140466), Ta));
+	       TK = VFMS(LDK(KP1_961570560), T2, VMUL(LDK(KP390180644), Te));
+	       TL = VADD(TJ, TK);
+	       TM = VSUB(To, Tp);
+	       TN = VFMA(LDK(KP707106781), VADD(TL, TM), TI);
+	       STA(&(O[WS(os, 1)]), VADD(TF, TN), ovs, &(O[0]));
+	       TO = VADD(TG, TH);
+	       TP = VFMA(LDK(KP707106781), VSUB(TL, TM), TO);
+	       TQ = VSUB(TD, TA);
+	       TR = VSUB(Tx, Ty);
+	       TS = VFMA(LDK(KP923879532), TR, VMUL(LDK(KP382683432), TQ));
+	       STA(&(O[WS(os, 2)]), VADD(TP, TS), ovs, &(O[0]));
+	       TT = VSUB(TJ, TK);
+	       TU = VSUB(Ts, Tr);
+	       TV = VADD(TT, TU);
+	       TW = VSUB(Tj, Tm);
+	       TX = VSUB(TC, TB);
+	       TY = VSUB(Tv, Tw);
+	       TZ = VSUB(TX, TY);
+	       STA(&(O[WS(os, 3)]), VFMS(LDK(KP707106781), VADD(TW, TZ), TV), ovs, &(O[0]));
+	       T10 = VSUB(TU, TT);
+	       STA(&(O[WS(os, 4)]), VFMA(LDK(KP707106781), VSUB(TZ, TW), T10), ovs, &(O[0]));
+	       T11 = VFMS(LDK(KP923879532), TQ, VMUL(LDK(KP382683432), TR));
+	       T12 = VFNMS(LDK(KP707106781), VSUB(TL, TM), TO);
+	       STA(&(O[WS(os, 5)]), VSUB(T11, T12), ovs, &(O[0]));
+	       T13 = VFMS(LDK(KP923879532), TE, VMUL(LDK(KP382683432), Tz));
+	       T14 = VFMS(LDK(KP707106781), VADD(TL, TM), TI);
+	       STA(&(O[WS(os, 6)]), VADD(T13, T14), ovs, &(O[0]));
+	       T15 = VSUB(Tq, Tt);
+	       T16 = VADD(TY, TX);
+	       STA(&(O[WS(os, 7)]), VADD(T15, T16), ovs, &(O[0]));
+	       STA(&(O[WS(os, 8)]), VSUB(T16, T15), ovs, &(O[0]));
+	       STA(&(O[WS(os, 9)]), VSUB(T13, T14), ovs, &(O[0]));
+	       STA(&(O[WS(os, 10)]), VADD(T11, T12), ovs, &(O[0]));
+	       STA(&(O[WS(os, 11)]), VFMS(LDK(KP707106781), VSUB(TZ, TW), T10), ovs, &(O[0]));
+	       STA(&(O[WS(os, 12)]), VFMA(LDK(KP707106781), VADD(TW, TZ), TV), ovs, &(O[0]));
+	       STA(&(O[WS(os, 13)]), VSUB(TS, TP), ovs, &(O[0]));
+	       STA(&(O[WS(os, 14)]), VSUB(TF, TN), ovs, &(O[0]));
+	       STA(&(O[WS(os, 15)]), VSUB(Tn, Tu), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 16, XSIMD_STRING("o01v_16"), {48, 18, 28, 0}, &GENUS, RODFT01 };
+
+void XSIMD(codelet_o01v_16) (planner *p) {
+     X(kr2r_register) (p, o01v_16, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o01v_16 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft01 -n 16 -name o01_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 72 FP additions, 41 FP multiplications,
+ * (or, 72 additions, 41 multiplications, 0 fused multiply/add),
+ * 73 stack variables, 18 constants, and 32 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o01v_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = VADD(VMUL(LDK(KP942793473), T5), VMUL(LDK(KP1_763842528), Tb));
+	       Ti = VADD(VMUL(LDK(KP580569354), T3), VMUL(LDK(KP1_913880671), Td));
+	       Tj = VADD(Th, Ti);
+	       Tk = VADD(VMUL(LDK(KP1_268786568), T7), VMUL(LDK(KP1_546020906), T9));
+	       Tl = VADD(VMUL(LDK(KP196034280), T1), VMUL(LDK(KP1_990369453), Tf));
+	       Tm = VADD(Tk, Tl);
+	       Tn = VADD(Tj, Tm);
+	       To = VADD(VMUL(LDK(KP1_111140466), T6), VMUL(LDK(KP1_662939224), Ta));
+	       Tp = VADD(VMUL(LDK(KP390180644), T2), VMUL(LDK(KP1_961570560), Te));
+	       Tq = VADD(To, Tp);
+	       Tr = VADD(VMUL(LDK(KP765366864), T4), VMUL(LDK(KP1_847759065), Tc));
+	       Ts = VMUL(LDK(KP1_414213562), T8);
+	       Tt = VADD(Tg, Ts);
+	       Tu = VADD(Tr, Tt);
+	       Tv = VADD(Tq, Tu);
+	       STA(&(O[0]), VADD(Tn, Tv), ovs, &(O[0]));
+	       Tw = VSUB(Th, Ti);
+	       Tx = VSUB(VMUL(LDK(KP1_546020906), T7), VMUL(LDK(KP1_268786568), T9));
+	       Ty = VSUB(VMUL(LDK(KP1_990369453), T1), VMUL(LDK(KP196034280), Tf));
+	       Tz = VADD(Tx, Ty);
+	       TA = VADD(Tw, Tz);
+	       TB = VSUB(VMUL(LDK(KP1_763842528), T5), VMUL(LDK(KP942793473), Tb));
+	       TC = VSUB(VMUL(LDK(KP1_913880671), T3), VMUL(LDK(KP580569354), Td));
+	       TD = VADD(TB, TC);
+	       TE = VSUB(Tk, Tl);
+	       TF = VADD(TD, TE);
+	       TG = VADD(VMUL(LDK(KP382683432), TA), VMUL(LDK(KP923879532), TF));
+	       TH = VSUB(VMUL(LDK(KP1_662939224), T6), VMUL(LDK(KP1_111140466), Ta));
+	       TI = VSUB(VMUL(LDK(KP1_961570560), T2), VMUL(LDK(KP390180644), Te));
+	       TJ = VADD(TH, TI);
+	       TK = VSUB(To, Tp);
+	       TL = VMUL(LDK(KP707106781), VADD(TJ, TK));
+	       TM = VSUB(VMUL(LDK(KP1_847759065), T4), VMUL(LDK(KP765366864), Tc));
+	       TN = VSUB(Tg, Ts);
+	       TO = VSUB(TM, TN);
+	       TP = VADD(TL, TO);
+	       STA(&(O[WS(os, 1)]), VADD(TG, TP), ovs, &(O[0]));
+	       TQ = VMUL(LDK(KP707106781), VSUB(TJ, TK));
+	       TR = VADD(TM, TN);
+	       TS = VADD(TQ, TR);
+	       TT = VSUB(TD, TE);
+	       TU = VSUB(Tz, Tw);
+	       TV = VADD(VMUL(LDK(KP923879532), TT), VMUL(LDK(KP382683432), TU));
+	       STA(&(O[WS(os, 2)]), VADD(TS, TV), ovs, &(O[0]));
+	       TW = VSUB(Tj, Tm);
+	       TX = VSUB(Ty, Tx);
+	       TY = VSUB(TB, TC);
+	       TZ = VSUB(TX, TY);
+	       T10 = VMUL(LDK(KP707106781), VADD(TW, TZ));
+	       T11 = VSUB(TH, TI);
+	       T12 = VSUB(Tt, Tr);
+	       T13 = VADD(T11, T12);
+	       STA(&(O[WS(os, 3)]), VSUB(T10, T13), ovs, &(O[0]));
+	       T14 = VMUL(LDK(KP707106781), VSUB(TZ, TW));
+	       T15 = VSUB(T12, T11);
+	       STA(&(O[WS(os, 4)]), VADD(T14, T15), ovs, &(O[0]));
+	       T16 = VSUB(VMUL(LDK(KP923879532), TU), VMUL(LDK(KP382683432), TT));
+	       T17 = VSUB(TR, TQ);
+	       STA(&(O[WS(os, 5)]), VSUB(T16, T17), ovs, &(O[0]));
+	       T18 = VSUB(VMUL(LDK(KP923879532), TA), VMUL(LDK(KP382683432), TF));
+	       T19 = VSUB(TL, TO);
+	       STA(&(O[WS(os, 6)]), VADD(T18, T19), ovs, &(O[0]));
+	       T1a = VSUB(Tq, Tu);
+	       T1b = VADD(TY, TX);
+	       STA(&(O[WS(os, 7)]), VADD(T1a, T1b), ovs, &(O[0]));
+	       STA(&(O[WS(os, 8)]), VSUB(T1b, T1a), ovs, &(O[0]));
+	       STA(&(O[WS(os, 9)]), VSUB(T18, T19), ovs, &(O[0]));
+	       STA(&(O[WS(os, 10)]), VADD(T16, T17), ovs, &(O[0]));
+	       STA(&(O[WS(os, 11)]), VSUB(T14, T15), ovs, &(O[0]));
+	       STA(&(O[WS(os, 12)]), VADD(T10, T13), ovs, &(O[0]));
+	       STA(&(O[WS(os, 13)]), VSUB(TV, TS), ovs, &(O[0]));
+	       STA(&(O[WS(os, 14)]), VSUB(TG, TP), ovs, &(O[0]));
+	       STA(&(O[WS(os, 15)]), VSUB(Tn, Tv), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 16, XSIMD_STRING("o01v_16"), {72, 41, 0, 0}, &GENUS, RODFT01 };
+
+void XSIMD(codelet_o01v_16) (planner *p) {
+     X(kr2r_register) (p, o01v_16, &desc);
+}
+
+#endif
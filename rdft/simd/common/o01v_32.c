@@ -0,0 +1,617 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o01v_32 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft01 -n 32 -name o01_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 196 FP additions, 114 FP multiplications,
+ * (or, 128 additions, 46 multiplications, 68 fused multiply/add),
+ * 176 stack variables, 38 constants, and 64 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o01v_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = VFMA(LDK(KP1_028205488), Tb, VMUL(LDK(KP1_715457220), Tl));
+	       Ty = VFMA(LDK(KP485960359), T5, VMUL(LDK(KP1_940062506), Tr));
+	       Tz = VADD(Tx, Ty);
+	       TA = VFMA(LDK(KP1_191398608), Td, VMUL(LDK(KP1_606415062), Tj));
+	       TB = VFMA(LDK(KP293460948), T3, VMUL(LDK(KP1_978353019), Tt));
+	       TC = VADD(TA, TB);
+	       TD = VADD(Tz, TC);
+	       TE = VFMA(LDK(KP855110186), T9, VMUL(LDK(KP1_807978586), Tn));
+	       TF = VFMA(LDK(KP673779706), T7, VMUL(LDK(KP1_883088130), Tp));
+	       TG = VADD(TE, TF);
+	       TH = VFMA(LDK(KP1_343117909), Tf, VMUL(LDK(KP1_481902250), Th));
+	       TI = VFMA(LDK(KP098135348), T1, VMUL(LDK(KP1_997590912), Tv));
+	       TJ = VADD(TH, TI);
+	       TK = VADD(TG, TJ);
+	       TL = VADD(TD, TK);
+	       TM = VFMA(LDK(KP942793473), Ta, VMUL(LDK(KP1_763842528), Tm));
+	       TN = VFMA(LDK(KP580569354), T6, VMUL(LDK(KP1_913880671), Tq));
+	       TO = VADD(TM, TN);
+	       TP = VFMA(LDK(KP1_268786568), Te, VMUL(LDK(KP1_546020906), Ti));
+	       TQ = VFMA(LDK(KP196034280), T2, VMUL(LDK(KP1_990369453), Tu));
+	       TR = VADD(TP, TQ);
+	       TS = VADD(TO, TR);
+	       TT = VFMA(LDK(KP1_111140466), Tc, VMUL(LDK(KP1_662939224), Tk));
+	       TU = VFMA(LDK(KP390180644), T4, VMUL(LDK(KP1_961570560), Ts));
+	       TV = VADD(TT, TU);
+	       TW = VFMA(LDK(KP765366864), T8, VMUL(LDK(KP1_847759065), To));
+	       TX = VFMA(LDK(KP1_414213562), Tg, Tw);
+	       TY = VADD(TW, TX);
+	       TZ = VADD(TV, TY);
+	       T10 = VADD(TS, TZ);
+	       STA(&(O[0]), VADD(TL, T10), ovs, &(O[0]));
+	       T11 = VFMS(LDK(KP1_763842528), Ta, VMUL(LDK(KP942793473), Tm));
+	       T12 = VFMS(LDK(KP1_913880671), T6, VMUL(LDK(KP580569354), Tq));
+	       T13 = VADD(T11, T12);
+	       T14 = VSUB(TP, TQ);
+	       T15 = VADD(T13, T14);
+	       T16 = VSUB(TM, TN);
+	       T17 = VFMS(LDK(KP1_546020906), Te, VMUL(LDK(KP1_268786568), Ti));
+	       T18 = VFMS(LDK(KP1_990369453), T2, VMUL(LDK(KP196034280), Tu));
+	       T19 = VADD(T17, T18);
+	       T1a = VADD(T16, T19);
+	       T1b = VFMA(LDK(KP382683432), T1a, VMUL(LDK(KP923879532), T15));
+	       T1c = VFMS(LDK(KP1_847759065), T8, VMUL(LDK(KP765366864), To));
+	       T1d = VFNMS(LDK(KP1_414213562), Tg, Tw);
+	       T1e = VSUB(T1c, T1d);
+	       T1f = VFMS(LDK(KP1_662939224), Tc, VMUL(LDK(KP1_111140466), Tk));
+	       T1g = VFMS(LDK(KP1_961570560), T4, VMUL(LDK(KP390180644), Ts));
+	       T1h = VADD(T1f, T1g);
+	       T1i = VSUB(TT, TU);
+	       T1j = VFMA(LDK(KP707106781), VADD(T1h, T1i), T1e);
+	       T1k = VADD(T1b, T1j);
+	       T1l = VFMS(LDK(KP1_715457220), Tb, VMUL(LDK(KP1_028205488), Tl));
+	       T1m = VFMS(LDK(KP1_940062506), T5, VMUL(LDK(KP485960359), Tr));
+	       T1n = VADD(T1l, T1m);
+	       T1o = VSUB(TA, TB);
+	       T1p = VADD(T1n, T1o);
+	       T1q = VSUB(Tx, Ty);
+	       T1r = VFMS(LDK(KP1_606415062), Td, VMUL(LDK(KP1_191398608), Tj));
+	       T1s = VFMS(LDK(KP1_978353019), T3, VMUL(LDK(KP293460948), Tt));
+	       T1t = VADD(T1r, T1s);
+	       T1u = VADD(T1q, T1t);
+	       T1v = VFMA(LDK(KP980785280), T1u, VMUL(LDK(KP195090322), T1p));
+	       T1w = VFMS(LDK(KP1_807978586), T9, VMUL(LDK(KP855110186), Tn));
+	       T1x = VFMS(LDK(KP1_883088130), T7, VMUL(LDK(KP673779706), Tp));
+	       T1y = VADD(T1w, T1x);
+	       T1z = VSUB(TH, TI);
+	       T1A = VADD(T1y, T1z);
+	       T1B = VSUB(TE, TF);
+	       T1C = VFMS(LDK(KP1_481902250), Tf, VMUL(LDK(KP1_343117909), Th));
+	       T1D = VFMS(LDK(KP1_997590912), T1, VMUL(LDK(KP098135348), Tv));
+	       T1E = VADD(T1C, T1D);
+	       T1F = VADD(T1B, T1E);
+	       T1G = VFMS(LDK(KP555570233), T1F, VMUL(LDK(KP831469612), T1A));
+	       T1H = VSUB(T1v, T1G);
+	       T1I = VFMA(LDK(KP831469612), T1F, VMUL(LDK(KP555570233), T1A));
+	       T1J = VFMS(LDK(KP195090322), T1u, VMUL(LDK(KP980785280), T1p));
+	       T1K = VSUB(T1I, T1J);
+	       STA(&(O[WS(os, 1)]), VFMA(LDK(KP707106781), VADD(T1H, T1K), T1k), ovs, &(O[0]));
+	       T1L = VSUB(T1q, T1t);
+	       T1M = VSUB(T1n, T1o);
+	       T1N = VFMS(LDK(KP831469612), T1M, VMUL(LDK(KP555570233), T1L));
+	       T1O = VSUB(T1E, T1B);
+	       T1P = VSUB(T1y, T1z);
+	       T1Q = VFMA(LDK(KP980785280), T1P, VMUL(LDK(KP195090322), T1O));
+	       T1R = VADD(T1N, T1Q);
+	       T1S = VSUB(T13, T14);
+	       T1T = VSUB(T16, T19);
+	       T1U = VFMS(LDK(KP382683432), T1T, VMUL(LDK(KP923879532), T1S));
+	       T1V = VADD(T1c, T1d);
+	       T1W = VFMA(LDK(KP707106781), VSUB(T1h, T1i), T1V);
+	       T1X = VSUB(T1U, T1W);
+	       STA(&(O[WS(os, 2)]), VSUB(T1R, T1X), ovs, &(O[0]));
+	       T1Y = VSUB(T1l, T1m);
+	       T1Z = VSUB(T1r, T1s);
+	       T20 = VADD(T1Y, T1Z);
+	       T21 = VSUB(TG, TJ);
+	       T22 = VSUB(T20, T21);
+	       T23 = VSUB(Tz, TC);
+	       T24 = VSUB(T1D, T1C);
+	       T25 = VSUB(T1w, T1x);
+	       T26 = VSUB(T24, T25);
+	       T27 = VADD(T23, T26);
+	       T28 = VFMS(LDK(KP382683432), T27, VMUL(LDK(KP923879532), T22));
+	       T29 = VSUB(T1f, T1g);
+	       T2a = VSUB(TX, TW);
+	       T2b = VADD(T29, T2a);
+	       T2c = VSUB(T11, T12);
+	       T2d = VSUB(T17, T18);
+	       T2e = VADD(T2c, T2d);
+	       T2f = VSUB(TO, TR);
+	       T2g = VFMA(LDK(KP707106781), VSUB(T2e, T2f), T2b);
+	       STA(&(O[WS(os, 3)]), VSUB(T28, T2g), ovs, &(O[0]));
+	       T2h = VADD(T20, T21);
+	       T2i = VSUB(T26, T23);
+	       T2j = VFMS(LDK(KP382683432), T2i, VMUL(LDK(KP923879532), T2h));
+	       T2k = VSUB(T2a, T29);
+	       T2l = VFMS(LDK(KP707106781), VADD(T2e, T2f), T2k);
+	       STA(&(O[WS(os, 4)]), VSUB(T2j, T2l), ovs, &(O[0]));
+	       T2m = VFMA(LDK(KP923879532), T1T, VMUL(LDK(KP382683432), T1S));
+	       T2n = VFNMS(LDK(KP707106781), VSUB(T1h, T1i), T1V);
+	       T2o = VADD(T2m, T2n);
+	       T2p = VFMS(LDK(KP980785280), T1O, VMUL(LDK(KP195090322), T1P));
+	       T2q = VFMA(LDK(KP831469612), T1L, VMUL(LDK(KP555570233), T1M));
+	       T2r = VSUB(T2p, T2q);
+	       T2s = VSUB(T1N, T1Q);
+	       STA(&(O[WS(os, 5)]), VFMS(LDK(KP707106781), VADD(T2r, T2s), T2o), ovs, &(O[0]));
+	       T2t = VADD(T1v, T1G);
+	       T2u = VFMS(LDK(KP923879532), T1a, VMUL(LDK(KP382683432), T15));
+	       T2v = VFMS(LDK(KP707106781), VADD(T1h, T1i), T1e);
+	       T2w = VADD(T2u, T2v);
+	       STA(&(O[WS(os, 6)]), VADD(T2t, T2w), ovs, &(O[0]));
+	       T2x = VSUB(T2c, T2d);
+	       T2y = VSUB(TV, TY);
+	       T2z = VADD(T2x, T2y);
+	       T2A = VSUB(TD, TK);
+	       T2B = VSUB(T1Y, T1Z);
+	       T2C = VADD(T25, T24);
+	       T2D = VADD(T2B, T2C);
+	       STA(&(O[WS(os, 7)]), VFMA(LDK(KP707106781), VADD(T2A, T2D), T2z), ovs, &(O[0]));
+	       T2E = VSUB(T2x, T2y);
+	       STA(&(O[WS(os, 8)]), VFMA(LDK(KP707106781), VSUB(T2D, T2A), T2E), ovs, &(O[0]));
+	       T2F = VADD(T1J, T1I);
+	       T2G = VSUB(T2u, T2v);
+	       STA(&(O[WS(os, 9)]), VADD(T2F, T2G), ovs, &(O[0]));
+	       T2H = VSUB(T2m, T2n);
+	       STA(&(O[WS(os, 10)]), VFMS(LDK(KP707106781), VSUB(T2r, T2s), T2H), ovs, &(O[0]));
+	       T2I = VFMA(LDK(KP382683432), T2h, VMUL(LDK(KP923879532), T2i));
+	       T2J = VFMA(LDK(KP707106781), VADD(T2e, T2f), T2k);
+	       STA(&(O[WS(os, 11)]), VSUB(T2I, T2J), ovs, &(O[0]));
+	       T2K = VFMA(LDK(KP382683432), T22, VMUL(LDK(KP923879532), T27));
+	       T2L = VFMS(LDK(KP707106781), VSUB(T2e, T2f), T2b);
+	       STA(&(O[WS(os, 12)]), VSUB(T2K, T2L), ovs, &(O[0]));
+	       T2M = VADD(T2q, T2p);
+	       T2N = VADD(T1U, T1W);
+	       STA(&(O[WS(os, 13)]), VSUB(T2M, T2N), ovs, &(O[0]));
+	       T2O = VSUB(T1b, T1j);
+	       STA(&(O[WS(os, 14)]), VFMA(LDK(KP707106781), VSUB(T1K, T1H), T2O), ovs, &(O[0]));
+	       T2P = VSUB(TS, TZ);
+	       T2Q = VSUB(T2C, T2B);
+	       STA(&(O[WS(os, 15)]), VADD(T2P, T2Q), ovs, &(O[0]));
+	       STA(&(O[WS(os, 16)]), VSUB(T2Q, T2P), ovs, &(O[0]));
+	       STA(&(O[WS(os, 17)]), VFMS(LDK(KP707106781), VSUB(T1K, T1H), T2O), ovs, &(O[0]));
+	       STA(&(O[WS(os, 18)]), VADD(T2N, T2M), ovs, &(O[0]));
+	       STA(&(O[WS(os, 19)]), VADD(T2K, T2L), ovs, &(O[0]));
+	       STA(&(O[WS(os, 20)]), VADD(T2I, T2J), ovs, &(O[0]));
+	       STA(&(O[WS(os, 21)]), VFMA(LDK(KP707106781), VSUB(T2r, T2s), T2H), ovs, &(O[0]));
+	       STA(&(O[WS(os, 22)]), VSUB(T2F, T2G), ovs, &(O[0]));
+	       STA(&(O[WS(os, 23)]), VFMS(LDK(KP707106781), VSUB(T2D, T2A), T2E), ovs, &(O[0]));
+	       STA(&(O[WS(os, 24)]), VFMS(LDK(KP707106781), VADD(T2A, T2D), T2z), ovs, &(O[0]));
+	       STA(&(O[WS(os, 25)]), VSUB(T2t, T2w), ovs, &(O[0]));
+	       STA(&(O[WS(os, 26)]), VFMA(LDK(KP707106781), VADD(T2r, T2s), T2o), ovs, &(O[0]));
+	       STA(&(O[WS(os, 27)]), VADD(T2j, T2l), ovs, &(O[0]));
+	       STA(&(O[WS(os, 28)]), VADD(T28, T2g), ovs, &(O[0]));
+	       STA(&(O[WS(os, 29)]), VADD(T1X, T1R), ovs, &(O[0]));
+	       STA(&(O[WS(os, 30)]), VFMS(LDK(KP707106781), VADD(T1H, T1K), T1k), ovs, &(O[0]));
+	       STA(&(O[WS(os, 31)]), VSUB(TL, T10), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 32, XSIMD_STRING("o01v_32"), {128, 46, 68, 0}, &GENUS, RODFT01 };
+
+void XSIMD(codelet_o01v_32) (planner *p) {
+     X(kr2r_register) (p, o01v_32, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o01v_32 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft01 -n 32 -name o01_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 186 FP additions, 103 FP multiplications,
+ * (or, 186 additions, 103 multiplications, 0 fused multiply/add),
+ * 187 stack variables, 38 constants, and 64 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o01v_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       V T2V, T2W, T2X, T2Y, T2Z, T30, T31;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = VADD(VMUL(LDK(KP1_028205488), Tb), VMUL(LDK(KP1_715457220), Tl));
+	       Ty = VADD(VMUL(LDK(KP485960359), T5), VMUL(LDK(KP1_940062506), Tr));
+	       Tz = VADD(Tx, Ty);
+	       TA = VADD(VMUL(LDK(KP1_191398608), Td), VMUL(LDK(KP1_606415062), Tj));
+	       TB = VADD(VMUL(LDK(KP293460948), T3), VMUL(LDK(KP1_978353019), Tt));
+	       TC = VADD(TA, TB);
+	       TD = VADD(Tz, TC);
+	       TE = VADD(VMUL(LDK(KP855110186), T9), VMUL(LDK(KP1_807978586), Tn));
+	       TF = VADD(VMUL(LDK(KP673779706), T7), VMUL(LDK(KP1_883088130), Tp));
+	       TG = VADD(TE, TF);
+	       TH = VADD(VMUL(LDK(KP1_343117909), Tf), VMUL(LDK(KP1_481902250), Th));
+	       TI = VADD(VMUL(LDK(KP098135348), T1), VMUL(LDK(KP1_997590912), Tv));
+	       TJ = VADD(TH, TI);
+	       TK = VADD(TG, TJ);
+	       TL = VADD(TD, TK);
+	       TM = VADD(VMUL(LDK(KP942793473), Ta), VMUL(LDK(KP1_763842528), Tm));
+	       TN = VADD(VMUL(LDK(KP580569354), T6), VMUL(LDK(KP1_913880671), Tq));
+	       TO = VADD(TM, TN);
+	       TP = VADD(VMUL(LDK(KP1_268786568), Te), VMUL(LDK(KP1_546020906), Ti));
+	       TQ = VADD(VMUL(LDK(KP196034280), T2), VMUL(LDK(KP1_990369453), Tu));
+	       TR = VADD(TP, TQ);
+	       TS = VADD(TO, TR);
+	       TT = VADD(VMUL(LDK(KP1_111140466), Tc), VMUL(LDK(KP1_662939224), Tk));
+	       TU = VADD(VMUL(LDK(KP390180644), T4), VMUL(LDK(KP1_961570560), Ts));
+	       TV = VADD(TT, TU);
+	       TW = VADD(VMUL(LDK(KP765366864), T8), VMUL(LDK(KP1_847759065), To));
+	       TX = VMUL(LDK(KP1_414213562), Tg);
+	       TY = VADD(Tw, TX);
+	       TZ = VADD(TW, TY);
+	       T10 = VADD(TV, TZ);
+	       T11 = VADD(TS, T10);
+	       STA(&(O[0]), VADD(TL, T11), ovs, &(O[0]));
+	       T12 = VSUB(TM, TN);
+	       T13 = VSUB(VMUL(LDK(KP1_546020906), Te), VMUL(LDK(KP1_268786568), Ti));
+	       T14 = VSUB(VMUL(LDK(KP1_990369453), T2), VMUL(LDK(KP196034280), Tu));
+	       T15 = VADD(T13, T14);
+	       T16 = VADD(T12, T15);
+	       T17 = VSUB(VMUL(LDK(KP1_763842528), Ta), VMUL(LDK(KP942793473), Tm));
+	       T18 = VSUB(VMUL(LDK(KP1_913880671), T6), VMUL(LDK(KP580569354), Tq));
+	       T19 = VADD(T17, T18);
+	       T1a = VSUB(TP, TQ);
+	       T1b = VADD(T19, T1a);
+	       T1c = VADD(VMUL(LDK(KP382683432), T16), VMUL(LDK(KP923879532), T1b));
+	       T1d = VSUB(VMUL(LDK(KP1_662939224), Tc), VMUL(LDK(KP1_111140466), Tk));
+	       T1e = VSUB(VMUL(LDK(KP1_961570560), T4), VMUL(LDK(KP390180644), Ts));
+	       T1f = VADD(T1d, T1e);
+	       T1g = VSUB(TT, TU);
+	       T1h = VMUL(LDK(KP707106781), VADD(T1f, T1g));
+	       T1i = VSUB(VMUL(LDK(KP1_847759065), T8), VMUL(LDK(KP765366864), To));
+	       T1j = VSUB(Tw, TX);
+	       T1k = VSUB(T1i, T1j);
+	       T1l = VADD(T1h, T1k);
+	       T1m = VADD(T1c, T1l);
+	       T1n = VSUB(Tx, Ty);
+	       T1o = VSUB(VMUL(LDK(KP1_606415062), Td), VMUL(LDK(KP1_191398608), Tj));
+	       T1p = VSUB(VMUL(LDK(KP1_978353019), T3), VMUL(LDK(KP293460948), Tt));
+	       T1q = VADD(T1o, T1p);
+	       T1r = VADD(T1n, T1q);
+	       T1s = VSUB(VMUL(LDK(KP1_715457220), Tb), VMUL(LDK(KP1_028205488), Tl));
+	       T1t = VSUB(VMUL(LDK(KP1_940062506), T5), VMUL(LDK(KP485960359), Tr));
+	       T1u = VADD(T1s, T1t);
+	       T1v = VSUB(TA, TB);
+	       T1w = VADD(T1u, T1v);
+	       T1x = VADD(VMUL(LDK(KP980785280), T1r), VMUL(LDK(KP195090322), T1w));
+	       T1y = VSUB(TE, TF);
+	       T1z = VSUB(VMUL(LDK(KP1_481902250), Tf), VMUL(LDK(KP1_343117909), Th));
+	       T1A = VSUB(VMUL(LDK(KP1_997590912), T1), VMUL(LDK(KP098135348), Tv));
+	       T1B = VADD(T1z, T1A);
+	       T1C = VADD(T1y, T1B);
+	       T1D = VSUB(VMUL(LDK(KP1_807978586), T9), VMUL(LDK(KP855110186), Tn));
+	       T1E = VSUB(VMUL(LDK(KP1_883088130), T7), VMUL(LDK(KP673779706), Tp));
+	       T1F = VADD(T1D, T1E);
+	       T1G = VSUB(TH, TI);
+	       T1H = VADD(T1F, T1G);
+	       T1I = VSUB(VMUL(LDK(KP555570233), T1C), VMUL(LDK(KP831469612), T1H));
+	       T1J = VSUB(T1x, T1I);
+	       T1K = VADD(VMUL(LDK(KP831469612), T1C), VMUL(LDK(KP555570233), T1H));
+	       T1L = VSUB(VMUL(LDK(KP195090322), T1r), VMUL(LDK(KP980785280), T1w));
+	       T1M = VSUB(T1K, T1L);
+	       T1N = VMUL(LDK(KP707106781), VADD(T1J, T1M));
+	       STA(&(O[WS(os, 1)]), VADD(T1m, T1N), ovs, &(O[0]));
+	       T1O = VSUB(T1u, T1v);
+	       T1P = VSUB(T1n, T1q);
+	       T1Q = VSUB(VMUL(LDK(KP831469612), T1O), VMUL(LDK(KP555570233), T1P));
+	       T1R = VSUB(T1F, T1G);
+	       T1S = VSUB(T1B, T1y);
+	       T1T = VADD(VMUL(LDK(KP980785280), T1R), VMUL(LDK(KP195090322), T1S));
+	       T1U = VADD(T1Q, T1T);
+	       T1V = VSUB(T12, T15);
+	       T1W = VSUB(T19, T1a);
+	       T1X = VSUB(VMUL(LDK(KP382683432), T1V), VMUL(LDK(KP923879532), T1W));
+	       T1Y = VMUL(LDK(KP707106781), VSUB(T1f, T1g));
+	       T1Z = VADD(T1i, T1j);
+	       T20 = VADD(T1Y, T1Z);
+	       T21 = VSUB(T1X, T20);
+	       STA(&(O[WS(os, 2)]), VSUB(T1U, T21), ovs, &(O[0]));
+	       T22 = VSUB(Tz, TC);
+	       T23 = VSUB(T1A, T1z);
+	       T24 = VSUB(T1D, T1E);
+	       T25 = VSUB(T23, T24);
+	       T26 = VADD(T22, T25);
+	       T27 = VSUB(T1s, T1t);
+	       T28 = VSUB(T1o, T1p);
+	       T29 = VADD(T27, T28);
+	       T2a = VSUB(TG, TJ);
+	       T2b = VSUB(T29, T2a);
+	       T2c = VSUB(VMUL(LDK(KP382683432), T26), VMUL(LDK(KP923879532), T2b));
+	       T2d = VSUB(T17, T18);
+	       T2e = VSUB(T13, T14);
+	       T2f = VADD(T2d, T2e);
+	       T2g = VSUB(TO, TR);
+	       T2h = VMUL(LDK(KP707106781), VSUB(T2f, T2g));
+	       T2i = VSUB(T1d, T1e);
+	       T2j = VSUB(TY, TW);
+	       T2k = VADD(T2i, T2j);
+	       T2l = VADD(T2h, T2k);
+	       STA(&(O[WS(os, 3)]), VSUB(T2c, T2l), ovs, &(O[0]));
+	       T2m = VSUB(T25, T22);
+	       T2n = VADD(T29, T2a);
+	       T2o = VSUB(VMUL(LDK(KP382683432), T2m), VMUL(LDK(KP923879532), T2n));
+	       T2p = VMUL(LDK(KP707106781), VADD(T2f, T2g));
+	       T2q = VSUB(T2j, T2i);
+	       T2r = VSUB(T2p, T2q);
+	       STA(&(O[WS(os, 4)]), VSUB(T2o, T2r), ovs, &(O[0]));
+	       T2s = VSUB(VMUL(LDK(KP980785280), T1S), VMUL(LDK(KP195090322), T1R));
+	       T2t = VADD(VMUL(LDK(KP831469612), T1P), VMUL(LDK(KP555570233), T1O));
+	       T2u = VSUB(T2s, T2t);
+	       T2v = VSUB(T1Q, T1T);
+	       T2w = VMUL(LDK(KP707106781), VADD(T2u, T2v));
+	       T2x = VADD(VMUL(LDK(KP923879532), T1V), VMUL(LDK(KP382683432), T1W));
+	       T2y = VSUB(T1Z, T1Y);
+	       T2z = VADD(T2x, T2y);
+	       STA(&(O[WS(os, 5)]), VSUB(T2w, T2z), ovs, &(O[0]));
+	       T2A = VADD(T1x, T1I);
+	       T2B = VSUB(VMUL(LDK(KP923879532), T16), VMUL(LDK(KP382683432), T1b));
+	       T2C = VSUB(T1h, T1k);
+	       T2D = VADD(T2B, T2C);
+	       STA(&(O[WS(os, 6)]), VADD(T2A, T2D), ovs, &(O[0]));
+	       T2E = VSUB(T2d, T2e);
+	       T2F = VSUB(TV, TZ);
+	       T2G = VADD(T2E, T2F);
+	       T2H = VSUB(TD, TK);
+	       T2I = VSUB(T27, T28);
+	       T2J = VADD(T24, T23);
+	       T2K = VADD(T2I, T2J);
+	       T2L = VMUL(LDK(KP707106781), VADD(T2H, T2K));
+	       STA(&(O[WS(os, 7)]), VADD(T2G, T2L), ovs, &(O[0]));
+	       T2M = VSUB(T2E, T2F);
+	       T2N = VMUL(LDK(KP707106781), VSUB(T2K, T2H));
+	       STA(&(O[WS(os, 8)]), VADD(T2M, T2N), ovs, &(O[0]));
+	       T2O = VADD(T1L, T1K);
+	       T2P = VSUB(T2B, T2C);
+	       STA(&(O[WS(os, 9)]), VADD(T2O, T2P), ovs, &(O[0]));
+	       T2Q = VMUL(LDK(KP707106781), VSUB(T2u, T2v));
+	       T2R = VSUB(T2x, T2y);
+	       STA(&(O[WS(os, 10)]), VSUB(T2Q, T2R), ovs, &(O[0]));
+	       T2S = VADD(VMUL(LDK(KP382683432), T2n), VMUL(LDK(KP923879532), T2m));
+	       T2T = VADD(T2p, T2q);
+	       STA(&(O[WS(os, 11)]), VSUB(T2S, T2T), ovs, &(O[0]));
+	       T2U = VADD(VMUL(LDK(KP382683432), T2b), VMUL(LDK(KP923879532), T26));
+	       T2V = VSUB(T2h, T2k);
+	       STA(&(O[WS(os, 12)]), VSUB(T2U, T2V), ovs, &(O[0]));
+	       T2W = VADD(T2t, T2s);
+	       T2X = VADD(T1X, T20);
+	       STA(&(O[WS(os, 13)]), VSUB(T2W, T2X), ovs, &(O[0]));
+	       T2Y = VSUB(T1c, T1l);
+	       T2Z = VMUL(LDK(KP707106781), VSUB(T1M, T1J));
+	       STA(&(O[WS(os, 14)]), VADD(T2Y, T2Z), ovs, &(O[0]));
+	       T30 = VSUB(TS, T10);
+	       T31 = VSUB(T2J, T2I);
+	       STA(&(O[WS(os, 15)]), VADD(T30, T31), ovs, &(O[0]));
+	       STA(&(O[WS(os, 16)]), VSUB(T31, T30), ovs, &(O[0]));
+	       STA(&(O[WS(os, 17)]), VSUB(T2Z, T2Y), ovs, &(O[0]));
+	       STA(&(O[WS(os, 18)]), VADD(T2X, T2W), ovs, &(O[0]));
+	       STA(&(O[WS(os, 19)]), VADD(T2U, T2V), ovs, &(O[0]));
+	       STA(&(O[WS(os, 20)]), VADD(T2S, T2T), ovs, &(O[0]));
+	       STA(&(O[WS(os, 21)]), VADD(T2Q, T2R), ovs, &(O[0]));
+	       STA(&(O[WS(os, 22)]), VSUB(T2O, T2P), ovs, &(O[0]));
+	       STA(&(O[WS(os, 23)]), VSUB(T2N, T2M), ovs, &(O[0]));
+	       STA(&(O[WS(os, 24)]), VSUB(T2L, T2G), ovs, &(O[0]));
+	       STA(&(O[WS(os, 25)]), VSUB(T2A, T2D), ovs, &(O[0]));
+	       STA(&(O[WS(os, 26)]), VADD(T2w, T2z), ovs, &(O[0]));
+	       STA(&(O[WS(os, 27)]), VADD(T2o, T2r), ovs, &(O[0]));
+	       STA(&(O[WS(os, 28)]), VADD(T2c, T2l), ovs, &(O[0]));
+	       STA(&(O[WS(os, 29)]), VADD(T21, T1U), ovs, &(O[0]));
+	       STA(&(O[WS(os, 30)]), VSUB(T1N, T1m), ovs, &(O[0]));
+	       STA(&(O[WS(os, 31)]), VSUB(TL, T11), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 32, XSIMD_STRING("o01v_32"), {186, 103, 0, 0}, &GENUS, RODFT01 };
+
+void XSIMD(codelet_o01v_32) (planner *p) {
+     X(kr2r_register) (p, o01v_32, &desc);
+}
+
+#endif
@@ -0,0 +1,1336 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o01v_64 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft01 -n 64 -name o01_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 476 FP additions, 270 FP multiplications,
+ * (or, 320 additions, 114 multiplications, 156 fused multiply/add),
+ * 436 stack variables, 78 constants, and 128 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o01v_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DVK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DVK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DVK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DVK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DVK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DVK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DVK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DVK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DVK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DVK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DVK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DVK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DVK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DVK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DVK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DVK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DVK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DVK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DVK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DVK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DVK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DVK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DVK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DVK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DVK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DVK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DVK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DVK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DVK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DVK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DVK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DVK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DVK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DVK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DVK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DVK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DVK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DVK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       V T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       V T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       V T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       V T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       V T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       V T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       V T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       V T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       V T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       V T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       V T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       V T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       V T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       V T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       V T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       V T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       V T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       V T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       V T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       V T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       V T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       V T6Z, T70, T71, T72;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = LDA(&(I[WS(is, 32)]), ivs, &(I[0]));
+	       Ty = LDA(&(I[WS(is, 33)]), ivs, &(I[0]));
+	       Tz = LDA(&(I[WS(is, 34)]), ivs, &(I[0]));
+	       TA = LDA(&(I[WS(is, 35)]), ivs, &(I[0]));
+	       TB = LDA(&(I[WS(is, 36)]), ivs, &(I[0]));
+	       TC = LDA(&(I[WS(is, 37)]), ivs, &(I[0]));
+	       TD = LDA(&(I[WS(is, 38)]), ivs, &(I[0]));
+	       TE = LDA(&(I[WS(is, 39)]), ivs, &(I[0]));
+	       TF = LDA(&(I[WS(is, 40)]), ivs, &(I[0]));
+	       TG = LDA(&(I[WS(is, 41)]), ivs, &(I[0]));
+	       TH = LDA(&(I[WS(is, 42)]), ivs, &(I[0]));
+	       TI = LDA(&(I[WS(is, 43)]), ivs, &(I[0]));
+	       TJ = LDA(&(I[WS(is, 44)]), ivs, &(I[0]));
+	       TK = LDA(&(I[WS(is, 45)]), ivs, &(I[0]));
+	       TL = LDA(&(I[WS(is, 46)]), ivs, &(I[0]));
+	       TM = LDA(&(I[WS(is, 47)]), ivs, &(I[0]));
+	       TN = LDA(&(I[WS(is, 48)]), ivs, &(I[0]));
+	       TO = LDA(&(I[WS(is, 49)]), ivs, &(I[0]));
+	       TP = LDA(&(I[WS(is, 50)]), ivs, &(I[0]));
+	       TQ = LDA(&(I[WS(is, 51)]), ivs, &(I[0]));
+	       TR = LDA(&(I[WS(is, 52)]), ivs, &(I[0]));
+	       TS = LDA(&(I[WS(is, 53)]), ivs, &(I[0]));
+	       TT = LDA(&(I[WS(is, 54)]), ivs, &(I[0]));
+	       TU = LDA(&(I[WS(is, 55)]), ivs, &(I[0]));
+	       TV = LDA(&(I[WS(is, 56)]), ivs, &(I[0]));
+	       TW = LDA(&(I[WS(is, 57)]), ivs, &(I[0]));
+	       TX = LDA(&(I[WS(is, 58)]), ivs, &(I[0]));
+	       TY = LDA(&(I[WS(is, 59)]), ivs, &(I[0]));
+	       TZ = LDA(&(I[WS(is, 60)]), ivs, &(I[0]));
+	       T10 = LDA(&(I[WS(is, 61)]), ivs, &(I[0]));
+	       T11 = LDA(&(I[WS(is, 62)]), ivs, &(I[0]));
+	       T12 = LDA(&(I[WS(is, 63)]), ivs, &(I[0]));
+	       T13 = VFMA(LDK(KP985796384), Tl, VMUL(LDK(KP1_740173982), TH));
+	       T14 = VFMA(LDK(KP533425514), Tb, VMUL(LDK(KP1_927552131), TR));
+	       T15 = VADD(T13, T14);
+	       T16 = VFMA(LDK(KP1_230463181), Tr, VMUL(LDK(KP1_576692855), TB));
+	       T17 = VFMA(LDK(KP244821350), T5, VMUL(LDK(KP1_984959069), TX));
+	       T18 = VADD(T16, T17);
+	       T19 = VADD(T15, T18);
+	       T1a = VFMA(LDK(KP899222659), Tj, VMUL(LDK(KP1_786448602), TJ));
+	       T1b = VFMA(LDK(KP627363480), Td, VMUL(LDK(KP1_899056361), TP));
+	       T1c = VADD(T1a, T1b);
+	       T1d = VFMA(LDK(KP1_306345685), Tt, VMUL(LDK(KP1_514417693), Tz));
+	       T1e = VFMA(LDK(KP147129127), T3, VMUL(LDK(KP1_994580913), TZ));
+	       T1f = VADD(T1d, T1e);
+	       T1g = VADD(T1c, T1f);
+	       T1h = VADD(T19, T1g);
+	       T1i = VFMA(LDK(KP1_069995239), Tn, VMUL(LDK(KP1_689707130), TF));
+	       T1j = VFMA(LDK(KP438202480), T9, VMUL(LDK(KP1_951404260), TT));
+	       T1k = VADD(T1i, T1j);
+	       T1l = VFMA(LDK(KP1_151616382), Tp, VMUL(LDK(KP1_635169626), TD));
+	       T1m = VFMA(LDK(KP341923777), T7, VMUL(LDK(KP1_970555284), TV));
+	       T1n = VADD(T1l, T1m);
+	       T1o = VADD(T1k, T1n);
+	       T1p = VFMA(LDK(KP810482628), Th, VMUL(LDK(KP1_828419511), TL));
+	       T1q = VFMA(LDK(KP719790073), Tf, VMUL(LDK(KP1_865985597), TN));
+	       T1r = VADD(T1p, T1q);
+	       T1s = VFMA(LDK(KP1_379081089), Tv, VMUL(LDK(KP1_448494165), Tx));
+	       T1t = VFMA(LDK(KP049082457), T1, VMUL(LDK(KP1_999397637), T11));
+	       T1u = VADD(T1s, T1t);
+	       T1v = VADD(T1r, T1u);
+	       T1w = VADD(T1o, T1v);
+	       T1x = VADD(T1h, T1w);
+	       T1y = VFMA(LDK(KP1_028205488), Tm, VMUL(LDK(KP1_715457220), TG));
+	       T1z = VFMA(LDK(KP485960359), Ta, VMUL(LDK(KP1_940062506), TS));
+	       T1A = VADD(T1y, T1z);
+	       T1B = VFMA(LDK(KP1_191398608), Tq, VMUL(LDK(KP1_606415062), TC));
+	       T1C = VFMA(LDK(KP293460948), T6, VMUL(LDK(KP1_978353019), TW));
+	       T1D = VADD(T1B, T1C);
+	       T1E = VADD(T1A, T1D);
+	       T1F = VFMA(LDK(KP855110186), Ti, VMUL(LDK(KP1_807978586), TK));
+	       T1G = VFMA(LDK(KP673779706), Te, VMUL(LDK(KP1_883088130), TO));
+	       T1H = VADD(T1F, T1G);
+	       T1I = VFMA(LDK(KP1_343117909), Tu, VMUL(LDK(KP1_481902250), Ty));
+	       T1J = VFMA(LDK(KP098135348), T2, VMUL(LDK(KP1_997590912), T10));
+	       T1K = VADD(T1I, T1J);
+	       T1L = VADD(T1H, T1K);
+	       T1M = VADD(T1E, T1L);
+	       T1N = VFMA(LDK(KP942793473), Tk, VMUL(LDK(KP1_763842528), TI));
+	       T1O = VFMA(LDK(KP580569354), Tc, VMUL(LDK(KP1_913880671), TQ));
+	       T1P = VADD(T1N, T1O);
+	       T1Q = VFMA(LDK(KP1_268786568), Ts, VMUL(LDK(KP1_546020906), TA));
+	       T1R = VFMA(LDK(KP196034280), T4, VMUL(LDK(KP1_990369453), TY));
+	       T1S = VADD(T1Q, T1R);
+	       T1T = VADD(T1P, T1S);
+	       T1U = VFMA(LDK(KP1_111140466), To, VMUL(LDK(KP1_662939224), TE));
+	       T1V = VFMA(LDK(KP390180644), T8, VMUL(LDK(KP1_961570560), TU));
+	       T1W = VADD(T1U, T1V);
+	       T1X = VFMA(LDK(KP765366864), Tg, VMUL(LDK(KP1_847759065), TM));
+	       T1Y = VFMA(LDK(KP1_414213562), Tw, T12);
+	       T1Z = VADD(T1X, T1Y);
+	       T20 = VADD(T1W, T1Z);
+	       T21 = VADD(T1T, T20);
+	       T22 = VADD(T1M, T21);
+	       STA(&(O[0]), VADD(T1x, T22), ovs, &(O[0]));
+	       T23 = VFMS(LDK(KP1_740173982), Tl, VMUL(LDK(KP985796384), TH));
+	       T24 = VFMS(LDK(KP1_927552131), Tb, VMUL(LDK(KP533425514), TR));
+	       T25 = VADD(T23, T24);
+	       T26 = VSUB(T16, T17);
+	       T27 = VADD(T25, T26);
+	       T28 = VSUB(T13, T14);
+	       T29 = VFMS(LDK(KP1_576692855), Tr, VMUL(LDK(KP1_230463181), TB));
+	       T2a = VFMS(LDK(KP1_984959069), T5, VMUL(LDK(KP244821350), TX));
+	       T2b = VADD(T29, T2a);
+	       T2c = VADD(T28, T2b);
+	       T2d = VFMS(LDK(KP995184726), T2c, VMUL(LDK(KP098017140), T27));
+	       T2e = VFMS(LDK(KP1_786448602), Tj, VMUL(LDK(KP899222659), TJ));
+	       T2f = VFMS(LDK(KP1_899056361), Td, VMUL(LDK(KP627363480), TP));
+	       T2g = VADD(T2e, T2f);
+	       T2h = VSUB(T1d, T1e);
+	       T2i = VADD(T2g, T2h);
+	       T2j = VSUB(T1a, T1b);
+	       T2k = VFMS(LDK(KP1_514417693), Tt, VMUL(LDK(KP1_306345685), Tz));
+	       T2l = VFMS(LDK(KP1_994580913), T3, VMUL(LDK(KP147129127), TZ));
+	       T2m = VADD(T2k, T2l);
+	       T2n = VADD(T2j, T2m);
+	       T2o = VFMS(LDK(KP773010453), T2n, VMUL(LDK(KP634393284), T2i));
+	       T2p = VSUB(T2d, T2o);
+	       T2q = VFMS(LDK(KP1_828419511), Th, VMUL(LDK(KP810482628), TL));
+	       T2r = VFMS(LDK(KP1_865985597), Tf, VMUL(LDK(KP719790073), TN));
+	       T2s = VADD(T2q, T2r);
+	       T2t = VSUB(T1s, T1t);
+	       T2u = VADD(T2s, T2t);
+	       T2v = VSUB(T1p, T1q);
+	       T2w = VFMS(LDK(KP1_448494165), Tv, VMUL(LDK(KP1_379081089), Tx));
+	       T2x = VFMS(LDK(KP1_999397637), T1, VMUL(LDK(KP049082457), T11));
+	       T2y = VADD(T2w, T2x);
+	       T2z = VADD(T2v, T2y);
+	       T2A = VFMA(LDK(KP956940335), T2z, VMUL(LDK(KP290284677), T2u));
+	       T2B = VFMS(LDK(KP1_689707130), Tn, VMUL(LDK(KP1_069995239), TF));
+	       T2C = VFMS(LDK(KP1_951404260), T9, VMUL(LDK(KP438202480), TT));
+	       T2D = VADD(T2B, T2C);
+	       T2E = VSUB(T1l, T1m);
+	       T2F = VADD(T2D, T2E);
+	       T2G = VSUB(T1i, T1j);
+	       T2H = VFMS(LDK(KP1_635169626), Tp, VMUL(LDK(KP1_151616382), TD));
+	       T2I = VFMS(LDK(KP1_970555284), T7, VMUL(LDK(KP341923777), TV));
+	       T2J = VADD(T2H, T2I);
+	       T2K = VADD(T2G, T2J);
+	       T2L = VFMS(LDK(KP471396736), T2K, VMUL(LDK(KP881921264), T2F));
+	       T2M = VSUB(T2A, T2L);
+	       T2N = VADD(T2p, T2M);
+	       T2O = VFMA(LDK(KP098017140), T2c, VMUL(LDK(KP995184726), T27));
+	       T2P = VFMA(LDK(KP634393284), T2n, VMUL(LDK(KP773010453), T2i));
+	       T2Q = VADD(T2O, T2P);
+	       T2R = VFMA(LDK(KP881921264), T2K, VMUL(LDK(KP471396736), T2F));
+	       T2S = VFMS(LDK(KP290284677), T2z, VMUL(LDK(KP956940335), T2u));
+	       T2T = VSUB(T2R, T2S);
+	       T2U = VADD(T2Q, T2T);
+	       T2V = VFMA(LDK(KP923879532), T2U, VMUL(LDK(KP382683432), T2N));
+	       T2W = VFMS(LDK(KP1_763842528), Tk, VMUL(LDK(KP942793473), TI));
+	       T2X = VFMS(LDK(KP1_913880671), Tc, VMUL(LDK(KP580569354), TQ));
+	       T2Y = VADD(T2W, T2X);
+	       T2Z = VSUB(T1Q, T1R);
+	       T30 = VADD(T2Y, T2Z);
+	       T31 = VSUB(T1N, T1O);
+	       T32 = VFMS(LDK(KP1_546020906), Ts, VMUL(LDK(KP1_268786568), TA));
+	       T33 = VFMS(LDK(KP1_990369453), T4, VMUL(LDK(KP196034280), TY));
+	       T34 = VADD(T32, T33);
+	       T35 = VADD(T31, T34);
+	       T36 = VFMA(LDK(KP382683432), T35, VMUL(LDK(KP923879532), T30));
+	       T37 = VFMS(LDK(KP1_847759065), Tg, VMUL(LDK(KP765366864), TM));
+	       T38 = VFNMS(LDK(KP1_414213562), Tw, T12);
+	       T39 = VSUB(T37, T38);
+	       T3a = VFMS(LDK(KP1_662939224), To, VMUL(LDK(KP1_111140466), TE));
+	       T3b = VFMS(LDK(KP1_961570560), T8, VMUL(LDK(KP390180644), TU));
+	       T3c = VADD(T3a, T3b);
+	       T3d = VSUB(T1U, T1V);
+	       T3e = VFMA(LDK(KP707106781), VADD(T3c, T3d), T39);
+	       T3f = VADD(T36, T3e);
+	       T3g = VFMS(LDK(KP1_715457220), Tm, VMUL(LDK(KP1_028205488), TG));
+	       T3h = VFMS(LDK(KP1_940062506), Ta, VMUL(LDK(KP485960359), TS));
+	       T3i = VADD(T3g, T3h);
+	       T3j = VSUB(T1B, T1C);
+	       T3k = VADD(T3i, T3j);
+	       T3l = VSUB(T1y, T1z);
+	       T3m = VFMS(LDK(KP1_606415062), Tq, VMUL(LDK(KP1_191398608), TC));
+	       T3n = VFMS(LDK(KP1_978353019), T6, VMUL(LDK(KP293460948), TW));
+	       T3o = VADD(T3m, T3n);
+	       T3p = VADD(T3l, T3o);
+	       T3q = VFMS(LDK(KP195090322), T3p, VMUL(LDK(KP980785280), T3k));
+	       T3r = VFMS(LDK(KP1_807978586), Ti, VMUL(LDK(KP855110186), TK));
+	       T3s = VFMS(LDK(KP1_883088130), Te, VMUL(LDK(KP673779706), TO));
+	       T3t = VADD(T3r, T3s);
+	       T3u = VSUB(T1I, T1J);
+	       T3v = VADD(T3t, T3u);
+	       T3w = VSUB(T1F, T1G);
+	       T3x = VFMS(LDK(KP1_481902250), Tu, VMUL(LDK(KP1_343117909), Ty));
+	       T3y = VFMS(LDK(KP1_997590912), T2, VMUL(LDK(KP098135348), T10));
+	       T3z = VADD(T3x, T3y);
+	       T3A = VADD(T3w, T3z);
+	       T3B = VFMA(LDK(KP831469612), T3A, VMUL(LDK(KP555570233), T3v));
+	       T3C = VSUB(T3q, T3B);
+	       T3D = VFMS(LDK(KP555570233), T3A, VMUL(LDK(KP831469612), T3v));
+	       T3E = VFMA(LDK(KP980785280), T3p, VMUL(LDK(KP195090322), T3k));
+	       T3F = VSUB(T3D, T3E);
+	       T3G = VFMS(LDK(KP707106781), VADD(T3C, T3F), T3f);
+	       STA(&(O[WS(os, 1)]), VSUB(T2V, T3G), ovs, &(O[0]));
+	       T3H = VSUB(T2y, T2v);
+	       T3I = VSUB(T2s, T2t);
+	       T3J = VFMA(LDK(KP995184726), T3I, VMUL(LDK(KP098017140), T3H));
+	       T3K = VSUB(T2D, T2E);
+	       T3L = VSUB(T2G, T2J);
+	       T3M = VFMS(LDK(KP634393284), T3L, VMUL(LDK(KP773010453), T3K));
+	       T3N = VSUB(T3J, T3M);
+	       T3O = VSUB(T25, T26);
+	       T3P = VSUB(T28, T2b);
+	       T3Q = VFMS(LDK(KP471396736), T3P, VMUL(LDK(KP881921264), T3O));
+	       T3R = VSUB(T2g, T2h);
+	       T3S = VSUB(T2j, T2m);
+	       T3T = VFMS(LDK(KP290284677), T3S, VMUL(LDK(KP956940335), T3R));
+	       T3U = VADD(T3Q, T3T);
+	       T3V = VSUB(T3N, T3U);
+	       T3W = VSUB(T3i, T3j);
+	       T3X = VSUB(T3l, T3o);
+	       T3Y = VFMS(LDK(KP555570233), T3X, VMUL(LDK(KP831469612), T3W));
+	       T3Z = VSUB(T3t, T3u);
+	       T40 = VSUB(T3w, T3z);
+	       T41 = VFMS(LDK(KP195090322), T40, VMUL(LDK(KP980785280), T3Z));
+	       T42 = VADD(T3Y, T41);
+	       T43 = VSUB(T2Y, T2Z);
+	       T44 = VSUB(T31, T34);
+	       T45 = VFMS(LDK(KP382683432), T44, VMUL(LDK(KP923879532), T43));
+	       T46 = VADD(T37, T38);
+	       T47 = VFMA(LDK(KP707106781), VSUB(T3c, T3d), T46);
+	       T48 = VSUB(T45, T47);
+	       T49 = VADD(T42, T48);
+	       STA(&(O[WS(os, 2)]), VSUB(T3V, T49), ovs, &(O[0]));
+	       T4a = VSUB(T3g, T3h);
+	       T4b = VSUB(T3m, T3n);
+	       T4c = VADD(T4a, T4b);
+	       T4d = VSUB(T1H, T1K);
+	       T4e = VSUB(T4c, T4d);
+	       T4f = VSUB(T1A, T1D);
+	       T4g = VSUB(T3r, T3s);
+	       T4h = VSUB(T3x, T3y);
+	       T4i = VADD(T4g, T4h);
+	       T4j = VSUB(T4f, T4i);
+	       T4k = VFMS(LDK(KP382683432), T4j, VMUL(LDK(KP923879532), T4e));
+	       T4l = VSUB(T3a, T3b);
+	       T4m = VSUB(T1X, T1Y);
+	       T4n = VSUB(T4l, T4m);
+	       T4o = VSUB(T2W, T2X);
+	       T4p = VSUB(T32, T33);
+	       T4q = VADD(T4o, T4p);
+	       T4r = VSUB(T1P, T1S);
+	       T4s = VFMA(LDK(KP707106781), VSUB(T4q, T4r), T4n);
+	       T4t = VSUB(T4k, T4s);
+	       T4u = VSUB(T2B, T2C);
+	       T4v = VSUB(T2H, T2I);
+	       T4w = VADD(T4u, T4v);
+	       T4x = VSUB(T1u, T1r);
+	       T4y = VADD(T4w, T4x);
+	       T4z = VSUB(T2x, T2w);
+	       T4A = VSUB(T2q, T2r);
+	       T4B = VSUB(T4z, T4A);
+	       T4C = VSUB(T1n, T1k);
+	       T4D = VSUB(T4B, T4C);
+	       T4E = VFMS(LDK(KP831469612), T4D, VMUL(LDK(KP555570233), T4y));
+	       T4F = VSUB(T23, T24);
+	       T4G = VSUB(T29, T2a);
+	       T4H = VADD(T4F, T4G);
+	       T4I = VSUB(T1c, T1f);
+	       T4J = VSUB(T4H, T4I);
+	       T4K = VSUB(T15, T18);
+	       T4L = VSUB(T2e, T2f);
+	       T4M = VSUB(T2k, T2l);
+	       T4N = VADD(T4L, T4M);
+	       T4O = VSUB(T4K, T4N);
+	       T4P = VFMA(LDK(KP195090322), T4O, VMUL(LDK(KP980785280), T4J));
+	       T4Q = VSUB(T4E, T4P);
+	       T4R = VFMS(LDK(KP980785280), T4O, VMUL(LDK(KP195090322), T4J));
+	       T4S = VFMA(LDK(KP555570233), T4D, VMUL(LDK(KP831469612), T4y));
+	       T4T = VSUB(T4R, T4S);
+	       STA(&(O[WS(os, 3)]), VFMA(LDK(KP707106781), VADD(T4Q, T4T), T4t), ovs, &(O[0]));
+	       T4U = VSUB(T4x, T4w);
+	       T4V = VADD(T4C, T4B);
+	       T4W = VFMA(LDK(KP195090322), T4V, VMUL(LDK(KP980785280), T4U));
+	       T4X = VADD(T4H, T4I);
+	       T4Y = VADD(T4K, T4N);
+	       T4Z = VFMA(LDK(KP555570233), T4Y, VMUL(LDK(KP831469612), T4X));
+	       T50 = VSUB(T4W, T4Z);
+	       T51 = VADD(T4c, T4d);
+	       T52 = VADD(T4f, T4i);
+	       T53 = VFMA(LDK(KP382683432), T52, VMUL(LDK(KP923879532), T51));
+	       T54 = VADD(T4l, T4m);
+	       T55 = VFMA(LDK(KP707106781), VADD(T4q, T4r), T54);
+	       T56 = VADD(T53, T55);
+	       STA(&(O[WS(os, 4)]), VSUB(T50, T56), ovs, &(O[0]));
+	       T57 = VFMA(LDK(KP881921264), T3P, VMUL(LDK(KP471396736), T3O));
+	       T58 = VFMA(LDK(KP956940335), T3S, VMUL(LDK(KP290284677), T3R));
+	       T59 = VADD(T57, T58);
+	       T5a = VADD(T3M, T3J);
+	       T5b = VADD(T59, T5a);
+	       T5c = VSUB(T3T, T3Q);
+	       T5d = VFMS(LDK(KP995184726), T3H, VMUL(LDK(KP098017140), T3I));
+	       T5e = VFMA(LDK(KP773010453), T3L, VMUL(LDK(KP634393284), T3K));
+	       T5f = VSUB(T5d, T5e);
+	       T5g = VADD(T5c, T5f);
+	       T5h = VFMS(LDK(KP382683432), T5g, VMUL(LDK(KP923879532), T5b));
+	       T5i = VFMS(LDK(KP707106781), VSUB(T3c, T3d), T46);
+	       T5j = VFMA(LDK(KP923879532), T44, VMUL(LDK(KP382683432), T43));
+	       T5k = VSUB(T5i, T5j);
+	       T5l = VFMA(LDK(KP831469612), T3X, VMUL(LDK(KP555570233), T3W));
+	       T5m = VFMA(LDK(KP980785280), T40, VMUL(LDK(KP195090322), T3Z));
+	       T5n = VADD(T5l, T5m);
+	       T5o = VSUB(T3Y, T41);
+	       T5p = VFNMS(LDK(KP707106781), VADD(T5n, T5o), T5k);
+	       STA(&(O[WS(os, 5)]), VADD(T5h, T5p), ovs, &(O[0]));
+	       T5q = VADD(T2d, T2o);
+	       T5r = VADD(T2R, T2S);
+	       T5s = VADD(T5q, T5r);
+	       T5t = VADD(T3E, T3D);
+	       T5u = VFMS(LDK(KP923879532), T35, VMUL(LDK(KP382683432), T30));
+	       T5v = VFMS(LDK(KP707106781), VADD(T3c, T3d), T39);
+	       T5w = VADD(T5u, T5v);
+	       T5x = VADD(T5t, T5w);
+	       STA(&(O[WS(os, 6)]), VADD(T5s, T5x), ovs, &(O[0]));
+	       T5y = VSUB(T4o, T4p);
+	       T5z = VSUB(T1W, T1Z);
+	       T5A = VADD(T5y, T5z);
+	       T5B = VSUB(T4a, T4b);
+	       T5C = VSUB(T4g, T4h);
+	       T5D = VADD(T5B, T5C);
+	       T5E = VSUB(T1E, T1L);
+	       T5F = VFMA(LDK(KP707106781), VADD(T5D, T5E), T5A);
+	       T5G = VSUB(T19, T1g);
+	       T5H = VSUB(T4u, T4v);
+	       T5I = VADD(T4A, T4z);
+	       T5J = VADD(T5H, T5I);
+	       T5K = VADD(T5G, T5J);
+	       T5L = VSUB(T4F, T4G);
+	       T5M = VSUB(T4L, T4M);
+	       T5N = VADD(T5L, T5M);
+	       T5O = VSUB(T1o, T1v);
+	       T5P = VADD(T5N, T5O);
+	       T5Q = VFMA(LDK(KP923879532), T5P, VMUL(LDK(KP382683432), T5K));
+	       STA(&(O[WS(os, 7)]), VADD(T5F, T5Q), ovs, &(O[0]));
+	       T5R = VSUB(T5y, T5z);
+	       T5S = VFMA(LDK(KP707106781), VSUB(T5D, T5E), T5R);
+	       T5T = VSUB(T5J, T5G);
+	       T5U = VSUB(T5N, T5O);
+	       T5V = VFMA(LDK(KP923879532), T5U, VMUL(LDK(KP382683432), T5T));
+	       STA(&(O[WS(os, 8)]), VADD(T5S, T5V), ovs, &(O[0]));
+	       T5W = VADD(T3q, T3B);
+	       T5X = VSUB(T5u, T5v);
+	       T5Y = VADD(T5W, T5X);
+	       T5Z = VSUB(T5q, T5r);
+	       T60 = VADD(T2L, T2A);
+	       T61 = VSUB(T2O, T2P);
+	       T62 = VSUB(T60, T61);
+	       STA(&(O[WS(os, 9)]), VFMA(LDK(KP707106781), VADD(T5Z, T62), T5Y), ovs, &(O[0]));
+	       T63 = VSUB(T59, T5a);
+	       T64 = VSUB(T5f, T5c);
+	       T65 = VFMS(LDK(KP382683432), T64, VMUL(LDK(KP923879532), T63));
+	       T66 = VADD(T5j, T5i);
+	       T67 = VFMA(LDK(KP707106781), VSUB(T5n, T5o), T66);
+	       STA(&(O[WS(os, 10)]), VSUB(T65, T67), ovs, &(O[0]));
+	       T68 = VFNMS(LDK(KP707106781), VADD(T4q, T4r), T54);
+	       T69 = VFMS(LDK(KP923879532), T52, VMUL(LDK(KP382683432), T51));
+	       T6a = VSUB(T68, T69);
+	       T6b = VFMS(LDK(KP555570233), T4X, VMUL(LDK(KP831469612), T4Y));
+	       T6c = VFMS(LDK(KP980785280), T4V, VMUL(LDK(KP195090322), T4U));
+	       T6d = VADD(T6b, T6c);
+	       T6e = VADD(T4Z, T4W);
+	       STA(&(O[WS(os, 11)]), VFMA(LDK(KP707106781), VSUB(T6d, T6e), T6a), ovs, &(O[0]));
+	       T6f = VFMA(LDK(KP923879532), T4j, VMUL(LDK(KP382683432), T4e));
+	       T6g = VFMS(LDK(KP707106781), VSUB(T4q, T4r), T4n);
+	       T6h = VSUB(T6f, T6g);
+	       T6i = VADD(T4R, T4S);
+	       STA(&(O[WS(os, 12)]), VADD(T6h, T6i), ovs, &(O[0]));
+	       T6j = VSUB(T5l, T5m);
+	       T6k = VADD(T45, T47);
+	       T6l = VSUB(T6j, T6k);
+	       T6m = VSUB(T57, T58);
+	       T6n = VADD(T5e, T5d);
+	       T6o = VADD(T6m, T6n);
+	       T6p = VADD(T3U, T3N);
+	       STA(&(O[WS(os, 13)]), VFMA(LDK(KP707106781), VSUB(T6o, T6p), T6l), ovs, &(O[0]));
+	       T6q = VSUB(T2M, T2p);
+	       T6r = VSUB(T2Q, T2T);
+	       T6s = VFMA(LDK(KP923879532), T6r, VMUL(LDK(KP382683432), T6q));
+	       T6t = VSUB(T36, T3e);
+	       T6u = VFMA(LDK(KP707106781), VSUB(T3F, T3C), T6t);
+	       STA(&(O[WS(os, 14)]), VADD(T6s, T6u), ovs, &(O[0]));
+	       T6v = VSUB(T5B, T5C);
+	       T6w = VSUB(T1T, T20);
+	       T6x = VSUB(T6v, T6w);
+	       T6y = VSUB(T1h, T1w);
+	       T6z = VSUB(T5I, T5H);
+	       T6A = VSUB(T5L, T5M);
+	       T6B = VSUB(T6z, T6A);
+	       STA(&(O[WS(os, 15)]), VFMS(LDK(KP707106781), VADD(T6y, T6B), T6x), ovs, &(O[0]));
+	       T6C = VADD(T6v, T6w);
+	       STA(&(O[WS(os, 16)]), VFMS(LDK(KP707106781), VSUB(T6B, T6y), T6C), ovs, &(O[0]));
+	       T6D = VFMS(LDK(KP923879532), T6q, VMUL(LDK(KP382683432), T6r));
+	       T6E = VFNMS(LDK(KP707106781), VSUB(T3F, T3C), T6t);
+	       STA(&(O[WS(os, 17)]), VSUB(T6D, T6E), ovs, &(O[0]));
+	       T6F = VADD(T6j, T6k);
+	       STA(&(O[WS(os, 18)]), VFMA(LDK(KP707106781), VADD(T6o, T6p), T6F), ovs, &(O[0]));
+	       T6G = VADD(T6f, T6g);
+	       T6H = VADD(T4P, T4E);
+	       STA(&(O[WS(os, 19)]), VADD(T6G, T6H), ovs, &(O[0]));
+	       T6I = VADD(T69, T68);
+	       STA(&(O[WS(os, 20)]), VFMS(LDK(KP707106781), VADD(T6d, T6e), T6I), ovs, &(O[0]));
+	       T6J = VFMA(LDK(KP923879532), T64, VMUL(LDK(KP382683432), T63));
+	       T6K = VFMS(LDK(KP707106781), VSUB(T5n, T5o), T66);
+	       STA(&(O[WS(os, 21)]), VSUB(T6J, T6K), ovs, &(O[0]));
+	       T6L = VSUB(T5X, T5W);
+	       STA(&(O[WS(os, 22)]), VFMS(LDK(KP707106781), VSUB(T62, T5Z), T6L), ovs, &(O[0]));
+	       T6M = VFMS(LDK(KP707106781), VSUB(T5D, T5E), T5R);
+	       T6N = VFMS(LDK(KP923879532), T5T, VMUL(LDK(KP382683432), T5U));
+	       STA(&(O[WS(os, 23)]), VADD(T6M, T6N), ovs, &(O[0]));
+	       T6O = VFMS(LDK(KP707106781), VADD(T5D, T5E), T5A);
+	       T6P = VFMS(LDK(KP923879532), T5K, VMUL(LDK(KP382683432), T5P));
+	       STA(&(O[WS(os, 24)]), VADD(T6O, T6P), ovs, &(O[0]));
+	       T6Q = VADD(T61, T60);
+	       T6R = VSUB(T5t, T5w);
+	       STA(&(O[WS(os, 25)]), VADD(T6Q, T6R), ovs, &(O[0]));
+	       T6S = VFMA(LDK(KP923879532), T5g, VMUL(LDK(KP382683432), T5b));
+	       T6T = VFMA(LDK(KP707106781), VADD(T5n, T5o), T5k);
+	       STA(&(O[WS(os, 26)]), VSUB(T6S, T6T), ovs, &(O[0]));
+	       T6U = VSUB(T6c, T6b);
+	       T6V = VSUB(T53, T55);
+	       STA(&(O[WS(os, 27)]), VSUB(T6U, T6V), ovs, &(O[0]));
+	       T6W = VADD(T4k, T4s);
+	       STA(&(O[WS(os, 28)]), VFMA(LDK(KP707106781), VSUB(T4Q, T4T), T6W), ovs, &(O[0]));
+	       T6X = VSUB(T6n, T6m);
+	       T6Y = VSUB(T42, T48);
+	       STA(&(O[WS(os, 29)]), VSUB(T6X, T6Y), ovs, &(O[0]));
+	       T6Z = VFMS(LDK(KP923879532), T2N, VMUL(LDK(KP382683432), T2U));
+	       T70 = VFMA(LDK(KP707106781), VADD(T3C, T3F), T3f);
+	       STA(&(O[WS(os, 30)]), VSUB(T6Z, T70), ovs, &(O[0]));
+	       T71 = VSUB(T1M, T21);
+	       T72 = VADD(T6A, T6z);
+	       STA(&(O[WS(os, 31)]), VADD(T71, T72), ovs, &(O[0]));
+	       STA(&(O[WS(os, 32)]), VSUB(T72, T71), ovs, &(O[0]));
+	       STA(&(O[WS(os, 33)]), VADD(T6Z, T70), ovs, &(O[0]));
+	       STA(&(O[WS(os, 34)]), VADD(T6Y, T6X), ovs, &(O[0]));
+	       STA(&(O[WS(os, 35)]), VFMS(LDK(KP707106781), VSUB(T4Q, T4T), T6W), ovs, &(O[0]));
+	       STA(&(O[WS(os, 36)]), VADD(T6V, T6U), ovs, &(O[0]));
+	       STA(&(O[WS(os, 37)]), VADD(T6S, T6T), ovs, &(O[0]));
+	       STA(&(O[WS(os, 38)]), VSUB(T6Q, T6R), ovs, &(O[0]));
+	       STA(&(O[WS(os, 39)]), VSUB(T6P, T6O), ovs, &(O[0]));
+	       STA(&(O[WS(os, 40)]), VSUB(T6N, T6M), ovs, &(O[0]));
+	       STA(&(O[WS(os, 41)]), VFMA(LDK(KP707106781), VSUB(T62, T5Z), T6L), ovs, &(O[0]));
+	       STA(&(O[WS(os, 42)]), VADD(T6K, T6J), ovs, &(O[0]));
+	       STA(&(O[WS(os, 43)]), VFMA(LDK(KP707106781), VADD(T6d, T6e), T6I), ovs, &(O[0]));
+	       STA(&(O[WS(os, 44)]), VSUB(T6H, T6G), ovs, &(O[0]));
+	       STA(&(O[WS(os, 45)]), VFMS(LDK(KP707106781), VADD(T6o, T6p), T6F), ovs, &(O[0]));
+	       STA(&(O[WS(os, 46)]), VADD(T6D, T6E), ovs, &(O[0]));
+	       STA(&(O[WS(os, 47)]), VFMA(LDK(KP707106781), VSUB(T6B, T6y), T6C), ovs, &(O[0]));
+	       STA(&(O[WS(os, 48)]), VFMA(LDK(KP707106781), VADD(T6y, T6B), T6x), ovs, &(O[0]));
+	       STA(&(O[WS(os, 49)]), VSUB(T6s, T6u), ovs, &(O[0]));
+	       STA(&(O[WS(os, 50)]), VFMS(LDK(KP707106781), VSUB(T6o, T6p), T6l), ovs, &(O[0]));
+	       STA(&(O[WS(os, 51)]), VSUB(T6i, T6h), ovs, &(O[0]));
+	       STA(&(O[WS(os, 52)]), VFMS(LDK(KP707106781), VSUB(T6d, T6e), T6a), ovs, &(O[0]));
+	       STA(&(O[WS(os, 53)]), VADD(T67, T65), ovs, &(O[0]));
+	       STA(&(O[WS(os, 54)]), VFMS(LDK(KP707106781), VADD(T5Z, T62), T5Y), ovs, &(O[0]));
+	       STA(&(O[WS(os, 55)]), VSUB(T5V, T5S), ovs, &(O[0]));
+	       STA(&(O[WS(os, 56)]), VSUB(T5Q, T5F), ovs, &(O[0]));
+	       STA(&(O[WS(os, 57)]), VSUB(T5s, T5x), ovs, &(O[0]));
+	       STA(&(O[WS(os, 58)]), VSUB(T5h, T5p), ovs, &(O[0]));
+	       STA(&(O[WS(os, 59)]), VADD(T56, T50), ovs, &(O[0]));
+	       STA(&(O[WS(os, 60)]), VFMS(LDK(KP707106781), VADD(T4Q, T4T), T4t), ovs, &(O[0]));
+	       STA(&(O[WS(os, 61)]), VADD(T49, T3V), ovs, &(O[0]));
+	       STA(&(O[WS(os, 62)]), VADD(T2V, T3G), ovs, &(O[0]));
+	       STA(&(O[WS(os, 63)]), VSUB(T1x, T22), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 64, XSIMD_STRING("o01v_64"), {320, 114, 156, 0}, &GENUS, RODFT01 };
+
+void XSIMD(codelet_o01v_64) (planner *p) {
+     X(kr2r_register) (p, o01v_64, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o01v_64 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft01 -n 64 -name o01_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 456 FP additions, 249 FP multiplications,
+ * (or, 456 additions, 249 multiplications, 0 fused multiply/add),
+ * 457 stack variables, 78 constants, and 128 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o01v_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DVK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DVK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DVK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DVK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DVK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DVK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DVK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DVK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DVK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DVK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DVK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DVK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DVK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DVK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DVK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DVK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DVK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DVK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DVK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DVK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DVK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DVK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DVK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DVK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DVK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DVK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DVK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DVK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DVK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DVK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DVK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DVK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DVK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DVK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DVK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DVK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DVK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DVK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       V T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       V T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       V T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       V T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       V T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       V T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       V T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       V T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       V T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       V T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       V T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       V T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       V T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       V T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       V T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       V T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       V T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       V T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       V T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       V T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       V T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       V T6Z, T70, T71, T72, T73, T74, T75, T76, T77, T78, T79, T7a;
+	       V T7b, T7c, T7d, T7e, T7f, T7g, T7h, T7i, T7j, T7k, T7l, T7m;
+	       V T7n;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = LDA(&(I[WS(is, 32)]), ivs, &(I[0]));
+	       Ty = LDA(&(I[WS(is, 33)]), ivs, &(I[0]));
+	       Tz = LDA(&(I[WS(is, 34)]), ivs, &(I[0]));
+	       TA = LDA(&(I[WS(is, 35)]), ivs, &(I[0]));
+	       TB = LDA(&(I[WS(is, 36)]), ivs, &(I[0]));
+	       TC = LDA(&(I[WS(is, 37)]), ivs, &(I[0]));
+	       TD = LDA(&(I[WS(is, 38)]), ivs, &(I[0]));
+	       TE = LDA(&(I[WS(is, 39)]), ivs, &(I[0]));
+	       TF = LDA(&(I[WS(is, 40)]), ivs, &(I[0]));
+	       TG = LDA(&(I[WS(is, 41)]), ivs, &(I[0]));
+	       TH = LDA(&(I[WS(is, 42)]), ivs, &(I[0]));
+	       TI = LDA(&(I[WS(is, 43)]), ivs, &(I[0]));
+	       TJ = LDA(&(I[WS(is, 44)]), ivs, &(I[0]));
+	       TK = LDA(&(I[WS(is, 45)]), ivs, &(I[0]));
+	       TL = LDA(&(I[WS(is, 46)]), ivs, &(I[0]));
+	       TM = LDA(&(I[WS(is, 47)]), ivs, &(I[0]));
+	       TN = LDA(&(I[WS(is, 48)]), ivs, &(I[0]));
+	       TO = LDA(&(I[WS(is, 49)]), ivs, &(I[0]));
+	       TP = LDA(&(I[WS(is, 50)]), ivs, &(I[0]));
+	       TQ = LDA(&(I[WS(is, 51)]), ivs, &(I[0]));
+	       TR = LDA(&(I[WS(is, 52)]), ivs, &(I[0]));
+	       TS = LDA(&(I[WS(is, 53)]), ivs, &(I[0]));
+	       TT = LDA(&(I[WS(is, 54)]), ivs, &(I[0]));
+	       TU = LDA(&(I[WS(is, 55)]), ivs, &(I[0]));
+	       TV = LDA(&(I[WS(is, 56)]), ivs, &(I[0]));
+	       TW = LDA(&(I[WS(is, 57)]), ivs, &(I[0]));
+	       TX = LDA(&(I[WS(is, 58)]), ivs, &(I[0]));
+	       TY = LDA(&(I[WS(is, 59)]), ivs, &(I[0]));
+	       TZ = LDA(&(I[WS(is, 60)]), ivs, &(I[0]));
+	       T10 = LDA(&(I[WS(is, 61)]), ivs, &(I[0]));
+	       T11 = LDA(&(I[WS(is, 62)]), ivs, &(I[0]));
+	       T12 = LDA(&(I[WS(is, 63)]), ivs, &(I[0]));
+	       T13 = VADD(VMUL(LDK(KP985796384), Tl), VMUL(LDK(KP1_740173982), TH));
+	       T14 = VADD(VMUL(LDK(KP533425514), Tb), VMUL(LDK(KP1_927552131), TR));
+	       T15 = VADD(T13, T14);
+	       T16 = VADD(VMUL(LDK(KP1_230463181), Tr), VMUL(LDK(KP1_576692855), TB));
+	       T17 = VADD(VMUL(LDK(KP244821350), T5), VMUL(LDK(KP1_984959069), TX));
+	       T18 = VADD(T16, T17);
+	       T19 = VADD(T15, T18);
+	       T1a = VADD(VMUL(LDK(KP899222659), Tj), VMUL(LDK(KP1_786448602), TJ));
+	       T1b = VADD(VMUL(LDK(KP627363480), Td), VMUL(LDK(KP1_899056361), TP));
+	       T1c = VADD(T1a, T1b);
+	       T1d = VADD(VMUL(LDK(KP1_306345685), Tt), VMUL(LDK(KP1_514417693), Tz));
+	       T1e = VADD(VMUL(LDK(KP147129127), T3), VMUL(LDK(KP1_994580913), TZ));
+	       T1f = VADD(T1d, T1e);
+	       T1g = VADD(T1c, T1f);
+	       T1h = VADD(T19, T1g);
+	       T1i = VADD(VMUL(LDK(KP1_069995239), Tn), VMUL(LDK(KP1_689707130), TF));
+	       T1j = VADD(VMUL(LDK(KP438202480), T9), VMUL(LDK(KP1_951404260), TT));
+	       T1k = VADD(T1i, T1j);
+	       T1l = VADD(VMUL(LDK(KP1_151616382), Tp), VMUL(LDK(KP1_635169626), TD));
+	       T1m = VADD(VMUL(LDK(KP341923777), T7), VMUL(LDK(KP1_970555284), TV));
+	       T1n = VADD(T1l, T1m);
+	       T1o = VADD(T1k, T1n);
+	       T1p = VADD(VMUL(LDK(KP810482628), Th), VMUL(LDK(KP1_828419511), TL));
+	       T1q = VADD(VMUL(LDK(KP719790073), Tf), VMUL(LDK(KP1_865985597), TN));
+	       T1r = VADD(T1p, T1q);
+	       T1s = VADD(VMUL(LDK(KP1_379081089), Tv), VMUL(LDK(KP1_448494165), Tx));
+	       T1t = VADD(VMUL(LDK(KP049082457), T1), VMUL(LDK(KP1_999397637), T11));
+	       T1u = VADD(T1s, T1t);
+	       T1v = VADD(T1r, T1u);
+	       T1w = VADD(T1o, T1v);
+	       T1x = VADD(T1h, T1w);
+	       T1y = VADD(VMUL(LDK(KP1_028205488), Tm), VMUL(LDK(KP1_715457220), TG));
+	       T1z = VADD(VMUL(LDK(KP485960359), Ta), VMUL(LDK(KP1_940062506), TS));
+	       T1A = VADD(T1y, T1z);
+	       T1B = VADD(VMUL(LDK(KP1_191398608), Tq), VMUL(LDK(KP1_606415062), TC));
+	       T1C = VADD(VMUL(LDK(KP293460948), T6), VMUL(LDK(KP1_978353019), TW));
+	       T1D = VADD(T1B, T1C);
+	       T1E = VADD(T1A, T1D);
+	       T1F = VADD(VMUL(LDK(KP855110186), Ti), VMUL(LDK(KP1_807978586), TK));
+	       T1G = VADD(VMUL(LDK(KP673779706), Te), VMUL(LDK(KP1_883088130), TO));
+	       T1H = VADD(T1F, T1G);
+	       T1I = VADD(VMUL(LDK(KP1_343117909), Tu), VMUL(LDK(KP1_481902250), Ty));
+	       T1J = VADD(VMUL(LDK(KP098135348), T2), VMUL(LDK(KP1_997590912), T10));
+	       T1K = VADD(T1I, T1J);
+	       T1L = VADD(T1H, T1K);
+	       T1M = VADD(T1E, T1L);
+	       T1N = VADD(VMUL(LDK(KP942793473), Tk), VMUL(LDK(KP1_763842528), TI));
+	       T1O = VADD(VMUL(LDK(KP580569354), Tc), VMUL(LDK(KP1_913880671), TQ));
+	       T1P = VADD(T1N, T1O);
+	       T1Q = VADD(VMUL(LDK(KP1_268786568), Ts), VMUL(LDK(KP1_546020906), TA));
+	       T1R = VADD(VMUL(LDK(KP196034280), T4), VMUL(LDK(KP1_990369453), TY));
+	       T1S = VADD(T1Q, T1R);
+	       T1T = VADD(T1P, T1S);
+	       T1U = VADD(VMUL(LDK(KP1_111140466), To), VMUL(LDK(KP1_662939224), TE));
+	       T1V = VADD(VMUL(LDK(KP390180644), T8), VMUL(LDK(KP1_961570560), TU));
+	       T1W = VADD(T1U, T1V);
+	       T1X = VADD(VMUL(LDK(KP765366864), Tg), VMUL(LDK(KP1_847759065), TM));
+	       T1Y = VMUL(LDK(KP1_414213562), Tw);
+	       T1Z = VADD(T12, T1Y);
+	       T20 = VADD(T1X, T1Z);
+	       T21 = VADD(T1W, T20);
+	       T22 = VADD(T1T, T21);
+	       T23 = VADD(T1M, T22);
+	       STA(&(O[0]), VADD(T1x, T23), ovs, &(O[0]));
+	       T24 = VSUB(T13, T14);
+	       T25 = VSUB(VMUL(LDK(KP1_576692855), Tr), VMUL(LDK(KP1_230463181), TB));
+	       T26 = VSUB(VMUL(LDK(KP1_984959069), T5), VMUL(LDK(KP244821350), TX));
+	       T27 = VADD(T25, T26);
+	       T28 = VADD(T24, T27);
+	       T29 = VSUB(VMUL(LDK(KP1_740173982), Tl), VMUL(LDK(KP985796384), TH));
+	       T2a = VSUB(VMUL(LDK(KP1_927552131), Tb), VMUL(LDK(KP533425514), TR));
+	       T2b = VADD(T29, T2a);
+	       T2c = VSUB(T16, T17);
+	       T2d = VADD(T2b, T2c);
+	       T2e = VADD(VMUL(LDK(KP098017140), T28), VMUL(LDK(KP995184726), T2d));
+	       T2f = VSUB(T1a, T1b);
+	       T2g = VSUB(VMUL(LDK(KP1_514417693), Tt), VMUL(LDK(KP1_306345685), Tz));
+	       T2h = VSUB(VMUL(LDK(KP1_994580913), T3), VMUL(LDK(KP147129127), TZ));
+	       T2i = VADD(T2g, T2h);
+	       T2j = VADD(T2f, T2i);
+	       T2k = VSUB(VMUL(LDK(KP1_786448602), Tj), VMUL(LDK(KP899222659), TJ));
+	       T2l = VSUB(VMUL(LDK(KP1_899056361), Td), VMUL(LDK(KP627363480), TP));
+	       T2m = VADD(T2k, T2l);
+	       T2n = VSUB(T1d, T1e);
+	       T2o = VADD(T2m, T2n);
+	       T2p = VADD(VMUL(LDK(KP634393284), T2j), VMUL(LDK(KP773010453), T2o));
+	       T2q = VADD(T2e, T2p);
+	       T2r = VSUB(T1i, T1j);
+	       T2s = VSUB(VMUL(LDK(KP1_635169626), Tp), VMUL(LDK(KP1_151616382), TD));
+	       T2t = VSUB(VMUL(LDK(KP1_970555284), T7), VMUL(LDK(KP341923777), TV));
+	       T2u = VADD(T2s, T2t);
+	       T2v = VADD(T2r, T2u);
+	       T2w = VSUB(VMUL(LDK(KP1_689707130), Tn), VMUL(LDK(KP1_069995239), TF));
+	       T2x = VSUB(VMUL(LDK(KP1_951404260), T9), VMUL(LDK(KP438202480), TT));
+	       T2y = VADD(T2w, T2x);
+	       T2z = VSUB(T1l, T1m);
+	       T2A = VADD(T2y, T2z);
+	       T2B = VADD(VMUL(LDK(KP881921264), T2v), VMUL(LDK(KP471396736), T2A));
+	       T2C = VSUB(T1p, T1q);
+	       T2D = VSUB(VMUL(LDK(KP1_448494165), Tv), VMUL(LDK(KP1_379081089), Tx));
+	       T2E = VSUB(VMUL(LDK(KP1_999397637), T1), VMUL(LDK(KP049082457), T11));
+	       T2F = VADD(T2D, T2E);
+	       T2G = VADD(T2C, T2F);
+	       T2H = VSUB(VMUL(LDK(KP1_828419511), Th), VMUL(LDK(KP810482628), TL));
+	       T2I = VSUB(VMUL(LDK(KP1_865985597), Tf), VMUL(LDK(KP719790073), TN));
+	       T2J = VADD(T2H, T2I);
+	       T2K = VSUB(T1s, T1t);
+	       T2L = VADD(T2J, T2K);
+	       T2M = VSUB(VMUL(LDK(KP290284677), T2G), VMUL(LDK(KP956940335), T2L));
+	       T2N = VSUB(T2B, T2M);
+	       T2O = VADD(T2q, T2N);
+	       T2P = VSUB(VMUL(LDK(KP995184726), T28), VMUL(LDK(KP098017140), T2d));
+	       T2Q = VSUB(VMUL(LDK(KP773010453), T2j), VMUL(LDK(KP634393284), T2o));
+	       T2R = VSUB(T2P, T2Q);
+	       T2S = VADD(VMUL(LDK(KP956940335), T2G), VMUL(LDK(KP290284677), T2L));
+	       T2T = VSUB(VMUL(LDK(KP471396736), T2v), VMUL(LDK(KP881921264), T2A));
+	       T2U = VSUB(T2S, T2T);
+	       T2V = VADD(T2R, T2U);
+	       T2W = VADD(VMUL(LDK(KP923879532), T2O), VMUL(LDK(KP382683432), T2V));
+	       T2X = VSUB(T1y, T1z);
+	       T2Y = VSUB(VMUL(LDK(KP1_606415062), Tq), VMUL(LDK(KP1_191398608), TC));
+	       T2Z = VSUB(VMUL(LDK(KP1_978353019), T6), VMUL(LDK(KP293460948), TW));
+	       T30 = VADD(T2Y, T2Z);
+	       T31 = VADD(T2X, T30);
+	       T32 = VSUB(VMUL(LDK(KP1_715457220), Tm), VMUL(LDK(KP1_028205488), TG));
+	       T33 = VSUB(VMUL(LDK(KP1_940062506), Ta), VMUL(LDK(KP485960359), TS));
+	       T34 = VADD(T32, T33);
+	       T35 = VSUB(T1B, T1C);
+	       T36 = VADD(T34, T35);
+	       T37 = VSUB(VMUL(LDK(KP195090322), T31), VMUL(LDK(KP980785280), T36));
+	       T38 = VSUB(T1F, T1G);
+	       T39 = VSUB(VMUL(LDK(KP1_481902250), Tu), VMUL(LDK(KP1_343117909), Ty));
+	       T3a = VSUB(VMUL(LDK(KP1_997590912), T2), VMUL(LDK(KP098135348), T10));
+	       T3b = VADD(T39, T3a);
+	       T3c = VADD(T38, T3b);
+	       T3d = VSUB(VMUL(LDK(KP1_807978586), Ti), VMUL(LDK(KP855110186), TK));
+	       T3e = VSUB(VMUL(LDK(KP1_883088130), Te), VMUL(LDK(KP673779706), TO));
+	       T3f = VADD(T3d, T3e);
+	       T3g = VSUB(T1I, T1J);
+	       T3h = VADD(T3f, T3g);
+	       T3i = VADD(VMUL(LDK(KP831469612), T3c), VMUL(LDK(KP555570233), T3h));
+	       T3j = VSUB(T37, T3i);
+	       T3k = VSUB(VMUL(LDK(KP555570233), T3c), VMUL(LDK(KP831469612), T3h));
+	       T3l = VADD(VMUL(LDK(KP980785280), T31), VMUL(LDK(KP195090322), T36));
+	       T3m = VSUB(T3k, T3l);
+	       T3n = VMUL(LDK(KP707106781), VADD(T3j, T3m));
+	       T3o = VSUB(T1N, T1O);
+	       T3p = VSUB(VMUL(LDK(KP1_546020906), Ts), VMUL(LDK(KP1_268786568), TA));
+	       T3q = VSUB(VMUL(LDK(KP1_990369453), T4), VMUL(LDK(KP196034280), TY));
+	       T3r = VADD(T3p, T3q);
+	       T3s = VADD(T3o, T3r);
+	       T3t = VSUB(VMUL(LDK(KP1_763842528), Tk), VMUL(LDK(KP942793473), TI));
+	       T3u = VSUB(VMUL(LDK(KP1_913880671), Tc), VMUL(LDK(KP580569354), TQ));
+	       T3v = VADD(T3t, T3u);
+	       T3w = VSUB(T1Q, T1R);
+	       T3x = VADD(T3v, T3w);
+	       T3y = VADD(VMUL(LDK(KP382683432), T3s), VMUL(LDK(KP923879532), T3x));
+	       T3z = VSUB(VMUL(LDK(KP1_662939224), To), VMUL(LDK(KP1_111140466), TE));
+	       T3A = VSUB(VMUL(LDK(KP1_961570560), T8), VMUL(LDK(KP390180644), TU));
+	       T3B = VADD(T3z, T3A);
+	       T3C = VSUB(T1U, T1V);
+	       T3D = VMUL(LDK(KP707106781), VADD(T3B, T3C));
+	       T3E = VSUB(VMUL(LDK(KP1_847759065), Tg), VMUL(LDK(KP765366864), TM));
+	       T3F = VSUB(T12, T1Y);
+	       T3G = VSUB(T3E, T3F);
+	       T3H = VADD(T3D, T3G);
+	       T3I = VADD(T3y, T3H);
+	       T3J = VSUB(T3n, T3I);
+	       STA(&(O[WS(os, 1)]), VSUB(T2W, T3J), ovs, &(O[0]));
+	       T3K = VSUB(T2J, T2K);
+	       T3L = VSUB(T2F, T2C);
+	       T3M = VADD(VMUL(LDK(KP995184726), T3K), VMUL(LDK(KP098017140), T3L));
+	       T3N = VSUB(T2r, T2u);
+	       T3O = VSUB(T2y, T2z);
+	       T3P = VSUB(VMUL(LDK(KP634393284), T3N), VMUL(LDK(KP773010453), T3O));
+	       T3Q = VSUB(T3M, T3P);
+	       T3R = VSUB(T24, T27);
+	       T3S = VSUB(T2b, T2c);
+	       T3T = VSUB(VMUL(LDK(KP471396736), T3R), VMUL(LDK(KP881921264), T3S));
+	       T3U = VSUB(T2f, T2i);
+	       T3V = VSUB(T2m, T2n);
+	       T3W = VSUB(VMUL(LDK(KP290284677), T3U), VMUL(LDK(KP956940335), T3V));
+	       T3X = VADD(T3T, T3W);
+	       T3Y = VSUB(T3Q, T3X);
+	       T3Z = VSUB(T2X, T30);
+	       T40 = VSUB(T34, T35);
+	       T41 = VSUB(VMUL(LDK(KP555570233), T3Z), VMUL(LDK(KP831469612), T40));
+	       T42 = VSUB(T38, T3b);
+	       T43 = VSUB(T3f, T3g);
+	       T44 = VSUB(VMUL(LDK(KP195090322), T42), VMUL(LDK(KP980785280), T43));
+	       T45 = VADD(T41, T44);
+	       T46 = VSUB(T3o, T3r);
+	       T47 = VSUB(T3v, T3w);
+	       T48 = VSUB(VMUL(LDK(KP382683432), T46), VMUL(LDK(KP923879532), T47));
+	       T49 = VMUL(LDK(KP707106781), VSUB(T3B, T3C));
+	       T4a = VADD(T3E, T3F);
+	       T4b = VADD(T49, T4a);
+	       T4c = VSUB(T48, T4b);
+	       T4d = VADD(T45, T4c);
+	       STA(&(O[WS(os, 2)]), VSUB(T3Y, T4d), ovs, &(O[0]));
+	       T4e = VSUB(T1A, T1D);
+	       T4f = VSUB(T3d, T3e);
+	       T4g = VSUB(T39, T3a);
+	       T4h = VADD(T4f, T4g);
+	       T4i = VSUB(T4e, T4h);
+	       T4j = VSUB(T32, T33);
+	       T4k = VSUB(T2Y, T2Z);
+	       T4l = VADD(T4j, T4k);
+	       T4m = VSUB(T1H, T1K);
+	       T4n = VSUB(T4l, T4m);
+	       T4o = VSUB(VMUL(LDK(KP382683432), T4i), VMUL(LDK(KP923879532), T4n));
+	       T4p = VSUB(T3t, T3u);
+	       T4q = VSUB(T3p, T3q);
+	       T4r = VADD(T4p, T4q);
+	       T4s = VSUB(T1P, T1S);
+	       T4t = VMUL(LDK(KP707106781), VSUB(T4r, T4s));
+	       T4u = VSUB(T3z, T3A);
+	       T4v = VSUB(T1X, T1Z);
+	       T4w = VSUB(T4u, T4v);
+	       T4x = VADD(T4t, T4w);
+	       T4y = VSUB(T4o, T4x);
+	       T4z = VSUB(T2E, T2D);
+	       T4A = VSUB(T2H, T2I);
+	       T4B = VSUB(T4z, T4A);
+	       T4C = VSUB(T1n, T1k);
+	       T4D = VSUB(T4B, T4C);
+	       T4E = VSUB(T2w, T2x);
+	       T4F = VSUB(T2s, T2t);
+	       T4G = VADD(T4E, T4F);
+	       T4H = VSUB(T1u, T1r);
+	       T4I = VADD(T4G, T4H);
+	       T4J = VSUB(VMUL(LDK(KP831469612), T4D), VMUL(LDK(KP555570233), T4I));
+	       T4K = VSUB(T15, T18);
+	       T4L = VSUB(T2k, T2l);
+	       T4M = VSUB(T2g, T2h);
+	       T4N = VADD(T4L, T4M);
+	       T4O = VSUB(T4K, T4N);
+	       T4P = VSUB(T29, T2a);
+	       T4Q = VSUB(T25, T26);
+	       T4R = VADD(T4P, T4Q);
+	       T4S = VSUB(T1c, T1f);
+	       T4T = VSUB(T4R, T4S);
+	       T4U = VADD(VMUL(LDK(KP195090322), T4O), VMUL(LDK(KP980785280), T4T));
+	       T4V = VSUB(T4J, T4U);
+	       T4W = VSUB(VMUL(LDK(KP980785280), T4O), VMUL(LDK(KP195090322), T4T));
+	       T4X = VADD(VMUL(LDK(KP555570233), T4D), VMUL(LDK(KP831469612), T4I));
+	       T4Y = VSUB(T4W, T4X);
+	       T4Z = VMUL(LDK(KP707106781), VADD(T4V, T4Y));
+	       STA(&(O[WS(os, 3)]), VADD(T4y, T4Z), ovs, &(O[0]));
+	       T50 = VADD(T4C, T4B);
+	       T51 = VSUB(T4H, T4G);
+	       T52 = VADD(VMUL(LDK(KP195090322), T50), VMUL(LDK(KP980785280), T51));
+	       T53 = VADD(T4K, T4N);
+	       T54 = VADD(T4R, T4S);
+	       T55 = VADD(VMUL(LDK(KP555570233), T53), VMUL(LDK(KP831469612), T54));
+	       T56 = VSUB(T52, T55);
+	       T57 = VADD(T4e, T4h);
+	       T58 = VADD(T4l, T4m);
+	       T59 = VADD(VMUL(LDK(KP382683432), T57), VMUL(LDK(KP923879532), T58));
+	       T5a = VMUL(LDK(KP707106781), VADD(T4r, T4s));
+	       T5b = VADD(T4u, T4v);
+	       T5c = VADD(T5a, T5b);
+	       T5d = VADD(T59, T5c);
+	       STA(&(O[WS(os, 4)]), VSUB(T56, T5d), ovs, &(O[0]));
+	       T5e = VSUB(T3W, T3T);
+	       T5f = VSUB(VMUL(LDK(KP995184726), T3L), VMUL(LDK(KP098017140), T3K));
+	       T5g = VADD(VMUL(LDK(KP773010453), T3N), VMUL(LDK(KP634393284), T3O));
+	       T5h = VSUB(T5f, T5g);
+	       T5i = VADD(T5e, T5h);
+	       T5j = VADD(VMUL(LDK(KP881921264), T3R), VMUL(LDK(KP471396736), T3S));
+	       T5k = VADD(VMUL(LDK(KP956940335), T3U), VMUL(LDK(KP290284677), T3V));
+	       T5l = VADD(T5j, T5k);
+	       T5m = VADD(T3P, T3M);
+	       T5n = VADD(T5l, T5m);
+	       T5o = VSUB(VMUL(LDK(KP382683432), T5i), VMUL(LDK(KP923879532), T5n));
+	       T5p = VSUB(T49, T4a);
+	       T5q = VADD(VMUL(LDK(KP923879532), T46), VMUL(LDK(KP382683432), T47));
+	       T5r = VSUB(T5p, T5q);
+	       T5s = VADD(VMUL(LDK(KP831469612), T3Z), VMUL(LDK(KP555570233), T40));
+	       T5t = VADD(VMUL(LDK(KP980785280), T42), VMUL(LDK(KP195090322), T43));
+	       T5u = VADD(T5s, T5t);
+	       T5v = VSUB(T41, T44);
+	       T5w = VMUL(LDK(KP707106781), VADD(T5u, T5v));
+	       T5x = VSUB(T5r, T5w);
+	       STA(&(O[WS(os, 5)]), VADD(T5o, T5x), ovs, &(O[0]));
+	       T5y = VADD(T2P, T2Q);
+	       T5z = VADD(T2B, T2M);
+	       T5A = VADD(T5y, T5z);
+	       T5B = VADD(T3l, T3k);
+	       T5C = VSUB(VMUL(LDK(KP923879532), T3s), VMUL(LDK(KP382683432), T3x));
+	       T5D = VSUB(T3D, T3G);
+	       T5E = VADD(T5C, T5D);
+	       T5F = VADD(T5B, T5E);
+	       STA(&(O[WS(os, 6)]), VADD(T5A, T5F), ovs, &(O[0]));
+	       T5G = VSUB(T4j, T4k);
+	       T5H = VSUB(T4f, T4g);
+	       T5I = VADD(T5G, T5H);
+	       T5J = VSUB(T1E, T1L);
+	       T5K = VMUL(LDK(KP707106781), VADD(T5I, T5J));
+	       T5L = VSUB(T4p, T4q);
+	       T5M = VSUB(T1W, T20);
+	       T5N = VADD(T5L, T5M);
+	       T5O = VADD(T5K, T5N);
+	       T5P = VSUB(T4P, T4Q);
+	       T5Q = VSUB(T4L, T4M);
+	       T5R = VADD(T5P, T5Q);
+	       T5S = VSUB(T1o, T1v);
+	       T5T = VADD(T5R, T5S);
+	       T5U = VSUB(T19, T1g);
+	       T5V = VSUB(T4E, T4F);
+	       T5W = VADD(T4A, T4z);
+	       T5X = VADD(T5V, T5W);
+	       T5Y = VADD(T5U, T5X);
+	       T5Z = VADD(VMUL(LDK(KP923879532), T5T), VMUL(LDK(KP382683432), T5Y));
+	       STA(&(O[WS(os, 7)]), VADD(T5O, T5Z), ovs, &(O[0]));
+	       T60 = VMUL(LDK(KP707106781), VSUB(T5I, T5J));
+	       T61 = VSUB(T5L, T5M);
+	       T62 = VADD(T60, T61);
+	       T63 = VSUB(T5R, T5S);
+	       T64 = VSUB(T5X, T5U);
+	       T65 = VADD(VMUL(LDK(KP923879532), T63), VMUL(LDK(KP382683432), T64));
+	       STA(&(O[WS(os, 8)]), VADD(T62, T65), ovs, &(O[0]));
+	       T66 = VADD(T37, T3i);
+	       T67 = VSUB(T5C, T5D);
+	       T68 = VADD(T66, T67);
+	       T69 = VSUB(T5y, T5z);
+	       T6a = VADD(T2T, T2S);
+	       T6b = VSUB(T2e, T2p);
+	       T6c = VSUB(T6a, T6b);
+	       T6d = VMUL(LDK(KP707106781), VADD(T69, T6c));
+	       STA(&(O[WS(os, 9)]), VADD(T68, T6d), ovs, &(O[0]));
+	       T6e = VSUB(T5h, T5e);
+	       T6f = VSUB(T5l, T5m);
+	       T6g = VSUB(VMUL(LDK(KP382683432), T6e), VMUL(LDK(KP923879532), T6f));
+	       T6h = VMUL(LDK(KP707106781), VSUB(T5u, T5v));
+	       T6i = VADD(T5q, T5p);
+	       T6j = VADD(T6h, T6i);
+	       STA(&(O[WS(os, 10)]), VSUB(T6g, T6j), ovs, &(O[0]));
+	       T6k = VSUB(VMUL(LDK(KP555570233), T54), VMUL(LDK(KP831469612), T53));
+	       T6l = VSUB(VMUL(LDK(KP980785280), T50), VMUL(LDK(KP195090322), T51));
+	       T6m = VADD(T6k, T6l);
+	       T6n = VADD(T55, T52);
+	       T6o = VMUL(LDK(KP707106781), VSUB(T6m, T6n));
+	       T6p = VSUB(T5b, T5a);
+	       T6q = VSUB(VMUL(LDK(KP923879532), T57), VMUL(LDK(KP382683432), T58));
+	       T6r = VSUB(T6p, T6q);
+	       STA(&(O[WS(os, 11)]), VADD(T6o, T6r), ovs, &(O[0]));
+	       T6s = VADD(VMUL(LDK(KP923879532), T4i), VMUL(LDK(KP382683432), T4n));
+	       T6t = VSUB(T4t, T4w);
+	       T6u = VSUB(T6s, T6t);
+	       T6v = VADD(T4W, T4X);
+	       STA(&(O[WS(os, 12)]), VADD(T6u, T6v), ovs, &(O[0]));
+	       T6w = VSUB(T5s, T5t);
+	       T6x = VADD(T48, T4b);
+	       T6y = VSUB(T6w, T6x);
+	       T6z = VSUB(T5j, T5k);
+	       T6A = VADD(T5g, T5f);
+	       T6B = VADD(T6z, T6A);
+	       T6C = VADD(T3X, T3Q);
+	       T6D = VMUL(LDK(KP707106781), VSUB(T6B, T6C));
+	       STA(&(O[WS(os, 13)]), VADD(T6y, T6D), ovs, &(O[0]));
+	       T6E = VSUB(T2q, T2N);
+	       T6F = VSUB(T2U, T2R);
+	       T6G = VADD(VMUL(LDK(KP923879532), T6E), VMUL(LDK(KP382683432), T6F));
+	       T6H = VSUB(T3y, T3H);
+	       T6I = VMUL(LDK(KP707106781), VSUB(T3m, T3j));
+	       T6J = VADD(T6H, T6I);
+	       STA(&(O[WS(os, 14)]), VADD(T6G, T6J), ovs, &(O[0]));
+	       T6K = VSUB(T1h, T1w);
+	       T6L = VSUB(T5W, T5V);
+	       T6M = VSUB(T5P, T5Q);
+	       T6N = VSUB(T6L, T6M);
+	       T6O = VMUL(LDK(KP707106781), VADD(T6K, T6N));
+	       T6P = VSUB(T5G, T5H);
+	       T6Q = VSUB(T1T, T21);
+	       T6R = VSUB(T6P, T6Q);
+	       STA(&(O[WS(os, 15)]), VSUB(T6O, T6R), ovs, &(O[0]));
+	       T6S = VMUL(LDK(KP707106781), VSUB(T6N, T6K));
+	       T6T = VADD(T6P, T6Q);
+	       STA(&(O[WS(os, 16)]), VSUB(T6S, T6T), ovs, &(O[0]));
+	       T6U = VSUB(VMUL(LDK(KP923879532), T6F), VMUL(LDK(KP382683432), T6E));
+	       T6V = VSUB(T6H, T6I);
+	       STA(&(O[WS(os, 17)]), VSUB(T6U, T6V), ovs, &(O[0]));
+	       T6W = VADD(T6w, T6x);
+	       T6X = VMUL(LDK(KP707106781), VADD(T6B, T6C));
+	       STA(&(O[WS(os, 18)]), VADD(T6W, T6X), ovs, &(O[0]));
+	       T6Y = VADD(T6s, T6t);
+	       T6Z = VADD(T4U, T4J);
+	       STA(&(O[WS(os, 19)]), VADD(T6Y, T6Z), ovs, &(O[0]));
+	       T70 = VMUL(LDK(KP707106781), VADD(T6m, T6n));
+	       T71 = VADD(T6q, T6p);
+	       STA(&(O[WS(os, 20)]), VSUB(T70, T71), ovs, &(O[0]));
+	       T72 = VADD(VMUL(LDK(KP923879532), T6e), VMUL(LDK(KP382683432), T6f));
+	       T73 = VSUB(T6h, T6i);
+	       STA(&(O[WS(os, 21)]), VSUB(T72, T73), ovs, &(O[0]));
+	       T74 = VMUL(LDK(KP707106781), VSUB(T6c, T69));
+	       T75 = VSUB(T67, T66);
+	       STA(&(O[WS(os, 22)]), VSUB(T74, T75), ovs, &(O[0]));
+	       T76 = VSUB(T60, T61);
+	       T77 = VSUB(VMUL(LDK(KP923879532), T64), VMUL(LDK(KP382683432), T63));
+	       STA(&(O[WS(os, 23)]), VADD(T76, T77), ovs, &(O[0]));
+	       T78 = VSUB(T5K, T5N);
+	       T79 = VSUB(VMUL(LDK(KP923879532), T5Y), VMUL(LDK(KP382683432), T5T));
+	       STA(&(O[WS(os, 24)]), VADD(T78, T79), ovs, &(O[0]));
+	       T7a = VADD(T6b, T6a);
+	       T7b = VSUB(T5B, T5E);
+	       STA(&(O[WS(os, 25)]), VADD(T7a, T7b), ovs, &(O[0]));
+	       T7c = VADD(VMUL(LDK(KP923879532), T5i), VMUL(LDK(KP382683432), T5n));
+	       T7d = VADD(T5w, T5r);
+	       STA(&(O[WS(os, 26)]), VSUB(T7c, T7d), ovs, &(O[0]));
+	       T7e = VSUB(T6l, T6k);
+	       T7f = VSUB(T59, T5c);
+	       STA(&(O[WS(os, 27)]), VSUB(T7e, T7f), ovs, &(O[0]));
+	       T7g = VADD(T4o, T4x);
+	       T7h = VMUL(LDK(KP707106781), VSUB(T4V, T4Y));
+	       STA(&(O[WS(os, 28)]), VADD(T7g, T7h), ovs, &(O[0]));
+	       T7i = VSUB(T6A, T6z);
+	       T7j = VSUB(T45, T4c);
+	       STA(&(O[WS(os, 29)]), VSUB(T7i, T7j), ovs, &(O[0]));
+	       T7k = VSUB(VMUL(LDK(KP923879532), T2V), VMUL(LDK(KP382683432), T2O));
+	       T7l = VADD(T3I, T3n);
+	       STA(&(O[WS(os, 30)]), VSUB(T7k, T7l), ovs, &(O[0]));
+	       T7m = VSUB(T1M, T22);
+	       T7n = VADD(T6M, T6L);
+	       STA(&(O[WS(os, 31)]), VADD(T7m, T7n), ovs, &(O[0]));
+	       STA(&(O[WS(os, 32)]), VSUB(T7n, T7m), ovs, &(O[0]));
+	       STA(&(O[WS(os, 33)]), VADD(T7k, T7l), ovs, &(O[0]));
+	       STA(&(O[WS(os, 34)]), VADD(T7j, T7i), ovs, &(O[0]));
+	       STA(&(O[WS(os, 35)]), VSUB(T7h, T7g), ovs, &(O[0]));
+	       STA(&(O[WS(os, 36)]), VADD(T7f, T7e), ovs, &(O[0]));
+	       STA(&(O[WS(os, 37)]), VADD(T7c, T7d), ovs, &(O[0]));
+	       STA(&(O[WS(os, 38)]), VSUB(T7a, T7b), ovs, &(O[0]));
+	       STA(&(O[WS(os, 39)]), VSUB(T79, T78), ovs, &(O[0]));
+	       STA(&(O[WS(os, 40)]), VSUB(T77, T76), ovs, &(O[0]));
+	       STA(&(O[WS(os, 41)]), VADD(T74, T75), ovs, &(O[0]));
+	       STA(&(O[WS(os, 42)]), VADD(T73, T72), ovs, &(O[0]));
+	       STA(&(O[WS(os, 43)]), VADD(T70, T71), ovs, &(O[0]));
+	       STA(&(O[WS(os, 44)]), VSUB(T6Z, T6Y), ovs, &(O[0]));
+	       STA(&(O[WS(os, 45)]), VSUB(T6X, T6W), ovs, &(O[0]));
+	       STA(&(O[WS(os, 46)]), VADD(T6U, T6V), ovs, &(O[0]));
+	       STA(&(O[WS(os, 47)]), VADD(T6T, T6S), ovs, &(O[0]));
+	       STA(&(O[WS(os, 48)]), VADD(T6R, T6O), ovs, &(O[0]));
+	       STA(&(O[WS(os, 49)]), VSUB(T6G, T6J), ovs, &(O[0]));
+	       STA(&(O[WS(os, 50)]), VSUB(T6D, T6y), ovs, &(O[0]));
+	       STA(&(O[WS(os, 51)]), VSUB(T6v, T6u), ovs, &(O[0]));
+	       STA(&(O[WS(os, 52)]), VSUB(T6o, T6r), ovs, &(O[0]));
+	       STA(&(O[WS(os, 53)]), VADD(T6j, T6g), ovs, &(O[0]));
+	       STA(&(O[WS(os, 54)]), VSUB(T6d, T68), ovs, &(O[0]));
+	       STA(&(O[WS(os, 55)]), VSUB(T65, T62), ovs, &(O[0]));
+	       STA(&(O[WS(os, 56)]), VSUB(T5Z, T5O), ovs, &(O[0]));
+	       STA(&(O[WS(os, 57)]), VSUB(T5A, T5F), ovs, &(O[0]));
+	       STA(&(O[WS(os, 58)]), VSUB(T5o, T5x), ovs, &(O[0]));
+	       STA(&(O[WS(os, 59)]), VADD(T5d, T56), ovs, &(O[0]));
+	       STA(&(O[WS(os, 60)]), VSUB(T4Z, T4y), ovs, &(O[0]));
+	       STA(&(O[WS(os, 61)]), VADD(T4d, T3Y), ovs, &(O[0]));
+	       STA(&(O[WS(os, 62)]), VADD(T2W, T3J), ovs, &(O[0]));
+	       STA(&(O[WS(os, 63)]), VSUB(T1x, T23), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 64, XSIMD_STRING("o01v_64"), {456, 249, 0, 0}, &GENUS, RODFT01 };
+
+void XSIMD(codelet_o01v_64) (planner *p) {
+     X(kr2r_register) (p, o01v_64, &desc);
+}
+
+#endif
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o01v_8 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft01 -n 8 -name o01_8 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 28 FP additions, 18 FP multiplications,
+ * (or, 16 additions, 6 multiplications, 12 fused multiply/add),
+ * 24 stack variables, 8 constants, and 16 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o01v_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(16, is), MAKE_VOLATILE_STRIDE(16, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = VFMA(LDK(KP1_111140466), T3, VMUL(LDK(KP1_662939224), T5));
+	       Ta = VFMA(LDK(KP390180644), T1, VMUL(LDK(KP1_961570560), T7));
+	       Tb = VADD(T9, Ta);
+	       Tc = VFMA(LDK(KP765366864), T2, VMUL(LDK(KP1_847759065), T6));
+	       Td = VFMA(LDK(KP1_414213562), T4, T8);
+	       Te = VADD(Tc, Td);
+	       STA(&(O[0]), VADD(Tb, Te), ovs, &(O[0]));
+	       Tf = VFMS(LDK(KP1_847759065), T2, VMUL(LDK(KP765366864), T6));
+	       Tg = VFNMS(LDK(KP1_414213562), T4, T8);
+	       Th = VSUB(Tf, Tg);
+	       Ti = VFMS(LDK(KP1_662939224), T3, VMUL(LDK(KP1_111140466), T5));
+	       Tj = VFMS(LDK(KP1_961570560), T1, VMUL(LDK(KP390180644), T7));
+	       Tk = VADD(Ti, Tj);
+	       Tl = VSUB(T9, Ta);
+	       STA(&(O[WS(os, 1)]), VFMA(LDK(KP707106781), VADD(Tk, Tl), Th), ovs, &(O[0]));
+	       Tm = VADD(Tf, Tg);
+	       STA(&(O[WS(os, 2)]), VFMA(LDK(KP707106781), VSUB(Tk, Tl), Tm), ovs, &(O[0]));
+	       Tn = VSUB(Tc, Td);
+	       To = VSUB(Tj, Ti);
+	       STA(&(O[WS(os, 3)]), VADD(Tn, To), ovs, &(O[0]));
+	       STA(&(O[WS(os, 4)]), VSUB(To, Tn), ovs, &(O[0]));
+	       STA(&(O[WS(os, 5)]), VFMS(LDK(KP707106781), VSUB(Tk, Tl), Tm), ovs, &(O[0]));
+	       STA(&(O[WS(os, 6)]), VFMS(LDK(KP707106781), VADD(Tk, Tl), Th), ovs, &(O[0]));
+	       STA(&(O[WS(os, 7)]), VSUB(Tb, Te), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 8, XSIMD_STRING("o01v_8"), {16, 6, 12, 0}, &GENUS, RODFT01 };
+
+void XSIMD(codelet_o01v_8) (planner *p) {
+     X(kr2r_register) (p, o01v_8, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o01v_8 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft01 -n 8 -name o01_8 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 26 FP additions, 15 FP multiplications,
+ * (or, 26 additions, 15 multiplications, 0 fused multiply/add),
+ * 27 stack variables, 8 constants, and 16 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o01v_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(16, is), MAKE_VOLATILE_STRIDE(16, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = VADD(VMUL(LDK(KP1_111140466), T3), VMUL(LDK(KP1_662939224), T5));
+	       Ta = VADD(VMUL(LDK(KP390180644), T1), VMUL(LDK(KP1_961570560), T7));
+	       Tb = VADD(T9, Ta);
+	       Tc = VADD(VMUL(LDK(KP765366864), T2), VMUL(LDK(KP1_847759065), T6));
+	       Td = VMUL(LDK(KP1_414213562), T4);
+	       Te = VADD(T8, Td);
+	       Tf = VADD(Tc, Te);
+	       STA(&(O[0]), VADD(Tb, Tf), ovs, &(O[0]));
+	       Tg = VSUB(VMUL(LDK(KP1_662939224), T3), VMUL(LDK(KP1_111140466), T5));
+	       Th = VSUB(VMUL(LDK(KP1_961570560), T1), VMUL(LDK(KP390180644), T7));
+	       Ti = VADD(Tg, Th);
+	       Tj = VSUB(T9, Ta);
+	       Tk = VMUL(LDK(KP707106781), VADD(Ti, Tj));
+	       Tl = VSUB(VMUL(LDK(KP1_847759065), T2), VMUL(LDK(KP765366864), T6));
+	       Tm = VSUB(T8, Td);
+	       Tn = VSUB(Tl, Tm);
+	       STA(&(O[WS(os, 1)]), VADD(Tk, Tn), ovs, &(O[0]));
+	       To = VMUL(LDK(KP707106781), VSUB(Ti, Tj));
+	       Tp = VADD(Tl, Tm);
+	       STA(&(O[WS(os, 2)]), VADD(To, Tp), ovs, &(O[0]));
+	       Tq = VSUB(Tc, Te);
+	       Tr = VSUB(Th, Tg);
+	       STA(&(O[WS(os, 3)]), VADD(Tq, Tr), ovs, &(O[0]));
+	       STA(&(O[WS(os, 4)]), VSUB(Tr, Tq), ovs, &(O[0]));
+	       STA(&(O[WS(os, 5)]), VSUB(To, Tp), ovs, &(O[0]));
+	       STA(&(O[WS(os, 6)]), VSUB(Tk, Tn), ovs, &(O[0]));
+	       STA(&(O[WS(os, 7)]), VSUB(Tb, Tf), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 8, XSIMD_STRING("o01v_8"), {26, 15, 0, 0}, &GENUS, RODFT01 };
+
+void XSIMD(codelet_o01v_8) (planner *p) {
+     X(kr2r_register) (p, o01v_8, &desc);
+}
+
+#endif
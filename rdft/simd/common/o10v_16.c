@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o10v_16 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft10 -n 16 -name o10_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 74 FP additions, 44 FP multiplications,
+ * (or, 52 additions, 22 multiplications, 22 fused multiply/add),
+ * 70 stack variables, 19 constants, and 32 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o10v_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = VADD(T1, Tg);
+	       Ti = VMUL(LDK(KP707106781), VADD(T4, Td));
+	       Tj = VFMS(LDK(KP707106781), VADD(T5, Tc), Ti);
+	       Tk = VADD(Th, Tj);
+	       Tl = VADD(T6, Tb);
+	       Tm = VADD(T3, Te);
+	       Tn = VFMS(LDK(KP923879532), Tm, VMUL(LDK(KP382683432), Tl));
+	       To = VADD(T2, Tf);
+	       Tp = VADD(T7, Ta);
+	       Tq = VFMS(LDK(KP382683432), Tp, VMUL(LDK(KP923879532), To));
+	       Tr = VADD(Tn, Tq);
+	       Ts = VADD(Tk, Tr);
+	       Tt = VADD(T8, T9);
+	       Tu = VFMA(LDK(KP707106781), VADD(T5, Tc), Ti);
+	       Tv = VADD(Tt, Tu);
+	       Tw = VFMA(LDK(KP923879532), Tl, VMUL(LDK(KP382683432), Tm));
+	       Tx = VFMA(LDK(KP382683432), To, VMUL(LDK(KP923879532), Tp));
+	       Ty = VADD(Tw, Tx);
+	       Tz = VADD(Tv, Ty);
+	       STA(&(O[0]), VFMA(LDK(KP1_990369453), Tz, VMUL(LDK(KP196034280), Ts)), ovs, &(O[0]));
+	       TA = VSUB(T1, Tg);
+	       TB = VSUB(T8, T9);
+	       TC = VADD(TA, TB);
+	       TD = VSUB(T7, Ta);
+	       TE = VSUB(T2, Tf);
+	       TF = VMUL(LDK(KP707106781), VADD(TD, TE));
+	       TG = VSUB(T3, Te);
+	       TH = VSUB(T6, Tb);
+	       TI = VFMS(LDK(KP707106781), VADD(TG, TH), TF);
+	       TJ = VADD(TC, TI);
+	       TK = VSUB(T5, Tc);
+	       TL = VSUB(T4, Td);
+	       TM = VADD(TK, TL);
+	       TN = VFMA(LDK(KP707106781), VADD(TG, TH), TF);
+	       TO = VADD(TM, TN);
+	       STA(&(O[WS(os, 1)]), VFMA(LDK(KP1_961570560), TO, VMUL(LDK(KP390180644), TJ)), ovs, &(O[0]));
+	       TP = VSUB(Tt, Tu);
+	       TQ = VSUB(Tn, Tq);
+	       TR = VSUB(TP, TQ);
+	       TS = VSUB(Th, Tj);
+	       TT = VSUB(Tw, Tx);
+	       TU = VADD(TS, TT);
+	       STA(&(O[WS(os, 2)]), VFMS(LDK(KP580569354), TU, VMUL(LDK(KP1_913880671), TR)), ovs, &(O[0]));
+	       TV = VSUB(TA, TB);
+	       TW = VSUB(TK, TL);
+	       TX = VSUB(TV, TW);
+	       TY = VSUB(TG, TH);
+	       TZ = VSUB(TD, TE);
+	       T10 = VSUB(TY, TZ);
+	       STA(&(O[WS(os, 3)]), VFMA(LDK(KP1_847759065), T10, VMUL(LDK(KP765366864), TX)), ovs, &(O[0]));
+	       T11 = VSUB(TS, TT);
+	       T12 = VADD(TP, TQ);
+	       STA(&(O[WS(os, 4)]), VFMA(LDK(KP1_763842528), T12, VMUL(LDK(KP942793473), T11)), ovs, &(O[0]));
+	       T13 = VSUB(TM, TN);
+	       T14 = VSUB(TC, TI);
+	       STA(&(O[WS(os, 5)]), VFMS(LDK(KP1_111140466), T14, VMUL(LDK(KP1_662939224), T13)), ovs, &(O[0]));
+	       T15 = VSUB(Tv, Ty);
+	       T16 = VSUB(Tk, Tr);
+	       STA(&(O[WS(os, 6)]), VFMS(LDK(KP1_268786568), T16, VMUL(LDK(KP1_546020906), T15)), ovs, &(O[0]));
+	       T17 = VADD(TV, TW);
+	       T18 = VADD(TY, TZ);
+	       STA(&(O[WS(os, 7)]), VMUL(LDK(KP1_414213562), VSUB(T17, T18)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 8)]), VFMA(LDK(KP1_546020906), T16, VMUL(LDK(KP1_268786568), T15)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 9)]), VFMA(LDK(KP1_662939224), T14, VMUL(LDK(KP1_111140466), T13)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 10)]), VFMS(LDK(KP1_763842528), T11, VMUL(LDK(KP942793473), T12)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 11)]), VFMS(LDK(KP1_847759065), TX, VMUL(LDK(KP765366864), T10)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 12)]), VFMA(LDK(KP1_913880671), TU, VMUL(LDK(KP580569354), TR)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 13)]), VFMS(LDK(KP1_961570560), TJ, VMUL(LDK(KP390180644), TO)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 14)]), VFMS(LDK(KP1_990369453), Ts, VMUL(LDK(KP196034280), Tz)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 15)]), VMUL(LDK(KP2_000000000), VADD(T17, T18)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 16, XSIMD_STRING("o10v_16"), {52, 22, 22, 0}, &GENUS, RODFT10 };
+
+void XSIMD(codelet_o10v_16) (planner *p) {
+     X(kr2r_register) (p, o10v_16, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o10v_16 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft10 -n 16 -name o10_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 72 FP additions, 42 FP multiplications,
+ * (or, 72 additions, 42 multiplications, 0 fused multiply/add),
+ * 72 stack variables, 19 constants, and 32 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o10v_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = VADD(T8, T9);
+	       Ti = VMUL(LDK(KP707106781), VADD(T5, Tc));
+	       Tj = VMUL(LDK(KP707106781), VADD(T4, Td));
+	       Tk = VADD(Ti, Tj);
+	       Tl = VADD(Th, Tk);
+	       Tm = VADD(T6, Tb);
+	       Tn = VADD(T3, Te);
+	       To = VADD(VMUL(LDK(KP923879532), Tm), VMUL(LDK(KP382683432), Tn));
+	       Tp = VADD(T2, Tf);
+	       Tq = VADD(T7, Ta);
+	       Tr = VADD(VMUL(LDK(KP382683432), Tp), VMUL(LDK(KP923879532), Tq));
+	       Ts = VADD(To, Tr);
+	       Tt = VADD(Tl, Ts);
+	       Tu = VADD(T1, Tg);
+	       Tv = VSUB(Ti, Tj);
+	       Tw = VADD(Tu, Tv);
+	       Tx = VSUB(VMUL(LDK(KP923879532), Tn), VMUL(LDK(KP382683432), Tm));
+	       Ty = VSUB(VMUL(LDK(KP382683432), Tq), VMUL(LDK(KP923879532), Tp));
+	       Tz = VADD(Tx, Ty);
+	       TA = VADD(Tw, Tz);
+	       STA(&(O[0]), VADD(VMUL(LDK(KP1_990369453), Tt), VMUL(LDK(KP196034280), TA)), ovs, &(O[0]));
+	       TB = VSUB(T5, Tc);
+	       TC = VSUB(T4, Td);
+	       TD = VADD(TB, TC);
+	       TE = VSUB(T3, Te);
+	       TF = VSUB(T6, Tb);
+	       TG = VMUL(LDK(KP707106781), VADD(TE, TF));
+	       TH = VSUB(T7, Ta);
+	       TI = VSUB(T2, Tf);
+	       TJ = VMUL(LDK(KP707106781), VADD(TH, TI));
+	       TK = VADD(TG, TJ);
+	       TL = VADD(TD, TK);
+	       TM = VSUB(T1, Tg);
+	       TN = VSUB(T8, T9);
+	       TO = VADD(TM, TN);
+	       TP = VSUB(TG, TJ);
+	       TQ = VADD(TO, TP);
+	       STA(&(O[WS(os, 1)]), VADD(VMUL(LDK(KP1_961570560), TL), VMUL(LDK(KP390180644), TQ)), ovs, &(O[0]));
+	       TR = VSUB(Tu, Tv);
+	       TS = VSUB(To, Tr);
+	       TT = VADD(TR, TS);
+	       TU = VSUB(Th, Tk);
+	       TV = VSUB(Tx, Ty);
+	       TW = VSUB(TU, TV);
+	       STA(&(O[WS(os, 2)]), VSUB(VMUL(LDK(KP580569354), TT), VMUL(LDK(KP1_913880671), TW)), ovs, &(O[0]));
+	       TX = VSUB(TE, TF);
+	       TY = VSUB(TH, TI);
+	       TZ = VSUB(TX, TY);
+	       T10 = VSUB(TM, TN);
+	       T11 = VSUB(TB, TC);
+	       T12 = VSUB(T10, T11);
+	       STA(&(O[WS(os, 3)]), VADD(VMUL(LDK(KP1_847759065), TZ), VMUL(LDK(KP765366864), T12)), ovs, &(O[0]));
+	       T13 = VADD(TU, TV);
+	       T14 = VSUB(TR, TS);
+	       STA(&(O[WS(os, 4)]), VADD(VMUL(LDK(KP1_763842528), T13), VMUL(LDK(KP942793473), T14)), ovs, &(O[0]));
+	       T15 = VSUB(TO, TP);
+	       T16 = VSUB(TD, TK);
+	       STA(&(O[WS(os, 5)]), VSUB(VMUL(LDK(KP1_111140466), T15), VMUL(LDK(KP1_662939224), T16)), ovs, &(O[0]));
+	       T17 = VSUB(Tw, Tz);
+	       T18 = VSUB(Tl, Ts);
+	       STA(&(O[WS(os, 6)]), VSUB(VMUL(LDK(KP1_268786568), T17), VMUL(LDK(KP1_546020906), T18)), ovs, &(O[0]));
+	       T19 = VADD(T10, T11);
+	       T1a = VADD(TX, TY);
+	       STA(&(O[WS(os, 7)]), VMUL(LDK(KP1_414213562), VSUB(T19, T1a)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 8)]), VADD(VMUL(LDK(KP1_546020906), T17), VMUL(LDK(KP1_268786568), T18)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 9)]), VADD(VMUL(LDK(KP1_662939224), T15), VMUL(LDK(KP1_111140466), T16)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 10)]), VSUB(VMUL(LDK(KP1_763842528), T14), VMUL(LDK(KP942793473), T13)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 11)]), VSUB(VMUL(LDK(KP1_847759065), T12), VMUL(LDK(KP765366864), TZ)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 12)]), VADD(VMUL(LDK(KP1_913880671), TT), VMUL(LDK(KP580569354), TW)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 13)]), VSUB(VMUL(LDK(KP1_961570560), TQ), VMUL(LDK(KP390180644), TL)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 14)]), VSUB(VMUL(LDK(KP1_990369453), TA), VMUL(LDK(KP196034280), Tt)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 15)]), VMUL(LDK(KP2_000000000), VADD(T19, T1a)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 16, XSIMD_STRING("o10v_16"), {72, 42, 0, 0}, &GENUS, RODFT10 };
+
+void XSIMD(codelet_o10v_16) (planner *p) {
+     X(kr2r_register) (p, o10v_16, &desc);
+}
+
+#endif
@@ -0,0 +1,624 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o10v_32 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft10 -n 32 -name o10_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 191 FP additions, 109 FP multiplications,
+ * (or, 135 additions, 53 multiplications, 56 fused multiply/add),
+ * 181 stack variables, 39 constants, and 64 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o10v_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       V T2V;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = VADD(T1, Tw);
+	       Ty = VMUL(LDK(KP707106781), VADD(T8, Tp));
+	       Tz = VFMS(LDK(KP707106781), VADD(T9, To), Ty);
+	       TA = VADD(Tx, Tz);
+	       TB = VADD(Tc, Tl);
+	       TC = VADD(T5, Ts);
+	       TD = VFMS(LDK(KP923879532), TC, VMUL(LDK(KP382683432), TB));
+	       TE = VADD(T4, Tt);
+	       TF = VADD(Td, Tk);
+	       TG = VFMS(LDK(KP382683432), TF, VMUL(LDK(KP923879532), TE));
+	       TH = VADD(TD, TG);
+	       TI = VADD(TA, TH);
+	       TJ = VADD(Te, Tj);
+	       TK = VMUL(LDK(KP707106781), VADD(T6, Tr));
+	       TL = VFMA(LDK(KP707106781), VADD(Tb, Tm), TK);
+	       TM = VADD(TJ, TL);
+	       TN = VADD(T3, Tu);
+	       TO = VFMS(LDK(KP707106781), VADD(Tb, Tm), TK);
+	       TP = VADD(TN, TO);
+	       TQ = VFMS(LDK(KP980785280), TP, VMUL(LDK(KP195090322), TM));
+	       TR = VADD(Ta, Tn);
+	       TS = VMUL(LDK(KP707106781), VADD(T2, Tv));
+	       TT = VFMA(LDK(KP707106781), VADD(Tf, Ti), TS);
+	       TU = VADD(TR, TT);
+	       TV = VADD(T7, Tq);
+	       TW = VFMS(LDK(KP707106781), VADD(Tf, Ti), TS);
+	       TX = VADD(TV, TW);
+	       TY = VFMS(LDK(KP831469612), TX, VMUL(LDK(KP555570233), TU));
+	       TZ = VADD(TQ, TY);
+	       T10 = VADD(TI, TZ);
+	       T11 = VADD(Tg, Th);
+	       T12 = VFMA(LDK(KP707106781), VADD(T9, To), Ty);
+	       T13 = VADD(T11, T12);
+	       T14 = VFMA(LDK(KP923879532), TB, VMUL(LDK(KP382683432), TC));
+	       T15 = VFMA(LDK(KP382683432), TE, VMUL(LDK(KP923879532), TF));
+	       T16 = VADD(T14, T15);
+	       T17 = VADD(T13, T16);
+	       T18 = VFMA(LDK(KP980785280), TM, VMUL(LDK(KP195090322), TP));
+	       T19 = VFMA(LDK(KP831469612), TU, VMUL(LDK(KP555570233), TX));
+	       T1a = VADD(T18, T19);
+	       T1b = VADD(T17, T1a);
+	       STA(&(O[0]), VFMA(LDK(KP1_997590912), T1b, VMUL(LDK(KP098135348), T10)), ovs, &(O[0]));
+	       T1c = VSUB(T1, Tw);
+	       T1d = VSUB(Tg, Th);
+	       T1e = VADD(T1c, T1d);
+	       T1f = VSUB(Td, Tk);
+	       T1g = VSUB(T4, Tt);
+	       T1h = VMUL(LDK(KP707106781), VADD(T1f, T1g));
+	       T1i = VSUB(T5, Ts);
+	       T1j = VSUB(Tc, Tl);
+	       T1k = VFMS(LDK(KP707106781), VADD(T1i, T1j), T1h);
+	       T1l = VADD(T1e, T1k);
+	       T1m = VSUB(Tb, Tm);
+	       T1n = VSUB(T6, Tr);
+	       T1o = VADD(T1m, T1n);
+	       T1p = VSUB(T3, Tu);
+	       T1q = VSUB(Te, Tj);
+	       T1r = VADD(T1p, T1q);
+	       T1s = VFMS(LDK(KP923879532), T1r, VMUL(LDK(KP382683432), T1o));
+	       T1t = VSUB(Tf, Ti);
+	       T1u = VSUB(T2, Tv);
+	       T1v = VADD(T1t, T1u);
+	       T1w = VSUB(T7, Tq);
+	       T1x = VSUB(Ta, Tn);
+	       T1y = VADD(T1w, T1x);
+	       T1z = VFMS(LDK(KP382683432), T1y, VMUL(LDK(KP923879532), T1v));
+	       T1A = VADD(T1s, T1z);
+	       T1B = VADD(T1l, T1A);
+	       T1C = VSUB(T9, To);
+	       T1D = VSUB(T8, Tp);
+	       T1E = VADD(T1C, T1D);
+	       T1F = VFMA(LDK(KP707106781), VADD(T1i, T1j), T1h);
+	       T1G = VADD(T1E, T1F);
+	       T1H = VFMA(LDK(KP923879532), T1o, VMUL(LDK(KP382683432), T1r));
+	       T1I = VFMA(LDK(KP382683432), T1v, VMUL(LDK(KP923879532), T1y));
+	       T1J = VADD(T1H, T1I);
+	       T1K = VADD(T1G, T1J);
+	       STA(&(O[WS(os, 1)]), VFMA(LDK(KP1_990369453), T1K, VMUL(LDK(KP196034280), T1B)), ovs, &(O[0]));
+	       T1L = VSUB(T11, T12);
+	       T1M = VSUB(TD, TG);
+	       T1N = VSUB(T1L, T1M);
+	       T1O = VSUB(TN, TO);
+	       T1P = VSUB(TJ, TL);
+	       T1Q = VFMS(LDK(KP831469612), T1P, VMUL(LDK(KP555570233), T1O));
+	       T1R = VSUB(TV, TW);
+	       T1S = VSUB(TR, TT);
+	       T1T = VFMA(LDK(KP195090322), T1S, VMUL(LDK(KP980785280), T1R));
+	       T1U = VSUB(T1Q, T1T);
+	       T1V = VADD(T1N, T1U);
+	       T1W = VSUB(Tx, Tz);
+	       T1X = VSUB(T14, T15);
+	       T1Y = VADD(T1W, T1X);
+	       T1Z = VFMA(LDK(KP831469612), T1O, VMUL(LDK(KP555570233), T1P));
+	       T20 = VFMS(LDK(KP195090322), T1R, VMUL(LDK(KP980785280), T1S));
+	       T21 = VSUB(T1Z, T20);
+	       T22 = VADD(T1Y, T21);
+	       STA(&(O[WS(os, 2)]), VFMS(LDK(KP293460948), T22, VMUL(LDK(KP1_978353019), T1V)), ovs, &(O[0]));
+	       T23 = VSUB(T1c, T1d);
+	       T24 = VSUB(T1C, T1D);
+	       T25 = VSUB(T23, T24);
+	       T26 = VSUB(T1w, T1x);
+	       T27 = VSUB(T1t, T1u);
+	       T28 = VMUL(LDK(KP707106781), VSUB(T26, T27));
+	       T29 = VSUB(T1p, T1q);
+	       T2a = VSUB(T1m, T1n);
+	       T2b = VFMS(LDK(KP707106781), VSUB(T29, T2a), T28);
+	       T2c = VADD(T25, T2b);
+	       T2d = VSUB(T1i, T1j);
+	       T2e = VSUB(T1f, T1g);
+	       T2f = VSUB(T2d, T2e);
+	       T2g = VFMA(LDK(KP707106781), VSUB(T29, T2a), T28);
+	       T2h = VADD(T2f, T2g);
+	       STA(&(O[WS(os, 3)]), VFMA(LDK(KP1_961570560), T2h, VMUL(LDK(KP390180644), T2c)), ovs, &(O[0]));
+	       T2i = VSUB(T1W, T1X);
+	       T2j = VADD(T1Q, T1T);
+	       T2k = VSUB(T2i, T2j);
+	       T2l = VADD(T1L, T1M);
+	       T2m = VADD(T1Z, T20);
+	       T2n = VADD(T2l, T2m);
+	       STA(&(O[WS(os, 4)]), VFMA(LDK(KP1_940062506), T2n, VMUL(LDK(KP485960359), T2k)), ovs, &(O[0]));
+	       T2o = VSUB(T1E, T1F);
+	       T2p = VSUB(T1s, T1z);
+	       T2q = VSUB(T2o, T2p);
+	       T2r = VSUB(T1e, T1k);
+	       T2s = VSUB(T1H, T1I);
+	       T2t = VADD(T2r, T2s);
+	       STA(&(O[WS(os, 5)]), VFMS(LDK(KP580569354), T2t, VMUL(LDK(KP1_913880671), T2q)), ovs, &(O[0]));
+	       T2u = VSUB(T13, T16);
+	       T2v = VSUB(TQ, TY);
+	       T2w = VSUB(T2u, T2v);
+	       T2x = VSUB(TA, TH);
+	       T2y = VSUB(T18, T19);
+	       T2z = VADD(T2x, T2y);
+	       STA(&(O[WS(os, 6)]), VFMS(LDK(KP673779706), T2z, VMUL(LDK(KP1_883088130), T2w)), ovs, &(O[0]));
+	       T2A = VADD(T23, T24);
+	       T2B = VADD(T2d, T2e);
+	       T2C = VSUB(T2A, T2B);
+	       T2D = VADD(T29, T2a);
+	       T2E = VADD(T26, T27);
+	       T2F = VSUB(T2D, T2E);
+	       STA(&(O[WS(os, 7)]), VFMA(LDK(KP1_847759065), T2F, VMUL(LDK(KP765366864), T2C)), ovs, &(O[0]));
+	       T2G = VSUB(T2x, T2y);
+	       T2H = VADD(T2u, T2v);
+	       STA(&(O[WS(os, 8)]), VFMA(LDK(KP1_807978586), T2H, VMUL(LDK(KP855110186), T2G)), ovs, &(O[0]));
+	       T2I = VSUB(T2r, T2s);
+	       T2J = VADD(T2o, T2p);
+	       STA(&(O[WS(os, 9)]), VFMA(LDK(KP1_763842528), T2J, VMUL(LDK(KP942793473), T2I)), ovs, &(O[0]));
+	       T2K = VSUB(T2l, T2m);
+	       T2L = VADD(T2i, T2j);
+	       STA(&(O[WS(os, 10)]), VFMS(LDK(KP1_028205488), T2L, VMUL(LDK(KP1_715457220), T2K)), ovs, &(O[0]));
+	       T2M = VSUB(T2f, T2g);
+	       T2N = VSUB(T25, T2b);
+	       STA(&(O[WS(os, 11)]), VFMS(LDK(KP1_111140466), T2N, VMUL(LDK(KP1_662939224), T2M)), ovs, &(O[0]));
+	       T2O = VSUB(T1Y, T21);
+	       T2P = VSUB(T1N, T1U);
+	       STA(&(O[WS(os, 12)]), VFMA(LDK(KP1_606415062), T2P, VMUL(LDK(KP1_191398608), T2O)), ovs, &(O[0]));
+	       T2Q = VSUB(T1G, T1J);
+	       T2R = VSUB(T1l, T1A);
+	       STA(&(O[WS(os, 13)]), VFMS(LDK(KP1_268786568), T2R, VMUL(LDK(KP1_546020906), T2Q)), ovs, &(O[0]));
+	       T2S = VSUB(T17, T1a);
+	       T2T = VSUB(TI, TZ);
+	       STA(&(O[WS(os, 14)]), VFMS(LDK(KP1_343117909), T2T, VMUL(LDK(KP1_481902250), T2S)), ovs, &(O[0]));
+	       T2U = VADD(T2A, T2B);
+	       T2V = VADD(T2D, T2E);
+	       STA(&(O[WS(os, 15)]), VMUL(LDK(KP1_414213562), VSUB(T2U, T2V)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 16)]), VFMA(LDK(KP1_481902250), T2T, VMUL(LDK(KP1_343117909), T2S)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 17)]), VFMA(LDK(KP1_546020906), T2R, VMUL(LDK(KP1_268786568), T2Q)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 18)]), VFMS(LDK(KP1_606415062), T2O, VMUL(LDK(KP1_191398608), T2P)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 19)]), VFMA(LDK(KP1_662939224), T2N, VMUL(LDK(KP1_111140466), T2M)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 20)]), VFMA(LDK(KP1_715457220), T2L, VMUL(LDK(KP1_028205488), T2K)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 21)]), VFMS(LDK(KP1_763842528), T2I, VMUL(LDK(KP942793473), T2J)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 22)]), VFMS(LDK(KP1_807978586), T2G, VMUL(LDK(KP855110186), T2H)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 23)]), VFMS(LDK(KP1_847759065), T2C, VMUL(LDK(KP765366864), T2F)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 24)]), VFMA(LDK(KP1_883088130), T2z, VMUL(LDK(KP673779706), T2w)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 25)]), VFMA(LDK(KP1_913880671), T2t, VMUL(LDK(KP580569354), T2q)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 26)]), VFMS(LDK(KP1_940062506), T2k, VMUL(LDK(KP485960359), T2n)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 27)]), VFMS(LDK(KP1_961570560), T2c, VMUL(LDK(KP390180644), T2h)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 28)]), VFMA(LDK(KP1_978353019), T22, VMUL(LDK(KP293460948), T1V)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 29)]), VFMS(LDK(KP1_990369453), T1B, VMUL(LDK(KP196034280), T1K)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 30)]), VFMS(LDK(KP1_997590912), T10, VMUL(LDK(KP098135348), T1b)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 31)]), VMUL(LDK(KP2_000000000), VADD(T2U, T2V)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 32, XSIMD_STRING("o10v_32"), {135, 53, 56, 0}, &GENUS, RODFT10 };
+
+void XSIMD(codelet_o10v_32) (planner *p) {
+     X(kr2r_register) (p, o10v_32, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o10v_32 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft10 -n 32 -name o10_32 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 186 FP additions, 104 FP multiplications,
+ * (or, 186 additions, 104 multiplications, 0 fused multiply/add),
+ * 186 stack variables, 39 constants, and 64 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o10v_32(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       V T2V, T2W, T2X, T2Y, T2Z, T30;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = VADD(Tg, Th);
+	       Ty = VMUL(LDK(KP707106781), VADD(T9, To));
+	       Tz = VMUL(LDK(KP707106781), VADD(T8, Tp));
+	       TA = VADD(Ty, Tz);
+	       TB = VADD(Tx, TA);
+	       TC = VADD(Tc, Tl);
+	       TD = VADD(T5, Ts);
+	       TE = VADD(VMUL(LDK(KP923879532), TC), VMUL(LDK(KP382683432), TD));
+	       TF = VADD(T4, Tt);
+	       TG = VADD(Td, Tk);
+	       TH = VADD(VMUL(LDK(KP382683432), TF), VMUL(LDK(KP923879532), TG));
+	       TI = VADD(TE, TH);
+	       TJ = VADD(TB, TI);
+	       TK = VADD(Te, Tj);
+	       TL = VMUL(LDK(KP707106781), VADD(Tb, Tm));
+	       TM = VMUL(LDK(KP707106781), VADD(T6, Tr));
+	       TN = VADD(TL, TM);
+	       TO = VADD(TK, TN);
+	       TP = VADD(T3, Tu);
+	       TQ = VSUB(TL, TM);
+	       TR = VADD(TP, TQ);
+	       TS = VADD(VMUL(LDK(KP980785280), TO), VMUL(LDK(KP195090322), TR));
+	       TT = VADD(Ta, Tn);
+	       TU = VMUL(LDK(KP707106781), VADD(Tf, Ti));
+	       TV = VMUL(LDK(KP707106781), VADD(T2, Tv));
+	       TW = VADD(TU, TV);
+	       TX = VADD(TT, TW);
+	       TY = VADD(T7, Tq);
+	       TZ = VSUB(TU, TV);
+	       T10 = VADD(TY, TZ);
+	       T11 = VADD(VMUL(LDK(KP831469612), TX), VMUL(LDK(KP555570233), T10));
+	       T12 = VADD(TS, T11);
+	       T13 = VADD(TJ, T12);
+	       T14 = VADD(T1, Tw);
+	       T15 = VSUB(Ty, Tz);
+	       T16 = VADD(T14, T15);
+	       T17 = VSUB(VMUL(LDK(KP923879532), TD), VMUL(LDK(KP382683432), TC));
+	       T18 = VSUB(VMUL(LDK(KP382683432), TG), VMUL(LDK(KP923879532), TF));
+	       T19 = VADD(T17, T18);
+	       T1a = VADD(T16, T19);
+	       T1b = VSUB(VMUL(LDK(KP980785280), TR), VMUL(LDK(KP195090322), TO));
+	       T1c = VSUB(VMUL(LDK(KP831469612), T10), VMUL(LDK(KP555570233), TX));
+	       T1d = VADD(T1b, T1c);
+	       T1e = VADD(T1a, T1d);
+	       STA(&(O[0]), VADD(VMUL(LDK(KP1_997590912), T13), VMUL(LDK(KP098135348), T1e)), ovs, &(O[0]));
+	       T1f = VSUB(T9, To);
+	       T1g = VSUB(T8, Tp);
+	       T1h = VADD(T1f, T1g);
+	       T1i = VSUB(T5, Ts);
+	       T1j = VSUB(Tc, Tl);
+	       T1k = VMUL(LDK(KP707106781), VADD(T1i, T1j));
+	       T1l = VSUB(Td, Tk);
+	       T1m = VSUB(T4, Tt);
+	       T1n = VMUL(LDK(KP707106781), VADD(T1l, T1m));
+	       T1o = VADD(T1k, T1n);
+	       T1p = VADD(T1h, T1o);
+	       T1q = VSUB(Tb, Tm);
+	       T1r = VSUB(T6, Tr);
+	       T1s = VADD(T1q, T1r);
+	       T1t = VSUB(T3, Tu);
+	       T1u = VSUB(Te, Tj);
+	       T1v = VADD(T1t, T1u);
+	       T1w = VADD(VMUL(LDK(KP923879532), T1s), VMUL(LDK(KP382683432), T1v));
+	       T1x = VSUB(Tf, Ti);
+	       T1y = VSUB(T2, Tv);
+	       T1z = VADD(T1x, T1y);
+	       T1A = VSUB(T7, Tq);
+	       T1B = VSUB(Ta, Tn);
+	       T1C = VADD(T1A, T1B);
+	       T1D = VADD(VMUL(LDK(KP382683432), T1z), VMUL(LDK(KP923879532), T1C));
+	       T1E = VADD(T1w, T1D);
+	       T1F = VADD(T1p, T1E);
+	       T1G = VSUB(T1, Tw);
+	       T1H = VSUB(Tg, Th);
+	       T1I = VADD(T1G, T1H);
+	       T1J = VSUB(T1k, T1n);
+	       T1K = VADD(T1I, T1J);
+	       T1L = VSUB(VMUL(LDK(KP923879532), T1v), VMUL(LDK(KP382683432), T1s));
+	       T1M = VSUB(VMUL(LDK(KP382683432), T1C), VMUL(LDK(KP923879532), T1z));
+	       T1N = VADD(T1L, T1M);
+	       T1O = VADD(T1K, T1N);
+	       STA(&(O[WS(os, 1)]), VADD(VMUL(LDK(KP1_990369453), T1F), VMUL(LDK(KP196034280), T1O)), ovs, &(O[0]));
+	       T1P = VSUB(T14, T15);
+	       T1Q = VSUB(TE, TH);
+	       T1R = VADD(T1P, T1Q);
+	       T1S = VSUB(TP, TQ);
+	       T1T = VSUB(TK, TN);
+	       T1U = VADD(VMUL(LDK(KP831469612), T1S), VMUL(LDK(KP555570233), T1T));
+	       T1V = VSUB(TY, TZ);
+	       T1W = VSUB(TT, TW);
+	       T1X = VSUB(VMUL(LDK(KP195090322), T1V), VMUL(LDK(KP980785280), T1W));
+	       T1Y = VSUB(T1U, T1X);
+	       T1Z = VADD(T1R, T1Y);
+	       T20 = VSUB(Tx, TA);
+	       T21 = VSUB(T17, T18);
+	       T22 = VSUB(T20, T21);
+	       T23 = VSUB(VMUL(LDK(KP831469612), T1T), VMUL(LDK(KP555570233), T1S));
+	       T24 = VADD(VMUL(LDK(KP195090322), T1W), VMUL(LDK(KP980785280), T1V));
+	       T25 = VSUB(T23, T24);
+	       T26 = VADD(T22, T25);
+	       STA(&(O[WS(os, 2)]), VSUB(VMUL(LDK(KP293460948), T1Z), VMUL(LDK(KP1_978353019), T26)), ovs, &(O[0]));
+	       T27 = VSUB(T1i, T1j);
+	       T28 = VSUB(T1l, T1m);
+	       T29 = VSUB(T27, T28);
+	       T2a = VSUB(T1t, T1u);
+	       T2b = VSUB(T1q, T1r);
+	       T2c = VMUL(LDK(KP707106781), VSUB(T2a, T2b));
+	       T2d = VSUB(T1A, T1B);
+	       T2e = VSUB(T1x, T1y);
+	       T2f = VMUL(LDK(KP707106781), VSUB(T2d, T2e));
+	       T2g = VADD(T2c, T2f);
+	       T2h = VADD(T29, T2g);
+	       T2i = VSUB(T1G, T1H);
+	       T2j = VSUB(T1f, T1g);
+	       T2k = VSUB(T2i, T2j);
+	       T2l = VSUB(T2c, T2f);
+	       T2m = VADD(T2k, T2l);
+	       STA(&(O[WS(os, 3)]), VADD(VMUL(LDK(KP1_961570560), T2h), VMUL(LDK(KP390180644), T2m)), ovs, &(O[0]));
+	       T2n = VADD(T20, T21);
+	       T2o = VADD(T1U, T1X);
+	       T2p = VADD(T2n, T2o);
+	       T2q = VSUB(T1P, T1Q);
+	       T2r = VADD(T23, T24);
+	       T2s = VSUB(T2q, T2r);
+	       STA(&(O[WS(os, 4)]), VADD(VMUL(LDK(KP1_940062506), T2p), VMUL(LDK(KP485960359), T2s)), ovs, &(O[0]));
+	       T2t = VSUB(T1I, T1J);
+	       T2u = VSUB(T1w, T1D);
+	       T2v = VADD(T2t, T2u);
+	       T2w = VSUB(T1h, T1o);
+	       T2x = VSUB(T1L, T1M);
+	       T2y = VSUB(T2w, T2x);
+	       STA(&(O[WS(os, 5)]), VSUB(VMUL(LDK(KP580569354), T2v), VMUL(LDK(KP1_913880671), T2y)), ovs, &(O[0]));
+	       T2z = VSUB(T16, T19);
+	       T2A = VSUB(TS, T11);
+	       T2B = VADD(T2z, T2A);
+	       T2C = VSUB(TB, TI);
+	       T2D = VSUB(T1b, T1c);
+	       T2E = VSUB(T2C, T2D);
+	       STA(&(O[WS(os, 6)]), VSUB(VMUL(LDK(KP673779706), T2B), VMUL(LDK(KP1_883088130), T2E)), ovs, &(O[0]));
+	       T2F = VADD(T2a, T2b);
+	       T2G = VADD(T2d, T2e);
+	       T2H = VSUB(T2F, T2G);
+	       T2I = VADD(T2i, T2j);
+	       T2J = VADD(T27, T28);
+	       T2K = VSUB(T2I, T2J);
+	       STA(&(O[WS(os, 7)]), VADD(VMUL(LDK(KP1_847759065), T2H), VMUL(LDK(KP765366864), T2K)), ovs, &(O[0]));
+	       T2L = VADD(T2C, T2D);
+	       T2M = VSUB(T2z, T2A);
+	       STA(&(O[WS(os, 8)]), VADD(VMUL(LDK(KP1_807978586), T2L), VMUL(LDK(KP855110186), T2M)), ovs, &(O[0]));
+	       T2N = VADD(T2w, T2x);
+	       T2O = VSUB(T2t, T2u);
+	       STA(&(O[WS(os, 9)]), VADD(VMUL(LDK(KP1_763842528), T2N), VMUL(LDK(KP942793473), T2O)), ovs, &(O[0]));
+	       T2P = VADD(T2q, T2r);
+	       T2Q = VSUB(T2n, T2o);
+	       STA(&(O[WS(os, 10)]), VSUB(VMUL(LDK(KP1_028205488), T2P), VMUL(LDK(KP1_715457220), T2Q)), ovs, &(O[0]));
+	       T2R = VSUB(T2k, T2l);
+	       T2S = VSUB(T29, T2g);
+	       STA(&(O[WS(os, 11)]), VSUB(VMUL(LDK(KP1_111140466), T2R), VMUL(LDK(KP1_662939224), T2S)), ovs, &(O[0]));
+	       T2T = VSUB(T22, T25);
+	       T2U = VSUB(T1R, T1Y);
+	       STA(&(O[WS(os, 12)]), VADD(VMUL(LDK(KP1_606415062), T2T), VMUL(LDK(KP1_191398608), T2U)), ovs, &(O[0]));
+	       T2V = VSUB(T1K, T1N);
+	       T2W = VSUB(T1p, T1E);
+	       STA(&(O[WS(os, 13)]), VSUB(VMUL(LDK(KP1_268786568), T2V), VMUL(LDK(KP1_546020906), T2W)), ovs, &(O[0]));
+	       T2X = VSUB(T1a, T1d);
+	       T2Y = VSUB(TJ, T12);
+	       STA(&(O[WS(os, 14)]), VSUB(VMUL(LDK(KP1_343117909), T2X), VMUL(LDK(KP1_481902250), T2Y)), ovs, &(O[0]));
+	       T2Z = VADD(T2I, T2J);
+	       T30 = VADD(T2F, T2G);
+	       STA(&(O[WS(os, 15)]), VMUL(LDK(KP1_414213562), VSUB(T2Z, T30)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 16)]), VADD(VMUL(LDK(KP1_481902250), T2X), VMUL(LDK(KP1_343117909), T2Y)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 17)]), VADD(VMUL(LDK(KP1_546020906), T2V), VMUL(LDK(KP1_268786568), T2W)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 18)]), VSUB(VMUL(LDK(KP1_606415062), T2U), VMUL(LDK(KP1_191398608), T2T)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 19)]), VADD(VMUL(LDK(KP1_662939224), T2R), VMUL(LDK(KP1_111140466), T2S)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 20)]), VADD(VMUL(LDK(KP1_715457220), T2P), VMUL(LDK(KP1_028205488), T2Q)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 21)]), VSUB(VMUL(LDK(KP1_763842528), T2O), VMUL(LDK(KP942793473), T2N)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 22)]), VSUB(VMUL(LDK(KP1_807978586), T2M), VMUL(LDK(KP855110186), T2L)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 23)]), VSUB(VMUL(LDK(KP1_847759065), T2K), VMUL(LDK(KP765366864), T2H)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 24)]), VADD(VMUL(LDK(KP1_883088130), T2B), VMUL(LDK(KP673779706), T2E)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 25)]), VADD(VMUL(LDK(KP1_913880671), T2v), VMUL(LDK(KP580569354), T2y)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 26)]), VSUB(VMUL(LDK(KP1_940062506), T2s), VMUL(LDK(KP485960359), T2p)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 27)]), VSUB(VMUL(LDK(KP1_961570560), T2m), VMUL(LDK(KP390180644), T2h)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 28)]), VADD(VMUL(LDK(KP1_978353019), T1Z), VMUL(LDK(KP293460948), T26)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 29)]), VSUB(VMUL(LDK(KP1_990369453), T1O), VMUL(LDK(KP196034280), T1F)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 30)]), VSUB(VMUL(LDK(KP1_997590912), T1e), VMUL(LDK(KP098135348), T13)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 31)]), VMUL(LDK(KP2_000000000), VADD(T2Z, T30)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 32, XSIMD_STRING("o10v_32"), {186, 104, 0, 0}, &GENUS, RODFT10 };
+
+void XSIMD(codelet_o10v_32) (planner *p) {
+     X(kr2r_register) (p, o10v_32, &desc);
+}
+
+#endif
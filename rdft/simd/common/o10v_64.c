@@ -0,0 +1,1347 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o10v_64 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft10 -n 64 -name o10_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 466 FP additions, 260 FP multiplications,
+ * (or, 332 additions, 126 multiplications, 134 fused multiply/add),
+ * 446 stack variables, 79 constants, and 128 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o10v_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DVK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DVK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DVK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DVK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DVK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DVK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DVK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DVK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DVK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DVK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DVK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DVK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DVK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DVK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DVK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DVK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DVK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DVK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DVK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DVK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DVK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DVK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DVK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       V T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       V T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       V T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       V T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       V T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       V T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       V T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       V T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       V T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       V T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       V T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       V T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       V T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       V T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       V T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       V T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       V T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       V T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       V T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       V T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       V T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       V T6Z, T70, T71, T72, T73, T74, T75, T76, T77, T78, T79, T7a;
+	       V T7b, T7c;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = LDA(&(I[WS(is, 32)]), ivs, &(I[0]));
+	       Ty = LDA(&(I[WS(is, 33)]), ivs, &(I[0]));
+	       Tz = LDA(&(I[WS(is, 34)]), ivs, &(I[0]));
+	       TA = LDA(&(I[WS(is, 35)]), ivs, &(I[0]));
+	       TB = LDA(&(I[WS(is, 36)]), ivs, &(I[0]));
+	       TC = LDA(&(I[WS(is, 37)]), ivs, &(I[0]));
+	       TD = LDA(&(I[WS(is, 38)]), ivs, &(I[0]));
+	       TE = LDA(&(I[WS(is, 39)]), ivs, &(I[0]));
+	       TF = LDA(&(I[WS(is, 40)]), ivs, &(I[0]));
+	       TG = LDA(&(I[WS(is, 41)]), ivs, &(I[0]));
+	       TH = LDA(&(I[WS(is, 42)]), ivs, &(I[0]));
+	       TI = LDA(&(I[WS(is, 43)]), ivs, &(I[0]));
+	       TJ = LDA(&(I[WS(is, 44)]), ivs, &(I[0]));
+	       TK = LDA(&(I[WS(is, 45)]), ivs, &(I[0]));
+	       TL = LDA(&(I[WS(is, 46)]), ivs, &(I[0]));
+	       TM = LDA(&(I[WS(is, 47)]), ivs, &(I[0]));
+	       TN = LDA(&(I[WS(is, 48)]), ivs, &(I[0]));
+	       TO = LDA(&(I[WS(is, 49)]), ivs, &(I[0]));
+	       TP = LDA(&(I[WS(is, 50)]), ivs, &(I[0]));
+	       TQ = LDA(&(I[WS(is, 51)]), ivs, &(I[0]));
+	       TR = LDA(&(I[WS(is, 52)]), ivs, &(I[0]));
+	       TS = LDA(&(I[WS(is, 53)]), ivs, &(I[0]));
+	       TT = LDA(&(I[WS(is, 54)]), ivs, &(I[0]));
+	       TU = LDA(&(I[WS(is, 55)]), ivs, &(I[0]));
+	       TV = LDA(&(I[WS(is, 56)]), ivs, &(I[0]));
+	       TW = LDA(&(I[WS(is, 57)]), ivs, &(I[0]));
+	       TX = LDA(&(I[WS(is, 58)]), ivs, &(I[0]));
+	       TY = LDA(&(I[WS(is, 59)]), ivs, &(I[0]));
+	       TZ = LDA(&(I[WS(is, 60)]), ivs, &(I[0]));
+	       T10 = LDA(&(I[WS(is, 61)]), ivs, &(I[0]));
+	       T11 = LDA(&(I[WS(is, 62)]), ivs, &(I[0]));
+	       T12 = LDA(&(I[WS(is, 63)]), ivs, &(I[0]));
+	       T13 = VADD(T1, T12);
+	       T14 = VMUL(LDK(KP707106781), VADD(Tg, TN));
+	       T15 = VFMS(LDK(KP707106781), VADD(Th, TM), T14);
+	       T16 = VADD(T13, T15);
+	       T17 = VADD(To, TF);
+	       T18 = VADD(T9, TU);
+	       T19 = VFMS(LDK(KP923879532), T18, VMUL(LDK(KP382683432), T17));
+	       T1a = VADD(T8, TV);
+	       T1b = VADD(Tp, TE);
+	       T1c = VFMS(LDK(KP382683432), T1b, VMUL(LDK(KP923879532), T1a));
+	       T1d = VADD(T19, T1c);
+	       T1e = VADD(T16, T1d);
+	       T1f = VADD(Ts, TB);
+	       T1g = VMUL(LDK(KP707106781), VADD(Tc, TR));
+	       T1h = VFMA(LDK(KP707106781), VADD(Tl, TI), T1g);
+	       T1i = VADD(T1f, T1h);
+	       T1j = VADD(T5, TY);
+	       T1k = VFMS(LDK(KP707106781), VADD(Tl, TI), T1g);
+	       T1l = VADD(T1j, T1k);
+	       T1m = VFMS(LDK(KP980785280), T1l, VMUL(LDK(KP195090322), T1i));
+	       T1n = VADD(Tk, TJ);
+	       T1o = VMUL(LDK(KP707106781), VADD(T4, TZ));
+	       T1p = VFMA(LDK(KP707106781), VADD(Tt, TA), T1o);
+	       T1q = VADD(T1n, T1p);
+	       T1r = VADD(Td, TQ);
+	       T1s = VFMS(LDK(KP707106781), VADD(Tt, TA), T1o);
+	       T1t = VADD(T1r, T1s);
+	       T1u = VFMS(LDK(KP831469612), T1t, VMUL(LDK(KP555570233), T1q));
+	       T1v = VADD(T1m, T1u);
+	       T1w = VADD(T1e, T1v);
+	       T1x = VADD(Tu, Tz);
+	       T1y = VMUL(LDK(KP707106781), VADD(Te, TP));
+	       T1z = VFMA(LDK(KP707106781), VADD(Tj, TK), T1y);
+	       T1A = VADD(T1x, T1z);
+	       T1B = VADD(Tb, TS);
+	       T1C = VADD(Tm, TH);
+	       T1D = VFMA(LDK(KP923879532), T1C, VMUL(LDK(KP382683432), T1B));
+	       T1E = VADD(Tr, TC);
+	       T1F = VADD(T6, TX);
+	       T1G = VFMA(LDK(KP382683432), T1F, VMUL(LDK(KP923879532), T1E));
+	       T1H = VADD(T1D, T1G);
+	       T1I = VADD(T1A, T1H);
+	       T1J = VADD(T3, T10);
+	       T1K = VFMS(LDK(KP707106781), VADD(Tj, TK), T1y);
+	       T1L = VADD(T1J, T1K);
+	       T1M = VFMS(LDK(KP923879532), T1B, VMUL(LDK(KP382683432), T1C));
+	       T1N = VFMS(LDK(KP382683432), T1E, VMUL(LDK(KP923879532), T1F));
+	       T1O = VADD(T1M, T1N);
+	       T1P = VADD(T1L, T1O);
+	       T1Q = VFMS(LDK(KP995184726), T1P, VMUL(LDK(KP098017140), T1I));
+	       T1R = VADD(Tq, TD);
+	       T1S = VMUL(LDK(KP707106781), VADD(Ta, TT));
+	       T1T = VFMA(LDK(KP707106781), VADD(Tn, TG), T1S);
+	       T1U = VADD(T1R, T1T);
+	       T1V = VADD(Tf, TO);
+	       T1W = VADD(Ti, TL);
+	       T1X = VFMA(LDK(KP923879532), T1W, VMUL(LDK(KP382683432), T1V));
+	       T1Y = VADD(Tv, Ty);
+	       T1Z = VADD(T2, T11);
+	       T20 = VFMA(LDK(KP382683432), T1Z, VMUL(LDK(KP923879532), T1Y));
+	       T21 = VADD(T1X, T20);
+	       T22 = VADD(T1U, T21);
+	       T23 = VADD(T7, TW);
+	       T24 = VFMS(LDK(KP707106781), VADD(Tn, TG), T1S);
+	       T25 = VADD(T23, T24);
+	       T26 = VFMS(LDK(KP923879532), T1V, VMUL(LDK(KP382683432), T1W));
+	       T27 = VFMS(LDK(KP382683432), T1Y, VMUL(LDK(KP923879532), T1Z));
+	       T28 = VADD(T26, T27);
+	       T29 = VADD(T25, T28);
+	       T2a = VFMS(LDK(KP956940335), T29, VMUL(LDK(KP290284677), T22));
+	       T2b = VADD(T1Q, T2a);
+	       T2c = VADD(T1w, T2b);
+	       T2d = VADD(Tw, Tx);
+	       T2e = VFMA(LDK(KP707106781), VADD(Th, TM), T14);
+	       T2f = VADD(T2d, T2e);
+	       T2g = VFMA(LDK(KP923879532), T17, VMUL(LDK(KP382683432), T18));
+	       T2h = VFMA(LDK(KP382683432), T1a, VMUL(LDK(KP923879532), T1b));
+	       T2i = VADD(T2g, T2h);
+	       T2j = VADD(T2f, T2i);
+	       T2k = VFMA(LDK(KP980785280), T1i, VMUL(LDK(KP195090322), T1l));
+	       T2l = VFMA(LDK(KP831469612), T1q, VMUL(LDK(KP555570233), T1t));
+	       T2m = VADD(T2k, T2l);
+	       T2n = VADD(T2j, T2m);
+	       T2o = VFMA(LDK(KP995184726), T1I, VMUL(LDK(KP098017140), T1P));
+	       T2p = VFMA(LDK(KP956940335), T22, VMUL(LDK(KP290284677), T29));
+	       T2q = VADD(T2o, T2p);
+	       T2r = VADD(T2n, T2q);
+	       STA(&(O[0]), VFMA(LDK(KP1_999397637), T2r, VMUL(LDK(KP049082457), T2c)), ovs, &(O[0]));
+	       T2s = VSUB(T1, T12);
+	       T2t = VSUB(Tw, Tx);
+	       T2u = VADD(T2s, T2t);
+	       T2v = VSUB(Tp, TE);
+	       T2w = VSUB(T8, TV);
+	       T2x = VMUL(LDK(KP707106781), VADD(T2v, T2w));
+	       T2y = VSUB(T9, TU);
+	       T2z = VSUB(To, TF);
+	       T2A = VFMS(LDK(KP707106781), VADD(T2y, T2z), T2x);
+	       T2B = VADD(T2u, T2A);
+	       T2C = VSUB(Tl, TI);
+	       T2D = VSUB(Tc, TR);
+	       T2E = VADD(T2C, T2D);
+	       T2F = VSUB(T5, TY);
+	       T2G = VSUB(Ts, TB);
+	       T2H = VADD(T2F, T2G);
+	       T2I = VFMS(LDK(KP923879532), T2H, VMUL(LDK(KP382683432), T2E));
+	       T2J = VSUB(Tt, TA);
+	       T2K = VSUB(T4, TZ);
+	       T2L = VADD(T2J, T2K);
+	       T2M = VSUB(Td, TQ);
+	       T2N = VSUB(Tk, TJ);
+	       T2O = VADD(T2M, T2N);
+	       T2P = VFMS(LDK(KP382683432), T2O, VMUL(LDK(KP923879532), T2L));
+	       T2Q = VADD(T2I, T2P);
+	       T2R = VADD(T2B, T2Q);
+	       T2S = VSUB(Tj, TK);
+	       T2T = VSUB(Te, TP);
+	       T2U = VADD(T2S, T2T);
+	       T2V = VSUB(Tr, TC);
+	       T2W = VSUB(T6, TX);
+	       T2X = VMUL(LDK(KP707106781), VADD(T2V, T2W));
+	       T2Y = VSUB(Tb, TS);
+	       T2Z = VSUB(Tm, TH);
+	       T30 = VFMA(LDK(KP707106781), VADD(T2Y, T2Z), T2X);
+	       T31 = VADD(T2U, T30);
+	       T32 = VSUB(T3, T10);
+	       T33 = VSUB(Tu, Tz);
+	       T34 = VADD(T32, T33);
+	       T35 = VFMS(LDK(KP707106781), VADD(T2Y, T2Z), T2X);
+	       T36 = VADD(T34, T35);
+	       T37 = VFMS(LDK(KP980785280), T36, VMUL(LDK(KP195090322), T31));
+	       T38 = VSUB(Tn, TG);
+	       T39 = VSUB(Ta, TT);
+	       T3a = VADD(T38, T39);
+	       T3b = VSUB(Tv, Ty);
+	       T3c = VSUB(T2, T11);
+	       T3d = VMUL(LDK(KP707106781), VADD(T3b, T3c));
+	       T3e = VSUB(Tf, TO);
+	       T3f = VSUB(Ti, TL);
+	       T3g = VFMA(LDK(KP707106781), VADD(T3e, T3f), T3d);
+	       T3h = VADD(T3a, T3g);
+	       T3i = VSUB(T7, TW);
+	       T3j = VSUB(Tq, TD);
+	       T3k = VADD(T3i, T3j);
+	       T3l = VFMS(LDK(KP707106781), VADD(T3e, T3f), T3d);
+	       T3m = VADD(T3k, T3l);
+	       T3n = VFMS(LDK(KP831469612), T3m, VMUL(LDK(KP555570233), T3h));
+	       T3o = VADD(T37, T3n);
+	       T3p = VADD(T2R, T3o);
+	       T3q = VSUB(Th, TM);
+	       T3r = VSUB(Tg, TN);
+	       T3s = VADD(T3q, T3r);
+	       T3t = VFMA(LDK(KP707106781), VADD(T2y, T2z), T2x);
+	       T3u = VADD(T3s, T3t);
+	       T3v = VFMA(LDK(KP923879532), T2E, VMUL(LDK(KP382683432), T2H));
+	       T3w = VFMA(LDK(KP382683432), T2L, VMUL(LDK(KP923879532), T2O));
+	       T3x = VADD(T3v, T3w);
+	       T3y = VADD(T3u, T3x);
+	       T3z = VFMA(LDK(KP980785280), T31, VMUL(LDK(KP195090322), T36));
+	       T3A = VFMA(LDK(KP831469612), T3h, VMUL(LDK(KP555570233), T3m));
+	       T3B = VADD(T3z, T3A);
+	       T3C = VADD(T3y, T3B);
+	       STA(&(O[WS(os, 1)]), VFMA(LDK(KP1_997590912), T3C, VMUL(LDK(KP098135348), T3p)), ovs, &(O[0]));
+	       T3D = VSUB(T2d, T2e);
+	       T3E = VSUB(T19, T1c);
+	       T3F = VSUB(T3D, T3E);
+	       T3G = VSUB(T1j, T1k);
+	       T3H = VSUB(T1f, T1h);
+	       T3I = VFMS(LDK(KP831469612), T3H, VMUL(LDK(KP555570233), T3G));
+	       T3J = VSUB(T1r, T1s);
+	       T3K = VSUB(T1n, T1p);
+	       T3L = VFMA(LDK(KP195090322), T3K, VMUL(LDK(KP980785280), T3J));
+	       T3M = VSUB(T3I, T3L);
+	       T3N = VADD(T3F, T3M);
+	       T3O = VSUB(T1J, T1K);
+	       T3P = VSUB(T1D, T1G);
+	       T3Q = VADD(T3O, T3P);
+	       T3R = VSUB(T1x, T1z);
+	       T3S = VSUB(T1M, T1N);
+	       T3T = VSUB(T3R, T3S);
+	       T3U = VFMS(LDK(KP956940335), T3T, VMUL(LDK(KP290284677), T3Q));
+	       T3V = VSUB(T23, T24);
+	       T3W = VSUB(T1X, T20);
+	       T3X = VADD(T3V, T3W);
+	       T3Y = VSUB(T1R, T1T);
+	       T3Z = VSUB(T26, T27);
+	       T40 = VSUB(T3Y, T3Z);
+	       T41 = VFMS(LDK(KP634393284), T40, VMUL(LDK(KP773010453), T3X));
+	       T42 = VADD(T3U, T41);
+	       T43 = VADD(T3N, T42);
+	       T44 = VSUB(T13, T15);
+	       T45 = VSUB(T2g, T2h);
+	       T46 = VADD(T44, T45);
+	       T47 = VFMA(LDK(KP831469612), T3G, VMUL(LDK(KP555570233), T3H));
+	       T48 = VFMS(LDK(KP195090322), T3J, VMUL(LDK(KP980785280), T3K));
+	       T49 = VSUB(T47, T48);
+	       T4a = VADD(T46, T49);
+	       T4b = VFMA(LDK(KP956940335), T3Q, VMUL(LDK(KP290284677), T3T));
+	       T4c = VFMA(LDK(KP634393284), T3X, VMUL(LDK(KP773010453), T40));
+	       T4d = VADD(T4b, T4c);
+	       T4e = VADD(T4a, T4d);
+	       STA(&(O[WS(os, 2)]), VFMS(LDK(KP147129127), T4e, VMUL(LDK(KP1_994580913), T43)), ovs, &(O[0]));
+	       T4f = VSUB(T2s, T2t);
+	       T4g = VSUB(T3q, T3r);
+	       T4h = VSUB(T4f, T4g);
+	       T4i = VSUB(T2M, T2N);
+	       T4j = VSUB(T2J, T2K);
+	       T4k = VMUL(LDK(KP707106781), VSUB(T4i, T4j));
+	       T4l = VSUB(T2F, T2G);
+	       T4m = VSUB(T2C, T2D);
+	       T4n = VFMS(LDK(KP707106781), VSUB(T4l, T4m), T4k);
+	       T4o = VADD(T4h, T4n);
+	       T4p = VSUB(T2Y, T2Z);
+	       T4q = VSUB(T2V, T2W);
+	       T4r = VSUB(T4p, T4q);
+	       T4s = VSUB(T32, T33);
+	       T4t = VSUB(T2S, T2T);
+	       T4u = VSUB(T4s, T4t);
+	       T4v = VFMS(LDK(KP923879532), T4u, VMUL(LDK(KP382683432), T4r));
+	       T4w = VSUB(T3e, T3f);
+	       T4x = VSUB(T3b, T3c);
+	       T4y = VSUB(T4w, T4x);
+	       T4z = VSUB(T3i, T3j);
+	       T4A = VSUB(T38, T39);
+	       T4B = VSUB(T4z, T4A);
+	       T4C = VFMS(LDK(KP382683432), T4B, VMUL(LDK(KP923879532), T4y));
+	       T4D = VADD(T4v, T4C);
+	       T4E = VADD(T4o, T4D);
+	       T4F = VSUB(T2y, T2z);
+	       T4G = VSUB(T2v, T2w);
+	       T4H = VSUB(T4F, T4G);
+	       T4I = VFMA(LDK(KP707106781), VSUB(T4l, T4m), T4k);
+	       T4J = VADD(T4H, T4I);
+	       T4K = VFMA(LDK(KP923879532), T4r, VMUL(LDK(KP382683432), T4u));
+	       T4L = VFMA(LDK(KP382683432), T4y, VMUL(LDK(KP923879532), T4B));
+	       T4M = VADD(T4K, T4L);
+	       T4N = VADD(T4J, T4M);
+	       STA(&(O[WS(os, 3)]), VFMA(LDK(KP1_990369453), T4N, VMUL(LDK(KP196034280), T4E)), ovs, &(O[0]));
+	       T4O = VSUB(T44, T45);
+	       T4P = VADD(T3I, T3L);
+	       T4Q = VSUB(T4O, T4P);
+	       T4R = VADD(T3R, T3S);
+	       T4S = VSUB(T3O, T3P);
+	       T4T = VFMS(LDK(KP881921264), T4S, VMUL(LDK(KP471396736), T4R));
+	       T4U = VADD(T3Y, T3Z);
+	       T4V = VSUB(T3V, T3W);
+	       T4W = VFMS(LDK(KP098017140), T4V, VMUL(LDK(KP995184726), T4U));
+	       T4X = VADD(T4T, T4W);
+	       T4Y = VADD(T4Q, T4X);
+	       T4Z = VADD(T3D, T3E);
+	       T50 = VADD(T47, T48);
+	       T51 = VADD(T4Z, T50);
+	       T52 = VFMA(LDK(KP881921264), T4R, VMUL(LDK(KP471396736), T4S));
+	       T53 = VFMA(LDK(KP098017140), T4U, VMUL(LDK(KP995184726), T4V));
+	       T54 = VADD(T52, T53);
+	       T55 = VADD(T51, T54);
+	       STA(&(O[WS(os, 4)]), VFMA(LDK(KP1_984959069), T55, VMUL(LDK(KP244821350), T4Y)), ovs, &(O[0]));
+	       T56 = VSUB(T3s, T3t);
+	       T57 = VSUB(T2I, T2P);
+	       T58 = VSUB(T56, T57);
+	       T59 = VSUB(T34, T35);
+	       T5a = VSUB(T2U, T30);
+	       T5b = VFMS(LDK(KP831469612), T5a, VMUL(LDK(KP555570233), T59));
+	       T5c = VSUB(T3k, T3l);
+	       T5d = VSUB(T3a, T3g);
+	       T5e = VFMA(LDK(KP195090322), T5d, VMUL(LDK(KP980785280), T5c));
+	       T5f = VSUB(T5b, T5e);
+	       T5g = VADD(T58, T5f);
+	       T5h = VSUB(T2u, T2A);
+	       T5i = VSUB(T3v, T3w);
+	       T5j = VADD(T5h, T5i);
+	       T5k = VFMA(LDK(KP831469612), T59, VMUL(LDK(KP555570233), T5a));
+	       T5l = VFMS(LDK(KP195090322), T5c, VMUL(LDK(KP980785280), T5d));
+	       T5m = VSUB(T5k, T5l);
+	       T5n = VADD(T5j, T5m);
+	       STA(&(O[WS(os, 5)]), VFMS(LDK(KP293460948), T5n, VMUL(LDK(KP1_978353019), T5g)), ovs, &(O[0]));
+	       T5o = VSUB(T2f, T2i);
+	       T5p = VSUB(T1m, T1u);
+	       T5q = VSUB(T5o, T5p);
+	       T5r = VSUB(T1L, T1O);
+	       T5s = VSUB(T1A, T1H);
+	       T5t = VFMS(LDK(KP773010453), T5s, VMUL(LDK(KP634393284), T5r));
+	       T5u = VSUB(T25, T28);
+	       T5v = VSUB(T1U, T21);
+	       T5w = VFMA(LDK(KP471396736), T5v, VMUL(LDK(KP881921264), T5u));
+	       T5x = VSUB(T5t, T5w);
+	       T5y = VADD(T5q, T5x);
+	       T5z = VSUB(T16, T1d);
+	       T5A = VSUB(T2k, T2l);
+	       T5B = VADD(T5z, T5A);
+	       T5C = VFMA(LDK(KP773010453), T5r, VMUL(LDK(KP634393284), T5s));
+	       T5D = VFMS(LDK(KP471396736), T5u, VMUL(LDK(KP881921264), T5v));
+	       T5E = VSUB(T5C, T5D);
+	       T5F = VADD(T5B, T5E);
+	       STA(&(O[WS(os, 6)]), VFMS(LDK(KP341923777), T5F, VMUL(LDK(KP1_970555284), T5y)), ovs, &(O[0]));
+	       T5G = VADD(T4f, T4g);
+	       T5H = VADD(T4F, T4G);
+	       T5I = VSUB(T5G, T5H);
+	       T5J = VADD(T4z, T4A);
+	       T5K = VADD(T4w, T4x);
+	       T5L = VMUL(LDK(KP707106781), VSUB(T5J, T5K));
+	       T5M = VADD(T4s, T4t);
+	       T5N = VADD(T4p, T4q);
+	       T5O = VFMS(LDK(KP707106781), VSUB(T5M, T5N), T5L);
+	       T5P = VADD(T5I, T5O);
+	       T5Q = VADD(T4l, T4m);
+	       T5R = VADD(T4i, T4j);
+	       T5S = VSUB(T5Q, T5R);
+	       T5T = VFMA(LDK(KP707106781), VSUB(T5M, T5N), T5L);
+	       T5U = VADD(T5S, T5T);
+	       STA(&(O[WS(os, 7)]), VFMA(LDK(KP1_961570560), T5U, VMUL(LDK(KP390180644), T5P)), ovs, &(O[0]));
+	       T5V = VSUB(T5z, T5A);
+	       T5W = VADD(T5t, T5w);
+	       T5X = VSUB(T5V, T5W);
+	       T5Y = VADD(T5o, T5p);
+	       T5Z = VADD(T5C, T5D);
+	       T60 = VADD(T5Y, T5Z);
+	       STA(&(O[WS(os, 8)]), VFMA(LDK(KP1_951404260), T60, VMUL(LDK(KP438202480), T5X)), ovs, &(O[0]));
+	       T61 = VSUB(T5h, T5i);
+	       T62 = VADD(T5b, T5e);
+	       T63 = VSUB(T61, T62);
+	       T64 = VADD(T56, T57);
+	       T65 = VADD(T5k, T5l);
+	       T66 = VADD(T64, T65);
+	       STA(&(O[WS(os, 9)]), VFMA(LDK(KP1_940062506), T66, VMUL(LDK(KP485960359), T63)), ovs, &(O[0]));
+	       T67 = VSUB(T4Z, T50);
+	       T68 = VSUB(T4T, T4W);
+	       T69 = VSUB(T67, T68);
+	       T6a = VADD(T4O, T4P);
+	       T6b = VSUB(T52, T53);
+	       T6c = VADD(T6a, T6b);
+	       STA(&(O[WS(os, 10)]), VFMS(LDK(KP533425514), T6c, VMUL(LDK(KP1_927552131), T69)), ovs, &(O[0]));
+	       T6d = VSUB(T4H, T4I);
+	       T6e = VSUB(T4v, T4C);
+	       T6f = VSUB(T6d, T6e);
+	       T6g = VSUB(T4h, T4n);
+	       T6h = VSUB(T4K, T4L);
+	       T6i = VADD(T6g, T6h);
+	       STA(&(O[WS(os, 11)]), VFMS(LDK(KP580569354), T6i, VMUL(LDK(KP1_913880671), T6f)), ovs, &(O[0]));
+	       T6j = VSUB(T46, T49);
+	       T6k = VSUB(T3U, T41);
+	       T6l = VSUB(T6j, T6k);
+	       T6m = VSUB(T3F, T3M);
+	       T6n = VSUB(T4b, T4c);
+	       T6o = VADD(T6m, T6n);
+	       STA(&(O[WS(os, 12)]), VFMA(LDK(KP1_899056361), T6o, VMUL(LDK(KP627363480), T6l)), ovs, &(O[0]));
+	       T6p = VSUB(T3u, T3x);
+	       T6q = VSUB(T37, T3n);
+	       T6r = VSUB(T6p, T6q);
+	       T6s = VSUB(T2B, T2Q);
+	       T6t = VSUB(T3z, T3A);
+	       T6u = VADD(T6s, T6t);
+	       STA(&(O[WS(os, 13)]), VFMS(LDK(KP673779706), T6u, VMUL(LDK(KP1_883088130), T6r)), ovs, &(O[0]));
+	       T6v = VSUB(T2j, T2m);
+	       T6w = VSUB(T1Q, T2a);
+	       T6x = VSUB(T6v, T6w);
+	       T6y = VSUB(T1e, T1v);
+	       T6z = VSUB(T2o, T2p);
+	       T6A = VADD(T6y, T6z);
+	       STA(&(O[WS(os, 14)]), VFMS(LDK(KP719790073), T6A, VMUL(LDK(KP1_865985597), T6x)), ovs, &(O[0]));
+	       T6B = VADD(T5G, T5H);
+	       T6C = VADD(T5Q, T5R);
+	       T6D = VSUB(T6B, T6C);
+	       T6E = VADD(T5M, T5N);
+	       T6F = VADD(T5J, T5K);
+	       T6G = VSUB(T6E, T6F);
+	       STA(&(O[WS(os, 15)]), VFMA(LDK(KP1_847759065), T6G, VMUL(LDK(KP765366864), T6D)), ovs, &(O[0]));
+	       T6H = VSUB(T6y, T6z);
+	       T6I = VADD(T6v, T6w);
+	       STA(&(O[WS(os, 16)]), VFMA(LDK(KP1_828419511), T6I, VMUL(LDK(KP810482628), T6H)), ovs, &(O[0]));
+	       T6J = VSUB(T6s, T6t);
+	       T6K = VADD(T6p, T6q);
+	       STA(&(O[WS(os, 17)]), VFMA(LDK(KP1_807978586), T6K, VMUL(LDK(KP855110186), T6J)), ovs, &(O[0]));
+	       T6L = VSUB(T6m, T6n);
+	       T6M = VADD(T6j, T6k);
+	       STA(&(O[WS(os, 18)]), VFMS(LDK(KP899222659), T6M, VMUL(LDK(KP1_786448602), T6L)), ovs, &(O[0]));
+	       T6N = VSUB(T6g, T6h);
+	       T6O = VADD(T6d, T6e);
+	       STA(&(O[WS(os, 19)]), VFMA(LDK(KP1_763842528), T6O, VMUL(LDK(KP942793473), T6N)), ovs, &(O[0]));
+	       T6P = VSUB(T6a, T6b);
+	       T6Q = VADD(T67, T68);
+	       STA(&(O[WS(os, 20)]), VFMA(LDK(KP1_740173982), T6Q, VMUL(LDK(KP985796384), T6P)), ovs, &(O[0]));
+	       T6R = VSUB(T64, T65);
+	       T6S = VADD(T61, T62);
+	       STA(&(O[WS(os, 21)]), VFMS(LDK(KP1_028205488), T6S, VMUL(LDK(KP1_715457220), T6R)), ovs, &(O[0]));
+	       T6T = VSUB(T5Y, T5Z);
+	       T6U = VADD(T5V, T5W);
+	       STA(&(O[WS(os, 22)]), VFMS(LDK(KP1_069995239), T6U, VMUL(LDK(KP1_689707130), T6T)), ovs, &(O[0]));
+	       T6V = VSUB(T5S, T5T);
+	       T6W = VSUB(T5I, T5O);
+	       STA(&(O[WS(os, 23)]), VFMS(LDK(KP1_111140466), T6W, VMUL(LDK(KP1_662939224), T6V)), ovs, &(O[0]));
+	       T6X = VSUB(T5B, T5E);
+	       T6Y = VSUB(T5q, T5x);
+	       STA(&(O[WS(os, 24)]), VFMA(LDK(KP1_635169626), T6Y, VMUL(LDK(KP1_151616382), T6X)), ovs, &(O[0]));
+	       T6Z = VSUB(T5j, T5m);
+	       T70 = VSUB(T58, T5f);
+	       STA(&(O[WS(os, 25)]), VFMA(LDK(KP1_606415062), T70, VMUL(LDK(KP1_191398608), T6Z)), ovs, &(O[0]));
+	       T71 = VSUB(T51, T54);
+	       T72 = VSUB(T4Q, T4X);
+	       STA(&(O[WS(os, 26)]), VFMS(LDK(KP1_230463181), T72, VMUL(LDK(KP1_576692855), T71)), ovs, &(O[0]));
+	       T73 = VSUB(T4J, T4M);
+	       T74 = VSUB(T4o, T4D);
+	       STA(&(O[WS(os, 27)]), VFMS(LDK(KP1_268786568), T74, VMUL(LDK(KP1_546020906), T73)), ovs, &(O[0]));
+	       T75 = VSUB(T4a, T4d);
+	       T76 = VSUB(T3N, T42);
+	       STA(&(O[WS(os, 28)]), VFMA(LDK(KP1_514417693), T76, VMUL(LDK(KP1_306345685), T75)), ovs, &(O[0]));
+	       T77 = VSUB(T3y, T3B);
+	       T78 = VSUB(T2R, T3o);
+	       STA(&(O[WS(os, 29)]), VFMS(LDK(KP1_343117909), T78, VMUL(LDK(KP1_481902250), T77)), ovs, &(O[0]));
+	       T79 = VSUB(T2n, T2q);
+	       T7a = VSUB(T1w, T2b);
+	       STA(&(O[WS(os, 30)]), VFMS(LDK(KP1_379081089), T7a, VMUL(LDK(KP1_448494165), T79)), ovs, &(O[0]));
+	       T7b = VADD(T6B, T6C);
+	       T7c = VADD(T6E, T6F);
+	       STA(&(O[WS(os, 31)]), VMUL(LDK(KP1_414213562), VSUB(T7b, T7c)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 32)]), VFMA(LDK(KP1_448494165), T7a, VMUL(LDK(KP1_379081089), T79)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 33)]), VFMA(LDK(KP1_481902250), T78, VMUL(LDK(KP1_343117909), T77)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 34)]), VFMS(LDK(KP1_514417693), T75, VMUL(LDK(KP1_306345685), T76)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 35)]), VFMA(LDK(KP1_546020906), T74, VMUL(LDK(KP1_268786568), T73)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 36)]), VFMA(LDK(KP1_576692855), T72, VMUL(LDK(KP1_230463181), T71)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 37)]), VFMS(LDK(KP1_606415062), T6Z, VMUL(LDK(KP1_191398608), T70)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 38)]), VFMS(LDK(KP1_635169626), T6X, VMUL(LDK(KP1_151616382), T6Y)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 39)]), VFMA(LDK(KP1_662939224), T6W, VMUL(LDK(KP1_111140466), T6V)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 40)]), VFMA(LDK(KP1_689707130), T6U, VMUL(LDK(KP1_069995239), T6T)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 41)]), VFMA(LDK(KP1_715457220), T6S, VMUL(LDK(KP1_028205488), T6R)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 42)]), VFMS(LDK(KP1_740173982), T6P, VMUL(LDK(KP985796384), T6Q)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 43)]), VFMS(LDK(KP1_763842528), T6N, VMUL(LDK(KP942793473), T6O)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 44)]), VFMA(LDK(KP1_786448602), T6M, VMUL(LDK(KP899222659), T6L)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 45)]), VFMS(LDK(KP1_807978586), T6J, VMUL(LDK(KP855110186), T6K)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 46)]), VFMS(LDK(KP1_828419511), T6H, VMUL(LDK(KP810482628), T6I)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 47)]), VFMS(LDK(KP1_847759065), T6D, VMUL(LDK(KP765366864), T6G)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 48)]), VFMA(LDK(KP1_865985597), T6A, VMUL(LDK(KP719790073), T6x)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 49)]), VFMA(LDK(KP1_883088130), T6u, VMUL(LDK(KP673779706), T6r)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 50)]), VFMS(LDK(KP1_899056361), T6l, VMUL(LDK(KP627363480), T6o)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 51)]), VFMA(LDK(KP1_913880671), T6i, VMUL(LDK(KP580569354), T6f)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 52)]), VFMA(LDK(KP1_927552131), T6c, VMUL(LDK(KP533425514), T69)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 53)]), VFMS(LDK(KP1_940062506), T63, VMUL(LDK(KP485960359), T66)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 54)]), VFMS(LDK(KP1_951404260), T5X, VMUL(LDK(KP438202480), T60)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 55)]), VFMS(LDK(KP1_961570560), T5P, VMUL(LDK(KP390180644), T5U)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 56)]), VFMA(LDK(KP1_970555284), T5F, VMUL(LDK(KP341923777), T5y)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 57)]), VFMA(LDK(KP1_978353019), T5n, VMUL(LDK(KP293460948), T5g)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 58)]), VFMS(LDK(KP1_984959069), T4Y, VMUL(LDK(KP244821350), T55)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 59)]), VFMS(LDK(KP1_990369453), T4E, VMUL(LDK(KP196034280), T4N)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 60)]), VFMA(LDK(KP1_994580913), T4e, VMUL(LDK(KP147129127), T43)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 61)]), VFMS(LDK(KP1_997590912), T3p, VMUL(LDK(KP098135348), T3C)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 62)]), VFMS(LDK(KP1_999397637), T2c, VMUL(LDK(KP049082457), T2r)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 63)]), VMUL(LDK(KP2_000000000), VADD(T7b, T7c)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 64, XSIMD_STRING("o10v_64"), {332, 126, 134, 0}, &GENUS, RODFT10 };
+
+void XSIMD(codelet_o10v_64) (planner *p) {
+     X(kr2r_register) (p, o10v_64, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o10v_64 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft10 -n 64 -name o10_64 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 456 FP additions, 250 FP multiplications,
+ * (or, 456 additions, 250 multiplications, 0 fused multiply/add),
+ * 456 stack variables, 79 constants, and 128 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o10v_64(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_999397637, +1.999397637392408440231531299332344393700122163);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DVK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DVK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DVK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DVK(KP049082457, +0.049082457045824576063469058918565850130932238);
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP147129127, +0.147129127199334847058931243150468643626598531);
+     DVK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DVK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DVK(KP1_994580913, +1.994580913357380432271194280365135642343377358);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP1_984959069, +1.984959069197419996313534503322235640021641309);
+     DVK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DVK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DVK(KP244821350, +0.244821350398432396997408948301891575150447218);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP341923777, +0.341923777520602452727284714416527063932658118);
+     DVK(KP1_970555284, +1.970555284777882489548036866357095574320258312);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_951404260, +1.951404260077057088920791532839055943288024532);
+     DVK(KP438202480, +0.438202480313739594455475094994715597696721593);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP533425514, +0.533425514949796772650573030232872788084233977);
+     DVK(KP1_927552131, +1.927552131590879733372928711015670307326167698);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP1_899056361, +1.899056361186073334391872148378690056504448308);
+     DVK(KP627363480, +0.627363480797782953312957691988200619986755019);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP719790073, +0.719790073069976297550209144653512840404634842);
+     DVK(KP1_865985597, +1.865985597669477775423320511086604996590031041);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_828419511, +1.828419511407061309270029658787154802089382231);
+     DVK(KP810482628, +0.810482628009979741816962611010104933023895508);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP899222659, +0.899222659309213200092589158848454151766374097);
+     DVK(KP1_786448602, +1.786448602391030640684832894986795956001251178);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_740173982, +1.740173982217422837304584808967697687821655579);
+     DVK(KP985796384, +0.985796384459568073746053377517618536479374613);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP1_069995239, +1.069995239774194421326153809274035831120531384);
+     DVK(KP1_689707130, +1.689707130499414146519142410209914195439571963);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_635169626, +1.635169626303167393009841768261267618942085035);
+     DVK(KP1_151616382, +1.151616382835690601491944907631461683552016911);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_230463181, +1.230463181161253690969827126827968555318860016);
+     DVK(KP1_576692855, +1.576692855253212524018329410719378565312986274);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_514417693, +1.514417693012969095150928107211568946080867431);
+     DVK(KP1_306345685, +1.306345685907553528168406027312610830153720047);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP1_379081089, +1.379081089474133849233461259914969405691073689);
+     DVK(KP1_448494165, +1.448494165902933841882138486581106334966186010);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k, T1l, T1m;
+	       V T1n, T1o, T1p, T1q, T1r, T1s, T1t, T1u, T1v, T1w, T1x, T1y;
+	       V T1z, T1A, T1B, T1C, T1D, T1E, T1F, T1G, T1H, T1I, T1J, T1K;
+	       V T1L, T1M, T1N, T1O, T1P, T1Q, T1R, T1S, T1T, T1U, T1V, T1W;
+	       V T1X, T1Y, T1Z, T20, T21, T22, T23, T24, T25, T26, T27, T28;
+	       V T29, T2a, T2b, T2c, T2d, T2e, T2f, T2g, T2h, T2i, T2j, T2k;
+	       V T2l, T2m, T2n, T2o, T2p, T2q, T2r, T2s, T2t, T2u, T2v, T2w;
+	       V T2x, T2y, T2z, T2A, T2B, T2C, T2D, T2E, T2F, T2G, T2H, T2I;
+	       V T2J, T2K, T2L, T2M, T2N, T2O, T2P, T2Q, T2R, T2S, T2T, T2U;
+	       V T2V, T2W, T2X, T2Y, T2Z, T30, T31, T32, T33, T34, T35, T36;
+	       V T37, T38, T39, T3a, T3b, T3c, T3d, T3e, T3f, T3g, T3h, T3i;
+	       V T3j, T3k, T3l, T3m, T3n, T3o, T3p, T3q, T3r, T3s, T3t, T3u;
+	       V T3v, T3w, T3x, T3y, T3z, T3A, T3B, T3C, T3D, T3E, T3F, T3G;
+	       V T3H, T3I, T3J, T3K, T3L, T3M, T3N, T3O, T3P, T3Q, T3R, T3S;
+	       V T3T, T3U, T3V, T3W, T3X, T3Y, T3Z, T40, T41, T42, T43, T44;
+	       V T45, T46, T47, T48, T49, T4a, T4b, T4c, T4d, T4e, T4f, T4g;
+	       V T4h, T4i, T4j, T4k, T4l, T4m, T4n, T4o, T4p, T4q, T4r, T4s;
+	       V T4t, T4u, T4v, T4w, T4x, T4y, T4z, T4A, T4B, T4C, T4D, T4E;
+	       V T4F, T4G, T4H, T4I, T4J, T4K, T4L, T4M, T4N, T4O, T4P, T4Q;
+	       V T4R, T4S, T4T, T4U, T4V, T4W, T4X, T4Y, T4Z, T50, T51, T52;
+	       V T53, T54, T55, T56, T57, T58, T59, T5a, T5b, T5c, T5d, T5e;
+	       V T5f, T5g, T5h, T5i, T5j, T5k, T5l, T5m, T5n, T5o, T5p, T5q;
+	       V T5r, T5s, T5t, T5u, T5v, T5w, T5x, T5y, T5z, T5A, T5B, T5C;
+	       V T5D, T5E, T5F, T5G, T5H, T5I, T5J, T5K, T5L, T5M, T5N, T5O;
+	       V T5P, T5Q, T5R, T5S, T5T, T5U, T5V, T5W, T5X, T5Y, T5Z, T60;
+	       V T61, T62, T63, T64, T65, T66, T67, T68, T69, T6a, T6b, T6c;
+	       V T6d, T6e, T6f, T6g, T6h, T6i, T6j, T6k, T6l, T6m, T6n, T6o;
+	       V T6p, T6q, T6r, T6s, T6t, T6u, T6v, T6w, T6x, T6y, T6z, T6A;
+	       V T6B, T6C, T6D, T6E, T6F, T6G, T6H, T6I, T6J, T6K, T6L, T6M;
+	       V T6N, T6O, T6P, T6Q, T6R, T6S, T6T, T6U, T6V, T6W, T6X, T6Y;
+	       V T6Z, T70, T71, T72, T73, T74, T75, T76, T77, T78, T79, T7a;
+	       V T7b, T7c, T7d, T7e, T7f, T7g, T7h, T7i, T7j, T7k, T7l, T7m;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = LDA(&(I[WS(is, 16)]), ivs, &(I[0]));
+	       Ti = LDA(&(I[WS(is, 17)]), ivs, &(I[0]));
+	       Tj = LDA(&(I[WS(is, 18)]), ivs, &(I[0]));
+	       Tk = LDA(&(I[WS(is, 19)]), ivs, &(I[0]));
+	       Tl = LDA(&(I[WS(is, 20)]), ivs, &(I[0]));
+	       Tm = LDA(&(I[WS(is, 21)]), ivs, &(I[0]));
+	       Tn = LDA(&(I[WS(is, 22)]), ivs, &(I[0]));
+	       To = LDA(&(I[WS(is, 23)]), ivs, &(I[0]));
+	       Tp = LDA(&(I[WS(is, 24)]), ivs, &(I[0]));
+	       Tq = LDA(&(I[WS(is, 25)]), ivs, &(I[0]));
+	       Tr = LDA(&(I[WS(is, 26)]), ivs, &(I[0]));
+	       Ts = LDA(&(I[WS(is, 27)]), ivs, &(I[0]));
+	       Tt = LDA(&(I[WS(is, 28)]), ivs, &(I[0]));
+	       Tu = LDA(&(I[WS(is, 29)]), ivs, &(I[0]));
+	       Tv = LDA(&(I[WS(is, 30)]), ivs, &(I[0]));
+	       Tw = LDA(&(I[WS(is, 31)]), ivs, &(I[0]));
+	       Tx = LDA(&(I[WS(is, 32)]), ivs, &(I[0]));
+	       Ty = LDA(&(I[WS(is, 33)]), ivs, &(I[0]));
+	       Tz = LDA(&(I[WS(is, 34)]), ivs, &(I[0]));
+	       TA = LDA(&(I[WS(is, 35)]), ivs, &(I[0]));
+	       TB = LDA(&(I[WS(is, 36)]), ivs, &(I[0]));
+	       TC = LDA(&(I[WS(is, 37)]), ivs, &(I[0]));
+	       TD = LDA(&(I[WS(is, 38)]), ivs, &(I[0]));
+	       TE = LDA(&(I[WS(is, 39)]), ivs, &(I[0]));
+	       TF = LDA(&(I[WS(is, 40)]), ivs, &(I[0]));
+	       TG = LDA(&(I[WS(is, 41)]), ivs, &(I[0]));
+	       TH = LDA(&(I[WS(is, 42)]), ivs, &(I[0]));
+	       TI = LDA(&(I[WS(is, 43)]), ivs, &(I[0]));
+	       TJ = LDA(&(I[WS(is, 44)]), ivs, &(I[0]));
+	       TK = LDA(&(I[WS(is, 45)]), ivs, &(I[0]));
+	       TL = LDA(&(I[WS(is, 46)]), ivs, &(I[0]));
+	       TM = LDA(&(I[WS(is, 47)]), ivs, &(I[0]));
+	       TN = LDA(&(I[WS(is, 48)]), ivs, &(I[0]));
+	       TO = LDA(&(I[WS(is, 49)]), ivs, &(I[0]));
+	       TP = LDA(&(I[WS(is, 50)]), ivs, &(I[0]));
+	       TQ = LDA(&(I[WS(is, 51)]), ivs, &(I[0]));
+	       TR = LDA(&(I[WS(is, 52)]), ivs, &(I[0]));
+	       TS = LDA(&(I[WS(is, 53)]), ivs, &(I[0]));
+	       TT = LDA(&(I[WS(is, 54)]), ivs, &(I[0]));
+	       TU = LDA(&(I[WS(is, 55)]), ivs, &(I[0]));
+	       TV = LDA(&(I[WS(is, 56)]), ivs, &(I[0]));
+	       TW = LDA(&(I[WS(is, 57)]), ivs, &(I[0]));
+	       TX = LDA(&(I[WS(is, 58)]), ivs, &(I[0]));
+	       TY = LDA(&(I[WS(is, 59)]), ivs, &(I[0]));
+	       TZ = LDA(&(I[WS(is, 60)]), ivs, &(I[0]));
+	       T10 = LDA(&(I[WS(is, 61)]), ivs, &(I[0]));
+	       T11 = LDA(&(I[WS(is, 62)]), ivs, &(I[0]));
+	       T12 = LDA(&(I[WS(is, 63)]), ivs, &(I[0]));
+	       T13 = VADD(Tw, Tx);
+	       T14 = VMUL(LDK(KP707106781), VADD(Th, TM));
+	       T15 = VMUL(LDK(KP707106781), VADD(Tg, TN));
+	       T16 = VADD(T14, T15);
+	       T17 = VADD(T13, T16);
+	       T18 = VADD(To, TF);
+	       T19 = VADD(T9, TU);
+	       T1a = VADD(VMUL(LDK(KP923879532), T18), VMUL(LDK(KP382683432), T19));
+	       T1b = VADD(T8, TV);
+	       T1c = VADD(Tp, TE);
+	       T1d = VADD(VMUL(LDK(KP382683432), T1b), VMUL(LDK(KP923879532), T1c));
+	       T1e = VADD(T1a, T1d);
+	       T1f = VADD(T17, T1e);
+	       T1g = VADD(Ts, TB);
+	       T1h = VMUL(LDK(KP707106781), VADD(Tl, TI));
+	       T1i = VMUL(LDK(KP707106781), VADD(Tc, TR));
+	       T1j = VADD(T1h, T1i);
+	       T1k = VADD(T1g, T1j);
+	       T1l = VADD(T5, TY);
+	       T1m = VSUB(T1h, T1i);
+	       T1n = VADD(T1l, T1m);
+	       T1o = VADD(VMUL(LDK(KP980785280), T1k), VMUL(LDK(KP195090322), T1n));
+	       T1p = VADD(Tk, TJ);
+	       T1q = VMUL(LDK(KP707106781), VADD(Tt, TA));
+	       T1r = VMUL(LDK(KP707106781), VADD(T4, TZ));
+	       T1s = VADD(T1q, T1r);
+	       T1t = VADD(T1p, T1s);
+	       T1u = VADD(Td, TQ);
+	       T1v = VSUB(T1q, T1r);
+	       T1w = VADD(T1u, T1v);
+	       T1x = VADD(VMUL(LDK(KP831469612), T1t), VMUL(LDK(KP555570233), T1w));
+	       T1y = VADD(T1o, T1x);
+	       T1z = VADD(T1f, T1y);
+	       T1A = VADD(Tu, Tz);
+	       T1B = VMUL(LDK(KP707106781), VADD(Tj, TK));
+	       T1C = VMUL(LDK(KP707106781), VADD(Te, TP));
+	       T1D = VADD(T1B, T1C);
+	       T1E = VADD(T1A, T1D);
+	       T1F = VADD(Tm, TH);
+	       T1G = VADD(Tb, TS);
+	       T1H = VADD(VMUL(LDK(KP923879532), T1F), VMUL(LDK(KP382683432), T1G));
+	       T1I = VADD(T6, TX);
+	       T1J = VADD(Tr, TC);
+	       T1K = VADD(VMUL(LDK(KP382683432), T1I), VMUL(LDK(KP923879532), T1J));
+	       T1L = VADD(T1H, T1K);
+	       T1M = VADD(T1E, T1L);
+	       T1N = VADD(T3, T10);
+	       T1O = VSUB(T1B, T1C);
+	       T1P = VADD(T1N, T1O);
+	       T1Q = VSUB(VMUL(LDK(KP923879532), T1G), VMUL(LDK(KP382683432), T1F));
+	       T1R = VSUB(VMUL(LDK(KP382683432), T1J), VMUL(LDK(KP923879532), T1I));
+	       T1S = VADD(T1Q, T1R);
+	       T1T = VADD(T1P, T1S);
+	       T1U = VADD(VMUL(LDK(KP995184726), T1M), VMUL(LDK(KP098017140), T1T));
+	       T1V = VADD(Tq, TD);
+	       T1W = VMUL(LDK(KP707106781), VADD(Tn, TG));
+	       T1X = VMUL(LDK(KP707106781), VADD(Ta, TT));
+	       T1Y = VADD(T1W, T1X);
+	       T1Z = VADD(T1V, T1Y);
+	       T20 = VADD(Ti, TL);
+	       T21 = VADD(Tf, TO);
+	       T22 = VADD(VMUL(LDK(KP923879532), T20), VMUL(LDK(KP382683432), T21));
+	       T23 = VADD(T2, T11);
+	       T24 = VADD(Tv, Ty);
+	       T25 = VADD(VMUL(LDK(KP382683432), T23), VMUL(LDK(KP923879532), T24));
+	       T26 = VADD(T22, T25);
+	       T27 = VADD(T1Z, T26);
+	       T28 = VADD(T7, TW);
+	       T29 = VSUB(T1W, T1X);
+	       T2a = VADD(T28, T29);
+	       T2b = VSUB(VMUL(LDK(KP923879532), T21), VMUL(LDK(KP382683432), T20));
+	       T2c = VSUB(VMUL(LDK(KP382683432), T24), VMUL(LDK(KP923879532), T23));
+	       T2d = VADD(T2b, T2c);
+	       T2e = VADD(T2a, T2d);
+	       T2f = VADD(VMUL(LDK(KP956940335), T27), VMUL(LDK(KP290284677), T2e));
+	       T2g = VADD(T1U, T2f);
+	       T2h = VADD(T1z, T2g);
+	       T2i = VADD(T1, T12);
+	       T2j = VSUB(T14, T15);
+	       T2k = VADD(T2i, T2j);
+	       T2l = VSUB(VMUL(LDK(KP923879532), T19), VMUL(LDK(KP382683432), T18));
+	       T2m = VSUB(VMUL(LDK(KP382683432), T1c), VMUL(LDK(KP923879532), T1b));
+	       T2n = VADD(T2l, T2m);
+	       T2o = VADD(T2k, T2n);
+	       T2p = VSUB(VMUL(LDK(KP980785280), T1n), VMUL(LDK(KP195090322), T1k));
+	       T2q = VSUB(VMUL(LDK(KP831469612), T1w), VMUL(LDK(KP555570233), T1t));
+	       T2r = VADD(T2p, T2q);
+	       T2s = VADD(T2o, T2r);
+	       T2t = VSUB(VMUL(LDK(KP995184726), T1T), VMUL(LDK(KP098017140), T1M));
+	       T2u = VSUB(VMUL(LDK(KP956940335), T2e), VMUL(LDK(KP290284677), T27));
+	       T2v = VADD(T2t, T2u);
+	       T2w = VADD(T2s, T2v);
+	       STA(&(O[0]), VADD(VMUL(LDK(KP1_999397637), T2h), VMUL(LDK(KP049082457), T2w)), ovs, &(O[0]));
+	       T2x = VSUB(Th, TM);
+	       T2y = VSUB(Tg, TN);
+	       T2z = VADD(T2x, T2y);
+	       T2A = VSUB(T9, TU);
+	       T2B = VSUB(To, TF);
+	       T2C = VMUL(LDK(KP707106781), VADD(T2A, T2B));
+	       T2D = VSUB(Tp, TE);
+	       T2E = VSUB(T8, TV);
+	       T2F = VMUL(LDK(KP707106781), VADD(T2D, T2E));
+	       T2G = VADD(T2C, T2F);
+	       T2H = VADD(T2z, T2G);
+	       T2I = VSUB(Tl, TI);
+	       T2J = VSUB(Tc, TR);
+	       T2K = VADD(T2I, T2J);
+	       T2L = VSUB(T5, TY);
+	       T2M = VSUB(Ts, TB);
+	       T2N = VADD(T2L, T2M);
+	       T2O = VADD(VMUL(LDK(KP923879532), T2K), VMUL(LDK(KP382683432), T2N));
+	       T2P = VSUB(Tt, TA);
+	       T2Q = VSUB(T4, TZ);
+	       T2R = VADD(T2P, T2Q);
+	       T2S = VSUB(Td, TQ);
+	       T2T = VSUB(Tk, TJ);
+	       T2U = VADD(T2S, T2T);
+	       T2V = VADD(VMUL(LDK(KP382683432), T2R), VMUL(LDK(KP923879532), T2U));
+	       T2W = VADD(T2O, T2V);
+	       T2X = VADD(T2H, T2W);
+	       T2Y = VSUB(Tj, TK);
+	       T2Z = VSUB(Te, TP);
+	       T30 = VADD(T2Y, T2Z);
+	       T31 = VSUB(Tb, TS);
+	       T32 = VSUB(Tm, TH);
+	       T33 = VMUL(LDK(KP707106781), VADD(T31, T32));
+	       T34 = VSUB(Tr, TC);
+	       T35 = VSUB(T6, TX);
+	       T36 = VMUL(LDK(KP707106781), VADD(T34, T35));
+	       T37 = VADD(T33, T36);
+	       T38 = VADD(T30, T37);
+	       T39 = VSUB(T3, T10);
+	       T3a = VSUB(Tu, Tz);
+	       T3b = VADD(T39, T3a);
+	       T3c = VSUB(T33, T36);
+	       T3d = VADD(T3b, T3c);
+	       T3e = VADD(VMUL(LDK(KP980785280), T38), VMUL(LDK(KP195090322), T3d));
+	       T3f = VSUB(Tn, TG);
+	       T3g = VSUB(Ta, TT);
+	       T3h = VADD(T3f, T3g);
+	       T3i = VSUB(Tf, TO);
+	       T3j = VSUB(Ti, TL);
+	       T3k = VMUL(LDK(KP707106781), VADD(T3i, T3j));
+	       T3l = VSUB(Tv, Ty);
+	       T3m = VSUB(T2, T11);
+	       T3n = VMUL(LDK(KP707106781), VADD(T3l, T3m));
+	       T3o = VADD(T3k, T3n);
+	       T3p = VADD(T3h, T3o);
+	       T3q = VSUB(T7, TW);
+	       T3r = VSUB(Tq, TD);
+	       T3s = VADD(T3q, T3r);
+	       T3t = VSUB(T3k, T3n);
+	       T3u = VADD(T3s, T3t);
+	       T3v = VADD(VMUL(LDK(KP831469612), T3p), VMUL(LDK(KP555570233), T3u));
+	       T3w = VADD(T3e, T3v);
+	       T3x = VADD(T2X, T3w);
+	       T3y = VSUB(T1, T12);
+	       T3z = VSUB(Tw, Tx);
+	       T3A = VADD(T3y, T3z);
+	       T3B = VSUB(T2C, T2F);
+	       T3C = VADD(T3A, T3B);
+	       T3D = VSUB(VMUL(LDK(KP923879532), T2N), VMUL(LDK(KP382683432), T2K));
+	       T3E = VSUB(VMUL(LDK(KP382683432), T2U), VMUL(LDK(KP923879532), T2R));
+	       T3F = VADD(T3D, T3E);
+	       T3G = VADD(T3C, T3F);
+	       T3H = VSUB(VMUL(LDK(KP980785280), T3d), VMUL(LDK(KP195090322), T38));
+	       T3I = VSUB(VMUL(LDK(KP831469612), T3u), VMUL(LDK(KP555570233), T3p));
+	       T3J = VADD(T3H, T3I);
+	       T3K = VADD(T3G, T3J);
+	       STA(&(O[WS(os, 1)]), VADD(VMUL(LDK(KP1_997590912), T3x), VMUL(LDK(KP098135348), T3K)), ovs, &(O[0]));
+	       T3L = VSUB(T2i, T2j);
+	       T3M = VSUB(T1a, T1d);
+	       T3N = VADD(T3L, T3M);
+	       T3O = VSUB(T1l, T1m);
+	       T3P = VSUB(T1g, T1j);
+	       T3Q = VADD(VMUL(LDK(KP831469612), T3O), VMUL(LDK(KP555570233), T3P));
+	       T3R = VSUB(T1u, T1v);
+	       T3S = VSUB(T1p, T1s);
+	       T3T = VSUB(VMUL(LDK(KP195090322), T3R), VMUL(LDK(KP980785280), T3S));
+	       T3U = VSUB(T3Q, T3T);
+	       T3V = VADD(T3N, T3U);
+	       T3W = VSUB(T1N, T1O);
+	       T3X = VSUB(T1H, T1K);
+	       T3Y = VADD(T3W, T3X);
+	       T3Z = VSUB(T1A, T1D);
+	       T40 = VSUB(T1Q, T1R);
+	       T41 = VSUB(T3Z, T40);
+	       T42 = VADD(VMUL(LDK(KP956940335), T3Y), VMUL(LDK(KP290284677), T41));
+	       T43 = VSUB(T28, T29);
+	       T44 = VSUB(T22, T25);
+	       T45 = VADD(T43, T44);
+	       T46 = VSUB(T1V, T1Y);
+	       T47 = VSUB(T2b, T2c);
+	       T48 = VSUB(T46, T47);
+	       T49 = VADD(VMUL(LDK(KP634393284), T45), VMUL(LDK(KP773010453), T48));
+	       T4a = VADD(T42, T49);
+	       T4b = VADD(T3V, T4a);
+	       T4c = VSUB(T13, T16);
+	       T4d = VSUB(T2l, T2m);
+	       T4e = VSUB(T4c, T4d);
+	       T4f = VSUB(VMUL(LDK(KP831469612), T3P), VMUL(LDK(KP555570233), T3O));
+	       T4g = VADD(VMUL(LDK(KP195090322), T3S), VMUL(LDK(KP980785280), T3R));
+	       T4h = VSUB(T4f, T4g);
+	       T4i = VADD(T4e, T4h);
+	       T4j = VSUB(VMUL(LDK(KP956940335), T41), VMUL(LDK(KP290284677), T3Y));
+	       T4k = VSUB(VMUL(LDK(KP634393284), T48), VMUL(LDK(KP773010453), T45));
+	       T4l = VADD(T4j, T4k);
+	       T4m = VADD(T4i, T4l);
+	       STA(&(O[WS(os, 2)]), VSUB(VMUL(LDK(KP147129127), T4b), VMUL(LDK(KP1_994580913), T4m)), ovs, &(O[0]));
+	       T4n = VSUB(T2A, T2B);
+	       T4o = VSUB(T2D, T2E);
+	       T4p = VSUB(T4n, T4o);
+	       T4q = VSUB(T2L, T2M);
+	       T4r = VSUB(T2I, T2J);
+	       T4s = VMUL(LDK(KP707106781), VSUB(T4q, T4r));
+	       T4t = VSUB(T2S, T2T);
+	       T4u = VSUB(T2P, T2Q);
+	       T4v = VMUL(LDK(KP707106781), VSUB(T4t, T4u));
+	       T4w = VADD(T4s, T4v);
+	       T4x = VADD(T4p, T4w);
+	       T4y = VSUB(T31, T32);
+	       T4z = VSUB(T34, T35);
+	       T4A = VSUB(T4y, T4z);
+	       T4B = VSUB(T39, T3a);
+	       T4C = VSUB(T2Y, T2Z);
+	       T4D = VSUB(T4B, T4C);
+	       T4E = VADD(VMUL(LDK(KP923879532), T4A), VMUL(LDK(KP382683432), T4D));
+	       T4F = VSUB(T3i, T3j);
+	       T4G = VSUB(T3l, T3m);
+	       T4H = VSUB(T4F, T4G);
+	       T4I = VSUB(T3q, T3r);
+	       T4J = VSUB(T3f, T3g);
+	       T4K = VSUB(T4I, T4J);
+	       T4L = VADD(VMUL(LDK(KP382683432), T4H), VMUL(LDK(KP923879532), T4K));
+	       T4M = VADD(T4E, T4L);
+	       T4N = VADD(T4x, T4M);
+	       T4O = VSUB(T3y, T3z);
+	       T4P = VSUB(T2x, T2y);
+	       T4Q = VSUB(T4O, T4P);
+	       T4R = VSUB(T4s, T4v);
+	       T4S = VADD(T4Q, T4R);
+	       T4T = VSUB(VMUL(LDK(KP923879532), T4D), VMUL(LDK(KP382683432), T4A));
+	       T4U = VSUB(VMUL(LDK(KP382683432), T4K), VMUL(LDK(KP923879532), T4H));
+	       T4V = VADD(T4T, T4U);
+	       T4W = VADD(T4S, T4V);
+	       STA(&(O[WS(os, 3)]), VADD(VMUL(LDK(KP1_990369453), T4N), VMUL(LDK(KP196034280), T4W)), ovs, &(O[0]));
+	       T4X = VADD(T4c, T4d);
+	       T4Y = VADD(T3Q, T3T);
+	       T4Z = VADD(T4X, T4Y);
+	       T50 = VADD(T3Z, T40);
+	       T51 = VSUB(T3W, T3X);
+	       T52 = VADD(VMUL(LDK(KP881921264), T50), VMUL(LDK(KP471396736), T51));
+	       T53 = VADD(T46, T47);
+	       T54 = VSUB(T43, T44);
+	       T55 = VADD(VMUL(LDK(KP098017140), T53), VMUL(LDK(KP995184726), T54));
+	       T56 = VADD(T52, T55);
+	       T57 = VADD(T4Z, T56);
+	       T58 = VSUB(T3L, T3M);
+	       T59 = VADD(T4f, T4g);
+	       T5a = VSUB(T58, T59);
+	       T5b = VSUB(VMUL(LDK(KP881921264), T51), VMUL(LDK(KP471396736), T50));
+	       T5c = VSUB(VMUL(LDK(KP098017140), T54), VMUL(LDK(KP995184726), T53));
+	       T5d = VADD(T5b, T5c);
+	       T5e = VADD(T5a, T5d);
+	       STA(&(O[WS(os, 4)]), VADD(VMUL(LDK(KP1_984959069), T57), VMUL(LDK(KP244821350), T5e)), ovs, &(O[0]));
+	       T5f = VSUB(T3A, T3B);
+	       T5g = VSUB(T2O, T2V);
+	       T5h = VADD(T5f, T5g);
+	       T5i = VSUB(T3b, T3c);
+	       T5j = VSUB(T30, T37);
+	       T5k = VADD(VMUL(LDK(KP831469612), T5i), VMUL(LDK(KP555570233), T5j));
+	       T5l = VSUB(T3s, T3t);
+	       T5m = VSUB(T3h, T3o);
+	       T5n = VSUB(VMUL(LDK(KP195090322), T5l), VMUL(LDK(KP980785280), T5m));
+	       T5o = VSUB(T5k, T5n);
+	       T5p = VADD(T5h, T5o);
+	       T5q = VSUB(T2z, T2G);
+	       T5r = VSUB(T3D, T3E);
+	       T5s = VSUB(T5q, T5r);
+	       T5t = VSUB(VMUL(LDK(KP831469612), T5j), VMUL(LDK(KP555570233), T5i));
+	       T5u = VADD(VMUL(LDK(KP195090322), T5m), VMUL(LDK(KP980785280), T5l));
+	       T5v = VSUB(T5t, T5u);
+	       T5w = VADD(T5s, T5v);
+	       STA(&(O[WS(os, 5)]), VSUB(VMUL(LDK(KP293460948), T5p), VMUL(LDK(KP1_978353019), T5w)), ovs, &(O[0]));
+	       T5x = VSUB(T2k, T2n);
+	       T5y = VSUB(T1o, T1x);
+	       T5z = VADD(T5x, T5y);
+	       T5A = VSUB(T1P, T1S);
+	       T5B = VSUB(T1E, T1L);
+	       T5C = VADD(VMUL(LDK(KP773010453), T5A), VMUL(LDK(KP634393284), T5B));
+	       T5D = VSUB(T2a, T2d);
+	       T5E = VSUB(T1Z, T26);
+	       T5F = VSUB(VMUL(LDK(KP471396736), T5D), VMUL(LDK(KP881921264), T5E));
+	       T5G = VSUB(T5C, T5F);
+	       T5H = VADD(T5z, T5G);
+	       T5I = VSUB(T17, T1e);
+	       T5J = VSUB(T2p, T2q);
+	       T5K = VSUB(T5I, T5J);
+	       T5L = VSUB(VMUL(LDK(KP773010453), T5B), VMUL(LDK(KP634393284), T5A));
+	       T5M = VADD(VMUL(LDK(KP471396736), T5E), VMUL(LDK(KP881921264), T5D));
+	       T5N = VSUB(T5L, T5M);
+	       T5O = VADD(T5K, T5N);
+	       STA(&(O[WS(os, 6)]), VSUB(VMUL(LDK(KP341923777), T5H), VMUL(LDK(KP1_970555284), T5O)), ovs, &(O[0]));
+	       T5P = VADD(T4q, T4r);
+	       T5Q = VADD(T4t, T4u);
+	       T5R = VSUB(T5P, T5Q);
+	       T5S = VADD(T4B, T4C);
+	       T5T = VADD(T4y, T4z);
+	       T5U = VMUL(LDK(KP707106781), VSUB(T5S, T5T));
+	       T5V = VADD(T4I, T4J);
+	       T5W = VADD(T4F, T4G);
+	       T5X = VMUL(LDK(KP707106781), VSUB(T5V, T5W));
+	       T5Y = VADD(T5U, T5X);
+	       T5Z = VADD(T5R, T5Y);
+	       T60 = VADD(T4O, T4P);
+	       T61 = VADD(T4n, T4o);
+	       T62 = VSUB(T60, T61);
+	       T63 = VSUB(T5U, T5X);
+	       T64 = VADD(T62, T63);
+	       STA(&(O[WS(os, 7)]), VADD(VMUL(LDK(KP1_961570560), T5Z), VMUL(LDK(KP390180644), T64)), ovs, &(O[0]));
+	       T65 = VADD(T5I, T5J);
+	       T66 = VADD(T5C, T5F);
+	       T67 = VADD(T65, T66);
+	       T68 = VSUB(T5x, T5y);
+	       T69 = VADD(T5L, T5M);
+	       T6a = VSUB(T68, T69);
+	       STA(&(O[WS(os, 8)]), VADD(VMUL(LDK(KP1_951404260), T67), VMUL(LDK(KP438202480), T6a)), ovs, &(O[0]));
+	       T6b = VADD(T5q, T5r);
+	       T6c = VADD(T5k, T5n);
+	       T6d = VADD(T6b, T6c);
+	       T6e = VSUB(T5f, T5g);
+	       T6f = VADD(T5t, T5u);
+	       T6g = VSUB(T6e, T6f);
+	       STA(&(O[WS(os, 9)]), VADD(VMUL(LDK(KP1_940062506), T6d), VMUL(LDK(KP485960359), T6g)), ovs, &(O[0]));
+	       T6h = VADD(T58, T59);
+	       T6i = VSUB(T52, T55);
+	       T6j = VADD(T6h, T6i);
+	       T6k = VSUB(T4X, T4Y);
+	       T6l = VSUB(T5b, T5c);
+	       T6m = VSUB(T6k, T6l);
+	       STA(&(O[WS(os, 10)]), VSUB(VMUL(LDK(KP533425514), T6j), VMUL(LDK(KP1_927552131), T6m)), ovs, &(O[0]));
+	       T6n = VSUB(T4Q, T4R);
+	       T6o = VSUB(T4E, T4L);
+	       T6p = VADD(T6n, T6o);
+	       T6q = VSUB(T4p, T4w);
+	       T6r = VSUB(T4T, T4U);
+	       T6s = VSUB(T6q, T6r);
+	       STA(&(O[WS(os, 11)]), VSUB(VMUL(LDK(KP580569354), T6p), VMUL(LDK(KP1_913880671), T6s)), ovs, &(O[0]));
+	       T6t = VSUB(T4e, T4h);
+	       T6u = VSUB(T42, T49);
+	       T6v = VADD(T6t, T6u);
+	       T6w = VSUB(T3N, T3U);
+	       T6x = VSUB(T4j, T4k);
+	       T6y = VSUB(T6w, T6x);
+	       STA(&(O[WS(os, 12)]), VADD(VMUL(LDK(KP1_899056361), T6v), VMUL(LDK(KP627363480), T6y)), ovs, &(O[0]));
+	       T6z = VSUB(T3C, T3F);
+	       T6A = VSUB(T3e, T3v);
+	       T6B = VADD(T6z, T6A);
+	       T6C = VSUB(T2H, T2W);
+	       T6D = VSUB(T3H, T3I);
+	       T6E = VSUB(T6C, T6D);
+	       STA(&(O[WS(os, 13)]), VSUB(VMUL(LDK(KP673779706), T6B), VMUL(LDK(KP1_883088130), T6E)), ovs, &(O[0]));
+	       T6F = VSUB(T2o, T2r);
+	       T6G = VSUB(T1U, T2f);
+	       T6H = VADD(T6F, T6G);
+	       T6I = VSUB(T1f, T1y);
+	       T6J = VSUB(T2t, T2u);
+	       T6K = VSUB(T6I, T6J);
+	       STA(&(O[WS(os, 14)]), VSUB(VMUL(LDK(KP719790073), T6H), VMUL(LDK(KP1_865985597), T6K)), ovs, &(O[0]));
+	       T6L = VADD(T5S, T5T);
+	       T6M = VADD(T5V, T5W);
+	       T6N = VSUB(T6L, T6M);
+	       T6O = VADD(T60, T61);
+	       T6P = VADD(T5P, T5Q);
+	       T6Q = VSUB(T6O, T6P);
+	       STA(&(O[WS(os, 15)]), VADD(VMUL(LDK(KP1_847759065), T6N), VMUL(LDK(KP765366864), T6Q)), ovs, &(O[0]));
+	       T6R = VADD(T6I, T6J);
+	       T6S = VSUB(T6F, T6G);
+	       STA(&(O[WS(os, 16)]), VADD(VMUL(LDK(KP1_828419511), T6R), VMUL(LDK(KP810482628), T6S)), ovs, &(O[0]));
+	       T6T = VADD(T6C, T6D);
+	       T6U = VSUB(T6z, T6A);
+	       STA(&(O[WS(os, 17)]), VADD(VMUL(LDK(KP1_807978586), T6T), VMUL(LDK(KP855110186), T6U)), ovs, &(O[0]));
+	       T6V = VADD(T6w, T6x);
+	       T6W = VSUB(T6t, T6u);
+	       STA(&(O[WS(os, 18)]), VSUB(VMUL(LDK(KP899222659), T6V), VMUL(LDK(KP1_786448602), T6W)), ovs, &(O[0]));
+	       T6X = VADD(T6q, T6r);
+	       T6Y = VSUB(T6n, T6o);
+	       STA(&(O[WS(os, 19)]), VADD(VMUL(LDK(KP1_763842528), T6X), VMUL(LDK(KP942793473), T6Y)), ovs, &(O[0]));
+	       T6Z = VADD(T6k, T6l);
+	       T70 = VSUB(T6h, T6i);
+	       STA(&(O[WS(os, 20)]), VADD(VMUL(LDK(KP1_740173982), T6Z), VMUL(LDK(KP985796384), T70)), ovs, &(O[0]));
+	       T71 = VADD(T6e, T6f);
+	       T72 = VSUB(T6b, T6c);
+	       STA(&(O[WS(os, 21)]), VSUB(VMUL(LDK(KP1_028205488), T71), VMUL(LDK(KP1_715457220), T72)), ovs, &(O[0]));
+	       T73 = VADD(T68, T69);
+	       T74 = VSUB(T65, T66);
+	       STA(&(O[WS(os, 22)]), VSUB(VMUL(LDK(KP1_069995239), T73), VMUL(LDK(KP1_689707130), T74)), ovs, &(O[0]));
+	       T75 = VSUB(T62, T63);
+	       T76 = VSUB(T5R, T5Y);
+	       STA(&(O[WS(os, 23)]), VSUB(VMUL(LDK(KP1_111140466), T75), VMUL(LDK(KP1_662939224), T76)), ovs, &(O[0]));
+	       T77 = VSUB(T5K, T5N);
+	       T78 = VSUB(T5z, T5G);
+	       STA(&(O[WS(os, 24)]), VADD(VMUL(LDK(KP1_635169626), T77), VMUL(LDK(KP1_151616382), T78)), ovs, &(O[0]));
+	       T79 = VSUB(T5s, T5v);
+	       T7a = VSUB(T5h, T5o);
+	       STA(&(O[WS(os, 25)]), VADD(VMUL(LDK(KP1_606415062), T79), VMUL(LDK(KP1_191398608), T7a)), ovs, &(O[0]));
+	       T7b = VSUB(T5a, T5d);
+	       T7c = VSUB(T4Z, T56);
+	       STA(&(O[WS(os, 26)]), VSUB(VMUL(LDK(KP1_230463181), T7b), VMUL(LDK(KP1_576692855), T7c)), ovs, &(O[0]));
+	       T7d = VSUB(T4S, T4V);
+	       T7e = VSUB(T4x, T4M);
+	       STA(&(O[WS(os, 27)]), VSUB(VMUL(LDK(KP1_268786568), T7d), VMUL(LDK(KP1_546020906), T7e)), ovs, &(O[0]));
+	       T7f = VSUB(T4i, T4l);
+	       T7g = VSUB(T3V, T4a);
+	       STA(&(O[WS(os, 28)]), VADD(VMUL(LDK(KP1_514417693), T7f), VMUL(LDK(KP1_306345685), T7g)), ovs, &(O[0]));
+	       T7h = VSUB(T3G, T3J);
+	       T7i = VSUB(T2X, T3w);
+	       STA(&(O[WS(os, 29)]), VSUB(VMUL(LDK(KP1_343117909), T7h), VMUL(LDK(KP1_481902250), T7i)), ovs, &(O[0]));
+	       T7j = VSUB(T2s, T2v);
+	       T7k = VSUB(T1z, T2g);
+	       STA(&(O[WS(os, 30)]), VSUB(VMUL(LDK(KP1_379081089), T7j), VMUL(LDK(KP1_448494165), T7k)), ovs, &(O[0]));
+	       T7l = VADD(T6O, T6P);
+	       T7m = VADD(T6L, T6M);
+	       STA(&(O[WS(os, 31)]), VMUL(LDK(KP1_414213562), VSUB(T7l, T7m)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 32)]), VADD(VMUL(LDK(KP1_448494165), T7j), VMUL(LDK(KP1_379081089), T7k)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 33)]), VADD(VMUL(LDK(KP1_481902250), T7h), VMUL(LDK(KP1_343117909), T7i)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 34)]), VSUB(VMUL(LDK(KP1_514417693), T7g), VMUL(LDK(KP1_306345685), T7f)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 35)]), VADD(VMUL(LDK(KP1_546020906), T7d), VMUL(LDK(KP1_268786568), T7e)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 36)]), VADD(VMUL(LDK(KP1_576692855), T7b), VMUL(LDK(KP1_230463181), T7c)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 37)]), VSUB(VMUL(LDK(KP1_606415062), T7a), VMUL(LDK(KP1_191398608), T79)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 38)]), VSUB(VMUL(LDK(KP1_635169626), T78), VMUL(LDK(KP1_151616382), T77)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 39)]), VADD(VMUL(LDK(KP1_662939224), T75), VMUL(LDK(KP1_111140466), T76)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 40)]), VADD(VMUL(LDK(KP1_689707130), T73), VMUL(LDK(KP1_069995239), T74)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 41)]), VADD(VMUL(LDK(KP1_715457220), T71), VMUL(LDK(KP1_028205488), T72)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 42)]), VSUB(VMUL(LDK(KP1_740173982), T70), VMUL(LDK(KP985796384), T6Z)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 43)]), VSUB(VMUL(LDK(KP1_763842528), T6Y), VMUL(LDK(KP942793473), T6X)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 44)]), VADD(VMUL(LDK(KP1_786448602), T6V), VMUL(LDK(KP899222659), T6W)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 45)]), VSUB(VMUL(LDK(KP1_807978586), T6U), VMUL(LDK(KP855110186), T6T)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 46)]), VSUB(VMUL(LDK(KP1_828419511), T6S), VMUL(LDK(KP810482628), T6R)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 47)]), VSUB(VMUL(LDK(KP1_847759065), T6Q), VMUL(LDK(KP765366864), T6N)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 48)]), VADD(VMUL(LDK(KP1_865985597), T6H), VMUL(LDK(KP719790073), T6K)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 49)]), VADD(VMUL(LDK(KP1_883088130), T6B), VMUL(LDK(KP673779706), T6E)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 50)]), VSUB(VMUL(LDK(KP1_899056361), T6y), VMUL(LDK(KP627363480), T6v)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 51)]), VADD(VMUL(LDK(KP1_913880671), T6p), VMUL(LDK(KP580569354), T6s)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 52)]), VADD(VMUL(LDK(KP1_927552131), T6j), VMUL(LDK(KP533425514), T6m)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 53)]), VSUB(VMUL(LDK(KP1_940062506), T6g), VMUL(LDK(KP485960359), T6d)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 54)]), VSUB(VMUL(LDK(KP1_951404260), T6a), VMUL(LDK(KP438202480), T67)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 55)]), VSUB(VMUL(LDK(KP1_961570560), T64), VMUL(LDK(KP390180644), T5Z)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 56)]), VADD(VMUL(LDK(KP1_970555284), T5H), VMUL(LDK(KP341923777), T5O)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 57)]), VADD(VMUL(LDK(KP1_978353019), T5p), VMUL(LDK(KP293460948), T5w)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 58)]), VSUB(VMUL(LDK(KP1_984959069), T5e), VMUL(LDK(KP244821350), T57)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 59)]), VSUB(VMUL(LDK(KP1_990369453), T4W), VMUL(LDK(KP196034280), T4N)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 60)]), VADD(VMUL(LDK(KP1_994580913), T4b), VMUL(LDK(KP147129127), T4m)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 61)]), VSUB(VMUL(LDK(KP1_997590912), T3K), VMUL(LDK(KP098135348), T3x)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 62)]), VSUB(VMUL(LDK(KP1_999397637), T2w), VMUL(LDK(KP049082457), T2h)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 63)]), VMUL(LDK(KP2_000000000), VADD(T7l, T7m)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 64, XSIMD_STRING("o10v_64"), {456, 250, 0, 0}, &GENUS, RODFT10 };
+
+void XSIMD(codelet_o10v_64) (planner *p) {
+     X(kr2r_register) (p, o10v_64, &desc);
+}
+
+#endif
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o10v_8 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft10 -n 8 -name o10_8 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 27 FP additions, 17 FP multiplications,
+ * (or, 19 additions, 9 multiplications, 8 fused multiply/add),
+ * 25 stack variables, 9 constants, and 16 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o10v_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(16, is), MAKE_VOLATILE_STRIDE(16, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = VADD(T1, T8);
+	       Ta = VMUL(LDK(KP707106781), VADD(T2, T7));
+	       Tb = VFMS(LDK(KP707106781), VADD(T3, T6), Ta);
+	       Tc = VADD(T9, Tb);
+	       Td = VADD(T4, T5);
+	       Te = VFMA(LDK(KP707106781), VADD(T3, T6), Ta);
+	       Tf = VADD(Td, Te);
+	       STA(&(O[0]), VFMA(LDK(KP1_961570560), Tf, VMUL(LDK(KP390180644), Tc)), ovs, &(O[0]));
+	       Tg = VSUB(T1, T8);
+	       Th = VSUB(T4, T5);
+	       Ti = VADD(Tg, Th);
+	       Tj = VSUB(T3, T6);
+	       Tk = VSUB(T2, T7);
+	       Tl = VADD(Tj, Tk);
+	       STA(&(O[WS(os, 1)]), VFMA(LDK(KP1_847759065), Tl, VMUL(LDK(KP765366864), Ti)), ovs, &(O[0]));
+	       Tm = VSUB(Td, Te);
+	       Tn = VSUB(T9, Tb);
+	       STA(&(O[WS(os, 2)]), VFMS(LDK(KP1_111140466), Tn, VMUL(LDK(KP1_662939224), Tm)), ovs, &(O[0]));
+	       To = VSUB(Tg, Th);
+	       Tp = VSUB(Tj, Tk);
+	       STA(&(O[WS(os, 3)]), VMUL(LDK(KP1_414213562), VSUB(To, Tp)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 4)]), VFMA(LDK(KP1_662939224), Tn, VMUL(LDK(KP1_111140466), Tm)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 5)]), VFMS(LDK(KP1_847759065), Ti, VMUL(LDK(KP765366864), Tl)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 6)]), VFMS(LDK(KP1_961570560), Tc, VMUL(LDK(KP390180644), Tf)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 7)]), VMUL(LDK(KP2_000000000), VADD(To, Tp)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 8, XSIMD_STRING("o10v_8"), {19, 9, 8, 0}, &GENUS, RODFT10 };
+
+void XSIMD(codelet_o10v_8) (planner *p) {
+     X(kr2r_register) (p, o10v_8, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o10v_8 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft10 -n 8 -name o10_8 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 26 FP additions, 16 FP multiplications,
+ * (or, 26 additions, 16 multiplications, 0 fused multiply/add),
+ * 26 stack variables, 9 constants, and 16 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o10v_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(16, is), MAKE_VOLATILE_STRIDE(16, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = VADD(T4, T5);
+	       Ta = VMUL(LDK(KP707106781), VADD(T3, T6));
+	       Tb = VMUL(LDK(KP707106781), VADD(T2, T7));
+	       Tc = VADD(Ta, Tb);
+	       Td = VADD(T9, Tc);
+	       Te = VADD(T1, T8);
+	       Tf = VSUB(Ta, Tb);
+	       Tg = VADD(Te, Tf);
+	       STA(&(O[0]), VADD(VMUL(LDK(KP1_961570560), Td), VMUL(LDK(KP390180644), Tg)), ovs, &(O[0]));
+	       Th = VSUB(T3, T6);
+	       Ti = VSUB(T2, T7);
+	       Tj = VADD(Th, Ti);
+	       Tk = VSUB(T1, T8);
+	       Tl = VSUB(T4, T5);
+	       Tm = VADD(Tk, Tl);
+	       STA(&(O[WS(os, 1)]), VADD(VMUL(LDK(KP1_847759065), Tj), VMUL(LDK(KP765366864), Tm)), ovs, &(O[0]));
+	       Tn = VSUB(Te, Tf);
+	       To = VSUB(T9, Tc);
+	       STA(&(O[WS(os, 2)]), VSUB(VMUL(LDK(KP1_111140466), Tn), VMUL(LDK(KP1_662939224), To)), ovs, &(O[0]));
+	       Tp = VSUB(Tk, Tl);
+	       Tq = VSUB(Th, Ti);
+	       STA(&(O[WS(os, 3)]), VMUL(LDK(KP1_414213562), VSUB(Tp, Tq)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 4)]), VADD(VMUL(LDK(KP1_662939224), Tn), VMUL(LDK(KP1_111140466), To)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 5)]), VSUB(VMUL(LDK(KP1_847759065), Tm), VMUL(LDK(KP765366864), Tj)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 6)]), VSUB(VMUL(LDK(KP1_961570560), Tg), VMUL(LDK(KP390180644), Td)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 7)]), VMUL(LDK(KP2_000000000), VADD(Tp, Tq)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 8, XSIMD_STRING("o10v_8"), {26, 16, 0, 0}, &GENUS, RODFT10 };
+
+void XSIMD(codelet_o10v_8) (planner *p) {
+     X(kr2r_register) (p, o10v_8, &desc);
+}
+
+#endif
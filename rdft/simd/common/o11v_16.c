@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o11v_16 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft11 -n 16 -name o11_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 86 FP additions, 66 FP multiplications,
+ * (or, 50 additions, 30 multiplications, 36 fused multiply/add),
+ * 78 stack variables, 23 constants, and 32 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o11v_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = VFNMS(LDK(KP707106781), VSUB(T8, T9), T1);
+	       Ti = VFMS(LDK(KP923879532), T5, VMUL(LDK(KP382683432), Tc));
+	       Tj = VFMS(LDK(KP382683432), Td, VMUL(LDK(KP923879532), T4));
+	       Tk = VADD(Ti, Tj);
+	       Tl = VADD(Th, Tk);
+	       Tm = VFMS(LDK(KP980785280), T3, VMUL(LDK(KP195090322), Te));
+	       Tn = VFMS(LDK(KP555570233), Tb, VMUL(LDK(KP831469612), T6));
+	       To = VADD(Tm, Tn);
+	       Tp = VFMS(LDK(KP831469612), T7, VMUL(LDK(KP555570233), Ta));
+	       Tq = VFMS(LDK(KP195090322), Tf, VMUL(LDK(KP980785280), T2));
+	       Tr = VADD(Tp, Tq);
+	       Ts = VADD(To, Tr);
+	       Tt = VADD(Tl, Ts);
+	       Tu = VFMA(LDK(KP707106781), VADD(T8, T9), Tg);
+	       Tv = VFMA(LDK(KP923879532), Tc, VMUL(LDK(KP382683432), T5));
+	       Tw = VFMA(LDK(KP382683432), T4, VMUL(LDK(KP923879532), Td));
+	       Tx = VADD(Tv, Tw);
+	       Ty = VADD(Tu, Tx);
+	       Tz = VFMA(LDK(KP980785280), Te, VMUL(LDK(KP195090322), T3));
+	       TA = VFMA(LDK(KP555570233), T6, VMUL(LDK(KP831469612), Tb));
+	       TB = VADD(Tz, TA);
+	       TC = VFMA(LDK(KP831469612), Ta, VMUL(LDK(KP555570233), T7));
+	       TD = VFMA(LDK(KP195090322), T2, VMUL(LDK(KP980785280), Tf));
+	       TE = VADD(TC, TD);
+	       TF = VADD(TB, TE);
+	       TG = VADD(Ty, TF);
+	       STA(&(O[0]), VFMA(LDK(KP1_997590912), TG, VMUL(LDK(KP098135348), Tt)), ovs, &(O[0]));
+	       TH = VFNMS(LDK(KP707106781), VADD(T8, T9), Tg);
+	       TI = VSUB(Ti, Tj);
+	       TJ = VSUB(TH, TI);
+	       TK = VSUB(Tp, Tq);
+	       TL = VSUB(TC, TD);
+	       TM = VMUL(LDK(KP707106781), VADD(TK, TL));
+	       TN = VSUB(Tm, Tn);
+	       TO = VSUB(Tz, TA);
+	       TP = VFMA(LDK(KP707106781), VSUB(TN, TO), TM);
+	       TQ = VSUB(TJ, TP);
+	       TR = VFMA(LDK(KP707106781), VSUB(T8, T9), T1);
+	       TS = VSUB(Tv, Tw);
+	       TT = VADD(TR, TS);
+	       TU = VMUL(LDK(KP707106781), VSUB(TK, TL));
+	       TV = VFMS(LDK(KP707106781), VADD(TN, TO), TU);
+	       TW = VADD(TT, TV);
+	       STA(&(O[WS(os, 1)]), VFMS(LDK(KP293460948), TW, VMUL(LDK(KP1_978353019), TQ)), ovs, &(O[0]));
+	       TX = VSUB(TR, TS);
+	       TY = VFMS(LDK(KP707106781), VSUB(TN, TO), TM);
+	       TZ = VADD(TX, TY);
+	       T10 = VADD(TH, TI);
+	       T11 = VFMA(LDK(KP707106781), VADD(TN, TO), TU);
+	       T12 = VADD(T10, T11);
+	       STA(&(O[WS(os, 2)]), VFMA(LDK(KP1_940062506), T12, VMUL(LDK(KP485960359), TZ)), ovs, &(O[0]));
+	       T13 = VSUB(Tu, Tx);
+	       T14 = VSUB(To, Tr);
+	       T15 = VSUB(T13, T14);
+	       T16 = VSUB(Th, Tk);
+	       T17 = VSUB(TB, TE);
+	       T18 = VADD(T16, T17);
+	       STA(&(O[WS(os, 3)]), VFMS(LDK(KP673779706), T18, VMUL(LDK(KP1_883088130), T15)), ovs, &(O[0]));
+	       T19 = VSUB(T16, T17);
+	       T1a = VADD(T13, T14);
+	       STA(&(O[WS(os, 4)]), VFMA(LDK(KP1_807978586), T1a, VMUL(LDK(KP855110186), T19)), ovs, &(O[0]));
+	       T1b = VSUB(T10, T11);
+	       T1c = VSUB(TX, TY);
+	       STA(&(O[WS(os, 5)]), VFMS(LDK(KP1_028205488), T1c, VMUL(LDK(KP1_715457220), T1b)), ovs, &(O[0]));
+	       T1d = VSUB(TT, TV);
+	       T1e = VADD(TJ, TP);
+	       STA(&(O[WS(os, 6)]), VFMA(LDK(KP1_606415062), T1e, VMUL(LDK(KP1_191398608), T1d)), ovs, &(O[0]));
+	       T1f = VSUB(Ty, TF);
+	       T1g = VSUB(Tl, Ts);
+	       STA(&(O[WS(os, 7)]), VFMS(LDK(KP1_343117909), T1g, VMUL(LDK(KP1_481902250), T1f)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 8)]), VFMA(LDK(KP1_343117909), T1f, VMUL(LDK(KP1_481902250), T1g)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 9)]), VFMS(LDK(KP1_606415062), T1d, VMUL(LDK(KP1_191398608), T1e)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 10)]), VFMA(LDK(KP1_028205488), T1b, VMUL(LDK(KP1_715457220), T1c)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 11)]), VFMS(LDK(KP1_807978586), T19, VMUL(LDK(KP855110186), T1a)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 12)]), VFMA(LDK(KP673779706), T15, VMUL(LDK(KP1_883088130), T18)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 13)]), VFMS(LDK(KP1_940062506), TZ, VMUL(LDK(KP485960359), T12)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 14)]), VFMA(LDK(KP293460948), TQ, VMUL(LDK(KP1_978353019), TW)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 15)]), VFMS(LDK(KP1_997590912), Tt, VMUL(LDK(KP098135348), TG)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 16, XSIMD_STRING("o11v_16"), {50, 30, 36, 0}, &GENUS, RODFT11 };
+
+void XSIMD(codelet_o11v_16) (planner *p) {
+     X(kr2r_register) (p, o11v_16, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o11v_16 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft11 -n 16 -name o11_16 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 82 FP additions, 62 FP multiplications,
+ * (or, 82 additions, 62 multiplications, 0 fused multiply/add),
+ * 82 stack variables, 23 constants, and 32 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o11v_16(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_997590912, +1.997590912410344785429543209518201388886407229);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP098135348, +0.098135348654836028509909953885365316629490726);
+     DVK(KP293460948, +0.293460948910723503317700259293435639412430633);
+     DVK(KP1_978353019, +1.978353019929561946903347476032486127967379067);
+     DVK(KP1_940062506, +1.940062506389087985207968414572200502913731924);
+     DVK(KP485960359, +0.485960359806527779896548324154942236641981567);
+     DVK(KP673779706, +0.673779706784440101378506425238295140955533559);
+     DVK(KP1_883088130, +1.883088130366041556825018805199004714371179592);
+     DVK(KP1_807978586, +1.807978586246886663172400594461074097420264050);
+     DVK(KP855110186, +0.855110186860564188641933713777597068609157259);
+     DVK(KP1_028205488, +1.028205488386443453187387677937631545216098241);
+     DVK(KP1_715457220, +1.715457220000544139804539968569540274084981599);
+     DVK(KP1_606415062, +1.606415062961289819613353025926283847759138854);
+     DVK(KP1_191398608, +1.191398608984866686934073057659939779023852677);
+     DVK(KP1_343117909, +1.343117909694036801250753700854843606457501264);
+     DVK(KP1_481902250, +1.481902250709918182351233794990325459457910619);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(32, is), MAKE_VOLATILE_STRIDE(32, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu, Tv, Tw, Tx, Ty, Tz, TA;
+	       V TB, TC, TD, TE, TF, TG, TH, TI, TJ, TK, TL, TM;
+	       V TN, TO, TP, TQ, TR, TS, TT, TU, TV, TW, TX, TY;
+	       V TZ, T10, T11, T12, T13, T14, T15, T16, T17, T18, T19, T1a;
+	       V T1b, T1c, T1d, T1e, T1f, T1g, T1h, T1i, T1j, T1k;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = LDA(&(I[WS(is, 8)]), ivs, &(I[0]));
+	       Ta = LDA(&(I[WS(is, 9)]), ivs, &(I[0]));
+	       Tb = LDA(&(I[WS(is, 10)]), ivs, &(I[0]));
+	       Tc = LDA(&(I[WS(is, 11)]), ivs, &(I[0]));
+	       Td = LDA(&(I[WS(is, 12)]), ivs, &(I[0]));
+	       Te = LDA(&(I[WS(is, 13)]), ivs, &(I[0]));
+	       Tf = LDA(&(I[WS(is, 14)]), ivs, &(I[0]));
+	       Tg = LDA(&(I[WS(is, 15)]), ivs, &(I[0]));
+	       Th = VMUL(LDK(KP707106781), VADD(T8, T9));
+	       Ti = VADD(Tg, Th);
+	       Tj = VADD(VMUL(LDK(KP923879532), Tc), VMUL(LDK(KP382683432), T5));
+	       Tk = VADD(VMUL(LDK(KP382683432), T4), VMUL(LDK(KP923879532), Td));
+	       Tl = VADD(Tj, Tk);
+	       Tm = VADD(Ti, Tl);
+	       Tn = VADD(VMUL(LDK(KP980785280), Te), VMUL(LDK(KP195090322), T3));
+	       To = VADD(VMUL(LDK(KP555570233), T6), VMUL(LDK(KP831469612), Tb));
+	       Tp = VADD(Tn, To);
+	       Tq = VADD(VMUL(LDK(KP831469612), Ta), VMUL(LDK(KP555570233), T7));
+	       Tr = VADD(VMUL(LDK(KP195090322), T2), VMUL(LDK(KP980785280), Tf));
+	       Ts = VADD(Tq, Tr);
+	       Tt = VADD(Tp, Ts);
+	       Tu = VADD(Tm, Tt);
+	       Tv = VMUL(LDK(KP707106781), VSUB(T8, T9));
+	       Tw = VSUB(T1, Tv);
+	       Tx = VSUB(VMUL(LDK(KP923879532), T5), VMUL(LDK(KP382683432), Tc));
+	       Ty = VSUB(VMUL(LDK(KP382683432), Td), VMUL(LDK(KP923879532), T4));
+	       Tz = VADD(Tx, Ty);
+	       TA = VADD(Tw, Tz);
+	       TB = VSUB(VMUL(LDK(KP980785280), T3), VMUL(LDK(KP195090322), Te));
+	       TC = VSUB(VMUL(LDK(KP555570233), Tb), VMUL(LDK(KP831469612), T6));
+	       TD = VADD(TB, TC);
+	       TE = VSUB(VMUL(LDK(KP831469612), T7), VMUL(LDK(KP555570233), Ta));
+	       TF = VSUB(VMUL(LDK(KP195090322), Tf), VMUL(LDK(KP980785280), T2));
+	       TG = VADD(TE, TF);
+	       TH = VADD(TD, TG);
+	       TI = VADD(TA, TH);
+	       STA(&(O[0]), VADD(VMUL(LDK(KP1_997590912), Tu), VMUL(LDK(KP098135348), TI)), ovs, &(O[0]));
+	       TJ = VADD(T1, Tv);
+	       TK = VSUB(Tj, Tk);
+	       TL = VADD(TJ, TK);
+	       TM = VSUB(TB, TC);
+	       TN = VSUB(Tn, To);
+	       TO = VMUL(LDK(KP707106781), VADD(TM, TN));
+	       TP = VSUB(TE, TF);
+	       TQ = VSUB(Tq, Tr);
+	       TR = VMUL(LDK(KP707106781), VSUB(TP, TQ));
+	       TS = VSUB(TO, TR);
+	       TT = VADD(TL, TS);
+	       TU = VSUB(Tg, Th);
+	       TV = VSUB(Tx, Ty);
+	       TW = VSUB(TU, TV);
+	       TX = VMUL(LDK(KP707106781), VSUB(TM, TN));
+	       TY = VMUL(LDK(KP707106781), VADD(TP, TQ));
+	       TZ = VADD(TX, TY);
+	       T10 = VSUB(TW, TZ);
+	       STA(&(O[WS(os, 1)]), VSUB(VMUL(LDK(KP293460948), TT), VMUL(LDK(KP1_978353019), T10)), ovs, &(O[0]));
+	       T11 = VADD(TU, TV);
+	       T12 = VADD(TO, TR);
+	       T13 = VADD(T11, T12);
+	       T14 = VSUB(TJ, TK);
+	       T15 = VSUB(TX, TY);
+	       T16 = VADD(T14, T15);
+	       STA(&(O[WS(os, 2)]), VADD(VMUL(LDK(KP1_940062506), T13), VMUL(LDK(KP485960359), T16)), ovs, &(O[0]));
+	       T17 = VSUB(Tw, Tz);
+	       T18 = VSUB(Tp, Ts);
+	       T19 = VADD(T17, T18);
+	       T1a = VSUB(Ti, Tl);
+	       T1b = VSUB(TD, TG);
+	       T1c = VSUB(T1a, T1b);
+	       STA(&(O[WS(os, 3)]), VSUB(VMUL(LDK(KP673779706), T19), VMUL(LDK(KP1_883088130), T1c)), ovs, &(O[0]));
+	       T1d = VADD(T1a, T1b);
+	       T1e = VSUB(T17, T18);
+	       STA(&(O[WS(os, 4)]), VADD(VMUL(LDK(KP1_807978586), T1d), VMUL(LDK(KP855110186), T1e)), ovs, &(O[0]));
+	       T1f = VSUB(T14, T15);
+	       T1g = VSUB(T11, T12);
+	       STA(&(O[WS(os, 5)]), VSUB(VMUL(LDK(KP1_028205488), T1f), VMUL(LDK(KP1_715457220), T1g)), ovs, &(O[0]));
+	       T1h = VADD(TW, TZ);
+	       T1i = VSUB(TL, TS);
+	       STA(&(O[WS(os, 6)]), VADD(VMUL(LDK(KP1_606415062), T1h), VMUL(LDK(KP1_191398608), T1i)), ovs, &(O[0]));
+	       T1j = VSUB(TA, TH);
+	       T1k = VSUB(Tm, Tt);
+	       STA(&(O[WS(os, 7)]), VSUB(VMUL(LDK(KP1_343117909), T1j), VMUL(LDK(KP1_481902250), T1k)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 8)]), VADD(VMUL(LDK(KP1_343117909), T1k), VMUL(LDK(KP1_481902250), T1j)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 9)]), VSUB(VMUL(LDK(KP1_606415062), T1i), VMUL(LDK(KP1_191398608), T1h)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 10)]), VADD(VMUL(LDK(KP1_028205488), T1g), VMUL(LDK(KP1_715457220), T1f)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 11)]), VSUB(VMUL(LDK(KP1_807978586), T1e), VMUL(LDK(KP855110186), T1d)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 12)]), VADD(VMUL(LDK(KP673779706), T1c), VMUL(LDK(KP1_883088130), T19)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 13)]), VSUB(VMUL(LDK(KP1_940062506), T16), VMUL(LDK(KP485960359), T13)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 14)]), VADD(VMUL(LDK(KP293460948), T10), VMUL(LDK(KP1_978353019), TT)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 15)]), VSUB(VMUL(LDK(KP1_997590912), TI), VMUL(LDK(KP098135348), Tu)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 16, XSIMD_STRING("o11v_16"), {82, 62, 0, 0}, &GENUS, RODFT11 };
+
+void XSIMD(codelet_o11v_16) (planner *p) {
+     X(kr2r_register) (p, o11v_16, &desc);
+}
+
+#endif
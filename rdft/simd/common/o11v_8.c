@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2024, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sat Oct 17 07:17:40 UTC 2026 */
+
+#include "rdft/codelet-rdft.h"
+
+
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o11v_8 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -fma -compact -variables 4 -pipeline-latency 4 -rodft11 -n 8 -name o11_8 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 32 FP additions, 28 FP multiplications,
+ * (or, 16 additions, 12 multiplications, 16 fused multiply/add),
+ * 28 stack variables, 11 constants, and 16 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o11v_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(16, is), MAKE_VOLATILE_STRIDE(16, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = VFNMS(LDK(KP707106781), VSUB(T4, T5), T1);
+	       Ta = VFMS(LDK(KP923879532), T3, VMUL(LDK(KP382683432), T6));
+	       Tb = VFMS(LDK(KP382683432), T7, VMUL(LDK(KP923879532), T2));
+	       Tc = VADD(Ta, Tb);
+	       Td = VADD(T9, Tc);
+	       Te = VFMA(LDK(KP707106781), VADD(T4, T5), T8);
+	       Tf = VFMA(LDK(KP923879532), T6, VMUL(LDK(KP382683432), T3));
+	       Tg = VFMA(LDK(KP382683432), T2, VMUL(LDK(KP923879532), T7));
+	       Th = VADD(Tf, Tg);
+	       Ti = VADD(Te, Th);
+	       STA(&(O[0]), VFMA(LDK(KP1_990369453), Ti, VMUL(LDK(KP196034280), Td)), ovs, &(O[0]));
+	       Tj = VFNMS(LDK(KP707106781), VADD(T4, T5), T8);
+	       Tk = VSUB(Ta, Tb);
+	       Tl = VSUB(Tj, Tk);
+	       Tm = VFMA(LDK(KP707106781), VSUB(T4, T5), T1);
+	       Tn = VSUB(Tf, Tg);
+	       To = VADD(Tm, Tn);
+	       STA(&(O[WS(os, 1)]), VFMS(LDK(KP580569354), To, VMUL(LDK(KP1_913880671), Tl)), ovs, &(O[0]));
+	       Tp = VSUB(Tm, Tn);
+	       Tq = VADD(Tj, Tk);
+	       STA(&(O[WS(os, 2)]), VFMA(LDK(KP1_763842528), Tq, VMUL(LDK(KP942793473), Tp)), ovs, &(O[0]));
+	       Tr = VSUB(Te, Th);
+	       Ts = VSUB(T9, Tc);
+	       STA(&(O[WS(os, 3)]), VFMS(LDK(KP1_268786568), Ts, VMUL(LDK(KP1_546020906), Tr)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 4)]), VFMA(LDK(KP1_268786568), Tr, VMUL(LDK(KP1_546020906), Ts)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 5)]), VFMS(LDK(KP1_763842528), Tp, VMUL(LDK(KP942793473), Tq)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 6)]), VFMA(LDK(KP580569354), Tl, VMUL(LDK(KP1_913880671), To)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 7)]), VFMS(LDK(KP1_990369453), Td, VMUL(LDK(KP196034280), Ti)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 8, XSIMD_STRING("o11v_8"), {16, 12, 16, 0}, &GENUS, RODFT11 };
+
+void XSIMD(codelet_o11v_8) (planner *p) {
+     X(kr2r_register) (p, o11v_8, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name o11v_8 -include rdft/simd/r2rv.h from: ../../../support/gen-r2r.py -compact -variables 4 -pipeline-latency 4 -rodft11 -n 8 -name o11_8 -include rdft/scalar/r2r.h */
+
+/*
+ * This function contains 30 FP additions, 26 FP multiplications,
+ * (or, 30 additions, 26 multiplications, 0 fused multiply/add),
+ * 30 stack variables, 11 constants, and 16 memory accesses
+ */
+#include "rdft/simd/r2rv.h"
+
+static void o11v_8(const R *I, R *O, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_990369453, +1.990369453344393772489673906218959843150949737);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP196034280, +0.196034280659121203988391127777283691722273346);
+     DVK(KP580569354, +0.580569354508924735272384751634790549382952557);
+     DVK(KP1_913880671, +1.913880671464417729871595773960539938965698411);
+     DVK(KP1_763842528, +1.763842528696710059425513727320776699016885241);
+     DVK(KP942793473, +0.942793473651995297112775251810508755314920638);
+     DVK(KP1_268786568, +1.268786568327290996430343226450986741351374190);
+     DVK(KP1_546020906, +1.546020906725473921621813219516939601942082586);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), I = I + ((2 * VL) * ivs), O = O + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(16, is), MAKE_VOLATILE_STRIDE(16, os)) {
+	       V T1, T2, T3, T4, T5, T6, T7, T8, T9, Ta, Tb, Tc;
+	       V Td, Te, Tf, Tg, Th, Ti, Tj, Tk, Tl, Tm, Tn, To;
+	       V Tp, Tq, Tr, Ts, Tt, Tu;
+	       T1 = LDA(&(I[0]), ivs, &(I[0]));
+	       T2 = LDA(&(I[WS(is, 1)]), ivs, &(I[0]));
+	       T3 = LDA(&(I[WS(is, 2)]), ivs, &(I[0]));
+	       T4 = LDA(&(I[WS(is, 3)]), ivs, &(I[0]));
+	       T5 = LDA(&(I[WS(is, 4)]), ivs, &(I[0]));
+	       T6 = LDA(&(I[WS(is, 5)]), ivs, &(I[0]));
+	       T7 = LDA(&(I[WS(is, 6)]), ivs, &(I[0]));
+	       T8 = LDA(&(I[WS(is, 7)]), ivs, &(I[0]));
+	       T9 = VMUL(LDK(KP707106781), VADD(T4, T5));
+	       Ta = VADD(T8, T9);
+	       Tb = VADD(VMUL(LDK(KP923879532), T6), VMUL(LDK(KP382683432), T3));
+	       Tc = VADD(VMUL(LDK(KP382683432), T2), VMUL(LDK(KP923879532), T7));
+	       Td = VADD(Tb, Tc);
+	       Te = VADD(Ta, Td);
+	       Tf = VMUL(LDK(KP707106781), VSUB(T4, T5));
+	       Tg = VSUB(T1, Tf);
+	       Th = VSUB(VMUL(LDK(KP923879532), T3), VMUL(LDK(KP382683432), T6));
+	       Ti = VSUB(VMUL(LDK(KP382683432), T7), VMUL(LDK(KP923879532), T2));
+	       Tj = VADD(Th, Ti);
+	       Tk = VADD(Tg, Tj);
+	       STA(&(O[0]), VADD(VMUL(LDK(KP1_990369453), Te), VMUL(LDK(KP196034280), Tk)), ovs, &(O[0]));
+	       Tl = VADD(T1, Tf);
+	       Tm = VSUB(Tb, Tc);
+	       Tn = VADD(Tl, Tm);
+	       To = VSUB(T8, T9);
+	       Tp = VSUB(Th, Ti);
+	       Tq = VSUB(To, Tp);
+	       STA(&(O[WS(os, 1)]), VSUB(VMUL(LDK(KP580569354), Tn), VMUL(LDK(KP1_913880671), Tq)), ovs, &(O[0]));
+	       Tr = VADD(To, Tp);
+	       Ts = VSUB(Tl, Tm);
+	       STA(&(O[WS(os, 2)]), VADD(VMUL(LDK(KP1_763842528), Tr), VMUL(LDK(KP942793473), Ts)), ovs, &(O[0]));
+	       Tt = VSUB(Tg, Tj);
+	       Tu = VSUB(Ta, Td);
+	       STA(&(O[WS(os, 3)]), VSUB(VMUL(LDK(KP1_268786568), Tt), VMUL(LDK(KP1_546020906), Tu)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 4)]), VADD(VMUL(LDK(KP1_268786568), Tu), VMUL(LDK(KP1_546020906), Tt)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 5)]), VSUB(VMUL(LDK(KP1_763842528), Ts), VMUL(LDK(KP942793473), Tr)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 6)]), VADD(VMUL(LDK(KP580569354), Tq), VMUL(LDK(KP1_913880671), Tn)), ovs, &(O[0]));
+	       STA(&(O[WS(os, 7)]), VSUB(VMUL(LDK(KP1_990369453), Tk), VMUL(LDK(KP196034280), Te)), ovs, &(O[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2r_desc desc = { 8, XSIMD_STRING("o11v_8"), {30, 26, 0, 0}, &GENUS, RODFT11 };
+
+void XSIMD(codelet_o11v_8) (planner *p) {
+     X(kr2r_register) (p, o11v_8, &desc);
+}
+
+#endif
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:07:28 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_10 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -fma -compact -variables 4 -pipeline-latency 4 -sign 1 -n 10 -name r2cb_10 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 34 FP additions, 20 FP multiplications,
+ * (or, 14 additions, 0 multiplications, 20 fused multiply/add),
+ * 26 stack variables, 5 constants, and 20 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_10(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_902113032, +1.902113032590307144232878666758764286811397268);
+     DVK(KP1_118033988, +1.118033988749894848204586834365638117720309180);
+     DVK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DVK(KP618033988, +0.618033988749894848204586834365638117720309180);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(40, rs), MAKE_VOLATILE_STRIDE(40, csr), MAKE_VOLATILE_STRIDE(40, csi)) {
+	       V T3, Tb, Tn, Tu, Tk, Tv, Ta, Ts, Te, Tg, Ti, Tj;
+	       {
+		    V T1, T2, Tl, Tm;
+		    T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+		    T2 = LDA(&(Cr[WS(csr, 5)]), ivs, &(Cr[0]));
+		    T3 = VSUB(T1, T2);
+		    Tb = VADD(T1, T2);
+		    Tl = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+		    Tm = LDA(&(Ci[WS(csi, 3)]), ivs, &(Ci[0]));
+		    Tn = VSUB(Tl, Tm);
+		    Tu = VADD(Tl, Tm);
+	       }
+	       Ti = LDA(&(Ci[WS(csi, 4)]), ivs, &(Ci[0]));
+	       Tj = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+	       Tk = VSUB(Ti, Tj);
+	       Tv = VADD(Ti, Tj);
+	       {
+		    V T6, Tc, T9, Td;
+		    {
+			 V T4, T5, T7, T8;
+			 T4 = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+			 T5 = LDA(&(Cr[WS(csr, 3)]), ivs, &(Cr[0]));
+			 T6 = VSUB(T4, T5);
+			 Tc = VADD(T4, T5);
+			 T7 = LDA(&(Cr[WS(csr, 4)]), ivs, &(Cr[0]));
+			 T8 = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+			 T9 = VSUB(T7, T8);
+			 Td = VADD(T7, T8);
+		    }
+		    Ta = VADD(T6, T9);
+		    Ts = VSUB(T6, T9);
+		    Te = VADD(Tc, Td);
+		    Tg = VSUB(Tc, Td);
+	       }
+	       STA(&(R1[WS(rs, 2)]), VFMA(LDK(KP2_000000000), Ta, T3), ovs, &(R1[0]));
+	       STA(&(R0[0]), VFMA(LDK(KP2_000000000), Te, Tb), ovs, &(R0[0]));
+	       {
+		    V To, Tq, Th, Tp, Tf;
+		    To = VFNMS(LDK(KP618033988), Tn, Tk);
+		    Tq = VFMA(LDK(KP618033988), Tk, Tn);
+		    Tf = VFNMS(LDK(KP500000000), Te, Tb);
+		    Th = VFNMS(LDK(KP1_118033988), Tg, Tf);
+		    Tp = VFMA(LDK(KP1_118033988), Tg, Tf);
+		    STA(&(R0[WS(rs, 4)]), VFNMS(LDK(KP1_902113032), To, Th), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 2)]), VFMA(LDK(KP1_902113032), Tq, Tp), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 1)]), VFMA(LDK(KP1_902113032), To, Th), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 3)]), VFNMS(LDK(KP1_902113032), Tq, Tp), ovs, &(R0[0]));
+	       }
+	       {
+		    V Tw, Ty, Tt, Tx, Tr;
+		    Tw = VFMA(LDK(KP618033988), Tv, Tu);
+		    Ty = VFNMS(LDK(KP618033988), Tu, Tv);
+		    Tr = VFNMS(LDK(KP500000000), Ta, T3);
+		    Tt = VFMA(LDK(KP1_118033988), Ts, Tr);
+		    Tx = VFNMS(LDK(KP1_118033988), Ts, Tr);
+		    STA(&(R1[0]), VFNMS(LDK(KP1_902113032), Tw, Tt), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 3)]), VFMA(LDK(KP1_902113032), Ty, Tx), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 4)]), VFMA(LDK(KP1_902113032), Tw, Tt), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 1)]), VFNMS(LDK(KP1_902113032), Ty, Tx), ovs, &(R1[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 10, XSIMD_STRING("r2cbv_10"), {14, 0, 20, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_10) (planner *p) {
+     X(kr2c_register) (p, r2cbv_10, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_10 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -compact -variables 4 -pipeline-latency 4 -sign 1 -n 10 -name r2cb_10 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 34 FP additions, 14 FP multiplications,
+ * (or, 26 additions, 6 multiplications, 8 fused multiply/add),
+ * 26 stack variables, 5 constants, and 20 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_10(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DVK(KP1_902113032, +1.902113032590307144232878666758764286811397268);
+     DVK(KP1_175570504, +1.175570504584946258337411909278145537195304875);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DVK(KP1_118033988, +1.118033988749894848204586834365638117720309180);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(40, rs), MAKE_VOLATILE_STRIDE(40, csr), MAKE_VOLATILE_STRIDE(40, csi)) {
+	       V T3, Tb, Tn, Tv, Tk, Tu, Ta, Ts, Te, Tg, Ti, Tj;
+	       {
+		    V T1, T2, Tl, Tm;
+		    T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+		    T2 = LDA(&(Cr[WS(csr, 5)]), ivs, &(Cr[0]));
+		    T3 = VSUB(T1, T2);
+		    Tb = VADD(T1, T2);
+		    Tl = LDA(&(Ci[WS(csi, 4)]), ivs, &(Ci[0]));
+		    Tm = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+		    Tn = VSUB(Tl, Tm);
+		    Tv = VADD(Tl, Tm);
+	       }
+	       Ti = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+	       Tj = LDA(&(Ci[WS(csi, 3)]), ivs, &(Ci[0]));
+	       Tk = VSUB(Ti, Tj);
+	       Tu = VADD(Ti, Tj);
+	       {
+		    V T6, Tc, T9, Td;
+		    {
+			 V T4, T5, T7, T8;
+			 T4 = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+			 T5 = LDA(&(Cr[WS(csr, 3)]), ivs, &(Cr[0]));
+			 T6 = VSUB(T4, T5);
+			 Tc = VADD(T4, T5);
+			 T7 = LDA(&(Cr[WS(csr, 4)]), ivs, &(Cr[0]));
+			 T8 = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+			 T9 = VSUB(T7, T8);
+			 Td = VADD(T7, T8);
+		    }
+		    Ta = VADD(T6, T9);
+		    Ts = VMUL(LDK(KP1_118033988), VSUB(T6, T9));
+		    Te = VADD(Tc, Td);
+		    Tg = VMUL(LDK(KP1_118033988), VSUB(Tc, Td));
+	       }
+	       STA(&(R1[WS(rs, 2)]), VFMA(LDK(KP2_000000000), Ta, T3), ovs, &(R1[0]));
+	       STA(&(R0[0]), VFMA(LDK(KP2_000000000), Te, Tb), ovs, &(R0[0]));
+	       {
+		    V To, Tq, Th, Tp, Tf;
+		    To = VFNMS(LDK(KP1_902113032), Tn, VMUL(LDK(KP1_175570504), Tk));
+		    Tq = VFMA(LDK(KP1_902113032), Tk, VMUL(LDK(KP1_175570504), Tn));
+		    Tf = VFNMS(LDK(KP500000000), Te, Tb);
+		    Th = VSUB(Tf, Tg);
+		    Tp = VADD(Tg, Tf);
+		    STA(&(R0[WS(rs, 1)]), VSUB(Th, To), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 2)]), VADD(Tp, Tq), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 4)]), VADD(Th, To), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 3)]), VSUB(Tp, Tq), ovs, &(R0[0]));
+	       }
+	       {
+		    V Tw, Ty, Tt, Tx, Tr;
+		    Tw = VFNMS(LDK(KP1_902113032), Tv, VMUL(LDK(KP1_175570504), Tu));
+		    Ty = VFMA(LDK(KP1_902113032), Tu, VMUL(LDK(KP1_175570504), Tv));
+		    Tr = VFNMS(LDK(KP500000000), Ta, T3);
+		    Tt = VSUB(Tr, Ts);
+		    Tx = VADD(Ts, Tr);
+		    STA(&(R1[WS(rs, 3)]), VSUB(Tt, Tw), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 4)]), VADD(Tx, Ty), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 1)]), VADD(Tt, Tw), ovs, &(R1[0]));
+		    STA(&(R1[0]), VSUB(Tx, Ty), ovs, &(R1[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 10, XSIMD_STRING("r2cbv_10"), {26, 6, 8, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_10) (planner *p) {
+     X(kr2c_register) (p, r2cbv_10, &desc);
+}
+
+#endif
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:07:28 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_12 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -fma -compact -variables 4 -pipeline-latency 4 -sign 1 -n 12 -name r2cb_12 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 38 FP additions, 16 FP multiplications,
+ * (or, 22 additions, 0 multiplications, 16 fused multiply/add),
+ * 25 stack variables, 2 constants, and 24 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_12(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(48, rs), MAKE_VOLATILE_STRIDE(48, csr), MAKE_VOLATILE_STRIDE(48, csi)) {
+	       V T8, Tb, Tk, Tz, Tu, Tv, Tn, Ty, T3, Tp, Tf, T6, Tq, Ti;
+	       {
+		    V T9, Ta, Tl, Tm;
+		    T8 = LDA(&(Cr[WS(csr, 3)]), ivs, &(Cr[0]));
+		    T9 = LDA(&(Cr[WS(csr, 5)]), ivs, &(Cr[0]));
+		    Ta = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+		    Tb = VADD(T9, Ta);
+		    Tk = VFNMS(LDK(KP2_000000000), T8, Tb);
+		    Tz = VSUB(T9, Ta);
+		    Tu = LDA(&(Ci[WS(csi, 3)]), ivs, &(Ci[0]));
+		    Tl = LDA(&(Ci[WS(csi, 5)]), ivs, &(Ci[0]));
+		    Tm = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+		    Tv = VADD(Tl, Tm);
+		    Tn = VSUB(Tl, Tm);
+		    Ty = VFMA(LDK(KP2_000000000), Tu, Tv);
+	       }
+	       {
+		    V Te, T1, T2, Td;
+		    Te = LDA(&(Ci[WS(csi, 4)]), ivs, &(Ci[0]));
+		    T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+		    T2 = LDA(&(Cr[WS(csr, 4)]), ivs, &(Cr[0]));
+		    Td = VSUB(T1, T2);
+		    T3 = VFMA(LDK(KP2_000000000), T2, T1);
+		    Tp = VFNMS(LDK(KP1_732050807), Te, Td);
+		    Tf = VFMA(LDK(KP1_732050807), Te, Td);
+	       }
+	       {
+		    V Th, T4, T5, Tg;
+		    Th = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+		    T4 = LDA(&(Cr[WS(csr, 6)]), ivs, &(Cr[0]));
+		    T5 = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+		    Tg = VSUB(T4, T5);
+		    T6 = VFMA(LDK(KP2_000000000), T5, T4);
+		    Tq = VFMA(LDK(KP1_732050807), Th, Tg);
+		    Ti = VFNMS(LDK(KP1_732050807), Th, Tg);
+	       }
+	       {
+		    V T7, Tc, Tx, TA;
+		    T7 = VADD(T3, T6);
+		    Tc = VADD(T8, Tb);
+		    STA(&(R0[WS(rs, 3)]), VFNMS(LDK(KP2_000000000), Tc, T7), ovs, &(R0[0]));
+		    STA(&(R0[0]), VFMA(LDK(KP2_000000000), Tc, T7), ovs, &(R0[0]));
+		    {
+			 V Tj, To, TB, TC;
+			 Tj = VADD(Tf, Ti);
+			 To = VFMA(LDK(KP1_732050807), Tn, Tk);
+			 STA(&(R0[WS(rs, 1)]), VADD(Tj, To), ovs, &(R0[0]));
+			 STA(&(R0[WS(rs, 4)]), VSUB(Tj, To), ovs, &(R0[0]));
+			 TB = VSUB(Tf, Ti);
+			 TC = VFNMS(LDK(KP1_732050807), Tz, Ty);
+			 STA(&(R1[WS(rs, 2)]), VSUB(TB, TC), ovs, &(R1[0]));
+			 STA(&(R1[WS(rs, 5)]), VADD(TB, TC), ovs, &(R1[0]));
+		    }
+		    Tx = VSUB(Tp, Tq);
+		    TA = VFMA(LDK(KP1_732050807), Tz, Ty);
+		    STA(&(R1[0]), VSUB(Tx, TA), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 3)]), VADD(Tx, TA), ovs, &(R1[0]));
+		    {
+			 V Tt, Tw, Tr, Ts;
+			 Tt = VSUB(T3, T6);
+			 Tw = VSUB(Tu, Tv);
+			 STA(&(R1[WS(rs, 4)]), VFNMS(LDK(KP2_000000000), Tw, Tt), ovs, &(R1[0]));
+			 STA(&(R1[WS(rs, 1)]), VFMA(LDK(KP2_000000000), Tw, Tt), ovs, &(R1[0]));
+			 Tr = VADD(Tp, Tq);
+			 Ts = VFNMS(LDK(KP1_732050807), Tn, Tk);
+			 STA(&(R0[WS(rs, 5)]), VADD(Tr, Ts), ovs, &(R0[0]));
+			 STA(&(R0[WS(rs, 2)]), VSUB(Tr, Ts), ovs, &(R0[0]));
+		    }
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 12, XSIMD_STRING("r2cbv_12"), {22, 0, 16, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_12) (planner *p) {
+     X(kr2c_register) (p, r2cbv_12, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_12 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -compact -variables 4 -pipeline-latency 4 -sign 1 -n 12 -name r2cb_12 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 38 FP additions, 10 FP multiplications,
+ * (or, 34 additions, 6 multiplications, 4 fused multiply/add),
+ * 25 stack variables, 2 constants, and 24 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_12(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(48, rs), MAKE_VOLATILE_STRIDE(48, csr), MAKE_VOLATILE_STRIDE(48, csi)) {
+	       V T8, Tb, Tm, TA, Tw, Tx, Tp, TB, T3, Tr, Tg, T6, Ts, Tk;
+	       {
+		    V T9, Ta, Tn, To;
+		    T8 = LDA(&(Cr[WS(csr, 3)]), ivs, &(Cr[0]));
+		    T9 = LDA(&(Cr[WS(csr, 5)]), ivs, &(Cr[0]));
+		    Ta = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+		    Tb = VADD(T9, Ta);
+		    Tm = VFMS(LDK(KP2_000000000), T8, Tb);
+		    TA = VMUL(LDK(KP1_732050807), VSUB(T9, Ta));
+		    Tw = LDA(&(Ci[WS(csi, 3)]), ivs, &(Ci[0]));
+		    Tn = LDA(&(Ci[WS(csi, 5)]), ivs, &(Ci[0]));
+		    To = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+		    Tx = VADD(Tn, To);
+		    Tp = VMUL(LDK(KP1_732050807), VSUB(Tn, To));
+		    TB = VFMA(LDK(KP2_000000000), Tw, Tx);
+	       }
+	       {
+		    V Tf, T1, T2, Td, Te;
+		    Te = LDA(&(Ci[WS(csi, 4)]), ivs, &(Ci[0]));
+		    Tf = VMUL(LDK(KP1_732050807), Te);
+		    T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+		    T2 = LDA(&(Cr[WS(csr, 4)]), ivs, &(Cr[0]));
+		    Td = VSUB(T1, T2);
+		    T3 = VFMA(LDK(KP2_000000000), T2, T1);
+		    Tr = VSUB(Td, Tf);
+		    Tg = VADD(Td, Tf);
+	       }
+	       {
+		    V Tj, T4, T5, Th, Ti;
+		    Ti = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+		    Tj = VMUL(LDK(KP1_732050807), Ti);
+		    T4 = LDA(&(Cr[WS(csr, 6)]), ivs, &(Cr[0]));
+		    T5 = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+		    Th = VSUB(T4, T5);
+		    T6 = VFMA(LDK(KP2_000000000), T5, T4);
+		    Ts = VADD(Th, Tj);
+		    Tk = VSUB(Th, Tj);
+	       }
+	       {
+		    V T7, Tc, Tz, TC;
+		    T7 = VADD(T3, T6);
+		    Tc = VMUL(LDK(KP2_000000000), VADD(T8, Tb));
+		    STA(&(R0[WS(rs, 3)]), VSUB(T7, Tc), ovs, &(R0[0]));
+		    STA(&(R0[0]), VADD(T7, Tc), ovs, &(R0[0]));
+		    {
+			 V Tl, Tq, TD, TE;
+			 Tl = VADD(Tg, Tk);
+			 Tq = VSUB(Tm, Tp);
+			 STA(&(R0[WS(rs, 1)]), VSUB(Tl, Tq), ovs, &(R0[0]));
+			 STA(&(R0[WS(rs, 4)]), VADD(Tl, Tq), ovs, &(R0[0]));
+			 TD = VSUB(Tg, Tk);
+			 TE = VSUB(TB, TA);
+			 STA(&(R1[WS(rs, 2)]), VSUB(TD, TE), ovs, &(R1[0]));
+			 STA(&(R1[WS(rs, 5)]), VADD(TD, TE), ovs, &(R1[0]));
+		    }
+		    Tz = VSUB(Tr, Ts);
+		    TC = VADD(TA, TB);
+		    STA(&(R1[0]), VSUB(Tz, TC), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 3)]), VADD(Tz, TC), ovs, &(R1[0]));
+		    {
+			 V Tv, Ty, Tt, Tu;
+			 Tv = VSUB(T3, T6);
+			 Ty = VMUL(LDK(KP2_000000000), VSUB(Tw, Tx));
+			 STA(&(R1[WS(rs, 4)]), VSUB(Tv, Ty), ovs, &(R1[0]));
+			 STA(&(R1[WS(rs, 1)]), VADD(Tv, Ty), ovs, &(R1[0]));
+			 Tt = VADD(Tr, Ts);
+			 Tu = VADD(Tm, Tp);
+			 STA(&(R0[WS(rs, 5)]), VSUB(Tt, Tu), ovs, &(R0[0]));
+			 STA(&(R0[WS(rs, 2)]), VADD(Tt, Tu), ovs, &(R0[0]));
+		    }
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 12, XSIMD_STRING("r2cbv_12"), {34, 6, 4, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_12) (planner *p) {
+     X(kr2c_register) (p, r2cbv_12, &desc);
+}
+
+#endif
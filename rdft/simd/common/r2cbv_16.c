@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:07:29 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_16 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -fma -compact -variables 4 -pipeline-latency 4 -sign 1 -n 16 -name r2cb_16 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 58 FP additions, 32 FP multiplications,
+ * (or, 26 additions, 0 multiplications, 32 fused multiply/add),
+ * 31 stack variables, 4 constants, and 32 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_16(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP414213562, +0.414213562373095048801688724209698078569671875);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(64, rs), MAKE_VOLATILE_STRIDE(64, csr), MAKE_VOLATILE_STRIDE(64, csi)) {
+	       V T5, TL, Tj, TD, T8, TM, To, TE, Tc, TP, Tf, TQ, Tu, Tz, TR;
+	       V TO, TH, TG;
+	       {
+		    V T4, Ti, T3, Th, T1, T2;
+		    T4 = LDA(&(Cr[WS(csr, 4)]), ivs, &(Cr[0]));
+		    Ti = LDA(&(Ci[WS(csi, 4)]), ivs, &(Ci[0]));
+		    T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+		    T2 = LDA(&(Cr[WS(csr, 8)]), ivs, &(Cr[0]));
+		    T3 = VADD(T1, T2);
+		    Th = VSUB(T1, T2);
+		    T5 = VFMA(LDK(KP2_000000000), T4, T3);
+		    TL = VFNMS(LDK(KP2_000000000), T4, T3);
+		    Tj = VFNMS(LDK(KP2_000000000), Ti, Th);
+		    TD = VFMA(LDK(KP2_000000000), Ti, Th);
+	       }
+	       {
+		    V T6, T7, Tk, Tl, Tm, Tn;
+		    T6 = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+		    T7 = LDA(&(Cr[WS(csr, 6)]), ivs, &(Cr[0]));
+		    Tk = VSUB(T6, T7);
+		    Tl = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+		    Tm = LDA(&(Ci[WS(csi, 6)]), ivs, &(Ci[0]));
+		    Tn = VADD(Tl, Tm);
+		    T8 = VADD(T6, T7);
+		    TM = VSUB(Tl, Tm);
+		    To = VSUB(Tk, Tn);
+		    TE = VADD(Tk, Tn);
+	       }
+	       {
+		    V Tq, Ty, Tv, Tt;
+		    {
+			 V Ta, Tb, Tw, Tx;
+			 Ta = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+			 Tb = LDA(&(Cr[WS(csr, 7)]), ivs, &(Cr[0]));
+			 Tc = VADD(Ta, Tb);
+			 Tq = VSUB(Ta, Tb);
+			 Tw = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+			 Tx = LDA(&(Ci[WS(csi, 7)]), ivs, &(Ci[0]));
+			 Ty = VADD(Tw, Tx);
+			 TP = VSUB(Tw, Tx);
+		    }
+		    {
+			 V Td, Te, Tr, Ts;
+			 Td = LDA(&(Cr[WS(csr, 5)]), ivs, &(Cr[0]));
+			 Te = LDA(&(Cr[WS(csr, 3)]), ivs, &(Cr[0]));
+			 Tf = VADD(Td, Te);
+			 Tv = VSUB(Td, Te);
+			 Tr = LDA(&(Ci[WS(csi, 5)]), ivs, &(Ci[0]));
+			 Ts = LDA(&(Ci[WS(csi, 3)]), ivs, &(Ci[0]));
+			 Tt = VADD(Tr, Ts);
+			 TQ = VSUB(Tr, Ts);
+		    }
+		    Tu = VSUB(Tq, Tt);
+		    Tz = VADD(Tv, Ty);
+		    TR = VSUB(TP, TQ);
+		    TO = VSUB(Tc, Tf);
+		    TH = VADD(Tq, Tt);
+		    TG = VSUB(Ty, Tv);
+	       }
+	       {
+		    V T9, Tg, TT, TU;
+		    T9 = VFMA(LDK(KP2_000000000), T8, T5);
+		    Tg = VADD(Tc, Tf);
+		    STA(&(R0[WS(rs, 4)]), VFNMS(LDK(KP2_000000000), Tg, T9), ovs, &(R0[0]));
+		    STA(&(R0[0]), VFMA(LDK(KP2_000000000), Tg, T9), ovs, &(R0[0]));
+		    TT = VFMA(LDK(KP2_000000000), TM, TL);
+		    TU = VADD(TO, TR);
+		    STA(&(R0[WS(rs, 3)]), VFNMS(LDK(KP1_414213562), TU, TT), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 7)]), VFMA(LDK(KP1_414213562), TU, TT), ovs, &(R0[0]));
+	       }
+	       {
+		    V TV, TW, Tp, TA;
+		    TV = VFNMS(LDK(KP2_000000000), T8, T5);
+		    TW = VADD(TQ, TP);
+		    STA(&(R0[WS(rs, 2)]), VFNMS(LDK(KP2_000000000), TW, TV), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 6)]), VFMA(LDK(KP2_000000000), TW, TV), ovs, &(R0[0]));
+		    Tp = VFMA(LDK(KP1_414213562), To, Tj);
+		    TA = VFNMS(LDK(KP414213562), Tz, Tu);
+		    STA(&(R1[WS(rs, 4)]), VFNMS(LDK(KP1_847759065), TA, Tp), ovs, &(R1[0]));
+		    STA(&(R1[0]), VFMA(LDK(KP1_847759065), TA, Tp), ovs, &(R1[0]));
+	       }
+	       {
+		    V TB, TC, TJ, TK;
+		    TB = VFNMS(LDK(KP1_414213562), To, Tj);
+		    TC = VFMA(LDK(KP414213562), Tu, Tz);
+		    STA(&(R1[WS(rs, 2)]), VFNMS(LDK(KP1_847759065), TC, TB), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 6)]), VFMA(LDK(KP1_847759065), TC, TB), ovs, &(R1[0]));
+		    TJ = VFMA(LDK(KP1_414213562), TE, TD);
+		    TK = VFMA(LDK(KP414213562), TG, TH);
+		    STA(&(R1[WS(rs, 3)]), VFNMS(LDK(KP1_847759065), TK, TJ), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 7)]), VFMA(LDK(KP1_847759065), TK, TJ), ovs, &(R1[0]));
+	       }
+	       {
+		    V TN, TS, TF, TI;
+		    TN = VFNMS(LDK(KP2_000000000), TM, TL);
+		    TS = VSUB(TO, TR);
+		    STA(&(R0[WS(rs, 5)]), VFNMS(LDK(KP1_414213562), TS, TN), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 1)]), VFMA(LDK(KP1_414213562), TS, TN), ovs, &(R0[0]));
+		    TF = VFNMS(LDK(KP1_414213562), TE, TD);
+		    TI = VFNMS(LDK(KP414213562), TH, TG);
+		    STA(&(R1[WS(rs, 1)]), VFNMS(LDK(KP1_847759065), TI, TF), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 5)]), VFMA(LDK(KP1_847759065), TI, TF), ovs, &(R1[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 16, XSIMD_STRING("r2cbv_16"), {26, 0, 32, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_16) (planner *p) {
+     X(kr2c_register) (p, r2cbv_16, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_16 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -compact -variables 4 -pipeline-latency 4 -sign 1 -n 16 -name r2cb_16 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 58 FP additions, 18 FP multiplications,
+ * (or, 54 additions, 14 multiplications, 4 fused multiply/add),
+ * 31 stack variables, 4 constants, and 32 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_16(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(64, rs), MAKE_VOLATILE_STRIDE(64, csr), MAKE_VOLATILE_STRIDE(64, csi)) {
+	       V T9, TS, Tl, TG, T6, TR, Ti, TD, Td, Tq, Tg, Tt, Tn, Tu, TV;
+	       V TU, TN, TK;
+	       {
+		    V T7, T8, TE, Tj, Tk, TF;
+		    T7 = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+		    T8 = LDA(&(Cr[WS(csr, 6)]), ivs, &(Cr[0]));
+		    TE = VSUB(T7, T8);
+		    Tj = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+		    Tk = LDA(&(Ci[WS(csi, 6)]), ivs, &(Ci[0]));
+		    TF = VADD(Tj, Tk);
+		    T9 = VMUL(LDK(KP2_000000000), VADD(T7, T8));
+		    TS = VMUL(LDK(KP1_414213562), VADD(TE, TF));
+		    Tl = VMUL(LDK(KP2_000000000), VSUB(Tj, Tk));
+		    TG = VMUL(LDK(KP1_414213562), VSUB(TE, TF));
+	       }
+	       {
+		    V T5, TC, T3, TA;
+		    {
+			 V T4, TB, T1, T2;
+			 T4 = LDA(&(Cr[WS(csr, 4)]), ivs, &(Cr[0]));
+			 T5 = VMUL(LDK(KP2_000000000), T4);
+			 TB = LDA(&(Ci[WS(csi, 4)]), ivs, &(Ci[0]));
+			 TC = VMUL(LDK(KP2_000000000), TB);
+			 T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+			 T2 = LDA(&(Cr[WS(csr, 8)]), ivs, &(Cr[0]));
+			 T3 = VADD(T1, T2);
+			 TA = VSUB(T1, T2);
+		    }
+		    T6 = VADD(T3, T5);
+		    TR = VADD(TA, TC);
+		    Ti = VSUB(T3, T5);
+		    TD = VSUB(TA, TC);
+	       }
+	       {
+		    V TI, TM, TL, TJ;
+		    {
+			 V Tb, Tc, To, Tp;
+			 Tb = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+			 Tc = LDA(&(Cr[WS(csr, 7)]), ivs, &(Cr[0]));
+			 Td = VADD(Tb, Tc);
+			 TI = VSUB(Tb, Tc);
+			 To = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+			 Tp = LDA(&(Ci[WS(csi, 7)]), ivs, &(Ci[0]));
+			 Tq = VSUB(To, Tp);
+			 TM = VADD(To, Tp);
+		    }
+		    {
+			 V Te, Tf, Tr, Ts;
+			 Te = LDA(&(Cr[WS(csr, 5)]), ivs, &(Cr[0]));
+			 Tf = LDA(&(Cr[WS(csr, 3)]), ivs, &(Cr[0]));
+			 Tg = VADD(Te, Tf);
+			 TL = VSUB(Te, Tf);
+			 Tr = LDA(&(Ci[WS(csi, 5)]), ivs, &(Ci[0]));
+			 Ts = LDA(&(Ci[WS(csi, 3)]), ivs, &(Ci[0]));
+			 Tt = VSUB(Tr, Ts);
+			 TJ = VADD(Tr, Ts);
+		    }
+		    Tn = VSUB(Td, Tg);
+		    Tu = VSUB(Tq, Tt);
+		    TV = VSUB(TM, TL);
+		    TU = VADD(TI, TJ);
+		    TN = VADD(TL, TM);
+		    TK = VSUB(TI, TJ);
+	       }
+	       {
+		    V Ta, Th, TT, TW;
+		    Ta = VADD(T6, T9);
+		    Th = VMUL(LDK(KP2_000000000), VADD(Td, Tg));
+		    STA(&(R0[WS(rs, 4)]), VSUB(Ta, Th), ovs, &(R0[0]));
+		    STA(&(R0[0]), VADD(Ta, Th), ovs, &(R0[0]));
+		    TT = VSUB(TR, TS);
+		    TW = VFNMS(LDK(KP1_847759065), TV, VMUL(LDK(KP765366864), TU));
+		    STA(&(R1[WS(rs, 5)]), VSUB(TT, TW), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 1)]), VADD(TT, TW), ovs, &(R1[0]));
+	       }
+	       {
+		    V TX, TY, Tm, Tv;
+		    TX = VADD(TR, TS);
+		    TY = VFMA(LDK(KP1_847759065), TU, VMUL(LDK(KP765366864), TV));
+		    STA(&(R1[WS(rs, 3)]), VSUB(TX, TY), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 7)]), VADD(TX, TY), ovs, &(R1[0]));
+		    Tm = VSUB(Ti, Tl);
+		    Tv = VMUL(LDK(KP1_414213562), VSUB(Tn, Tu));
+		    STA(&(R0[WS(rs, 5)]), VSUB(Tm, Tv), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 1)]), VADD(Tm, Tv), ovs, &(R0[0]));
+	       }
+	       {
+		    V Tw, Tx, TH, TO;
+		    Tw = VADD(Ti, Tl);
+		    Tx = VMUL(LDK(KP1_414213562), VADD(Tn, Tu));
+		    STA(&(R0[WS(rs, 3)]), VSUB(Tw, Tx), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 7)]), VADD(Tw, Tx), ovs, &(R0[0]));
+		    TH = VADD(TD, TG);
+		    TO = VFNMS(LDK(KP765366864), TN, VMUL(LDK(KP1_847759065), TK));
+		    STA(&(R1[WS(rs, 4)]), VSUB(TH, TO), ovs, &(R1[0]));
+		    STA(&(R1[0]), VADD(TH, TO), ovs, &(R1[0]));
+	       }
+	       {
+		    V TP, TQ, Ty, Tz;
+		    TP = VSUB(TD, TG);
+		    TQ = VFMA(LDK(KP765366864), TK, VMUL(LDK(KP1_847759065), TN));
+		    STA(&(R1[WS(rs, 2)]), VSUB(TP, TQ), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 6)]), VADD(TP, TQ), ovs, &(R1[0]));
+		    Ty = VSUB(T6, T9);
+		    Tz = VMUL(LDK(KP2_000000000), VADD(Tt, Tq));
+		    STA(&(R0[WS(rs, 2)]), VSUB(Ty, Tz), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 6)]), VADD(Ty, Tz), ovs, &(R0[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 16, XSIMD_STRING("r2cbv_16"), {54, 14, 4, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_16) (planner *p) {
+     X(kr2c_register) (p, r2cbv_16, &desc);
+}
+
+#endif
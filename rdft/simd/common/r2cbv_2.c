@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:07:28 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_2 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -fma -compact -variables 4 -pipeline-latency 4 -sign 1 -n 2 -name r2cb_2 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 2 FP additions, 0 FP multiplications,
+ * (or, 2 additions, 0 multiplications, 0 fused multiply/add),
+ * 3 stack variables, 0 constants, and 4 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_2(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(8, rs), MAKE_VOLATILE_STRIDE(8, csr), MAKE_VOLATILE_STRIDE(8, csi)) {
+	       V T1, T2;
+	       T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+	       T2 = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+	       STA(&(R1[0]), VSUB(T1, T2), ovs, &(R1[0]));
+	       STA(&(R0[0]), VADD(T1, T2), ovs, &(R0[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 2, XSIMD_STRING("r2cbv_2"), {2, 0, 0, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_2) (planner *p) {
+     X(kr2c_register) (p, r2cbv_2, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_2 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -compact -variables 4 -pipeline-latency 4 -sign 1 -n 2 -name r2cb_2 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 2 FP additions, 0 FP multiplications,
+ * (or, 2 additions, 0 multiplications, 0 fused multiply/add),
+ * 3 stack variables, 0 constants, and 4 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_2(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(8, rs), MAKE_VOLATILE_STRIDE(8, csr), MAKE_VOLATILE_STRIDE(8, csi)) {
+	       V T1, T2;
+	       T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+	       T2 = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+	       STA(&(R1[0]), VSUB(T1, T2), ovs, &(R1[0]));
+	       STA(&(R0[0]), VADD(T1, T2), ovs, &(R0[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 2, XSIMD_STRING("r2cbv_2"), {2, 0, 0, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_2) (planner *p) {
+     X(kr2c_register) (p, r2cbv_2, &desc);
+}
+
+#endif
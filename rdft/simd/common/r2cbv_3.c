@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:07:28 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_3 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -fma -compact -variables 4 -pipeline-latency 4 -sign 1 -n 3 -name r2cb_3 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 4 FP additions, 3 FP multiplications,
+ * (or, 1 additions, 0 multiplications, 3 fused multiply/add),
+ * 7 stack variables, 2 constants, and 6 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_3(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(12, rs), MAKE_VOLATILE_STRIDE(12, csr), MAKE_VOLATILE_STRIDE(12, csi)) {
+	       V T4, T1, T2, T3;
+	       T4 = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+	       T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+	       T2 = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+	       T3 = VSUB(T1, T2);
+	       STA(&(R0[0]), VFMA(LDK(KP2_000000000), T2, T1), ovs, &(R0[0]));
+	       STA(&(R0[WS(rs, 1)]), VFMA(LDK(KP1_732050807), T4, T3), ovs, &(R0[0]));
+	       STA(&(R1[0]), VFNMS(LDK(KP1_732050807), T4, T3), ovs, &(R1[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 3, XSIMD_STRING("r2cbv_3"), {1, 0, 3, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_3) (planner *p) {
+     X(kr2c_register) (p, r2cbv_3, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_3 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -compact -variables 4 -pipeline-latency 4 -sign 1 -n 3 -name r2cb_3 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 4 FP additions, 2 FP multiplications,
+ * (or, 3 additions, 1 multiplications, 1 fused multiply/add),
+ * 8 stack variables, 2 constants, and 6 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_3(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DVK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(12, rs), MAKE_VOLATILE_STRIDE(12, csr), MAKE_VOLATILE_STRIDE(12, csi)) {
+	       V T5, T1, T2, T3, T4;
+	       T4 = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+	       T5 = VMUL(LDK(KP1_732050807), T4);
+	       T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+	       T2 = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+	       T3 = VSUB(T1, T2);
+	       STA(&(R0[0]), VFMA(LDK(KP2_000000000), T2, T1), ovs, &(R0[0]));
+	       STA(&(R0[WS(rs, 1)]), VADD(T3, T5), ovs, &(R0[0]));
+	       STA(&(R1[0]), VSUB(T3, T5), ovs, &(R1[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 3, XSIMD_STRING("r2cbv_3"), {3, 1, 1, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_3) (planner *p) {
+     X(kr2c_register) (p, r2cbv_3, &desc);
+}
+
+#endif
@@ -0,0 +1,641 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:07:29 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_32 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -fma -compact -variables 4 -pipeline-latency 4 -sign 1 -n 32 -name r2cb_32 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 156 FP additions, 84 FP multiplications,
+ * (or, 72 additions, 0 multiplications, 84 fused multiply/add),
+ * 54 stack variables, 9 constants, and 64 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_32(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP668178637, +0.668178637919298919997757686523080761552472251);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP198912367, +0.198912367379658006911597622644676228597850501);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP414213562, +0.414213562373095048801688724209698078569671875);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(128, rs), MAKE_VOLATILE_STRIDE(128, csr), MAKE_VOLATILE_STRIDE(128, csi)) {
+	       V T5, T1R, Tz, T1t, T8, T1S, TE, T1u, Tg, T1X, T2m, TK, TP, T1x, T1U;
+	       V T1w, To, T28, T2p, TW, T1d, T1D, T20, T1A, Tv, T23, T2q, T25, T1g, T1B;
+	       V T17, T1E;
+	       {
+		    V T4, Ty, T3, Tx, T1, T2;
+		    T4 = LDA(&(Cr[WS(csr, 8)]), ivs, &(Cr[0]));
+		    Ty = LDA(&(Ci[WS(csi, 8)]), ivs, &(Ci[0]));
+		    T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+		    T2 = LDA(&(Cr[WS(csr, 16)]), ivs, &(Cr[0]));
+		    T3 = VADD(T1, T2);
+		    Tx = VSUB(T1, T2);
+		    T5 = VFMA(LDK(KP2_000000000), T4, T3);
+		    T1R = VFNMS(LDK(KP2_000000000), T4, T3);
+		    Tz = VFNMS(LDK(KP2_000000000), Ty, Tx);
+		    T1t = VFMA(LDK(KP2_000000000), Ty, Tx);
+	       }
+	       {
+		    V T6, T7, TA, TB, TC, TD;
+		    T6 = LDA(&(Cr[WS(csr, 4)]), ivs, &(Cr[0]));
+		    T7 = LDA(&(Cr[WS(csr, 12)]), ivs, &(Cr[0]));
+		    TA = VSUB(T6, T7);
+		    TB = LDA(&(Ci[WS(csi, 4)]), ivs, &(Ci[0]));
+		    TC = LDA(&(Ci[WS(csi, 12)]), ivs, &(Ci[0]));
+		    TD = VADD(TB, TC);
+		    T8 = VADD(T6, T7);
+		    T1S = VSUB(TB, TC);
+		    TE = VSUB(TA, TD);
+		    T1u = VADD(TA, TD);
+	       }
+	       {
+		    V Tc, TG, TO, T1V, Tf, TL, TJ, T1W;
+		    {
+			 V Ta, Tb, TM, TN;
+			 Ta = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+			 Tb = LDA(&(Cr[WS(csr, 14)]), ivs, &(Cr[0]));
+			 Tc = VADD(Ta, Tb);
+			 TG = VSUB(Ta, Tb);
+			 TM = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+			 TN = LDA(&(Ci[WS(csi, 14)]), ivs, &(Ci[0]));
+			 TO = VADD(TM, TN);
+			 T1V = VSUB(TM, TN);
+		    }
+		    {
+			 V Td, Te, TH, TI;
+			 Td = LDA(&(Cr[WS(csr, 10)]), ivs, &(Cr[0]));
+			 Te = LDA(&(Cr[WS(csr, 6)]), ivs, &(Cr[0]));
+			 Tf = VADD(Td, Te);
+			 TL = VSUB(Td, Te);
+			 TH = LDA(&(Ci[WS(csi, 10)]), ivs, &(Ci[0]));
+			 TI = LDA(&(Ci[WS(csi, 6)]), ivs, &(Ci[0]));
+			 TJ = VADD(TH, TI);
+			 T1W = VSUB(TH, TI);
+		    }
+		    Tg = VADD(Tc, Tf);
+		    T1X = VSUB(T1V, T1W);
+		    T2m = VADD(T1W, T1V);
+		    TK = VSUB(TG, TJ);
+		    TP = VADD(TL, TO);
+		    T1x = VADD(TG, TJ);
+		    T1U = VSUB(Tc, Tf);
+		    T1w = VSUB(TO, TL);
+	       }
+	       {
+		    V Tk, TS, T1c, T26, Tn, T19, TV, T27;
+		    {
+			 V Ti, Tj, T1a, T1b;
+			 Ti = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+			 Tj = LDA(&(Cr[WS(csr, 15)]), ivs, &(Cr[0]));
+			 Tk = VADD(Ti, Tj);
+			 TS = VSUB(Ti, Tj);
+			 T1a = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+			 T1b = LDA(&(Ci[WS(csi, 15)]), ivs, &(Ci[0]));
+			 T1c = VADD(T1a, T1b);
+			 T26 = VSUB(T1a, T1b);
+		    }
+		    {
+			 V Tl, Tm, TT, TU;
+			 Tl = LDA(&(Cr[WS(csr, 9)]), ivs, &(Cr[0]));
+			 Tm = LDA(&(Cr[WS(csr, 7)]), ivs, &(Cr[0]));
+			 Tn = VADD(Tl, Tm);
+			 T19 = VSUB(Tl, Tm);
+			 TT = LDA(&(Ci[WS(csi, 9)]), ivs, &(Ci[0]));
+			 TU = LDA(&(Ci[WS(csi, 7)]), ivs, &(Ci[0]));
+			 TV = VADD(TT, TU);
+			 T27 = VSUB(TT, TU);
+		    }
+		    To = VADD(Tk, Tn);
+		    T28 = VSUB(T26, T27);
+		    T2p = VADD(T27, T26);
+		    TW = VSUB(TS, TV);
+		    T1d = VADD(T19, T1c);
+		    T1D = VSUB(T1c, T19);
+		    T20 = VSUB(Tk, Tn);
+		    T1A = VADD(TS, TV);
+	       }
+	       {
+		    V Tr, TX, T10, T22, Tu, T12, T15, T21;
+		    {
+			 V Tp, Tq, TY, TZ;
+			 Tp = LDA(&(Cr[WS(csr, 5)]), ivs, &(Cr[0]));
+			 Tq = LDA(&(Cr[WS(csr, 11)]), ivs, &(Cr[0]));
+			 Tr = VADD(Tp, Tq);
+			 TX = VSUB(Tp, Tq);
+			 TY = LDA(&(Ci[WS(csi, 5)]), ivs, &(Ci[0]));
+			 TZ = LDA(&(Ci[WS(csi, 11)]), ivs, &(Ci[0]));
+			 T10 = VADD(TY, TZ);
+			 T22 = VSUB(TY, TZ);
+		    }
+		    {
+			 V Ts, Tt, T13, T14;
+			 Ts = LDA(&(Cr[WS(csr, 3)]), ivs, &(Cr[0]));
+			 Tt = LDA(&(Cr[WS(csr, 13)]), ivs, &(Cr[0]));
+			 Tu = VADD(Ts, Tt);
+			 T12 = VSUB(Ts, Tt);
+			 T13 = LDA(&(Ci[WS(csi, 3)]), ivs, &(Ci[0]));
+			 T14 = LDA(&(Ci[WS(csi, 13)]), ivs, &(Ci[0]));
+			 T15 = VADD(T13, T14);
+			 T21 = VSUB(T14, T13);
+		    }
+		    Tv = VADD(Tr, Tu);
+		    T23 = VSUB(T21, T22);
+		    T2q = VADD(T22, T21);
+		    T25 = VSUB(Tr, Tu);
+		    {
+			 V T1e, T1f, T11, T16;
+			 T1e = VADD(TX, T10);
+			 T1f = VADD(T12, T15);
+			 T1g = VSUB(T1e, T1f);
+			 T1B = VADD(T1e, T1f);
+			 T11 = VSUB(TX, T10);
+			 T16 = VSUB(T12, T15);
+			 T17 = VADD(T11, T16);
+			 T1E = VSUB(T16, T11);
+		    }
+	       }
+	       {
+		    V Tw, T2w, Th, T2v, T9;
+		    Tw = VADD(To, Tv);
+		    T2w = VADD(T2q, T2p);
+		    T9 = VFMA(LDK(KP2_000000000), T8, T5);
+		    Th = VFMA(LDK(KP2_000000000), Tg, T9);
+		    T2v = VFNMS(LDK(KP2_000000000), Tg, T9);
+		    STA(&(R0[WS(rs, 8)]), VFNMS(LDK(KP2_000000000), Tw, Th), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 12)]), VFMA(LDK(KP2_000000000), T2w, T2v), ovs, &(R0[0]));
+		    STA(&(R0[0]), VFMA(LDK(KP2_000000000), Tw, Th), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 4)]), VFNMS(LDK(KP2_000000000), T2w, T2v), ovs, &(R0[0]));
+	       }
+	       {
+		    V T2n, T2t, T2s, T2u, T2l, T2o, T2r;
+		    T2l = VFNMS(LDK(KP2_000000000), T8, T5);
+		    T2n = VFNMS(LDK(KP2_000000000), T2m, T2l);
+		    T2t = VFMA(LDK(KP2_000000000), T2m, T2l);
+		    T2o = VSUB(To, Tv);
+		    T2r = VSUB(T2p, T2q);
+		    T2s = VSUB(T2o, T2r);
+		    T2u = VADD(T2o, T2r);
+		    STA(&(R0[WS(rs, 10)]), VFNMS(LDK(KP1_414213562), T2s, T2n), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 14)]), VFMA(LDK(KP1_414213562), T2u, T2t), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 2)]), VFMA(LDK(KP1_414213562), T2s, T2n), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 6)]), VFNMS(LDK(KP1_414213562), T2u, T2t), ovs, &(R0[0]));
+	       }
+	       {
+		    V TR, T1j, T1i, T1k;
+		    {
+			 V TF, TQ, T18, T1h;
+			 TF = VFMA(LDK(KP1_414213562), TE, Tz);
+			 TQ = VFNMS(LDK(KP414213562), TP, TK);
+			 TR = VFMA(LDK(KP1_847759065), TQ, TF);
+			 T1j = VFNMS(LDK(KP1_847759065), TQ, TF);
+			 T18 = VFMA(LDK(KP707106781), T17, TW);
+			 T1h = VFMA(LDK(KP707106781), T1g, T1d);
+			 T1i = VFNMS(LDK(KP198912367), T1h, T18);
+			 T1k = VFMA(LDK(KP198912367), T18, T1h);
+		    }
+		    STA(&(R1[WS(rs, 8)]), VFNMS(LDK(KP1_961570560), T1i, TR), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 12)]), VFMA(LDK(KP1_961570560), T1k, T1j), ovs, &(R1[0]));
+		    STA(&(R1[0]), VFMA(LDK(KP1_961570560), T1i, TR), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 4)]), VFNMS(LDK(KP1_961570560), T1k, T1j), ovs, &(R1[0]));
+	       }
+	       {
+		    V T2f, T2j, T2i, T2k;
+		    {
+			 V T2d, T2e, T2g, T2h;
+			 T2d = VFMA(LDK(KP2_000000000), T1S, T1R);
+			 T2e = VADD(T1U, T1X);
+			 T2f = VFNMS(LDK(KP1_414213562), T2e, T2d);
+			 T2j = VFMA(LDK(KP1_414213562), T2e, T2d);
+			 T2g = VSUB(T28, T25);
+			 T2h = VSUB(T20, T23);
+			 T2i = VFNMS(LDK(KP414213562), T2h, T2g);
+			 T2k = VFMA(LDK(KP414213562), T2g, T2h);
+		    }
+		    STA(&(R0[WS(rs, 3)]), VFNMS(LDK(KP1_847759065), T2i, T2f), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 15)]), VFMA(LDK(KP1_847759065), T2k, T2j), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 11)]), VFMA(LDK(KP1_847759065), T2i, T2f), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 7)]), VFNMS(LDK(KP1_847759065), T2k, T2j), ovs, &(R0[0]));
+	       }
+	       {
+		    V T1n, T1r, T1q, T1s;
+		    {
+			 V T1l, T1m, T1o, T1p;
+			 T1l = VFNMS(LDK(KP1_414213562), TE, Tz);
+			 T1m = VFMA(LDK(KP414213562), TK, TP);
+			 T1n = VFNMS(LDK(KP1_847759065), T1m, T1l);
+			 T1r = VFMA(LDK(KP1_847759065), T1m, T1l);
+			 T1o = VFNMS(LDK(KP707106781), T1g, T1d);
+			 T1p = VFNMS(LDK(KP707106781), T17, TW);
+			 T1q = VFNMS(LDK(KP668178637), T1p, T1o);
+			 T1s = VFMA(LDK(KP668178637), T1o, T1p);
+		    }
+		    STA(&(R1[WS(rs, 2)]), VFNMS(LDK(KP1_662939224), T1q, T1n), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 14)]), VFMA(LDK(KP1_662939224), T1s, T1r), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 10)]), VFMA(LDK(KP1_662939224), T1q, T1n), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 6)]), VFNMS(LDK(KP1_662939224), T1s, T1r), ovs, &(R1[0]));
+	       }
+	       {
+		    V T1L, T1P, T1O, T1Q;
+		    {
+			 V T1J, T1K, T1M, T1N;
+			 T1J = VFMA(LDK(KP1_414213562), T1u, T1t);
+			 T1K = VFMA(LDK(KP414213562), T1w, T1x);
+			 T1L = VFNMS(LDK(KP1_847759065), T1K, T1J);
+			 T1P = VFMA(LDK(KP1_847759065), T1K, T1J);
+			 T1M = VFMA(LDK(KP707106781), T1E, T1D);
+			 T1N = VFMA(LDK(KP707106781), T1B, T1A);
+			 T1O = VFNMS(LDK(KP198912367), T1N, T1M);
+			 T1Q = VFMA(LDK(KP198912367), T1M, T1N);
+		    }
+		    STA(&(R1[WS(rs, 3)]), VFNMS(LDK(KP1_961570560), T1O, T1L), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 15)]), VFMA(LDK(KP1_961570560), T1Q, T1P), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 11)]), VFMA(LDK(KP1_961570560), T1O, T1L), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 7)]), VFNMS(LDK(KP1_961570560), T1Q, T1P), ovs, &(R1[0]));
+	       }
+	       {
+		    V T1Z, T2b, T2a, T2c;
+		    {
+			 V T1T, T1Y, T24, T29;
+			 T1T = VFNMS(LDK(KP2_000000000), T1S, T1R);
+			 T1Y = VSUB(T1U, T1X);
+			 T1Z = VFMA(LDK(KP1_414213562), T1Y, T1T);
+			 T2b = VFNMS(LDK(KP1_414213562), T1Y, T1T);
+			 T24 = VADD(T20, T23);
+			 T29 = VADD(T25, T28);
+			 T2a = VFNMS(LDK(KP414213562), T29, T24);
+			 T2c = VFMA(LDK(KP414213562), T24, T29);
+		    }
+		    STA(&(R0[WS(rs, 9)]), VFNMS(LDK(KP1_847759065), T2a, T1Z), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 13)]), VFMA(LDK(KP1_847759065), T2c, T2b), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 1)]), VFMA(LDK(KP1_847759065), T2a, T1Z), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 5)]), VFNMS(LDK(KP1_847759065), T2c, T2b), ovs, &(R0[0]));
+	       }
+	       {
+		    V T1z, T1H, T1G, T1I;
+		    {
+			 V T1v, T1y, T1C, T1F;
+			 T1v = VFNMS(LDK(KP1_414213562), T1u, T1t);
+			 T1y = VFNMS(LDK(KP414213562), T1x, T1w);
+			 T1z = VFNMS(LDK(KP1_847759065), T1y, T1v);
+			 T1H = VFMA(LDK(KP1_847759065), T1y, T1v);
+			 T1C = VFNMS(LDK(KP707106781), T1B, T1A);
+			 T1F = VFNMS(LDK(KP707106781), T1E, T1D);
+			 T1G = VFNMS(LDK(KP668178637), T1F, T1C);
+			 T1I = VFMA(LDK(KP668178637), T1C, T1F);
+		    }
+		    STA(&(R1[WS(rs, 9)]), VFNMS(LDK(KP1_662939224), T1G, T1z), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 13)]), VFMA(LDK(KP1_662939224), T1I, T1H), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 1)]), VFMA(LDK(KP1_662939224), T1G, T1z), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 5)]), VFNMS(LDK(KP1_662939224), T1I, T1H), ovs, &(R1[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 32, XSIMD_STRING("r2cbv_32"), {72, 0, 84, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_32) (planner *p) {
+     X(kr2c_register) (p, r2cbv_32, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_32 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -compact -variables 4 -pipeline-latency 4 -sign 1 -n 32 -name r2cb_32 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 156 FP additions, 50 FP multiplications,
+ * (or, 140 additions, 34 multiplications, 16 fused multiply/add),
+ * 54 stack variables, 9 constants, and 64 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_32(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_662939224, +1.662939224605090474157576755235811513477121624);
+     DVK(KP1_111140466, +1.111140466039204449485661627897065748749874382);
+     DVK(KP1_961570560, +1.961570560806460898252364472268478073947867462);
+     DVK(KP390180644, +0.390180644032256535696569736954044481855383236);
+     DVK(KP765366864, +0.765366864730179543456919968060797733522689125);
+     DVK(KP1_847759065, +1.847759065022573512256366378793576573644833252);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(128, rs), MAKE_VOLATILE_STRIDE(128, csr), MAKE_VOLATILE_STRIDE(128, csi)) {
+	       V T9, T2c, TB, T1y, T6, T2b, Ty, T1v, Th, T2e, T2f, TD, TK, T1C, T1F;
+	       V T1h, Tp, T2i, T2m, TN, T13, T1K, T1Y, T1k, Tw, TU, T1l, TW, T1V, T2j;
+	       V T1R, T2l;
+	       {
+		    V T7, T8, T1w, Tz, TA, T1x;
+		    T7 = LDA(&(Cr[WS(csr, 4)]), ivs, &(Cr[0]));
+		    T8 = LDA(&(Cr[WS(csr, 12)]), ivs, &(Cr[0]));
+		    T1w = VSUB(T7, T8);
+		    Tz = LDA(&(Ci[WS(csi, 4)]), ivs, &(Ci[0]));
+		    TA = LDA(&(Ci[WS(csi, 12)]), ivs, &(Ci[0]));
+		    T1x = VADD(Tz, TA);
+		    T9 = VMUL(LDK(KP2_000000000), VADD(T7, T8));
+		    T2c = VMUL(LDK(KP1_414213562), VADD(T1w, T1x));
+		    TB = VMUL(LDK(KP2_000000000), VSUB(Tz, TA));
+		    T1y = VMUL(LDK(KP1_414213562), VSUB(T1w, T1x));
+	       }
+	       {
+		    V T5, T1u, T3, T1s;
+		    {
+			 V T4, T1t, T1, T2;
+			 T4 = LDA(&(Cr[WS(csr, 8)]), ivs, &(Cr[0]));
+			 T5 = VMUL(LDK(KP2_000000000), T4);
+			 T1t = LDA(&(Ci[WS(csi, 8)]), ivs, &(Ci[0]));
+			 T1u = VMUL(LDK(KP2_000000000), T1t);
+			 T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+			 T2 = LDA(&(Cr[WS(csr, 16)]), ivs, &(Cr[0]));
+			 T3 = VADD(T1, T2);
+			 T1s = VSUB(T1, T2);
+		    }
+		    T6 = VADD(T3, T5);
+		    T2b = VADD(T1s, T1u);
+		    Ty = VSUB(T3, T5);
+		    T1v = VSUB(T1s, T1u);
+	       }
+	       {
+		    V Td, T1A, TG, T1E, Tg, T1D, TJ, T1B;
+		    {
+			 V Tb, Tc, TE, TF;
+			 Tb = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+			 Tc = LDA(&(Cr[WS(csr, 14)]), ivs, &(Cr[0]));
+			 Td = VADD(Tb, Tc);
+			 T1A = VSUB(Tb, Tc);
+			 TE = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+			 TF = LDA(&(Ci[WS(csi, 14)]), ivs, &(Ci[0]));
+			 TG = VSUB(TE, TF);
+			 T1E = VADD(TE, TF);
+		    }
+		    {
+			 V Te, Tf, TH, TI;
+			 Te = LDA(&(Cr[WS(csr, 10)]), ivs, &(Cr[0]));
+			 Tf = LDA(&(Cr[WS(csr, 6)]), ivs, &(Cr[0]));
+			 Tg = VADD(Te, Tf);
+			 T1D = VSUB(Te, Tf);
+			 TH = LDA(&(Ci[WS(csi, 10)]), ivs, &(Ci[0]));
+			 TI = LDA(&(Ci[WS(csi, 6)]), ivs, &(Ci[0]));
+			 TJ = VSUB(TH, TI);
+			 T1B = VADD(TH, TI);
+		    }
+		    Th = VMUL(LDK(KP2_000000000), VADD(Td, Tg));
+		    T2e = VADD(T1A, T1B);
+		    T2f = VSUB(T1E, T1D);
+		    TD = VSUB(Td, Tg);
+		    TK = VSUB(TG, TJ);
+		    T1C = VSUB(T1A, T1B);
+		    T1F = VADD(T1D, T1E);
+		    T1h = VMUL(LDK(KP2_000000000), VADD(TJ, TG));
+	       }
+	       {
+		    V Tl, T1I, TZ, T1X, To, T1W, T12, T1J;
+		    {
+			 V Tj, Tk, TX, TY;
+			 Tj = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+			 Tk = LDA(&(Cr[WS(csr, 15)]), ivs, &(Cr[0]));
+			 Tl = VADD(Tj, Tk);
+			 T1I = VSUB(Tj, Tk);
+			 TX = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+			 TY = LDA(&(Ci[WS(csi, 15)]), ivs, &(Ci[0]));
+			 TZ = VSUB(TX, TY);
+			 T1X = VADD(TX, TY);
+		    }
+		    {
+			 V Tm, Tn, T10, T11;
+			 Tm = LDA(&(Cr[WS(csr, 9)]), ivs, &(Cr[0]));
+			 Tn = LDA(&(Cr[WS(csr, 7)]), ivs, &(Cr[0]));
+			 To = VADD(Tm, Tn);
+			 T1W = VSUB(Tm, Tn);
+			 T10 = LDA(&(Ci[WS(csi, 9)]), ivs, &(Ci[0]));
+			 T11 = LDA(&(Ci[WS(csi, 7)]), ivs, &(Ci[0]));
+			 T12 = VSUB(T10, T11);
+			 T1J = VADD(T10, T11);
+		    }
+		    Tp = VADD(Tl, To);
+		    T2i = VADD(T1I, T1J);
+		    T2m = VSUB(T1X, T1W);
+		    TN = VSUB(Tl, To);
+		    T13 = VSUB(TZ, T12);
+		    T1K = VSUB(T1I, T1J);
+		    T1Y = VADD(T1W, T1X);
+		    T1k = VADD(T12, TZ);
+	       }
+	       {
+		    V Ts, T1L, TT, T1M, Tv, T1O, TQ, T1P;
+		    {
+			 V Tq, Tr, TR, TS;
+			 Tq = LDA(&(Cr[WS(csr, 5)]), ivs, &(Cr[0]));
+			 Tr = LDA(&(Cr[WS(csr, 11)]), ivs, &(Cr[0]));
+			 Ts = VADD(Tq, Tr);
+			 T1L = VSUB(Tq, Tr);
+			 TR = LDA(&(Ci[WS(csi, 5)]), ivs, &(Ci[0]));
+			 TS = LDA(&(Ci[WS(csi, 11)]), ivs, &(Ci[0]));
+			 TT = VSUB(TR, TS);
+			 T1M = VADD(TR, TS);
+		    }
+		    {
+			 V Tt, Tu, TO, TP;
+			 Tt = LDA(&(Cr[WS(csr, 3)]), ivs, &(Cr[0]));
+			 Tu = LDA(&(Cr[WS(csr, 13)]), ivs, &(Cr[0]));
+			 Tv = VADD(Tt, Tu);
+			 T1O = VSUB(Tt, Tu);
+			 TO = LDA(&(Ci[WS(csi, 13)]), ivs, &(Ci[0]));
+			 TP = LDA(&(Ci[WS(csi, 3)]), ivs, &(Ci[0]));
+			 TQ = VSUB(TO, TP);
+			 T1P = VADD(TP, TO);
+		    }
+		    Tw = VADD(Ts, Tv);
+		    TU = VSUB(TQ, TT);
+		    T1l = VADD(TT, TQ);
+		    TW = VSUB(Ts, Tv);
+		    {
+			 V T1T, T1U, T1N, T1Q;
+			 T1T = VADD(T1L, T1M);
+			 T1U = VADD(T1O, T1P);
+			 T1V = VMUL(LDK(KP707106781), VSUB(T1T, T1U));
+			 T2j = VMUL(LDK(KP707106781), VADD(T1T, T1U));
+			 T1N = VSUB(T1L, T1M);
+			 T1Q = VSUB(T1O, T1P);
+			 T1R = VMUL(LDK(KP707106781), VADD(T1N, T1Q));
+			 T2l = VMUL(LDK(KP707106781), VSUB(T1N, T1Q));
+		    }
+	       }
+	       {
+		    V Tx, T1r, Ti, T1q, Ta;
+		    Tx = VMUL(LDK(KP2_000000000), VADD(Tp, Tw));
+		    T1r = VMUL(LDK(KP2_000000000), VADD(T1l, T1k));
+		    Ta = VADD(T6, T9);
+		    Ti = VADD(Ta, Th);
+		    T1q = VSUB(Ta, Th);
+		    STA(&(R0[WS(rs, 8)]), VSUB(Ti, Tx), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 12)]), VADD(T1q, T1r), ovs, &(R0[0]));
+		    STA(&(R0[0]), VADD(Ti, Tx), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 4)]), VSUB(T1q, T1r), ovs, &(R0[0]));
+	       }
+	       {
+		    V T1i, T1o, T1n, T1p, T1g, T1j, T1m;
+		    T1g = VSUB(T6, T9);
+		    T1i = VSUB(T1g, T1h);
+		    T1o = VADD(T1g, T1h);
+		    T1j = VSUB(Tp, Tw);
+		    T1m = VSUB(T1k, T1l);
+		    T1n = VMUL(LDK(KP1_414213562), VSUB(T1j, T1m));
+		    T1p = VMUL(LDK(KP1_414213562), VADD(T1j, T1m));
+		    STA(&(R0[WS(rs, 10)]), VSUB(T1i, T1n), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 14)]), VADD(T1o, T1p), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 2)]), VADD(T1i, T1n), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 6)]), VSUB(T1o, T1p), ovs, &(R0[0]));
+	       }
+	       {
+		    V TM, T16, T15, T17;
+		    {
+			 V TC, TL, TV, T14;
+			 TC = VSUB(Ty, TB);
+			 TL = VMUL(LDK(KP1_414213562), VSUB(TD, TK));
+			 TM = VADD(TC, TL);
+			 T16 = VSUB(TC, TL);
+			 TV = VADD(TN, TU);
+			 T14 = VADD(TW, T13);
+			 T15 = VFNMS(LDK(KP765366864), T14, VMUL(LDK(KP1_847759065), TV));
+			 T17 = VFMA(LDK(KP765366864), TV, VMUL(LDK(KP1_847759065), T14));
+		    }
+		    STA(&(R0[WS(rs, 9)]), VSUB(TM, T15), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 13)]), VADD(T16, T17), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 1)]), VADD(TM, T15), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 5)]), VSUB(T16, T17), ovs, &(R0[0]));
+	       }
+	       {
+		    V T2t, T2x, T2w, T2y;
+		    {
+			 V T2r, T2s, T2u, T2v;
+			 T2r = VADD(T2b, T2c);
+			 T2s = VFMA(LDK(KP1_847759065), T2e, VMUL(LDK(KP765366864), T2f));
+			 T2t = VSUB(T2r, T2s);
+			 T2x = VADD(T2r, T2s);
+			 T2u = VADD(T2i, T2j);
+			 T2v = VSUB(T2m, T2l);
+			 T2w = VFNMS(LDK(KP1_961570560), T2v, VMUL(LDK(KP390180644), T2u));
+			 T2y = VFMA(LDK(KP1_961570560), T2u, VMUL(LDK(KP390180644), T2v));
+		    }
+		    STA(&(R1[WS(rs, 11)]), VSUB(T2t, T2w), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 15)]), VADD(T2x, T2y), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 3)]), VADD(T2t, T2w), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 7)]), VSUB(T2x, T2y), ovs, &(R1[0]));
+	       }
+	       {
+		    V T1a, T1e, T1d, T1f;
+		    {
+			 V T18, T19, T1b, T1c;
+			 T18 = VADD(Ty, TB);
+			 T19 = VMUL(LDK(KP1_414213562), VADD(TD, TK));
+			 T1a = VSUB(T18, T19);
+			 T1e = VADD(T18, T19);
+			 T1b = VSUB(TN, TU);
+			 T1c = VSUB(T13, TW);
+			 T1d = VFNMS(LDK(KP1_847759065), T1c, VMUL(LDK(KP765366864), T1b));
+			 T1f = VFMA(LDK(KP1_847759065), T1b, VMUL(LDK(KP765366864), T1c));
+		    }
+		    STA(&(R0[WS(rs, 11)]), VSUB(T1a, T1d), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 15)]), VADD(T1e, T1f), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 3)]), VADD(T1a, T1d), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 7)]), VSUB(T1e, T1f), ovs, &(R0[0]));
+	       }
+	       {
+		    V T25, T29, T28, T2a;
+		    {
+			 V T23, T24, T26, T27;
+			 T23 = VSUB(T1v, T1y);
+			 T24 = VFMA(LDK(KP765366864), T1C, VMUL(LDK(KP1_847759065), T1F));
+			 T25 = VSUB(T23, T24);
+			 T29 = VADD(T23, T24);
+			 T26 = VSUB(T1K, T1R);
+			 T27 = VSUB(T1Y, T1V);
+			 T28 = VFNMS(LDK(KP1_662939224), T27, VMUL(LDK(KP1_111140466), T26));
+			 T2a = VFMA(LDK(KP1_662939224), T26, VMUL(LDK(KP1_111140466), T27));
+		    }
+		    STA(&(R1[WS(rs, 10)]), VSUB(T25, T28), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 14)]), VADD(T29, T2a), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 2)]), VADD(T25, T28), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 6)]), VSUB(T29, T2a), ovs, &(R1[0]));
+	       }
+	       {
+		    V T2h, T2p, T2o, T2q;
+		    {
+			 V T2d, T2g, T2k, T2n;
+			 T2d = VSUB(T2b, T2c);
+			 T2g = VFNMS(LDK(KP1_847759065), T2f, VMUL(LDK(KP765366864), T2e));
+			 T2h = VADD(T2d, T2g);
+			 T2p = VSUB(T2d, T2g);
+			 T2k = VSUB(T2i, T2j);
+			 T2n = VADD(T2l, T2m);
+			 T2o = VFNMS(LDK(KP1_111140466), T2n, VMUL(LDK(KP1_662939224), T2k));
+			 T2q = VFMA(LDK(KP1_111140466), T2k, VMUL(LDK(KP1_662939224), T2n));
+		    }
+		    STA(&(R1[WS(rs, 9)]), VSUB(T2h, T2o), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 13)]), VADD(T2p, T2q), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 1)]), VADD(T2h, T2o), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 5)]), VSUB(T2p, T2q), ovs, &(R1[0]));
+	       }
+	       {
+		    V T1H, T21, T20, T22;
+		    {
+			 V T1z, T1G, T1S, T1Z;
+			 T1z = VADD(T1v, T1y);
+			 T1G = VFNMS(LDK(KP765366864), T1F, VMUL(LDK(KP1_847759065), T1C));
+			 T1H = VADD(T1z, T1G);
+			 T21 = VSUB(T1z, T1G);
+			 T1S = VADD(T1K, T1R);
+			 T1Z = VADD(T1V, T1Y);
+			 T20 = VFNMS(LDK(KP390180644), T1Z, VMUL(LDK(KP1_961570560), T1S));
+			 T22 = VFMA(LDK(KP390180644), T1S, VMUL(LDK(KP1_961570560), T1Z));
+		    }
+		    STA(&(R1[WS(rs, 8)]), VSUB(T1H, T20), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 12)]), VADD(T21, T22), ovs, &(R1[0]));
+		    STA(&(R1[0]), VADD(T1H, T20), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 4)]), VSUB(T21, T22), ovs, &(R1[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 32, XSIMD_STRING("r2cbv_32"), {140, 34, 16, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_32) (planner *p) {
+     X(kr2c_register) (p, r2cbv_32, &desc);
+}
+
+#endif
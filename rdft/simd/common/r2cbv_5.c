@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:07:28 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_5 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -fma -compact -variables 4 -pipeline-latency 4 -sign 1 -n 5 -name r2cb_5 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 12 FP additions, 10 FP multiplications,
+ * (or, 2 additions, 0 multiplications, 10 fused multiply/add),
+ * 18 stack variables, 5 constants, and 10 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_5(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_902113032, +1.902113032590307144232878666758764286811397268);
+     DVK(KP1_118033988, +1.118033988749894848204586834365638117720309180);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DVK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DVK(KP618033988, +0.618033988749894848204586834365638117720309180);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(20, rs), MAKE_VOLATILE_STRIDE(20, csr), MAKE_VOLATILE_STRIDE(20, csi)) {
+	       V Ta, Tc, T1, T4, T5, T6, Tb, T7;
+	       {
+		    V T8, T9, T2, T3;
+		    T8 = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+		    T9 = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+		    Ta = VFMA(LDK(KP618033988), T9, T8);
+		    Tc = VFMS(LDK(KP618033988), T8, T9);
+		    T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+		    T2 = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+		    T3 = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+		    T4 = VADD(T2, T3);
+		    T5 = VFNMS(LDK(KP500000000), T4, T1);
+		    T6 = VSUB(T2, T3);
+	       }
+	       STA(&(R0[0]), VFMA(LDK(KP2_000000000), T4, T1), ovs, &(R0[0]));
+	       Tb = VFNMS(LDK(KP1_118033988), T6, T5);
+	       STA(&(R0[WS(rs, 1)]), VFNMS(LDK(KP1_902113032), Tc, Tb), ovs, &(R0[0]));
+	       STA(&(R1[WS(rs, 1)]), VFMA(LDK(KP1_902113032), Tc, Tb), ovs, &(R1[0]));
+	       T7 = VFMA(LDK(KP1_118033988), T6, T5);
+	       STA(&(R1[0]), VFNMS(LDK(KP1_902113032), Ta, T7), ovs, &(R1[0]));
+	       STA(&(R0[WS(rs, 2)]), VFMA(LDK(KP1_902113032), Ta, T7), ovs, &(R0[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 5, XSIMD_STRING("r2cbv_5"), {2, 0, 10, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_5) (planner *p) {
+     X(kr2c_register) (p, r2cbv_5, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_5 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -compact -variables 4 -pipeline-latency 4 -sign 1 -n 5 -name r2cb_5 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 12 FP additions, 7 FP multiplications,
+ * (or, 8 additions, 3 multiplications, 4 fused multiply/add),
+ * 18 stack variables, 5 constants, and 10 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_5(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DVK(KP1_118033988, +1.118033988749894848204586834365638117720309180);
+     DVK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DVK(KP1_902113032, +1.902113032590307144232878666758764286811397268);
+     DVK(KP1_175570504, +1.175570504584946258337411909278145537195304875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(20, rs), MAKE_VOLATILE_STRIDE(20, csr), MAKE_VOLATILE_STRIDE(20, csi)) {
+	       V Ta, Tc, T1, T4, T5, T6, Tb, T7;
+	       {
+		    V T8, T9, T2, T3;
+		    T8 = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+		    T9 = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+		    Ta = VFNMS(LDK(KP1_902113032), T9, VMUL(LDK(KP1_175570504), T8));
+		    Tc = VFMA(LDK(KP1_902113032), T8, VMUL(LDK(KP1_175570504), T9));
+		    T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+		    T2 = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+		    T3 = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+		    T4 = VADD(T2, T3);
+		    T5 = VFNMS(LDK(KP500000000), T4, T1);
+		    T6 = VMUL(LDK(KP1_118033988), VSUB(T2, T3));
+	       }
+	       STA(&(R0[0]), VFMA(LDK(KP2_000000000), T4, T1), ovs, &(R0[0]));
+	       Tb = VADD(T6, T5);
+	       STA(&(R1[0]), VSUB(Tb, Tc), ovs, &(R1[0]));
+	       STA(&(R0[WS(rs, 2)]), VADD(Tb, Tc), ovs, &(R0[0]));
+	       T7 = VSUB(T5, T6);
+	       STA(&(R0[WS(rs, 1)]), VSUB(T7, Ta), ovs, &(R0[0]));
+	       STA(&(R1[WS(rs, 1)]), VADD(T7, Ta), ovs, &(R1[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 5, XSIMD_STRING("r2cbv_5"), {8, 3, 4, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_5) (planner *p) {
+     X(kr2c_register) (p, r2cbv_5, &desc);
+}
+
+#endif
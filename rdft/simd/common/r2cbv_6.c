@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:07:28 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_6 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -fma -compact -variables 4 -pipeline-latency 4 -sign 1 -n 6 -name r2cb_6 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 14 FP additions, 6 FP multiplications,
+ * (or, 8 additions, 0 multiplications, 6 fused multiply/add),
+ * 17 stack variables, 2 constants, and 12 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_6(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(24, rs), MAKE_VOLATILE_STRIDE(24, csr), MAKE_VOLATILE_STRIDE(24, csi)) {
+	       V T3, T7, Tc, Te, T6, T8, T1, T2, T9, Td;
+	       T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+	       T2 = LDA(&(Cr[WS(csr, 3)]), ivs, &(Cr[0]));
+	       T3 = VADD(T1, T2);
+	       T7 = VSUB(T1, T2);
+	       {
+		    V Ta, Tb, T4, T5;
+		    Ta = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+		    Tb = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+		    Tc = VSUB(Ta, Tb);
+		    Te = VADD(Ta, Tb);
+		    T4 = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+		    T5 = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+		    T6 = VADD(T4, T5);
+		    T8 = VSUB(T5, T4);
+	       }
+	       STA(&(R0[0]), VFMA(LDK(KP2_000000000), T6, T3), ovs, &(R0[0]));
+	       STA(&(R1[WS(rs, 1)]), VFNMS(LDK(KP2_000000000), T8, T7), ovs, &(R1[0]));
+	       T9 = VSUB(T3, T6);
+	       STA(&(R0[WS(rs, 2)]), VFNMS(LDK(KP1_732050807), Tc, T9), ovs, &(R0[0]));
+	       STA(&(R0[WS(rs, 1)]), VFMA(LDK(KP1_732050807), Tc, T9), ovs, &(R0[0]));
+	       Td = VADD(T7, T8);
+	       STA(&(R1[0]), VFNMS(LDK(KP1_732050807), Te, Td), ovs, &(R1[0]));
+	       STA(&(R1[WS(rs, 2)]), VFMA(LDK(KP1_732050807), Te, Td), ovs, &(R1[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 6, XSIMD_STRING("r2cbv_6"), {8, 0, 6, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_6) (planner *p) {
+     X(kr2c_register) (p, r2cbv_6, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_6 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -compact -variables 4 -pipeline-latency 4 -sign 1 -n 6 -name r2cb_6 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 14 FP additions, 4 FP multiplications,
+ * (or, 12 additions, 2 multiplications, 2 fused multiply/add),
+ * 17 stack variables, 2 constants, and 12 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_6(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DVK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(24, rs), MAKE_VOLATILE_STRIDE(24, csr), MAKE_VOLATILE_STRIDE(24, csi)) {
+	       V T3, T7, Tc, Te, T6, T8, T1, T2, T9, Td;
+	       T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+	       T2 = LDA(&(Cr[WS(csr, 3)]), ivs, &(Cr[0]));
+	       T3 = VSUB(T1, T2);
+	       T7 = VADD(T1, T2);
+	       {
+		    V Ta, Tb, T4, T5;
+		    Ta = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+		    Tb = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+		    Tc = VMUL(LDK(KP1_732050807), VSUB(Ta, Tb));
+		    Te = VMUL(LDK(KP1_732050807), VADD(Ta, Tb));
+		    T4 = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+		    T5 = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+		    T6 = VSUB(T4, T5);
+		    T8 = VADD(T4, T5);
+	       }
+	       STA(&(R1[WS(rs, 1)]), VFMA(LDK(KP2_000000000), T6, T3), ovs, &(R1[0]));
+	       STA(&(R0[0]), VFMA(LDK(KP2_000000000), T8, T7), ovs, &(R0[0]));
+	       T9 = VSUB(T7, T8);
+	       STA(&(R0[WS(rs, 2)]), VSUB(T9, Tc), ovs, &(R0[0]));
+	       STA(&(R0[WS(rs, 1)]), VADD(T9, Tc), ovs, &(R0[0]));
+	       Td = VSUB(T3, T6);
+	       STA(&(R1[0]), VSUB(Td, Te), ovs, &(R1[0]));
+	       STA(&(R1[WS(rs, 2)]), VADD(Td, Te), ovs, &(R1[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 6, XSIMD_STRING("r2cbv_6"), {12, 2, 2, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_6) (planner *p) {
+     X(kr2c_register) (p, r2cbv_6, &desc);
+}
+
+#endif
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:07:28 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_7 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -fma -compact -variables 4 -pipeline-latency 4 -sign 1 -n 7 -name r2cb_7 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 24 FP additions, 22 FP multiplications,
+ * (or, 2 additions, 0 multiplications, 22 fused multiply/add),
+ * 27 stack variables, 7 constants, and 14 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_7(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_949855824, +1.949855824363647214036263365987862434465571601);
+     DVK(KP801937735, +0.801937735804838252472204639014890102331838324);
+     DVK(KP1_801937735, +1.801937735804838252472204639014890102331838324);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DVK(KP692021471, +0.692021471630095869627814897002069140197260599);
+     DVK(KP356895867, +0.356895867892209443894399510021300583399127187);
+     DVK(KP554958132, +0.554958132087371191422194871006410481067288862);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(28, rs), MAKE_VOLATILE_STRIDE(28, csr), MAKE_VOLATILE_STRIDE(28, csi)) {
+	       V T1, T9, Tb, Ta, Tc, Tm, Th, T7, Tk, Tf, T5, Tl, Tn;
+	       T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+	       T9 = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+	       Tb = LDA(&(Ci[WS(csi, 3)]), ivs, &(Ci[0]));
+	       Ta = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+	       Tc = VFMA(LDK(KP554958132), Tb, Ta);
+	       Tm = VFMS(LDK(KP554958132), Ta, T9);
+	       Th = VFMA(LDK(KP554958132), T9, Tb);
+	       {
+		    V T2, T4, T3, T6, Tj, Te;
+		    T2 = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+		    T4 = LDA(&(Cr[WS(csr, 3)]), ivs, &(Cr[0]));
+		    T3 = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+		    T6 = VFNMS(LDK(KP356895867), T3, T2);
+		    Tj = VFNMS(LDK(KP356895867), T4, T3);
+		    Te = VFNMS(LDK(KP356895867), T2, T4);
+		    T7 = VFNMS(LDK(KP692021471), T6, T4);
+		    Tk = VFNMS(LDK(KP692021471), Tj, T2);
+		    Tf = VFNMS(LDK(KP692021471), Te, T3);
+		    T5 = VADD(VADD(T2, T3), T4);
+	       }
+	       STA(&(R0[0]), VFMA(LDK(KP2_000000000), T5, T1), ovs, &(R0[0]));
+	       Tl = VFNMS(LDK(KP1_801937735), Tk, T1);
+	       Tn = VFMA(LDK(KP801937735), Tm, Tb);
+	       STA(&(R1[WS(rs, 1)]), VFNMS(LDK(KP1_949855824), Tn, Tl), ovs, &(R1[0]));
+	       STA(&(R0[WS(rs, 2)]), VFMA(LDK(KP1_949855824), Tn, Tl), ovs, &(R0[0]));
+	       {
+		    V T8, Td, Tg, Ti;
+		    T8 = VFNMS(LDK(KP1_801937735), T7, T1);
+		    Td = VFMA(LDK(KP801937735), Tc, T9);
+		    STA(&(R1[0]), VFNMS(LDK(KP1_949855824), Td, T8), ovs, &(R1[0]));
+		    STA(&(R0[WS(rs, 3)]), VFMA(LDK(KP1_949855824), Td, T8), ovs, &(R0[0]));
+		    Tg = VFNMS(LDK(KP1_801937735), Tf, T1);
+		    Ti = VFNMS(LDK(KP801937735), Th, Ta);
+		    STA(&(R0[WS(rs, 1)]), VFNMS(LDK(KP1_949855824), Ti, Tg), ovs, &(R0[0]));
+		    STA(&(R1[WS(rs, 2)]), VFMA(LDK(KP1_949855824), Ti, Tg), ovs, &(R1[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 7, XSIMD_STRING("r2cbv_7"), {2, 0, 22, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_7) (planner *p) {
+     X(kr2c_register) (p, r2cbv_7, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_7 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -compact -variables 4 -pipeline-latency 4 -sign 1 -n 7 -name r2cb_7 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 24 FP additions, 19 FP multiplications,
+ * (or, 11 additions, 6 multiplications, 13 fused multiply/add),
+ * 21 stack variables, 7 constants, and 14 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_7(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DVK(KP1_801937735, +1.801937735804838252472204639014890102331838324);
+     DVK(KP445041867, +0.445041867912628808577805128993589518932711138);
+     DVK(KP1_246979603, +1.246979603717467061050009768008479621264549462);
+     DVK(KP867767478, +0.867767478235116240951536665696717509219981456);
+     DVK(KP1_949855824, +1.949855824363647214036263365987862434465571601);
+     DVK(KP1_563662964, +1.563662964936059617416889053348115500464669037);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(28, rs), MAKE_VOLATILE_STRIDE(28, csr), MAKE_VOLATILE_STRIDE(28, csi)) {
+	       V T9, Td, Tb, T1, T4, T2, T3, T5, Tc, Ta, T6, T8, T7;
+	       T6 = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+	       T8 = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+	       T7 = LDA(&(Ci[WS(csi, 3)]), ivs, &(Ci[0]));
+	       T9 = VSUB(VFNMS(LDK(KP1_949855824), T7, VMUL(LDK(KP1_563662964), T6)), VMUL(LDK(KP867767478), T8));
+	       Td = VSUB(VFMA(LDK(KP867767478), T6, VMUL(LDK(KP1_563662964), T7)), VMUL(LDK(KP1_949855824), T8));
+	       Tb = VADD(VFMA(LDK(KP1_563662964), T8, VMUL(LDK(KP1_949855824), T6)), VMUL(LDK(KP867767478), T7));
+	       T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+	       T4 = LDA(&(Cr[WS(csr, 3)]), ivs, &(Cr[0]));
+	       T2 = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+	       T3 = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+	       T5 = VSUB(VFNMS(LDK(KP445041867), T4, VFMA(LDK(KP1_246979603), T3, T1)), VMUL(LDK(KP1_801937735), T2));
+	       Tc = VSUB(VFNMS(LDK(KP1_801937735), T3, VFMA(LDK(KP1_246979603), T4, T1)), VMUL(LDK(KP445041867), T2));
+	       Ta = VSUB(VFNMS(LDK(KP1_801937735), T4, VFMA(LDK(KP1_246979603), T2, T1)), VMUL(LDK(KP445041867), T3));
+	       STA(&(R0[WS(rs, 2)]), VSUB(T5, T9), ovs, &(R0[0]));
+	       STA(&(R1[WS(rs, 1)]), VADD(T5, T9), ovs, &(R1[0]));
+	       STA(&(R0[WS(rs, 1)]), VADD(Tc, Td), ovs, &(R0[0]));
+	       STA(&(R1[WS(rs, 2)]), VSUB(Tc, Td), ovs, &(R1[0]));
+	       STA(&(R0[WS(rs, 3)]), VADD(Ta, Tb), ovs, &(R0[0]));
+	       STA(&(R1[0]), VSUB(Ta, Tb), ovs, &(R1[0]));
+	       STA(&(R0[0]), VFMA(LDK(KP2_000000000), VADD(VADD(T2, T3), T4), T1), ovs, &(R0[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 7, XSIMD_STRING("r2cbv_7"), {11, 6, 13, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_7) (planner *p) {
+     X(kr2c_register) (p, r2cbv_7, &desc);
+}
+
+#endif
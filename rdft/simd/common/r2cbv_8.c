@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:07:28 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_8 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -fma -compact -variables 4 -pipeline-latency 4 -sign 1 -n 8 -name r2cb_8 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 20 FP additions, 12 FP multiplications,
+ * (or, 8 additions, 0 multiplications, 12 fused multiply/add),
+ * 19 stack variables, 2 constants, and 16 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_8(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(32, rs), MAKE_VOLATILE_STRIDE(32, csr), MAKE_VOLATILE_STRIDE(32, csi)) {
+	       V T4, Ta, T3, T9, T8, Tc, Tf, Tk, T1, T2, T5, Tj;
+	       T4 = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+	       Ta = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+	       T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+	       T2 = LDA(&(Cr[WS(csr, 4)]), ivs, &(Cr[0]));
+	       T3 = VADD(T1, T2);
+	       T9 = VSUB(T1, T2);
+	       {
+		    V T6, T7, Td, Te;
+		    T6 = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+		    T7 = LDA(&(Cr[WS(csr, 3)]), ivs, &(Cr[0]));
+		    T8 = VADD(T6, T7);
+		    Tc = VSUB(T6, T7);
+		    Td = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+		    Te = LDA(&(Ci[WS(csi, 3)]), ivs, &(Ci[0]));
+		    Tf = VADD(Td, Te);
+		    Tk = VSUB(Td, Te);
+	       }
+	       T5 = VFMA(LDK(KP2_000000000), T4, T3);
+	       STA(&(R0[WS(rs, 2)]), VFNMS(LDK(KP2_000000000), T8, T5), ovs, &(R0[0]));
+	       STA(&(R0[0]), VFMA(LDK(KP2_000000000), T8, T5), ovs, &(R0[0]));
+	       Tj = VFNMS(LDK(KP2_000000000), T4, T3);
+	       STA(&(R0[WS(rs, 1)]), VFNMS(LDK(KP2_000000000), Tk, Tj), ovs, &(R0[0]));
+	       STA(&(R0[WS(rs, 3)]), VFMA(LDK(KP2_000000000), Tk, Tj), ovs, &(R0[0]));
+	       {
+		    V Tb, Tg, Th, Ti;
+		    Tb = VFNMS(LDK(KP2_000000000), Ta, T9);
+		    Tg = VSUB(Tc, Tf);
+		    STA(&(R1[WS(rs, 2)]), VFNMS(LDK(KP1_414213562), Tg, Tb), ovs, &(R1[0]));
+		    STA(&(R1[0]), VFMA(LDK(KP1_414213562), Tg, Tb), ovs, &(R1[0]));
+		    Th = VFMA(LDK(KP2_000000000), Ta, T9);
+		    Ti = VADD(Tc, Tf);
+		    STA(&(R1[WS(rs, 1)]), VFNMS(LDK(KP1_414213562), Ti, Th), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 3)]), VFMA(LDK(KP1_414213562), Ti, Th), ovs, &(R1[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 8, XSIMD_STRING("r2cbv_8"), {8, 0, 12, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_8) (planner *p) {
+     X(kr2c_register) (p, r2cbv_8, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_8 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -compact -variables 4 -pipeline-latency 4 -sign 1 -n 8 -name r2cb_8 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 20 FP additions, 6 FP multiplications,
+ * (or, 20 additions, 6 multiplications, 0 fused multiply/add),
+ * 21 stack variables, 2 constants, and 16 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_8(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_414213562, +1.414213562373095048801688724209698078569671875);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(32, rs), MAKE_VOLATILE_STRIDE(32, csr), MAKE_VOLATILE_STRIDE(32, csi)) {
+	       V T5, Tg, T3, Te, T9, Ti, Td, Tj, T6, Ta;
+	       {
+		    V T4, Tf, T1, T2;
+		    T4 = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+		    T5 = VMUL(LDK(KP2_000000000), T4);
+		    Tf = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+		    Tg = VMUL(LDK(KP2_000000000), Tf);
+		    T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+		    T2 = LDA(&(Cr[WS(csr, 4)]), ivs, &(Cr[0]));
+		    T3 = VADD(T1, T2);
+		    Te = VSUB(T1, T2);
+		    {
+			 V T7, T8, Tb, Tc;
+			 T7 = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+			 T8 = LDA(&(Cr[WS(csr, 3)]), ivs, &(Cr[0]));
+			 T9 = VMUL(LDK(KP2_000000000), VADD(T7, T8));
+			 Ti = VSUB(T7, T8);
+			 Tb = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+			 Tc = LDA(&(Ci[WS(csi, 3)]), ivs, &(Ci[0]));
+			 Td = VMUL(LDK(KP2_000000000), VSUB(Tb, Tc));
+			 Tj = VADD(Tb, Tc);
+		    }
+	       }
+	       T6 = VADD(T3, T5);
+	       STA(&(R0[WS(rs, 2)]), VSUB(T6, T9), ovs, &(R0[0]));
+	       STA(&(R0[0]), VADD(T6, T9), ovs, &(R0[0]));
+	       Ta = VSUB(T3, T5);
+	       STA(&(R0[WS(rs, 1)]), VSUB(Ta, Td), ovs, &(R0[0]));
+	       STA(&(R0[WS(rs, 3)]), VADD(Ta, Td), ovs, &(R0[0]));
+	       {
+		    V Th, Tk, Tl, Tm;
+		    Th = VSUB(Te, Tg);
+		    Tk = VMUL(LDK(KP1_414213562), VSUB(Ti, Tj));
+		    STA(&(R1[WS(rs, 2)]), VSUB(Th, Tk), ovs, &(R1[0]));
+		    STA(&(R1[0]), VADD(Th, Tk), ovs, &(R1[0]));
+		    Tl = VADD(Te, Tg);
+		    Tm = VMUL(LDK(KP1_414213562), VADD(Ti, Tj));
+		    STA(&(R1[WS(rs, 1)]), VSUB(Tl, Tm), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 3)]), VADD(Tl, Tm), ovs, &(R1[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 8, XSIMD_STRING("r2cbv_8"), {20, 6, 0, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_8) (planner *p) {
+     X(kr2c_register) (p, r2cbv_8, &desc);
+}
+
+#endif
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:07:28 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_9 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -fma -compact -variables 4 -pipeline-latency 4 -sign 1 -n 9 -name r2cb_9 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 32 FP additions, 24 FP multiplications,
+ * (or, 8 additions, 0 multiplications, 24 fused multiply/add),
+ * 35 stack variables, 12 constants, and 18 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_9(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP1_705737063, +1.705737063904886419256501927880148143872040591);
+     DVK(KP1_969615506, +1.969615506024416118733486049179046027341286503);
+     DVK(KP984807753, +0.984807753012208059366743024589523013670643252);
+     DVK(KP176326980, +0.176326980708464973471090386868618986121633062);
+     DVK(KP1_326827896, +1.326827896337876792410842639271782594433726619);
+     DVK(KP1_532088886, +1.532088886237956070404785301110833347871664914);
+     DVK(KP766044443, +0.766044443118978035202392650555416673935832457);
+     DVK(KP839099631, +0.839099631177280011763127298123181364687434283);
+     DVK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DVK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DVK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(36, rs), MAKE_VOLATILE_STRIDE(36, csr), MAKE_VOLATILE_STRIDE(36, csi)) {
+	       V T3, Tp, Tb, Th, Ti, T8, Tl, Tq, Tg, Tr, Tv, Tw;
+	       {
+		    V Ta, T1, T2, T9;
+		    Ta = LDA(&(Ci[WS(csi, 3)]), ivs, &(Ci[0]));
+		    T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+		    T2 = LDA(&(Cr[WS(csr, 3)]), ivs, &(Cr[0]));
+		    T9 = VSUB(T1, T2);
+		    T3 = VFMA(LDK(KP2_000000000), T2, T1);
+		    Tp = VFMA(LDK(KP1_732050807), Ta, T9);
+		    Tb = VFNMS(LDK(KP1_732050807), Ta, T9);
+	       }
+	       {
+		    V T4, T7, Tk, Tf, Tj, Tc;
+		    T4 = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+		    Th = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+		    {
+			 V T5, T6, Td, Te;
+			 T5 = LDA(&(Cr[WS(csr, 4)]), ivs, &(Cr[0]));
+			 T6 = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+			 T7 = VADD(T5, T6);
+			 Tk = VSUB(T6, T5);
+			 Td = LDA(&(Ci[WS(csi, 4)]), ivs, &(Ci[0]));
+			 Te = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+			 Tf = VADD(Td, Te);
+			 Ti = VSUB(Td, Te);
+		    }
+		    T8 = VADD(T4, T7);
+		    Tj = VFNMS(LDK(KP500000000), Ti, Th);
+		    Tl = VFNMS(LDK(KP866025403), Tk, Tj);
+		    Tq = VFMA(LDK(KP866025403), Tk, Tj);
+		    Tc = VFNMS(LDK(KP500000000), T7, T4);
+		    Tg = VFNMS(LDK(KP866025403), Tf, Tc);
+		    Tr = VFMA(LDK(KP866025403), Tf, Tc);
+	       }
+	       STA(&(R0[0]), VFMA(LDK(KP2_000000000), T8, T3), ovs, &(R0[0]));
+	       Tv = VSUB(T3, T8);
+	       Tw = VADD(Ti, Th);
+	       STA(&(R1[WS(rs, 1)]), VFNMS(LDK(KP1_732050807), Tw, Tv), ovs, &(R1[0]));
+	       STA(&(R0[WS(rs, 3)]), VFMA(LDK(KP1_732050807), Tw, Tv), ovs, &(R0[0]));
+	       {
+		    V To, Tm, Tn, Tu, Ts, Tt;
+		    To = VFMA(LDK(KP839099631), Tg, Tl);
+		    Tm = VFNMS(LDK(KP839099631), Tl, Tg);
+		    Tn = VFNMS(LDK(KP766044443), Tm, Tb);
+		    STA(&(R1[0]), VFMA(LDK(KP1_532088886), Tm, Tb), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 3)]), VFMA(LDK(KP1_326827896), To, Tn), ovs, &(R1[0]));
+		    STA(&(R0[WS(rs, 2)]), VFNMS(LDK(KP1_326827896), To, Tn), ovs, &(R0[0]));
+		    Tu = VFMA(LDK(KP176326980), Tq, Tr);
+		    Ts = VFNMS(LDK(KP176326980), Tr, Tq);
+		    Tt = VFMA(LDK(KP984807753), Ts, Tp);
+		    STA(&(R0[WS(rs, 1)]), VFNMS(LDK(KP1_969615506), Ts, Tp), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 4)]), VFMA(LDK(KP1_705737063), Tu, Tt), ovs, &(R0[0]));
+		    STA(&(R1[WS(rs, 2)]), VFNMS(LDK(KP1_705737063), Tu, Tt), ovs, &(R1[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 9, XSIMD_STRING("r2cbv_9"), {8, 0, 24, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_9) (planner *p) {
+     X(kr2c_register) (p, r2cbv_9, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cbv_9 -include rdft/simd/r2cbv.h from: ../../../genfft/gen_r2cb.native -compact -variables 4 -pipeline-latency 4 -sign 1 -n 9 -name r2cb_9 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 32 FP additions, 18 FP multiplications,
+ * (or, 22 additions, 8 multiplications, 10 fused multiply/add),
+ * 35 stack variables, 12 constants, and 18 memory accesses
+ */
+#include "rdft/simd/r2cbv.h"
+
+static void r2cbv_9(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP984807753, +0.984807753012208059366743024589523013670643252);
+     DVK(KP173648177, +0.173648177666930348851716626769314796000375677);
+     DVK(KP300767466, +0.300767466360870593278543795225003852144476517);
+     DVK(KP1_705737063, +1.705737063904886419256501927880148143872040591);
+     DVK(KP642787609, +0.642787609686539326322643409907263432907559884);
+     DVK(KP766044443, +0.766044443118978035202392650555416673935832457);
+     DVK(KP1_326827896, +1.326827896337876792410842639271782594433726619);
+     DVK(KP1_113340798, +1.113340798452838732905825904094046265936583811);
+     DVK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DVK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DVK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DVK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ovs), R1 = R1 + ((2 * VL) * ovs), Cr = Cr + ((2 * VL) * ivs), Ci = Ci + ((2 * VL) * ivs), MAKE_VOLATILE_STRIDE(36, rs), MAKE_VOLATILE_STRIDE(36, csr), MAKE_VOLATILE_STRIDE(36, csi)) {
+	       V T3, Tq, Tc, Tk, Tj, T8, Tm, Ts, Th, Tr, Tw, Tx;
+	       {
+		    V Tb, T1, T2, T9, Ta;
+		    Ta = LDA(&(Ci[WS(csi, 3)]), ivs, &(Ci[0]));
+		    Tb = VMUL(LDK(KP1_732050807), Ta);
+		    T1 = LDA(&(Cr[0]), ivs, &(Cr[0]));
+		    T2 = LDA(&(Cr[WS(csr, 3)]), ivs, &(Cr[0]));
+		    T9 = VSUB(T1, T2);
+		    T3 = VFMA(LDK(KP2_000000000), T2, T1);
+		    Tq = VADD(T9, Tb);
+		    Tc = VSUB(T9, Tb);
+	       }
+	       {
+		    V T4, T7, Ti, Tg, Tl, Td;
+		    T4 = LDA(&(Cr[WS(csr, 1)]), ivs, &(Cr[0]));
+		    Tk = LDA(&(Ci[WS(csi, 1)]), ivs, &(Ci[0]));
+		    {
+			 V T5, T6, Te, Tf;
+			 T5 = LDA(&(Cr[WS(csr, 4)]), ivs, &(Cr[0]));
+			 T6 = LDA(&(Cr[WS(csr, 2)]), ivs, &(Cr[0]));
+			 T7 = VADD(T5, T6);
+			 Ti = VMUL(LDK(KP866025403), VSUB(T5, T6));
+			 Te = LDA(&(Ci[WS(csi, 4)]), ivs, &(Ci[0]));
+			 Tf = LDA(&(Ci[WS(csi, 2)]), ivs, &(Ci[0]));
+			 Tg = VMUL(LDK(KP866025403), VADD(Te, Tf));
+			 Tj = VSUB(Tf, Te);
+		    }
+		    T8 = VADD(T4, T7);
+		    Tl = VFMA(LDK(KP500000000), Tj, Tk);
+		    Tm = VADD(Ti, Tl);
+		    Ts = VSUB(Tl, Ti);
+		    Td = VFNMS(LDK(KP500000000), T7, T4);
+		    Th = VSUB(Td, Tg);
+		    Tr = VADD(Td, Tg);
+	       }
+	       STA(&(R0[0]), VFMA(LDK(KP2_000000000), T8, T3), ovs, &(R0[0]));
+	       Tw = VSUB(T3, T8);
+	       Tx = VMUL(LDK(KP1_732050807), VSUB(Tk, Tj));
+	       STA(&(R1[WS(rs, 1)]), VSUB(Tw, Tx), ovs, &(R1[0]));
+	       STA(&(R0[WS(rs, 3)]), VADD(Tw, Tx), ovs, &(R0[0]));
+	       {
+		    V Tp, Tn, To, Tv, Tt, Tu;
+		    Tp = VFMA(LDK(KP1_113340798), Th, VMUL(LDK(KP1_326827896), Tm));
+		    Tn = VFNMS(LDK(KP642787609), Tm, VMUL(LDK(KP766044443), Th));
+		    To = VSUB(Tc, Tn);
+		    STA(&(R1[0]), VFMA(LDK(KP2_000000000), Tn, Tc), ovs, &(R1[0]));
+		    STA(&(R1[WS(rs, 3)]), VADD(To, Tp), ovs, &(R1[0]));
+		    STA(&(R0[WS(rs, 2)]), VSUB(To, Tp), ovs, &(R0[0]));
+		    Tv = VFMA(LDK(KP1_705737063), Tr, VMUL(LDK(KP300767466), Ts));
+		    Tt = VFNMS(LDK(KP984807753), Ts, VMUL(LDK(KP173648177), Tr));
+		    Tu = VSUB(Tq, Tt);
+		    STA(&(R0[WS(rs, 1)]), VFMA(LDK(KP2_000000000), Tt, Tq), ovs, &(R0[0]));
+		    STA(&(R0[WS(rs, 4)]), VADD(Tu, Tv), ovs, &(R0[0]));
+		    STA(&(R1[WS(rs, 2)]), VSUB(Tu, Tv), ovs, &(R1[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 9, XSIMD_STRING("r2cbv_9"), {22, 8, 10, 0}, &GENUS };
+
+void XSIMD(codelet_r2cbv_9) (planner *p) {
+     X(kr2c_register) (p, r2cbv_9, &desc);
+}
+
+#endif
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:06:26 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_10 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -fma -compact -variables 4 -pipeline-latency 4 -n 10 -name r2cf_10 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 34 FP additions, 14 FP multiplications,
+ * (or, 24 additions, 4 multiplications, 10 fused multiply/add),
+ * 26 stack variables, 4 constants, and 20 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_10(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP559016994, +0.559016994374947424102293417182819058860154590);
+     DVK(KP250000000, +0.250000000000000000000000000000000000000000000);
+     DVK(KP618033988, +0.618033988749894848204586834365638117720309180);
+     DVK(KP951056516, +0.951056516295153572116439333379382143405698634);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(40, rs), MAKE_VOLATILE_STRIDE(40, csr), MAKE_VOLATILE_STRIDE(40, csi)) {
+	       V T3, Tt, Td, Tn, Tg, To, Th, Tv, T6, Tq, T9, Tr, Ta, Tu, T1;
+	       V T2;
+	       T1 = LDA(&(R0[0]), ivs, &(R0[0]));
+	       T2 = LDA(&(R1[WS(rs, 2)]), ivs, &(R1[0]));
+	       T3 = VSUB(T1, T2);
+	       Tt = VADD(T1, T2);
+	       {
+		    V Tb, Tc, Te, Tf;
+		    Tb = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+		    Tc = LDA(&(R1[WS(rs, 4)]), ivs, &(R1[0]));
+		    Td = VSUB(Tb, Tc);
+		    Tn = VADD(Tb, Tc);
+		    Te = LDA(&(R0[WS(rs, 3)]), ivs, &(R0[0]));
+		    Tf = LDA(&(R1[0]), ivs, &(R1[0]));
+		    Tg = VSUB(Te, Tf);
+		    To = VADD(Te, Tf);
+	       }
+	       Th = VADD(Td, Tg);
+	       Tv = VADD(Tn, To);
+	       {
+		    V T4, T5, T7, T8;
+		    T4 = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+		    T5 = LDA(&(R1[WS(rs, 3)]), ivs, &(R1[0]));
+		    T6 = VSUB(T4, T5);
+		    Tq = VADD(T4, T5);
+		    T7 = LDA(&(R0[WS(rs, 4)]), ivs, &(R0[0]));
+		    T8 = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+		    T9 = VSUB(T7, T8);
+		    Tr = VADD(T7, T8);
+	       }
+	       Ta = VADD(T6, T9);
+	       Tu = VADD(Tq, Tr);
+	       {
+		    V Tl, Tm, Tk, Ti, Tj;
+		    Tl = VSUB(T6, T9);
+		    Tm = VSUB(Tg, Td);
+		    STA(&(Ci[WS(csi, 1)]), VMUL(LDK(KP951056516), VFMS(LDK(KP618033988), Tm, Tl)), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 3)]), VMUL(LDK(KP951056516), VFMA(LDK(KP618033988), Tl, Tm)), ovs, &(Ci[0]));
+		    Tk = VSUB(Ta, Th);
+		    Ti = VADD(Ta, Th);
+		    Tj = VFNMS(LDK(KP250000000), Ti, T3);
+		    STA(&(Cr[WS(csr, 1)]), VFMA(LDK(KP559016994), Tk, Tj), ovs, &(Cr[0]));
+		    STA(&(Cr[WS(csr, 5)]), VADD(T3, Ti), ovs, &(Cr[0]));
+		    STA(&(Cr[WS(csr, 3)]), VFNMS(LDK(KP559016994), Tk, Tj), ovs, &(Cr[0]));
+	       }
+	       {
+		    V Tp, Ts, Ty, Tw, Tx;
+		    Tp = VSUB(Tn, To);
+		    Ts = VSUB(Tq, Tr);
+		    STA(&(Ci[WS(csi, 2)]), VMUL(LDK(KP951056516), VFNMS(LDK(KP618033988), Ts, Tp)), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 4)]), VMUL(LDK(KP951056516), VFMA(LDK(KP618033988), Tp, Ts)), ovs, &(Ci[0]));
+		    Ty = VSUB(Tu, Tv);
+		    Tw = VADD(Tu, Tv);
+		    Tx = VFNMS(LDK(KP250000000), Tw, Tt);
+		    STA(&(Cr[WS(csr, 2)]), VFNMS(LDK(KP559016994), Ty, Tx), ovs, &(Cr[0]));
+		    STA(&(Cr[0]), VADD(Tt, Tw), ovs, &(Cr[0]));
+		    STA(&(Cr[WS(csr, 4)]), VFMA(LDK(KP559016994), Ty, Tx), ovs, &(Cr[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 10, XSIMD_STRING("r2cfv_10"), {24, 4, 10, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_10) (planner *p) {
+     X(kr2c_register) (p, r2cfv_10, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_10 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -compact -variables 4 -pipeline-latency 4 -n 10 -name r2cf_10 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 34 FP additions, 12 FP multiplications,
+ * (or, 28 additions, 6 multiplications, 6 fused multiply/add),
+ * 26 stack variables, 4 constants, and 20 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_10(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP250000000, +0.250000000000000000000000000000000000000000000);
+     DVK(KP559016994, +0.559016994374947424102293417182819058860154590);
+     DVK(KP951056516, +0.951056516295153572116439333379382143405698634);
+     DVK(KP587785252, +0.587785252292473129168705954639072768597652438);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(40, rs), MAKE_VOLATILE_STRIDE(40, csr), MAKE_VOLATILE_STRIDE(40, csi)) {
+	       V Ti, Tt, Ta, Tn, Td, To, Te, Tv, T3, Tq, T6, Tr, T7, Tu, Tg;
+	       V Th;
+	       Tg = LDA(&(R0[0]), ivs, &(R0[0]));
+	       Th = LDA(&(R1[WS(rs, 2)]), ivs, &(R1[0]));
+	       Ti = VSUB(Tg, Th);
+	       Tt = VADD(Tg, Th);
+	       {
+		    V T8, T9, Tb, Tc;
+		    T8 = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+		    T9 = LDA(&(R1[WS(rs, 4)]), ivs, &(R1[0]));
+		    Ta = VSUB(T8, T9);
+		    Tn = VADD(T8, T9);
+		    Tb = LDA(&(R0[WS(rs, 3)]), ivs, &(R0[0]));
+		    Tc = LDA(&(R1[0]), ivs, &(R1[0]));
+		    Td = VSUB(Tb, Tc);
+		    To = VADD(Tb, Tc);
+	       }
+	       Te = VADD(Ta, Td);
+	       Tv = VADD(Tn, To);
+	       {
+		    V T1, T2, T4, T5;
+		    T1 = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+		    T2 = LDA(&(R1[WS(rs, 3)]), ivs, &(R1[0]));
+		    T3 = VSUB(T1, T2);
+		    Tq = VADD(T1, T2);
+		    T4 = LDA(&(R0[WS(rs, 4)]), ivs, &(R0[0]));
+		    T5 = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+		    T6 = VSUB(T4, T5);
+		    Tr = VADD(T4, T5);
+	       }
+	       T7 = VADD(T3, T6);
+	       Tu = VADD(Tq, Tr);
+	       {
+		    V Tl, Tm, Tf, Tj, Tk;
+		    Tl = VSUB(Td, Ta);
+		    Tm = VSUB(T3, T6);
+		    STA(&(Ci[WS(csi, 1)]), VFNMS(LDK(KP951056516), Tm, VMUL(LDK(KP587785252), Tl)), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 3)]), VFMA(LDK(KP587785252), Tm, VMUL(LDK(KP951056516), Tl)), ovs, &(Ci[0]));
+		    Tf = VMUL(LDK(KP559016994), VSUB(T7, Te));
+		    Tj = VADD(T7, Te);
+		    Tk = VFNMS(LDK(KP250000000), Tj, Ti);
+		    STA(&(Cr[WS(csr, 1)]), VADD(Tf, Tk), ovs, &(Cr[0]));
+		    STA(&(Cr[WS(csr, 5)]), VADD(Ti, Tj), ovs, &(Cr[0]));
+		    STA(&(Cr[WS(csr, 3)]), VSUB(Tk, Tf), ovs, &(Cr[0]));
+	       }
+	       {
+		    V Tp, Ts, Ty, Tw, Tx;
+		    Tp = VSUB(Tn, To);
+		    Ts = VSUB(Tq, Tr);
+		    STA(&(Ci[WS(csi, 2)]), VFNMS(LDK(KP587785252), Ts, VMUL(LDK(KP951056516), Tp)), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 4)]), VFMA(LDK(KP951056516), Ts, VMUL(LDK(KP587785252), Tp)), ovs, &(Ci[0]));
+		    Ty = VMUL(LDK(KP559016994), VSUB(Tu, Tv));
+		    Tw = VADD(Tu, Tv);
+		    Tx = VFNMS(LDK(KP250000000), Tw, Tt);
+		    STA(&(Cr[WS(csr, 2)]), VSUB(Tx, Ty), ovs, &(Cr[0]));
+		    STA(&(Cr[0]), VADD(Tt, Tw), ovs, &(Cr[0]));
+		    STA(&(Cr[WS(csr, 4)]), VADD(Ty, Tx), ovs, &(Cr[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 10, XSIMD_STRING("r2cfv_10"), {28, 6, 6, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_10) (planner *p) {
+     X(kr2c_register) (p, r2cfv_10, &desc);
+}
+
+#endif
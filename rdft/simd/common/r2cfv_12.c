@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:06:26 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_12 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -fma -compact -variables 4 -pipeline-latency 4 -n 12 -name r2cf_12 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 38 FP additions, 10 FP multiplications,
+ * (or, 30 additions, 2 multiplications, 8 fused multiply/add),
+ * 21 stack variables, 2 constants, and 24 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_12(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DVK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(48, rs), MAKE_VOLATILE_STRIDE(48, csr), MAKE_VOLATILE_STRIDE(48, csi)) {
+	       V T5, Tp, Tm, Tk, Ty, Tt, Ta, Tq, Tn, Tf, Tz, Tu, Tl, To;
+	       {
+		    V T1, T2, T3, T4;
+		    T1 = LDA(&(R0[0]), ivs, &(R0[0]));
+		    T2 = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+		    T3 = LDA(&(R0[WS(rs, 4)]), ivs, &(R0[0]));
+		    T4 = VADD(T2, T3);
+		    T5 = VADD(T1, T4);
+		    Tp = VFNMS(LDK(KP500000000), T4, T1);
+		    Tm = VSUB(T3, T2);
+	       }
+	       {
+		    V Tg, Th, Ti, Tj;
+		    Tg = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+		    Th = LDA(&(R1[WS(rs, 3)]), ivs, &(R1[0]));
+		    Ti = LDA(&(R1[WS(rs, 5)]), ivs, &(R1[0]));
+		    Tj = VADD(Th, Ti);
+		    Tk = VFNMS(LDK(KP500000000), Tj, Tg);
+		    Ty = VSUB(Ti, Th);
+		    Tt = VADD(Tg, Tj);
+	       }
+	       {
+		    V T6, T7, T8, T9;
+		    T6 = LDA(&(R0[WS(rs, 3)]), ivs, &(R0[0]));
+		    T7 = LDA(&(R0[WS(rs, 5)]), ivs, &(R0[0]));
+		    T8 = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+		    T9 = VADD(T7, T8);
+		    Ta = VADD(T6, T9);
+		    Tq = VFNMS(LDK(KP500000000), T9, T6);
+		    Tn = VSUB(T8, T7);
+	       }
+	       {
+		    V Tb, Tc, Td, Te;
+		    Tb = LDA(&(R1[WS(rs, 4)]), ivs, &(R1[0]));
+		    Tc = LDA(&(R1[0]), ivs, &(R1[0]));
+		    Td = LDA(&(R1[WS(rs, 2)]), ivs, &(R1[0]));
+		    Te = VADD(Tc, Td);
+		    Tf = VFNMS(LDK(KP500000000), Te, Tb);
+		    Tz = VSUB(Td, Tc);
+		    Tu = VADD(Tb, Te);
+	       }
+	       STA(&(Cr[WS(csr, 3)]), VSUB(T5, Ta), ovs, &(Cr[0]));
+	       STA(&(Ci[WS(csi, 3)]), VSUB(Tt, Tu), ovs, &(Ci[0]));
+	       Tl = VSUB(Tf, Tk);
+	       To = VSUB(Tm, Tn);
+	       STA(&(Ci[WS(csi, 1)]), VFMA(LDK(KP866025403), To, Tl), ovs, &(Ci[0]));
+	       STA(&(Ci[WS(csi, 5)]), VFNMS(LDK(KP866025403), To, Tl), ovs, &(Ci[0]));
+	       {
+		    V Tx, TA, Tv, Tw;
+		    Tx = VSUB(Tp, Tq);
+		    TA = VSUB(Ty, Tz);
+		    STA(&(Cr[WS(csr, 5)]), VFNMS(LDK(KP866025403), TA, Tx), ovs, &(Cr[0]));
+		    STA(&(Cr[WS(csr, 1)]), VFMA(LDK(KP866025403), TA, Tx), ovs, &(Cr[0]));
+		    Tv = VADD(T5, Ta);
+		    Tw = VADD(Tt, Tu);
+		    STA(&(Cr[WS(csr, 6)]), VSUB(Tv, Tw), ovs, &(Cr[0]));
+		    STA(&(Cr[0]), VADD(Tv, Tw), ovs, &(Cr[0]));
+	       }
+	       {
+		    V Tr, Ts, TB, TC;
+		    Tr = VADD(Tp, Tq);
+		    Ts = VADD(Tk, Tf);
+		    STA(&(Cr[WS(csr, 2)]), VSUB(Tr, Ts), ovs, &(Cr[0]));
+		    STA(&(Cr[WS(csr, 4)]), VADD(Tr, Ts), ovs, &(Cr[0]));
+		    TB = VADD(Ty, Tz);
+		    TC = VADD(Tm, Tn);
+		    STA(&(Ci[WS(csi, 2)]), VMUL(LDK(KP866025403), VSUB(TB, TC)), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 4)]), VMUL(LDK(KP866025403), VADD(TC, TB)), ovs, &(Ci[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 12, XSIMD_STRING("r2cfv_12"), {30, 2, 8, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_12) (planner *p) {
+     X(kr2c_register) (p, r2cfv_12, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_12 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -compact -variables 4 -pipeline-latency 4 -n 12 -name r2cf_12 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 38 FP additions, 8 FP multiplications,
+ * (or, 34 additions, 4 multiplications, 4 fused multiply/add),
+ * 21 stack variables, 2 constants, and 24 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_12(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DVK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(48, rs), MAKE_VOLATILE_STRIDE(48, csr), MAKE_VOLATILE_STRIDE(48, csi)) {
+	       V T5, Tp, Tb, Tn, Ty, Tt, Ta, Tq, Tc, Ti, Tz, Tu, Td, To;
+	       {
+		    V T1, T2, T3, T4;
+		    T1 = LDA(&(R0[0]), ivs, &(R0[0]));
+		    T2 = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+		    T3 = LDA(&(R0[WS(rs, 4)]), ivs, &(R0[0]));
+		    T4 = VADD(T2, T3);
+		    T5 = VADD(T1, T4);
+		    Tp = VFNMS(LDK(KP500000000), T4, T1);
+		    Tb = VSUB(T3, T2);
+	       }
+	       {
+		    V Tj, Tk, Tl, Tm;
+		    Tj = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+		    Tk = LDA(&(R1[WS(rs, 3)]), ivs, &(R1[0]));
+		    Tl = LDA(&(R1[WS(rs, 5)]), ivs, &(R1[0]));
+		    Tm = VADD(Tk, Tl);
+		    Tn = VFNMS(LDK(KP500000000), Tm, Tj);
+		    Ty = VSUB(Tl, Tk);
+		    Tt = VADD(Tj, Tm);
+	       }
+	       {
+		    V T6, T7, T8, T9;
+		    T6 = LDA(&(R0[WS(rs, 3)]), ivs, &(R0[0]));
+		    T7 = LDA(&(R0[WS(rs, 5)]), ivs, &(R0[0]));
+		    T8 = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+		    T9 = VADD(T7, T8);
+		    Ta = VADD(T6, T9);
+		    Tq = VFNMS(LDK(KP500000000), T9, T6);
+		    Tc = VSUB(T8, T7);
+	       }
+	       {
+		    V Te, Tf, Tg, Th;
+		    Te = LDA(&(R1[WS(rs, 4)]), ivs, &(R1[0]));
+		    Tf = LDA(&(R1[0]), ivs, &(R1[0]));
+		    Tg = LDA(&(R1[WS(rs, 2)]), ivs, &(R1[0]));
+		    Th = VADD(Tf, Tg);
+		    Ti = VFNMS(LDK(KP500000000), Th, Te);
+		    Tz = VSUB(Tg, Tf);
+		    Tu = VADD(Te, Th);
+	       }
+	       STA(&(Cr[WS(csr, 3)]), VSUB(T5, Ta), ovs, &(Cr[0]));
+	       STA(&(Ci[WS(csi, 3)]), VSUB(Tt, Tu), ovs, &(Ci[0]));
+	       Td = VMUL(LDK(KP866025403), VSUB(Tb, Tc));
+	       To = VSUB(Ti, Tn);
+	       STA(&(Ci[WS(csi, 1)]), VADD(Td, To), ovs, &(Ci[0]));
+	       STA(&(Ci[WS(csi, 5)]), VSUB(To, Td), ovs, &(Ci[0]));
+	       {
+		    V Tx, TA, Tv, Tw;
+		    Tx = VSUB(Tp, Tq);
+		    TA = VMUL(LDK(KP866025403), VSUB(Ty, Tz));
+		    STA(&(Cr[WS(csr, 5)]), VSUB(Tx, TA), ovs, &(Cr[0]));
+		    STA(&(Cr[WS(csr, 1)]), VADD(Tx, TA), ovs, &(Cr[0]));
+		    Tv = VADD(T5, Ta);
+		    Tw = VADD(Tt, Tu);
+		    STA(&(Cr[WS(csr, 6)]), VSUB(Tv, Tw), ovs, &(Cr[0]));
+		    STA(&(Cr[0]), VADD(Tv, Tw), ovs, &(Cr[0]));
+	       }
+	       {
+		    V Tr, Ts, TB, TC;
+		    Tr = VADD(Tp, Tq);
+		    Ts = VADD(Tn, Ti);
+		    STA(&(Cr[WS(csr, 2)]), VSUB(Tr, Ts), ovs, &(Cr[0]));
+		    STA(&(Cr[WS(csr, 4)]), VADD(Tr, Ts), ovs, &(Cr[0]));
+		    TB = VADD(Ty, Tz);
+		    TC = VADD(Tb, Tc);
+		    STA(&(Ci[WS(csi, 2)]), VMUL(LDK(KP866025403), VSUB(TB, TC)), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 4)]), VMUL(LDK(KP866025403), VADD(TC, TB)), ovs, &(Ci[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 12, XSIMD_STRING("r2cfv_12"), {34, 4, 4, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_12) (planner *p) {
+     X(kr2c_register) (p, r2cfv_12, &desc);
+}
+
+#endif
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:06:26 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_16 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -fma -compact -variables 4 -pipeline-latency 4 -n 16 -name r2cf_16 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 58 FP additions, 20 FP multiplications,
+ * (or, 38 additions, 0 multiplications, 20 fused multiply/add),
+ * 34 stack variables, 3 constants, and 32 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_16(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP414213562, +0.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(64, rs), MAKE_VOLATILE_STRIDE(64, csr), MAKE_VOLATILE_STRIDE(64, csi)) {
+	       V T3, T6, T7, TN, TB, Ta, Td, Te, TO, TE, Tm, TT, Ty, TI, Tt;
+	       V TS, Tz, TL, TC, TD, TR, TU;
+	       {
+		    V T1, T2, T4, T5;
+		    T1 = LDA(&(R0[0]), ivs, &(R0[0]));
+		    T2 = LDA(&(R0[WS(rs, 4)]), ivs, &(R0[0]));
+		    T3 = VADD(T1, T2);
+		    T4 = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+		    T5 = LDA(&(R0[WS(rs, 6)]), ivs, &(R0[0]));
+		    T6 = VADD(T4, T5);
+		    T7 = VADD(T3, T6);
+		    TN = VSUB(T4, T5);
+		    TB = VSUB(T1, T2);
+	       }
+	       {
+		    V T8, T9, Tb, Tc;
+		    T8 = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+		    T9 = LDA(&(R0[WS(rs, 5)]), ivs, &(R0[0]));
+		    Ta = VADD(T8, T9);
+		    TC = VSUB(T8, T9);
+		    Tb = LDA(&(R0[WS(rs, 7)]), ivs, &(R0[0]));
+		    Tc = LDA(&(R0[WS(rs, 3)]), ivs, &(R0[0]));
+		    Td = VADD(Tb, Tc);
+		    TD = VSUB(Tb, Tc);
+	       }
+	       Te = VADD(Ta, Td);
+	       TO = VSUB(TD, TC);
+	       TE = VADD(TC, TD);
+	       {
+		    V Ti, TG, Tl, TH;
+		    {
+			 V Tg, Th, Tj, Tk;
+			 Tg = LDA(&(R1[0]), ivs, &(R1[0]));
+			 Th = LDA(&(R1[WS(rs, 4)]), ivs, &(R1[0]));
+			 Ti = VADD(Tg, Th);
+			 TG = VSUB(Tg, Th);
+			 Tj = LDA(&(R1[WS(rs, 2)]), ivs, &(R1[0]));
+			 Tk = LDA(&(R1[WS(rs, 6)]), ivs, &(R1[0]));
+			 Tl = VADD(Tj, Tk);
+			 TH = VSUB(Tj, Tk);
+		    }
+		    Tm = VSUB(Ti, Tl);
+		    TT = VFMA(LDK(KP414213562), TG, TH);
+		    Ty = VADD(Ti, Tl);
+		    TI = VFNMS(LDK(KP414213562), TH, TG);
+	       }
+	       {
+		    V Tp, TJ, Ts, TK;
+		    {
+			 V Tn, To, Tq, Tr;
+			 Tn = LDA(&(R1[WS(rs, 7)]), ivs, &(R1[0]));
+			 To = LDA(&(R1[WS(rs, 3)]), ivs, &(R1[0]));
+			 Tp = VADD(Tn, To);
+			 TJ = VSUB(Tn, To);
+			 Tq = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+			 Tr = LDA(&(R1[WS(rs, 5)]), ivs, &(R1[0]));
+			 Ts = VADD(Tq, Tr);
+			 TK = VSUB(Tr, Tq);
+		    }
+		    Tt = VSUB(Tp, Ts);
+		    TS = VFMA(LDK(KP414213562), TJ, TK);
+		    Tz = VADD(Tp, Ts);
+		    TL = VFNMS(LDK(KP414213562), TK, TJ);
+	       }
+	       STA(&(Cr[WS(csr, 4)]), VSUB(T7, Te), ovs, &(Cr[0]));
+	       STA(&(Ci[WS(csi, 4)]), VSUB(Tz, Ty), ovs, &(Ci[0]));
+	       {
+		    V Tf, Tu, Tv, Tw;
+		    Tf = VSUB(T3, T6);
+		    Tu = VADD(Tm, Tt);
+		    STA(&(Cr[WS(csr, 6)]), VFNMS(LDK(KP707106781), Tu, Tf), ovs, &(Cr[0]));
+		    STA(&(Cr[WS(csr, 2)]), VFMA(LDK(KP707106781), Tu, Tf), ovs, &(Cr[0]));
+		    Tv = VSUB(Td, Ta);
+		    Tw = VSUB(Tt, Tm);
+		    STA(&(Ci[WS(csi, 2)]), VFMA(LDK(KP707106781), Tw, Tv), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 6)]), VFMS(LDK(KP707106781), Tw, Tv), ovs, &(Ci[0]));
+	       }
+	       {
+		    V Tx, TA, TF, TM;
+		    Tx = VADD(T7, Te);
+		    TA = VADD(Ty, Tz);
+		    STA(&(Cr[WS(csr, 8)]), VSUB(Tx, TA), ovs, &(Cr[0]));
+		    STA(&(Cr[0]), VADD(Tx, TA), ovs, &(Cr[0]));
+		    TF = VFMA(LDK(KP707106781), TE, TB);
+		    TM = VADD(TI, TL);
+		    STA(&(Cr[WS(csr, 7)]), VFNMS(LDK(KP923879532), TM, TF), ovs, &(Cr[0]));
+		    STA(&(Cr[WS(csr, 1)]), VFMA(LDK(KP923879532), TM, TF), ovs, &(Cr[0]));
+	       }
+	       TR = VFNMS(LDK(KP707106781), TO, TN);
+	       TU = VSUB(TS, TT);
+	       STA(&(Ci[WS(csi, 1)]), VFMS(LDK(KP923879532), TU, TR), ovs, &(Ci[0]));
+	       STA(&(Ci[WS(csi, 7)]), VFMA(LDK(KP923879532), TU, TR), ovs, &(Ci[0]));
+	       {
+		    V TV, TW, TP, TQ;
+		    TV = VFNMS(LDK(KP707106781), TE, TB);
+		    TW = VADD(TT, TS);
+		    STA(&(Cr[WS(csr, 5)]), VFNMS(LDK(KP923879532), TW, TV), ovs, &(Cr[0]));
+		    STA(&(Cr[WS(csr, 3)]), VFMA(LDK(KP923879532), TW, TV), ovs, &(Cr[0]));
+		    TP = VFMA(LDK(KP707106781), TO, TN);
+		    TQ = VSUB(TL, TI);
+		    STA(&(Ci[WS(csi, 3)]), VFMA(LDK(KP923879532), TQ, TP), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 5)]), VFMS(LDK(KP923879532), TQ, TP), ovs, &(Ci[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 16, XSIMD_STRING("r2cfv_16"), {38, 0, 20, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_16) (planner *p) {
+     X(kr2c_register) (p, r2cfv_16, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_16 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -compact -variables 4 -pipeline-latency 4 -n 16 -name r2cf_16 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 58 FP additions, 12 FP multiplications,
+ * (or, 54 additions, 8 multiplications, 4 fused multiply/add),
+ * 34 stack variables, 3 constants, and 32 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_16(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(64, rs), MAKE_VOLATILE_STRIDE(64, csr), MAKE_VOLATILE_STRIDE(64, csi)) {
+	       V T3, T6, T7, Tz, Ti, Ta, Td, Te, TA, Th, Tq, TV, TF, TP, Tx;
+	       V TU, TE, TM, Tg, Tf, TJ, TQ;
+	       {
+		    V T1, T2, T4, T5;
+		    T1 = LDA(&(R0[0]), ivs, &(R0[0]));
+		    T2 = LDA(&(R0[WS(rs, 4)]), ivs, &(R0[0]));
+		    T3 = VADD(T1, T2);
+		    T4 = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+		    T5 = LDA(&(R0[WS(rs, 6)]), ivs, &(R0[0]));
+		    T6 = VADD(T4, T5);
+		    T7 = VADD(T3, T6);
+		    Tz = VSUB(T1, T2);
+		    Ti = VSUB(T4, T5);
+	       }
+	       {
+		    V T8, T9, Tb, Tc;
+		    T8 = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+		    T9 = LDA(&(R0[WS(rs, 5)]), ivs, &(R0[0]));
+		    Ta = VADD(T8, T9);
+		    Tg = VSUB(T8, T9);
+		    Tb = LDA(&(R0[WS(rs, 7)]), ivs, &(R0[0]));
+		    Tc = LDA(&(R0[WS(rs, 3)]), ivs, &(R0[0]));
+		    Td = VADD(Tb, Tc);
+		    Tf = VSUB(Tb, Tc);
+	       }
+	       Te = VADD(Ta, Td);
+	       TA = VMUL(LDK(KP707106781), VADD(Tg, Tf));
+	       Th = VMUL(LDK(KP707106781), VSUB(Tf, Tg));
+	       {
+		    V Tm, TN, Tp, TO;
+		    {
+			 V Tk, Tl, Tn, To;
+			 Tk = LDA(&(R1[WS(rs, 7)]), ivs, &(R1[0]));
+			 Tl = LDA(&(R1[WS(rs, 3)]), ivs, &(R1[0]));
+			 Tm = VSUB(Tk, Tl);
+			 TN = VADD(Tk, Tl);
+			 Tn = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+			 To = LDA(&(R1[WS(rs, 5)]), ivs, &(R1[0]));
+			 Tp = VSUB(Tn, To);
+			 TO = VADD(Tn, To);
+		    }
+		    Tq = VFNMS(LDK(KP923879532), Tp, VMUL(LDK(KP382683432), Tm));
+		    TV = VADD(TN, TO);
+		    TF = VFMA(LDK(KP923879532), Tm, VMUL(LDK(KP382683432), Tp));
+		    TP = VSUB(TN, TO);
+	       }
+	       {
+		    V Tt, TK, Tw, TL;
+		    {
+			 V Tr, Ts, Tu, Tv;
+			 Tr = LDA(&(R1[0]), ivs, &(R1[0]));
+			 Ts = LDA(&(R1[WS(rs, 4)]), ivs, &(R1[0]));
+			 Tt = VSUB(Tr, Ts);
+			 TK = VADD(Tr, Ts);
+			 Tu = LDA(&(R1[WS(rs, 2)]), ivs, &(R1[0]));
+			 Tv = LDA(&(R1[WS(rs, 6)]), ivs, &(R1[0]));
+			 Tw = VSUB(Tu, Tv);
+			 TL = VADD(Tu, Tv);
+		    }
+		    Tx = VFMA(LDK(KP382683432), Tt, VMUL(LDK(KP923879532), Tw));
+		    TU = VADD(TK, TL);
+		    TE = VFNMS(LDK(KP382683432), Tw, VMUL(LDK(KP923879532), Tt));
+		    TM = VSUB(TK, TL);
+	       }
+	       STA(&(Cr[WS(csr, 4)]), VSUB(T7, Te), ovs, &(Cr[0]));
+	       STA(&(Ci[WS(csi, 4)]), VSUB(TV, TU), ovs, &(Ci[0]));
+	       {
+		    V Tj, Ty, TD, TG;
+		    Tj = VSUB(Th, Ti);
+		    Ty = VSUB(Tq, Tx);
+		    STA(&(Ci[WS(csi, 1)]), VADD(Tj, Ty), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 7)]), VSUB(Ty, Tj), ovs, &(Ci[0]));
+		    TD = VADD(Tz, TA);
+		    TG = VADD(TE, TF);
+		    STA(&(Cr[WS(csr, 7)]), VSUB(TD, TG), ovs, &(Cr[0]));
+		    STA(&(Cr[WS(csr, 1)]), VADD(TD, TG), ovs, &(Cr[0]));
+	       }
+	       {
+		    V TB, TC, TH, TI;
+		    TB = VSUB(Tz, TA);
+		    TC = VADD(Tx, Tq);
+		    STA(&(Cr[WS(csr, 5)]), VSUB(TB, TC), ovs, &(Cr[0]));
+		    STA(&(Cr[WS(csr, 3)]), VADD(TB, TC), ovs, &(Cr[0]));
+		    TH = VADD(Ti, Th);
+		    TI = VSUB(TF, TE);
+		    STA(&(Ci[WS(csi, 3)]), VADD(TH, TI), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 5)]), VSUB(TI, TH), ovs, &(Ci[0]));
+	       }
+	       TJ = VSUB(T3, T6);
+	       TQ = VMUL(LDK(KP707106781), VADD(TM, TP));
+	       STA(&(Cr[WS(csr, 6)]), VSUB(TJ, TQ), ovs, &(Cr[0]));
+	       STA(&(Cr[WS(csr, 2)]), VADD(TJ, TQ), ovs, &(Cr[0]));
+	       {
+		    V TR, TS, TT, TW;
+		    TR = VSUB(Td, Ta);
+		    TS = VMUL(LDK(KP707106781), VSUB(TP, TM));
+		    STA(&(Ci[WS(csi, 2)]), VADD(TR, TS), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 6)]), VSUB(TS, TR), ovs, &(Ci[0]));
+		    TT = VADD(T7, Te);
+		    TW = VADD(TU, TV);
+		    STA(&(Cr[WS(csr, 8)]), VSUB(TT, TW), ovs, &(Cr[0]));
+		    STA(&(Cr[0]), VADD(TT, TW), ovs, &(Cr[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 16, XSIMD_STRING("r2cfv_16"), {54, 8, 4, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_16) (planner *p) {
+     X(kr2c_register) (p, r2cfv_16, &desc);
+}
+
+#endif
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:06:26 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_3 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -fma -compact -variables 4 -pipeline-latency 4 -n 3 -name r2cf_3 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 4 FP additions, 2 FP multiplications,
+ * (or, 3 additions, 1 multiplications, 1 fused multiply/add),
+ * 7 stack variables, 2 constants, and 6 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_3(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DVK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(12, rs), MAKE_VOLATILE_STRIDE(12, csr), MAKE_VOLATILE_STRIDE(12, csi)) {
+	       V T1, T2, T3, T4;
+	       T1 = LDA(&(R0[0]), ivs, &(R0[0]));
+	       T2 = LDA(&(R1[0]), ivs, &(R1[0]));
+	       T3 = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+	       T4 = VADD(T2, T3);
+	       STA(&(Cr[WS(csr, 1)]), VFNMS(LDK(KP500000000), T4, T1), ovs, &(Cr[0]));
+	       STA(&(Ci[WS(csi, 1)]), VMUL(LDK(KP866025403), VSUB(T3, T2)), ovs, &(Ci[0]));
+	       STA(&(Cr[0]), VADD(T1, T4), ovs, &(Cr[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 3, XSIMD_STRING("r2cfv_3"), {3, 1, 1, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_3) (planner *p) {
+     X(kr2c_register) (p, r2cfv_3, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_3 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -compact -variables 4 -pipeline-latency 4 -n 3 -name r2cf_3 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 4 FP additions, 2 FP multiplications,
+ * (or, 3 additions, 1 multiplications, 1 fused multiply/add),
+ * 7 stack variables, 2 constants, and 6 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_3(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DVK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(12, rs), MAKE_VOLATILE_STRIDE(12, csr), MAKE_VOLATILE_STRIDE(12, csi)) {
+	       V T1, T2, T3, T4;
+	       T1 = LDA(&(R0[0]), ivs, &(R0[0]));
+	       T2 = LDA(&(R1[0]), ivs, &(R1[0]));
+	       T3 = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+	       T4 = VADD(T2, T3);
+	       STA(&(Cr[WS(csr, 1)]), VFNMS(LDK(KP500000000), T4, T1), ovs, &(Cr[0]));
+	       STA(&(Ci[WS(csi, 1)]), VMUL(LDK(KP866025403), VSUB(T3, T2)), ovs, &(Ci[0]));
+	       STA(&(Cr[0]), VADD(T1, T4), ovs, &(Cr[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 3, XSIMD_STRING("r2cfv_3"), {3, 1, 1, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_3) (planner *p) {
+     X(kr2c_register) (p, r2cfv_3, &desc);
+}
+
+#endif
@@ -0,0 +1,614 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:06:27 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_32 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -fma -compact -variables 4 -pipeline-latency 4 -n 32 -name r2cf_32 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 156 FP additions, 68 FP multiplications,
+ * (or, 88 additions, 0 multiplications, 68 fused multiply/add),
+ * 54 stack variables, 7 constants, and 64 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_32(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP668178637, +0.668178637919298919997757686523080761552472251);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP198912367, +0.198912367379658006911597622644676228597850501);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DVK(KP414213562, +0.414213562373095048801688724209698078569671875);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(128, rs), MAKE_VOLATILE_STRIDE(128, csr), MAKE_VOLATILE_STRIDE(128, csi)) {
+	       V T7, T2b, Tv, T1h, Te, T2n, Ty, T1i, Tt, T2d, TF, T1l, Tm, T2c, TC;
+	       V T1k, T1Z, T22, T2k, T2j, T1e, T1C, T19, T1B, T1S, T1V, T2h, T2g, TX, T1z;
+	       V TS, T1y;
+	       {
+		    V T1, T2, T3, T4, T5, T6;
+		    T1 = LDA(&(R0[0]), ivs, &(R0[0]));
+		    T2 = LDA(&(R0[WS(rs, 8)]), ivs, &(R0[0]));
+		    T3 = VADD(T1, T2);
+		    T4 = LDA(&(R0[WS(rs, 4)]), ivs, &(R0[0]));
+		    T5 = LDA(&(R0[WS(rs, 12)]), ivs, &(R0[0]));
+		    T6 = VADD(T4, T5);
+		    T7 = VADD(T3, T6);
+		    T2b = VSUB(T3, T6);
+		    Tv = VSUB(T1, T2);
+		    T1h = VSUB(T4, T5);
+	       }
+	       {
+		    V Ta, Tw, Td, Tx;
+		    {
+			 V T8, T9, Tb, Tc;
+			 T8 = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+			 T9 = LDA(&(R0[WS(rs, 10)]), ivs, &(R0[0]));
+			 Ta = VADD(T8, T9);
+			 Tw = VSUB(T8, T9);
+			 Tb = LDA(&(R0[WS(rs, 14)]), ivs, &(R0[0]));
+			 Tc = LDA(&(R0[WS(rs, 6)]), ivs, &(R0[0]));
+			 Td = VADD(Tb, Tc);
+			 Tx = VSUB(Tb, Tc);
+		    }
+		    Te = VADD(Ta, Td);
+		    T2n = VSUB(Td, Ta);
+		    Ty = VADD(Tw, Tx);
+		    T1i = VSUB(Tx, Tw);
+	       }
+	       {
+		    V Tp, TD, Ts, TE;
+		    {
+			 V Tn, To, Tq, Tr;
+			 Tn = LDA(&(R0[WS(rs, 15)]), ivs, &(R0[0]));
+			 To = LDA(&(R0[WS(rs, 7)]), ivs, &(R0[0]));
+			 Tp = VADD(Tn, To);
+			 TD = VSUB(Tn, To);
+			 Tq = LDA(&(R0[WS(rs, 3)]), ivs, &(R0[0]));
+			 Tr = LDA(&(R0[WS(rs, 11)]), ivs, &(R0[0]));
+			 Ts = VADD(Tq, Tr);
+			 TE = VSUB(Tq, Tr);
+		    }
+		    Tt = VADD(Tp, Ts);
+		    T2d = VSUB(Tp, Ts);
+		    TF = VFMA(LDK(KP414213562), TE, TD);
+		    T1l = VFNMS(LDK(KP414213562), TD, TE);
+	       }
+	       {
+		    V Ti, TA, Tl, TB;
+		    {
+			 V Tg, Th, Tj, Tk;
+			 Tg = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+			 Th = LDA(&(R0[WS(rs, 9)]), ivs, &(R0[0]));
+			 Ti = VADD(Tg, Th);
+			 TA = VSUB(Tg, Th);
+			 Tj = LDA(&(R0[WS(rs, 5)]), ivs, &(R0[0]));
+			 Tk = LDA(&(R0[WS(rs, 13)]), ivs, &(R0[0]));
+			 Tl = VADD(Tj, Tk);
+			 TB = VSUB(Tj, Tk);
+		    }
+		    Tm = VADD(Ti, Tl);
+		    T2c = VSUB(Ti, Tl);
+		    TC = VFNMS(LDK(KP414213562), TB, TA);
+		    T1k = VFMA(LDK(KP414213562), TA, TB);
+	       }
+	       {
+		    V T11, T1X, T1c, T1Y, T14, T20, T17, T21, T1d, T18;
+		    {
+			 V TZ, T10, T1a, T1b;
+			 TZ = LDA(&(R1[WS(rs, 15)]), ivs, &(R1[0]));
+			 T10 = LDA(&(R1[WS(rs, 7)]), ivs, &(R1[0]));
+			 T11 = VSUB(TZ, T10);
+			 T1X = VADD(TZ, T10);
+			 T1a = LDA(&(R1[WS(rs, 11)]), ivs, &(R1[0]));
+			 T1b = LDA(&(R1[WS(rs, 3)]), ivs, &(R1[0]));
+			 T1c = VSUB(T1a, T1b);
+			 T1Y = VADD(T1b, T1a);
+		    }
+		    {
+			 V T12, T13, T15, T16;
+			 T12 = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+			 T13 = LDA(&(R1[WS(rs, 9)]), ivs, &(R1[0]));
+			 T14 = VSUB(T12, T13);
+			 T20 = VADD(T12, T13);
+			 T15 = LDA(&(R1[WS(rs, 13)]), ivs, &(R1[0]));
+			 T16 = LDA(&(R1[WS(rs, 5)]), ivs, &(R1[0]));
+			 T17 = VSUB(T15, T16);
+			 T21 = VADD(T15, T16);
+		    }
+		    T1Z = VADD(T1X, T1Y);
+		    T22 = VADD(T20, T21);
+		    T2k = VSUB(T21, T20);
+		    T2j = VSUB(T1X, T1Y);
+		    T1d = VSUB(T17, T14);
+		    T1e = VFMA(LDK(KP707106781), T1d, T1c);
+		    T1C = VFNMS(LDK(KP707106781), T1d, T1c);
+		    T18 = VADD(T14, T17);
+		    T19 = VFMA(LDK(KP707106781), T18, T11);
+		    T1B = VFNMS(LDK(KP707106781), T18, T11);
+	       }
+	       {
+		    V TK, T1Q, TV, T1R, TN, T1T, TQ, T1U, TW, TR;
+		    {
+			 V TI, TJ, TT, TU;
+			 TI = LDA(&(R1[0]), ivs, &(R1[0]));
+			 TJ = LDA(&(R1[WS(rs, 8)]), ivs, &(R1[0]));
+			 TK = VSUB(TI, TJ);
+			 T1Q = VADD(TI, TJ);
+			 TT = LDA(&(R1[WS(rs, 4)]), ivs, &(R1[0]));
+			 TU = LDA(&(R1[WS(rs, 12)]), ivs, &(R1[0]));
+			 TV = VSUB(TT, TU);
+			 T1R = VADD(TT, TU);
+		    }
+		    {
+			 V TL, TM, TO, TP;
+			 TL = LDA(&(R1[WS(rs, 2)]), ivs, &(R1[0]));
+			 TM = LDA(&(R1[WS(rs, 10)]), ivs, &(R1[0]));
+			 TN = VSUB(TL, TM);
+			 T1T = VADD(TL, TM);
+			 TO = LDA(&(R1[WS(rs, 14)]), ivs, &(R1[0]));
+			 TP = LDA(&(R1[WS(rs, 6)]), ivs, &(R1[0]));
+			 TQ = VSUB(TO, TP);
+			 T1U = VADD(TO, TP);
+		    }
+		    T1S = VADD(T1Q, T1R);
+		    T1V = VADD(T1T, T1U);
+		    T2h = VSUB(T1U, T1T);
+		    T2g = VSUB(T1Q, T1R);
+		    TW = VSUB(TN, TQ);
+		    TX = VFMA(LDK(KP707106781), TW, TV);
+		    T1z = VFNMS(LDK(KP707106781), TW, TV);
+		    TR = VADD(TN, TQ);
+		    TS = VFMA(LDK(KP707106781), TR, TK);
+		    T1y = VFNMS(LDK(KP707106781), TR, TK);
+	       }
+	       {
+		    V Tf, Tu, T27, T28, T29, T2a;
+		    Tf = VADD(T7, Te);
+		    Tu = VADD(Tm, Tt);
+		    T27 = VADD(Tf, Tu);
+		    T28 = VADD(T1S, T1V);
+		    T29 = VADD(T1Z, T22);
+		    T2a = VADD(T28, T29);
+		    STA(&(Cr[WS(csr, 8)]), VSUB(Tf, Tu), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 8)]), VSUB(T29, T28), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 16)]), VSUB(T27, T2a), ovs, &(Cr[0]));
+		    STA(&(Cr[0]), VADD(T27, T2a), ovs, &(Cr[0]));
+	       }
+	       {
+		    V T1P, T25, T24, T26, T1W, T23;
+		    T1P = VSUB(T7, Te);
+		    T25 = VSUB(Tt, Tm);
+		    T1W = VSUB(T1S, T1V);
+		    T23 = VSUB(T1Z, T22);
+		    T24 = VADD(T1W, T23);
+		    T26 = VSUB(T23, T1W);
+		    STA(&(Cr[WS(csr, 12)]), VFNMS(LDK(KP707106781), T24, T1P), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 12)]), VFMS(LDK(KP707106781), T26, T25), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 4)]), VFMA(LDK(KP707106781), T24, T1P), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 4)]), VFMA(LDK(KP707106781), T26, T25), ovs, &(Ci[0]));
+	       }
+	       {
+		    V T2f, T2v, T2p, T2r, T2m, T2q, T2u, T2w, T2e, T2o;
+		    T2e = VADD(T2c, T2d);
+		    T2f = VFMA(LDK(KP707106781), T2e, T2b);
+		    T2v = VFNMS(LDK(KP707106781), T2e, T2b);
+		    T2o = VSUB(T2d, T2c);
+		    T2p = VFNMS(LDK(KP707106781), T2o, T2n);
+		    T2r = VFMA(LDK(KP707106781), T2o, T2n);
+		    {
+			 V T2i, T2l, T2s, T2t;
+			 T2i = VFMA(LDK(KP414213562), T2h, T2g);
+			 T2l = VFNMS(LDK(KP414213562), T2k, T2j);
+			 T2m = VADD(T2i, T2l);
+			 T2q = VSUB(T2l, T2i);
+			 T2s = VFNMS(LDK(KP414213562), T2g, T2h);
+			 T2t = VFMA(LDK(KP414213562), T2j, T2k);
+			 T2u = VADD(T2s, T2t);
+			 T2w = VSUB(T2t, T2s);
+		    }
+		    STA(&(Cr[WS(csr, 14)]), VFNMS(LDK(KP923879532), T2m, T2f), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 14)]), VFMS(LDK(KP923879532), T2u, T2r), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 2)]), VFMA(LDK(KP923879532), T2m, T2f), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 2)]), VFMA(LDK(KP923879532), T2u, T2r), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 6)]), VFMS(LDK(KP923879532), T2q, T2p), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 6)]), VFMA(LDK(KP923879532), T2w, T2v), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 10)]), VFMA(LDK(KP923879532), T2q, T2p), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 10)]), VFNMS(LDK(KP923879532), T2w, T2v), ovs, &(Cr[0]));
+	       }
+	       {
+		    V TH, T1t, T1s, T1u, T1g, T1o, T1n, T1p;
+		    {
+			 V Tz, TG, T1q, T1r;
+			 Tz = VFMA(LDK(KP707106781), Ty, Tv);
+			 TG = VADD(TC, TF);
+			 TH = VFMA(LDK(KP923879532), TG, Tz);
+			 T1t = VFNMS(LDK(KP923879532), TG, Tz);
+			 T1q = VFMA(LDK(KP198912367), T19, T1e);
+			 T1r = VFMA(LDK(KP198912367), TS, TX);
+			 T1s = VSUB(T1q, T1r);
+			 T1u = VADD(T1r, T1q);
+		    }
+		    {
+			 V TY, T1f, T1j, T1m;
+			 TY = VFNMS(LDK(KP198912367), TX, TS);
+			 T1f = VFNMS(LDK(KP198912367), T1e, T19);
+			 T1g = VADD(TY, T1f);
+			 T1o = VSUB(T1f, TY);
+			 T1j = VFNMS(LDK(KP707106781), T1i, T1h);
+			 T1m = VADD(T1k, T1l);
+			 T1n = VFNMS(LDK(KP923879532), T1m, T1j);
+			 T1p = VFMA(LDK(KP923879532), T1m, T1j);
+		    }
+		    STA(&(Cr[WS(csr, 15)]), VFNMS(LDK(KP980785280), T1g, TH), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 15)]), VFMA(LDK(KP980785280), T1s, T1p), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 1)]), VFMA(LDK(KP980785280), T1g, TH), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 1)]), VFMS(LDK(KP980785280), T1s, T1p), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 7)]), VFMA(LDK(KP980785280), T1o, T1n), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 7)]), VFMA(LDK(KP980785280), T1u, T1t), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 9)]), VFMS(LDK(KP980785280), T1o, T1n), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 9)]), VFNMS(LDK(KP980785280), T1u, T1t), ovs, &(Cr[0]));
+	       }
+	       {
+		    V T1x, T1N, T1M, T1O, T1E, T1I, T1H, T1J;
+		    {
+			 V T1v, T1w, T1K, T1L;
+			 T1v = VFNMS(LDK(KP707106781), Ty, Tv);
+			 T1w = VSUB(T1k, T1l);
+			 T1x = VFMA(LDK(KP923879532), T1w, T1v);
+			 T1N = VFNMS(LDK(KP923879532), T1w, T1v);
+			 T1K = VFNMS(LDK(KP668178637), T1y, T1z);
+			 T1L = VFNMS(LDK(KP668178637), T1B, T1C);
+			 T1M = VSUB(T1K, T1L);
+			 T1O = VADD(T1K, T1L);
+		    }
+		    {
+			 V T1A, T1D, T1F, T1G;
+			 T1A = VFMA(LDK(KP668178637), T1z, T1y);
+			 T1D = VFMA(LDK(KP668178637), T1C, T1B);
+			 T1E = VADD(T1A, T1D);
+			 T1I = VSUB(T1D, T1A);
+			 T1F = VFMA(LDK(KP707106781), T1i, T1h);
+			 T1G = VSUB(TF, TC);
+			 T1H = VFNMS(LDK(KP923879532), T1G, T1F);
+			 T1J = VFMA(LDK(KP923879532), T1G, T1F);
+		    }
+		    STA(&(Cr[WS(csr, 13)]), VFNMS(LDK(KP831469612), T1E, T1x), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 13)]), VFMS(LDK(KP831469612), T1M, T1J), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 3)]), VFMA(LDK(KP831469612), T1E, T1x), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 3)]), VFMA(LDK(KP831469612), T1M, T1J), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 5)]), VFMS(LDK(KP831469612), T1I, T1H), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 5)]), VFNMS(LDK(KP831469612), T1O, T1N), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 11)]), VFMA(LDK(KP831469612), T1I, T1H), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 11)]), VFMA(LDK(KP831469612), T1O, T1N), ovs, &(Cr[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 32, XSIMD_STRING("r2cfv_32"), {88, 0, 68, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_32) (planner *p) {
+     X(kr2c_register) (p, r2cfv_32, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_32 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -compact -variables 4 -pipeline-latency 4 -n 32 -name r2cf_32 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 156 FP additions, 42 FP multiplications,
+ * (or, 140 additions, 26 multiplications, 16 fused multiply/add),
+ * 54 stack variables, 7 constants, and 64 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_32(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(128, rs), MAKE_VOLATILE_STRIDE(128, csr), MAKE_VOLATILE_STRIDE(128, csi)) {
+	       V T7, T2b, Tv, T1l, Te, T2o, Ty, T1k, Tt, T2d, TF, T1h, Tm, T2c, TC;
+	       V T1i, T1Z, T22, T2k, T2j, T1e, T1C, T19, T1B, T1S, T1V, T2h, T2g, TX, T1z;
+	       V TS, T1y;
+	       {
+		    V T1, T2, T3, T4, T5, T6;
+		    T1 = LDA(&(R0[0]), ivs, &(R0[0]));
+		    T2 = LDA(&(R0[WS(rs, 8)]), ivs, &(R0[0]));
+		    T3 = VADD(T1, T2);
+		    T4 = LDA(&(R0[WS(rs, 4)]), ivs, &(R0[0]));
+		    T5 = LDA(&(R0[WS(rs, 12)]), ivs, &(R0[0]));
+		    T6 = VADD(T4, T5);
+		    T7 = VADD(T3, T6);
+		    T2b = VSUB(T3, T6);
+		    Tv = VSUB(T1, T2);
+		    T1l = VSUB(T4, T5);
+	       }
+	       {
+		    V Ta, Tw, Td, Tx;
+		    {
+			 V T8, T9, Tb, Tc;
+			 T8 = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+			 T9 = LDA(&(R0[WS(rs, 10)]), ivs, &(R0[0]));
+			 Ta = VADD(T8, T9);
+			 Tw = VSUB(T8, T9);
+			 Tb = LDA(&(R0[WS(rs, 14)]), ivs, &(R0[0]));
+			 Tc = LDA(&(R0[WS(rs, 6)]), ivs, &(R0[0]));
+			 Td = VADD(Tb, Tc);
+			 Tx = VSUB(Tb, Tc);
+		    }
+		    Te = VADD(Ta, Td);
+		    T2o = VSUB(Td, Ta);
+		    Ty = VMUL(LDK(KP707106781), VADD(Tw, Tx));
+		    T1k = VMUL(LDK(KP707106781), VSUB(Tx, Tw));
+	       }
+	       {
+		    V Tp, TD, Ts, TE;
+		    {
+			 V Tn, To, Tq, Tr;
+			 Tn = LDA(&(R0[WS(rs, 15)]), ivs, &(R0[0]));
+			 To = LDA(&(R0[WS(rs, 7)]), ivs, &(R0[0]));
+			 Tp = VADD(Tn, To);
+			 TD = VSUB(Tn, To);
+			 Tq = LDA(&(R0[WS(rs, 3)]), ivs, &(R0[0]));
+			 Tr = LDA(&(R0[WS(rs, 11)]), ivs, &(R0[0]));
+			 Ts = VADD(Tq, Tr);
+			 TE = VSUB(Tq, Tr);
+		    }
+		    Tt = VADD(Tp, Ts);
+		    T2d = VSUB(Tp, Ts);
+		    TF = VFMA(LDK(KP923879532), TD, VMUL(LDK(KP382683432), TE));
+		    T1h = VFNMS(LDK(KP923879532), TE, VMUL(LDK(KP382683432), TD));
+	       }
+	       {
+		    V Ti, TA, Tl, TB;
+		    {
+			 V Tg, Th, Tj, Tk;
+			 Tg = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+			 Th = LDA(&(R0[WS(rs, 9)]), ivs, &(R0[0]));
+			 Ti = VADD(Tg, Th);
+			 TA = VSUB(Tg, Th);
+			 Tj = LDA(&(R0[WS(rs, 5)]), ivs, &(R0[0]));
+			 Tk = LDA(&(R0[WS(rs, 13)]), ivs, &(R0[0]));
+			 Tl = VADD(Tj, Tk);
+			 TB = VSUB(Tj, Tk);
+		    }
+		    Tm = VADD(Ti, Tl);
+		    T2c = VSUB(Ti, Tl);
+		    TC = VFNMS(LDK(KP382683432), TB, VMUL(LDK(KP923879532), TA));
+		    T1i = VFMA(LDK(KP382683432), TA, VMUL(LDK(KP923879532), TB));
+	       }
+	       {
+		    V T11, T1X, T1d, T1Y, T14, T20, T17, T21, T1a, T18;
+		    {
+			 V TZ, T10, T1b, T1c;
+			 TZ = LDA(&(R1[WS(rs, 15)]), ivs, &(R1[0]));
+			 T10 = LDA(&(R1[WS(rs, 7)]), ivs, &(R1[0]));
+			 T11 = VSUB(TZ, T10);
+			 T1X = VADD(TZ, T10);
+			 T1b = LDA(&(R1[WS(rs, 3)]), ivs, &(R1[0]));
+			 T1c = LDA(&(R1[WS(rs, 11)]), ivs, &(R1[0]));
+			 T1d = VSUB(T1b, T1c);
+			 T1Y = VADD(T1b, T1c);
+		    }
+		    {
+			 V T12, T13, T15, T16;
+			 T12 = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+			 T13 = LDA(&(R1[WS(rs, 9)]), ivs, &(R1[0]));
+			 T14 = VSUB(T12, T13);
+			 T20 = VADD(T12, T13);
+			 T15 = LDA(&(R1[WS(rs, 13)]), ivs, &(R1[0]));
+			 T16 = LDA(&(R1[WS(rs, 5)]), ivs, &(R1[0]));
+			 T17 = VSUB(T15, T16);
+			 T21 = VADD(T15, T16);
+		    }
+		    T1Z = VADD(T1X, T1Y);
+		    T22 = VADD(T20, T21);
+		    T2k = VSUB(T21, T20);
+		    T2j = VSUB(T1X, T1Y);
+		    T1a = VMUL(LDK(KP707106781), VSUB(T17, T14));
+		    T1e = VSUB(T1a, T1d);
+		    T1C = VADD(T1d, T1a);
+		    T18 = VMUL(LDK(KP707106781), VADD(T14, T17));
+		    T19 = VADD(T11, T18);
+		    T1B = VSUB(T11, T18);
+	       }
+	       {
+		    V TK, T1Q, TW, T1R, TN, T1T, TQ, T1U, TT, TR;
+		    {
+			 V TI, TJ, TU, TV;
+			 TI = LDA(&(R1[0]), ivs, &(R1[0]));
+			 TJ = LDA(&(R1[WS(rs, 8)]), ivs, &(R1[0]));
+			 TK = VSUB(TI, TJ);
+			 T1Q = VADD(TI, TJ);
+			 TU = LDA(&(R1[WS(rs, 4)]), ivs, &(R1[0]));
+			 TV = LDA(&(R1[WS(rs, 12)]), ivs, &(R1[0]));
+			 TW = VSUB(TU, TV);
+			 T1R = VADD(TU, TV);
+		    }
+		    {
+			 V TL, TM, TO, TP;
+			 TL = LDA(&(R1[WS(rs, 2)]), ivs, &(R1[0]));
+			 TM = LDA(&(R1[WS(rs, 10)]), ivs, &(R1[0]));
+			 TN = VSUB(TL, TM);
+			 T1T = VADD(TL, TM);
+			 TO = LDA(&(R1[WS(rs, 14)]), ivs, &(R1[0]));
+			 TP = LDA(&(R1[WS(rs, 6)]), ivs, &(R1[0]));
+			 TQ = VSUB(TO, TP);
+			 T1U = VADD(TO, TP);
+		    }
+		    T1S = VADD(T1Q, T1R);
+		    T1V = VADD(T1T, T1U);
+		    T2h = VSUB(T1U, T1T);
+		    T2g = VSUB(T1Q, T1R);
+		    TT = VMUL(LDK(KP707106781), VSUB(TQ, TN));
+		    TX = VSUB(TT, TW);
+		    T1z = VADD(TW, TT);
+		    TR = VMUL(LDK(KP707106781), VADD(TN, TQ));
+		    TS = VADD(TK, TR);
+		    T1y = VSUB(TK, TR);
+	       }
+	       {
+		    V Tf, Tu, T27, T28, T29, T2a;
+		    Tf = VADD(T7, Te);
+		    Tu = VADD(Tm, Tt);
+		    T27 = VADD(Tf, Tu);
+		    T28 = VADD(T1S, T1V);
+		    T29 = VADD(T1Z, T22);
+		    T2a = VADD(T28, T29);
+		    STA(&(Cr[WS(csr, 8)]), VSUB(Tf, Tu), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 8)]), VSUB(T29, T28), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 16)]), VSUB(T27, T2a), ovs, &(Cr[0]));
+		    STA(&(Cr[0]), VADD(T27, T2a), ovs, &(Cr[0]));
+	       }
+	       {
+		    V T1P, T25, T24, T26, T1W, T23;
+		    T1P = VSUB(T7, Te);
+		    T25 = VSUB(Tt, Tm);
+		    T1W = VSUB(T1S, T1V);
+		    T23 = VSUB(T1Z, T22);
+		    T24 = VMUL(LDK(KP707106781), VADD(T1W, T23));
+		    T26 = VMUL(LDK(KP707106781), VSUB(T23, T1W));
+		    STA(&(Cr[WS(csr, 12)]), VSUB(T1P, T24), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 12)]), VSUB(T26, T25), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 4)]), VADD(T1P, T24), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 4)]), VADD(T25, T26), ovs, &(Ci[0]));
+	       }
+	       {
+		    V T2f, T2v, T2p, T2r, T2m, T2q, T2u, T2w, T2e, T2n;
+		    T2e = VMUL(LDK(KP707106781), VADD(T2c, T2d));
+		    T2f = VADD(T2b, T2e);
+		    T2v = VSUB(T2b, T2e);
+		    T2n = VMUL(LDK(KP707106781), VSUB(T2d, T2c));
+		    T2p = VSUB(T2n, T2o);
+		    T2r = VADD(T2o, T2n);
+		    {
+			 V T2i, T2l, T2s, T2t;
+			 T2i = VFMA(LDK(KP923879532), T2g, VMUL(LDK(KP382683432), T2h));
+			 T2l = VFNMS(LDK(KP382683432), T2k, VMUL(LDK(KP923879532), T2j));
+			 T2m = VADD(T2i, T2l);
+			 T2q = VSUB(T2l, T2i);
+			 T2s = VFNMS(LDK(KP382683432), T2g, VMUL(LDK(KP923879532), T2h));
+			 T2t = VFMA(LDK(KP382683432), T2j, VMUL(LDK(KP923879532), T2k));
+			 T2u = VADD(T2s, T2t);
+			 T2w = VSUB(T2t, T2s);
+		    }
+		    STA(&(Cr[WS(csr, 14)]), VSUB(T2f, T2m), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 14)]), VSUB(T2u, T2r), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 2)]), VADD(T2f, T2m), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 2)]), VADD(T2r, T2u), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 6)]), VADD(T2p, T2q), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 6)]), VADD(T2v, T2w), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 10)]), VSUB(T2q, T2p), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 10)]), VSUB(T2v, T2w), ovs, &(Cr[0]));
+	       }
+	       {
+		    V TH, T1t, T1s, T1u, T1g, T1o, T1n, T1p;
+		    {
+			 V Tz, TG, T1q, T1r;
+			 Tz = VADD(Tv, Ty);
+			 TG = VADD(TC, TF);
+			 TH = VADD(Tz, TG);
+			 T1t = VSUB(Tz, TG);
+			 T1q = VFNMS(LDK(KP195090322), TS, VMUL(LDK(KP980785280), TX));
+			 T1r = VFMA(LDK(KP195090322), T19, VMUL(LDK(KP980785280), T1e));
+			 T1s = VADD(T1q, T1r);
+			 T1u = VSUB(T1r, T1q);
+		    }
+		    {
+			 V TY, T1f, T1j, T1m;
+			 TY = VFMA(LDK(KP980785280), TS, VMUL(LDK(KP195090322), TX));
+			 T1f = VFNMS(LDK(KP195090322), T1e, VMUL(LDK(KP980785280), T19));
+			 T1g = VADD(TY, T1f);
+			 T1o = VSUB(T1f, TY);
+			 T1j = VSUB(T1h, T1i);
+			 T1m = VSUB(T1k, T1l);
+			 T1n = VSUB(T1j, T1m);
+			 T1p = VADD(T1m, T1j);
+		    }
+		    STA(&(Cr[WS(csr, 15)]), VSUB(TH, T1g), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 15)]), VSUB(T1s, T1p), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 1)]), VADD(TH, T1g), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 1)]), VADD(T1p, T1s), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 7)]), VADD(T1n, T1o), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 7)]), VADD(T1t, T1u), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 9)]), VSUB(T1o, T1n), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 9)]), VSUB(T1t, T1u), ovs, &(Cr[0]));
+	       }
+	       {
+		    V T1x, T1N, T1M, T1O, T1E, T1I, T1H, T1J;
+		    {
+			 V T1v, T1w, T1K, T1L;
+			 T1v = VSUB(Tv, Ty);
+			 T1w = VADD(T1i, T1h);
+			 T1x = VADD(T1v, T1w);
+			 T1N = VSUB(T1v, T1w);
+			 T1K = VFNMS(LDK(KP555570233), T1y, VMUL(LDK(KP831469612), T1z));
+			 T1L = VFMA(LDK(KP555570233), T1B, VMUL(LDK(KP831469612), T1C));
+			 T1M = VADD(T1K, T1L);
+			 T1O = VSUB(T1L, T1K);
+		    }
+		    {
+			 V T1A, T1D, T1F, T1G;
+			 T1A = VFMA(LDK(KP831469612), T1y, VMUL(LDK(KP555570233), T1z));
+			 T1D = VFNMS(LDK(KP555570233), T1C, VMUL(LDK(KP831469612), T1B));
+			 T1E = VADD(T1A, T1D);
+			 T1I = VSUB(T1D, T1A);
+			 T1F = VSUB(TF, TC);
+			 T1G = VADD(T1l, T1k);
+			 T1H = VSUB(T1F, T1G);
+			 T1J = VADD(T1G, T1F);
+		    }
+		    STA(&(Cr[WS(csr, 13)]), VSUB(T1x, T1E), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 13)]), VSUB(T1M, T1J), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 3)]), VADD(T1x, T1E), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 3)]), VADD(T1J, T1M), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 5)]), VADD(T1H, T1I), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 5)]), VADD(T1N, T1O), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 11)]), VSUB(T1I, T1H), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 11)]), VSUB(T1N, T1O), ovs, &(Cr[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 32, XSIMD_STRING("r2cfv_32"), {140, 26, 16, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_32) (planner *p) {
+     X(kr2c_register) (p, r2cfv_32, &desc);
+}
+
+#endif
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:06:26 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_5 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -fma -compact -variables 4 -pipeline-latency 4 -n 5 -name r2cf_5 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 12 FP additions, 7 FP multiplications,
+ * (or, 7 additions, 2 multiplications, 5 fused multiply/add),
+ * 17 stack variables, 4 constants, and 10 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_5(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP559016994, +0.559016994374947424102293417182819058860154590);
+     DVK(KP250000000, +0.250000000000000000000000000000000000000000000);
+     DVK(KP618033988, +0.618033988749894848204586834365638117720309180);
+     DVK(KP951056516, +0.951056516295153572116439333379382143405698634);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(20, rs), MAKE_VOLATILE_STRIDE(20, csr), MAKE_VOLATILE_STRIDE(20, csi)) {
+	       V T7, T8, T9, T3, Ta, T6, Tb, Tc;
+	       T7 = LDA(&(R0[0]), ivs, &(R0[0]));
+	       {
+		    V T1, T2, T4, T5;
+		    T1 = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+		    T2 = LDA(&(R1[0]), ivs, &(R1[0]));
+		    T8 = VADD(T2, T1);
+		    T4 = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+		    T5 = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+		    T9 = VADD(T4, T5);
+		    T3 = VSUB(T1, T2);
+		    Ta = VADD(T8, T9);
+		    T6 = VSUB(T4, T5);
+	       }
+	       STA(&(Ci[WS(csi, 1)]), VMUL(LDK(KP951056516), VFNMS(LDK(KP618033988), T6, T3)), ovs, &(Ci[0]));
+	       STA(&(Cr[0]), VADD(T7, Ta), ovs, &(Cr[0]));
+	       STA(&(Ci[WS(csi, 2)]), VMUL(LDK(KP951056516), VFMA(LDK(KP618033988), T3, T6)), ovs, &(Ci[0]));
+	       Tb = VFNMS(LDK(KP250000000), Ta, T7);
+	       Tc = VSUB(T8, T9);
+	       STA(&(Cr[WS(csr, 1)]), VFMA(LDK(KP559016994), Tc, Tb), ovs, &(Cr[0]));
+	       STA(&(Cr[WS(csr, 2)]), VFNMS(LDK(KP559016994), Tc, Tb), ovs, &(Cr[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 5, XSIMD_STRING("r2cfv_5"), {7, 2, 5, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_5) (planner *p) {
+     X(kr2c_register) (p, r2cfv_5, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_5 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -compact -variables 4 -pipeline-latency 4 -n 5 -name r2cf_5 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 12 FP additions, 6 FP multiplications,
+ * (or, 9 additions, 3 multiplications, 3 fused multiply/add),
+ * 17 stack variables, 4 constants, and 10 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_5(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP250000000, +0.250000000000000000000000000000000000000000000);
+     DVK(KP559016994, +0.559016994374947424102293417182819058860154590);
+     DVK(KP587785252, +0.587785252292473129168705954639072768597652438);
+     DVK(KP951056516, +0.951056516295153572116439333379382143405698634);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(20, rs), MAKE_VOLATILE_STRIDE(20, csr), MAKE_VOLATILE_STRIDE(20, csi)) {
+	       V Ta, T7, T8, T3, Tb, T6, T9, Tc;
+	       Ta = LDA(&(R0[0]), ivs, &(R0[0]));
+	       {
+		    V T1, T2, T4, T5;
+		    T1 = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+		    T2 = LDA(&(R1[0]), ivs, &(R1[0]));
+		    T7 = VADD(T2, T1);
+		    T4 = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+		    T5 = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+		    T8 = VADD(T4, T5);
+		    T3 = VSUB(T1, T2);
+		    Tb = VADD(T7, T8);
+		    T6 = VSUB(T4, T5);
+	       }
+	       STA(&(Ci[WS(csi, 1)]), VFNMS(LDK(KP587785252), T6, VMUL(LDK(KP951056516), T3)), ovs, &(Ci[0]));
+	       STA(&(Cr[0]), VADD(Ta, Tb), ovs, &(Cr[0]));
+	       STA(&(Ci[WS(csi, 2)]), VFMA(LDK(KP587785252), T3, VMUL(LDK(KP951056516), T6)), ovs, &(Ci[0]));
+	       T9 = VMUL(LDK(KP559016994), VSUB(T7, T8));
+	       Tc = VFNMS(LDK(KP250000000), Tb, Ta);
+	       STA(&(Cr[WS(csr, 1)]), VADD(T9, Tc), ovs, &(Cr[0]));
+	       STA(&(Cr[WS(csr, 2)]), VSUB(Tc, T9), ovs, &(Cr[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 5, XSIMD_STRING("r2cfv_5"), {9, 3, 3, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_5) (planner *p) {
+     X(kr2c_register) (p, r2cfv_5, &desc);
+}
+
+#endif
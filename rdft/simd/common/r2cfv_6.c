@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:06:26 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_6 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -fma -compact -variables 4 -pipeline-latency 4 -n 6 -name r2cf_6 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 14 FP additions, 4 FP multiplications,
+ * (or, 12 additions, 2 multiplications, 2 fused multiply/add),
+ * 17 stack variables, 2 constants, and 12 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_6(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DVK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(24, rs), MAKE_VOLATILE_STRIDE(24, csr), MAKE_VOLATILE_STRIDE(24, csi)) {
+	       V T3, Td, T9, Tc, T6, Tb, T1, T2, Ta, Te;
+	       T1 = LDA(&(R0[0]), ivs, &(R0[0]));
+	       T2 = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+	       T3 = VSUB(T1, T2);
+	       Td = VADD(T1, T2);
+	       {
+		    V T7, T8, T4, T5;
+		    T7 = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+		    T8 = LDA(&(R1[0]), ivs, &(R1[0]));
+		    T9 = VSUB(T7, T8);
+		    Tc = VADD(T7, T8);
+		    T4 = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+		    T5 = LDA(&(R1[WS(rs, 2)]), ivs, &(R1[0]));
+		    T6 = VSUB(T4, T5);
+		    Tb = VADD(T4, T5);
+	       }
+	       STA(&(Ci[WS(csi, 1)]), VMUL(LDK(KP866025403), VSUB(T9, T6)), ovs, &(Ci[0]));
+	       Ta = VADD(T6, T9);
+	       STA(&(Cr[WS(csr, 1)]), VFNMS(LDK(KP500000000), Ta, T3), ovs, &(Cr[0]));
+	       STA(&(Cr[WS(csr, 3)]), VADD(T3, Ta), ovs, &(Cr[0]));
+	       STA(&(Ci[WS(csi, 2)]), VMUL(LDK(KP866025403), VSUB(Tb, Tc)), ovs, &(Ci[0]));
+	       Te = VADD(Tb, Tc);
+	       STA(&(Cr[WS(csr, 2)]), VFNMS(LDK(KP500000000), Te, Td), ovs, &(Cr[0]));
+	       STA(&(Cr[0]), VADD(Td, Te), ovs, &(Cr[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 6, XSIMD_STRING("r2cfv_6"), {12, 2, 2, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_6) (planner *p) {
+     X(kr2c_register) (p, r2cfv_6, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_6 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -compact -variables 4 -pipeline-latency 4 -n 6 -name r2cf_6 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 14 FP additions, 4 FP multiplications,
+ * (or, 12 additions, 2 multiplications, 2 fused multiply/add),
+ * 17 stack variables, 2 constants, and 12 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_6(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DVK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(24, rs), MAKE_VOLATILE_STRIDE(24, csr), MAKE_VOLATILE_STRIDE(24, csi)) {
+	       V T3, Td, T9, Tc, T6, Tb, T1, T2, Ta, Te;
+	       T1 = LDA(&(R0[0]), ivs, &(R0[0]));
+	       T2 = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+	       T3 = VSUB(T1, T2);
+	       Td = VADD(T1, T2);
+	       {
+		    V T7, T8, T4, T5;
+		    T7 = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+		    T8 = LDA(&(R1[0]), ivs, &(R1[0]));
+		    T9 = VSUB(T7, T8);
+		    Tc = VADD(T7, T8);
+		    T4 = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+		    T5 = LDA(&(R1[WS(rs, 2)]), ivs, &(R1[0]));
+		    T6 = VSUB(T4, T5);
+		    Tb = VADD(T4, T5);
+	       }
+	       STA(&(Ci[WS(csi, 1)]), VMUL(LDK(KP866025403), VSUB(T9, T6)), ovs, &(Ci[0]));
+	       Ta = VADD(T6, T9);
+	       STA(&(Cr[WS(csr, 1)]), VFNMS(LDK(KP500000000), Ta, T3), ovs, &(Cr[0]));
+	       STA(&(Cr[WS(csr, 3)]), VADD(T3, Ta), ovs, &(Cr[0]));
+	       STA(&(Ci[WS(csi, 2)]), VMUL(LDK(KP866025403), VSUB(Tb, Tc)), ovs, &(Ci[0]));
+	       Te = VADD(Tb, Tc);
+	       STA(&(Cr[WS(csr, 2)]), VFNMS(LDK(KP500000000), Te, Td), ovs, &(Cr[0]));
+	       STA(&(Cr[0]), VADD(Td, Te), ovs, &(Cr[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 6, XSIMD_STRING("r2cfv_6"), {12, 2, 2, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_6) (planner *p) {
+     X(kr2c_register) (p, r2cfv_6, &desc);
+}
+
+#endif
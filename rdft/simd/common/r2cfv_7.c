@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:06:26 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_7 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -fma -compact -variables 4 -pipeline-latency 4 -n 7 -name r2cf_7 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 24 FP additions, 18 FP multiplications,
+ * (or, 9 additions, 3 multiplications, 15 fused multiply/add),
+ * 23 stack variables, 6 constants, and 14 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_7(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP801937735, +0.801937735804838252472204639014890102331838324);
+     DVK(KP974927912, +0.974927912181823607018131682993931217232785801);
+     DVK(KP554958132, +0.554958132087371191422194871006410481067288862);
+     DVK(KP900968867, +0.900968867902419126236102319507445051165919162);
+     DVK(KP692021471, +0.692021471630095869627814897002069140197260599);
+     DVK(KP356895867, +0.356895867892209443894399510021300583399127187);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(28, rs), MAKE_VOLATILE_STRIDE(28, csr), MAKE_VOLATILE_STRIDE(28, csi)) {
+	       V T1, T4, Ta, T7, Tb, Td, Tj, Ti, Th, Tf;
+	       T1 = LDA(&(R0[0]), ivs, &(R0[0]));
+	       {
+		    V T2, T3, T8, T9, T5, T6;
+		    T2 = LDA(&(R1[0]), ivs, &(R1[0]));
+		    T3 = LDA(&(R0[WS(rs, 3)]), ivs, &(R0[0]));
+		    T4 = VADD(T2, T3);
+		    T8 = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+		    T9 = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+		    Ta = VADD(T8, T9);
+		    T5 = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+		    T6 = LDA(&(R1[WS(rs, 2)]), ivs, &(R1[0]));
+		    T7 = VADD(T5, T6);
+		    Tb = VFNMS(LDK(KP356895867), Ta, T7);
+		    Td = VFNMS(LDK(KP356895867), T4, Ta);
+		    Tj = VSUB(T6, T5);
+		    Ti = VSUB(T9, T8);
+		    Th = VSUB(T3, T2);
+		    Tf = VFNMS(LDK(KP356895867), T7, T4);
+	       }
+	       {
+		    V Tc, Tm, Te, Tk, Tg, Tl;
+		    Tc = VFNMS(LDK(KP692021471), Tb, T4);
+		    STA(&(Cr[WS(csr, 3)]), VFNMS(LDK(KP900968867), Tc, T1), ovs, &(Cr[0]));
+		    Tm = VFNMS(LDK(KP554958132), Th, Tj);
+		    STA(&(Ci[WS(csi, 3)]), VMUL(LDK(KP974927912), VFNMS(LDK(KP801937735), Tm, Ti)), ovs, &(Ci[0]));
+		    Te = VFNMS(LDK(KP692021471), Td, T7);
+		    STA(&(Cr[WS(csr, 2)]), VFNMS(LDK(KP900968867), Te, T1), ovs, &(Cr[0]));
+		    Tk = VFMA(LDK(KP554958132), Tj, Ti);
+		    STA(&(Ci[WS(csi, 2)]), VMUL(LDK(KP974927912), VFNMS(LDK(KP801937735), Tk, Th)), ovs, &(Ci[0]));
+		    STA(&(Cr[0]), VADD(VADD(VADD(T1, T4), T7), Ta), ovs, &(Cr[0]));
+		    Tg = VFNMS(LDK(KP692021471), Tf, Ta);
+		    STA(&(Cr[WS(csr, 1)]), VFNMS(LDK(KP900968867), Tg, T1), ovs, &(Cr[0]));
+		    Tl = VFMA(LDK(KP554958132), Ti, Th);
+		    STA(&(Ci[WS(csi, 1)]), VMUL(LDK(KP974927912), VFMA(LDK(KP801937735), Tl, Tj)), ovs, &(Ci[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 7, XSIMD_STRING("r2cfv_7"), {9, 3, 15, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_7) (planner *p) {
+     X(kr2c_register) (p, r2cfv_7, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_7 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -compact -variables 4 -pipeline-latency 4 -n 7 -name r2cf_7 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 24 FP additions, 18 FP multiplications,
+ * (or, 12 additions, 6 multiplications, 12 fused multiply/add),
+ * 20 stack variables, 6 constants, and 14 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_7(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP222520933, +0.222520933956314404288902564496794759466355569);
+     DVK(KP900968867, +0.900968867902419126236102319507445051165919162);
+     DVK(KP623489801, +0.623489801858733530525004884004239810632274731);
+     DVK(KP433883739, +0.433883739117558120475768332848358754609990728);
+     DVK(KP781831482, +0.781831482468029808708444526674057750232334519);
+     DVK(KP974927912, +0.974927912181823607018131682993931217232785801);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(28, rs), MAKE_VOLATILE_STRIDE(28, csr), MAKE_VOLATILE_STRIDE(28, csi)) {
+	       V T1, Ta, Tb, T4, Td, T7, Tc, T8, T9;
+	       T1 = LDA(&(R0[0]), ivs, &(R0[0]));
+	       T8 = LDA(&(R1[0]), ivs, &(R1[0]));
+	       T9 = LDA(&(R0[WS(rs, 3)]), ivs, &(R0[0]));
+	       Ta = VADD(T8, T9);
+	       Tb = VSUB(T9, T8);
+	       {
+		    V T2, T3, T5, T6;
+		    T2 = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+		    T3 = LDA(&(R1[WS(rs, 2)]), ivs, &(R1[0]));
+		    T4 = VADD(T2, T3);
+		    Td = VSUB(T3, T2);
+		    T5 = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+		    T6 = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+		    T7 = VADD(T5, T6);
+		    Tc = VSUB(T6, T5);
+	       }
+	       STA(&(Ci[WS(csi, 2)]), VSUB(VFNMS(LDK(KP781831482), Tc, VMUL(LDK(KP974927912), Tb)), VMUL(LDK(KP433883739), Td)), ovs, &(Ci[0]));
+	       STA(&(Ci[WS(csi, 1)]), VADD(VFMA(LDK(KP781831482), Tb, VMUL(LDK(KP974927912), Td)), VMUL(LDK(KP433883739), Tc)), ovs, &(Ci[0]));
+	       STA(&(Cr[WS(csr, 2)]), VSUB(VFNMS(LDK(KP900968867), T4, VFMA(LDK(KP623489801), T7, T1)), VMUL(LDK(KP222520933), Ta)), ovs, &(Cr[0]));
+	       STA(&(Ci[WS(csi, 3)]), VSUB(VFMA(LDK(KP433883739), Tb, VMUL(LDK(KP974927912), Tc)), VMUL(LDK(KP781831482), Td)), ovs, &(Ci[0]));
+	       STA(&(Cr[WS(csr, 3)]), VSUB(VFNMS(LDK(KP222520933), T7, VFMA(LDK(KP623489801), T4, T1)), VMUL(LDK(KP900968867), Ta)), ovs, &(Cr[0]));
+	       STA(&(Cr[WS(csr, 1)]), VSUB(VFNMS(LDK(KP900968867), T7, VFMA(LDK(KP623489801), Ta, T1)), VMUL(LDK(KP222520933), T4)), ovs, &(Cr[0]));
+	       STA(&(Cr[0]), VADD(VADD(VADD(T1, Ta), T4), T7), ovs, &(Cr[0]));
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 7, XSIMD_STRING("r2cfv_7"), {12, 6, 12, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_7) (planner *p) {
+     X(kr2c_register) (p, r2cfv_7, &desc);
+}
+
+#endif
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:06:26 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_8 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -fma -compact -variables 4 -pipeline-latency 4 -n 8 -name r2cf_8 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 20 FP additions, 4 FP multiplications,
+ * (or, 16 additions, 0 multiplications, 4 fused multiply/add),
+ * 14 stack variables, 1 constants, and 16 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_8(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(32, rs), MAKE_VOLATILE_STRIDE(32, csr), MAKE_VOLATILE_STRIDE(32, csi)) {
+	       V T3, T7, Td, Tj, T6, Tf, Ta, Ti;
+	       {
+		    V T1, T2, Tb, Tc;
+		    T1 = LDA(&(R0[0]), ivs, &(R0[0]));
+		    T2 = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+		    T3 = VADD(T1, T2);
+		    T7 = VSUB(T1, T2);
+		    Tb = LDA(&(R1[WS(rs, 3)]), ivs, &(R1[0]));
+		    Tc = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+		    Td = VSUB(Tb, Tc);
+		    Tj = VADD(Tb, Tc);
+	       }
+	       {
+		    V T4, T5, T8, T9;
+		    T4 = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+		    T5 = LDA(&(R0[WS(rs, 3)]), ivs, &(R0[0]));
+		    T6 = VADD(T4, T5);
+		    Tf = VSUB(T4, T5);
+		    T8 = LDA(&(R1[0]), ivs, &(R1[0]));
+		    T9 = LDA(&(R1[WS(rs, 2)]), ivs, &(R1[0]));
+		    Ta = VSUB(T8, T9);
+		    Ti = VADD(T8, T9);
+	       }
+	       STA(&(Cr[WS(csr, 2)]), VSUB(T3, T6), ovs, &(Cr[0]));
+	       STA(&(Ci[WS(csi, 2)]), VSUB(Tj, Ti), ovs, &(Ci[0]));
+	       {
+		    V Te, Tg, Th, Tk;
+		    Te = VADD(Ta, Td);
+		    STA(&(Cr[WS(csr, 3)]), VFNMS(LDK(KP707106781), Te, T7), ovs, &(Cr[0]));
+		    STA(&(Cr[WS(csr, 1)]), VFMA(LDK(KP707106781), Te, T7), ovs, &(Cr[0]));
+		    Tg = VSUB(Td, Ta);
+		    STA(&(Ci[WS(csi, 1)]), VFMS(LDK(KP707106781), Tg, Tf), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 3)]), VFMA(LDK(KP707106781), Tg, Tf), ovs, &(Ci[0]));
+		    Th = VADD(T3, T6);
+		    Tk = VADD(Ti, Tj);
+		    STA(&(Cr[WS(csr, 4)]), VSUB(Th, Tk), ovs, &(Cr[0]));
+		    STA(&(Cr[0]), VADD(Th, Tk), ovs, &(Cr[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 8, XSIMD_STRING("r2cfv_8"), {16, 0, 4, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_8) (planner *p) {
+     X(kr2c_register) (p, r2cfv_8, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_8 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -compact -variables 4 -pipeline-latency 4 -n 8 -name r2cf_8 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 20 FP additions, 2 FP multiplications,
+ * (or, 20 additions, 2 multiplications, 0 fused multiply/add),
+ * 14 stack variables, 1 constants, and 16 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_8(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(32, rs), MAKE_VOLATILE_STRIDE(32, csr), MAKE_VOLATILE_STRIDE(32, csi)) {
+	       V T3, T7, Td, Tj, T6, Tg, Ta, Ti;
+	       {
+		    V T1, T2, Tb, Tc;
+		    T1 = LDA(&(R0[0]), ivs, &(R0[0]));
+		    T2 = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+		    T3 = VADD(T1, T2);
+		    T7 = VSUB(T1, T2);
+		    Tb = LDA(&(R1[WS(rs, 3)]), ivs, &(R1[0]));
+		    Tc = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+		    Td = VSUB(Tb, Tc);
+		    Tj = VADD(Tb, Tc);
+	       }
+	       {
+		    V T4, T5, T8, T9;
+		    T4 = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+		    T5 = LDA(&(R0[WS(rs, 3)]), ivs, &(R0[0]));
+		    T6 = VADD(T4, T5);
+		    Tg = VSUB(T4, T5);
+		    T8 = LDA(&(R1[0]), ivs, &(R1[0]));
+		    T9 = LDA(&(R1[WS(rs, 2)]), ivs, &(R1[0]));
+		    Ta = VSUB(T8, T9);
+		    Ti = VADD(T8, T9);
+	       }
+	       STA(&(Cr[WS(csr, 2)]), VSUB(T3, T6), ovs, &(Cr[0]));
+	       STA(&(Ci[WS(csi, 2)]), VSUB(Tj, Ti), ovs, &(Ci[0]));
+	       {
+		    V Te, Tf, Th, Tk;
+		    Te = VMUL(LDK(KP707106781), VADD(Ta, Td));
+		    STA(&(Cr[WS(csr, 3)]), VSUB(T7, Te), ovs, &(Cr[0]));
+		    STA(&(Cr[WS(csr, 1)]), VADD(T7, Te), ovs, &(Cr[0]));
+		    Tf = VMUL(LDK(KP707106781), VSUB(Td, Ta));
+		    STA(&(Ci[WS(csi, 1)]), VSUB(Tf, Tg), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 3)]), VADD(Tg, Tf), ovs, &(Ci[0]));
+		    Th = VADD(T3, T6);
+		    Tk = VADD(Ti, Tj);
+		    STA(&(Cr[WS(csr, 4)]), VSUB(Th, Tk), ovs, &(Cr[0]));
+		    STA(&(Cr[0]), VADD(Th, Tk), ovs, &(Cr[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 8, XSIMD_STRING("r2cfv_8"), {20, 2, 0, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_8) (planner *p) {
+     X(kr2c_register) (p, r2cfv_8, &desc);
+}
+
+#endif
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Thu May 24 08:06:26 EDT 2018 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_9 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -fma -compact -variables 4 -pipeline-latency 4 -n 9 -name r2cf_9 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 38 FP additions, 30 FP multiplications,
+ * (or, 12 additions, 4 multiplications, 26 fused multiply/add),
+ * 48 stack variables, 18 constants, and 18 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_9(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP907603734, +0.907603734547952313649323976213898122064543220);
+     DVK(KP347296355, +0.347296355333860697703433253538629592000751354);
+     DVK(KP852868531, +0.852868531952443209628250963940074071936020296);
+     DVK(KP666666666, +0.666666666666666666666666666666666666666666667);
+     DVK(KP898197570, +0.898197570222573798468955502359086394667167570);
+     DVK(KP673648177, +0.673648177666930348851716626769314796000375677);
+     DVK(KP879385241, +0.879385241571816768108218554649462939872416269);
+     DVK(KP984807753, +0.984807753012208059366743024589523013670643252);
+     DVK(KP939692620, +0.939692620785908384054109277324731469936208134);
+     DVK(KP394930843, +0.394930843634698457567117349190734585290304520);
+     DVK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DVK(KP586256827, +0.586256827714544512072145703099641959914944179);
+     DVK(KP726681596, +0.726681596905677465811651808188092531873167623);
+     DVK(KP968908795, +0.968908795874236621082202410917456709164223497);
+     DVK(KP203604859, +0.203604859554852403062088995281827210665664861);
+     DVK(KP152703644, +0.152703644666139302296566746461370407999248646);
+     DVK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DVK(KP184792530, +0.184792530904095372701352047572203755870913560);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(36, rs), MAKE_VOLATILE_STRIDE(36, csr), MAKE_VOLATILE_STRIDE(36, csi)) {
+	       V T1, T4, To, Tk, Ta, Tu, Tf, Th, Tj, Tx, Tl, Tm, Ty, Tq, T2;
+	       V T3, T5, Tg;
+	       T1 = LDA(&(R0[0]), ivs, &(R0[0]));
+	       T2 = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+	       T3 = LDA(&(R0[WS(rs, 3)]), ivs, &(R0[0]));
+	       T4 = VADD(T2, T3);
+	       To = VSUB(T3, T2);
+	       {
+		    V T6, Tb, T9, Te, Ti;
+		    T6 = LDA(&(R1[0]), ivs, &(R1[0]));
+		    Tb = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+		    {
+			 V T7, T8, Tc, Td;
+			 T7 = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+			 T8 = LDA(&(R1[WS(rs, 3)]), ivs, &(R1[0]));
+			 T9 = VADD(T7, T8);
+			 Tk = VSUB(T7, T8);
+			 Tc = LDA(&(R1[WS(rs, 2)]), ivs, &(R1[0]));
+			 Td = LDA(&(R0[WS(rs, 4)]), ivs, &(R0[0]));
+			 Te = VADD(Tc, Td);
+			 Ti = VSUB(Td, Tc);
+		    }
+		    Ta = VADD(T6, T9);
+		    Tu = VFMA(LDK(KP184792530), Tk, Ti);
+		    Tf = VADD(Tb, Te);
+		    Th = VFNMS(LDK(KP500000000), Te, Tb);
+		    Tj = VFNMS(LDK(KP152703644), Ti, Th);
+		    Tx = VFMA(LDK(KP203604859), Th, Ti);
+		    Tl = VFMS(LDK(KP500000000), T9, T6);
+		    Tm = VFNMS(LDK(KP968908795), Tl, Tk);
+		    Ty = VFMA(LDK(KP726681596), Tk, Tl);
+		    Tq = VFMA(LDK(KP586256827), Tl, Ti);
+	       }
+	       STA(&(Ci[WS(csi, 3)]), VMUL(LDK(KP866025403), VSUB(Tf, Ta)), ovs, &(Ci[0]));
+	       T5 = VADD(T1, T4);
+	       Tg = VADD(Ta, Tf);
+	       STA(&(Cr[WS(csr, 3)]), VFNMS(LDK(KP500000000), Tg, T5), ovs, &(Cr[0]));
+	       STA(&(Cr[0]), VADD(T5, Tg), ovs, &(Cr[0]));
+	       {
+		    V Tv, Tt, Tn, TC, TB;
+		    Tt = VFMA(LDK(KP394930843), Th, To);
+		    Tv = VFNMS(LDK(KP939692620), Tu, Tt);
+		    STA(&(Ci[WS(csi, 2)]), VMUL(LDK(KP984807753), VFNMS(LDK(KP879385241), Tv, Tl)), ovs, &(Ci[0]));
+		    Tn = VFMA(LDK(KP673648177), Tm, Tj);
+		    TB = VFMA(LDK(KP898197570), Ty, Tx);
+		    TC = VFMA(LDK(KP666666666), Tn, TB);
+		    STA(&(Ci[WS(csi, 1)]), VMUL(LDK(KP984807753), VFMS(LDK(KP879385241), To, Tn)), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 4)]), VMUL(LDK(KP866025403), VFMA(LDK(KP852868531), TC, To)), ovs, &(Ci[0]));
+		    {
+			 V Tp, Ts, Tz, TA, Tr, Tw;
+			 Tp = VFNMS(LDK(KP500000000), T4, T1);
+			 Tr = VFNMS(LDK(KP347296355), Tq, Tk);
+			 Ts = VFNMS(LDK(KP907603734), Tr, Th);
+			 Tw = VFNMS(LDK(KP673648177), Tm, Tj);
+			 Tz = VFNMS(LDK(KP898197570), Ty, Tx);
+			 TA = VFNMS(LDK(KP500000000), Tz, Tw);
+			 STA(&(Cr[WS(csr, 2)]), VFNMS(LDK(KP939692620), Ts, Tp), ovs, &(Cr[0]));
+			 STA(&(Cr[WS(csr, 1)]), VFMA(LDK(KP852868531), Tz, Tp), ovs, &(Cr[0]));
+			 STA(&(Cr[WS(csr, 4)]), VFMA(LDK(KP852868531), TA, Tp), ovs, &(Cr[0]));
+		    }
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 9, XSIMD_STRING("r2cfv_9"), {12, 4, 26, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_9) (planner *p) {
+     X(kr2c_register) (p, r2cfv_9, &desc);
+}
+
+#else
+
+/* Generated by: ../../../support/vectorize-r2c.py -name r2cfv_9 -include rdft/simd/r2cfv.h from: ../../../genfft/gen_r2cf.native -compact -variables 4 -pipeline-latency 4 -n 9 -name r2cf_9 -include rdft/scalar/r2cf.h */
+
+/*
+ * This function contains 38 FP additions, 26 FP multiplications,
+ * (or, 21 additions, 9 multiplications, 17 fused multiply/add),
+ * 36 stack variables, 14 constants, and 18 memory accesses
+ */
+#include "rdft/simd/r2cfv.h"
+
+static void r2cfv_9(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DVK(KP939692620, +0.939692620785908384054109277324731469936208134);
+     DVK(KP296198132, +0.296198132726023843175338011893050938967728390);
+     DVK(KP342020143, +0.342020143325668733044099614682259580763083368);
+     DVK(KP813797681, +0.813797681349373692844693217248393223289101568);
+     DVK(KP984807753, +0.984807753012208059366743024589523013670643252);
+     DVK(KP150383733, +0.150383733180435296639271897612501926072238258);
+     DVK(KP642787609, +0.642787609686539326322643409907263432907559884);
+     DVK(KP663413948, +0.663413948168938396205421319635891297216863310);
+     DVK(KP852868531, +0.852868531952443209628250963940074071936020296);
+     DVK(KP173648177, +0.173648177666930348851716626769314796000375677);
+     DVK(KP556670399, +0.556670399226419366452912952047023132968291906);
+     DVK(KP766044443, +0.766044443118978035202392650555416673935832457);
+     DVK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DVK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - (2 * VL), R0 = R0 + ((2 * VL) * ivs), R1 = R1 + ((2 * VL) * ivs), Cr = Cr + ((2 * VL) * ovs), Ci = Ci + ((2 * VL) * ovs), MAKE_VOLATILE_STRIDE(36, rs), MAKE_VOLATILE_STRIDE(36, csr), MAKE_VOLATILE_STRIDE(36, csi)) {
+	       V T1, T4, Tr, Ta, Tl, Ti, Tf, Tk, Tj, T2, T3, T5, Tg;
+	       T1 = LDA(&(R0[0]), ivs, &(R0[0]));
+	       T2 = LDA(&(R1[WS(rs, 1)]), ivs, &(R1[0]));
+	       T3 = LDA(&(R0[WS(rs, 3)]), ivs, &(R0[0]));
+	       T4 = VADD(T2, T3);
+	       Tr = VSUB(T3, T2);
+	       {
+		    V T6, T7, T8, T9;
+		    T6 = LDA(&(R1[0]), ivs, &(R1[0]));
+		    T7 = LDA(&(R0[WS(rs, 2)]), ivs, &(R0[0]));
+		    T8 = LDA(&(R1[WS(rs, 3)]), ivs, &(R1[0]));
+		    T9 = VADD(T7, T8);
+		    Ta = VADD(T6, T9);
+		    Tl = VSUB(T8, T7);
+		    Ti = VFNMS(LDK(KP500000000), T9, T6);
+	       }
+	       {
+		    V Tb, Tc, Td, Te;
+		    Tb = LDA(&(R0[WS(rs, 1)]), ivs, &(R0[0]));
+		    Tc = LDA(&(R1[WS(rs, 2)]), ivs, &(R1[0]));
+		    Td = LDA(&(R0[WS(rs, 4)]), ivs, &(R0[0]));
+		    Te = VADD(Tc, Td);
+		    Tf = VADD(Tb, Te);
+		    Tk = VFNMS(LDK(KP500000000), Te, Tb);
+		    Tj = VSUB(Td, Tc);
+	       }
+	       STA(&(Ci[WS(csi, 3)]), VMUL(LDK(KP866025403), VSUB(Tf, Ta)), ovs, &(Ci[0]));
+	       T5 = VADD(T1, T4);
+	       Tg = VADD(Ta, Tf);
+	       STA(&(Cr[WS(csr, 3)]), VFNMS(LDK(KP500000000), Tg, T5), ovs, &(Cr[0]));
+	       STA(&(Cr[0]), VADD(T5, Tg), ovs, &(Cr[0]));
+	       {
+		    V Tt, Th, Tm, Tn, To, Tp, Tq, Ts;
+		    Tt = VMUL(LDK(KP866025403), Tr);
+		    Th = VFNMS(LDK(KP500000000), T4, T1);
+		    Tm = VFMA(LDK(KP766044443), Ti, VMUL(LDK(KP556670399), Tl));
+		    Tn = VFMA(LDK(KP173648177), Tk, VMUL(LDK(KP852868531), Tj));
+		    To = VADD(Tm, Tn);
+		    Tp = VFNMS(LDK(KP642787609), Ti, VMUL(LDK(KP663413948), Tl));
+		    Tq = VFNMS(LDK(KP984807753), Tk, VMUL(LDK(KP150383733), Tj));
+		    Ts = VADD(Tp, Tq);
+		    STA(&(Cr[WS(csr, 1)]), VADD(Th, To), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 1)]), VADD(Tt, Ts), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 4)]), VSUB(VFMA(LDK(KP866025403), VSUB(Tp, Tq), Th), VMUL(LDK(KP500000000), To)), ovs, &(Cr[0]));
+		    STA(&(Ci[WS(csi, 4)]), VFNMS(LDK(KP500000000), Ts, VMUL(LDK(KP866025403), VADD(Tr, VSUB(Tn, Tm)))), ovs, &(Ci[0]));
+		    STA(&(Ci[WS(csi, 2)]), VSUB(VSUB(VFNMS(LDK(KP150383733), Tl, VFNMS(LDK(KP342020143), Tk, VMUL(LDK(KP813797681), Tj))), VMUL(LDK(KP984807753), Ti)), Tt), ovs, &(Ci[0]));
+		    STA(&(Cr[WS(csr, 2)]), VSUB(VSUB(VFNMS(LDK(KP296198132), Tj, VFMA(LDK(KP173648177), Ti, Th)), VMUL(LDK(KP939692620), Tk)), VMUL(LDK(KP852868531), Tl)), ovs, &(Cr[0]));
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kr2c_desc desc = { 9, XSIMD_STRING("r2cfv_9"), {21, 9, 17, 0}, &GENUS };
+
+void XSIMD(codelet_r2cfv_9) (planner *p) {
+     X(kr2c_register) (p, r2cfv_9, &desc);
+}
+
+#endif
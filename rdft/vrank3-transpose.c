@@ -58,6 +58,7 @@ typedef struct P_s {
      INT nc, mc; /* transpose-cut params */
      plan *cld1, *cld2, *cld3; /* children, null if unused */
      const S *slv;
+     scratch scr; /* nbuf elements */
 } P;
 
 
@@ -182,7 +183,7 @@ static void apply_gcd(const plan *ego_, R *I, R *O)
      const P *ego = (const P *) ego_;
      INT n = ego->nd, m = ego->md, d = ego->d;
      INT vl = ego->vl;
-     R *buf = (R *)MALLOC(sizeof(R) * ego->nbuf, BUFFERS);
+     R *buf = X(scratch_get)(&ego->scr);
      INT i, num_el = n*m*d*vl;
 
      A(ego->n == n * d && ego->m == m * d);
@@ -228,7 +229,7 @@ static void apply_gcd(const plan *ego_, R *I, R *O)
 	  }
      }
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 static int applicable_gcd(const problem_rdft *p, planner *plnr,
@@ -333,7 +334,7 @@ static void apply_cut(const plan *ego_, R *I, R *O)
      const P *ego = (const P *) ego_;
      INT n = ego->n, m = ego->m, nc = ego->nc, mc = ego->mc, vl = ego->vl;
      INT i;
-     R *buf1 = (R *)MALLOC(sizeof(R) * ego->nbuf, BUFFERS);
+     R *buf1 = X(scratch_get)(&ego->scr);
      UNUSED(O);
 
      if (m > mc) {
@@ -361,7 +362,7 @@ static void apply_cut(const plan *ego_, R *I, R *O)
 	       memcpy(I + mc*(n*vl), buf1, (m-mc)*(n*vl)*sizeof(R));
      }
 
-     X(ifree)(buf1);
+     X(scratch_put)(&ego->scr, buf1);
 }
 
 /* only cut one dimension if the resulting buffer is small enough */
@@ -986,10 +987,10 @@ static void apply_toms513(const plan *ego_, R *I, R *O)
      const P *ego = (const P *) ego_;
      INT n = ego->n, m = ego->m;
      INT vl = ego->vl;
-     R *buf = (R *)MALLOC(sizeof(R) * ego->nbuf, BUFFERS);
+     R *buf = X(scratch_get)(&ego->scr);
      UNUSED(O);
      transpose_toms513(I, n, m, vl, (char *) (buf + 2*vl), (n+m)/2, buf);
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 static int applicable_toms513(const problem_rdft *p, planner *plnr,
@@ -1033,6 +1034,7 @@ static void awake(plan *ego_, enum wakefulness wakefulness)
      X(plan_awake)(ego->cld1, wakefulness);
      X(plan_awake)(ego->cld2, wakefulness);
      X(plan_awake)(ego->cld3, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
 }
 
 static void print(const plan *ego_, printer *p)
@@ -1088,6 +1090,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 	  X(plan_destroy_internal)(&(pln->super.super));
 	  return 0;
      }
+     X(scratch_init)(&pln->scr, sizeof(R) * pln->nbuf);
 
      return &(pln->super.super);
 }
@@ -39,6 +39,7 @@ typedef struct {
      INT n;
      INT vl;
      INT ivs, ovs;
+     scratch scr;
 } P;
 
 #ifdef AMD_FMV_AUTO
@@ -53,7 +54,7 @@ static void apply(const plan *ego_, R *I, R *O)
      INT ivs = ego->ivs, ovs = ego->ovs;
      R *buf;
 
-     buf = (R *) MALLOC(sizeof(R) * (2*n), BUFFERS);
+     buf = X(scratch_get)(&ego->scr);
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  buf[0] = I[0];
@@ -77,7 +78,7 @@ static void apply(const plan *ego_, R *I, R *O)
 	  }
      }
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 static void awake(plan *ego_, enum wakefulness wakefulness)
@@ -85,6 +86,7 @@ static void awake(plan *ego_, enum wakefulness wakefulness)
      P *ego = (P *) ego_;
      X(plan_awake)(ego->cld, wakefulness);
      X(plan_awake)(ego->cldcpy, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
 }
 
 static void destroy(plan *ego_)
@@ -163,6 +165,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      pln = MKPLAN_RDFT(P, &padt, apply);
 
      pln->n = n;
+     X(scratch_init)(&pln->scr, sizeof(R) * (2*n));
      pln->is = p->sz->dims[0].is;
      pln->cld = cld;
      pln->cldcpy = cldcpy;
@@ -53,6 +53,7 @@ typedef struct {
      INT n;
      INT vl;
      INT ivs, ovs;
+     scratch scr;
 } P;
 
 static void apply(const plan *ego_, R *I, R *O)
@@ -66,7 +67,7 @@ static void apply(const plan *ego_, R *I, R *O)
      R *buf;
      E csum;
 
-     buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+     buf = X(scratch_get)(&ego->scr);
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  buf[0] = I[0] + I[is * n];
@@ -103,7 +104,7 @@ static void apply(const plan *ego_, R *I, R *O)
 	  }
      }
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 static void awake(plan *ego_, enum wakefulness wakefulness)
@@ -116,6 +117,7 @@ static void awake(plan *ego_, enum wakefulness wakefulness)
      };
 
      X(plan_awake)(ego->cld, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
      X(twiddle_awake)(wakefulness,
 		      &ego->td, redft00e_tw, 2*ego->n, 1, (ego->n+1)/2);
 }
@@ -182,6 +184,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      pln = MKPLAN_RDFT(P, &padt, apply);
 
      pln->n = n;
+     X(scratch_init)(&pln->scr, sizeof(R) * n);
      pln->is = p->sz->dims[0].is;
      pln->os = p->sz->dims[0].os;
      pln->cld = cld;
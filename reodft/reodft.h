@@ -32,6 +32,7 @@ void X(rodft00e_r2hc_register)(planner *p);
 void X(rodft00e_r2hc_pad_register)(planner *p);
 void X(reodft00e_splitradix_register)(planner *p);
 void X(reodft010e_r2hc_register)(planner *p);
+void X(reodft010e_r2hc_batch_register)(planner *p);
 void X(reodft11e_r2hc_register)(planner *p);
 void X(reodft11e_radix2_r2hc_register)(planner *p);
 void X(reodft11e_r2hc_odd_register)(planner *p);
@@ -46,6 +46,7 @@ typedef struct {
      INT n;
      INT vl;
      INT ivs, ovs;
+     scratch scr;
 } P;
 
 /* redft00 */
@@ -62,7 +63,7 @@ static void apply_e(const plan *ego_, R *I, R *O)
      R *W = ego->td->W - 2;
      R *buf;
 
-     buf = (R *) MALLOC(sizeof(R) * n2, BUFFERS);
+     buf = X(scratch_get)(&ego->scr);
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  /* do size (n-1)/2 r2hc transform of odd-indexed elements
@@ -125,7 +126,7 @@ static void apply_e(const plan *ego_, R *I, R *O)
 	  }
      }
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 /* rodft00 */
@@ -142,7 +143,7 @@ static void apply_o(const plan *ego_, R *I, R *O)
      R *W = ego->td->W - 2;
      R *buf;
 
-     buf = (R *) MALLOC(sizeof(R) * n2, BUFFERS);
+     buf = X(scratch_get)(&ego->scr);
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  /* do size (n+1)/2 r2hc transform of even-indexed elements
@@ -210,7 +211,7 @@ static void apply_o(const plan *ego_, R *I, R *O)
 	  }
      }
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 static void awake(plan *ego_, enum wakefulness wakefulness)
@@ -223,6 +224,7 @@ static void awake(plan *ego_, enum wakefulness wakefulness)
      };
 
      X(plan_awake)(ego->clde, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
      X(plan_awake)(ego->cldo, wakefulness);
      X(twiddle_awake)(wakefulness, &ego->td, reodft00e_tw, 
 		      2*ego->n, 1, ego->n/4);
@@ -321,6 +323,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      pln = MKPLAN_RDFT(P, &padt, p->kind[0] == REDFT00 ? apply_e : apply_o);
 
      pln->n = n;
+     X(scratch_init)(&pln->scr, sizeof(R) * (n/2));
      pln->is = p->sz->dims[0].is;
      pln->os = p->sz->dims[0].os;
      pln->clde = clde;
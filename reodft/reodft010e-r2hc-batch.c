@@ -0,0 +1,520 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2022, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/* Do a vector of R{E,O}DFT{01,10} problems via R2HC problems, NBUF
+   vectors at a time.  The algorithm is that of reodft010e-r2hc.c, but
+   the pre- and post-processing of a block of NBUF vectors goes through
+   one buffer in which element i of vector j is at buf[i * NBUF + j].
+   The inner loops then run over the vectors with unit stride in the
+   buffer, which the compiler vectorizes, and the NBUF size-N R2HC
+   transforms are one child plan with unit vector stride, which the
+   SIMD codelets of rdft/simd/common/r2cfv_*.c execute one transform
+   per vector lane.  The vectors that do not fill a block are left to
+   a separate child plan. */
+
+#include "reodft/reodft.h"
+
+typedef struct {
+     solver super;
+     size_t maxnbuf_ndx;
+} S;
+
+static const INT maxnbufs[] = { 16, 256 };
+
+/* NBUF is kept a multiple of BATCH, so that the rows of the buffer
+   are aligned and the R2HC child can use SIMD codelets of any vector
+   length up to BATCH reals */
+#define BATCH 16
+
+typedef struct {
+     plan_rdft super;
+     plan *cld, *cldrest;
+     twid *td;
+     INT is, os;
+     INT n;
+     INT vl, nbuf;
+     INT ivs, ovs;
+     rdft_kind kind;
+     scratch scr;
+} P;
+
+#ifdef AMD_FMV_AUTO
+__attribute__((target_clones(TARGET_STRINGS)))
+#endif
+static void apply_re01(const plan *ego_, R *I, R *O)
+{
+     const P *ego = (const P *) ego_;
+     plan_rdft *cld = (plan_rdft *) ego->cld;
+     plan_rdft *cldrest;
+     INT is = ego->is, os = ego->os;
+     INT i, j, n = ego->n;
+     INT iv, vl = ego->vl, nbuf = ego->nbuf;
+     INT ivs = ego->ivs, ovs = ego->ovs;
+     R *W = ego->td->W;
+     R *buf;
+
+     buf = X(scratch_get)(&ego->scr);
+
+     for (iv = nbuf; iv <= vl; iv += nbuf, I += ivs * nbuf, O += ovs * nbuf) {
+	  for (j = 0; j < nbuf; ++j)
+	       buf[j] = I[ivs * j];
+	  for (i = 1; i < n - i; ++i) {
+	       const R *Ia = I + is * i, *Ib = I + is * (n - i);
+	       R *ba = buf + nbuf * i, *bb = buf + nbuf * (n - i);
+	       E wa = W[2*i], wb = W[2*i + 1];
+	       for (j = 0; j < nbuf; ++j) {
+		    E a, b, apb, amb;
+		    a = Ia[ivs * j];
+		    b = Ib[ivs * j];
+		    apb = a + b;
+		    amb = a - b;
+		    ba[j] = wa * amb + wb * apb;
+		    bb[j] = wa * apb - wb * amb;
+	       }
+	  }
+	  if (i == n - i) {
+	       const R *Ia = I + is * i;
+	       R *ba = buf + nbuf * i;
+	       E w = K(2.0) * W[2*i];
+	       for (j = 0; j < nbuf; ++j)
+		    ba[j] = w * Ia[ivs * j];
+	  }
+
+	  cld->apply((plan *) cld, buf, buf);
+
+	  for (j = 0; j < nbuf; ++j)
+	       O[ovs * j] = buf[j];
+	  for (i = 1; i < n - i; ++i) {
+	       const R *ba = buf + nbuf * i, *bb = buf + nbuf * (n - i);
+	       INT k = i + i;
+	       R *Oa = O + os * (k - 1), *Ob = O + os * k;
+	       for (j = 0; j < nbuf; ++j) {
+		    E a = ba[j], b = bb[j];
+		    Oa[ovs * j] = a - b;
+		    Ob[ovs * j] = a + b;
+	       }
+	  }
+	  if (i == n - i) {
+	       const R *ba = buf + nbuf * i;
+	       R *Oa = O + os * (n - 1);
+	       for (j = 0; j < nbuf; ++j)
+		    Oa[ovs * j] = ba[j];
+	  }
+     }
+
+     X(scratch_put)(&ego->scr, buf);
+
+     cldrest = (plan_rdft *) ego->cldrest;
+     cldrest->apply((plan *) cldrest, I, O);
+}
+
+/* ro01 is same as re01, but with i <-> n - 1 - i in the input and
+   the sign of the odd output elements flipped. */
+#ifdef AMD_FMV_AUTO
+__attribute__((target_clones(TARGET_STRINGS)))
+#endif
+static void apply_ro01(const plan *ego_, R *I, R *O)
+{
+     const P *ego = (const P *) ego_;
+     plan_rdft *cld = (plan_rdft *) ego->cld;
+     plan_rdft *cldrest;
+     INT is = ego->is, os = ego->os;
+     INT i, j, n = ego->n;
+     INT iv, vl = ego->vl, nbuf = ego->nbuf;
+     INT ivs = ego->ivs, ovs = ego->ovs;
+     R *W = ego->td->W;
+     R *buf;
+
+     buf = X(scratch_get)(&ego->scr);
+
+     for (iv = nbuf; iv <= vl; iv += nbuf, I += ivs * nbuf, O += ovs * nbuf) {
+	  {
+	       const R *Ia = I + is * (n - 1);
+	       for (j = 0; j < nbuf; ++j)
+		    buf[j] = Ia[ivs * j];
+	  }
+	  for (i = 1; i < n - i; ++i) {
+	       const R *Ia = I + is * (n - 1 - i), *Ib = I + is * (i - 1);
+	       R *ba = buf + nbuf * i, *bb = buf + nbuf * (n - i);
+	       E wa = W[2*i], wb = W[2*i + 1];
+	       for (j = 0; j < nbuf; ++j) {
+		    E a, b, apb, amb;
+		    a = Ia[ivs * j];
+		    b = Ib[ivs * j];
+		    apb = a + b;
+		    amb = a - b;
+		    ba[j] = wa * amb + wb * apb;
+		    bb[j] = wa * apb - wb * amb;
+	       }
+	  }
+	  if (i == n - i) {
+	       const R *Ia = I + is * (i - 1);
+	       R *ba = buf + nbuf * i;
+	       E w = K(2.0) * W[2*i];
+	       for (j = 0; j < nbuf; ++j)
+		    ba[j] = w * Ia[ivs * j];
+	  }
+
+	  cld->apply((plan *) cld, buf, buf);
+
+	  for (j = 0; j < nbuf; ++j)
+	       O[ovs * j] = buf[j];
+	  for (i = 1; i < n - i; ++i) {
+	       const R *ba = buf + nbuf * i, *bb = buf + nbuf * (n - i);
+	       INT k = i + i;
+	       R *Oa = O + os * (k - 1), *Ob = O + os * k;
+	       for (j = 0; j < nbuf; ++j) {
+		    E a = ba[j], b = bb[j];
+		    Oa[ovs * j] = b - a;
+		    Ob[ovs * j] = a + b;
+	       }
+	  }
+	  if (i == n - i) {
+	       const R *ba = buf + nbuf * i;
+	       R *Oa = O + os * (n - 1);
+	       for (j = 0; j < nbuf; ++j)
+		    Oa[ovs * j] = -ba[j];
+	  }
+     }
+
+     X(scratch_put)(&ego->scr, buf);
+
+     cldrest = (plan_rdft *) ego->cldrest;
+     cldrest->apply((plan *) cldrest, I, O);
+}
+
+#ifdef AMD_FMV_AUTO
+__attribute__((target_clones(TARGET_STRINGS)))
+#endif
+static void apply_re10(const plan *ego_, R *I, R *O)
+{
+     const P *ego = (const P *) ego_;
+     plan_rdft *cld = (plan_rdft *) ego->cld;
+     plan_rdft *cldrest;
+     INT is = ego->is, os = ego->os;
+     INT i, j, n = ego->n;
+     INT iv, vl = ego->vl, nbuf = ego->nbuf;
+     INT ivs = ego->ivs, ovs = ego->ovs;
+     R *W = ego->td->W;
+     R *buf;
+
+     buf = X(scratch_get)(&ego->scr);
+
+     for (iv = nbuf; iv <= vl; iv += nbuf, I += ivs * nbuf, O += ovs * nbuf) {
+	  for (j = 0; j < nbuf; ++j)
+	       buf[j] = I[ivs * j];
+	  for (i = 1; i < n - i; ++i) {
+	       INT k = i + i;
+	       const R *Iu = I + is * (k - 1), *Iv = I + is * k;
+	       R *ba = buf + nbuf * i, *bb = buf + nbuf * (n - i);
+	       for (j = 0; j < nbuf; ++j) {
+		    bb[j] = Iu[ivs * j];
+		    ba[j] = Iv[ivs * j];
+	       }
+	  }
+	  if (i == n - i) {
+	       const R *Ia = I + is * (n - 1);
+	       R *ba = buf + nbuf * i;
+	       for (j = 0; j < nbuf; ++j)
+		    ba[j] = Ia[ivs * j];
+	  }
+
+	  cld->apply((plan *) cld, buf, buf);
+
+	  for (j = 0; j < nbuf; ++j)
+	       O[ovs * j] = K(2.0) * buf[j];
+	  for (i = 1; i < n - i; ++i) {
+	       const R *ba = buf + nbuf * i, *bb = buf + nbuf * (n - i);
+	       R *Oa = O + os * i, *Ob = O + os * (n - i);
+	       E wa = K(2.0) * W[2*i], wb = K(2.0) * W[2*i + 1];
+	       for (j = 0; j < nbuf; ++j) {
+		    E a = ba[j], b = bb[j];
+		    Oa[ovs * j] = wa * a + wb * b;
+		    Ob[ovs * j] = wb * a - wa * b;
+	       }
+	  }
+	  if (i == n - i) {
+	       const R *ba = buf + nbuf * i;
+	       R *Oa = O + os * i;
+	       E w = K(2.0) * W[2*i];
+	       for (j = 0; j < nbuf; ++j)
+		    Oa[ovs * j] = w * ba[j];
+	  }
+     }
+
+     X(scratch_put)(&ego->scr, buf);
+
+     cldrest = (plan_rdft *) ego->cldrest;
+     cldrest->apply((plan *) cldrest, I, O);
+}
+
+/* ro10 is same as re10, but with i <-> n - 1 - i in the output and
+   the sign of the odd input elements flipped. */
+#ifdef AMD_FMV_AUTO
+__attribute__((target_clones(TARGET_STRINGS)))
+#endif
+static void apply_ro10(const plan *ego_, R *I, R *O)
+{
+     const P *ego = (const P *) ego_;
+     plan_rdft *cld = (plan_rdft *) ego->cld;
+     plan_rdft *cldrest;
+     INT is = ego->is, os = ego->os;
+     INT i, j, n = ego->n;
+     INT iv, vl = ego->vl, nbuf = ego->nbuf;
+     INT ivs = ego->ivs, ovs = ego->ovs;
+     R *W = ego->td->W;
+     R *buf;
+
+     buf = X(scratch_get)(&ego->scr);
+
+     for (iv = nbuf; iv <= vl; iv += nbuf, I += ivs * nbuf, O += ovs * nbuf) {
+	  for (j = 0; j < nbuf; ++j)
+	       buf[j] = I[ivs * j];
+	  for (i = 1; i < n - i; ++i) {
+	       INT k = i + i;
+	       const R *Iu = I + is * (k - 1), *Iv = I + is * k;
+	       R *ba = buf + nbuf * i, *bb = buf + nbuf * (n - i);
+	       for (j = 0; j < nbuf; ++j) {
+		    bb[j] = -Iu[ivs * j];
+		    ba[j] = Iv[ivs * j];
+	       }
+	  }
+	  if (i == n - i) {
+	       const R *Ia = I + is * (n - 1);
+	       R *ba = buf + nbuf * i;
+	       for (j = 0; j < nbuf; ++j)
+		    ba[j] = -Ia[ivs * j];
+	  }
+
+	  cld->apply((plan *) cld, buf, buf);
+
+	  {
+	       R *Oa = O + os * (n - 1);
+	       for (j = 0; j < nbuf; ++j)
+		    Oa[ovs * j] = K(2.0) * buf[j];
+	  }
+	  for (i = 1; i < n - i; ++i) {
+	       const R *ba = buf + nbuf * i, *bb = buf + nbuf * (n - i);
+	       R *Oa = O + os * (n - 1 - i), *Ob = O + os * (i - 1);
+	       E wa = K(2.0) * W[2*i], wb = K(2.0) * W[2*i + 1];
+	       for (j = 0; j < nbuf; ++j) {
+		    E a = ba[j], b = bb[j];
+		    Oa[ovs * j] = wa * a + wb * b;
+		    Ob[ovs * j] = wb * a - wa * b;
+	       }
+	  }
+	  if (i == n - i) {
+	       const R *ba = buf + nbuf * i;
+	       R *Oa = O + os * (i - 1);
+	       E w = K(2.0) * W[2*i];
+	       for (j = 0; j < nbuf; ++j)
+		    Oa[ovs * j] = w * ba[j];
+	  }
+     }
+
+     X(scratch_put)(&ego->scr, buf);
+
+     cldrest = (plan_rdft *) ego->cldrest;
+     cldrest->apply((plan *) cldrest, I, O);
+}
+
+static void awake(plan *ego_, enum wakefulness wakefulness)
+{
+     P *ego = (P *) ego_;
+     static const tw_instr reodft010e_tw[] = {
+          { TW_COS, 0, 1 },
+          { TW_SIN, 0, 1 },
+          { TW_NEXT, 1, 0 }
+     };
+
+     X(plan_awake)(ego->cld, wakefulness);
+     X(plan_awake)(ego->cldrest, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
+
+     X(twiddle_awake)(wakefulness, &ego->td, reodft010e_tw,
+		      4*ego->n, 1, ego->n/2+1);
+}
+
+static void destroy(plan *ego_)
+{
+     P *ego = (P *) ego_;
+     X(plan_destroy_internal)(ego->cldrest);
+     X(plan_destroy_internal)(ego->cld);
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *) ego_;
+     p->print(p, "(%se-r2hc-batch-%D/%D%v%(%p%)%(%p%))",
+	      X(rdft_kind_str)(ego->kind), ego->n, ego->nbuf, ego->vl,
+	      ego->cld, ego->cldrest);
+}
+
+/* number of vectors per block, a multiple of BATCH, or 0 if VL is
+   too short for a block */
+static INT batch_nbuf(INT n, INT vl, size_t maxnbuf_ndx)
+{
+     INT nbuf = X(nbuf)(n, vl, maxnbufs[maxnbuf_ndx]);
+     return nbuf - nbuf % BATCH;
+}
+
+static int applicable0(const S *ego, const problem *p_)
+{
+     const problem_rdft *p = (const problem_rdft *) p_;
+     INT n, vl, ivs, ovs, nbuf;
+
+     if (!(1
+	   && p->sz->rnk == 1
+	   && p->vecsz->rnk == 1
+	   && (p->kind[0] == REDFT01 || p->kind[0] == REDFT10
+	       || p->kind[0] == RODFT01 || p->kind[0] == RODFT10)
+	      ))
+	  return 0;
+
+     n = p->sz->dims[0].n;
+     X(tensor_tornk1)(p->vecsz, &vl, &ivs, &ovs);
+
+     nbuf = batch_nbuf(n, vl, ego->maxnbuf_ndx);
+     if (nbuf == 0)
+	  return 0;
+
+     /* prune this solver if one of lower index yields the same blocks */
+     if (ego->maxnbuf_ndx > 0
+	 && batch_nbuf(n, vl, ego->maxnbuf_ndx - 1) == nbuf)
+	  return 0;
+
+     /* a block of output must not overwrite the input of later blocks */
+     return (p->I != p->O || X(tensor_inplace_strides2)(p->sz, p->vecsz));
+}
+
+static int applicable(const S *ego, const problem *p, const planner *plnr)
+{
+     return (!NO_SLOWP(plnr) && applicable0(ego, p));
+}
+
+static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
+{
+     const S *ego = (const S *) ego_;
+     P *pln;
+     const problem_rdft *p;
+     plan *cld = (plan *) 0, *cldrest = (plan *) 0;
+     R *buf;
+     INT n, vl, ivs, ovs, nbuf;
+     opcnt ops;
+
+     static const plan_adt padt = {
+	  X(rdft_solve), awake, print, destroy
+     };
+
+     if (!applicable(ego, p_, plnr))
+          return (plan *)0;
+
+     p = (const problem_rdft *) p_;
+
+     n = p->sz->dims[0].n;
+     X(tensor_tornk1)(p->vecsz, &vl, &ivs, &ovs);
+     nbuf = batch_nbuf(n, vl, ego->maxnbuf_ndx);
+
+     /* initial allocation for the purpose of planning */
+     buf = (R *) MALLOC(sizeof(R) * n * nbuf, BUFFERS);
+
+     cld = X(mkplan_d)(plnr, X(mkproblem_rdft_1_d)(
+			    X(mktensor_1d)(n, nbuf, nbuf),
+			    X(mktensor_1d)(nbuf, 1, 1),
+			    buf, buf, R2HC));
+     X(ifree)(buf);
+     if (!cld)
+	  goto nada;
+
+     /* plan the leftover transforms (cldrest): */
+     {
+	  INT id = ivs * (nbuf * (vl / nbuf));
+	  INT od = ovs * (nbuf * (vl / nbuf));
+	  cldrest = X(mkplan_d)(plnr,
+				X(mkproblem_rdft_d)(
+				     X(tensor_copy)(p->sz),
+				     X(mktensor_1d)(vl % nbuf, ivs, ovs),
+				     p->I + id, p->O + od, p->kind));
+     }
+     if (!cldrest)
+	  goto nada;
+
+     switch (p->kind[0]) {
+	 case REDFT01: pln = MKPLAN_RDFT(P, &padt, apply_re01); break;
+	 case REDFT10: pln = MKPLAN_RDFT(P, &padt, apply_re10); break;
+	 case RODFT01: pln = MKPLAN_RDFT(P, &padt, apply_ro01); break;
+	 case RODFT10: pln = MKPLAN_RDFT(P, &padt, apply_ro10); break;
+	 default: A(0); goto nada;
+     }
+
+     pln->n = n;
+     pln->nbuf = nbuf;
+     X(scratch_init)(&pln->scr, sizeof(R) * n * nbuf);
+     pln->is = p->sz->dims[0].is;
+     pln->os = p->sz->dims[0].os;
+     pln->vl = vl;
+     pln->ivs = ivs;
+     pln->ovs = ovs;
+     pln->cld = cld;
+     pln->cldrest = cldrest;
+     pln->td = 0;
+     pln->kind = p->kind[0];
+
+     X(ops_zero)(&ops);
+     ops.other = 4 + (n-1)/2 * 10 + (1 - n % 2) * 5;
+     if (p->kind[0] == REDFT01 || p->kind[0] == RODFT01) {
+	  ops.add = (n-1)/2 * 6;
+	  ops.mul = (n-1)/2 * 4 + (1 - n % 2) * 2;
+     }
+     else { /* 10 transforms */
+	  ops.add = (n-1)/2 * 2;
+	  ops.mul = 1 + (n-1)/2 * 6 + (1 - n % 2) * 2;
+     }
+
+     X(ops_zero)(&pln->super.super.ops);
+     X(ops_madd2)(vl - vl % nbuf, &ops, &pln->super.super.ops);
+     X(ops_madd2)(vl / nbuf, &cld->ops, &pln->super.super.ops);
+     X(ops_add2)(&cldrest->ops, &pln->super.super.ops);
+
+     return &(pln->super.super);
+
+ nada:
+     X(plan_destroy_internal)(cldrest);
+     X(plan_destroy_internal)(cld);
+     return (plan *) 0;
+}
+
+/* constructor */
+static solver *mksolver(size_t maxnbuf_ndx)
+{
+     static const solver_adt sadt = { PROBLEM_RDFT, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     slv->maxnbuf_ndx = maxnbuf_ndx;
+     return &(slv->super);
+}
+
+void X(reodft010e_r2hc_batch_register)(planner *p)
+{
+     size_t i;
+     for (i = 0; i < NELEM(maxnbufs); ++i)
+	  REGISTER_SOLVER(p, mksolver(i));
+}
@@ -38,6 +38,7 @@ typedef struct {
      INT vl;
      INT ivs, ovs;
      rdft_kind kind;
+     scratch scr;
 } P;
 
 /* A real-even-01 DFT operates logically on a size-4N array:
@@ -95,7 +96,7 @@ static void apply_re01(const plan *ego_, R *I, R *O)
      R *W = ego->td->W;
      R *buf;
 
-     buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+     buf = X(scratch_get)(&ego->scr);
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  buf[0] = I[0];
@@ -134,7 +135,7 @@ static void apply_re01(const plan *ego_, R *I, R *O)
 	  }
      }
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 /* ro01 is same as re01, but with i <-> n - 1 - i in the input and
@@ -152,7 +153,7 @@ static void apply_ro01(const plan *ego_, R *I, R *O)
      R *W = ego->td->W;
      R *buf;
 
-     buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+     buf = X(scratch_get)(&ego->scr);
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  buf[0] = I[is * (n - 1)];
@@ -191,7 +192,7 @@ static void apply_ro01(const plan *ego_, R *I, R *O)
 	  }
      }
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 #ifdef AMD_FMV_AUTO
@@ -207,7 +208,7 @@ static void apply_re10(const plan *ego_, R *I, R *O)
      R *W = ego->td->W;
      R *buf;
 
-     buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+     buf = X(scratch_get)(&ego->scr);
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  buf[0] = I[0];
@@ -243,7 +244,7 @@ static void apply_re10(const plan *ego_, R *I, R *O)
 	  }
      }
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 /* ro10 is same as re10, but with i <-> n - 1 - i in the output and
@@ -261,7 +262,7 @@ static void apply_ro10(const plan *ego_, R *I, R *O)
      R *W = ego->td->W;
      R *buf;
 
-     buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+     buf = X(scratch_get)(&ego->scr);
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  buf[0] = I[0];
@@ -297,7 +298,7 @@ static void apply_ro10(const plan *ego_, R *I, R *O)
 	  }
      }
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 static void awake(plan *ego_, enum wakefulness wakefulness)
@@ -310,6 +311,7 @@ static void awake(plan *ego_, enum wakefulness wakefulness)
      };
 
      X(plan_awake)(ego->cld, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
 
      X(twiddle_awake)(wakefulness, &ego->td, reodft010e_tw, 
 		      4*ego->n, 1, ego->n/2+1);
@@ -383,6 +385,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      }
 
      pln->n = n;
+     X(scratch_init)(&pln->scr, sizeof(R) * n);
      pln->is = p->sz->dims[0].is;
      pln->os = p->sz->dims[0].os;
      pln->cld = cld;
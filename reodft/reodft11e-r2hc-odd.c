@@ -57,6 +57,7 @@ typedef struct {
      INT vl;
      INT ivs, ovs;
      rdft_kind kind;
+     scratch scr;
 } P;
 
 static DK(SQRT2, +1.4142135623730950488016887242096980785696718753769);
@@ -75,7 +76,7 @@ static void apply_re11(const plan *ego_, R *I, R *O)
      INT ivs = ego->ivs, ovs = ego->ovs;
      R *buf;
 
-     buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+     buf = X(scratch_get)(&ego->scr);
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  {
@@ -130,7 +131,7 @@ static void apply_re11(const plan *ego_, R *I, R *O)
 	  O[os * n2] = SQRT2 * SGN_SET(buf[0], (n2+1)/2);
      }
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 /* like for rodft01, rodft11 is obtained from redft11 by
@@ -147,7 +148,7 @@ static void apply_ro11(const plan *ego_, R *I, R *O)
      INT ivs = ego->ivs, ovs = ego->ovs;
      R *buf;
 
-     buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+     buf = X(scratch_get)(&ego->scr);
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  {
@@ -204,13 +205,14 @@ static void apply_ro11(const plan *ego_, R *I, R *O)
 	  O[os * n2] = SQRT2 * SGN_SET(buf[0], (n2+1)/2 + n2);
      }
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 static void awake(plan *ego_, enum wakefulness wakefulness)
 {
      P *ego = (P *) ego_;
      X(plan_awake)(ego->cld, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
 }
 
 static void destroy(plan *ego_)
@@ -274,6 +276,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 
      pln = MKPLAN_RDFT(P, &padt, p->kind[0]==REDFT11 ? apply_re11:apply_ro11);
      pln->n = n;
+     X(scratch_init)(&pln->scr, sizeof(R) * n);
      pln->is = p->sz->dims[0].is;
      pln->os = p->sz->dims[0].os;
      pln->cld = cld;
@@ -48,6 +48,7 @@ typedef struct {
      INT vl;
      INT ivs, ovs;
      rdft_kind kind;
+     scratch scr;
 } P;
 
 static void apply_re11(const plan *ego_, R *I, R *O)
@@ -61,7 +62,7 @@ static void apply_re11(const plan *ego_, R *I, R *O)
      R *buf;
      E cur;
 
-     buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+     buf = X(scratch_get)(&ego->scr);
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  /* I wish that this didn't require an extra pass. */
@@ -110,7 +111,7 @@ static void apply_re11(const plan *ego_, R *I, R *O)
 	  }
      }
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 /* like for rodft01, rodft11 is obtained from redft11 by
@@ -126,7 +127,7 @@ static void apply_ro11(const plan *ego_, R *I, R *O)
      R *buf;
      E cur;
 
-     buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+     buf = X(scratch_get)(&ego->scr);
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  /* I wish that this didn't require an extra pass. */
@@ -175,7 +176,7 @@ static void apply_ro11(const plan *ego_, R *I, R *O)
 	  }
      }
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 static void awake(plan *ego_, enum wakefulness wakefulness)
@@ -192,6 +193,7 @@ static void awake(plan *ego_, enum wakefulness wakefulness)
      };
 
      X(plan_awake)(ego->cld, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
 
      X(twiddle_awake)(wakefulness,
 		      &ego->td, reodft010e_tw, 4*ego->n, 1, ego->n/2+1);
@@ -260,6 +262,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 
      pln = MKPLAN_RDFT(P, &padt, p->kind[0]==REDFT11 ? apply_re11:apply_ro11);
      pln->n = n;
+     X(scratch_init)(&pln->scr, sizeof(R) * n);
      pln->is = p->sz->dims[0].is;
      pln->os = p->sz->dims[0].os;
      pln->cld = cld;
@@ -54,6 +54,7 @@ typedef struct {
      INT vl;
      INT ivs, ovs;
      rdft_kind kind;
+     scratch scr;
 } P;
 
 static void apply_re11(const plan *ego_, R *I, R *O)
@@ -67,7 +68,7 @@ static void apply_re11(const plan *ego_, R *I, R *O)
      R *W2;
      R *buf;
 
-     buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+     buf = X(scratch_get)(&ego->scr);
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  buf[0] = K(2.0) * I[0];
@@ -180,7 +181,7 @@ static void apply_re11(const plan *ego_, R *I, R *O)
 	  }
      }
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 #if 0
@@ -200,7 +201,7 @@ static void apply_re11(const plan *ego_, R *I, R *O)
      R *W;
      R *buf;
 
-     buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+     buf = X(scratch_get)(&ego->scr);
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  buf[0] = K(2.0) * I[0];
@@ -257,7 +258,7 @@ static void apply_re11(const plan *ego_, R *I, R *O)
 	  }
      }
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 #endif /* 0 */
@@ -275,7 +276,7 @@ static void apply_ro11(const plan *ego_, R *I, R *O)
      R *W2;
      R *buf;
 
-     buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+     buf = X(scratch_get)(&ego->scr);
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  buf[0] = K(2.0) * I[is * (n - 1)];
@@ -388,7 +389,7 @@ static void apply_ro11(const plan *ego_, R *I, R *O)
 	  }
      }
 
-     X(ifree)(buf);
+     X(scratch_put)(&ego->scr, buf);
 }
 
 static void awake(plan *ego_, enum wakefulness wakefulness)
@@ -406,6 +407,7 @@ static void awake(plan *ego_, enum wakefulness wakefulness)
      };
 
      X(plan_awake)(ego->cld, wakefulness);
+     X(scratch_awake)(&ego->scr, wakefulness);
 
      X(twiddle_awake)(wakefulness, &ego->td, reodft010e_tw, 
 		      2*ego->n, 1, ego->n/4+1);
@@ -474,6 +476,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 
      pln = MKPLAN_RDFT(P, &padt, p->kind[0]==REDFT11 ? apply_re11:apply_ro11);
      pln->n = n;
+     X(scratch_init)(&pln->scr, sizeof(R) * n);
      pln->is = p->sz->dims[0].is;
      pln->os = p->sz->dims[0].os;
      pln->cld = cld;
@@ -61,16 +61,9 @@ int X(have_simd_avx)(void)
 #endif
 
 #ifdef AMD_OPT_TRANS
-#if defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64)
-#    include "amd64-cpuid.h"
-#else
-#    include "x86-cpuid.h"
-#endif
 void X(enquire_L1DcacheSize) (void)
 {
-	int eax, ebx, ecx, edx;
-	cpuid_all(0x80000005,0,&eax,&ebx,&ecx,&edx);
-	L1Dsize = ((ecx >> 24) & 0xFF)*1024;
+	L1Dsize = (unsigned int)X(imin)(CACHESIZE, (INT)X(cache_size)(1)); //probed (or overridden) L1D size, bounded by the static buffers
 	L1D_blk_size = X(isqrt)((L1Dsize/(2*8))); //where 2 is no. of tiles and 8 is double data type (may be use (INT)sizeof(R))
 	L1D_blk_size = L1D_blk_size&0xFF0; //block size is chosen that is multiple of 16/8, currently chosen that is multiple of 16.
 }
@@ -0,0 +1,920 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2019-2021, Advanced Micro Devices, Inc. All Rights Reserved.
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+#
+
+# Generator of REDFT/RODFT codelets, taking the options of
+# genfft/gen_r2r.native that matter for them, for hosts without an
+# OCaml toolchain.  As in genfft, the trigonometric transform of size
+# n is written as a complex DFT of size 2(n-1), 2(n+1), 4n or 8n of a
+# symmetric real sequence, the DFT is expanded into a dag by
+# split-radix and prime-factor algorithms, and the dag is simplified
+# (zeros and unit constants, negations pushed into the operators,
+# common subexpressions) before dead code is removed.  The output
+# follows the layout of gen_r2r, so that support/vectorize-r2c.py can
+# turn it into a SIMD codelet.
+#
+# usage: gen-r2r.py [-fma] -redft10 -n 16 -name e10_16 -include rdft/scalar/r2r.h
+
+import random
+import sys
+from decimal import Decimal, getcontext
+from fractions import Fraction
+
+getcontext().prec = 80
+
+class Error(Exception):
+    pass
+
+######################################################################
+# trigonometry in high precision
+
+def dpi():
+    # from the documentation of the decimal module
+    getcontext().prec += 2
+    three = Decimal(3)
+    lasts, t, s, n, na, d, da = 0, three, 3, 1, 0, 0, 24
+    while s != lasts:
+        lasts = s
+        n, na = n + na, na + 8
+        d, da = d + da, da + 32
+        t = (t * n) / d
+        s += t
+    getcontext().prec -= 2
+    return +s
+
+PI = dpi()
+
+def dcos(x):
+    getcontext().prec += 2
+    i, lasts, s, fact, num, sign = 0, 0, 1, 1, 1, 1
+    while s != lasts:
+        lasts = s
+        i += 2
+        fact *= i * (i - 1)
+        num *= x * x
+        sign *= -1
+        s += num / fact * sign
+    getcontext().prec -= 2
+    return +s
+
+def dsin(x):
+    getcontext().prec += 2
+    i, lasts, s, fact, num, sign = 1, 0, x, 1, x, 1
+    while s != lasts:
+        lasts = s
+        i += 2
+        fact *= i * (i - 1)
+        num *= x * x
+        sign *= -1
+        s += num / fact * sign
+    getcontext().prec -= 2
+    return +s
+
+def trig(t):
+    """(cos 2 pi t, sin 2 pi t) for a rational number of turns T,
+    exact at multiples of 1/4 and symmetric at multiples of 1/8"""
+    t = t - (t.numerator // t.denominator)
+    q = int(t * 4)
+    r = t - Fraction(q, 4)
+    if r == 0:
+        c, s = Decimal(1), Decimal(0)
+    elif r * 8 < 1:
+        x = 2 * PI * r.numerator / r.denominator
+        c, s = dcos(x), dsin(x)
+    elif r * 8 == 1:
+        c = s = dcos(PI / 4)
+    else:
+        r = Fraction(1, 4) - r
+        x = 2 * PI * r.numerator / r.denominator
+        c, s = dsin(x), dcos(x)
+    for _ in range(q):
+        c, s = -s, c
+    return c, s
+
+######################################################################
+# the dag.  Values are signed references (node, sign), or None for
+# zero; nodes never represent a negation.
+
+class Node:
+    count = 0
+    def __init__(self, op, args, k=None):
+        self.op = op          # 'load', 'add', 'sub', 'mul'
+        self.args = args      # nodes (or the input index of a load)
+        self.k = k            # constant of a 'mul', a positive Decimal
+        Node.count += 1
+        self.id = Node.count
+
+table = {}
+
+def ckey(k):
+    return k.quantize(Decimal(10) ** -40)
+
+def mknode(op, args, k=None):
+    key = (op, tuple(a if op == 'load' else a.id for a in args),
+           None if k is None else ckey(k))
+    n = table.get(key)
+    if n is None:
+        n = table[key] = Node(op, args, k)
+    return n
+
+def load(i):
+    return (mknode('load', (i,)), 1)
+
+def neg(x):
+    return None if x is None else (x[0], -x[1])
+
+def add(x, y):
+    if x is None:
+        return y
+    if y is None:
+        return x
+    (a, sa), (b, sb) = x, y
+    if a is b:
+        return mul(Decimal(2 * sa), (a, 1)) if sa == sb else None
+    if sa == sb:
+        if a.id > b.id:
+            a, b = b, a
+        return (mknode('add', (a, b)), sa)
+    if sa < 0:
+        a, b = b, a
+    # a - b
+    if a.id > b.id:
+        return (mknode('sub', (b, a)), -1)
+    return (mknode('sub', (a, b)), 1)
+
+def sub(x, y):
+    return add(x, neg(y))
+
+def mul(k, x):
+    if x is None or k == 0:
+        return None
+    a, s = x
+    if k < 0:
+        k, s = -k, -s
+    if k == 1:
+        return (a, s)
+    if a.op == 'mul':
+        return mul(k * a.k, (a.args[0], s))
+    return (mknode('mul', (a,), k), s)
+
+# complex values are pairs of values
+
+def cadd(x, y):
+    return (add(x[0], y[0]), add(x[1], y[1]))
+
+def csub(x, y):
+    return (sub(x[0], y[0]), sub(x[1], y[1]))
+
+def ctimesi(x, sign):
+    # sign * i * x
+    re, im = x
+    return (mul(Decimal(-sign), im), mul(Decimal(sign), re))
+
+def twiddle(t, x, scale=1):
+    """scale * exp(2 pi i t) * x"""
+    c, s = trig(t)
+    c, s = c * scale, s * scale
+    re, im = x
+    if c != 0 and s != 0 and abs(c) == abs(s):
+        sc = 1 if c > 0 else -1
+        ss = 1 if s > 0 else -1
+        k = abs(c)
+        return (mul(k, add(mul(Decimal(sc), re), mul(Decimal(-ss), im))),
+                mul(k, add(mul(Decimal(sc), im), mul(Decimal(ss), re))))
+    return (add(mul(c, re), mul(-s, im)), add(mul(c, im), mul(s, re)))
+
+def smallest_factor(n):
+    p = 2
+    while p * p <= n:
+        if n % p == 0:
+            return p
+        p += 1
+    return n
+
+def dft(x, sign):
+    """sum_j x_j exp(sign 2 pi i j k / N)"""
+    N = len(x)
+    if N == 1:
+        return list(x)
+    if N == 2:
+        return [cadd(x[0], x[1]), csub(x[0], x[1])]
+    if N % 4 == 0:
+        # split radix
+        u = dft(x[0::2], sign)
+        z = dft(x[1::4], sign)
+        z3 = dft(x[3::4], sign)
+        X = [None] * N
+        q = N // 4
+        for k in range(q):
+            a = twiddle(Fraction(sign * k, N), z[k])
+            b = twiddle(Fraction(sign * 3 * k, N), z3[k])
+            s = cadd(a, b)
+            d = ctimesi(csub(a, b), sign)
+            X[k] = cadd(u[k], s)
+            X[k + 2 * q] = csub(u[k], s)
+            X[k + q] = cadd(u[k + q], d)
+            X[k + 3 * q] = csub(u[k + q], d)
+        return X
+    p = smallest_factor(N)
+    if p == N:
+        return dft_prime(x, sign)
+    # Cooley-Tukey, decimation in time
+    m = N // p
+    sub_ = [dft(x[r::p], sign) for r in range(p)]
+    X = [None] * N
+    for k1 in range(m):
+        t = [twiddle(Fraction(sign * r * k1, N), sub_[r][k1])
+             for r in range(p)]
+        T = dft(t, sign)
+        for k2 in range(p):
+            X[k1 + m * k2] = T[k2]
+    return X
+
+def dft_prime(x, sign):
+    N = len(x)
+    h = (N - 1) // 2
+    A = [cadd(x[j], x[N - j]) for j in range(1, h + 1)]
+    B = [csub(x[j], x[N - j]) for j in range(1, h + 1)]
+    X = [None] * N
+    s0 = x[0]
+    for a in A:
+        s0 = cadd(s0, a)
+    X[0] = s0
+    for k in range(1, h + 1):
+        P = x[0]
+        Q = (None, None)
+        for j in range(1, h + 1):
+            c, s = trig(Fraction(j * k, N))
+            P = cadd(P, (mul(c, A[j - 1][0]), mul(c, A[j - 1][1])))
+            Q = cadd(Q, (mul(s, B[j - 1][0]), mul(s, B[j - 1][1])))
+        iQ = ctimesi(Q, sign)
+        X[k] = cadd(P, iQ)
+        X[N - k] = csub(P, iQ)
+    return X
+
+######################################################################
+# trigonometric transforms.  Each function maps a list of input values
+# to the list of output values.
+
+def generic(kind, x):
+    """KIND as the DFT of a symmetric real sequence, as in genfft"""
+    n = len(x)
+    real = lambda v: (v, None)
+    if kind == 'redft00':
+        N = 2 * (n - 1)
+        z = [None] * N
+        for j in range(n):
+            z[j] = real(x[j])
+        for j in range(1, n - 1):
+            z[N - j] = real(x[j])
+        X = dft(z, -1)
+        return [X[k][0] for k in range(n)]
+    if kind == 'rodft00':
+        N = 2 * (n + 1)
+        z = [(None, None)] * N
+        for j in range(n):
+            z[j + 1] = real(x[j])
+            z[N - j - 1] = real(neg(x[j]))
+        X = dft(z, 1)
+        return [X[k + 1][1] for k in range(n)]
+    if kind in ('redft11', 'rodft11'):
+        N = 8 * n
+        z = [(None, None)] * N
+        for j in range(n):
+            z[2 * j + 1] = real(x[j])
+            z[N - 2 * j - 1] = real(x[j] if kind == 'redft11'
+                                    else neg(x[j]))
+        if kind == 'redft11':
+            X = dft(z, -1)
+            return [X[2 * k + 1][0] for k in range(n)]
+        X = dft(z, 1)
+        return [X[2 * k + 1][1] for k in range(n)]
+    raise Error('no generic algorithm for ' + kind)
+
+def redft10(x):
+    """Makhoul's algorithm: a real DFT of the even elements followed by
+    the reversed odd elements, and a twiddle of each output"""
+    n = len(x)
+    v = [None] * n
+    for j in range(0, n, 2):
+        v[j // 2] = (x[j], None)
+    for j in range(1, n, 2):
+        v[n - 1 - j // 2] = (x[j], None)
+    V = dft(v, -1)
+    return [twiddle(Fraction(-k, 4 * n), V[k], 2)[0] for k in range(n)]
+
+def alternate(x):
+    return [x[j] if j % 2 == 0 else neg(x[j]) for j in range(len(x))]
+
+def rodft10(x):
+    # RODFT10(x)_k = REDFT10((-1)^j x_j)_{n-1-k}
+    return redft10(alternate(x))[::-1]
+
+def transposed(f, n, scale):
+    """the transpose of the linear map F of size N, with input j
+    scaled by SCALE[j], obtained by network transposition"""
+    outs = f([load(j) for j in range(n)])
+    adj = {}
+    nodes = {}
+    def visit(a):
+        if a.id not in nodes:
+            nodes[a.id] = a
+            if a.op != 'load':
+                for b in a.args:
+                    visit(b)
+    for o in outs:
+        if o is not None:
+            visit(o[0])
+    for k, o in enumerate(outs):
+        if o is not None:
+            a, s = o
+            y = mul(Decimal(s) * scale.get(k, 1), load(k))
+            adj[a.id] = add(adj.get(a.id), y)
+    res = [None] * n
+    for i in sorted(nodes, reverse=True):
+        a = nodes[i]
+        y = adj.pop(i, None)
+        if y is None:
+            continue
+        if a.op == 'load':
+            res[a.args[0]] = y
+        elif a.op == 'mul':
+            b = a.args[0]
+            adj[b.id] = add(adj.get(b.id), mul(a.k, y))
+        else:
+            b, c = a.args
+            adj[b.id] = add(adj.get(b.id), y)
+            adj[c.id] = add(adj.get(c.id),
+                            y if a.op == 'add' else neg(y))
+    return res
+
+def substitute(outs, x):
+    """OUTS with load(j) replaced by the value X[j]"""
+    memo = {}
+    def sub1(a):
+        v = memo.get(a.id, 0)
+        if v != 0:
+            return v
+        if a.op == 'load':
+            v = x[a.args[0]]
+        elif a.op == 'mul':
+            v = mul(a.k, sub1(a.args[0]))
+        elif a.op == 'add':
+            v = add(sub1(a.args[0]), sub1(a.args[1]))
+        else:
+            v = sub(sub1(a.args[0]), sub1(a.args[1]))
+        memo[a.id] = v
+        return v
+    return [None if o is None else
+            (lambda v: None if v is None else (v[0], v[1] * o[1]))(sub1(o[0]))
+            for o in outs]
+
+def redft01(x):
+    # REDFT01 = REDFT10^T diag(1/2, 1, ..., 1)
+    n = len(x)
+    return substitute(transposed(redft10, n, {0: Decimal('0.5')}), x)
+
+def rodft01(x):
+    # RODFT01 = RODFT10^T diag(1, ..., 1, 1/2)
+    n = len(x)
+    return substitute(transposed(rodft10, n, {n - 1: Decimal('0.5')}), x)
+
+def redft11(x):
+    """for even n, a complex DFT of size n/2 between two twiddles"""
+    n = len(x)
+    if n % 2:
+        return generic('redft11', x)
+    m = n // 2
+    t = [twiddle(Fraction(-p, 2 * n), (x[2 * p], x[n - 1 - 2 * p]))
+         for p in range(m)]
+    T = dft(t, -1)
+    y = [None] * n
+    for q in range(m):
+        re, im = twiddle(Fraction(-(4 * q + 1), 8 * n), T[q], 2)
+        y[2 * q] = re
+        y[n - 1 - 2 * q] = neg(im)
+    return y
+
+def rodft11(x):
+    # RODFT11(x)_k = REDFT11((-1)^j x_j)_{n-1-k}
+    return redft11(alternate(x))[::-1]
+
+def redft00(x):
+    """for odd n, split into the even outputs, a REDFT00 of size
+    (n+1)/2, and the odd outputs, a REDFT01 of size (n-1)/2"""
+    n = len(x)
+    if n <= 2 or n % 2 == 0:
+        return generic('redft00', x)
+    N = n - 1
+    M = N // 2
+    s = [add(x[j], x[N - j]) for j in range(M)] + [mul(Decimal(2), x[M])]
+    d = [sub(x[j], x[N - j]) for j in range(M)]
+    ye = redft00(s)
+    yo = redft01(d)
+    y = [None] * n
+    y[0::2] = ye
+    y[1::2] = yo
+    return y
+
+def rodft00(x):
+    """for odd n, split into the odd outputs, a RODFT00 of size
+    (n-1)/2, and the even outputs, a RODFT01 of size (n+1)/2"""
+    n = len(x)
+    if n == 1:
+        return [mul(Decimal(2), x[0])]
+    if n % 2 == 0:
+        return generic('rodft00', x)
+    N = n + 1
+    M = N // 2
+    # x[j - 1] is the input of index j = 1 ... N - 1
+    d = [sub(x[j - 1], x[N - j - 1]) for j in range(1, M)]
+    s = ([add(x[j - 1], x[N - j - 1]) for j in range(1, M)]
+         + [mul(Decimal(2), x[M - 1])])
+    yo = rodft00(d) if d else []
+    ye = rodft01(s)
+    y = [None] * n
+    y[0::2] = ye
+    y[1::2] = yo
+    return y
+
+ALGORITHMS = {
+    'redft00': redft00, 'redft01': redft01,
+    'redft10': redft10, 'redft11': redft11,
+    'rodft00': rodft00, 'rodft01': rodft01,
+    'rodft10': rodft10, 'rodft11': rodft11,
+}
+
+def transform(kind, n):
+    """return the list of output values of KIND of size N"""
+    return ALGORITHMS[kind]([load(j) for j in range(n)])
+
+######################################################################
+# signs.  The canonical dag computes either a - b or b - a, and a sum
+# or its negation, in whatever sign the hash-consing found first, so
+# that some outputs come out negated.  Scalar code can afford a
+# negation, but SIMD has none; choose the sign E of every sum and
+# difference so that each node stays one addition or subtraction
+# (not -a - b) and as many outputs as possible are positive.
+
+def polarize(outs):
+    nodes, parents, seen = [], {}, set()
+    def visit(a):
+        if a.id in seen:
+            return
+        seen.add(a.id)
+        if a.op != 'load':
+            for b in a.args:
+                visit(b)
+                parents.setdefault(b.id, []).append(a)
+        nodes.append(a)
+    for o in outs:
+        if o is not None:
+            visit(o[0])
+    e = dict((a.id, 1) for a in nodes if a.op in ('add', 'sub'))
+    def E(a):
+        if a.op == 'load':
+            return 1
+        if a.op == 'mul':
+            return E(a.args[0])
+        return e[a.id]
+    def bad(a):
+        x, y = E(a.args[0]), E(a.args[1])
+        if a.op == 'sub':
+            y = -y
+        return x == y == -e[a.id]
+    def root(a):
+        return a.args[0] if a.op == 'mul' else a
+    # constraints: ('node', a), hard; ('out', a, s), soft
+    cons, uses = [], {}
+    for a in nodes:
+        if a.op in ('add', 'sub'):
+            c = ('node', a)
+            cons.append(c)
+            for b in [a] + [root(x) for x in a.args]:
+                uses.setdefault(b.id, []).append(c)
+    for o in outs:
+        if o is not None and root(o[0]).op in ('add', 'sub'):
+            c = ('out', o[0], o[1])
+            cons.append(c)
+            uses.setdefault(root(o[0]).id, []).append(c)
+    def weight(c):
+        if c[0] == 'node':
+            return 8 if bad(c[1]) else 0
+        return 1 if E(c[1]) != c[2] else 0
+    def vars_of(c):
+        if c[0] == 'out':
+            return [root(c[1])]
+        return [b for b in [c[1]] + [root(x) for x in c[1].args]
+                if b.op in ('add', 'sub')]
+    def delta(b):
+        cs = uses[b.id]
+        before = sum(weight(c) for c in cs)
+        e[b.id] = -e[b.id]
+        after = sum(weight(c) for c in cs)
+        e[b.id] = -e[b.id]
+        return after - before
+    # walksat, seeded for reproducible output
+    rng = random.Random(len(nodes))
+    unsat = [c for c in cons if weight(c)]
+    best, bestcost = dict(e), sum(weight(c) for c in unsat)
+    for step in range(50 * len(cons)):
+        if not unsat:
+            break
+        c = unsat[rng.randrange(len(unsat))]
+        vs = vars_of(c)
+        if rng.random() < 0.3:
+            b = vs[rng.randrange(len(vs))]
+        else:
+            b = min(vs, key=lambda v: (delta(v), v.id))
+        touched = uses[b.id]
+        e[b.id] = -e[b.id]
+        unsat = [x for x in unsat if x not in touched] \
+            + [x for x in touched if weight(x)]
+        cost = sum(weight(x) for x in unsat)
+        if cost < bestcost:
+            best, bestcost = dict(e), cost
+    e.clear()
+    e.update(best)
+
+    # rebuild the dag: R(a) is a signed reference to the value of A
+    memo = {}
+    def R(a):
+        r = memo.get(a.id)
+        if r is not None:
+            return r
+        if a.op == 'load':
+            r = (a, 1)
+        elif a.op == 'mul':
+            x, sx = R(a.args[0])
+            r = (mknode('mul', (x,), a.k), sx)
+        else:
+            (x, sx), (y, sy) = R(a.args[0]), R(a.args[1])
+            s = e[a.id]
+            cx, cy = s * sx, s * sy * (1 if a.op == 'add' else -1)
+            if cx == cy:
+                if x.id > y.id:
+                    x, y = y, x
+                r = (mknode('add', (x, y)), s * cx)
+            elif cx > 0:
+                r = (mknode('sub', (x, y)), s)
+            else:
+                r = (mknode('sub', (y, x)), s)
+        memo[a.id] = r
+        return r
+    res = []
+    for o in outs:
+        if o is None:
+            res.append(None)
+        else:
+            a, s = R(o[0])
+            res.append((a, s * o[1]))
+    return res
+
+######################################################################
+# evaluation, for checking the dag against the definitions
+
+def evaluate(outs, x):
+    memo = {}
+    def ev(a):
+        v = memo.get(a.id)
+        if v is None:
+            if a.op == 'load':
+                v = x[a.args[0]]
+            elif a.op == 'add':
+                v = ev(a.args[0]) + ev(a.args[1])
+            elif a.op == 'sub':
+                v = ev(a.args[0]) - ev(a.args[1])
+            else:
+                v = float(a.k) * ev(a.args[0])
+            memo[a.id] = v
+        return v
+    return [0.0 if o is None else o[1] * ev(o[0]) for o in outs]
+
+def definition(kind, x):
+    import math
+    n = len(x)
+    c, s = math.cos, math.sin
+    if kind == 'redft00':
+        return [x[0] + (-1) ** k * x[n - 1]
+                + 2 * sum(x[j] * c(math.pi * j * k / (n - 1))
+                          for j in range(1, n - 1)) for k in range(n)]
+    if kind == 'rodft00':
+        return [2 * sum(x[j] * s(math.pi * (j + 1) * (k + 1) / (n + 1))
+                        for j in range(n)) for k in range(n)]
+    if kind == 'redft10':
+        return [2 * sum(x[j] * c(math.pi * (j + 0.5) * k / n)
+                        for j in range(n)) for k in range(n)]
+    if kind == 'rodft10':
+        return [2 * sum(x[j] * s(math.pi * (j + 0.5) * (k + 1) / n)
+                        for j in range(n)) for k in range(n)]
+    if kind == 'redft01':
+        return [x[0] + 2 * sum(x[j] * c(math.pi * j * (k + 0.5) / n)
+                               for j in range(1, n)) for k in range(n)]
+    if kind == 'rodft01':
+        return [(-1) ** k * x[n - 1]
+                + 2 * sum(x[j] * s(math.pi * (j + 1) * (k + 0.5) / n)
+                          for j in range(n - 1)) for k in range(n)]
+    if kind == 'redft11':
+        return [2 * sum(x[j] * c(math.pi * (j + 0.5) * (k + 0.5) / n)
+                        for j in range(n)) for k in range(n)]
+    if kind == 'rodft11':
+        return [2 * sum(x[j] * s(math.pi * (j + 0.5) * (k + 0.5) / n)
+                        for j in range(n)) for k in range(n)]
+
+def check(kind, n, outs):
+    import random
+    x = [random.uniform(-1, 1) for _ in range(n)]
+    y = evaluate(outs, x)
+    d = definition(kind, x)
+    err = max(abs(a - b) for a, b in zip(y, d))
+    if err > 1e-10 * n:
+        raise Error('%s of size %d is wrong (error %g)' % (kind, n, err))
+
+######################################################################
+# code generation
+
+DIGITS = '0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ'
+
+def varname(i):
+    s = ''
+    while True:
+        s = DIGITS[i % 62] + s
+        i //= 62
+        if i == 0:
+            return 'T' + s
+
+def kname(k):
+    s = '%.9f' % k.quantize(Decimal(10) ** -9, rounding='ROUND_DOWN')
+    ip, fp = s.split('.')
+    return 'KP' + (fp if ip == '0' else ip + '_' + fp)
+
+def kvalue(k):
+    return '+' + str(k.quantize(Decimal(10) ** -45))
+
+class Codegen:
+    def __init__(self, outs, fma):
+        self.outs = outs
+        self.fma = fma
+        self.nadd = self.nmul = self.nfma = 0
+        self.consts = []
+        self.kseen = set()
+        self.stmts = []
+        self.temps = {}
+        self.nloads = 0
+        # reference counts in the dag reachable from the outputs
+        self.refs = {}
+        self.nodes = []
+        seen = set()
+        def visit(a):
+            self.refs[a.id] = self.refs.get(a.id, 0) + 1
+            if a.id in seen:
+                return
+            seen.add(a.id)
+            if a.op != 'load':
+                for b in a.args:
+                    visit(b)
+            self.nodes.append(a)
+        for o in outs:
+            if o is not None:
+                visit(o[0])
+        # with fma, a product feeding additions is fused into each of
+        # them; count the uses that still need the product itself
+        self.fused = {}
+        self.prodrefs = dict(self.refs)
+        if fma:
+            for a in self.nodes:
+                if a.op in ('add', 'sub'):
+                    f = self.fusable(a)
+                    if f is not None:
+                        self.fused[a.id] = f
+                        self.prodrefs[a.args[f].id] -= 1
+
+    def fusable(self, a):
+        x, y = a.args
+        cands = [i for i in (0, 1) if a.args[i].op == 'mul']
+        if not cands:
+            return None
+        # prefer a product that is not needed otherwise
+        cands.sort(key=lambda i: self.refs[a.args[i].id])
+        return cands[0]
+
+    def const(self, k):
+        name = kname(k)
+        if name not in self.kseen:
+            self.kseen.add(name)
+            self.consts.append((name, kvalue(k)))
+        return name
+
+    def needs_temp(self, a):
+        if a.op == 'load':
+            return True
+        refs = self.prodrefs[a.id] if a.op == 'mul' else self.refs[a.id]
+        return refs > 1
+
+    def expr(self, a):
+        """expression tree computing node A"""
+        t = self.temps.get(a.id)
+        if t is not None:
+            return ('T', t)
+        e = self.build(a)
+        if self.needs_temp(a):
+            t = varname(len(self.temps) + 1)
+            self.temps[a.id] = t
+            self.stmts.append(('set', t, e))
+            return ('T', t)
+        return e
+
+    def build(self, a):
+        if a.op == 'load':
+            self.nloads += 1
+            return ('ld', a.args[0])
+        if a.op == 'mul':
+            self.nmul += 1
+            return ('mul', self.const(a.k), self.expr(a.args[0]))
+        f = self.fused.get(a.id)
+        if f is not None:
+            p = a.args[f]
+            other = self.expr(a.args[1 - f])
+            prod = self.expr(p.args[0])
+            k = self.const(p.k)
+            self.nfma += 1
+            if a.op == 'add':
+                return ('fma', k, prod, other)
+            if f == 1:
+                return ('fnms', k, prod, other)
+            return ('fms', k, prod, other)
+        self.nadd += 1
+        return (a.op, self.expr(a.args[0]), self.expr(a.args[1]))
+
+    def negate(self, e):
+        """expression tree of -E without a negation, or None"""
+        op = e[0]
+        if op == 'sub':
+            return ('sub', e[2], e[1])
+        if op == 'add':
+            for i in (1, 2):
+                m = self.negate(e[i])
+                if m is not None:
+                    return ('sub', m, e[3 - i])
+            return None
+        if op == 'mul':
+            m = self.negate(e[2])
+            return None if m is None else ('mul', e[1], m)
+        if op == 'fms':
+            return ('fnms', e[1], e[2], e[3])
+        if op == 'fnms':
+            return ('fms', e[1], e[2], e[3])
+        if op == 'fma':
+            m = self.negate(e[3])
+            if m is not None:
+                return ('fnms', e[1], e[2], m)
+            m = self.negate(e[2])
+            if m is not None:
+                return ('fms', e[1], m, e[3])
+        return None
+
+    def run(self):
+        # load everything first, so that the codelet works in place
+        for a in sorted((a for a in self.nodes if a.op == 'load'),
+                        key=lambda a: a.args[0]):
+            self.expr(a)
+        for k, o in enumerate(self.outs):
+            if o is None:
+                self.stmts.append(('store', k, ('zero',)))
+                continue
+            a, s = o
+            e = self.expr(a)
+            if s < 0:
+                m = self.negate(e)
+                if m is None:
+                    self.nadd += 1
+                    m = ('neg', e)
+                e = m
+            self.stmts.append(('store', k, e))
+
+def cexpr(e, ctx='top'):
+    op = e[0]
+    if op == 'T':
+        return e[1]
+    if op == 'ld':
+        return 'I[0]' if e[1] == 0 else 'I[WS(is, %d)]' % e[1]
+    if op == 'zero':
+        return 'K(0.0)'
+    if op == 'neg':
+        return '-(%s)' % cexpr(e[1])
+    if op in ('add', 'sub'):
+        s = '%s %s %s' % (cexpr(e[1], 'left'), '+' if op == 'add' else '-',
+                          cexpr(e[2], 'right'))
+        return '(%s)' % s if ctx in ('right', 'factor') else s
+    if op == 'mul':
+        return '%s * %s' % (e[1], cexpr(e[2], 'factor'))
+    return '%s(%s, %s, %s)' % (op.upper(), e[1], cexpr(e[2]), cexpr(e[3]))
+
+def generate(kind, n, name, include, fma, cmdline):
+    table.clear()
+    outs = polarize(transform(kind, n))
+    check(kind, n, outs)
+    g = Codegen(outs, fma)
+    g.run()
+    out = []
+    w = out.append
+    w('/* Generated by: %s */' % cmdline)
+    w('')
+    w('/*')
+    w(' * This function contains %d FP additions, %d FP multiplications,'
+      % (g.nadd + g.nfma, g.nmul + g.nfma))
+    w(' * (or, %d additions, %d multiplications, %d fused multiply/add),'
+      % (g.nadd, g.nmul, g.nfma))
+    w(' * %d stack variables, %d constants, and %d memory accesses'
+      % (len(g.temps), len(g.consts), g.nloads + n))
+    w(' */')
+    w('#include "%s"' % include)
+    w('')
+    w('static void %s(const R *I, R *O, stride is, stride os, '
+      'INT v, INT ivs, INT ovs)' % name)
+    w('{')
+    for k, v in g.consts:
+        w('     DK(%s, %s);' % (k, v))
+    w('     {')
+    w('\t  INT i;')
+    w('\t  for (i = v; i > 0; i = i - 1, I = I + ivs, O = O + ovs, '
+      'MAKE_VOLATILE_STRIDE(%d, is), MAKE_VOLATILE_STRIDE(%d, os)) {'
+      % (2 * n, 2 * n))
+    names = list(g.temps.values())
+    for i in range(0, len(names), 12):
+        w('\t       E %s;' % ', '.join(names[i:i + 12]))
+    for st in g.stmts:
+        if st[0] == 'set':
+            w('\t       %s = %s;' % (st[1], cexpr(st[2])))
+        else:
+            k = st[1]
+            lhs = 'O[0]' if k == 0 else 'O[WS(os, %d)]' % k
+            w('\t       %s = %s;' % (lhs, cexpr(st[2])))
+    w('\t  }')
+    w('     }')
+    w('}')
+    w('')
+    w('static const kr2r_desc desc = { %d, "%s", {%d, %d, %d, 0}, '
+      '&GENUS, %s };' % (n, name, g.nadd, g.nmul, g.nfma, kind.upper()))
+    w('')
+    w('void X(codelet_%s) (planner *p) {' % name)
+    w('     X(kr2r_register) (p, %s, &desc);' % name)
+    w('}')
+    return '\n'.join(out)
+
+KINDS = ('redft00', 'redft01', 'redft10', 'redft11',
+         'rodft00', 'rodft01', 'rodft10', 'rodft11')
+
+def main(argv):
+    fma = False
+    kind = n = name = include = None
+    args = argv[1:]
+    try:
+        while args:
+            a = args.pop(0)
+            if a == '-fma':
+                fma = True
+            elif a[1:] in KINDS:
+                kind = a[1:]
+            elif a == '-n':
+                n = int(args.pop(0))
+            elif a == '-name':
+                name = args.pop(0)
+            elif a == '-include':
+                include = args.pop(0)
+            elif a in ('-compact',):
+                pass
+            elif a in ('-variables', '-pipeline-latency'):
+                args.pop(0)
+            else:
+                raise Error('unknown option ' + a)
+        if not (kind and n and name and include):
+            raise Error('usage: gen-r2r.py [-fma] -<kind> -n <size> '
+                        '-name <name> -include <header>')
+        if (kind == 'redft00' and n < 2) or n < 1:
+            raise Error('size %d too small' % n)
+        cmdline = ' '.join(['../../../support/gen-r2r.py'] + argv[1:])
+        sys.stdout.write(generate(kind, n, name, include, fma, cmdline)
+                         + '\n')
+    except Error as e:
+        sys.stderr.write('gen-r2r.py: %s\n' % e)
+        return 1
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
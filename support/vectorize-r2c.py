@@ -0,0 +1,279 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2019-2021, Advanced Micro Devices, Inc. All Rights Reserved.
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+#
+
+# Turn a scalar r2cf/r2cb codelet generated by genfft, or an r2r
+# codelet generated by gen-r2r.py, into a SIMD codelet that computes
+# 2*VL transforms at once, one per vector lane.  Lane j of a vector
+# holds element k of transform i+j, so the codelet requires the vector
+# stride to be 1 in both input and output; see XSIMD(rdft_r2cfv_genus)
+# and XSIMD(rdft_r2rv_genus) in rdft/simd/common/genus.c.
+#
+# The arithmetic of both FMA and non-FMA variants is kept as the
+# generator scheduled it; only the types, loads, stores and operators
+# change.
+#
+# usage: vectorize-r2c.py -name r2cfv_8 -include rdft/simd/r2cfv.h r2cf_8.c
+#        vectorize-r2c.py -name e10v_8 -include rdft/simd/r2rv.h e10_8.c
+
+import re
+import sys
+
+class Error(Exception):
+    pass
+
+TOKEN = re.compile(r'\s*(?:([A-Za-z_][A-Za-z_0-9]*)|([0-9]+)|(.))')
+
+def tokenize(s):
+    toks = []
+    pos = 0
+    s = s.rstrip()
+    while pos < len(s):
+        m = TOKEN.match(s, pos)
+        if not m:
+            raise Error('cannot tokenize: ' + s)
+        pos = m.end()
+        toks.append(m.group(1) or m.group(2) or m.group(3))
+    return toks
+
+class Parser:
+    # expressions are trees of tuples (op, args...), printed by unparse()
+    FUNS = {'FMA': 'VFMA', 'FMS': 'VFMS', 'FNMS': 'VFNMS', 'FNMA': 'FNMA'}
+
+    def __init__(self, toks, arrays):
+        self.toks = toks
+        self.i = 0
+        self.arrays = arrays
+
+    def peek(self):
+        return self.toks[self.i] if self.i < len(self.toks) else None
+
+    def next(self):
+        t = self.peek()
+        self.i += 1
+        return t
+
+    def expect(self, t):
+        if self.next() != t:
+            raise Error('expected ' + t + ' in ' + ' '.join(self.toks))
+
+    def expr(self):
+        e = self.term()
+        while self.peek() in ('+', '-'):
+            op = 'VADD' if self.next() == '+' else 'VSUB'
+            t = self.term()
+            if t[0] == 'FNMA':
+                # e + FNMA(a, b, c) = (e - a * b) - c
+                if op != 'VADD':
+                    raise Error('cannot subtract FNMA')
+                e = ('VSUB', ('VFNMS', t[1], t[2], e), t[3])
+            else:
+                e = (op, e, t)
+        if e[0] == 'FNMA':
+            raise Error('FNMA outside of a sum')
+        return e
+
+    def term(self):
+        e = self.factor()
+        while self.peek() == '*':
+            self.next()
+            e = ('VMUL', e, self.factor())
+        return e
+
+    def factor(self):
+        t = self.next()
+        if t == '(':
+            e = self.expr()
+            self.expect(')')
+            return e
+        if t == '-':
+            return negate(self.factor())
+        if t in self.FUNS:
+            self.expect('(')
+            a = self.expr()
+            self.expect(',')
+            b = self.expr()
+            self.expect(',')
+            c = self.expr()
+            self.expect(')')
+            return (self.FUNS[t], a, b, c)
+        if t in self.arrays:
+            return ('LDA', self.memref(t), t)
+        if t.startswith('KP'):
+            return ('LDK', t)
+        if re.match(r'T[0-9A-Za-z]+$', t):
+            return ('VAR', t)
+        raise Error('unexpected token ' + str(t))
+
+    def memref(self, a):
+        # a[index], with index copied verbatim
+        self.expect('[')
+        depth, idx = 1, []
+        while True:
+            t = self.next()
+            if t is None:
+                raise Error('unterminated index')
+            if t == '[':
+                depth += 1
+            elif t == ']':
+                depth -= 1
+                if depth == 0:
+                    break
+            idx.append(t)
+        index = ''.join(idx).replace(',', ', ')
+        return '&(%s[%s])' % (a, index)
+
+def negate(e):
+    # SIMD has no negation; push the sign into the operators
+    op = e[0]
+    if op == 'VMUL':
+        if e[1][0] == 'LDK':
+            return ('VMUL', e[1], negate(e[2]))
+        return ('VMUL', negate(e[1]), e[2])
+    if op == 'VSUB':
+        return ('VSUB', e[2], e[1])
+    if op == 'VFNMS':
+        return ('VFMS', e[1], e[2], e[3])
+    if op == 'VFMS':
+        return ('VFNMS', e[1], e[2], e[3])
+    if op == 'VADD':
+        # -(a + b) = (-a) - b
+        for a, b in ((e[1], e[2]), (e[2], e[1])):
+            try:
+                return ('VSUB', negate(a), b)
+            except Error:
+                pass
+    if op == 'VFMA':
+        # -(a * b + c) = (-c) - a * b
+        try:
+            return ('VFNMS', e[1], e[2], negate(e[3]))
+        except Error:
+            pass
+    raise Error('cannot negate ' + op)
+
+def unparse(e):
+    op = e[0]
+    if op == 'VAR':
+        return e[1]
+    if op == 'LDK':
+        return 'LDK(%s)' % e[1]
+    if op == 'LDA':
+        return 'LDA(%s, ivs, &(%s[0]))' % (e[1], e[2])
+    return '%s(%s)' % (op, ', '.join(unparse(a) for a in e[1:]))
+
+def convert_stmt(line, inputs, outputs):
+    m = re.match(r'^(\s*)(.*?)\s*=\s*(.*);\s*$', line)
+    indent, lhs, rhs = m.group(1), m.group(2), m.group(3)
+    rhs = unparse(Parser(tokenize(rhs), inputs).expr())
+    lm = re.match(r'^([A-Za-z_0-9]+)\[(.*)\]$', lhs)
+    if lm:
+        a = lm.group(1)
+        if a not in outputs:
+            raise Error('store to input array ' + a)
+        return '%sSTA(&(%s[%s]), %s, ovs, &(%s[0]));' % (
+            indent, a, lm.group(2), rhs, a)
+    return '%s%s = %s;' % (indent, lhs, rhs)
+
+def convert_variant(lines, name, include, oldname, inputs, outputs):
+    out = []
+    for line in lines:
+        s = line.strip()
+        if s.startswith('/* Generated by:'):
+            out.append('/* Generated by: ../../../support/vectorize-r2c.py '
+                       '-name %s -include %s from: %s */'
+                       % (name, include, s[len('/* Generated by: '):-3]))
+        elif s.startswith('#include "rdft/scalar/'):
+            out.append('#include "%s"' % include)
+        elif s.startswith('static void ' + oldname + '('):
+            out.append(line.replace(oldname, name, 1))
+        elif s.startswith('DK('):
+            out.append(line.replace('DK(', 'DVK(', 1))
+        elif s.startswith('for (i = v;'):
+            line = line.replace('i = i - 1', 'i = i - (2 * VL)')
+            line = re.sub(r'(R0|R1|Cr|Ci|I|O) = \1 \+ (ivs|ovs)',
+                          r'\1 = \1 + ((2 * VL) * \2)', line)
+            out.append(line)
+        elif s.startswith('E '):
+            out.append(line.replace('E ', 'V ', 1))
+        elif s.startswith('static const kr2c_desc desc') \
+             or s.startswith('static const kr2r_desc desc'):
+            line = line.replace('"%s"' % oldname,
+                                'XSIMD_STRING("%s")' % name)
+            out.append(line)
+        elif s.startswith('void X(codelet_' + oldname + ')'):
+            out.append('void XSIMD(codelet_%s) (planner *p) {' % name)
+        elif s.startswith('X(kr2c_register)') \
+             or s.startswith('X(kr2r_register)'):
+            out.append(line.replace(oldname, name))
+        elif re.match(r'^[A-Za-z_0-9]+(\[.*\])?\s*=.*;$', s) \
+             and not s.startswith('INT '):
+            out.append(convert_stmt(line, inputs, outputs))
+        else:
+            out.append(line)
+    # VLEAVE() after the loop: the loop body closes with two braces
+    # at the indentation of "INT i;" minus one level.
+    res = []
+    i = 0
+    while i < len(out):
+        res.append(out[i])
+        if out[i].startswith('static void ' + name + '('):
+            # find the end of the function
+            j = i + 1
+            while out[j] != '}':
+                res.append(out[j])
+                j += 1
+            # insert VLEAVE before the closing brace
+            res.append('     VLEAVE();')
+            res.append(out[j])
+            i = j
+        i += 1
+    return res
+
+def main(argv):
+    name = include = src = None
+    args = argv[1:]
+    while args:
+        a = args.pop(0)
+        if a == '-name':
+            name = args.pop(0)
+        elif a == '-include':
+            include = args.pop(0)
+        else:
+            src = a
+    if not (name and include and src):
+        sys.stderr.write('usage: vectorize-r2c.py -name NAME '
+                         '-include HEADER SCALAR.c\n')
+        return 2
+    oldname = name.replace('v_', '_', 1)
+    if oldname.startswith('r2cf'):
+        inputs, outputs = ('R0', 'R1'), ('Cr', 'Ci')
+    elif oldname.startswith('r2cb'):
+        inputs, outputs = ('Cr', 'Ci'), ('R0', 'R1')
+    else:
+        inputs, outputs = ('I',), ('O',)
+    lines = open(src).read().split('\n')
+    try:
+        out = convert_variant(lines, name, include, oldname, inputs, outputs)
+    except Error as e:
+        sys.stderr.write('%s: %s\n' % (src, e))
+        return 1
+    sys.stdout.write('\n'.join(out))
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
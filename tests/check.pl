@@ -10,6 +10,9 @@ $estimate = 0;
 $wisdom = 0;
 $validate_wisdom = 0;
 $threads_callback = 0;
+$work_stealing = 0;
+$affinity = 0;
+$parallel_planner = 0;
 $nthreads = 1;
 $rounds = 0;
 $maxsize = 60000;
@@ -35,6 +38,9 @@ sub make_options {
     $options = "-o estimate $options" if $estimate;
     $options = "-o wisdom $options" if $wisdom;
     $options = "-o threads_callback $options" if $threads_callback;
+    $options = "-o work_stealing $options" if $work_stealing;
+    $options = "-o affinity $options" if $affinity;
+    $options = "-o parallel_planner=$parallel_planner $options" if $parallel_planner;
     $options = "-o nthreads=$nthreads $options" if ($nthreads > 1);
     $options = "-obflag=30 $options" if $mpi_transposed_in;
     $options = "-obflag=31 $options" if $mpi_transposed_out;
@@ -289,6 +295,9 @@ sub parse_arguments (@)
 	elsif ($arglist[0] eq '--wisdom') { ++$wisdom; }
         elsif ($arglist[0] eq '--validate-wisdom') { ++$wisdom;  ++$validate_wisdom; }
 	elsif ($arglist[0] eq '--threads_callback') { ++$threads_callback; }
+	elsif ($arglist[0] eq '--work_stealing') { ++$work_stealing; }
+	elsif ($arglist[0] eq '--affinity') { ++$affinity; }
+	elsif ($arglist[0] =~ /^--parallel-planner=(.+)$/) { $parallel_planner = $1; }
 	elsif ($arglist[0] =~ /^--nthreads=(.+)$/) { $nthreads = $1; }
 	elsif ($arglist[0] eq '-k') { ++$keepgoing; }
 	elsif ($arglist[0] eq '--keep-going') { ++$keepgoing; }
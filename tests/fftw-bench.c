@@ -44,6 +44,13 @@ int usewisdom = 0;
 int havewisdom = 0;
 int nthreads = 1;
 int amnesia = 0;
+int profile = 0;
+int usescratch = 0;
+int pencil = 0; /* mpi-bench: pencil decomposition of 3d DFTs */
+static void *scratch = 0;
+static const char *import_twiddles = 0;
+static const char *export_twiddles = 0;
+static int alloc_policy = FFTW_ALLOC_DEFAULT;
 
 extern void install_hook(void);  /* in hook.c */
 extern void uninstall_hook(void);  /* in hook.c */
@@ -90,8 +97,8 @@ static void serial_threads(void *(*work)(char *), char *jobdata, size_t elsize,
 
 void useropt(const char *arg)
 {
-     int x;
-     double y;
+     int x, z, v;
+     double y, w;
 
      if (!strcmp(arg, "patient")) the_flags |= FFTW_PATIENT;
      else if (!strcmp(arg, "estimate")) the_flags |= FFTW_ESTIMATE;
@@ -106,12 +113,48 @@ void useropt(const char *arg)
      else if (!strcmp(arg, "paranoid")) paranoid = 1;
      else if (!strcmp(arg, "wisdom")) usewisdom = 1;
      else if (!strcmp(arg, "amnesia")) amnesia = 1;
+     else if (!strcmp(arg, "profile")) profile = 1;
+     else if (!strcmp(arg, "scratch")) usescratch = 1;
+     else if (!strcmp(arg, "pencil")) pencil = 1;
+     else if (!strncmp(arg, "import-twiddles=", 16))
+	  import_twiddles = arg + 16;
+     else if (!strncmp(arg, "export-twiddles=", 16))
+	  export_twiddles = arg + 16;
+     else if (!strcmp(arg, "alloc-policy=thp"))
+	  FFTW(set_alloc_policy)(alloc_policy = FFTW_ALLOC_THP, 0);
+     else if (!strcmp(arg, "alloc-policy=hugetlb"))
+	  FFTW(set_alloc_policy)(alloc_policy = FFTW_ALLOC_HUGETLB, 0);
      else if (!strcmp(arg, "threads_callback"))
 #ifdef HAVE_SMP
           FFTW(threads_set_callback)(serial_threads, NULL);
 #else
           fprintf(stderr, "Serial FFTW; ignoring threads_callback option.\n");
 #endif
+     else if (!strcmp(arg, "work_stealing"))
+#ifdef HAVE_SMP
+          FFTW(threads_set_work_stealing)(1);
+#else
+          fprintf(stderr, "Serial FFTW; ignoring work_stealing option.\n");
+#endif
+     else if (!strcmp(arg, "affinity"))
+#ifdef HAVE_SMP
+          FFTW(plan_with_affinity)(0, 1 << 20);
+#else
+          fprintf(stderr, "Serial FFTW; ignoring affinity option.\n");
+#endif
+     else if (sscanf(arg, "parallel_planner=%d", &x) == 1)
+#ifdef HAVE_SMP
+          FFTW(plan_with_parallel_planner)(x);
+#else
+          fprintf(stderr, "Serial FFTW; ignoring parallel_planner option.\n");
+#endif
+     else if (sscanf(arg, "top_n=%d", &x) == 1)
+          FFTW(plan_with_top_n)(x);
+     else if (sscanf(arg, "cache_pressure=%d:%d", &x, &z) == 2)
+          FFTW(plan_with_cache_pressure)((size_t) x << 10, (size_t) z << 10);
+     else if (sscanf(arg, "cache_sizes=%d:%d:%d", &x, &z, &v) == 3)
+          FFTW(set_cache_sizes)((size_t) x << 10, (size_t) z << 10,
+                                (size_t) v << 10);
      else if (sscanf(arg, "nthreads=%d", &x) == 1) nthreads = x;
 #ifdef FFTW_RANDOM_ESTIMATOR
      else if (sscanf(arg, "eseed=%d", &x) == 1) FFTW(random_estimate_seed) = x;
@@ -119,6 +162,8 @@ void useropt(const char *arg)
      else if (sscanf(arg, "timelimit=%lg", &y) == 1) {
 	  FFTW(set_timelimit)(y);
      }
+     else if (sscanf(arg, "timing_confidence=%lg:%lg", &y, &w) == 2)
+	  FFTW(set_timing_confidence)(y, w);
 
      else fprintf(stderr, "unknown user option: %s.  Ignoring.\n", arg);
 }
@@ -261,6 +306,20 @@ void setup(bench_problem *p)
      rdwisdom();
      install_hook();
 
+     if (import_twiddles) {
+	  int ok = FFTW(import_twiddles_mmap)(import_twiddles);
+	  if (verbose > 1)
+	       printf("imported twiddles from %s\n", import_twiddles);
+	  BENCH_ASSERT(ok);
+     }
+
+     if (verbose > 1) {
+	  size_t l1d, l2, l3;
+	  FFTW(get_cache_sizes)(&l1d, &l2, &l3);
+	  printf("CACHES = %uK:%uK:%uK\n", (unsigned) (l1d >> 10),
+		 (unsigned) (l2 >> 10), (unsigned) (l3 >> 10));
+     }
+
 #ifdef HAVE_SMP
      if (verbose > 1 && nthreads > 1) printf("NTHREADS = %d\n", nthreads);
 #endif
@@ -283,8 +342,27 @@ void setup(bench_problem *p)
 	       printf("flops: %0.0f add, %0.0f mul, %0.0f fma\n",
 		      add, mul, nfma);
 	       printf("estimated cost: %f, pcost = %f\n", cost, pcost);
+	       printf("scratch: %lu bytes\n",
+		      (unsigned long) FFTW(plan_scratch_size)(the_plan));
 	  }
      }
+
+     if (usescratch)
+	  scratch = FFTW(malloc)(FFTW(plan_scratch_size)(the_plan));
+
+     if (verbose > 1) {
+	  FFTW(planner_stats) st;
+	  FFTW(get_planner_stats)(&st);
+	  printf("planner: %0.0f problems, %0.0f searched, %0.0f plans, "
+		 "%0.0f timeouts\n", st.nprob, st.nsearch, st.nplan,
+		 st.ntimeout);
+	  printf("wisdom tables: %0.0f lookups, %0.0f hits, %0.0f inserts, "
+		 "%0.0f solutions\n", st.lookup, st.succ_lookup, st.insert,
+		 st.nelem);
+     }
+
+     if (profile)
+	  FFTW(plan_profile_start)(the_plan);
 }
 
 
@@ -294,14 +372,32 @@ void doit(int iter, bench_problem *p)
      FFTW(plan) q = the_plan;
 
      UNUSED(p);
-     for (i = 0; i < iter; ++i)
-	  FFTW(execute)(q);
+     if (usescratch)
+	  for (i = 0; i < iter; ++i)
+	       FFTW(execute_with_scratch)(q, scratch);
+     else
+	  for (i = 0; i < iter; ++i)
+	       FFTW(execute)(q);
 }
 
 void done(bench_problem *p)
 {
      UNUSED(p);
 
+     if (profile)
+	  FFTW(plan_profile_fprint)(the_plan, stdout);
+     if (export_twiddles)
+	  BENCH_ASSERT(FFTW(export_twiddles)(export_twiddles));
+     if (alloc_policy != FFTW_ALLOC_DEFAULT && verbose > 1) {
+	  FFTW(alloc_stats) st;
+	  FFTW(get_alloc_stats)(&st);
+	  printf("huge pages: thp %lu, hugetlb %lu, peak %lu bytes"
+		 " in %lu blocks\n",
+		 (unsigned long) st.thp, (unsigned long) st.hugetlb,
+		 (unsigned long) st.peak, (unsigned long) st.nalloc);
+     }
+     FFTW(free)(scratch);
+     scratch = 0;
      FFTW(destroy_plan)(the_plan);
      uninstall_hook();
 }
@@ -23,16 +23,48 @@
 
 static int threads_inited = 0;
 
+typedef struct {
+     void (*f)(INT lo, INT hi, void *args);
+     void *args;
+     INT n, block_size;
+} sixstep_data;
+
+static void *spawn_sixstep(spawn_data *d)
+{
+     sixstep_data *ego = (sixstep_data *) d->data;
+     INT lo = d->min * ego->block_size;
+     INT hi = X(imin)(ego->n, d->max * ego->block_size);
+
+     if (lo < hi)
+	  ego->f(lo, hi, ego->args);
+     return 0;
+}
+
+static void sixstep_loop(INT n, int nthr,
+			 void (*f)(INT lo, INT hi, void *args), void *args)
+{
+     sixstep_data d;
+
+     d.f = f;
+     d.args = args;
+     d.n = n;
+     d.block_size = X(threads_block_size)(n, nthr);
+     X(spawn_loop)((int)((n + d.block_size - 1) / d.block_size), nthr,
+		   spawn_sixstep, (void *) &d);
+}
+
 static void threads_register_hooks(void)
 {
      X(mksolver_ct_hook) = X(mksolver_ct_threads);
      X(mksolver_hc2hc_hook) = X(mksolver_hc2hc_threads);
+     X(dft_sixstep_loop_hook) = sixstep_loop;
 }
 
 static void threads_unregister_hooks(void)
 {
      X(mksolver_ct_hook) = 0;
      X(mksolver_hc2hc_hook) = 0;
+     X(dft_sixstep_loop_hook) = 0;
 }
 
 /* should be called before all other FFTW functions! */
@@ -61,6 +93,7 @@ void X(cleanup_threads)(void)
 {
      X(cleanup)();
      if (threads_inited) {
+	  X(threads_psearch_cleanup)();
 	  X(threads_cleanup)();
 	  threads_unregister_hooks();
 	  threads_inited = 0;
@@ -85,6 +118,31 @@ int X(planner_nthreads)(void)
     return X(the_planner)()->nthr;
 }
 
+int X(threads_affinity) = 0;
+int X(plan_with_affinity)(const int *cpus, int ncpus)
+{
+     int n;
+
+     if (!threads_inited) {
+	  X(cleanup)();
+	  X(init_threads)();
+     }
+     A(threads_inited);
+     n = X(ithreads_set_affinity)(cpus, ncpus);
+     X(threads_affinity) = (n > 0);
+     return n;
+}
+
+void X(plan_with_parallel_planner)(int nworkers)
+{
+     if (!threads_inited) {
+	  X(cleanup)();
+	  X(init_threads)();
+     }
+     A(threads_inited);
+     X(threads_psearch_init)(X(the_planner)(), nworkers);
+}
+
 void X(make_planner_thread_safe)(void)
 {
      X(threads_register_planner_hooks)();
@@ -97,3 +155,87 @@ void X(threads_set_callback)(void (*spawnloop)(void *(*work)(char *), char *, si
      X(spawnloop_callback) = (spawnloop_function) spawnloop;
      X(spawnloop_callback_data) = data;
 }
+
+int X(threads_work_stealing) = 0;
+void X(threads_set_work_stealing)(int enable)
+{
+     X(threads_work_stealing) = (enable != 0);
+}
+
+/* When work stealing is enabled, the threaded solvers split their
+   loops into WS_GRAIN blocks per thread, so that threads that finish
+   early find blocks left to steal from slower ones. */
+#define WS_GRAIN 4
+
+/* Size of the blocks into which a threaded solver splits a loop of
+   length n that is to be executed by nthr threads. */
+INT X(threads_block_size)(INT n, int nthr)
+{
+     INT nblk = nthr;
+
+     if (X(threads_work_stealing) && nthr > 1)
+	  nblk *= WS_GRAIN;
+     return (n + nblk - 1) / nblk;
+}
+
+typedef struct {
+     plan **cldrn;
+     enum wakefulness wakefulness;
+} awake_data;
+
+static void *spawn_awake(spawn_data *d)
+{
+     awake_data *ego = (awake_data *) d->data;
+     int i;
+
+     for (i = d->min; i < d->max; ++i)
+	  X(plan_awake)(ego->cldrn[i], ego->wakefulness);
+     return 0;
+}
+
+/* Awaken the children of a threaded plan.  When the workers are bound
+   to CPUs, each child is awakened by the thread that will execute it,
+   so that the memory the child allocates is local to that thread. */
+void X(threads_awake_children)(plan **cldrn, int nblk, int nthr,
+			       enum wakefulness wakefulness)
+{
+     awake_data d;
+     int i;
+
+     if (X(threads_affinity) && wakefulness != SLEEPY) {
+	  d.cldrn = cldrn;
+	  d.wakefulness = wakefulness;
+	  X(spawn_loop_serialized)(nblk, nthr, spawn_awake, (void *) &d);
+     } else {
+	  for (i = 0; i < nblk; ++i)
+	       X(plan_awake)(cldrn[i], wakefulness);
+     }
+}
+
+static void *spawn_in_arena(spawn_data *d)
+{
+     const scratch_closure *c = (const scratch_closure *) d->data;
+     spawn_data d1 = *d;
+     scratch_arena saved;
+     void *r;
+
+     d1.data = c->data;
+     X(scratch_enter)(&c->arena, &saved);
+     r = c->proc(&d1);
+     X(scratch_leave)(&saved);
+     return r;
+}
+
+/* If the calling thread executes within a scratch arena, replace PROC
+   and DATA by a closure C that executes PROC within the same arena. */
+void X(threads_scratch_closure)(scratch_closure *c,
+				spawn_function *proc, void **data)
+{
+     X(scratch_current)(&c->arena);
+     if (c->arena.base) {
+	  c->proc = *proc;
+	  c->data = *data;
+	  *proc = spawn_in_arena;
+	  *data = (void *) c;
+     }
+}
@@ -26,6 +26,7 @@ static const solvtab s =
      SOLVTAB(X(dft_thr_vrank_geq1_register)),
      SOLVTAB(X(rdft_thr_vrank_geq1_register)),
      SOLVTAB(X(rdft2_thr_vrank_geq1_register)),
+     SOLVTAB(X(rdft_thr_transpose_register)),
 
      SOLVTAB_END
 };
@@ -25,7 +25,7 @@ typedef struct {
      plan_dft super;
      plan *cld;
      plan **cldws;
-     int nthr;
+     int nblk, nthr;
      INT r;
 } P;
 
@@ -37,10 +37,12 @@ typedef struct {
 static void *spawn_apply(spawn_data *d)
 {
      PD *ego = (PD *) d->data;
-     INT thr_num = d->thr_num;
+     int i;
 
-     plan_dftw *cldw = (plan_dftw *) (ego->cldws[thr_num]);
-     cldw->apply((plan *) cldw, ego->r, ego->i);
+     for (i = d->min; i < d->max; ++i) {
+	  plan_dftw *cldw = (plan_dftw *) (ego->cldws[i]);
+	  cldw->apply((plan *) cldw, ego->r, ego->i);
+     }
      return 0;
 }
 
@@ -58,7 +60,7 @@ static void apply_dit(const plan *ego_, R *ri, R *ii, R *ro, R *io)
 	  d.r = ro; d.i = io;
 	  d.cldws = ego->cldws;
 
-	  X(spawn_loop)(ego->nthr, ego->nthr, spawn_apply, (void*)&d);
+	  X(spawn_loop)(ego->nblk, ego->nthr, spawn_apply, (void*)&d);
      }
 }
 
@@ -73,7 +75,7 @@ static void apply_dif(const plan *ego_, R *ri, R *ii, R *ro, R *io)
 	  d.r = ri; d.i = ii;
 	  d.cldws = ego->cldws;
 
-	  X(spawn_loop)(ego->nthr, ego->nthr, spawn_apply, (void*)&d);
+	  X(spawn_loop)(ego->nblk, ego->nthr, spawn_apply, (void*)&d);
      }
 
      cld = (plan_dft *) ego->cld;
@@ -83,10 +85,8 @@ static void apply_dif(const plan *ego_, R *ri, R *ii, R *ro, R *io)
 static void awake(plan *ego_, enum wakefulness wakefulness)
 {
      P *ego = (P *) ego_;
-     int i;
      X(plan_awake)(ego->cld, wakefulness);
-     for (i = 0; i < ego->nthr; ++i)
-	  X(plan_awake)(ego->cldws[i], wakefulness);
+     X(threads_awake_children)(ego->cldws, ego->nblk, ego->nthr, wakefulness);
 }
 
 static void destroy(plan *ego_)
@@ -94,7 +94,7 @@ static void destroy(plan *ego_)
      P *ego = (P *) ego_;
      int i;
      X(plan_destroy_internal)(ego->cld);
-     for (i = 0; i < ego->nthr; ++i)
+     for (i = 0; i < ego->nblk; ++i)
 	  X(plan_destroy_internal)(ego->cldws[i]);
      X(ifree)(ego->cldws);
 }
@@ -105,8 +105,8 @@ static void print(const plan *ego_, printer *p)
      int i;
      p->print(p, "(dft-thr-ct-%s-x%d/%D",
 	      ego->super.apply == apply_dit ? "dit" : "dif",
-	      ego->nthr, ego->r);
-     for (i = 0; i < ego->nthr; ++i)
+	      ego->nblk, ego->r);
+     for (i = 0; i < ego->nblk; ++i)
           if (i == 0 || (ego->cldws[i] != ego->cldws[i-1] &&
                          (i <= 1 || ego->cldws[i] != ego->cldws[i-2])))
                p->print(p, "%(%p%)", ego->cldws[i]);
@@ -121,7 +121,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      plan *cld = 0, **cldws = 0;
      INT n, r, m, v, ivs, ovs;
      INT block_size;
-     int i, nthr, plnr_nthr_save;
+     int i, nblk, nthr, plnr_nthr_save;
      iodim *d;
 
      static const plan_adt padt = {
@@ -139,24 +139,25 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 
      X(tensor_tornk1)(p->vecsz, &v, &ivs, &ovs);
 
-     block_size = (m + plnr->nthr - 1) / plnr->nthr;
-     nthr = (int)((m + block_size - 1) / block_size);
+     block_size = X(threads_block_size)(m, plnr->nthr);
+     nblk = (int)((m + block_size - 1) / block_size);
+     nthr = X(imin)(plnr->nthr, nblk);
      plnr_nthr_save = plnr->nthr;
-     plnr->nthr = (plnr->nthr + nthr - 1) / nthr;
+     plnr->nthr = (plnr->nthr + nblk - 1) / nblk;
 
-     cldws = (plan **) MALLOC(sizeof(plan *) * nthr, PLANS);
-     for (i = 0; i < nthr; ++i) cldws[i] = (plan *) 0;
+     cldws = (plan **) MALLOC(sizeof(plan *) * nblk, PLANS);
+     for (i = 0; i < nblk; ++i) cldws[i] = (plan *) 0;
 
      switch (ego->dec) {
 	 case DECDIT:
 	 {
-	      for (i = 0; i < nthr; ++i) {
+	      for (i = 0; i < nblk; ++i) {
 		   cldws[i] = ego->mkcldw(ego,
 					  r, m * d[0].os, m * d[0].os,
 					  m, d[0].os,
 					  v, ovs, ovs,
 					  i*block_size,
-					  (i == nthr - 1) ?
+					  (i == nblk - 1) ?
 					  (m - i*block_size) : block_size,
 					  p->ro, p->io, plnr);
 		   if (!cldws[i]) goto nada;
@@ -204,13 +205,13 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 		   covs = ivs;
 	      }
 
-	      for (i = 0; i < nthr; ++i) {
+	      for (i = 0; i < nblk; ++i) {
 		   cldws[i] = ego->mkcldw(ego,
 					  r, m * d[0].is, cors,
 					  m, d[0].is,
 					  v, ivs, covs,
 					  i*block_size,
-					  (i == nthr - 1) ?
+					  (i == nblk - 1) ?
 					  (m - i*block_size) : block_size,
 					  p->ri, p->ii, plnr);
 		   if (!cldws[i]) goto nada;
@@ -237,10 +238,11 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 
      pln->cld = cld;
      pln->cldws = cldws;
+     pln->nblk = nblk;
      pln->nthr = nthr;
      pln->r = r;
      X(ops_zero)(&pln->super.super.ops);
-     for (i = 0; i < nthr; ++i) {
+     for (i = 0; i < nblk; ++i) {
           X(ops_add2)(&cldws[i]->ops, &pln->super.super.ops);
 	  pln->super.super.could_prune_now_p |= cldws[i]->could_prune_now_p;
      }
@@ -249,7 +251,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 
  nada:
      if (cldws) {
-	  for (i = 0; i < nthr; ++i)
+	  for (i = 0; i < nblk; ++i)
 	       X(plan_destroy_internal)(cldws[i]);
 	  X(ifree)(cldws);
      }
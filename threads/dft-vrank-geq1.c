@@ -32,7 +32,7 @@ typedef struct {
      plan_dft super;
      plan **cldrn;
      INT its, ots;
-     int nthr;
+     int nblk, nthr;
      const S *solver;
 } P;
 
@@ -47,12 +47,14 @@ static void *spawn_apply(spawn_data *d)
      PD *ego = (PD *) d->data;
      INT its = ego->its;
      INT ots = ego->ots;
-     int thr_num = d->thr_num;
-     plan_dft *cld = (plan_dft *) ego->cldrn[thr_num];
+     int i;
 
-     cld->apply((plan *) cld,
-		ego->ri + thr_num * its, ego->ii + thr_num * its,
-		ego->ro + thr_num * ots, ego->io + thr_num * ots);
+     for (i = d->min; i < d->max; ++i) {
+	  plan_dft *cld = (plan_dft *) ego->cldrn[i];
+	  cld->apply((plan *) cld,
+		     ego->ri + i * its, ego->ii + i * its,
+		     ego->ro + i * ots, ego->io + i * ots);
+     }
      return 0;
 }
 
@@ -66,22 +68,20 @@ static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
      d.cldrn = ego->cldrn;
      d.ri = ri; d.ii = ii; d.ro = ro; d.io = io;
 
-     X(spawn_loop)(ego->nthr, ego->nthr, spawn_apply, (void*) &d);
+     X(spawn_loop)(ego->nblk, ego->nthr, spawn_apply, (void*) &d);
 }
 
 static void awake(plan *ego_, enum wakefulness wakefulness)
 {
      P *ego = (P *) ego_;
-     int i;
-     for (i = 0; i < ego->nthr; ++i)
-	  X(plan_awake)(ego->cldrn[i], wakefulness);
+     X(threads_awake_children)(ego->cldrn, ego->nblk, ego->nthr, wakefulness);
 }
 
 static void destroy(plan *ego_)
 {
      P *ego = (P *) ego_;
      int i;
-     for (i = 0; i < ego->nthr; ++i)
+     for (i = 0; i < ego->nblk; ++i)
 	  X(plan_destroy_internal)(ego->cldrn[i]);
      X(ifree)(ego->cldrn);
 }
@@ -91,8 +91,8 @@ static void print(const plan *ego_, printer *p)
      const P *ego = (const P *) ego_;
      const S *s = ego->solver;
      int i;
-     p->print(p, "(dft-thr-vrank>=1-x%d/%d", ego->nthr, s->vecloop_dim);
-     for (i = 0; i < ego->nthr; ++i)
+     p->print(p, "(dft-thr-vrank>=1-x%d/%d", ego->nblk, s->vecloop_dim);
+     for (i = 0; i < ego->nblk; ++i)
 	  if (i == 0 || (ego->cldrn[i] != ego->cldrn[i-1] &&
 			 (i <= 1 || ego->cldrn[i] != ego->cldrn[i-2])))
 	       p->print(p, "%(%p%)", ego->cldrn[i]);
@@ -142,7 +142,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      int vdim;
      iodim *d;
      plan **cldrn = (plan **) 0;
-     int i, nthr;
+     int i, nblk, nthr;
      INT its, ots, block_size;
      tensor *vecsz = 0;
 
@@ -155,19 +155,20 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      p = (const problem_dft *) p_;
      d = p->vecsz->dims + vdim;
 
-     block_size = (d->n + plnr->nthr - 1) / plnr->nthr;
-     nthr = (int)((d->n + block_size - 1) / block_size);
-     plnr->nthr = (plnr->nthr + nthr - 1) / nthr;
+     block_size = X(threads_block_size)(d->n, plnr->nthr);
+     nblk = (int)((d->n + block_size - 1) / block_size);
+     nthr = X(imin)(plnr->nthr, nblk);
+     plnr->nthr = (plnr->nthr + nblk - 1) / nblk;
      its = d->is * block_size;
      ots = d->os * block_size;
 
-     cldrn = (plan **)MALLOC(sizeof(plan *) * nthr, PLANS);
-     for (i = 0; i < nthr; ++i) cldrn[i] = (plan *) 0;
+     cldrn = (plan **)MALLOC(sizeof(plan *) * nblk, PLANS);
+     for (i = 0; i < nblk; ++i) cldrn[i] = (plan *) 0;
      
      vecsz = X(tensor_copy)(p->vecsz);
-     for (i = 0; i < nthr; ++i) {
+     for (i = 0; i < nblk; ++i) {
 	  vecsz->dims[vdim].n =
-	       (i == nthr - 1) ? (d->n - i*block_size) : block_size;
+	       (i == nblk - 1) ? (d->n - i*block_size) : block_size;
 	  cldp = X(mkproblem_dft)(p->sz, vecsz,
 				  p->ri + i*its, p->ii + i*its, 
 				  p->ro + i*ots, p->io + i*ots);
@@ -181,12 +182,13 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      pln->cldrn = cldrn;
      pln->its = its;
      pln->ots = ots;
+     pln->nblk = nblk;
      pln->nthr = nthr;
 
      pln->solver = ego;
      X(ops_zero)(&pln->super.super.ops);
      pln->super.super.pcost = 0;
-     for (i = 0; i < nthr; ++i) {
+     for (i = 0; i < nblk; ++i) {
 	  X(ops_add2)(&cldrn[i]->ops, &pln->super.super.ops);
 	  pln->super.super.pcost += cldrn[i]->pcost;
      }
@@ -195,7 +197,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 
  nada:
      if (cldrn) {
-	  for (i = 0; i < nthr; ++i)
+	  for (i = 0; i < nblk; ++i)
 	       X(plan_destroy_internal)(cldrn[i]);
 	  X(ifree)(cldrn);
      }
@@ -24,7 +24,7 @@ typedef struct {
      plan_rdft super;
      plan *cld;
      plan **cldws;
-     int nthr;
+     int nblk, nthr;
      INT r;
 } P;
 
@@ -36,9 +36,12 @@ typedef struct {
 static void *spawn_apply(spawn_data *d)
 {
      PD *ego = (PD *) d->data;
-     
-     plan_hc2hc *cldw = (plan_hc2hc *) (ego->cldws[d->thr_num]);
-     cldw->apply((plan *) cldw, ego->IO);
+     int i;
+
+     for (i = d->min; i < d->max; ++i) {
+	  plan_hc2hc *cldw = (plan_hc2hc *) (ego->cldws[i]);
+	  cldw->apply((plan *) cldw, ego->IO);
+     }
      return 0;
 }
 
@@ -56,7 +59,7 @@ static void apply_dit(const plan *ego_, R *I, R *O)
 	  d.IO = O;
 	  d.cldws = ego->cldws;
 
-	  X(spawn_loop)(ego->nthr, ego->nthr, spawn_apply, (void*)&d);
+	  X(spawn_loop)(ego->nblk, ego->nthr, spawn_apply, (void*)&d);
      }
 }
 
@@ -71,7 +74,7 @@ static void apply_dif(const plan *ego_, R *I, R *O)
 	  d.IO = I;
 	  d.cldws = ego->cldws;
 
-	  X(spawn_loop)(ego->nthr, ego->nthr, spawn_apply, (void*)&d);
+	  X(spawn_loop)(ego->nblk, ego->nthr, spawn_apply, (void*)&d);
      }
 
      cld = (plan_rdft *) ego->cld;
@@ -81,10 +84,8 @@ static void apply_dif(const plan *ego_, R *I, R *O)
 static void awake(plan *ego_, enum wakefulness wakefulness)
 {
      P *ego = (P *) ego_;
-     int i;
      X(plan_awake)(ego->cld, wakefulness);
-     for (i = 0; i < ego->nthr; ++i)
-	  X(plan_awake)(ego->cldws[i], wakefulness);
+     X(threads_awake_children)(ego->cldws, ego->nblk, ego->nthr, wakefulness);
 }
 
 static void destroy(plan *ego_)
@@ -92,7 +93,7 @@ static void destroy(plan *ego_)
      P *ego = (P *) ego_;
      int i;
      X(plan_destroy_internal)(ego->cld);
-     for (i = 0; i < ego->nthr; ++i)
+     for (i = 0; i < ego->nblk; ++i)
 	  X(plan_destroy_internal)(ego->cldws[i]);
      X(ifree)(ego->cldws);
 }
@@ -103,8 +104,8 @@ static void print(const plan *ego_, printer *p)
      int i;
      p->print(p, "(rdft-thr-ct-%s-x%d/%D",
 	      ego->super.apply == apply_dit ? "dit" : "dif",
-	      ego->nthr, ego->r);
-     for (i = 0; i < ego->nthr; ++i)
+	      ego->nblk, ego->r);
+     for (i = 0; i < ego->nblk; ++i)
           if (i == 0 || (ego->cldws[i] != ego->cldws[i-1] &&
                          (i <= 1 || ego->cldws[i] != ego->cldws[i-2])))
                p->print(p, "%(%p%)", ego->cldws[i]);
@@ -118,7 +119,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      P *pln = 0;
      plan *cld = 0, **cldws = 0;
      INT n, r, m, v, ivs, ovs, mcount;
-     int i, nthr, plnr_nthr_save;
+     int i, nblk, nthr, plnr_nthr_save;
      INT block_size;
      iodim *d;
 
@@ -138,21 +139,22 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 
      X(tensor_tornk1)(p->vecsz, &v, &ivs, &ovs);
 
-     block_size = (mcount + plnr->nthr - 1) / plnr->nthr;
-     nthr = (int)((mcount + block_size - 1) / block_size);
+     block_size = X(threads_block_size)(mcount, plnr->nthr);
+     nblk = (int)((mcount + block_size - 1) / block_size);
+     nthr = X(imin)(plnr->nthr, nblk);
      plnr_nthr_save = plnr->nthr;
-     plnr->nthr = (plnr->nthr + nthr - 1) / nthr;
+     plnr->nthr = (plnr->nthr + nblk - 1) / nblk;
 
-     cldws = (plan **) MALLOC(sizeof(plan *) * nthr, PLANS);
-     for (i = 0; i < nthr; ++i) cldws[i] = (plan *) 0;
+     cldws = (plan **) MALLOC(sizeof(plan *) * nblk, PLANS);
+     for (i = 0; i < nblk; ++i) cldws[i] = (plan *) 0;
 
      switch (p->kind[0]) {
 	 case R2HC:
-	      for (i = 0; i < nthr; ++i) {
+	      for (i = 0; i < nblk; ++i) {
 		   cldws[i] = ego->mkcldw(ego, 
 					  R2HC, r, m, d[0].os, v, ovs, 
 					  i*block_size, 
-					  (i == nthr - 1) ? 
+					  (i == nblk - 1) ? 
 					  (mcount - i*block_size) : block_size,
 					  p->O, plnr);
 		   if (!cldws[i]) goto nada;
@@ -173,11 +175,11 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 	      break;
 
 	 case HC2R:
-	      for (i = 0; i < nthr; ++i) {
+	      for (i = 0; i < nblk; ++i) {
 		   cldws[i] = ego->mkcldw(ego, 
 					  HC2R, r, m, d[0].is, v, ivs, 
 					  i*block_size, 
-					  (i == nthr - 1) ? 
+					  (i == nblk - 1) ? 
 					  (mcount - i*block_size) : block_size,
 					  p->I, plnr);
 		   if (!cldws[i]) goto nada;
@@ -203,10 +205,11 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 
      pln->cld = cld;
      pln->cldws = cldws;
+     pln->nblk = nblk;
      pln->nthr = nthr;
      pln->r = r;
      X(ops_zero)(&pln->super.super.ops);
-     for (i = 0; i < nthr; ++i) {
+     for (i = 0; i < nblk; ++i) {
           X(ops_add2)(&cldws[i]->ops, &pln->super.super.ops);
 	  pln->super.super.could_prune_now_p |= cldws[i]->could_prune_now_p;
      }
@@ -215,7 +218,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 
  nada:
      if (cldws) {
-	  for (i = 0; i < nthr; ++i)
+	  for (i = 0; i < nblk; ++i)
 	       X(plan_destroy_internal)(cldws[i]);
 	  X(ifree)(cldws);
      }
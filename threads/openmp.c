@@ -23,13 +23,24 @@
 
 #include "threads/threads.h"
 
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
+
 //_OPENMP is not defined for clang compiler
 #if !defined(_OPENMP) && !defined(__clang__)
 #error OpenMP enabled but not using an OpenMP compiler
 #endif
 
+#ifdef _OPENMP
+static omp_lock_t psearch_lock;
+#endif
+
 int X(ithreads_init)(void)
 {
+#ifdef _OPENMP
+     omp_init_lock(&psearch_lock);
+#endif
      return 0; /* no error */
 }
 
@@ -39,6 +50,9 @@ int X(ithreads_init)(void)
    that is executing proc (from 0 to nthreads-1), and d->data is
    the same as the data parameter passed to X(spawn_loop).
 
+   With the work-stealing scheduler, the iterations are handed out one
+   at a time by the OpenMP runtime (schedule(dynamic)).
+
    This function returns only after all the threads have completed. */
 #ifdef AMD_FMV_AUTO
 __attribute__((target_clones(TARGET_STRINGS)))
@@ -48,6 +62,7 @@ void X(spawn_loop)(int loopmax, int nthr, spawn_function proc, void *data)
      int block_size;
      spawn_data d;
      int i;
+     scratch_closure sc;
 
      A(loopmax >= 0);
      A(nthr > 0);
@@ -55,6 +70,8 @@ void X(spawn_loop)(int loopmax, int nthr, spawn_function proc, void *data)
 
      if (!loopmax) return;
 
+     X(threads_scratch_closure)(&sc, &proc, &data);
+
      /* Choose the block size and number of threads in order to (1)
         minimize the critical path and (2) use the fewest threads that
         achieve the same critical path (to minimize overhead).
@@ -79,6 +96,18 @@ void X(spawn_loop)(int loopmax, int nthr, spawn_function proc, void *data)
           return;
      }
 
+     if (X(threads_work_stealing)) {
+#pragma omp parallel for schedule(dynamic) private(d)
+	  for (i = 0; i < loopmax; ++i) {
+	       d.min = i;
+	       d.max = i + 1;
+	       d.thr_num = i;
+	       d.data = data;
+	       proc(&d);
+	  }
+	  return;
+     }
+
 #pragma omp parallel for private(d)
      for (i = 0; i < nthr; ++i) {
 	  d.max = (d.min = i * block_size) + block_size;
@@ -90,8 +119,61 @@ void X(spawn_loop)(int loopmax, int nthr, spawn_function proc, void *data)
      }
 }
 
+/* Like X(spawn_loop), but the blocks are executed one at a time.  The
+   OpenMP backend does not control which thread runs a block, so they
+   are all executed by the calling thread. */
+void X(spawn_loop_serialized)(int loopmax, int nthr, spawn_function proc,
+			      void *data)
+{
+     int block_size;
+     spawn_data d;
+     int i;
+
+     A(loopmax >= 0);
+     A(nthr > 0);
+     A(proc);
+
+     if (!loopmax) return;
+
+     block_size = (loopmax + nthr - 1) / nthr;
+     nthr = (loopmax + block_size - 1) / block_size;
+
+     for (i = 0; i < nthr; ++i) {
+	  d.max = (d.min = i * block_size) + block_size;
+	  if (d.max > loopmax)
+	       d.max = loopmax;
+	  d.thr_num = i;
+	  d.data = data;
+	  proc(&d);
+     }
+}
+
+/* Thread placement is left to the OpenMP runtime (OMP_PLACES,
+   OMP_PROC_BIND). */
+int X(ithreads_set_affinity)(const int *cpus, int ncpus)
+{
+     UNUSED(cpus);
+     UNUSED(ncpus);
+     return 0;
+}
+
+void X(ithreads_lock_psearch)(int lockp)
+{
+#ifdef _OPENMP
+     if (lockp)
+	  omp_set_lock(&psearch_lock);
+     else
+	  omp_unset_lock(&psearch_lock);
+#else
+     UNUSED(lockp);
+#endif
+}
+
 void X(threads_cleanup)(void)
 {
+#ifdef _OPENMP
+     omp_destroy_lock(&psearch_lock);
+#endif
 }
 
 /* FIXME [Matteo Frigo 2015-05-25] What does "thread-safe"
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ * Copyright (C) 2019-2021, Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Parallel search: the candidate solvers of a search are planned and
+   timed concurrently by a set of worker planners, one per thread (see
+   the comment on parallel search in kernel/planner.c).
+
+   Each worker is configured with the same solvers as the API planner,
+   in the same order, so that solver indices mean the same thing in all
+   planners.  Each worker times its plans on a private copy of the
+   problem arrays, so that concurrent measurements do not share cache
+   lines.  The copy preserves the alignment of the arrays and the
+   relative offsets of overlapping arrays, and hence the hash of the
+   problem. */
+
+#include "api/api.h"
+#include "threads/threads.h"
+#include "dft/dft.h"
+#include "rdft/rdft.h"
+#include <string.h>
+
+static planner **workers = 0;
+static int nworkers = 0;
+
+/* private copy of the arrays of a problem: one region per group of
+   overlapping arrays, since e.g. the input of a subproblem may be a
+   user array and its output a buffer allocated far away */
+#define ARENA_MAXREG 4
+
+typedef struct {
+     uintptr_t lo, hi; /* addresses spanned by the original arrays */
+     uintptr_t base;   /* address of LO in the copy */
+     char *buf;
+} region;
+
+typedef struct {
+     region r[ARENA_MAXREG];
+     int n;
+} arena;
+
+/* alignment (in bytes) preserved by the copy */
+#define ARENA_ALIGN 64
+
+static void arena_span(arena *a, R *p, INT m)
+{
+     uintptr_t x = (uintptr_t) UNTAINT(p);
+     uintptr_t lo = x - (uintptr_t) m * sizeof(R);
+     uintptr_t hi = x + (uintptr_t) (m + 1) * sizeof(R);
+     int i;
+
+     /* merge with the regions that overlap [LO, HI) */
+     for (i = 0; i < a->n; ) {
+	  region *r = a->r + i;
+	  if (lo <= r->hi && r->lo <= hi) {
+	       if (r->lo < lo) lo = r->lo;
+	       if (r->hi > hi) hi = r->hi;
+	       *r = a->r[--a->n];
+	       i = 0;
+	  } else
+	       ++i;
+     }
+     A(a->n < ARENA_MAXREG);
+     a->r[a->n].lo = lo;
+     a->r[a->n].hi = hi;
+     ++a->n;
+}
+
+static void arena_alloc(arena *a)
+{
+     int i;
+
+     for (i = 0; i < a->n; ++i) {
+	  region *r = a->r + i;
+	  size_t n = (size_t) (r->hi - r->lo) + ARENA_ALIGN;
+
+	  r->buf = (char *) MALLOC(n, BUFFERS);
+	  memset(r->buf, 0, n);
+	  r->base = (uintptr_t) r->buf
+	       + ((r->lo - (uintptr_t) r->buf) & (ARENA_ALIGN - 1));
+     }
+}
+
+static void arena_free(arena *a)
+{
+     int i;
+
+     for (i = 0; i < a->n; ++i)
+	  X(ifree0)(a->r[i].buf);
+}
+
+static R *arena_move(const arena *a, R *p)
+{
+     uintptr_t x = (uintptr_t) UNTAINT(p);
+     int i;
+
+     for (i = 0; i < a->n; ++i) {
+	  const region *r = a->r + i;
+	  if (x >= r->lo && x < r->hi) {
+	       x = x - r->lo + r->base;
+	       break;
+	  }
+     }
+     A(i < a->n);
+     return (R *) (x | TAINTOF(p));
+}
+
+/* largest distance (in elements) of an array element from the array
+   pointer, or -1 if the tensors are not finite */
+static INT max_index(const tensor *sz, const tensor *vecsz)
+{
+     if (!FINITE_RNK(sz->rnk) || !FINITE_RNK(vecsz->rnk))
+	  return -1;
+     return X(tensor_max_index)(sz) + X(tensor_max_index)(vecsz);
+}
+
+/* copy of P with private arrays, or 0 if P is not of a known kind */
+static problem *clone_problem(const problem *p, arena *a)
+{
+     INT m;
+
+     a->n = 0;
+
+     switch (p->adt->problem_kind) {
+	 case PROBLEM_DFT: {
+	      const problem_dft *q = (const problem_dft *) p;
+	      if ((m = max_index(q->sz, q->vecsz)) < 0)
+		   return 0;
+	      arena_span(a, q->ri, m); arena_span(a, q->ii, m);
+	      arena_span(a, q->ro, m); arena_span(a, q->io, m);
+	      arena_alloc(a);
+	      return X(mkproblem_dft)(q->sz, q->vecsz,
+				      arena_move(a, q->ri), arena_move(a, q->ii),
+				      arena_move(a, q->ro), arena_move(a, q->io));
+	 }
+	 case PROBLEM_RDFT: {
+	      const problem_rdft *q = (const problem_rdft *) p;
+	      if ((m = max_index(q->sz, q->vecsz)) < 0)
+		   return 0;
+	      arena_span(a, q->I, m); arena_span(a, q->O, m);
+	      arena_alloc(a);
+	      return X(mkproblem_rdft)(q->sz, q->vecsz,
+				       arena_move(a, q->I), arena_move(a, q->O),
+				       q->kind);
+	 }
+	 case PROBLEM_RDFT2: {
+	      const problem_rdft2 *q = (const problem_rdft2 *) p;
+	      if ((m = max_index(q->sz, q->vecsz)) < 0)
+		   return 0;
+	      arena_span(a, q->r0, m); arena_span(a, q->r1, m);
+	      arena_span(a, q->cr, m); arena_span(a, q->ci, m);
+	      arena_alloc(a);
+	      return X(mkproblem_rdft2)(q->sz, q->vecsz,
+					arena_move(a, q->r0), arena_move(a, q->r1),
+					arena_move(a, q->cr), arena_move(a, q->ci),
+					q->kind);
+	 }
+	 default:
+	      return 0;
+     }
+}
+
+typedef struct {
+     planner *master;
+     const flags_t *flagsp;
+     psearch_cand *c;
+     int ncand, nthr;
+     problem **p; /* copy of the problem for each worker */
+} psearch_data;
+
+static void *psearch_thread(spawn_data *d)
+{
+     psearch_data *ego = (psearch_data *) d->data;
+     int k, i;
+
+     /* worker K evaluates candidates K, K + NTHR, ... */
+     for (k = d->min; k < d->max; ++k)
+	  for (i = k; i < ego->ncand; i += ego->nthr)
+	       X(planner_psearch_cand)(workers[k], ego->master, ego->p[k],
+				       ego->flagsp, ego->c + i);
+     return 0;
+}
+
+static int psearch(planner *plnr, const problem *p, const flags_t *flagsp,
+		   psearch_cand *c, int ncand)
+{
+     psearch_data d;
+     arena *a;
+     int i, nthr = X(imin)(nworkers, ncand), ok = 1;
+
+     if (workers[0]->nslvdesc != plnr->nslvdesc)
+	  return 0; /* not configured like the workers */
+
+#ifdef AMD_TOP_N_PLANNER
+     /* the workers plan for the same rank as PLNR */
+     for (i = 0; i < nworkers; ++i)
+	  X(planner_set_top_n)(workers[i], plnr->top_n);
+#endif
+
+     a = (arena *) MALLOC(sizeof(arena) * (size_t)nthr, OTHER);
+     d.p = (problem **) MALLOC(sizeof(problem *) * (size_t)nthr, OTHER);
+     for (i = 0; i < nthr; ++i) {
+	  d.p[i] = clone_problem(p, a + i);
+	  ok &= (d.p[i] && d.p[i]->adt->problem_kind == p->adt->problem_kind);
+     }
+
+     if (ok) {
+	  d.master = plnr;
+	  d.flagsp = flagsp;
+	  d.c = c;
+	  d.ncand = ncand;
+	  d.nthr = nthr;
+
+	  X(spawn_loop)(nthr, nthr, psearch_thread, (void *) &d);
+
+	  /* everything the workers found is in the tables of PLNR */
+	  for (i = 0; i < nthr; ++i)
+	       workers[i]->adt->forget(workers[i], FORGET_EVERYTHING);
+     }
+
+     for (i = 0; i < nthr; ++i) {
+	  X(problem_destroy)(d.p[i]);
+	  arena_free(a + i);
+     }
+     X(ifree)(d.p);
+     X(ifree)(a);
+     return ok;
+}
+
+static planner *mkworker(const planner *plnr)
+{
+     planner *w = X(mkplanner)();
+
+#ifdef AMD_OPT_PREFER_256BIT_FPU
+     w->size = plnr->size;
+#else
+     UNUSED(plnr);
+#endif
+#ifdef AMD_TOP_N_PLANNER
+     X(planner_set_top_n)(w, plnr->top_n);
+#endif
+     X(configure_planner)(w);
+     X(threads_conf_standard)(w);
+     w->lock_hook = X(ithreads_lock_psearch);
+     return w;
+}
+
+void X(threads_psearch_cleanup)(void)
+{
+     int i;
+
+     for (i = 0; i < nworkers; ++i)
+	  X(planner_destroy)(workers[i]);
+     X(ifree0)(workers);
+     workers = 0;
+     nworkers = 0;
+}
+
+void X(threads_psearch_init)(planner *plnr, int n)
+{
+     int i;
+
+     X(threads_psearch_cleanup)();
+     plnr->psearch_hook = 0;
+
+     if (n > 1) {
+	  workers = (planner **) MALLOC(sizeof(planner *) * (size_t)n, OTHER);
+	  for (i = 0; i < n; ++i)
+	       workers[i] = mkworker(plnr);
+	  nworkers = n;
+	  plnr->psearch_hook = psearch;
+     }
+}
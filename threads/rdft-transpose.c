@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* threaded in-place transposition of square matrices of vl-tuples.
+   The rows are split into one slab per thread, holding equal numbers
+   of elements to move, and every slab is transposed by
+   X(transpose_tiled_slab) or X(transpose_tiledbuf_slab) (see
+   kernel/transpose.c), so that all threads stream through disjoint
+   parts of the matrix at once.  The other in-place transposes reduce
+   to this one: the outer loops of rdft-rank0-ip-sq are split by
+   rdft-thr-vrank>=1, and the square transpose in the middle of
+   rdft-transpose-gcd and rdft-transpose-cut is planned here, while
+   their out-of-place steps are again split by rdft-thr-vrank>=1. */
+
+#include "threads/threads.h"
+
+typedef void (*slab_func)(R *I, INT l, INT u, INT s0, INT s1, INT vl);
+
+typedef struct {
+     solver super;
+     slab_func slab;
+     const char *nam;
+} S;
+
+typedef struct {
+     plan_rdft super;
+     INT n, s0, s1, vl;
+     INT *bnd; /* slab I is rows [bnd[I], bnd[I + 1]) */
+     int nthr;
+     const S *solver;
+} P;
+
+typedef struct {
+     const P *ego;
+     R *I;
+} PD;
+
+static void *spawn_apply(spawn_data *d)
+{
+     PD *pd = (PD *) d->data;
+     const P *ego = pd->ego;
+     int i;
+
+     for (i = d->min; i < d->max; ++i)
+	  ego->solver->slab(pd->I, ego->bnd[i], ego->bnd[i + 1],
+			    ego->s0, ego->s1, ego->vl);
+     return 0;
+}
+
+static void apply(const plan *ego_, R *I, R *O)
+{
+     const P *ego = (const P *) ego_;
+     PD d;
+
+     UNUSED(O);
+     d.ego = ego;
+     d.I = I;
+     X(spawn_loop)(ego->nthr, ego->nthr, spawn_apply, (void *) &d);
+}
+
+static void destroy(plan *ego_)
+{
+     P *ego = (P *) ego_;
+     X(ifree)(ego->bnd);
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *) ego_;
+     p->print(p, "(%s-x%d/%D-x%D-x%D)", ego->solver->nam, ego->nthr,
+	      ego->vl, ego->n, ego->n);
+}
+
+/* the square dimensions *D0 and *D1 of a rank-2 transpose of
+   *VL-tuples, as in rdft-rank0-ip-sq */
+static int pickdims(const tensor *vecsz, const iodim **d0,
+		    const iodim **d1, INT *vl)
+{
+     const iodim *d[2];
+     int i, rnk = 0;
+
+     *vl = 1;
+     for (i = 0; i < vecsz->rnk; ++i) {
+	  const iodim *di = vecsz->dims + i;
+	  if (*vl == 1 && di->is == 1 && di->os == 1)
+	       *vl = di->n;
+	  else if (rnk == 2)
+	       return 0;
+	  else
+	       d[rnk++] = di;
+     }
+
+     if (rnk != 2)
+	  return 0;
+     *d0 = d[0];
+     *d1 = d[1];
+     return (d[0]->n == d[1]->n
+	     && d[0]->is == d[1]->os
+	     && d[0]->os == d[1]->is);
+}
+
+static int applicable(const problem *p_, const planner *plnr,
+		      const iodim **d0, const iodim **d1, INT *vl)
+{
+     const problem_rdft *p = (const problem_rdft *) p_;
+
+     return (1
+	     && plnr->nthr > 1
+	     && p->I == p->O
+	     && p->sz->rnk == 0
+	     && FINITE_RNK(p->vecsz->rnk)
+	     && pickdims(p->vecsz, d0, d1, vl)
+
+	     /* one slab per thread, and as in rdft-rank0-ip-sq-tiled */
+	     && (*d0)->n >= plnr->nthr
+	     && X(compute_tilesz)(*vl, 2) > 4
+	  );
+}
+
+static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
+{
+     const S *ego = (const S *) ego_;
+     const iodim *d0, *d1;
+     INT n, vl, nel;
+     int i, nthr;
+     P *pln;
+
+     static const plan_adt padt = {
+	  X(rdft_solve), X(null_awake), print, destroy
+     };
+
+     if (!applicable(p_, plnr, &d0, &d1, &vl))
+          return (plan *) 0;
+
+     n = d0->n;
+     nthr = plnr->nthr;
+     pln = MKPLAN_RDFT(P, &padt, apply);
+     pln->n = n;
+     pln->s0 = d0->is;
+     pln->s1 = d0->os;
+     pln->vl = vl;
+     pln->nthr = nthr;
+     pln->solver = ego;
+
+     /* the rows [0, L) hold L^2/2 of the elements to move, so slab I
+	ends at N * sqrt((I + 1) / NTHR) */
+     pln->bnd = (INT *) MALLOC(sizeof(INT) * (nthr + 1), PLANS);
+     nel = n * n / nthr;
+     for (i = 0; i < nthr; ++i)
+	  pln->bnd[i] = X(isqrt)(nel * i);
+     pln->bnd[nthr] = n;
+
+     X(ops_zero)(&pln->super.super.ops);
+     pln->super.super.ops.other = 2 * n * n * vl;
+     return &(pln->super.super);
+}
+
+static solver *mksolver(slab_func slab, const char *nam)
+{
+     static const solver_adt sadt = { PROBLEM_RDFT, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     slv->slab = slab;
+     slv->nam = nam;
+     return &(slv->super);
+}
+
+void X(rdft_thr_transpose_register)(planner *p)
+{
+     REGISTER_SOLVER(p, mksolver(X(transpose_tiled_slab),
+				 "rdft-thr-transpose-sq-tiled"));
+     REGISTER_SOLVER(p, mksolver(X(transpose_tiledbuf_slab),
+				 "rdft-thr-transpose-sq-tiledbuf"));
+}
@@ -32,7 +32,7 @@ typedef struct {
      plan_rdft super;
      plan **cldrn;
      INT its, ots;
-     int nthr;
+     int nblk, nthr;
      const S *solver;
 } P;
 
@@ -45,11 +45,13 @@ typedef struct {
 static void *spawn_apply(spawn_data *d)
 {
      PD *ego = (PD *) d->data;
-     int thr_num = d->thr_num;
-     plan_rdft *cld = (plan_rdft *) ego->cldrn[d->thr_num];
+     int i;
 
-     cld->apply((plan *) cld,
-		ego->I + thr_num * ego->its, ego->O + thr_num * ego->ots);
+     for (i = d->min; i < d->max; ++i) {
+	  plan_rdft *cld = (plan_rdft *) ego->cldrn[i];
+	  cld->apply((plan *) cld,
+		     ego->I + i * ego->its, ego->O + i * ego->ots);
+     }
      return 0;
 }
 
@@ -63,22 +65,20 @@ static void apply(const plan *ego_, R *I, R *O)
      d.cldrn = ego->cldrn;
      d.I = I; d.O = O;
 
-     X(spawn_loop)(ego->nthr, ego->nthr, spawn_apply, (void*) &d);
+     X(spawn_loop)(ego->nblk, ego->nthr, spawn_apply, (void*) &d);
 }
 
 static void awake(plan *ego_, enum wakefulness wakefulness)
 {
      P *ego = (P *) ego_;
-     int i;
-     for (i = 0; i < ego->nthr; ++i)
-	  X(plan_awake)(ego->cldrn[i], wakefulness);
+     X(threads_awake_children)(ego->cldrn, ego->nblk, ego->nthr, wakefulness);
 }
 
 static void destroy(plan *ego_)
 {
      P *ego = (P *) ego_;
      int i;
-     for (i = 0; i < ego->nthr; ++i)
+     for (i = 0; i < ego->nblk; ++i)
 	  X(plan_destroy_internal)(ego->cldrn[i]);
      X(ifree)(ego->cldrn);
 }
@@ -88,8 +88,8 @@ static void print(const plan *ego_, printer *p)
      const P *ego = (const P *) ego_;
      const S *s = ego->solver;
      int i;
-     p->print(p, "(rdft-thr-vrank>=1-x%d/%d", ego->nthr, s->vecloop_dim);
-     for (i = 0; i < ego->nthr; ++i)
+     p->print(p, "(rdft-thr-vrank>=1-x%d/%d", ego->nblk, s->vecloop_dim);
+     for (i = 0; i < ego->nblk; ++i)
 	  if (i == 0 || (ego->cldrn[i] != ego->cldrn[i-1] &&
 			 (i <= 1 || ego->cldrn[i] != ego->cldrn[i-2])))
 	       p->print(p, "%(%p%)", ego->cldrn[i]);
@@ -139,7 +139,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      int vdim;
      iodim *d;
      plan **cldrn = (plan **) 0;
-     int i, nthr;
+     int i, nblk, nthr;
      INT its, ots, block_size;
      tensor *vecsz;
 
@@ -153,19 +153,20 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 
      d = p->vecsz->dims + vdim;
 
-     block_size = (d->n + plnr->nthr - 1) / plnr->nthr;
-     nthr = (int)((d->n + block_size - 1) / block_size);
-     plnr->nthr = (plnr->nthr + nthr - 1) / nthr;
+     block_size = X(threads_block_size)(d->n, plnr->nthr);
+     nblk = (int)((d->n + block_size - 1) / block_size);
+     nthr = X(imin)(plnr->nthr, nblk);
+     plnr->nthr = (plnr->nthr + nblk - 1) / nblk;
      its = d->is * block_size;
      ots = d->os * block_size;
 
-     cldrn = (plan **)MALLOC(sizeof(plan *) * nthr, PLANS);
-     for (i = 0; i < nthr; ++i) cldrn[i] = (plan *) 0;
+     cldrn = (plan **)MALLOC(sizeof(plan *) * nblk, PLANS);
+     for (i = 0; i < nblk; ++i) cldrn[i] = (plan *) 0;
      
      vecsz = X(tensor_copy)(p->vecsz);
-     for (i = 0; i < nthr; ++i) {
+     for (i = 0; i < nblk; ++i) {
 	  vecsz->dims[vdim].n =
-	       (i == nthr - 1) ? (d->n - i*block_size) : block_size;
+	       (i == nblk - 1) ? (d->n - i*block_size) : block_size;
 	  cldp = X(mkproblem_rdft)(p->sz, vecsz,
 				   p->I + i*its, p->O + i*ots, p->kind);
 	  cldrn[i] = X(mkplan_d)(plnr, cldp);
@@ -178,12 +179,13 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      pln->cldrn = cldrn;
      pln->its = its;
      pln->ots = ots;
+     pln->nblk = nblk;
      pln->nthr = nthr;
 
      pln->solver = ego;
      X(ops_zero)(&pln->super.super.ops);
      pln->super.super.pcost = 0;
-     for (i = 0; i < nthr; ++i) {
+     for (i = 0; i < nblk; ++i) {
 	  X(ops_add2)(&cldrn[i]->ops, &pln->super.super.ops);
 	  pln->super.super.pcost += cldrn[i]->pcost;
      }
@@ -192,7 +194,7 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
 
  nada:
      if (cldrn) {
-	  for (i = 0; i < nthr; ++i)
+	  for (i = 0; i < nblk; ++i)
 	       X(plan_destroy_internal)(cldrn[i]);
 	  X(ifree)(cldrn);
      }
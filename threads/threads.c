@@ -22,6 +22,10 @@
    function.  The first portion of this file is a set of macros to
    spawn and join threads on various systems. */
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#  define _GNU_SOURCE /* for pthread_setaffinity_np and sched_getaffinity */
+#endif
+
 #include "threads/threads.h"
 #include "api/api.h"
 
@@ -156,6 +160,185 @@ typedef pthread_mutex_t os_static_mutex_t;
 static void os_static_mutex_lock(os_static_mutex_t *s) { pthread_mutex_lock(s); }
 static void os_static_mutex_unlock(os_static_mutex_t *s) { pthread_mutex_unlock(s); }
 
+/* atomic operations, used by the work-stealing pool */
+#if defined(__GNUC__)
+#  define HAVE_OS_ATOMICS 1
+typedef volatile int os_atomic_t;
+typedef volatile unsigned long long os_atomic64_t;
+
+static int os_atomic_load(os_atomic_t *p)
+{
+     return __atomic_load_n(p, __ATOMIC_SEQ_CST);
+}
+static void os_atomic_store(os_atomic_t *p, int v)
+{
+     __atomic_store_n(p, v, __ATOMIC_SEQ_CST);
+}
+static int os_atomic_xchg(os_atomic_t *p, int v)
+{
+     return __atomic_exchange_n(p, v, __ATOMIC_SEQ_CST);
+}
+static int os_atomic_cas(os_atomic_t *p, int old, int new_)
+{
+     return __atomic_compare_exchange_n(p, &old, new_, 0,
+					__ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+static int os_atomic_dec(os_atomic_t *p)
+{
+     return __atomic_sub_fetch(p, 1, __ATOMIC_SEQ_CST);
+}
+static unsigned long long os_atomic64_load(os_atomic64_t *p)
+{
+     return __atomic_load_n(p, __ATOMIC_SEQ_CST);
+}
+static void os_atomic64_store(os_atomic64_t *p, unsigned long long v)
+{
+     __atomic_store_n(p, v, __ATOMIC_SEQ_CST);
+}
+static int os_atomic64_cas(os_atomic64_t *p, unsigned long long old,
+			   unsigned long long new_)
+{
+     return __atomic_compare_exchange_n(p, &old, new_, 0,
+					__ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+static void os_cpu_relax(void)
+{
+#  if defined(__i386__) || defined(__x86_64__)
+     __builtin_ia32_pause();
+#  endif
+}
+#  include <sched.h>
+static void os_yield(void) { sched_yield(); }
+#endif
+
+/* CPU affinity and topology, used to place the workers of the pool */
+#if defined(__linux__) && defined(CPU_SETSIZE)
+#  define HAVE_OS_AFFINITY 1
+#  include <stdio.h>
+
+static cpu_set_t os_process_cpus; /* affinity mask at initialization */
+
+static void os_affinity_init(void)
+{
+     if (sched_getaffinity(0, sizeof(os_process_cpus), &os_process_cpus))
+	  CPU_ZERO(&os_process_cpus);
+}
+
+/* bind the calling thread to CPU, or to the CPUs of the process if
+   CPU < 0 */
+static void os_bind_cpu(int cpu)
+{
+     cpu_set_t set;
+
+     if (cpu < 0) {
+	  if (CPU_COUNT(&os_process_cpus) == 0) return;
+	  set = os_process_cpus;
+     } else {
+	  CPU_ZERO(&set);
+	  CPU_SET(cpu, &set);
+     }
+     pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+/* Read a sysfs CPU list such as "0-3,8-11" into LIST.  Returns the
+   number of CPUs in the list, or 0 if the file cannot be read. */
+static int sysfs_cpulist(const char *path, int *list, int maxn)
+{
+     FILE *f = fopen(path, "r");
+     int n = 0, lo, hi, c;
+
+     if (!f) return 0;
+     while (fscanf(f, "%d", &lo) == 1) {
+	  hi = lo;
+	  c = fgetc(f);
+	  if (c == '-') {
+	       if (fscanf(f, "%d", &hi) != 1) break;
+	       c = fgetc(f);
+	  }
+	  for (; lo <= hi && n < maxn; ++lo)
+	       list[n++] = lo;
+	  if (c != ',') break;
+     }
+     fclose(f);
+     return n;
+}
+
+typedef struct {
+     int cpu, smt, node, llc;
+} os_cpu_desc;
+
+static int os_cpu_desc_cmp(const void *a_, const void *b_)
+{
+     const os_cpu_desc *a = (const os_cpu_desc *)a_;
+     const os_cpu_desc *b = (const os_cpu_desc *)b_;
+
+     if (a->smt != b->smt) return a->smt - b->smt;
+     if (a->node != b->node) return a->node - b->node;
+     if (a->llc != b->llc) return a->llc - b->llc;
+     return a->cpu - b->cpu;
+}
+
+/* Store in CPUS the CPUs on which the process may run, ordered so that
+   CPUs that share a NUMA node and a last-level cache (a CCX on Zen)
+   are adjacent, first hardware thread of every core first.  Returns
+   the number of CPUs. */
+static int os_discover_cpus(int *cpus, int maxn)
+{
+     char path[128];
+     int *list, *node_of;
+     os_cpu_desc *d;
+     int cpu, i, k, n, ncpus = 0;
+
+     if (CPU_COUNT(&os_process_cpus) == 0) return 0;
+
+     list = (int *)MALLOC(sizeof(int) * CPU_SETSIZE, OTHER);
+     node_of = (int *)MALLOC(sizeof(int) * CPU_SETSIZE, OTHER);
+     d = (os_cpu_desc *)MALLOC(sizeof(os_cpu_desc) * CPU_SETSIZE, OTHER);
+
+     for (cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+	  node_of[cpu] = 0;
+     for (k = 0; k < 256; ++k) {
+	  sprintf(path, "/sys/devices/system/node/node%d/cpulist", k);
+	  n = sysfs_cpulist(path, list, CPU_SETSIZE);
+	  for (i = 0; i < n; ++i)
+	       if (list[i] < CPU_SETSIZE)
+		    node_of[list[i]] = k;
+     }
+
+     for (cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+	  os_cpu_desc *c;
+	  if (!CPU_ISSET(cpu, &os_process_cpus)) continue;
+
+	  c = d + ncpus++;
+	  c->cpu = cpu;
+	  c->node = node_of[cpu];
+
+	  sprintf(path,
+		  "/sys/devices/system/cpu/cpu%d/cache/index3/shared_cpu_list",
+		  cpu);
+	  c->llc = sysfs_cpulist(path, list, CPU_SETSIZE) ? list[0] : 0;
+
+	  sprintf(path,
+		  "/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list",
+		  cpu);
+	  n = sysfs_cpulist(path, list, CPU_SETSIZE);
+	  for (c->smt = 0; c->smt < n && list[c->smt] != cpu; ++c->smt)
+	       ;
+	  if (c->smt == n) c->smt = 0;
+     }
+
+     qsort(d, (size_t)ncpus, sizeof(os_cpu_desc), os_cpu_desc_cmp);
+     if (ncpus > maxn) ncpus = maxn;
+     for (i = 0; i < ncpus; ++i)
+	  cpus[i] = d[i].cpu;
+
+     X(ifree)(d);
+     X(ifree)(node_of);
+     X(ifree)(list);
+     return ncpus;
+}
+#endif
+
 #elif defined(__WIN32__) || defined(_WIN32) || defined(_WINDOWS)
 /* hack: windef.h defines INT for its own purposes and this causes
    a conflict with our own INT in ifftw.h.  Divert the windows
@@ -245,6 +428,79 @@ static void os_static_mutex_unlock(os_static_mutex_t *s)
      LONG old = InterlockedExchange(s, 0);
      A(old == 1);
 }
+
+/* atomic operations, used by the work-stealing pool */
+#define HAVE_OS_ATOMICS 1
+typedef volatile LONG os_atomic_t;
+typedef volatile LONGLONG os_atomic64_t;
+
+static int os_atomic_load(os_atomic_t *p)
+{
+     return (int) InterlockedCompareExchange(p, 0, 0);
+}
+static void os_atomic_store(os_atomic_t *p, int v)
+{
+     InterlockedExchange(p, v);
+}
+static int os_atomic_xchg(os_atomic_t *p, int v)
+{
+     return (int) InterlockedExchange(p, v);
+}
+static int os_atomic_cas(os_atomic_t *p, int old, int new_)
+{
+     return InterlockedCompareExchange(p, new_, old) == old;
+}
+static int os_atomic_dec(os_atomic_t *p)
+{
+     return (int) InterlockedDecrement(p);
+}
+static unsigned long long os_atomic64_load(os_atomic64_t *p)
+{
+     return (unsigned long long) InterlockedCompareExchange64(p, 0, 0);
+}
+static void os_atomic64_store(os_atomic64_t *p, unsigned long long v)
+{
+     InterlockedExchange64(p, (LONGLONG) v);
+}
+static int os_atomic64_cas(os_atomic64_t *p, unsigned long long old,
+			   unsigned long long new_)
+{
+     return InterlockedCompareExchange64(p, (LONGLONG) new_, (LONGLONG) old)
+	  == (LONGLONG) old;
+}
+static void os_cpu_relax(void)
+{
+     YieldProcessor();
+}
+static void os_yield(void) { SwitchToThread(); }
+
+/* CPU affinity, used to place the workers of the pool.  Topology
+   discovery is not implemented, so only explicit CPU lists work. */
+#define HAVE_OS_AFFINITY 1
+
+static void os_affinity_init(void)
+{
+}
+
+static void os_bind_cpu(int cpu)
+{
+     DWORD_PTR process_mask, system_mask;
+
+     if (cpu < 0) {
+	  if (GetProcessAffinityMask(GetCurrentProcess(),
+				     &process_mask, &system_mask))
+	       SetThreadAffinityMask(GetCurrentThread(), process_mask);
+     } else if (cpu < (int)(8 * sizeof(DWORD_PTR))) {
+	  SetThreadAffinityMask(GetCurrentThread(), ((DWORD_PTR)1) << cpu);
+     }
+}
+
+static int os_discover_cpus(int *cpus, int maxn)
+{
+     UNUSED(cpus);
+     UNUSED(maxn);
+     return 0;
+}
 #else
 #error "No threading layer defined"
 #endif
@@ -373,13 +629,411 @@ static void kill_workforce(void)
      });
 }
 
+/************************************************************************/
+
+/* Work-stealing pool.
+
+   The semaphore-per-worker scheme above costs two semaphore round
+   trips per thread and per X(spawn_loop), and its static partition
+   of the loop lets one slow thread stall all the others.  The pool
+   below keeps a persistent set of workers that spin for a while
+   before parking on a semaphore, gives each participating thread a
+   deque holding its share of the iterations, and lets threads that
+   run out of work steal half of what is left in somebody else's
+   deque.  Iterations are claimed from the owner's deque in chunks.
+
+   A deque is a range [lo, hi) of iterations packed in a single
+   64-bit word, so that both the owner (which claims from the front)
+   and the thieves (which steal from the back) update it with a
+   compare-and-swap.
+
+   Only one loop at a time runs on the pool.  Nested or concurrent
+   calls to X(spawn_loop) fall back to the worker queue above.
+
+   With X(plan_with_affinity), worker i is bound to the i-th CPU of the
+   placement list.  The list groups CPUs that share an L3 cache, so
+   the contiguous ranges of iterations given to consecutive workers
+   stay within one CCX, and so do the first victims of a thief. */
+
+#ifdef HAVE_OS_ATOMICS
+
+#define WS_SPIN 2048    /* busy-wait iterations before yielding */
+#define WS_YIELD 64     /* yields before parking */
+#define WS_CHUNKS 4     /* chunks per initial share of a deque */
+#define WS_CACHE_LINE 64
+
+#define WS_PACK(lo, hi) \
+     (((unsigned long long) (unsigned) (hi) << 32) | (unsigned) (lo))
+#define WS_LO(r) ((int) (unsigned) ((r) & 0xffffffffULL))
+#define WS_HI(r) ((int) (unsigned) ((r) >> 32))
+
+typedef struct {
+     os_atomic64_t range;
+     char pad[WS_CACHE_LINE - sizeof(unsigned long long)];
+} ws_deque;
+
+struct ws_worker {
+     os_atomic_t seq;     /* incremented by the master for each job */
+     os_atomic_t parked;  /* nonzero while sleeping on WAKE */
+     int id;              /* index of the deque owned by this worker */
+     int cpu;             /* CPU to run on, or -1 for any */
+     int bound_cpu;       /* CPU the worker is currently bound to */
+     os_sem_t wake;
+};
+
+static struct {
+     struct ws_worker **workers;
+     int nworkers;
+     ws_deque *deques;
+     os_atomic_t busy;     /* nonzero while a loop runs on the pool */
+     os_atomic_t pending;  /* workers that have not finished the job */
+     os_sem_t done;        /* posted by the last worker to finish */
+
+     /* the current job */
+     spawn_function proc;
+     void *data;
+     int nthr, chunk;
+     spawn_data *single;   /* if nonzero, run proc(single) only */
+
+     /* placement of the workers */
+     int *cpus;
+     int ncpus;
+} pool;
+
+static int ws_cpu(int i)
+{
+     return pool.ncpus > 0 ? pool.cpus[i % pool.ncpus] : -1;
+}
+
+/* claim up to CHUNK iterations from the front of deque Q */
+static int ws_pop(ws_deque *q, int chunk, int *lo, int *hi)
+{
+     for (;;) {
+	  unsigned long long r = os_atomic64_load(&q->range);
+	  int l = WS_LO(r), h = WS_HI(r), m;
+
+	  if (l >= h) return 0;
+	  m = (h - l > chunk) ? l + chunk : h;
+	  if (os_atomic64_cas(&q->range, r, WS_PACK(m, h))) {
+	       *lo = l; *hi = m;
+	       return 1;
+	  }
+     }
+}
+
+/* steal the upper half of the iterations left in deque Q */
+static int ws_steal(ws_deque *q, int *lo, int *hi)
+{
+     for (;;) {
+	  unsigned long long r = os_atomic64_load(&q->range);
+	  int l = WS_LO(r), h = WS_HI(r), m;
+
+	  if (l >= h) return 0;
+	  m = h - (h - l + 1) / 2;
+	  if (os_atomic64_cas(&q->range, r, WS_PACK(l, m))) {
+	       *lo = m; *hi = h;
+	       return 1;
+	  }
+     }
+}
+
+/* execute iterations of the current job until none is left */
+static void ws_run(int self)
+{
+     int nthr = pool.nthr, v, lo, hi;
+     spawn_data d;
+
+     d.thr_num = self;
+     d.data = pool.data;
+
+     for (;;) {
+	  while (ws_pop(pool.deques + self, pool.chunk, &d.min, &d.max))
+	       pool.proc(&d);
+
+	  for (v = 1; v < nthr; ++v)
+	       if (ws_steal(pool.deques + (self + v) % nthr, &lo, &hi))
+		    break;
+	  if (v == nthr)
+	       return; /* all deques are empty */
+
+	  /* our deque is empty, so nobody else is touching it */
+	  os_atomic64_store(&pool.deques[self].range, WS_PACK(lo, hi));
+     }
+}
+
+/* wait until the master hands out a job with sequence number != SEEN */
+static void ws_wait(struct ws_worker *w, int seen)
+{
+     int spin;
+
+     /* spin, then yield the processor in case it is oversubscribed,
+	then park */
+     for (spin = 0; spin < WS_SPIN + WS_YIELD; ++spin) {
+	  if (os_atomic_load(&w->seq) != seen)
+	       return;
+	  if (spin < WS_SPIN)
+	       os_cpu_relax();
+	  else
+	       os_yield();
+     }
+
+     os_atomic_xchg(&w->parked, 1);
+     if (os_atomic_load(&w->seq) != seen && os_atomic_cas(&w->parked, 1, 0))
+	  return; /* the job arrived before we fell asleep */
+
+     /* either no job yet, or the master has already seen us parked
+	and posted WAKE */
+     os_sem_down(&w->wake);
+}
+
+static void ws_wake(struct ws_worker *w)
+{
+     os_atomic_store(&w->seq, w->seq + 1);
+     if (os_atomic_xchg(&w->parked, 0))
+	  os_sem_up(&w->wake);
+}
+
+static FFTW_WORKER ws_worker(void *arg)
+{
+     struct ws_worker *ego = (struct ws_worker *)arg;
+     int seen = 0;
+
+     for (;;) {
+	  ws_wait(ego, seen);
+	  seen = os_atomic_load(&ego->seq);
+
+	  /* !pool.proc ==> terminate worker */
+	  if (!pool.proc) break;
+
+#ifdef HAVE_OS_AFFINITY
+	  if (ego->cpu != ego->bound_cpu) {
+	       os_bind_cpu(ego->cpu);
+	       ego->bound_cpu = ego->cpu;
+	  }
+#endif
+
+	  if (pool.single)
+	       pool.proc(pool.single);
+	  else
+	       ws_run(ego->id);
+
+	  if (os_atomic_dec(&pool.pending) == 0)
+	       os_sem_up(&pool.done);
+     }
+
+     os_sem_up(&termination_semaphore);
+
+     os_destroy_thread();
+     /* UNREACHABLE */
+     return 0;
+}
+
+/* make sure that the pool has at least NWORKERS workers.  Must be
+   called with the pool busy, so that no worker is running a job. */
+static void ws_grow(int nworkers)
+{
+     struct ws_worker **workers;
+     int i;
+
+     if (nworkers <= pool.nworkers) return;
+
+     workers = (struct ws_worker **)
+	  MALLOC(sizeof(struct ws_worker *) * nworkers, OTHER);
+     for (i = 0; i < pool.nworkers; ++i)
+	  workers[i] = pool.workers[i];
+     if (pool.workers) X(ifree)(pool.workers);
+     pool.workers = workers;
+
+     if (pool.deques) X(ifree)(pool.deques);
+     pool.deques = (ws_deque *)
+	  MALLOC(sizeof(ws_deque) * (nworkers + 1), OTHER);
+
+     for (i = pool.nworkers; i < nworkers; ++i) {
+	  struct ws_worker *w =
+	       (struct ws_worker *)MALLOC(sizeof(*w), OTHER);
+	  w->seq = 0;
+	  w->parked = 0;
+	  w->id = i;
+	  w->cpu = ws_cpu(i);
+	  w->bound_cpu = -1;
+	  os_sem_init(&w->wake);
+	  workers[i] = w;
+	  os_create_thread(ws_worker, w);
+     }
+     pool.nworkers = nworkers;
+}
+
+/* wait until all workers have finished the current job */
+static void ws_join(void)
+{
+     int spin;
+
+     for (spin = 0; spin < WS_SPIN + WS_YIELD
+	       && os_atomic_load(&pool.pending); ++spin) {
+	  if (spin < WS_SPIN)
+	       os_cpu_relax();
+	  else
+	       os_yield();
+     }
+     os_sem_down(&pool.done);
+}
+
+/* run the loop on the pool.  Returns 0 if the pool is in use, in
+   which case the caller must run the loop by other means. */
+static int ws_spawn_loop(int loopmax, int nthr, int block_size,
+			 spawn_function proc, void *data)
+{
+     int i;
+
+     if (!os_atomic_cas(&pool.busy, 0, 1))
+	  return 0;
+
+     ws_grow(nthr - 1);
+
+     pool.proc = proc;
+     pool.data = data;
+     pool.nthr = nthr;
+     pool.chunk = X(imax)(1, block_size / WS_CHUNKS);
+     for (i = 0; i < nthr; ++i) {
+	  int lo = i * block_size;
+	  int hi = X(imin)(lo + block_size, loopmax);
+	  os_atomic64_store(&pool.deques[i].range, WS_PACK(lo, hi));
+     }
+     os_atomic_store(&pool.pending, nthr - 1);
+
+     /* workers 0..nthr-2 own the first nthr-1 deques, and we own the
+	last one */
+     for (i = 0; i < nthr - 1; ++i)
+	  ws_wake(pool.workers[i]);
+
+     ws_run(nthr - 1);
+     ws_join();
+
+     os_atomic_store(&pool.busy, 0);
+     return 1;
+}
+
+/* run proc(d) on worker W and wait for it.  Returns 0 if the pool is
+   in use. */
+static int ws_run_on(int w, spawn_function proc, spawn_data *d)
+{
+     if (!os_atomic_cas(&pool.busy, 0, 1))
+	  return 0;
+
+     ws_grow(w + 1);
+
+     pool.proc = proc;
+     pool.single = d;
+     os_atomic_store(&pool.pending, 1);
+     ws_wake(pool.workers[w]);
+     ws_join();
+     pool.single = 0;
+
+     os_atomic_store(&pool.busy, 0);
+     return 1;
+}
+
+static int ws_set_affinity(const int *cpus, int ncpus)
+{
+     int i;
+
+     if (pool.cpus) X(ifree)(pool.cpus);
+     pool.cpus = 0;
+     pool.ncpus = 0;
+
+#ifdef HAVE_OS_AFFINITY
+     if (ncpus > 0) {
+	  pool.cpus = (int *)MALLOC(sizeof(int) * ncpus, OTHER);
+	  if (cpus) {
+	       for (i = 0; i < ncpus; ++i)
+		    pool.cpus[i] = cpus[i];
+	  } else {
+	       ncpus = os_discover_cpus(pool.cpus, ncpus);
+	  }
+	  pool.ncpus = ncpus;
+	  if (!ncpus) {
+	       X(ifree)(pool.cpus);
+	       pool.cpus = 0;
+	  }
+     }
+#else
+     UNUSED(cpus);
+     UNUSED(ncpus);
+#endif
+
+     /* workers rebind themselves at their next job */
+     for (i = 0; i < pool.nworkers; ++i)
+	  pool.workers[i]->cpu = ws_cpu(i);
+
+     return pool.ncpus;
+}
+
+static void ws_init(void)
+{
+     pool.workers = 0;
+     pool.nworkers = 0;
+     pool.deques = 0;
+     pool.busy = 0;
+     pool.pending = 0;
+     pool.single = 0;
+     pool.cpus = 0;
+     pool.ncpus = 0;
+     os_sem_init(&pool.done);
+#ifdef HAVE_OS_AFFINITY
+     os_affinity_init();
+#endif
+}
+
+static void ws_cleanup(void)
+{
+     int i;
+
+     /* tell all workers that they must terminate */
+     pool.proc = 0;
+     for (i = 0; i < pool.nworkers; ++i) {
+	  struct ws_worker *w = pool.workers[i];
+	  ws_wake(w);
+	  os_sem_down(&termination_semaphore);
+	  os_sem_destroy(&w->wake);
+	  X(ifree)(w);
+     }
+     if (pool.workers) X(ifree)(pool.workers);
+     if (pool.deques) X(ifree)(pool.deques);
+     if (pool.cpus) X(ifree)(pool.cpus);
+     pool.workers = 0;
+     pool.deques = 0;
+     pool.nworkers = 0;
+     pool.cpus = 0;
+     pool.ncpus = 0;
+     os_sem_destroy(&pool.done);
+}
+
+#else /* !HAVE_OS_ATOMICS */
+
+#define ws_spawn_loop(loopmax, nthr, block_size, proc, data) 0
+#define ws_run_on(w, proc, d) 0
+static int ws_set_affinity(const int *cpus, int ncpus)
+{
+     UNUSED(cpus);
+     UNUSED(ncpus);
+     return 0;
+}
+static void ws_init(void) {}
+static void ws_cleanup(void) {}
+
+#endif /* HAVE_OS_ATOMICS */
+
 static os_static_mutex_t initialization_mutex = OS_STATIC_MUTEX_INITIALIZER;
 
+static os_mutex_t psearch_lock;
+
 int X(ithreads_init)(void)
 {
      os_static_mutex_lock(&initialization_mutex); {
           os_mutex_init(&queue_lock);
+          os_mutex_init(&psearch_lock);
           os_sem_init(&termination_semaphore);
+          ws_init();
 
           WITH_QUEUE_LOCK({
                worker_queue = 0;
@@ -395,6 +1049,9 @@ int X(ithreads_init)(void)
    that is executing proc (from 0 to nthreads-1), and d->data is
    the same as the data parameter passed to X(spawn_loop).
 
+   With the work-stealing scheduler, proc may be called several times
+   per thread, each time on a different range of iterations.
+
    This function returns only after all the threads have completed. */
 #ifdef AMD_FMV_AUTO
 __attribute__((target_clones(TARGET_STRINGS)))
@@ -403,6 +1060,7 @@ void X(spawn_loop)(int loopmax, int nthr, spawn_function proc, void *data)
 {
      int block_size;
      int i;
+     scratch_closure sc;
 
      A(loopmax >= 0);
      A(nthr > 0);
@@ -410,6 +1068,8 @@ void X(spawn_loop)(int loopmax, int nthr, spawn_function proc, void *data)
 
      if (!loopmax) return;
 
+     X(threads_scratch_closure)(&sc, &proc, &data);
+
      /* Choose the block size and number of threads in order to (1)
         minimize the critical path and (2) use the fewest threads that
         achieve the same critical path (to minimize overhead).
@@ -432,6 +1092,10 @@ void X(spawn_loop)(int loopmax, int nthr, spawn_function proc, void *data)
           X(spawnloop_callback)(proc, sdata, sizeof(spawn_data), nthr, X(spawnloop_callback_data));
           STACK_FREE(sdata);
      }
+     else if ((X(threads_work_stealing) || X(threads_affinity)) && nthr > 1
+	      && ws_spawn_loop(loopmax, nthr, block_size, proc, data)) {
+	  /* done by the work-stealing pool */
+     }
      else {
           struct work *r;
           STACK_MALLOC(struct work *, r, sizeof(struct work) * nthr);
@@ -471,9 +1135,60 @@ void X(spawn_loop)(int loopmax, int nthr, spawn_function proc, void *data)
      }
 }
 
+/* Like X(spawn_loop), but the blocks are executed one at a time, each
+   by the thread to which X(spawn_loop) initially assigns it.  The
+   threaded solvers awaken their children in this way when a thread
+   placement is in effect, so that the memory allocated by a child
+   (twiddle factors, buffers) is first touched, and hence placed, on
+   the CPU that works on that child. */
+void X(spawn_loop_serialized)(int loopmax, int nthr, spawn_function proc,
+			      void *data)
+{
+     int block_size;
+     int i;
+     spawn_data d;
+
+     A(loopmax >= 0);
+     A(nthr > 0);
+     A(proc);
+
+     if (!loopmax) return;
+
+     block_size = (loopmax + nthr - 1) / nthr;
+     nthr = (loopmax + block_size - 1) / block_size;
+
+     for (i = 0; i < nthr; ++i) {
+	  d.max = (d.min = i * block_size) + block_size;
+	  if (d.max > loopmax)
+	       d.max = loopmax;
+	  d.thr_num = i;
+	  d.data = data;
+
+	  /* the last block belongs to the calling thread */
+	  if (i == nthr - 1 || X(spawnloop_callback) || !X(threads_affinity)
+	      || !ws_run_on(i, proc, &d))
+	       proc(&d);
+     }
+}
+
+int X(ithreads_set_affinity)(const int *cpus, int ncpus)
+{
+     return ws_set_affinity(cpus, ncpus);
+}
+
+void X(ithreads_lock_psearch)(int lockp)
+{
+     if (lockp)
+	  os_mutex_lock(&psearch_lock);
+     else
+	  os_mutex_unlock(&psearch_lock);
+}
+
 void X(threads_cleanup)(void)
 {
+     ws_cleanup();
      kill_workforce();
+     os_mutex_destroy(&psearch_lock);
      os_mutex_destroy(&queue_lock);
      os_sem_destroy(&termination_semaphore);
 }
@@ -37,18 +37,46 @@ __attribute__((target_clones(TARGET_STRINGS)))
 #endif
 void X(spawn_loop)(int loopmax, int nthreads,
 		   spawn_function proc, void *data);
+void X(spawn_loop_serialized)(int loopmax, int nthreads,
+			      spawn_function proc, void *data);
 int X(ithreads_init)(void);
+int X(ithreads_set_affinity)(const int *cpus, int ncpus);
+void X(ithreads_lock_psearch)(int lockp);
 void X(threads_cleanup)(void);
 
 typedef void (*spawnloop_function)(spawn_function, spawn_data *, size_t, int, void *);
 extern spawnloop_function X(spawnloop_callback);
 extern void *X(spawnloop_callback_data);
 
+/* nonzero if X(spawn_loop) should use the work-stealing scheduler */
+extern int X(threads_work_stealing);
+INT X(threads_block_size)(INT n, int nthr);
+
+/* nonzero if the workers are bound to CPUs by X(plan_with_affinity) */
+extern int X(threads_affinity);
+void X(threads_awake_children)(plan **cldrn, int nblk, int nthr,
+			       enum wakefulness wakefulness);
+
+/* a loop whose blocks run within the scratch arena of the thread that
+   spawned it (see kernel/scratch.c) */
+typedef struct {
+     spawn_function proc;
+     void *data;
+     scratch_arena arena;
+} scratch_closure;
+void X(threads_scratch_closure)(scratch_closure *c,
+				spawn_function *proc, void **data);
+
+/* parallel search with NWORKERS worker planners (psearch.c) */
+void X(threads_psearch_init)(planner *plnr, int nworkers);
+void X(threads_psearch_cleanup)(void);
+
 /* configurations */
 
 void X(dft_thr_vrank_geq1_register)(planner *p);
 void X(rdft_thr_vrank_geq1_register)(planner *p);
 void X(rdft2_thr_vrank_geq1_register)(planner *p);
+void X(rdft_thr_transpose_register)(planner *p);
 
 ct_solver *X(mksolver_ct_threads)(size_t size, INT r, int dec,
 				  ct_mkinferior mkcldw,
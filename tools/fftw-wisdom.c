@@ -79,6 +79,7 @@ static struct my_option options[] =
   {"time-limit", REQARG, 't'},
 
   {"output-file", REQARG, 'o'},
+  {"binary", NOARG, 'b'},
 
   {"impatient", NOARG, 'i'},
   {"measure", NOARG, 'm'},
@@ -87,6 +88,7 @@ static struct my_option options[] =
 
   {"no-system-wisdom", NOARG, 'n'},
   {"wisdom-file", REQARG, 'w'},
+  {"binary-wisdom-file", REQARG, 'W'},
 
 #ifdef HAVE_SMP
   {"threads", REQARG, 'T'},
@@ -111,11 +113,13 @@ static void help(FILE *f, const char *program_name)
  "              -c, --canonical: plan/optimize canonical set of sizes\n"
  "     -t <h>, --time-limit=<h>: time limit in hours (default: 0, no limit)\n"
  "  -o FILE, --output-file=FILE: output to FILE instead of stdout\n"
+ "                 -b, --binary: output binary wisdom (requires -o)\n"
  "                -m, --measure: plan in MEASURE mode (PATIENT is default)\n"
  "               -e, --estimate: plan in ESTIMATE mode (not recommended)\n"
  "             -x, --exhaustive: plan in EXHAUSTIVE mode (may be slow)\n"
  "       -n, --no-system-wisdom: don't read /etc/fftw/ system wisdom file\n"
  "  -w FILE, --wisdom-file=FILE: read wisdom from FILE (stdin if -)\n"
+ "   -W FILE, --binary-wisdom-file=FILE: read binary wisdom from FILE\n"
 #ifdef HAVE_SMP
  "            -T N, --threads=N: plan with N threads\n"
 #endif
@@ -154,6 +158,7 @@ int bench_main(int argc, char *argv[])
      int impatient = 0;
      int system_wisdom = 1;
      int canonical = 0;
+     int binary = 0;
      double hours = 0;
      FILE *output_file;
      char *output_fname = 0;
@@ -227,6 +232,10 @@ int bench_main(int argc, char *argv[])
 		   }
 		   break;
 
+	      case 'b':
+		   binary = 1;
+		   break;
+
 	      case 'm':
 	      case 'i':
 		   impatient = 1;
@@ -262,6 +271,14 @@ int bench_main(int argc, char *argv[])
 		   break;
 	      }
 
+	      case 'W':
+		   if (!FFTW(import_wisdom_mmap)(my_optarg)) {
+			fprintf(stderr, "fftw_wisdom: error reading binary "
+				"wisdom from \"%s\"\n", my_optarg);
+			exit(EXIT_FAILURE);
+		   }
+		   break;
+
 #ifdef HAVE_SMP
 	      case 'T':
 		   nthreads = atoi(my_optarg);
@@ -324,7 +341,12 @@ int bench_main(int argc, char *argv[])
      nproblems = iproblem;
      qsort(problems, nproblems, sizeof(bench_problem *), prob_size_cmp);
 
-     if (!output_fname)
+     if (binary && !output_fname) {
+	  fprintf(stderr, "fftw-wisdom: binary output requires -o FILE\n");
+	  exit(EXIT_FAILURE);
+     }
+
+     if (!output_fname || binary)
 	  output_file = stdout;
      else
 	  if (!(output_file = fopen(output_fname, "w"))) {
@@ -348,7 +370,14 @@ int bench_main(int argc, char *argv[])
 	 && hours < (time((time_t*)0) - begin) / 3600.0)
 	  fprintf(stderr, "EXCEEDED TIME LIMIT OF %g HOURS.\n", hours);
 
-     FFTW(export_wisdom_to_file)(output_file);
+     if (binary) {
+	  if (!FFTW(export_wisdom_binary)(output_fname)) {
+	       fprintf(stderr,
+		       "fftw-wisdom: error writing \"%s\"\n", output_fname);
+	       exit(EXIT_FAILURE);
+	  }
+     } else
+	  FFTW(export_wisdom_to_file)(output_file);
      if (output_file != stdout)
 	  fclose(output_file);
      if (output_fname)